@@ -0,0 +1,51 @@
+#include "benchmark/benchmark_api.h"
+#include "emucore.h"
+#include "eminline.h"
+#include "attotime.h"
+
+// advance a normalized time in cycle-sized steps, as device_scheduler did per device
+static void BM_attotime_add_normalized(benchmark::State& state) {
+	attoseconds_t const per_cycle = HZ_TO_ATTOSECONDS(3'579'545);
+	attotime target(1, ATTOSECONDS_PER_SECOND / 2);
+	attotime local(1, 0);
+	u32 cycles = 1;
+	while (state.KeepRunning()) {
+		local += attotime(0, per_cycle * cycles);
+		if (local < target)
+			benchmark::DoNotOptimize(target = std::max(local, attotime(1, 0)));
+		else
+			local = attotime(1, 0);
+		cycles = (cycles * 5 + 1) & 0xff;
+	}
+}
+// Register the function as a benchmark
+BENCHMARK(BM_attotime_add_normalized);
+
+// the same walk tracked as an attosecond offset from a fixed base
+static void BM_attotime_add_offset(benchmark::State& state) {
+	attoseconds_t const per_cycle = HZ_TO_ATTOSECONDS(3'579'545);
+	attoseconds_t const target = ATTOSECONDS_PER_SECOND / 2;
+	attoseconds_t local = 0;
+	u32 cycles = 1;
+	while (state.KeepRunning()) {
+		local += per_cycle * cycles;
+		if (local < target)
+			benchmark::DoNotOptimize(local);
+		else
+			local = 0;
+		cycles = (cycles * 5 + 1) & 0xff;
+	}
+}
+// Register the function as a benchmark
+BENCHMARK(BM_attotime_add_offset);
+
+static void BM_attotime_from_ticks(benchmark::State& state) {
+	u64 ticks = 1;
+	while (state.KeepRunning()) {
+		benchmark::DoNotOptimize(attotime::from_ticks(ticks, 14'318'181));
+		ticks = ticks * 3 + 1;
+		ticks &= 0xffffffffULL;
+	}
+}
+// Register the function as a benchmark
+BENCHMARK(BM_attotime_from_ticks);
@@ -0,0 +1,44 @@
+#include "benchmark/benchmark_api.h"
+#include "avhuff.h"
+
+#include <vector>
+
+// a field of smoothly varying video, roughly like a laserdisc frame
+static std::vector<uint8_t> make_avhuff_input(int width, int height)
+{
+	bitmap_yuy16 bitmap(width, height);
+	uint32_t seed = 0x87654321;
+	for (int y = 0; y < height; y++)
+	{
+		uint16_t *dest = &bitmap.pix(y);
+		for (int x = 0; x < width; x++)
+		{
+			seed = seed * 1103515245 + 12345;
+			uint8_t const luma = uint8_t(((x + y) >> 2) + ((seed >> 16) & 0x03));
+			uint8_t const chroma = uint8_t(0x80 + ((x >> 4) & 0x0f));
+			dest[x] = (luma << 8) | chroma;
+		}
+	}
+
+	std::vector<uint8_t> raw;
+	avhuff_encoder::assemble_data(raw, bitmap, 0, 0, nullptr);
+	return raw;
+}
+
+static void BM_avhuff_decode(benchmark::State& state) {
+	int const width = 720;
+	int const height = int(state.range(0));
+	std::vector<uint8_t> const raw(make_avhuff_input(width, height));
+	std::vector<uint8_t> compressed(raw.size());
+	std::vector<uint8_t> output(raw.size());
+	uint32_t complen = 0;
+	avhuff_encoder encoder;
+	encoder.encode_data(raw.data(), compressed.data(), complen);
+	while (state.KeepRunning()) {
+		avhuff_decoder decoder;
+		benchmark::DoNotOptimize(decoder.decode_data(compressed.data(), complen, output.data()));
+	}
+	state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(width * height * 2));
+}
+// Register the function as a benchmark
+BENCHMARK(BM_avhuff_decode)->Arg(240)->Arg(480);
@@ -0,0 +1,110 @@
+#include "benchmark/benchmark_api.h"
+#include "chd.h"
+#include "chdcodec.h"
+#include "ioprocs.h"
+
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+constexpr uint32_t HUNK_BYTES = 4096 * 4;
+
+// a hunk of moderately compressible data: runs, small deltas and some noise
+std::vector<uint8_t> make_chd_hunk()
+{
+	std::vector<uint8_t> hunk(HUNK_BYTES);
+	uint32_t seed = 0x87654321;
+	uint8_t value = 0;
+	for (size_t i = 0; i < hunk.size(); i++)
+	{
+		seed = seed * 1103515245 + 12345;
+		uint32_t const r = seed >> 16;
+		if ((r & 0x1f) == 0)
+			value = uint8_t(r >> 8);
+		else if ((r & 0x03) == 0)
+			value += uint8_t((r >> 4) & 0x07) - 3;
+		hunk[i] = value;
+	}
+	return hunk;
+}
+
+// codecs need an open CHD for their geometry; back it with a temporary file
+bool make_chd(chd_file &chd, chd_codec_type type)
+{
+	FILE *const file = std::tmpfile();
+	if (!file)
+		return false;
+	util::random_read_write::ptr io = util::stdio_read_write(file);
+	if (!io)
+	{
+		std::fclose(file);
+		return false;
+	}
+	chd_codec_type compression[4] = { type, CHD_CODEC_NONE, CHD_CODEC_NONE, CHD_CODEC_NONE };
+	return !chd.create(std::move(io), HUNK_BYTES * 16, HUNK_BYTES, 4, compression);
+}
+
+} // anonymous namespace
+
+static void BM_chd_compress(benchmark::State& state, chd_codec_type type) {
+	chd_file chd;
+	if (!make_chd(chd, type)) {
+		state.SkipWithError("cannot create CHD");
+		return;
+	}
+	std::vector<uint8_t> const hunk(make_chd_hunk());
+	std::vector<uint8_t> compressed(HUNK_BYTES);
+	chd_compressor::ptr compressor(chd_codec_list::new_compressor(type, chd));
+	while (state.KeepRunning()) {
+		try {
+			benchmark::DoNotOptimize(compressor->compress(hunk.data(), HUNK_BYTES, compressed.data()));
+		} catch (...) {
+			state.SkipWithError("hunk not compressible");
+			break;
+		}
+	}
+	state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(HUNK_BYTES));
+}
+
+static void BM_chd_decompress(benchmark::State& state, chd_codec_type type) {
+	chd_file chd;
+	if (!make_chd(chd, type)) {
+		state.SkipWithError("cannot create CHD");
+		return;
+	}
+	std::vector<uint8_t> const hunk(make_chd_hunk());
+	std::vector<uint8_t> compressed(HUNK_BYTES);
+	std::vector<uint8_t> output(HUNK_BYTES);
+	uint32_t complen;
+	try {
+		complen = chd_codec_list::new_compressor(type, chd)->compress(hunk.data(), HUNK_BYTES, compressed.data());
+	} catch (...) {
+		state.SkipWithError("hunk not compressible");
+		return;
+	}
+	chd_decompressor::ptr decompressor(chd_codec_list::new_decompressor(type, chd));
+	while (state.KeepRunning()) {
+		decompressor->decompress(compressed.data(), complen, output.data(), HUNK_BYTES);
+		benchmark::DoNotOptimize(output.data());
+	}
+	if (output != hunk)
+		state.SkipWithError("decompressed data does not match");
+	state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(HUNK_BYTES));
+}
+
+// Register the functions as benchmarks
+BENCHMARK_CAPTURE(BM_chd_compress, zlib, CHD_CODEC_ZLIB);
+BENCHMARK_CAPTURE(BM_chd_compress, lzma, CHD_CODEC_LZMA);
+BENCHMARK_CAPTURE(BM_chd_compress, huff, CHD_CODEC_HUFFMAN);
+BENCHMARK_CAPTURE(BM_chd_compress, flac, CHD_CODEC_FLAC);
+#if defined(USE_ZSTD)
+BENCHMARK_CAPTURE(BM_chd_compress, zstd, CHD_CODEC_ZSTD);
+#endif
+BENCHMARK_CAPTURE(BM_chd_decompress, zlib, CHD_CODEC_ZLIB);
+BENCHMARK_CAPTURE(BM_chd_decompress, lzma, CHD_CODEC_LZMA);
+BENCHMARK_CAPTURE(BM_chd_decompress, huff, CHD_CODEC_HUFFMAN);
+BENCHMARK_CAPTURE(BM_chd_decompress, flac, CHD_CODEC_FLAC);
+#if defined(USE_ZSTD)
+BENCHMARK_CAPTURE(BM_chd_decompress, zstd, CHD_CODEC_ZSTD);
+#endif
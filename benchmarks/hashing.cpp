@@ -0,0 +1,46 @@
+#include "benchmark/benchmark_api.h"
+#include "hashing.h"
+
+#include <vector>
+
+static std::vector<uint8_t> make_hash_buffer(size_t size)
+{
+	std::vector<uint8_t> buffer(size);
+	uint32_t seed = 0x12345678;
+	for (auto &b : buffer)
+	{
+		seed = seed * 1103515245 + 12345;
+		b = uint8_t(seed >> 16);
+	}
+	return buffer;
+}
+
+static void BM_crc32(benchmark::State& state) {
+	std::vector<uint8_t> const buffer(make_hash_buffer(state.range(0)));
+	while (state.KeepRunning()) {
+		benchmark::DoNotOptimize(util::crc32_creator::simple(buffer.data(), buffer.size()));
+	}
+	state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(buffer.size()));
+}
+// Register the function as a benchmark
+BENCHMARK(BM_crc32)->Range(64, 1 << 20);
+
+static void BM_crc16(benchmark::State& state) {
+	std::vector<uint8_t> const buffer(make_hash_buffer(state.range(0)));
+	while (state.KeepRunning()) {
+		benchmark::DoNotOptimize(util::crc16_creator::simple(buffer.data(), buffer.size()));
+	}
+	state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(buffer.size()));
+}
+// Register the function as a benchmark
+BENCHMARK(BM_crc16)->Range(64, 1 << 20);
+
+static void BM_sha1(benchmark::State& state) {
+	std::vector<uint8_t> const buffer(make_hash_buffer(state.range(0)));
+	while (state.KeepRunning()) {
+		benchmark::DoNotOptimize(util::sha1_creator::simple(buffer.data(), buffer.size()));
+	}
+	state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(buffer.size()));
+}
+// Register the function as a benchmark
+BENCHMARK(BM_sha1)->Range(64, 1 << 20);
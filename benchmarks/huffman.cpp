@@ -0,0 +1,48 @@
+#include "benchmark/benchmark_api.h"
+#include "huffman.h"
+
+#include <vector>
+
+// skewed distribution, roughly like the deltas CHD codecs feed through huffman
+static std::vector<uint8_t> make_huffman_input(size_t size)
+{
+	std::vector<uint8_t> buffer(size);
+	uint32_t seed = 0x87654321;
+	for (auto &b : buffer)
+	{
+		seed = seed * 1103515245 + 12345;
+		uint32_t const r = seed >> 16;
+		b = uint8_t((r & 0x0f) ? (r & 0x07) : (r >> 8));
+	}
+	return buffer;
+}
+
+static void BM_huffman_encode(benchmark::State& state) {
+	std::vector<uint8_t> const input(make_huffman_input(state.range(0)));
+	std::vector<uint8_t> output(input.size() * 2 + 1024);
+	while (state.KeepRunning()) {
+		huffman_8bit_encoder encoder;
+		uint32_t complen;
+		benchmark::DoNotOptimize(encoder.encode(input.data(), input.size(), output.data(), output.size(), complen));
+		benchmark::DoNotOptimize(complen);
+	}
+	state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(input.size()));
+}
+// Register the function as a benchmark
+BENCHMARK(BM_huffman_encode)->Range(4 << 10, 256 << 10);
+
+static void BM_huffman_decode(benchmark::State& state) {
+	std::vector<uint8_t> const input(make_huffman_input(state.range(0)));
+	std::vector<uint8_t> compressed(input.size() * 2 + 1024);
+	std::vector<uint8_t> output(input.size());
+	uint32_t complen = 0;
+	huffman_8bit_encoder encoder;
+	encoder.encode(input.data(), input.size(), compressed.data(), compressed.size(), complen);
+	while (state.KeepRunning()) {
+		huffman_8bit_decoder decoder;
+		benchmark::DoNotOptimize(decoder.decode(compressed.data(), complen, output.data(), output.size()));
+	}
+	state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(input.size()));
+}
+// Register the function as a benchmark
+BENCHMARK(BM_huffman_decode)->Range(4 << 10, 256 << 10);
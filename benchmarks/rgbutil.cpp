@@ -0,0 +1,61 @@
+#include "benchmark/benchmark_api.h"
+#include "emucore.h"
+#include "video/rgbutil.h"
+
+static void BM_rgbaint_blend(benchmark::State& state) {
+	rgbaint_t dst(0x80402010);
+	rgbaint_t const src(0x10204080);
+	u8 factor = 0;
+	while (state.KeepRunning()) {
+		rgbaint_t value(dst);
+		value.blend(src, factor++);
+		benchmark::DoNotOptimize(value);
+	}
+}
+// Register the function as a benchmark
+BENCHMARK(BM_rgbaint_blend);
+
+static void BM_rgbaint_scale_and_clamp(benchmark::State& state) {
+	rgbaint_t const scale(0x100, 0x80, 0x1c0, 0x40);
+	u32 color = 0x11223344;
+	while (state.KeepRunning()) {
+		rgbaint_t value(color++);
+		value.scale_and_clamp(scale);
+		benchmark::DoNotOptimize(value.to_rgba_clamp());
+	}
+}
+// Register the function as a benchmark
+BENCHMARK(BM_rgbaint_scale_and_clamp);
+
+static void BM_rgbaint_scale_add_and_clamp(benchmark::State& state) {
+	rgbaint_t const scale(0x100, 0x80, 0x1c0, 0x40);
+	rgbaint_t const other(0x10, 0x20, 0x30, 0x40);
+	u32 color = 0x11223344;
+	while (state.KeepRunning()) {
+		rgbaint_t value(color++);
+		value.scale_add_and_clamp(scale, other);
+		benchmark::DoNotOptimize(value.to_rgba_clamp());
+	}
+}
+// Register the function as a benchmark
+BENCHMARK(BM_rgbaint_scale_add_and_clamp);
+
+static void BM_rgbaint_bilinear_filter(benchmark::State& state) {
+	u8 u = 0, v = 0x55;
+	while (state.KeepRunning()) {
+		benchmark::DoNotOptimize(rgbaint_t::bilinear_filter(0xff102030, 0x80405060, 0x40708090, 0x20a0b0c0, u++, v--));
+	}
+}
+// Register the function as a benchmark
+BENCHMARK(BM_rgbaint_bilinear_filter);
+
+static void BM_rgbaint_bilinear_filter_rgbaint(benchmark::State& state) {
+	rgbaint_t value;
+	u8 u = 0, v = 0x55;
+	while (state.KeepRunning()) {
+		value.bilinear_filter_rgbaint(0xff102030, 0x80405060, 0x40708090, 0x20a0b0c0, u++, v--);
+		benchmark::DoNotOptimize(value);
+	}
+}
+// Register the function as a benchmark
+BENCHMARK(BM_rgbaint_bilinear_filter_rgbaint);
@@ -20,7 +20,7 @@ nscsi_harddisk_device::nscsi_harddisk_device(const machine_config &mconfig, cons
 }
 
 nscsi_harddisk_device::nscsi_harddisk_device(const machine_config &mconfig, device_type type, const char *tag, device_t *owner, uint32_t clock) :
-	nscsi_full_device(mconfig, type, tag, owner, clock), image(*this, "image"), lba(0), cur_lba(0), blocks(0), bytes_per_sector(0)
+	nscsi_full_device(mconfig, type, tag, owner, clock), image(*this, "image"), lba(0), cur_lba(0), blocks(0), bytes_per_sector(0), m_read_ahead_lba(0), m_read_ahead_count(0)
 {
 }
 
@@ -46,6 +46,7 @@ void nscsi_harddisk_device::device_reset()
 		image->get_inquiry_data(m_inquiry_data);
 	}
 	cur_lba = -1;
+	m_read_ahead_count = 0;
 }
 
 void nscsi_harddisk_device::device_add_mconfig(machine_config &config)
@@ -65,7 +66,17 @@ uint8_t nscsi_harddisk_device::scsi_get_data(int id, int pos)
 		int clba = lba + pos / bytes_per_sector;
 		if(clba != cur_lba) {
 			cur_lba = clba;
-			if(!image->read(cur_lba, block)) {
+			if(clba < m_read_ahead_lba || clba >= m_read_ahead_lba + m_read_ahead_count) {
+				// fetch as much of the rest of the transfer as fits in one go
+				int count = std::min<int>(lba + blocks - clba, sizeof(m_read_ahead) / bytes_per_sector);
+				if(count < 1)
+					count = 1;
+				m_read_ahead_lba = clba;
+				m_read_ahead_count = image->read(clba, m_read_ahead, count) ? count : 0;
+			}
+			if(m_read_ahead_count) {
+				memcpy(block, &m_read_ahead[(clba - m_read_ahead_lba) * bytes_per_sector], bytes_per_sector);
+			} else {
 				LOG("HD READ ERROR !\n");
 				memset(block, 0, sizeof(block));
 			}
@@ -95,6 +106,8 @@ void nscsi_harddisk_device::scsi_put_data(int id, int pos, uint8_t data)
 
 void nscsi_harddisk_device::scsi_command()
 {
+	m_read_ahead_count = 0;
+
 	if(scsi_cmdbuf[0] != SC_READ_6) {
 		LOGMASKED(LOG_COMMAND, "%02x %02x %02x %02x %02x %02x\n",
 			scsi_cmdbuf[0], scsi_cmdbuf[1], scsi_cmdbuf[2],
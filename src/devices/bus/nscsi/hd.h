@@ -29,6 +29,11 @@ protected:
 	int lba, cur_lba, blocks;
 	int bytes_per_sector;
 
+	// sectors read from the image ahead of a data-in transfer, dropped when a new command starts
+	static constexpr int READ_AHEAD_SECTORS = 16;
+	uint8_t m_read_ahead[READ_AHEAD_SECTORS * 512];
+	int m_read_ahead_lba, m_read_ahead_count;
+
 	std::vector<u8> m_inquiry_data;
 };
 
@@ -85,11 +85,15 @@ void nscsi_s1410_device::scsi_command()
 		LOG("command FORMAT UNIT\n");
 		{
 			const auto &info = image->get_info();
-			auto block = std::make_unique<uint8_t[]>(info.sectorbytes);
-			memset(&block[0], 0x6c, info.sectorbytes);
+			auto block = std::make_unique<uint8_t[]>(info.sectorbytes * info.sectors);
+			memset(&block[0], 0x6c, info.sectorbytes * info.sectors);
 			lba = ((scsi_cmdbuf[1] & 0x1f)<<16) | (scsi_cmdbuf[2]<<8) | scsi_cmdbuf[3];
-			for(; lba < (info.cylinders * info.heads * info.sectors); lba++) {
-				image->write(lba, block.get());
+			int const end = info.cylinders * info.heads * info.sectors;
+			while(lba < end) {
+				// a track at a time
+				int const count = std::min<int>(end - lba, info.sectors);
+				image->write(lba, block.get(), count);
+				lba += count;
 			}
 		}
 		scsi_status_complete(SS_GOOD);
@@ -109,7 +113,7 @@ void nscsi_s1410_device::scsi_command()
 		auto block = std::make_unique<uint8_t[]>(track_length);
 		memset(&block[0], 0x6c, track_length);
 
-		if(!image->write(lba, &block[0])) {
+		if(!image->write(lba, &block[0], blocks)) {
 			logerror("%s: HD WRITE ERROR !\n", tag());
 			scsi_status_complete(SS_FORMAT_ERROR);
 			scsi_sense_buffer[0] = SK_FORMAT_ERROR;
@@ -422,8 +422,8 @@ void adsp21xx_device::device_start()
 {
 	// get our address spaces
 	space(AS_PROGRAM).cache(m_cache);
-	space(AS_PROGRAM).specific(m_program);
-	space(AS_DATA).specific(m_data);
+	space(AS_PROGRAM).cache(m_program);
+	space(AS_DATA).cache(m_data);
 	if(has_space(AS_IO))
 		space(AS_IO).specific(m_io);
 
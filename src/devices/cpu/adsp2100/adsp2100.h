@@ -436,8 +436,8 @@ protected:
 
 	// address spaces
 	memory_access<14, 2, -2, ENDIANNESS_LITTLE>::cache m_cache;
-	memory_access<14, 2, -2, ENDIANNESS_LITTLE>::specific m_program;
-	memory_access<14, 1, -1, ENDIANNESS_LITTLE>::specific m_data;
+	memory_access<14, 2, -2, ENDIANNESS_LITTLE>::cache m_program;
+	memory_access<14, 1, -1, ENDIANNESS_LITTLE>::cache m_data;
 	memory_access<11, 1, -1, ENDIANNESS_LITTLE>::specific m_io;
 
 	// tables
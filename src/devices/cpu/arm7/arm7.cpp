@@ -94,6 +94,8 @@ arm7_cpu_device::arm7_cpu_device(const machine_config &mconfig, device_type type
 	, m_vectorbase(0)
 	, m_pc(0)
 {
+	m_program_config.m_flat_access = true;
+
 	std::fill(std::begin(m_r), std::end(m_r), 0);
 	uint32_t arch = ARM9_COPRO_ID_ARCH_V4;
 	if (m_archFlags & ARCHFLAG_T)
@@ -939,10 +941,12 @@ void arm7_cpu_device::device_start()
 
 	if(m_program->endianness() == ENDIANNESS_LITTLE) {
 		m_program->cache(m_cachele);
+		m_program->specific(m_specificle);
 		m_pr32 = [this](offs_t address) -> u32 { return m_cachele.read_dword(address); };
 		m_prptr = [this](offs_t address) -> const void * { return m_cachele.read_ptr(address); };
 	} else {
 		m_program->cache(m_cachebe);
+		m_program->specific(m_specificbe);
 		m_pr32 = [this](offs_t address) -> u32 { return m_cachebe.read_dword(address); };
 		m_prptr = [this](offs_t address) -> const void * { return m_cachebe.read_ptr(address); };
 	}
@@ -2083,7 +2087,7 @@ void arm946es_cpu_device::arm7_cpu_write32(uint32_t addr, uint32_t data)
 		return;
 	}
 
-	m_program->write_dword(addr, data);
+	program_write32(addr, data);
 }
 
 
@@ -2103,7 +2107,7 @@ void arm946es_cpu_device::arm7_cpu_write16(uint32_t addr, uint16_t data)
 		return;
 	}
 
-	m_program->write_word(addr, data);
+	program_write16(addr, data);
 }
 
 void arm946es_cpu_device::arm7_cpu_write8(uint32_t addr, uint8_t data)
@@ -2119,7 +2123,7 @@ void arm946es_cpu_device::arm7_cpu_write8(uint32_t addr, uint8_t data)
 		return;
 	}
 
-	m_program->write_byte(addr, data);
+	program_write8(addr, data);
 }
 
 uint32_t arm946es_cpu_device::arm7_cpu_read32(uint32_t addr)
@@ -2156,11 +2160,11 @@ uint32_t arm946es_cpu_device::arm7_cpu_read32(uint32_t addr)
 	{
 		if (addr & 3)
 		{
-			result = rotr_32(m_program->read_dword(addr & ~3), 8 * (addr & 3));
+			result = rotr_32(program_read32(addr & ~3), 8 * (addr & 3));
 		}
 		else
 		{
-			result = m_program->read_dword(addr);
+			result = program_read32(addr);
 		}
 	}
 	return result;
@@ -2181,7 +2185,7 @@ uint32_t arm946es_cpu_device::arm7_cpu_read16(uint32_t addr)
 		return *wp;
 	}
 
-	return m_program->read_word(addr);
+	return program_read16(addr);
 }
 
 uint8_t arm946es_cpu_device::arm7_cpu_read8(uint32_t addr)
@@ -2196,7 +2200,7 @@ uint8_t arm946es_cpu_device::arm7_cpu_read8(uint32_t addr)
 	}
 
 	// Handle through normal 8 bit handler (for 32 bit cpu)
-	return m_program->read_byte(addr);
+	return program_read8(addr);
 }
 
 void arm7_cpu_device::arm7_dt_r_callback(uint32_t insn, uint32_t *prn)
@@ -2281,7 +2285,7 @@ void arm7_cpu_device::arm7_cpu_write32(uint32_t addr, uint32_t data)
 	}
 
 	addr &= ~3;
-	m_program->write_dword(addr, data);
+	program_write32(addr, data);
 }
 
 
@@ -2296,7 +2300,7 @@ void arm7_cpu_device::arm7_cpu_write16(uint32_t addr, uint16_t data)
 	}
 
 	addr &= ~1;
-	m_program->write_word(addr, data);
+	program_write16(addr, data);
 }
 
 void arm7_cpu_device::arm7_cpu_write8(uint32_t addr, uint8_t data)
@@ -2309,7 +2313,7 @@ void arm7_cpu_device::arm7_cpu_write8(uint32_t addr, uint8_t data)
 		}
 	}
 
-	m_program->write_byte(addr, data);
+	program_write8(addr, data);
 }
 
 uint32_t arm7_cpu_device::arm7_cpu_read32(uint32_t addr)
@@ -2326,11 +2330,11 @@ uint32_t arm7_cpu_device::arm7_cpu_read32(uint32_t addr)
 
 	if (addr & 3)
 	{
-		result = rotr_32(m_program->read_dword(addr & ~3), 8 * (addr & 3));
+		result = rotr_32(program_read32(addr & ~3), 8 * (addr & 3));
 	}
 	else
 	{
-		result = m_program->read_dword(addr);
+		result = program_read32(addr);
 	}
 
 	return result;
@@ -2348,7 +2352,7 @@ uint32_t arm7_cpu_device::arm7_cpu_read16(uint32_t addr)
 		}
 	}
 
-	result = m_program->read_word(addr & ~1);
+	result = program_read16(addr & ~1);
 
 	if (addr & 1)
 	{
@@ -2369,7 +2373,7 @@ uint8_t arm7_cpu_device::arm7_cpu_read8(uint32_t addr)
 	}
 
 	// Handle through normal 8 bit handler (for 32 bit cpu)
-	return m_program->read_byte(addr);
+	return program_read8(addr);
 }
 
 #include "arm7drc.hxx"
@@ -143,6 +143,8 @@ protected:
 	address_space_config m_program_config;
 	memory_access<32, 2, 0, ENDIANNESS_LITTLE>::cache m_cachele;
 	memory_access<32, 2, 0, ENDIANNESS_BIG>::cache m_cachebe;
+	memory_access<32, 2, 0, ENDIANNESS_LITTLE>::specific m_specificle;
+	memory_access<32, 2, 0, ENDIANNESS_BIG>::specific m_specificbe;
 
 	uint32_t m_r[/*NUM_REGS*/37];
 
@@ -281,6 +283,14 @@ protected:
 	virtual uint32_t arm7_cpu_read16(uint32_t addr);
 	virtual uint8_t arm7_cpu_read8(uint32_t addr);
 
+	// physical data accesses, bypassing the address space virtual calls
+	u32 program_read32(offs_t addr) { return (m_endian == ENDIANNESS_LITTLE) ? m_specificle.read_dword(addr) : m_specificbe.read_dword(addr); }
+	u16 program_read16(offs_t addr) { return (m_endian == ENDIANNESS_LITTLE) ? m_specificle.read_word(addr) : m_specificbe.read_word(addr); }
+	u8 program_read8(offs_t addr) { return (m_endian == ENDIANNESS_LITTLE) ? m_specificle.read_byte(addr) : m_specificbe.read_byte(addr); }
+	void program_write32(offs_t addr, u32 data) { if (m_endian == ENDIANNESS_LITTLE) m_specificle.write_dword(addr, data); else m_specificbe.write_dword(addr, data); }
+	void program_write16(offs_t addr, u16 data) { if (m_endian == ENDIANNESS_LITTLE) m_specificle.write_word(addr, data); else m_specificbe.write_word(addr, data); }
+	void program_write8(offs_t addr, u8 data) { if (m_endian == ENDIANNESS_LITTLE) m_specificle.write_byte(addr, data); else m_specificbe.write_byte(addr, data); }
+
 	// Coprocessor support
 	void arm7_do_callback(uint32_t data);
 	virtual uint32_t arm7_rt_r_callback(offs_t offset);
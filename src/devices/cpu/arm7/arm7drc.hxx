@@ -134,7 +134,7 @@ void arm7_cpu_device::arm7_drc_init()
 
 	/* allocate the implementation-specific state from the full cache */
 	m_impstate = arm7imp_state();
-	try { m_impstate.cache = std::make_unique<drc_cache>(CACHE_SIZE); }
+	try { m_impstate.cache = std::make_unique<drc_cache>(machine().config(), CACHE_SIZE); }
 	catch (std::bad_alloc const &) { throw emu_fatalerror("Unable to allocate cache of size %d\n", (uint32_t)(CACHE_SIZE)); }
 
 	/* initialize the UML generator */
@@ -46,6 +46,7 @@ lpc210x_device::lpc210x_device(const machine_config &mconfig, const char *tag, d
 	, m_program_config("program", ENDIANNESS_LITTLE, 32, 32, 0, address_map_constructor(FUNC(lpc210x_device::lpc2103_map), this))
 	, m_vic(*this, "vic")
 {
+	m_program_config.m_flat_access = true;
 }
 
 uint32_t lpc210x_device::arm_E01FC088_r()
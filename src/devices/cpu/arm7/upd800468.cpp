@@ -129,6 +129,7 @@ upd800468_device::upd800468_device(const machine_config &mconfig, const char *ta
 	, m_adc_cb(*this, 0x00), m_in_cb(*this, 0x00), m_out_cb(*this)
 	, m_ram_view(*this, "ramview")
 {
+	m_program_config.m_flat_access = true;
 }
 
 device_memory_interface::space_config_vector upd800468_device::memory_space_config() const
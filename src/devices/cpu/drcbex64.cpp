@@ -911,10 +911,16 @@ void drcbe_x64::reset()
 		x86log_disasm_code_range(m_log, "exit_point", m_exit, m_nocode);
 		x86log_disasm_code_range(m_log, "nocode_point", m_nocode, dst + bytes);
 	}
+	m_drcuml.code_generated(dst, bytes, "entry/exit glue");
 
 	// reset our hash tables
 	m_hash.reset();
 	m_hash.set_default_codeptr(m_nocode);
+
+	// all linked and unlinked call sites went with the cache
+	m_block_links.clear();
+	m_unlinked.clear();
+	m_linked.clear();
 }
 
 
@@ -940,6 +946,7 @@ void drcbe_x64::generate(drcuml_block &block, const instruction *instlist, uint3
 	// tell all of our utility objects that a block is beginning
 	m_hash.block_begin(block, instlist, numinst);
 	m_map.block_begin(block);
+	m_block_links.clear();
 
 	// compute the base by aligning the cache top to a cache line (assumed to be 64 bytes)
 	x86code *dst = (x86code *)(uint64_t(m_cache.top() + 63) & ~63);
@@ -998,9 +1005,13 @@ void drcbe_x64::generate(drcuml_block &block, const instruction *instlist, uint3
 	if (!bytes)
 		block.abort();
 
+	// chain fixed hashjmps to code that now exists
+	link_block(dst, instlist, numinst);
+
 	// log it
 	if (m_log != nullptr)
 		x86log_disasm_code_range(m_log, (blockname.empty()) ? "Unknown block" : blockname.c_str(), dst, dst + bytes);
+	m_drcuml.code_generated(dst, bytes, (blockname.empty()) ? "Unknown block" : blockname.c_str());
 
 	// tell all of our utility objects that the block is finished
 	m_hash.block_end(block);
@@ -1008,6 +1019,113 @@ void drcbe_x64::generate(drcuml_block &block, const instruction *instlist, uint3
 }
 
 
+//-------------------------------------------------
+//  link_block - patch the fixed hashjmps of a
+//  freshly emitted block, and any waiting on the
+//  entry points it provides
+//-------------------------------------------------
+
+void drcbe_x64::link_block(drccodeptr base, const instruction *instlist, uint32_t numinst)
+{
+	// call sites in this block go straight to their targets if they already exist
+	for (link_site const &site : m_block_links)
+	{
+		drccodeptr const start = base + site.start;
+		drccodeptr const end = base + site.end;
+		drccodeptr const target = m_hash.get_codeptr(site.key >> 32, uint32_t(site.key));
+		if (!target || (target == m_nocode) || !relink_site(site.key, start, end, target))
+			m_unlinked.emplace(site.key, std::make_pair(start, end));
+	}
+	m_block_links.clear();
+
+	// now resolve anything that was waiting for the entry points this block defines
+	for (uint32_t inum = 0; inum < numinst; inum++)
+	{
+		const instruction &inst = instlist[inum];
+		if (inst.opcode() == OP_HASH)
+		{
+			uint64_t const key = link_key(inst.param(0).immediate(), inst.param(1).immediate());
+			drccodeptr const target = m_hash.get_codeptr(key >> 32, uint32_t(key));
+
+			// sites already chained to an older definition of this entry point must follow it
+			auto const linked = m_linked.equal_range(key);
+			for (auto it = linked.first; linked.second != it; )
+			{
+				if (patch_link(it->second.start, it->second.end, target))
+				{
+					++it;
+				}
+				else
+				{
+					// can't reach the new target, so go back to calling through the hash table
+					size_t const length = it->second.end - it->second.start;
+					std::copy_n(it->second.original, length, it->second.start);
+					osd::invalidate_instruction_cache(it->second.start, length);
+					m_unlinked.emplace(key, std::make_pair(it->second.start, it->second.end));
+					it = m_linked.erase(it);
+				}
+			}
+
+			// sites waiting for this entry point can now be chained
+			auto const range = m_unlinked.equal_range(key);
+			for (auto it = range.first; range.second != it; )
+			{
+				if (relink_site(key, it->second.first, it->second.second, target))
+					it = m_unlinked.erase(it);
+				else
+					++it;
+			}
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  relink_site - chain a call site to its target,
+//  remembering the indirect call it replaces so it
+//  can be redirected if the target is redefined
+//-------------------------------------------------
+
+bool drcbe_x64::relink_site(uint64_t key, drccodeptr start, drccodeptr end, drccodeptr target)
+{
+	linked_site site;
+	if ((end - start) > std::size(site.original))
+		return false;
+
+	site.start = start;
+	site.end = end;
+	std::copy(start, end, site.original);
+	if (!patch_link(start, end, target))
+		return false;
+
+	m_linked.emplace(key, site);
+	return true;
+}
+
+
+//-------------------------------------------------
+//  patch_link - replace an indirect call through
+//  the hash table with a direct call, keeping the
+//  return address the same
+//-------------------------------------------------
+
+bool drcbe_x64::patch_link(drccodeptr start, drccodeptr end, drccodeptr target)
+{
+	// need room for a rel32 call, and the target must be in range
+	int64_t const delta = target - end;
+	if (((end - start) < 5) || (delta != int32_t(delta)))
+		return false;
+
+	// pad with NOPs in front so the call still returns to the same place
+	std::fill(start, end - 5, 0x90);
+	end[-5] = 0xe8;
+	int32_t const rel = int32_t(delta);
+	memcpy(end - 4, &rel, sizeof(rel));
+	osd::invalidate_instruction_cache(start, end - start);
+	return true;
+}
+
+
 //-------------------------------------------------
 //  hash_exists - return true if the given mode/pc
 //  exists in the hash table
@@ -1487,7 +1605,11 @@ void drcbe_x64::op_hashjmp(Assembler &a, const instruction &inst)
 		{
 			uint32_t l1val = (pcp.immediate() >> m_hash.l1shift()) & m_hash.l1mask();
 			uint32_t l2val = (pcp.immediate() >> m_hash.l2shift()) & m_hash.l2mask();
+			size_t const start = a.offset();
 			a.call(MABS(&m_hash.base()[modep.immediate()][l1val][l2val]));              // call  hash[modep][l1val][l2val]
+
+			// remember the call so it can be chained directly once the target exists
+			m_block_links.emplace_back(link_site{ link_key(modep.immediate(), pcp.immediate()), start, a.offset() });
 		}
 
 		// a fixed mode but variable PC
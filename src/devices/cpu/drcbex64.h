@@ -18,6 +18,8 @@
 
 #include "asmjit/src/asmjit/asmjit.h"
 
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 
@@ -227,6 +229,12 @@ private:
 
 	size_t emit(asmjit::CodeHolder &ch);
 
+	// block linking helpers
+	static uint64_t link_key(uint32_t mode, uint32_t pc) { return (uint64_t(mode) << 32) | pc; }
+	void link_block(drccodeptr base, const uml::instruction *instlist, uint32_t numinst);
+	static bool patch_link(drccodeptr start, drccodeptr end, drccodeptr target);
+	bool relink_site(uint64_t key, drccodeptr start, drccodeptr end, drccodeptr target);
+
 	// internal state
 	drc_hash_table          m_hash;                 // hash table state
 	drc_map_variables       m_map;                  // code map
@@ -241,6 +249,24 @@ private:
 	x86code *               m_exit;                 // exit point
 	x86code *               m_nocode;               // nocode handler
 
+	// a fixed hashjmp call site that can be patched to call its target directly
+	struct link_site
+	{
+		uint64_t            key;                    // target mode and PC
+		size_t              start;                  // offset of the indirect call
+		size_t              end;                    // offset of the return address
+	};
+	// a call site that has been patched, with the indirect call it replaced
+	struct linked_site
+	{
+		drccodeptr          start;                  // start of the patched call
+		drccodeptr          end;                    // return address
+		uint8_t             original[16];           // bytes of the indirect call
+	};
+	std::vector<link_site>  m_block_links;          // sites in the block being generated
+	std::unordered_multimap<uint64_t, std::pair<drccodeptr, drccodeptr> > m_unlinked; // sites waiting for a target
+	std::unordered_multimap<uint64_t, linked_site> m_linked; // sites calling their target directly
+
 	// state to live in the near cache
 	struct near_state
 	{
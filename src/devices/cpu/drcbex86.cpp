@@ -788,6 +788,7 @@ void drcbe_x86::reset()
 
 		m_logged_common = true;
 	}
+	m_drcuml.code_generated(dst, bytes, "entry/exit glue");
 
 	// reset our hash tables
 	m_hash.reset();
@@ -877,6 +878,7 @@ void drcbe_x86::generate(drcuml_block &block, const instruction *instlist, uint3
 	// log it
 	if (m_log != nullptr)
 		x86log_disasm_code_range(m_log, (blockname.empty()) ? "Unknown block" : blockname.c_str(), dst, dst + bytes);
+	m_drcuml.code_generated(dst, bytes, (blockname.empty()) ? "Unknown block" : blockname.c_str());
 
 	// tell all of our utility objects that the block is finished
 	m_hash.block_end(block);
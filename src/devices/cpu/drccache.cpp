@@ -11,6 +11,8 @@
 #include "emu.h"
 #include "drccache.h"
 
+#include "emuopts.h"
+
 #include <algorithm>
 
 
@@ -49,7 +51,9 @@ drc_cache::drc_cache(size_t bytes) :
 	m_codegen(nullptr),
 	m_size(m_cache.size()),
 	m_executable(false),
-	m_rwx(false)
+	m_rwx(false),
+	m_flush_count(0),
+	m_peak_bytes(0)
 {
 	// alignment and page size must be powers of two, cache must be page-aligned
 	assert(!(CACHE_ALIGNMENT & (CACHE_ALIGNMENT - 1)));
@@ -81,6 +85,33 @@ drc_cache::drc_cache(size_t bytes) :
 }
 
 
+//-------------------------------------------------
+//  drc_cache - constructor, allowing the size to
+//  be overridden by the user
+//-------------------------------------------------
+
+drc_cache::drc_cache(machine_config const &mconfig, size_t bytes) :
+	drc_cache(configured_size(mconfig, bytes))
+{
+}
+
+
+//-------------------------------------------------
+//  configured_size - apply any user size trumping
+//  the CPU's default
+//-------------------------------------------------
+
+size_t drc_cache::configured_size(machine_config const &mconfig, size_t bytes)
+{
+	size_t const megabytes = mconfig.options().drc_cache_size();
+	if (!megabytes)
+		return bytes;
+
+	// leave room for the near cache and at least a few maximum-size blocks
+	return std::max<size_t>(megabytes << 20, NEAR_CACHE_SIZE + (CODEGEN_MAX_BYTES * 4));
+}
+
+
 //-------------------------------------------------
 //  ~drc_cache - destructor
 //-------------------------------------------------
@@ -100,6 +131,11 @@ void drc_cache::flush()
 	// can't flush in the middle of codegen
 	assert(!m_codegen);
 
+	// keep statistics
+	m_peak_bytes = peak_code_bytes();
+	if (m_top != m_base)
+		++m_flush_count;
+
 	// just reset the top back to the base and re-seed
 	m_top = m_base;
 	codegen_init();
@@ -43,6 +43,7 @@ class drc_cache
 public:
 	// construction/destruction
 	drc_cache(size_t bytes);
+	drc_cache(machine_config const &mconfig, size_t bytes);
 	~drc_cache();
 
 	// getters
@@ -50,6 +51,11 @@ public:
 	drccodeptr base() const { return m_base; }
 	drccodeptr top() const { return m_top; }
 
+	// statistics
+	uint32_t flush_count() const { return m_flush_count; }
+	size_t code_bytes() const { return m_top - m_base; }
+	size_t peak_code_bytes() const { return std::max<size_t>(m_peak_bytes, m_top - m_base); }
+
 	// pointer checking
 	bool contains_pointer(const void *ptr) const { return ((const drccodeptr)ptr >= m_near && (const drccodeptr)ptr < m_near + m_size); }
 	bool contains_near_pointer(const void *ptr) const { return ((const drccodeptr)ptr >= m_near && (const drccodeptr)ptr < m_neartop); }
@@ -70,6 +76,8 @@ public:
 	void request_oob_codegen(drc_oob_delegate &&callback, void *param1 = nullptr, void *param2 = nullptr);
 
 private:
+	static size_t configured_size(machine_config const &mconfig, size_t bytes);
+
 	// largest block of code that can be generated at once
 	static constexpr size_t CODEGEN_MAX_BYTES = 131072;
 
@@ -95,6 +103,8 @@ private:
 	size_t const        m_size;             // size of the cache in bytes
 	bool                m_executable;       // whether cached code is currently executable
 	bool                m_rwx;              // whether pages can be simultaneously writable and executable
+	uint32_t            m_flush_count;      // number of times the cache has been flushed
+	size_t              m_peak_bytes;       // most code and temporary data held before a flush
 
 	// oob management
 	struct oob_handler
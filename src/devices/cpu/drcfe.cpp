@@ -18,6 +18,8 @@
 #include "emu.h"
 #include "drcfe.h"
 
+#include <type_traits>
+
 
 namespace {
 
@@ -26,6 +28,13 @@ namespace {
 //**************************************************************************
 
 constexpr u32 MAX_STACK_DEPTH = 100;
+constexpr u32 MAX_IDLE_LOOP_LENGTH = 8;
+
+// flags that mean a loop body can make progress on its own or can't be reasoned about
+constexpr u32 IDLE_LOOP_REJECT_FLAGS =
+		OPFLAG_WRITES_MEMORY | OPFLAG_CAN_TRIGGER_SW_INT | OPFLAG_CAN_EXPOSE_EXTERNAL_INT | OPFLAG_WILL_CAUSE_EXCEPTION |
+		OPFLAG_MODIFIES_TRANSLATION | OPFLAG_COMPILER_PAGE_FAULT | OPFLAG_COMPILER_UNMAPPED | OPFLAG_INVALID_OPCODE |
+		OPFLAG_CAN_CHANGE_MODES;
 
 
 
@@ -146,6 +155,14 @@ const opcode_desc *drc_frontend::describe_code(offs_t startpc)
 		}
 	}
 
+	// flag loops that only poll so the core can give up the rest of its timeslice there
+	for (offs_t pc = minpc; pc < maxpc; pc++)
+	{
+		opcode_desc *const desc = m_desc_array[pc - minpc];
+		if (desc && (desc->flags & OPFLAG_INTRABLOCK_BRANCH) && (desc->targetpc <= desc->pc))
+			mark_idle_loop(*desc, minpc);
+	}
+
 	// now build the list of descriptions in order
 	// first from startpc -> maxpc, then from minpc -> startpc
 	build_sequence(startpc - minpc, maxpc - minpc, OPFLAG_REDISPATCH);
@@ -376,6 +393,73 @@ void drc_frontend::accumulate_required_backwards(opcode_desc &desc, u32 *reqmask
 }
 
 
+//-------------------------------------------------
+//  mark_idle_loop - flag a short backward branch
+//  whose loop only polls: no stores, nothing that
+//  can raise an exception or change modes, and no
+//  register carried from one iteration to the
+//  next, so every iteration does the same thing
+//  until something outside the CPU changes
+//-------------------------------------------------
+
+void drc_frontend::mark_idle_loop(opcode_desc &branch, offs_t minpc)
+{
+	if (branch.skipslots != 0)
+		return;
+
+	// gather the loop body in execution order, ending with the branch and its delay slots
+	opcode_desc const *body[MAX_IDLE_LOOP_LENGTH + 1];
+	u32 count = 0;
+	for (offs_t pc = branch.targetpc; pc != branch.pc; )
+	{
+		opcode_desc const *const desc = m_desc_array[pc - minpc];
+		if (!desc || !desc->length || (desc->flags & OPFLAG_IS_BRANCH) || desc->skipslots || (count == MAX_IDLE_LOOP_LENGTH))
+			return;
+		body[count++] = desc;
+		pc += desc->length;
+		if (pc > branch.pc)
+			return;
+	}
+	body[count++] = &branch;
+	for (opcode_desc const &slot : branch.delay)
+	{
+		if ((slot.flags & OPFLAG_IS_BRANCH) || (count > MAX_IDLE_LOOP_LENGTH))
+			return;
+		body[count++] = &slot;
+	}
+
+	constexpr unsigned REGWORDS = std::extent_v<decltype(opcode_desc::regout)>;
+	u32 written[REGWORDS] = { 0 };
+	bool polls = false;
+	for (u32 index = 0; index < count; index++)
+	{
+		if (body[index]->flags & IDLE_LOOP_REJECT_FLAGS)
+			return;
+		polls = polls || (body[index]->flags & OPFLAG_READS_MEMORY);
+		for (unsigned regnum = 0; regnum < REGWORDS; regnum++)
+			written[regnum] |= body[index]->regout[regnum];
+	}
+
+	// a register read before the body writes it would carry state between iterations (a counter, say)
+	bool writes = false;
+	u32 defined[REGWORDS] = { 0 };
+	for (u32 index = 0; index < count; index++)
+	{
+		for (unsigned regnum = 0; regnum < REGWORDS; regnum++)
+		{
+			if (body[index]->regin[regnum] & written[regnum] & ~defined[regnum])
+				return;
+			defined[regnum] |= body[index]->regout[regnum];
+			writes = writes || written[regnum];
+		}
+	}
+
+	// something has to be polled unless it's a bare spin
+	if (polls || !writes)
+		branch.flags |= OPFLAG_IDLE_LOOP;
+}
+
+
 //-------------------------------------------------
 //  release_descriptions - release any
 //  descriptions we've allocated back to the
@@ -76,6 +76,7 @@ constexpr u32 OPFLAG_CAN_CHANGE_MODES        = 0x00080000;       // instruction
 // execution semantics
 constexpr u32 OPFLAG_READS_MEMORY            = 0x00100000;       // instruction reads memory
 constexpr u32 OPFLAG_WRITES_MEMORY           = 0x00200000;       // instruction writes memory
+constexpr u32 OPFLAG_IDLE_LOOP               = 0x00400000;       // instruction is the backward branch of a loop that only polls
 
 
 
@@ -145,6 +146,7 @@ private:
 	opcode_desc *describe_one(offs_t curpc, opcode_desc const *prevdesc, bool in_delay_slot = false);
 	void build_sequence(int start, int end, u32 endflag);
 	void accumulate_required_backwards(opcode_desc &desc, u32 *reqmask);
+	void mark_idle_loop(opcode_desc &branch, offs_t minpc);
 	void release_descriptions();
 
 	// configuration parameters
@@ -11,7 +11,8 @@
     Future improvements/changes:
 
     * UML optimizer:
-        - constant folding
+        - value propagation across labels
+        - dead store elimination
 
     * Write a back-end validator:
         - checks all combinations of memory/register/immediate on all params
@@ -19,6 +20,14 @@
 
     * Extend registers to 16? Depends on if PPC can use them
 
+    * AArch64 native back-end:
+        - non-x86 hosts currently fall back to drcbe_c
+        - asmjit's a64 emitter is available in 3rdparty
+        - drc_cache already handles W^X mapping and instruction cache
+          invalidation, which an ARM64 back-end needs
+        - should implement the full opcode set and pass the back-end
+          validator before being selected as NATIVE_DRC
+
     * Support for FPU exceptions
 
     * New instructions?
@@ -41,6 +50,7 @@
 #include "drcbex64.h"
 #endif
 
+#include <algorithm>
 #include <fstream>
 
 
@@ -77,6 +87,299 @@ struct bevalidate_test
 };
 
 
+// tracks values known to be held in integer registers and in memory
+// locations between instructions of a straight-line run of code
+class drcuml_value_tracker
+{
+public:
+	drcuml_value_tracker() { reset(); }
+
+	void reset();
+	void propagate(uml::instruction &inst) const;
+	void update(uml::instruction const &inst);
+
+private:
+	// an integer register holding a known immediate
+	struct ireg_value
+	{
+		bool            known;      // value is known
+		u8              bytes;      // number of low bytes that are known
+		u64             value;      // the value itself
+	};
+
+	// a memory location known to hold an immediate or a register's value
+	struct memory_value
+	{
+		u8 const *      base;       // start of the location
+		u8              bytes;      // size of the location
+		uml::parameter  value;      // immediate or integer register
+	};
+
+	memory_value const *find_memory(void const *base, u8 bytes) const;
+	void kill_ireg(int regnum);
+	void kill_memory(void const *base, u8 bytes);
+
+	static bool all_immediate_allowed(uml::instruction const &inst);
+
+	ireg_value                  m_ireg[uml::REG_I_COUNT];
+	std::vector<memory_value>   m_memory;
+};
+
+
+
+//**************************************************************************
+//  UML VALUE TRACKER
+//**************************************************************************
+
+//-------------------------------------------------
+//  reset - forget everything, used at points
+//  that can be reached from elsewhere
+//-------------------------------------------------
+
+void drcuml_value_tracker::reset()
+{
+	for (ireg_value &reg : m_ireg)
+		reg.known = false;
+	m_memory.clear();
+}
+
+
+//-------------------------------------------------
+//  propagate - replace inputs with known values
+//  and drop stores that would not change memory
+//-------------------------------------------------
+
+void drcuml_value_tracker::propagate(uml::instruction &inst) const
+{
+	uml::instruction const original(inst);
+	bool changed(false);
+
+	for (int pnum = 0; pnum < inst.numparams(); pnum++)
+	{
+		if (!inst.param_is_input(pnum) || inst.param_is_output(pnum))
+			continue;
+
+		uml::parameter const &param(inst.param(pnum));
+		u8 const bytes(inst.param_bytes(pnum));
+
+		// integer registers holding an immediate
+		if (param.is_int_register())
+		{
+			ireg_value const &reg(m_ireg[param.ireg() - uml::REG_I0]);
+			if (reg.known && (bytes <= reg.bytes) && inst.param_allows(pnum, uml::parameter::PTYPE_IMMEDIATE))
+			{
+				inst.set_param(pnum, reg.value & make_bitmask<u64>(bytes * 8));
+				changed = true;
+			}
+		}
+
+		// memory holding an immediate or a register's value
+		else if (param.is_memory() && inst.param_allows(pnum, uml::parameter::PTYPE_MEMORY))
+		{
+			memory_value const *const mem(find_memory(param.memory(), bytes));
+			if (mem && inst.param_allows(pnum, mem->value.type()))
+			{
+				if (mem->value.is_immediate())
+					inst.set_param(pnum, mem->value.immediate() & make_bitmask<u64>(bytes * 8));
+				else
+					inst.set_param(pnum, mem->value);
+				changed = true;
+			}
+		}
+	}
+
+	// don't hand the back-end all-immediate operations it can't fold away
+	if (changed && !all_immediate_allowed(inst))
+	{
+		bool const all_immediate = [&inst] ()
+		{
+			for (int pnum = 0; pnum < inst.numparams(); pnum++)
+				if (inst.param_is_input(pnum) && inst.param_allows(pnum, uml::parameter::PTYPE_IMMEDIATE) && !inst.param(pnum).is_immediate())
+					return false;
+			return true;
+		}();
+		if (all_immediate)
+			inst = original;
+	}
+
+	// a store of what memory is already known to hold is redundant
+	if ((inst.opcode() == uml::OP_MOV) && (inst.condition() == uml::COND_ALWAYS) && inst.param(0).is_memory())
+	{
+		memory_value const *const mem(find_memory(inst.param(0).memory(), inst.size()));
+		if (mem && (mem->value == inst.param(1)))
+			inst.nop();
+	}
+}
+
+
+//-------------------------------------------------
+//  update - account for the effects of an
+//  instruction
+//-------------------------------------------------
+
+void drcuml_value_tracker::update(uml::instruction const &inst)
+{
+	switch (inst.opcode())
+	{
+	// entry points and calls can change anything
+	case uml::OP_HANDLE:
+	case uml::OP_HASH:
+	case uml::OP_LABEL:
+	case uml::OP_DEBUG:
+	case uml::OP_EXH:
+	case uml::OP_CALLH:
+	case uml::OP_CALLC:
+	case uml::OP_RESTORE:
+		reset();
+		return;
+
+	// memory handlers may call back into the CPU, and indexed stores may hit anything
+	case uml::OP_READ:
+	case uml::OP_READM:
+	case uml::OP_WRITE:
+	case uml::OP_WRITEM:
+	case uml::OP_FREAD:
+	case uml::OP_FWRITE:
+	case uml::OP_STORE:
+	case uml::OP_FSTORE:
+	case uml::OP_SAVE:
+		m_memory.clear();
+		break;
+
+	default:
+		break;
+	}
+
+	// forget whatever the outputs held before
+	for (int pnum = 0; pnum < inst.numparams(); pnum++)
+	{
+		if (inst.param_is_output(pnum))
+		{
+			uml::parameter const &param(inst.param(pnum));
+			if (param.is_int_register())
+				kill_ireg(param.ireg() - uml::REG_I0);
+			else if (param.is_memory())
+				kill_memory(param.memory(), inst.param_bytes(pnum));
+		}
+	}
+
+	// unconditional moves establish new known values
+	if ((inst.opcode() == uml::OP_MOV) && (inst.condition() == uml::COND_ALWAYS))
+	{
+		uml::parameter const &dst(inst.param(0));
+		uml::parameter const &src(inst.param(1));
+		if (dst.is_int_register())
+		{
+			if (src.is_immediate())
+				m_ireg[dst.ireg() - uml::REG_I0] = ireg_value{ true, inst.size(), src.immediate() };
+			else if (src.is_memory())
+				m_memory.emplace_back(memory_value{ reinterpret_cast<u8 const *>(src.memory()), inst.size(), dst });
+		}
+		else if (dst.is_memory() && (src.is_immediate() || src.is_int_register()))
+		{
+			m_memory.emplace_back(memory_value{ reinterpret_cast<u8 const *>(dst.memory()), inst.size(), src });
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  find_memory - find what an exact memory
+//  location is known to hold
+//-------------------------------------------------
+
+drcuml_value_tracker::memory_value const *drcuml_value_tracker::find_memory(void const *base, u8 bytes) const
+{
+	for (memory_value const &mem : m_memory)
+		if ((mem.base == base) && (mem.bytes == bytes))
+			return &mem;
+	return nullptr;
+}
+
+
+//-------------------------------------------------
+//  kill_ireg - forget an integer register and
+//  any memory known to hold its value
+//-------------------------------------------------
+
+void drcuml_value_tracker::kill_ireg(int regnum)
+{
+	m_ireg[regnum].known = false;
+	uml::parameter const reg(uml::ireg(regnum));
+	m_memory.erase(
+			std::remove_if(m_memory.begin(), m_memory.end(), [&reg] (memory_value const &mem) { return mem.value == reg; }),
+			m_memory.end());
+}
+
+
+//-------------------------------------------------
+//  kill_memory - forget any memory overlapping a
+//  location that is written
+//-------------------------------------------------
+
+void drcuml_value_tracker::kill_memory(void const *base, u8 bytes)
+{
+	u8 const *const start(reinterpret_cast<u8 const *>(base));
+	m_memory.erase(
+			std::remove_if(
+				m_memory.begin(),
+				m_memory.end(),
+				[start, bytes] (memory_value const &mem) { return (mem.base < (start + bytes)) && (start < (mem.base + mem.bytes)); }),
+			m_memory.end());
+}
+
+
+//-------------------------------------------------
+//  all_immediate_allowed - return true if an
+//  instruction may safely have only immediate
+//  inputs, either because back-ends handle it or
+//  because simplify() will fold it
+//-------------------------------------------------
+
+bool drcuml_value_tracker::all_immediate_allowed(uml::instruction const &inst)
+{
+	switch (inst.opcode())
+	{
+	case uml::OP_DEBUG:
+	case uml::OP_EXIT:
+	case uml::OP_HASHJMP:
+	case uml::OP_EXH:
+	case uml::OP_SETFMOD:
+	case uml::OP_LOAD:
+	case uml::OP_LOADS:
+	case uml::OP_STORE:
+	case uml::OP_READ:
+	case uml::OP_READM:
+	case uml::OP_WRITE:
+	case uml::OP_WRITEM:
+	case uml::OP_FLOAD:
+	case uml::OP_FSTORE:
+	case uml::OP_FREAD:
+	case uml::OP_MOV:
+		return true;
+
+	case uml::OP_SEXT:
+	case uml::OP_ROLAND:
+	case uml::OP_ADD:
+	case uml::OP_SUB:
+	case uml::OP_CMP:
+	case uml::OP_AND:
+	case uml::OP_TEST:
+	case uml::OP_OR:
+	case uml::OP_XOR:
+	case uml::OP_SHL:
+	case uml::OP_SHR:
+	case uml::OP_SAR:
+	case uml::OP_ROL:
+	case uml::OP_ROR:
+		return inst.flags() == 0;
+
+	default:
+		return false;
+	}
+}
+
+
 
 //**************************************************************************
 //  DRC BACKEND INTERFACE
@@ -145,6 +448,13 @@ drcuml_state::drcuml_state(device_t &device, drc_cache &cache, u32 flags, int mo
 	, m_umllog(device.machine().options().drc_log_uml()
 			? new std::ofstream(util::string_format("drcuml_%s.asm", device.shortname()))
 			: nullptr)
+	, m_optimize(device.machine().options().drc_optimize())
+	, m_perfmap(device.machine().options().drc_perf_map()
+			? new std::ofstream(util::string_format("/tmp/perf-%d.map", osd_getpid()), std::ios::out | std::ios::app)
+			: nullptr)
+	, m_block_count(0)
+	, m_inst_count(0)
+	, m_native_bytes(0)
 	, m_blocklist()
 	, m_handlelist()
 	, m_symlist()
@@ -158,6 +468,17 @@ drcuml_state::drcuml_state(device_t &device, drc_cache &cache, u32 flags, int mo
 
 drcuml_state::~drcuml_state()
 {
+	if (m_block_count)
+	{
+		osd_printf_verbose(
+				"%s: DRC compiled %u blocks (%u UML instructions, %u native bytes), %u cache flushes, peak cache use %u bytes\n",
+				m_device.tag(),
+				m_block_count,
+				m_inst_count,
+				m_native_bytes,
+				m_cache.flush_count(),
+				m_cache.peak_code_bytes());
+	}
 }
 
 
@@ -275,6 +596,37 @@ const char *drcuml_state::symbol_find(void *base, u32 *offset)
 }
 
 
+//-------------------------------------------------
+//  generate - have the back-end generate code for
+//  a block and count it
+//-------------------------------------------------
+
+void drcuml_state::generate(drcuml_block &block, uml::instruction *instructions, u32 count)
+{
+	m_beintf->generate(block, instructions, count);
+	++m_block_count;
+	m_inst_count += count;
+}
+
+
+//-------------------------------------------------
+//  code_generated - called by native back-ends
+//  for each range of code they emit
+//-------------------------------------------------
+
+void drcuml_state::code_generated(void const *base, size_t bytes, char const *name)
+{
+	m_native_bytes += bytes;
+
+	// perf expects "start size symbol" in hex, one per line
+	if (m_perfmap && bytes)
+	{
+		util::stream_format(*m_perfmap, "%x %x %s %s\n", uintptr_t(base), bytes, m_device.tag(), name);
+		m_perfmap->flush();
+	}
+}
+
+
 //-------------------------------------------------
 //  log_vprintf - directly printf to the UML log
 //  if generated
@@ -395,6 +747,8 @@ uml::instruction &drcuml_block::append()
 void drcuml_block::optimize()
 {
 	u32 mapvar[uml::MAPVAR_COUNT] = { 0 };
+	bool const optimizing(m_drcuml.optimizing());
+	drcuml_value_tracker tracker;
 
 	// iterate over instructions
 	for (int instnum = 0; instnum < m_nextinst; instnum++)
@@ -428,8 +782,16 @@ void drcuml_block::optimize()
 				if (inst.param(pnum).is_mapvar())
 					inst.set_mapvar(pnum, mapvar[inst.param(pnum).mapvar() - uml::MAPVAR_M0]);
 
+		// substitute known values so simplification can fold them
+		if (optimizing)
+			tracker.propagate(inst);
+
 		// now that flags are correct, simplify the instruction
 		inst.simplify();
+
+		// note what the final form of the instruction leaves behind
+		if (optimizing)
+			tracker.update(inst);
 	}
 }
 
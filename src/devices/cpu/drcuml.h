@@ -176,7 +176,8 @@ public:
 	// back-end interface
 	void get_backend_info(drcbe_info &info) { m_beintf->get_info(info); }
 	bool hash_exists(u32 mode, u32 pc) { return m_beintf->hash_exists(mode, pc); }
-	void generate(drcuml_block &block, uml::instruction *instructions, u32 count) { m_beintf->generate(block, instructions, count); }
+	void generate(drcuml_block &block, uml::instruction *instructions, u32 count);
+	void code_generated(void const *base, size_t bytes, char const *name);
 
 	// handle management
 	uml::code_handle *handle_alloc(char const *name);
@@ -185,6 +186,9 @@ public:
 	void symbol_add(void *base, u32 length, char const *name);
 	char const *symbol_find(void *base, u32 *offset = nullptr);
 
+	// optimization
+	bool optimizing() const { return m_optimize; }
+
 	// logging
 	bool logging() const { return bool(m_umllog); }
 	template <typename Format, typename... Params>
@@ -225,6 +229,11 @@ private:
 	drc_cache &                             m_cache;            // pointer to the codegen cache
 	std::unique_ptr<drcbe_interface> const  m_beintf;           // backend interface pointer
 	std::unique_ptr<std::ostream> const     m_umllog;           // handle to the UML logfile
+	bool const                              m_optimize;         // propagate values between instructions
+	std::unique_ptr<std::ostream> const     m_perfmap;          // Linux perf symbol map
+	u32                                     m_block_count;      // blocks compiled
+	u64                                     m_inst_count;       // UML instructions compiled
+	u64                                     m_native_bytes;     // native code bytes emitted
 	std::list<drcuml_block>                 m_blocklist;        // list of active blocks
 	std::list<uml::code_handle>             m_handlelist;       // list of active handles
 	std::list<symbol>                       m_symlist;          // list of symbols
@@ -119,7 +119,7 @@ dspp_device::dspp_device(const machine_config &mconfig, device_type type, const
 	m_dspx_underover_enable(0),
 	m_dspx_audio_time(0),
 	m_dspx_audio_duration(0),
-	m_cache(CACHE_SIZE),
+	m_cache(mconfig, CACHE_SIZE),
 	m_drcuml(nullptr),
 	m_drcfe(nullptr),
 	m_drcoptions(0)
@@ -206,7 +206,7 @@ hyperstone_device::hyperstone_device(const machine_config &mconfig, const char *
 	: cpu_device(mconfig, type, tag, owner, clock)
 	, m_program_config("program", ENDIANNESS_BIG, prg_data_width, 32, 0, internal_map)
 	, m_io_config("io", ENDIANNESS_BIG, io_data_width, 15)
-	, m_cache(CACHE_SIZE + sizeof(hyperstone_device))
+	, m_cache(mconfig, CACHE_SIZE + sizeof(hyperstone_device))
 	, m_drcuml(nullptr)
 	, m_drcfe(nullptr)
 	, m_drcoptions(0)
@@ -475,6 +475,8 @@ private:
 		uint32_t m_cycles;          /* accumulated cycles */
 		uint8_t m_checkints;        /* need to check interrupts before next instruction */
 		uml::code_label m_labelnum; /* index for local labels */
+		bool m_check_delay;         /* a delayed branch may still be pending */
+		bool m_delay_checked;       /* the current instruction checked for a pending delayed branch */
 	};
 
 	void execute_run_drc();
@@ -275,6 +275,9 @@ void hyperstone_device::code_compile_block(offs_t pc)
 				UML_MOV(block, I7, 0);
 				UML_CALLH(block, *m_interrupt_checks);
 
+				/* a sequence may be entered in the delay slot of a DBcc */
+				compiler.m_check_delay = true;
+
 				/* iterate over instructions in the sequence and compile them */
 				for (curdesc = seqhead; curdesc != seqlast->next(); curdesc = curdesc->next())
 				{
@@ -931,6 +934,7 @@ bool hyperstone_device::generate_opcode(drcuml_block &block, compiler_state &com
 	uint32_t op = (uint32_t)desc->opptr.w[0];
 
 	UML_ADD(block, DRC_PC, DRC_PC, 2);
+	compiler.m_delay_checked = false;
 
 	switch (op >> 8)
 	{
@@ -1194,18 +1198,25 @@ bool hyperstone_device::generate_opcode(drcuml_block &block, compiler_state &com
 
 	UML_ROLINS(block, DRC_SR, ((desc->length >> 1) << ILC_SHIFT), 0, ILC_MASK);
 
-	int no_delay_taken = compiler.m_labelnum++;
-	UML_TEST(block, mem(&m_core->delay_slot_taken), ~0);
-	UML_JMPc(block, uml::COND_Z, no_delay_taken);
-	UML_MOV(block, mem(&m_core->delay_slot_taken), 0);
-	generate_update_cycles(block);
-	UML_HASHJMP(block, 0, DRC_PC, *m_nocode);
-	UML_LABEL(block, no_delay_taken);
-
-	int done;
-	UML_AND(block, I0, DRC_SR, (T_MASK | P_MASK));
-	UML_CMP(block, I0, (T_MASK | P_MASK));
-	UML_JMPc(block, uml::COND_NE, done = compiler.m_labelnum++);
+	/* only an instruction that consumed a delayed branch can have to redirect to its target */
+	if (compiler.m_delay_checked)
+	{
+		int no_delay_taken = compiler.m_labelnum++;
+		UML_TEST(block, mem(&m_core->delay_slot_taken), ~0);
+		UML_JMPc(block, uml::COND_Z, no_delay_taken);
+		UML_MOV(block, mem(&m_core->delay_slot_taken), 0);
+		generate_update_cycles(block);
+		UML_HASHJMP(block, 0, DRC_PC, *m_nocode);
+		UML_LABEL(block, no_delay_taken);
+		compiler.m_check_delay = false;
+	}
+
+	/* trace mode is rare, so test T on its own before looking at P */
+	int done = compiler.m_labelnum++;
+	UML_TEST(block, DRC_SR, T_MASK);
+	UML_JMPc(block, uml::COND_Z, done);
+	UML_TEST(block, DRC_SR, P_MASK);
+	UML_JMPc(block, uml::COND_Z, done);
 	UML_TEST(block, mem(&m_core->delay_slot), 1);
 	UML_EXHc(block, uml::COND_E, *m_exception[EXCEPTION_TRACE], 0);
 
@@ -7,6 +7,12 @@ constexpr uint32_t WRITE_ONLY_REGMASK = (1 << BCR_REGISTER) | (1 << TPR_REGISTER
 
 void hyperstone_device::generate_check_delay_pc(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc)
 {
+	/* DBcc ends its sequence, so a delayed branch can only be pending until the */
+	/* first instruction of the following sequence has consumed it */
+	if (!compiler.m_check_delay)
+		return;
+	compiler.m_delay_checked = true;
+
 	/* if PC is used in a delay instruction, the delayed PC should be used */
 	UML_TEST(block, mem(&m_core->delay_slot), 1);
 	UML_MOVc(block, uml::COND_NZ, DRC_PC, mem(&m_core->delay_pc));
@@ -32,6 +32,9 @@ void athlonxp_device::device_start()
 	space(AS_OPCODES).specific(m_opcodes);
 	space(AS_DATA).cache(mmacache32);
 
+	// opcode fetches go through the emulated cache
+	m_fetch_window_enabled = false;
+
 	space(AS_OPCODES).install_readwrite_handler(0, 0xffffffff, read32s_delegate(*this, FUNC(athlonxp_device::debug_read_memory)), write32s_delegate(*this, FUNC(athlonxp_device::debug_write_memory)));
 
 	build_x87_opcode_table();
@@ -72,7 +72,10 @@ i386_device::i386_device(const machine_config &mconfig, device_type type, const
 	, m_io_config("io", ENDIANNESS_LITTLE, io_data_width, 16, 0)
 	, m_smiact(*this)
 	, m_ferr_handler(*this)
+	, m_x87_host_fpu(false)
 {
+	m_program_config.m_flat_access = true;
+
 	// 32 unified
 	set_vtlb_dynamic_entries(32);
 }
@@ -337,15 +340,57 @@ void i386_device::NEAR_BRANCH(int32_t offs)
 	m_pc += offs;
 }
 
+// Instruction bytes are read straight from host memory while they stay
+// inside the window validated at the start of the instruction.  The
+// window is checked against the TLB and A20 once per instruction, and
+// dropped whenever the program space map changes.
+void i386_device::fetch_window_update()
+{
+	if (!m_fetch_window_enabled)
+		return;
+
+	uint32_t address = m_pc, error;
+	uint32_t const linear = m_pc & ~FETCH_WINDOW_MASK;
+	if (!translate_address(m_CPL, TR_FETCH, &address, &error))
+	{
+		// let the fetch itself raise the fault
+		m_fetch_size = 0;
+		return;
+	}
+	address = address & m_a20_mask & ~FETCH_WINDOW_MASK;
+	if (m_fetch_size && (linear == m_fetch_linear) && (address == m_fetch_phys))
+		return;
+
+	uintptr_t entry = m_program->flat_read_table()[address >> m_program->flat_page_shift()];
+	if (entry == emu::detail::FLAT_UNKNOWN)
+		entry = m_program->flat_fill(read_or_write::READ, address);
+	if (entry == emu::detail::FLAT_NONE)
+	{
+		m_fetch_size = 0;
+		return;
+	}
+
+	m_fetch_window = reinterpret_cast<const uint8_t *>(entry) + (address & make_bitmask<uint32_t>(m_program->flat_page_shift()));
+	m_fetch_linear = linear;
+	m_fetch_phys = address;
+	m_fetch_size = FETCH_WINDOW_MASK + 1;
+}
+
 uint8_t i386_device::FETCH()
 {
 	uint8_t value;
-	uint32_t address = m_pc, error;
+	uint32_t const offset = m_pc - m_fetch_linear;
 
-	if(!translate_address(m_CPL,TR_FETCH,&address,&error))
-		PF_THROW(error);
+	if(offset < m_fetch_size) {
+		value = m_fetch_window[BYTE4_XOR_LE(offset)];
+	} else {
+		uint32_t address = m_pc, error;
 
-	value = mem_pr8(address & m_a20_mask);
+		if(!translate_address(m_CPL,TR_FETCH,&address,&error))
+			PF_THROW(error);
+
+		value = mem_pr8(address & m_a20_mask);
+	}
 #ifdef DEBUG_MISSING_OPCODE
 	m_opcode_bytes[m_opcode_bytes_length] = value;
 	m_opcode_bytes_length = (m_opcode_bytes_length + 1) & 15;
@@ -362,6 +407,10 @@ uint16_t i386_device::FETCH16()
 	if( !WORD_ALIGNED(address) ) {       /* Unaligned read */
 		value = (FETCH() << 0);
 		value |= (FETCH() << 8);
+	} else if( (m_pc - m_fetch_linear) < m_fetch_size ) {
+		value = *reinterpret_cast<const uint16_t *>(&m_fetch_window[WORD_XOR_LE(m_pc - m_fetch_linear)]);
+		m_eip += 2;
+		m_pc += 2;
 	} else {
 		if(!translate_address(m_CPL,TR_FETCH,&address,&error))
 			PF_THROW(error);
@@ -382,6 +431,10 @@ uint32_t i386_device::FETCH32()
 		value |= (FETCH() << 8);
 		value |= (FETCH() << 16);
 		value |= (FETCH() << 24);
+	} else if( (m_pc - m_fetch_linear) < m_fetch_size ) {
+		value = *reinterpret_cast<const uint32_t *>(&m_fetch_window[m_pc - m_fetch_linear]);
+		m_eip += 4;
+		m_pc += 4;
 	} else {
 		if(!translate_address(m_CPL,TR_FETCH,&address,&error))
 			PF_THROW(error);
@@ -402,7 +455,7 @@ uint8_t i386_device::READ8PL(uint32_t ea, uint8_t privilege)
 		PF_THROW(error);
 
 	address &= m_a20_mask;
-	return m_program->read_byte(address);
+	return maspecific32.read_byte(address);
 }
 
 uint16_t i386_device::READ16PL(uint32_t ea, uint8_t privilege)
@@ -419,7 +472,7 @@ uint16_t i386_device::READ16PL(uint32_t ea, uint8_t privilege)
 			PF_THROW(error);
 
 		address &= m_a20_mask;
-		value = m_program->read_word(address);
+		value = maspecific32.read_word(address);
 		break;
 
 	case 1:
@@ -427,7 +480,7 @@ uint16_t i386_device::READ16PL(uint32_t ea, uint8_t privilege)
 			PF_THROW(error);
 
 		address &= m_a20_mask;
-		value = m_program->read_dword(address - 1, 0x00ffff00) >> 8;
+		value = maspecific32.read_dword(address - 1, 0x00ffff00) >> 8;
 		break;
 
 	case 3:
@@ -452,7 +505,7 @@ uint32_t i386_device::READ32PL(uint32_t ea, uint8_t privilege)
 			PF_THROW(error);
 
 		address &= m_a20_mask;
-		value = m_program->read_dword(address);
+		value = maspecific32.read_dword(address);
 		break;
 
 	case 1:
@@ -460,7 +513,7 @@ uint32_t i386_device::READ32PL(uint32_t ea, uint8_t privilege)
 			PF_THROW(error);
 
 		address &= m_a20_mask;
-		value = m_program->read_dword(address - 1, 0xffffff00) >> 8;
+		value = maspecific32.read_dword(address - 1, 0xffffff00) >> 8;
 		value |= READ8PL(ea + 3, privilege) << 24;
 		break;
 
@@ -477,7 +530,7 @@ uint32_t i386_device::READ32PL(uint32_t ea, uint8_t privilege)
 			PF_THROW(error);
 
 		address &= m_a20_mask;
-		value |= m_program->read_dword(address, 0x00ffffff) << 8;
+		value |= maspecific32.read_dword(address, 0x00ffffff) << 8;
 		break;
 	}
 
@@ -502,7 +555,7 @@ uint64_t i386_device::READ64PL(uint32_t ea, uint8_t privilege)
 			PF_THROW(error);
 
 		address &= m_a20_mask;
-		value = m_program->read_dword(address - 1, 0xffffff00) >> 8;
+		value = maspecific32.read_dword(address - 1, 0xffffff00) >> 8;
 		value |= uint64_t(READ32PL(ea + 3, privilege)) << 24;
 		value |= uint64_t(READ8PL(ea + 7, privilege)) << 56;
 		break;
@@ -522,13 +575,24 @@ uint64_t i386_device::READ64PL(uint32_t ea, uint8_t privilege)
 			PF_THROW(error);
 
 		address &= m_a20_mask;
-		value |= uint64_t(m_program->read_dword(address, 0x00ffffff)) << 40;
+		value |= uint64_t(maspecific32.read_dword(address, 0x00ffffff)) << 40;
 		break;
 	}
 
 	return value;
 }
 
+uint8_t i386sx_device::READ8PL(uint32_t ea, uint8_t privilege)
+{
+	uint32_t address = ea, error;
+
+	if(!translate_address(privilege,TR_READ,&address,&error))
+		PF_THROW(error);
+
+	address &= m_a20_mask;
+	return maspecific16.read_byte(address);
+}
+
 uint16_t i386sx_device::READ16PL(uint32_t ea, uint8_t privilege)
 {
 	uint16_t value;
@@ -540,7 +604,7 @@ uint16_t i386sx_device::READ16PL(uint32_t ea, uint8_t privilege)
 			PF_THROW(error);
 
 		address &= m_a20_mask;
-		return m_program->read_word(address);
+		return maspecific16.read_word(address);
 	}
 	else
 	{
@@ -607,7 +671,7 @@ void i386_device::WRITE8PL(uint32_t ea, uint8_t privilege, uint8_t value)
 		PF_THROW(error);
 
 	address &= m_a20_mask;
-	m_program->write_byte(address, value);
+	maspecific32.write_byte(address, value);
 }
 
 void i386_device::WRITE16PL(uint32_t ea, uint8_t privilege, uint16_t value)
@@ -622,7 +686,7 @@ void i386_device::WRITE16PL(uint32_t ea, uint8_t privilege, uint16_t value)
 			PF_THROW(error);
 
 		address &= m_a20_mask;
-		m_program->write_word(address, value);
+		maspecific32.write_word(address, value);
 		break;
 
 	case 1:
@@ -630,7 +694,7 @@ void i386_device::WRITE16PL(uint32_t ea, uint8_t privilege, uint16_t value)
 			PF_THROW(error);
 
 		address &= m_a20_mask;
-		m_program->write_dword(address - 1, value << 8, 0x00ffff00);
+		maspecific32.write_dword(address - 1, value << 8, 0x00ffff00);
 		break;
 
 	case 3:
@@ -651,7 +715,7 @@ void i386_device::WRITE32PL(uint32_t ea, uint8_t privilege, uint32_t value)
 			PF_THROW(error);
 
 		address &= m_a20_mask;
-		m_program->write_dword(address, value);
+		maspecific32.write_dword(address, value);
 		break;
 
 	case 1:
@@ -659,7 +723,7 @@ void i386_device::WRITE32PL(uint32_t ea, uint8_t privilege, uint32_t value)
 			PF_THROW(error);
 
 		address &= m_a20_mask;
-		m_program->write_dword(address - 1, (value << 8) & 0xffffff00, 0xffffff00);
+		maspecific32.write_dword(address - 1, (value << 8) & 0xffffff00, 0xffffff00);
 		WRITE8PL(ea + 3, privilege, (value >> 24) & 0xff);
 		break;
 
@@ -676,7 +740,7 @@ void i386_device::WRITE32PL(uint32_t ea, uint8_t privilege, uint32_t value)
 			PF_THROW(error);
 
 		address &= m_a20_mask;
-		m_program->write_dword(address, value >> 8, 0x00ffffff);
+		maspecific32.write_dword(address, value >> 8, 0x00ffffff);
 		break;
 	}
 }
@@ -697,7 +761,7 @@ void i386_device::WRITE64PL(uint32_t ea, uint8_t privilege, uint64_t value)
 			PF_THROW(error);
 
 		address &= m_a20_mask;
-		m_program->write_dword(address - 1, value << 8, 0xffffff00);
+		maspecific32.write_dword(address - 1, value << 8, 0xffffff00);
 		WRITE32PL(ea + 3, privilege, (value >> 24) & 0xffffffff);
 		WRITE8PL(ea + 7, privilege, (value >> 56) & 0xff );
 		break;
@@ -717,11 +781,21 @@ void i386_device::WRITE64PL(uint32_t ea, uint8_t privilege, uint64_t value)
 			PF_THROW(error);
 
 		address &= m_a20_mask;
-		m_program->write_dword(address, (value >> 40) & 0x00ffffff, 0x00ffffff);
+		maspecific32.write_dword(address, (value >> 40) & 0x00ffffff, 0x00ffffff);
 		break;
 	}
 }
 
+void i386sx_device::WRITE8PL(uint32_t ea, uint8_t privilege, uint8_t value)
+{
+	uint32_t address = ea, error;
+	if(!translate_address(privilege,TR_WRITE,&address,&error))
+		PF_THROW(error);
+
+	address &= m_a20_mask;
+	maspecific16.write_byte(address, value);
+}
+
 void i386sx_device::WRITE16PL(uint32_t ea, uint8_t privilege, uint16_t value)
 {
 	uint32_t address = ea, error;
@@ -732,7 +806,7 @@ void i386sx_device::WRITE16PL(uint32_t ea, uint8_t privilege, uint16_t value)
 			PF_THROW(error);
 
 		address &= m_a20_mask;
-		m_program->write_word(address, value);
+		maspecific16.write_word(address, value);
 	}
 	else
 	{
@@ -1920,6 +1994,7 @@ void i386_device::i386_postload()
 	for (i = 0; i < 6; i++)
 		i386_load_segment_descriptor(i);
 	CHANGE_PC(m_eip);
+	m_fetch_size = 0;
 }
 
 void i386_device::i386_common_init()
@@ -1956,10 +2031,19 @@ void i386_device::i386_common_init()
 	if(m_program->data_width() == 16) {
 		// for the 386sx
 		m_program->cache(macache16);
+		m_program->specific(maspecific16);
 	} else {
 		m_program->cache(macache32);
+		m_program->specific(maspecific32);
 	}
 
+	// fetch from host memory when the program space exposes flat 32-bit pages at least as big as an MMU page
+	m_fetch_window = nullptr;
+	m_fetch_linear = 0;
+	m_fetch_phys = 0;
+	m_fetch_size = 0;
+	m_fetch_window_enabled = m_program->flat_read_table() && (m_program->data_width() == 32) && (m_program->flat_page_shift() >= FETCH_WINDOW_BITS);
+
 	m_io = &space(AS_IO);
 	m_smi = false;
 	m_debugger_temp = 0;
@@ -2046,7 +2130,7 @@ void i386_device::i386_common_init()
 	m_ferr_handler(0);
 
 	set_icountptr(m_cycles);
-	m_notifier = m_program->add_change_notifier([this] (read_or_write mode) { dri_changed(); });
+	m_notifier = m_program->add_change_notifier([this] (read_or_write mode) { m_fetch_size = 0; dri_changed(); });
 }
 
 void i386_device::device_start()
@@ -2829,6 +2913,7 @@ void i386_device::execute_run()
 		m_prev_eip = m_eip;
 
 		debugger_instruction_hook(m_pc);
+		fetch_window_update();
 
 		if(m_delayed_interrupt_enable != 0)
 		{
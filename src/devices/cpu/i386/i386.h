@@ -35,6 +35,10 @@ public:
 	auto smiact() { return m_smiact.bind(); }
 	auto ferr() { return m_ferr_handler.bind(); }
 
+	// run x87 arithmetic on the host fpu while the guest rounds to nearest
+	// with all exceptions masked; sticky status flags become approximate
+	void set_x87_host_fpu(bool fast) { m_x87_host_fpu = fast; }
+
 	uint64_t debug_segbase(int params, const uint64_t *param);
 	uint64_t debug_seglimit(int params, const uint64_t *param);
 	uint64_t debug_segofftovirt(int params, const uint64_t *param);
@@ -310,6 +314,17 @@ protected:
 	uint32_t m_a20_mask;
 	memory_access<32, 1, 0, ENDIANNESS_LITTLE>::cache macache16;
 	memory_access<32, 2, 0, ENDIANNESS_LITTLE>::cache macache32;
+	memory_access<32, 1, 0, ENDIANNESS_LITTLE>::specific maspecific16;
+	memory_access<32, 2, 0, ENDIANNESS_LITTLE>::specific maspecific32;
+
+	// host memory backing the code page the current instruction is fetched from
+	static constexpr int FETCH_WINDOW_BITS = 12;
+	static constexpr uint32_t FETCH_WINDOW_MASK = (1U << FETCH_WINDOW_BITS) - 1;
+	const uint8_t *m_fetch_window;  // host pointer for m_fetch_linear
+	uint32_t m_fetch_linear;        // linear address of the start of the window
+	uint32_t m_fetch_phys;          // physical address of the start of the window
+	uint32_t m_fetch_size;          // window size in bytes, 0 if fetches must go through the memory system
+	bool m_fetch_window_enabled;    // program space can be fetched from directly
 
 	int m_cpuid_max_input_value_eax; // Highest CPUID standard function available
 	uint32_t m_cpuid_id0, m_cpuid_id1, m_cpuid_id2;
@@ -329,6 +344,7 @@ protected:
 	uint16_t m_x87_cs;
 	uint32_t m_x87_inst_ptr;
 	uint16_t m_x87_opcode;
+	bool m_x87_host_fpu;
 
 	i386_modrm_func m_opcode_table_x87_d8[256];
 	i386_modrm_func m_opcode_table_x87_d9[256];
@@ -400,6 +416,7 @@ protected:
 	bool i386_translate_address(int intention, bool debug, offs_t *address, vtlb_entry *entry);
 	bool translate_address(int pl, int type, uint32_t *address, uint32_t *error);
 	void CHANGE_PC(uint32_t pc);
+	void fetch_window_update();
 	inline void NEAR_BRANCH(int32_t offs);
 	inline uint8_t FETCH();
 	inline uint16_t FETCH16();
@@ -1368,6 +1385,8 @@ protected:
 	floatx80 x87_sub(floatx80 a, floatx80 b);
 	floatx80 x87_mul(floatx80 a, floatx80 b);
 	floatx80 x87_div(floatx80 a, floatx80 b);
+	inline bool x87_host_fpu_active() const;
+	template <typename Op> floatx80 x87_host_arith(floatx80 a, floatx80 b, bool div, Op &&op);
 	void x87_fadd_m32real(uint8_t modrm);
 	void x87_fadd_m64real(uint8_t modrm);
 	void x87_fadd_st_sti(uint8_t modrm);
@@ -1536,9 +1555,11 @@ protected:
 	virtual u16 mem_pr16(offs_t address) override { return macache16.read_word(address); }
 	virtual u32 mem_pr32(offs_t address) override { return macache16.read_dword(address); }
 
+	virtual uint8_t READ8PL(uint32_t ea, uint8_t privilege) override;
 	virtual uint16_t READ16PL(uint32_t ea, uint8_t privilege) override;
 	virtual uint32_t READ32PL(uint32_t ea, uint8_t privilege) override;
 	virtual uint64_t READ64PL(uint32_t ea, uint8_t privilege) override;
+	virtual void WRITE8PL(uint32_t ea, uint8_t privilege, uint8_t value) override;
 	virtual void WRITE16PL(uint32_t ea, uint8_t privilege, uint16_t value) override;
 	virtual void WRITE32PL(uint32_t ea, uint8_t privilege, uint32_t value) override;
 	virtual void WRITE64PL(uint32_t ea, uint8_t privilege, uint64_t value) override;
@@ -1909,26 +1909,16 @@ inline uint32_t i386_disassembler::FETCHD32(offs_t base_pc, offs_t &pc, const da
 	return FETCH32(base_pc, pc, opcodes);
 }
 
-char *i386_disassembler::hexstring(uint32_t value, int digits)
+std::string i386_disassembler::hexstring(uint32_t value, int digits)
 {
-	static char buffer[20];
-	buffer[0] = '0';
-	if (digits)
-		snprintf(&buffer[1], 19, "%0*Xh", digits, value);
-	else
-		snprintf(&buffer[1], 19, "%Xh", value);
-	return (buffer[1] >= '0' && buffer[1] <= '9') ? &buffer[1] : &buffer[0];
+	std::string const result = digits ? util::string_format("%0*Xh", digits, value) : util::string_format("%Xh", value);
+	return (result[0] >= '0' && result[0] <= '9') ? result : ('0' + result);
 }
 
-char *i386_disassembler::hexstring64(uint32_t lo, uint32_t hi)
+std::string i386_disassembler::hexstring64(uint32_t lo, uint32_t hi)
 {
-	static char buffer[40];
-	buffer[0] = '0';
-	if (hi != 0)
-		snprintf(&buffer[1], 39, "%X%08Xh", hi, lo);
-	else
-		snprintf(&buffer[1], 39, "%Xh", lo);
-	return (buffer[1] >= '0' && buffer[1] <= '9') ? &buffer[1] : &buffer[0];
+	std::string const result = (hi != 0) ? util::string_format("%X%08Xh", hi, lo) : util::string_format("%Xh", lo);
+	return (result[0] >= '0' && result[0] <= '9') ? result : ('0' + result);
 }
 
 std::string i386_disassembler::hexstringpc(uint64_t pc)
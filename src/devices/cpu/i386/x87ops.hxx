@@ -240,6 +240,99 @@ void i386_device::x87_reset()
 	m_ferr_handler(0);
 }
 
+/*************************************
+ *
+ * Host FPU fast path
+ *
+ *************************************/
+
+// the x86 long double is the same 80-bit format, only laid out differently
+#if (defined(__i386__) || defined(__x86_64__)) && defined(__LDBL_MANT_DIG__) && (__LDBL_MANT_DIG__ == 64)
+#define X87_HOST_EXTENDED   1
+#else
+#define X87_HOST_EXTENDED   0
+#endif
+
+#if X87_HOST_EXTENDED
+static inline long double x87_to_host(floatx80 v)
+{
+	uint8_t bytes[sizeof(long double)] = { 0 };
+	memcpy(&bytes[0], &v.low, 8);
+	memcpy(&bytes[8], &v.high, 2);
+	long double r;
+	memcpy(&r, bytes, sizeof(r));
+	return r;
+}
+
+static inline floatx80 x87_from_host(long double v)
+{
+	uint8_t bytes[sizeof(long double)];
+	memcpy(bytes, &v, sizeof(v));
+	floatx80 r;
+	memcpy(&r.low, &bytes[0], 8);
+	memcpy(&r.high, &bytes[8], 2);
+	return r;
+}
+
+static inline float x87_host_single(floatx80 v) { return float(x87_to_host(v)); }
+static inline double x87_host_double(floatx80 v) { return double(x87_to_host(v)); }
+static inline floatx80 x87_from_host_single(float v) { return x87_from_host(v); }
+static inline floatx80 x87_from_host_double(double v) { return x87_from_host(v); }
+#else
+static inline float x87_host_single(floatx80 v) { return u2f(floatx80_to_float32(v)); }
+static inline double x87_host_double(floatx80 v) { return u2d(floatx80_to_float64(v)); }
+static inline floatx80 x87_from_host_single(float v) { return float32_to_floatx80(f2u(v)); }
+static inline floatx80 x87_from_host_double(double v) { return float64_to_floatx80(d2u(v)); }
+#endif
+
+inline bool i386_device::x87_host_fpu_active() const
+{
+	// host rounding is left at nearest, and with every exception masked
+	// nothing but the sticky status flags can tell the difference
+	return m_x87_host_fpu && ((m_x87_cw & ((X87_CW_RC_MASK << X87_CW_RC_SHIFT) | 0x3f)) == 0x3f);
+}
+
+template <typename Op>
+floatx80 i386_device::x87_host_arith(floatx80 a, floatx80 b, bool div, Op &&op)
+{
+	// keep the cheap-to-detect sticky flags; inexact and underflow are not tracked
+	auto const flags = [div] (auto r, auto x, auto y)
+	{
+		if (std::isnan(r) && !std::isnan(x) && !std::isnan(y))
+			float_exception_flags |= float_flag_invalid;
+		else if (std::isinf(r) && std::isfinite(x) && std::isfinite(y))
+			float_exception_flags |= (div && y == 0) ? float_flag_divbyzero : (float_flag_overflow | float_flag_inexact);
+	};
+
+	switch ((m_x87_cw >> X87_CW_PC_SHIFT) & X87_CW_PC_MASK)
+	{
+		case X87_CW_PC_SINGLE:
+		{
+			float const x = x87_host_single(a), y = x87_host_single(b);
+			float const r = op(x, y);
+			flags(r, x, y);
+			return x87_from_host_single(r);
+		}
+		case X87_CW_PC_EXTEND:
+#if X87_HOST_EXTENDED
+		{
+			long double const x = x87_to_host(a), y = x87_to_host(b);
+			long double const r = op(x, y);
+			flags(r, x, y);
+			return x87_from_host(r);
+		}
+#endif
+		// otherwise the host has nothing wider than double, fall through
+		default:
+		{
+			double const x = x87_host_double(a), y = x87_host_double(b);
+			double const r = op(x, y);
+			flags(r, x, y);
+			return x87_from_host_double(r);
+		}
+	}
+}
+
 /*************************************
  *
  * Core arithmetic
@@ -248,6 +341,9 @@ void i386_device::x87_reset()
 
 floatx80 i386_device::x87_add(floatx80 a, floatx80 b)
 {
+	if (x87_host_fpu_active())
+		return x87_host_arith(a, b, false, [] (auto x, auto y) { return x + y; });
+
 	floatx80 result = { 0 };
 
 	switch ((m_x87_cw >> X87_CW_PC_SHIFT) & X87_CW_PC_MASK)
@@ -278,6 +374,9 @@ floatx80 i386_device::x87_add(floatx80 a, floatx80 b)
 
 floatx80 i386_device::x87_sub(floatx80 a, floatx80 b)
 {
+	if (x87_host_fpu_active())
+		return x87_host_arith(a, b, false, [] (auto x, auto y) { return x - y; });
+
 	floatx80 result = { 0 };
 
 	switch ((m_x87_cw >> X87_CW_PC_SHIFT) & X87_CW_PC_MASK)
@@ -308,6 +407,9 @@ floatx80 i386_device::x87_sub(floatx80 a, floatx80 b)
 
 floatx80 i386_device::x87_mul(floatx80 a, floatx80 b)
 {
+	if (x87_host_fpu_active())
+		return x87_host_arith(a, b, false, [] (auto x, auto y) { return x * y; });
+
 	floatx80 val = { 0 };
 
 	switch ((m_x87_cw >> X87_CW_PC_SHIFT) & X87_CW_PC_MASK)
@@ -339,6 +441,9 @@ floatx80 i386_device::x87_mul(floatx80 a, floatx80 b)
 
 floatx80 i386_device::x87_div(floatx80 a, floatx80 b)
 {
+	if (x87_host_fpu_active())
+		return x87_host_arith(a, b, true, [] (auto x, auto y) { return x / y; });
+
 	floatx80 val = { 0 };
 
 	switch ((m_x87_cw >> X87_CW_PC_SHIFT) & X87_CW_PC_MASK)
@@ -2366,7 +2471,12 @@ void i386_device::x87_fsqrt(uint8_t modrm)
 		}
 		else
 		{
-			result = floatx80_sqrt(value);
+#if X87_HOST_EXTENDED
+			if (x87_host_fpu_active())
+				result = x87_from_host(sqrtl(x87_to_host(value)));
+			else
+#endif
+				result = floatx80_sqrt(value);
 		}
 	}
 
@@ -22,6 +22,7 @@ public:
 
 	virtual void do_exec_full() override;
 	virtual void do_exec_partial() override;
+	virtual void do_exec_fast() override;
 
 protected:
 	address_space *io;
@@ -30,7 +31,7 @@ protected:
 	virtual space_config_vector memory_space_config() const override;
 	virtual void device_start() override;
 
-#define O(o) void o ## _full(); void o ## _partial()
+#define O(o) void o ## _full(); void o ## _partial(); void o ## _fast()
 
 	O(brk_16_imp);
 	O(ill_non);
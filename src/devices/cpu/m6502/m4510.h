@@ -23,6 +23,7 @@ public:
 
 	virtual void do_exec_full() override;
 	virtual void do_exec_partial() override;
+	virtual void do_exec_fast() override;
 
 	bool get_nomap() const { return nomap; }
 
@@ -56,7 +57,7 @@ protected:
 		return adr;
 	}
 
-#define O(o) void o ## _full(); void o ## _partial()
+#define O(o) void o ## _full(); void o ## _partial(); void o ## _fast()
 
 	// 4510 opcodes
 	O(eom_imp);
@@ -12,6 +12,8 @@
 #include "m6502.h"
 #include "m6502d.h"
 
+#include <typeinfo>
+
 DEFINE_DEVICE_TYPE(M6502, m6502_device, "m6502", "MOS Technology 6502")
 DEFINE_DEVICE_TYPE(M6512, m6512_device, "m6512", "MOS Technology 6512")
 
@@ -31,7 +33,9 @@ m6502_device::m6502_device(const machine_config &mconfig, device_type type, cons
 	program_config("program", ENDIANNESS_LITTLE, 8, 16),
 	sprogram_config("decrypted_opcodes", ENDIANNESS_LITTLE, 8, 16),
 	mintf(nullptr),
-	uses_custom_memory_interface(false)
+	uses_custom_memory_interface(false),
+	fast_exec_requested(false),
+	fast_exec(false)
 {
 }
 
@@ -56,6 +60,11 @@ void m6502_device::init()
 			space(AS_PROGRAM).specific(mintf->program14);
 	}
 
+	// the fast handlers bypass the memory interface, so only the plain one qualifies
+	fast_exec = fast_exec_requested && mintf && (typeid(*mintf) == typeid(mi_default));
+	if(fast_exec_requested && !fast_exec)
+		logerror("Fast execution not available with this memory interface, using cycle-accurate execution\n");
+
 	state_add(STATE_GENPC,     "GENPC",     XPC).callexport().noshow();
 	state_add(STATE_GENPCBASE, "CURPC",     XPC).callexport().noshow();
 	state_add(STATE_GENFLAGS,  "GENFLAGS",  P).callimport().formatstr("%6s").noshow();
@@ -402,7 +411,10 @@ void m6502_device::execute_run()
 			if(machine().debug_flags & DEBUG_FLAG_ENABLED)
 				debugger_instruction_hook(pc_to_external(NPC));
 		}
-		do_exec_full();
+		if(fast_exec)
+			do_exec_fast();
+		else
+			do_exec_full();
 	}
 }
 
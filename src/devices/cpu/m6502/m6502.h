@@ -50,6 +50,11 @@ public:
 		mintf = std::move(interface);
 	}
 
+	// run whole instructions at a time with direct memory accesses; only
+	// for instances whose map has no wait states, taps or handlers that
+	// depend on the exact cycle of an access
+	void set_fast_execution(bool fast) { fast_exec_requested = fast; }
+
 	bool get_sync() const { return sync; }
 
 	auto sync_cb() { return sync_w.bind(); }
@@ -138,6 +143,7 @@ protected:
 	bool nmi_state, irq_state, apu_irq_state, v_state;
 	bool nmi_pending, irq_taken, sync, inhibit_interrupts;
 	bool uses_custom_memory_interface;
+	bool fast_exec_requested, fast_exec;
 
 	uint8_t read(uint16_t adr) { return mintf->read(adr); }
 	uint8_t read_9(uint16_t adr) { return mintf->read_9(adr); }
@@ -145,6 +151,13 @@ protected:
 	void write_9(uint16_t adr, uint8_t val) { mintf->write_9(adr, val); }
 	uint8_t read_arg(uint16_t adr) { return mintf->read_arg(adr); }
 	uint8_t read_pc() { return mintf->read_arg(PC); }
+
+	// non-virtual equivalents of mi_default, used by the _fast handlers
+	uint8_t fast_read(uint16_t adr) { return mintf->program.read_byte(adr); }
+	uint8_t fast_read_sync(uint16_t adr) { return mintf->csprogram.read_byte(adr); }
+	uint8_t fast_read_arg(uint16_t adr) { return mintf->cprogram.read_byte(adr); }
+	uint8_t fast_read_pc() { return mintf->cprogram.read_byte(PC); }
+	void fast_write(uint16_t adr, uint8_t val) { mintf->program.write_byte(adr, val); }
 	void prefetch_start();
 	void prefetch_end();
 	void prefetch_end_noirq();
@@ -154,6 +167,7 @@ protected:
 	virtual offs_t pc_to_external(u16 pc); // For paged PCs
 	virtual void do_exec_full();
 	virtual void do_exec_partial();
+	virtual void do_exec_fast();
 
 	// inline helpers
 	static inline bool page_changing(uint16_t base, int delta) { return ((base + delta) ^ base) & 0xff00; }
@@ -181,7 +195,7 @@ protected:
 	uint8_t do_rol(uint8_t v);
 	uint8_t do_asr(uint8_t v);
 
-#define O(o) void o ## _full(); void o ## _partial()
+#define O(o) void o ## _full(); void o ## _partial(); void o ## _fast()
 
 	// NMOS 6502 opcodes
 	//   documented opcodes
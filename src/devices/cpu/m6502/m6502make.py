@@ -6,6 +6,7 @@ from __future__ import print_function
 
 import io
 import logging
+import re
 import sys
 
 USAGE = """
@@ -77,6 +78,21 @@ def identify_line_type(ins):
     return "NONE"
 
 
+# accesses rewritten to the non-virtual helpers in the _fast handlers
+FAST_ACCESSES = [
+    (re.compile(r"mintf->read_sync\("), "fast_read_sync("),
+    (re.compile(r"(?<![\w>.])read_pc\(\)"), "fast_read_pc()"),
+    (re.compile(r"(?<![\w>.])read_arg\("), "fast_read_arg("),
+    (re.compile(r"(?<![\w>.])read\("), "fast_read("),
+    (re.compile(r"(?<![\w>.])write\("), "fast_write("),
+]
+
+def fast_access(ins):
+    for pattern, replacement in FAST_ACCESSES:
+        ins = pattern.sub(replacement, ins)
+    return ins
+
+
 def save_opcodes(f, device, opcodes):
     for name, instructions in opcodes:
         emit(f, "void %s_device::%s_full()" % (device, name))
@@ -143,6 +159,23 @@ def save_opcodes(f, device, opcodes):
         emit(f, "}")
         emit(f, "")
 
+        # instruction-granular variant: runs to the end of the instruction
+        # without checking icount between accesses, so it never leaves a
+        # substate behind; instructions that wait use the full variant
+        emit(f, "void %s_device::%s_fast()" % (device, name))
+        emit(f, "{")
+        if any(identify_line_type(ins) == "EAT" for ins in instructions):
+            emit(f, "	%s_full();" % name)
+        else:
+            for ins in instructions:
+                if identify_line_type(ins) == "MEMORY":
+                    emit(f, fast_access(ins))
+                    emit(f, "	icount--;")
+                else:
+                    emit(f, ins)
+        emit(f, "}")
+        emit(f, "")
+
 
 DO_EXEC_FULL_PROLOG="""\
 void %(device)s_device::do_exec_full()
@@ -166,6 +199,17 @@ DO_EXEC_PARTIAL_EPILOG="""\
 }
 """
 
+DO_EXEC_FAST_PROLOG="""\
+void %(device)s_device::do_exec_fast()
+{
+\tswitch(inst_state) {
+"""
+
+DO_EXEC_FAST_EPILOG="""\
+\t}
+}
+"""
+
 DISASM_PROLOG="""\
 const %(device)s_disassembler::disasm_entry %(device)s_disassembler::disasm_entries[0x%(disasm_count)x] = {
 """
@@ -199,6 +243,15 @@ def save_tables(f, device, states):
             emit(f, "\tcase %s: %s_partial(); break;" % ("STATE_RESET", state))
     emit(f, DO_EXEC_PARTIAL_EPILOG % d)
 
+    emit(f, DO_EXEC_FAST_PROLOG % d)
+    for n, state in enumerate(states):
+        if state == ".": continue
+        if n < total_states - 1:
+            emit(f, "\tcase 0x%02x: %s_fast(); break;" % (n, state))
+        else:
+            emit(f, "\tcase %s: %s_fast(); break;" % ("STATE_RESET", state))
+    emit(f, DO_EXEC_FAST_EPILOG % d)
+
 def save_dasm(f, device, states):
     total_states = len(states)
 
@@ -28,6 +28,7 @@ public:
 	virtual std::unique_ptr<util::disasm_interface> create_disassembler() override;
 	virtual void do_exec_full() override;
 	virtual void do_exec_partial() override;
+	virtual void do_exec_fast() override;
 
 protected:
 	m6510_device(const machine_config &mconfig, device_type type, const char *tag, device_t *owner, uint32_t clock);
@@ -60,7 +61,7 @@ protected:
 	void init_port();
 	void update_port();
 
-#define O(o) void o ## _full(); void o ## _partial()
+#define O(o) void o ## _full(); void o ## _partial(); void o ## _fast()
 
 	// 6510 undocumented instructions in a C64 context
 	// implementation follows what the test suites expect (usually an extra and)
@@ -31,6 +31,8 @@ m68000_device::m68000_device(const machine_config &mconfig, device_type type, co
 	  m_disable_specifics(false),
 	  m_disable_interrupt_callback(false)
 {
+	m_program_config.m_flat_access = true;
+	m_opcodes_config.m_flat_access = true;
 }
 
 void m68000_device::abort_access(u32 reason)
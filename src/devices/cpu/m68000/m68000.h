@@ -246,253 +246,143 @@ protected:
 	inline int map_sp(int r) { return r == 15 ? m_sp : r; }
 	void set_ftu_const();
 
+	// Branch-free flag computation for a Bits-wide result, with the
+	// carry/borrow in bit Bits of r
+	template <int Bits> static u16 nz_flags(u32 r) {
+		return ((r >> (Bits - 4)) & SR_N) | ((r & ((1U << Bits) - 1)) ? 0 : SR_Z);
+	}
+
+	template <int Bits> static u16 add_flags(u32 a, u32 b, u32 r) {
+		return nz_flags<Bits>(r) | (((r >> Bits) & 1) * (SR_X|SR_C)) | ((((a ^ r) & (b ^ r)) >> (Bits - 2)) & SR_V);
+	}
+
+	template <int Bits> static u16 sub_flags(u32 a, u32 b, u32 r) {
+		return nz_flags<Bits>(r) | (((r >> Bits) & 1) * (SR_X|SR_C)) | ((((a ^ b) & (b ^ r)) >> (Bits - 2)) & SR_V);
+	}
+
 	inline void alu_add(u16 a, u16 b) {
 		u32 r = b + a;
-		m_isr = 0;
-		if(!(r & 0xffff))
-			m_isr |= SR_Z;
-		if(r & 0x8000)
-			m_isr |= SR_N;
-		if(r & 0x10000)
-			m_isr |= SR_X|SR_C;
-		if(((b&a&~r) | ((~b)&(~a)&r)) & 0x8000)
-			m_isr |= SR_V;
+		m_isr = add_flags<16>(a, b, r);
 		m_aluo = r;
 	}
 
 	inline void alu_add8(u8 a, u8 b) {
 		u16 r = b + a;
-		m_isr = 0;
-		if(!(r & 0xff))
-			m_isr |= SR_Z;
-		if(r & 0x80)
-			m_isr |= SR_N;
-		if(r & 0x100)
-			m_isr |= SR_X|SR_C;
-		if(((b&a&~r) | ((~b)&(~a)&r)) & 0x80)
-			m_isr |= SR_V;
+		m_isr = add_flags<8>(a, b, r);
 		m_aluo = r;
 	}
 
 	inline void alu_addc(u16 a, u16 b) {
 		u32 r = b + a + ((m_isr & SR_C) ? 1 : 0);
-		m_isr = 0;
-		if(!(r & 0xffff))
-			m_isr |= SR_Z;
-		if(r & 0x8000)
-			m_isr |= SR_N;
-		if(r & 0x10000)
-			m_isr |= SR_X|SR_C;
-		if(((b&a&~r) | ((~b)&(~a)&r)) & 0x8000)
-			m_isr |= SR_V;
+		m_isr = add_flags<16>(a, b, r);
 		m_aluo = r;
 	}
 
 	inline void alu_addx(u16 a, u16 b) {
 		u32 r = b + a + ((m_sr & SR_X) ? 1 : 0);
-		m_isr = 0;
-		if(!(r & 0xffff))
-			m_isr |= SR_Z;
-		if(r & 0x8000)
-			m_isr |= SR_N;
-		if(r & 0x10000)
-			m_isr |= SR_X|SR_C;
-		if(((b&a&~r) | ((~b)&(~a)&r)) & 0x8000)
-			m_isr |= SR_V;
+		m_isr = add_flags<16>(a, b, r);
 		m_aluo = r;
 	}
 
 	inline void alu_addx8(u8 a, u8 b) {
 		u16 r = b + a + ((m_sr & SR_X) ? 1 : 0);
-		m_isr = 0;
-		if(!(r & 0xff))
-			m_isr |= SR_Z;
-		if(r & 0x80)
-			m_isr |= SR_N;
-		if(r & 0x100)
-			m_isr |= SR_X|SR_C;
-		if(((b&a&~r) | ((~b)&(~a)&r)) & 0x80)
-			m_isr |= SR_V;
+		m_isr = add_flags<8>(a, b, r);
 		m_aluo = r;
 	}
 
 	inline void alu_and(u16 a, u16 b) {
 		u16 r = b & a;
-		m_isr = m_sr & SR_X;
-		if(!r)
-			m_isr |= SR_Z;
-		if(r & 0x8000)
-			m_isr |= SR_N;
+		m_isr = (m_sr & SR_X) | nz_flags<16>(r);
 		m_aluo = r;
 	}
 
 	inline void alu_andx(u16 a, u16 b) {
 		u16 r = b & a;
-		m_isr = m_sr & SR_X ? SR_X|SR_C : 0;
-		if(!r)
-			m_isr |= SR_Z;
-		if(r & 0x8000)
-			m_isr |= SR_N;
+		m_isr = (m_sr & SR_X ? SR_X|SR_C : 0) | nz_flags<16>(r);
 		m_aluo = r;
 	}
 
 	inline void alu_and8(u16 a, u16 b) {
 		u16 r = b & a;
-		m_isr = m_sr & SR_X;
-		if(!(r & 0xff))
-			m_isr |= SR_Z;
-		if(r & 0x80)
-			m_isr |= SR_N;
+		m_isr = (m_sr & SR_X) | nz_flags<8>(r);
 		m_aluo = r;
 	}
 
 	inline void alu_and8x(u8 a, u8 b) {
 		u8 r = b & a;
-		m_isr = m_sr & SR_X ? SR_X|SR_C : 0;
-		if(!r)
-			m_isr |= SR_Z;
-		if(r & 0x80)
-			m_isr |= SR_N;
+		m_isr = (m_sr & SR_X ? SR_X|SR_C : 0) | nz_flags<8>(r);
 		m_aluo = r;
 	}
 
 	inline void alu_or(u16 a, u16 b) {
 		u16 r = b | a;
-		m_isr = m_sr & SR_X;
-		if(!r)
-			m_isr |= SR_Z;
-		if(r & 0x8000)
-			m_isr |= SR_N;
+		m_isr = (m_sr & SR_X) | nz_flags<16>(r);
 		m_aluo = r;
 	}
 
 	inline void alu_or8(u8 a, u8 b) {
 		u8 r = b | a;
-		m_isr = m_sr & SR_X;
-		if(!r)
-			m_isr |= SR_Z;
-		if(r & 0x80)
-			m_isr |= SR_N;
+		m_isr = (m_sr & SR_X) | nz_flags<8>(r);
 		m_aluo = r;
 	}
 
 	inline void alu_eor(u16 a, u16 b) {
 		u16 r = b ^ a;
-		m_isr = m_sr & SR_X;
-		if(!r)
-			m_isr |= SR_Z;
-		if(r & 0x8000)
-			m_isr |= SR_N;
+		m_isr = (m_sr & SR_X) | nz_flags<16>(r);
 		m_aluo = r;
 	}
 
 	inline void alu_eor8(u8 a, u8 b) {
 		u8 r = b ^ a;
-		m_isr = m_sr & SR_X;
-		if(!r)
-			m_isr |= SR_Z;
-		if(r & 0x80)
-			m_isr |= SR_N;
+		m_isr = (m_sr & SR_X) | nz_flags<8>(r);
 		m_aluo = r;
 	}
 
 	inline void alu_ext(u16 a) {
 		u16 r = s8(a);
-		m_isr = 0;
-		if(!r)
-			m_isr |= SR_Z;
-		if(r & 0x8000)
-			m_isr |= SR_N;
+		m_isr = nz_flags<16>(r);
 		m_aluo = r;
 	}
 
 	inline void alu_not(u16 a) {
 		u16 r = ~a;
-		m_isr = 0;
-		if(!r)
-			m_isr |= SR_Z;
-		if(r & 0x8000)
-			m_isr |= SR_N;
+		m_isr = nz_flags<16>(r);
 		m_aluo = r;
 	}
 
 	inline void alu_not8(u8 a) {
 		u8 r = ~a;
-		m_isr = 0;
-		if(!r)
-			m_isr |= SR_Z;
-		if(r & 0x80)
-			m_isr |= SR_N;
+		m_isr = nz_flags<8>(r);
 		m_aluo = r;
 	}
 
 	inline void alu_sub(u16 a, u16 b) {
 		u32 r = b - a;
-		m_isr = 0;
-		if(!(r & 0xffff))
-			m_isr |= SR_Z;
-		if(r & 0x8000)
-			m_isr |= SR_N;
-		if(r & 0x10000)
-			m_isr |= SR_X|SR_C;
-		if(((b&(~a)&~r) | ((~b)&a&r)) & 0x8000)
-			m_isr |= SR_V;
+		m_isr = sub_flags<16>(a, b, r);
 		m_aluo = r;
 	}
 
 	inline void alu_sub8(u8 a, u8 b) {
 		u16 r = b - a;
-		m_isr = 0;
-		if(!(r & 0xff))
-			m_isr |= SR_Z;
-		if(r & 0x80)
-			m_isr |= SR_N;
-		if(r & 0x100)
-			m_isr |= SR_X|SR_C;
-		if(((b&(~a)&~r) | ((~b)&a&r)) & 0x80)
-			m_isr |= SR_V;
+		m_isr = sub_flags<8>(a, b, r);
 		m_aluo = r;
 	}
 
 	inline void alu_subc(u16 a, u16 b) {
 		u32 r = b - a - ((m_isr & SR_C) ? 1 : 0);
-		m_isr = 0;
-		if(!(r & 0xffff))
-			m_isr |= SR_Z;
-		if(r & 0x8000)
-			m_isr |= SR_N;
-		if(r & 0x10000)
-			m_isr |= SR_X|SR_C;
-		if(((b&(~a)&~r) | ((~b)&a&r)) & 0x8000)
-			m_isr |= SR_V;
+		m_isr = sub_flags<16>(a, b, r);
 		m_aluo = r;
 	}
 
 	inline void alu_subx(u16 a, u16 b) {
 		u32 r = b - a - ((m_sr & SR_X) ? 1 : 0);
-		m_isr = 0;
-		if(!(r & 0xffff))
-			m_isr |= SR_Z;
-		if(r & 0x8000)
-			m_isr |= SR_N;
-		if(r & 0x10000)
-			m_isr |= SR_X|SR_C;
-		if(((b&(~a)&~r) | ((~b)&a&r)) & 0x8000)
-			m_isr |= SR_V;
+		m_isr = sub_flags<16>(a, b, r);
 		m_aluo = r;
 	}
 
 	inline void alu_subx8(u8 a, u8 b) {
 		u16 r = b - a - ((m_sr & SR_X) ? 1 : 0);
-		m_isr = 0;
-		if(!(r & 0xff))
-			m_isr |= SR_Z;
-		if(r & 0x80)
-			m_isr |= SR_N;
-		if(r & 0x100)
-			m_isr |= SR_X|SR_C;
-		if(((b&(~a)&~r) | ((~b)&a&r)) & 0x80)
-			m_isr |= SR_V;
+		m_isr = sub_flags<8>(a, b, r);
 		m_aluo = r;
 	}
 
@@ -6,8 +6,15 @@
 
 #pragma once
 
+#include "cpu/drcfe.h"
+#include "cpu/drcuml.h"
+
+class mb86233_frontend;
+
 class mb86233_device : public cpu_device
 {
+	friend class mb86233_frontend;
+
 public:
 	enum address_space_ids {
 		AS_RF = 4,
@@ -59,8 +66,9 @@ public:
 	};
 
 	mb86233_device(const machine_config &mconfig, const char *tag, device_t *owner, uint32_t clock);
+	virtual ~mb86233_device();
 
-	void stall() { m_stall = true; }
+	void stall() { m_core->stall = true; }
 
 	void gpio0_w(int state);
 	void gpio1_w(int state);
@@ -95,15 +103,42 @@ private:
 	memory_access<16, 2, -2, ENDIANNESS_LITTLE>::specific m_io;
 	memory_access< 4, 2, -2, ENDIANNESS_LITTLE>::specific m_rf;
 
-	int m_icount;
+	// state shared with the recompiler, allocated near the drc cache
+	struct internal_state
+	{
+		int icount;
+
+		u32 st, a, b, d, p;
+		u32 alu_stmask, alu_stset, alu_r1, alu_r2;
+		u16 ppc, pc, sp, b0, b1, x0, x1, i0, i1, vsmr, pcs[4], mask, m;
+		u8 r, rpc, c0, c1, sft, vsm;
+		bool gpio0, gpio1, gpio2, gpio3;
+
+		bool stall;
+
+		u32 arg0, arg1;
+	};
+
+	internal_state *m_core;
+
+	// recompiler state
+	struct compiler_state
+	{
+		compiler_state &operator=(compiler_state const &) = delete;
+
+		u32 cycles;                 // accumulated cycles
+		uml::code_label labelnum;   // index for local labels
+	};
 
-	u32 m_st, m_a, m_b, m_d, m_p;
-	u32 m_alu_stmask, m_alu_stset, m_alu_r1, m_alu_r2;
-	u16 m_ppc, m_pc, m_sp, m_b0, m_b1, m_x0, m_x1, m_i0, m_i1, m_vsmr, m_pcs[4], m_mask, m_m;
-	u8 m_r, m_rpc, m_c0, m_c1, m_sft, m_vsm;
-	bool m_gpio0, m_gpio1, m_gpio2, m_gpio3;
+	drc_cache m_drccache;
+	std::unique_ptr<drcuml_state> m_drcuml;
+	std::unique_ptr<mb86233_frontend> m_drcfe;
+	bool m_enable_drc;
+	bool m_cache_dirty;
 
-	bool m_stall;
+	uml::code_handle *m_entry;
+	uml::code_handle *m_nocode;
+	uml::code_handle *m_out_of_cycles;
 
 	static s32 s24_32(u32 val);
 	static u32 set_exp(u32 val, u32 exp);
@@ -129,6 +164,43 @@ private:
 	void write_mem_internal_1(u32 r, u32 v, bool bank);
 	void write_mem_external_1(u32 r, u32 v);
 	void write_mem_io_1(u32 r, u32 v);
+
+	bool execute_op(u32 opcode);
+
+	// mb86233drc.cpp
+	void run_drc();
+	void flush_cache();
+	void compile_block(offs_t pc);
+	void alloc_handle(uml::code_handle *&handleptr, const char *name);
+	void static_generate_entry_point();
+	void static_generate_nocode_handler();
+	void static_generate_out_of_cycles();
+
+	void generate_sequence_instruction(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
+	void generate_update_cycles(drcuml_block &block, compiler_state &compiler, uml::parameter param);
+	void generate_stall_check(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
+	void generate_fallback(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
+	bool generate_opcode(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
+	bool generate_lab(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
+	bool generate_mov(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
+	void generate_branch(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
+	void generate_repeat(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uml::code_label top);
+	void generate_jump(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, offs_t target);
+	bool generate_alu_pre(drcuml_block &block, compiler_state &compiler, u32 alu);
+	void generate_alu_post(drcuml_block &block, compiler_state &compiler, u32 alu);
+	void generate_set_sz(drcuml_block &block, uml::parameter val, u32 mask, uml::parameter dst);
+	void generate_testdz(drcuml_block &block);
+	void generate_ea_pre(drcuml_block &block, int bank, u32 r);
+	void generate_ea_post(drcuml_block &block, int bank, u32 r);
+	void generate_reg_read(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, u32 r, uml::parameter dst);
+	void generate_reg_write(drcuml_block &block, u32 r, uml::parameter src);
+
+	static bool alu_supported(u32 alu);
+
+public:
+	void cfunc_execute_op();
+	void cfunc_read_reg();
+	void cfunc_write_reg();
 };
 
 class mb86234_device : public mb86233_device
@@ -0,0 +1,971 @@
+// license:BSD-3-Clause
+// copyright-holders:Olivier Galibert
+/******************************************************************************
+
+    MB86233 UML recompiler core
+
+    Data moves, loads, the alu, the repeat counter and the immediate
+    branches are compiled natively.  Everything else (brul/bsul, ldif,
+    cfxd and the unknown sub-opcodes) calls back into execute_op, the
+    interpreter's own implementation, with pc and ppc set as the
+    interpreter would have them.
+
+******************************************************************************/
+
+#include "emu.h"
+#include "mb86233.h"
+#include "mb86233fe.h"
+
+#include "cpu/drcfe.h"
+#include "cpu/drcuml.h"
+#include "cpu/drcumlsh.h"
+
+
+// map variables
+#define MAPVAR_PC                       uml::M0
+
+// exit codes
+#define EXECUTE_OUT_OF_CYCLES           0
+#define EXECUTE_MISSING_CODE            1
+#define EXECUTE_UNMAPPED_CODE           2
+#define EXECUTE_RESET_CACHE             3
+
+
+#define ICOUNT                  uml::mem(&m_core->icount)
+#define ST                      uml::mem(&m_core->st)
+#define A                       uml::mem(&m_core->a)
+#define B                       uml::mem(&m_core->b)
+#define D                       uml::mem(&m_core->d)
+#define P                       uml::mem(&m_core->p)
+#define ALU_R1                  uml::mem(&m_core->alu_r1)
+#define ALU_R2                  uml::mem(&m_core->alu_r2)
+#define ALU_STSET               uml::mem(&m_core->alu_stset)
+#define ARG0                    uml::mem(&m_core->arg0)
+#define ARG1                    uml::mem(&m_core->arg1)
+
+// the narrower registers keep their interpreter types, so go through load/store
+#define LOAD16(dst, field)      UML_LOAD(block, dst, &m_core->field, 0, SIZE_WORD, SCALE_x1)
+#define STORE16(field, src)     UML_STORE(block, &m_core->field, 0, src, SIZE_WORD, SCALE_x1)
+#define LOAD8(dst, field)       UML_LOAD(block, dst, &m_core->field, 0, SIZE_BYTE, SCALE_x1)
+#define STORE8(field, src)      UML_STORE(block, &m_core->field, 0, src, SIZE_BYTE, SCALE_x1)
+
+static constexpr u32 ALU_STMASK = mb86233_device::F_ZRD | mb86233_device::F_SGD | mb86233_device::F_CPD | mb86233_device::F_OVD | mb86233_device::F_DVZD;
+
+
+inline void mb86233_device::alloc_handle(uml::code_handle *&handleptr, const char *name)
+{
+	if(!handleptr)
+		handleptr = m_drcuml->handle_alloc(name);
+}
+
+
+/***************************************************************************
+    C FUNCTION CALLBACKS
+***************************************************************************/
+
+void mb86233_device::cfunc_execute_op()
+{
+	execute_op(m_core->arg0);
+}
+
+void mb86233_device::cfunc_read_reg()
+{
+	m_core->arg1 = read_reg(m_core->arg0);
+}
+
+void mb86233_device::cfunc_write_reg()
+{
+	write_reg(m_core->arg0, m_core->arg1);
+}
+
+static void cfunc_execute_op(void *param)
+{
+	((mb86233_device *)param)->cfunc_execute_op();
+}
+
+static void cfunc_read_reg(void *param)
+{
+	((mb86233_device *)param)->cfunc_read_reg();
+}
+
+static void cfunc_write_reg(void *param)
+{
+	((mb86233_device *)param)->cfunc_write_reg();
+}
+
+
+/***************************************************************************
+    CACHE MANAGEMENT
+***************************************************************************/
+
+void mb86233_device::run_drc()
+{
+	if(m_cache_dirty) {
+		flush_cache();
+		m_cache_dirty = false;
+	}
+
+	int execute_result;
+	do {
+		execute_result = m_drcuml->execute(*m_entry);
+
+		if(execute_result == EXECUTE_MISSING_CODE)
+			compile_block(m_core->pc);
+		else if(execute_result == EXECUTE_UNMAPPED_CODE)
+			fatalerror("MB86233: attempted to execute unmapped code at PC=%04X\n", m_core->pc);
+		else if(execute_result == EXECUTE_RESET_CACHE)
+			flush_cache();
+	} while(execute_result != EXECUTE_OUT_OF_CYCLES);
+}
+
+void mb86233_device::flush_cache()
+{
+	// empty the transient cache contents
+	m_drcuml->reset();
+
+	try {
+		static_generate_entry_point();
+		static_generate_nocode_handler();
+		static_generate_out_of_cycles();
+	} catch(drcuml_block::abort_compilation &) {
+		fatalerror("MB86233: error generating static handlers\n");
+	}
+}
+
+void mb86233_device::compile_block(offs_t pc)
+{
+	compiler_state compiler = { 0, 1 };
+	const opcode_desc *seqhead, *seqlast;
+	bool override = false;
+
+	auto profile = g_profiler.start(PROFILER_DRC_COMPILE);
+
+	const opcode_desc *desclist = m_drcfe->describe_code(pc);
+
+	bool succeeded = false;
+	while(!succeeded) {
+		try {
+			drcuml_block &block(m_drcuml->begin_block(4096));
+
+			for(seqhead = desclist; seqhead != nullptr; seqhead = seqlast->next()) {
+				// determine the last instruction in this sequence
+				for(seqlast = seqhead; seqlast != nullptr; seqlast = seqlast->next())
+					if(seqlast->flags & OPFLAG_END_SEQUENCE)
+						break;
+				assert(seqlast != nullptr);
+
+				// if we don't have a hash for this pc, or if we are overriding all, add one
+				if(override || !m_drcuml->hash_exists(0, seqhead->pc))
+					UML_HASH(block, 0, seqhead->pc);
+
+				// if we already have a hash, and this is the first sequence, assume that we
+				// are recompiling due to being out of sync and allow future overrides
+				else if(seqhead == desclist) {
+					override = true;
+					UML_HASH(block, 0, seqhead->pc);
+				}
+
+				// otherwise, redispatch to that fixed pc and skip the rest of the processing
+				else {
+					UML_LABEL(block, seqhead->pc | 0x80000000);
+					UML_HASHJMP(block, 0, seqhead->pc, *m_nocode);
+					continue;
+				}
+
+				// label this instruction, if it may be jumped to locally
+				if(seqhead->flags & OPFLAG_IS_BRANCH_TARGET)
+					UML_LABEL(block, seqhead->pc | 0x80000000);
+
+				for(const opcode_desc *curdesc = seqhead; curdesc != seqlast->next(); curdesc = curdesc->next())
+					generate_sequence_instruction(block, compiler, curdesc);
+
+				u32 nextpc = (seqlast->pc + seqlast->length) & 0xffff;
+				generate_update_cycles(block, compiler, nextpc);
+
+				if(seqlast->next() == nullptr || seqlast->next()->pc != nextpc)
+					UML_HASHJMP(block, 0, nextpc, *m_nocode);
+			}
+
+			block.end();
+			succeeded = true;
+		} catch(drcuml_block::abort_compilation &) {
+			flush_cache();
+		}
+	}
+}
+
+
+/***************************************************************************
+    STATIC CODEGEN
+***************************************************************************/
+
+void mb86233_device::static_generate_entry_point()
+{
+	drcuml_block &block(m_drcuml->begin_block(20));
+
+	// forward references
+	alloc_handle(m_nocode, "nocode");
+
+	alloc_handle(m_entry, "entry");
+	UML_HANDLE(block, *m_entry);
+
+	LOAD16(I0, pc);
+	UML_HASHJMP(block, 0, I0, *m_nocode);
+
+	block.end();
+}
+
+void mb86233_device::static_generate_nocode_handler()
+{
+	drcuml_block &block(m_drcuml->begin_block(10));
+
+	alloc_handle(m_nocode, "nocode");
+	UML_HANDLE(block, *m_nocode);
+	UML_GETEXP(block, I0);
+	STORE16(pc, I0);
+	UML_EXIT(block, EXECUTE_MISSING_CODE);
+
+	block.end();
+}
+
+void mb86233_device::static_generate_out_of_cycles()
+{
+	drcuml_block &block(m_drcuml->begin_block(10));
+
+	alloc_handle(m_out_of_cycles, "out_of_cycles");
+	UML_HANDLE(block, *m_out_of_cycles);
+	UML_GETEXP(block, I0);
+	STORE16(pc, I0);
+	UML_EXIT(block, EXECUTE_OUT_OF_CYCLES);
+
+	block.end();
+}
+
+
+/***************************************************************************
+    CODE GENERATION
+***************************************************************************/
+
+void mb86233_device::generate_sequence_instruction(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc)
+{
+	UML_MAPVAR(block, MAPVAR_PC, desc->pc);
+
+	// a repeated instruction loops on itself, so start it with no
+	// pending cycles to keep the per-iteration accounting exact
+	bool const repeated = desc->userflags & OP_USERFLAG_REPEATED_OP;
+	uml::code_label repeat_top = 0;
+	if(repeated) {
+		generate_update_cycles(block, compiler, desc->pc);
+		repeat_top = compiler.labelnum++;
+		UML_LABEL(block, repeat_top);
+	}
+
+	compiler.cycles += desc->cycles;
+
+	if(machine().debug_flags & DEBUG_FLAG_ENABLED) {
+		STORE16(pc, desc->pc);
+		STORE16(ppc, desc->pc);
+		UML_DEBUG(block, desc->pc);
+	}
+
+	if(desc->flags & OPFLAG_COMPILER_UNMAPPED) {
+		STORE16(pc, desc->pc);
+		UML_EXIT(block, EXECUTE_UNMAPPED_CODE);
+	}
+
+	if(!generate_opcode(block, compiler, desc))
+		generate_fallback(block, compiler, desc);
+
+	if(repeated)
+		generate_repeat(block, compiler, desc, repeat_top);
+}
+
+void mb86233_device::generate_update_cycles(drcuml_block &block, compiler_state &compiler, uml::parameter param)
+{
+	if(compiler.cycles > 0) {
+		UML_SUB(block, ICOUNT, ICOUNT, compiler.cycles);
+		UML_EXHc(block, COND_S, *m_out_of_cycles, param);
+	}
+	compiler.cycles = 0;
+}
+
+void mb86233_device::generate_stall_check(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc)
+{
+	// a stalled access retries the whole instruction, like the interpreter
+	uml::code_label no_stall = compiler.labelnum++;
+
+	LOAD8(I3, stall);
+	UML_TEST(block, I3, 0xff);
+	UML_JMPc(block, COND_Z, no_stall);
+	STORE8(stall, 0);
+	compiler_state compiler_temp(compiler);
+	generate_update_cycles(block, compiler_temp, desc->pc);
+	UML_HASHJMP(block, 0, desc->pc, *m_nocode);
+	UML_LABEL(block, no_stall);
+}
+
+void mb86233_device::generate_fallback(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc)
+{
+	STORE16(ppc, desc->pc);
+	STORE16(pc, (desc->pc + 1) & 0xffff);
+	UML_MOV(block, ARG0, desc->opptr.l[0]);
+	UML_CALLC(block, ::cfunc_execute_op, this);
+	generate_stall_check(block, compiler, desc);
+
+	if(desc->flags & OPFLAG_IS_BRANCH) {
+		LOAD16(I0, pc);
+		compiler_state compiler_temp(compiler);
+		generate_update_cycles(block, compiler_temp, uml::I0);
+		UML_HASHJMP(block, 0, I0, *m_nocode);
+	}
+}
+
+void mb86233_device::generate_repeat(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uml::code_label top)
+{
+	uml::code_label done = compiler.labelnum++;
+
+	LOAD8(I0, r);
+	UML_CMP(block, I0, 1);
+	UML_JMPc(block, COND_E, done);
+	UML_SUB(block, I0, I0, 1);
+	STORE8(r, I0);
+	UML_SUB(block, ICOUNT, ICOUNT, compiler.cycles);
+	UML_EXHc(block, COND_S, *m_out_of_cycles, desc->pc);
+	UML_JMP(block, top);
+	UML_LABEL(block, done);
+}
+
+void mb86233_device::generate_jump(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, offs_t target)
+{
+	compiler_state compiler_temp(compiler);
+	generate_update_cycles(block, compiler_temp, target);
+	if(desc->flags & OPFLAG_INTRABLOCK_BRANCH)
+		UML_JMP(block, target | 0x80000000);
+	else
+		UML_HASHJMP(block, 0, target, *m_nocode);
+}
+
+bool mb86233_device::generate_opcode(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc)
+{
+	u32 opcode = desc->opptr.l[0];
+
+	switch((opcode >> 26) & 0x3f) {
+	case 0x00:
+		return generate_lab(block, compiler, desc);
+
+	case 0x07:
+		return generate_mov(block, compiler, desc);
+
+	case 0x0d:
+		// stmh only
+		if(((opcode >> 17) & 7) != 5)
+			return false;
+		STORE16(m, opcode & 0xffff);
+		return true;
+
+	case 0x0e:
+		switch((opcode >> 24) & 0x3) {
+		case 0:
+			UML_AND(block, P, P, 0xff000000);
+			UML_OR(block, P, P, opcode & 0xffffff);
+			break;
+		case 1:
+			UML_MOV(block, A, u32(s24_32(opcode)));
+			break;
+		case 2:
+			UML_MOV(block, B, u32(s24_32(opcode)));
+			break;
+		case 3: {
+			u32 v = s24_32(opcode);
+			UML_MOV(block, D, v);
+			UML_AND(block, ST, ST, ~(F_ZRD | F_SGD));
+			if(u32 flags = v ? (v & 0x80000000 ? F_SGD : 0) : F_ZRD)
+				UML_OR(block, ST, ST, flags);
+			break;
+		}
+		}
+		return true;
+
+	case 0x0f: {
+		u32 alu = (opcode >> 20) & 0x1f;
+		u32 sub2 = (opcode >> 17) & 7;
+
+		if(sub2 == 2) {
+			// rep, the alu part never reaches its post stage
+			if(opcode & 0x8000) {
+				generate_reg_read(block, compiler, desc, opcode, uml::I0);
+				STORE8(r, I0);
+			} else
+				STORE8(r, opcode & 0xff);
+			return true;
+		}
+
+		if((sub2 != 0 && sub2 != 1 && sub2 != 3) || !alu_supported(alu))
+			return false;
+
+		generate_alu_pre(block, compiler, alu);
+		if(sub2 == 0) {
+			if(opcode & 0x0004) UML_MOV(block, A, 0);
+			if(opcode & 0x0008) UML_MOV(block, B, 0);
+			if(opcode & 0x0010) UML_MOV(block, D, 0);
+		}
+		generate_alu_post(block, compiler, alu);
+		return true;
+	}
+
+	case 0x10: case 0x11: case 0x12: case 0x13: case 0x14: case 0x15: case 0x16: case 0x17:
+	case 0x18: case 0x19: case 0x1a: case 0x1b: case 0x1c: case 0x1d: case 0x1e: case 0x1f:
+		// ldi
+		generate_reg_write(block, opcode >> 24, u32(s24_32(opcode)));
+		return true;
+
+	case 0x2f: case 0x3f:
+		switch((opcode >> 17) & 7) {
+		case 0: case 2: case 5:
+			generate_branch(block, compiler, desc);
+			return true;
+		default:
+			return false;
+		}
+
+	default:
+		return false;
+	}
+}
+
+bool mb86233_device::generate_lab(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc)
+{
+	u32 opcode = desc->opptr.l[0];
+	u32 r1 = opcode & 0x1ff;
+	u32 r2 = (opcode >> 9) & 0x1ff;
+	u32 alu = (opcode >> 21) & 0x1f;
+	u32 op = (opcode >> 18) & 0x7;
+
+	if((op != 0 && op != 1 && op != 3 && op != 4) || !alu_supported(alu))
+		return false;
+
+	generate_alu_pre(block, compiler, alu);
+
+	generate_ea_pre(block, 0, r1);
+	if(op == 4)
+		UML_ADD(block, I0, I0, 0x200);
+	UML_READ(block, I1, I0, SIZE_DWORD, SPACE_DATA);
+	generate_stall_check(block, compiler, desc);
+
+	generate_ea_pre(block, 1, r2);
+	if(op == 3)
+		UML_ADD(block, I0, I0, 0x200);
+	if(op == 0 || op == 1)
+		UML_READ(block, I2, I0, SIZE_DWORD, SPACE_IO);
+	else
+		UML_READ(block, I2, I0, SIZE_DWORD, SPACE_DATA);
+	generate_stall_check(block, compiler, desc);
+
+	generate_ea_post(block, 0, r1);
+	generate_ea_post(block, 1, r2);
+	UML_MOV(block, A, I1);
+	UML_MOV(block, B, I2);
+
+	generate_alu_post(block, compiler, alu);
+	return true;
+}
+
+bool mb86233_device::generate_mov(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc)
+{
+	u32 opcode = desc->opptr.l[0];
+	u32 r1 = opcode & 0x1ff;
+	u32 r2 = (opcode >> 9) & 0x1ff;
+	u32 alu = (opcode >> 21) & 0x1f;
+	u32 op = (opcode >> 18) & 0x7;
+
+	if(op == 6 || (op == 7 && (r2 >> 6) == 7) || !alu_supported(alu))
+		return false;
+
+	generate_alu_pre(block, compiler, alu);
+
+	if(op != 7) {
+		// memory to memory, source on bank 0
+		generate_ea_pre(block, 0, r1);
+		if(op == 4)
+			UML_ADD(block, I0, I0, 0x200);
+		UML_READ(block, I1, I0, SIZE_DWORD, op == 2 ? SPACE_IO : op == 5 ? SPACE_PROGRAM : SPACE_DATA);
+		generate_stall_check(block, compiler, desc);
+		generate_ea_post(block, 0, r1);
+
+		generate_ea_pre(block, 1, r2);
+		if(op == 3)
+			UML_ADD(block, I0, I0, 0x200);
+		UML_WRITE(block, I0, I1, SIZE_DWORD, op <= 1 ? SPACE_IO : SPACE_DATA);
+		generate_ea_post(block, 1, r2);
+
+	} else {
+		switch(r2 >> 6) {
+		case 0: case 1:
+			// mov reg, mem / mov reg, mem (e)
+			generate_reg_read(block, compiler, desc, r2, uml::I1);
+			generate_ea_pre(block, 1, r1);
+			UML_WRITE(block, I0, I1, SIZE_DWORD, (r2 >> 6) ? SPACE_IO : SPACE_DATA);
+			generate_ea_post(block, 1, r1);
+			break;
+
+		case 2: case 3: case 4:
+			// mov mem + 0x200, reg / mov mem, reg / mov mem (e), reg
+			generate_ea_pre(block, 1, r1);
+			if((r2 >> 6) == 2)
+				UML_ADD(block, I0, I0, 0x200);
+			UML_READ(block, I1, I0, SIZE_DWORD, (r2 >> 6) == 4 ? SPACE_IO : SPACE_DATA);
+			generate_stall_check(block, compiler, desc);
+			generate_ea_post(block, 1, r1);
+			generate_reg_write(block, r2, uml::I1);
+			break;
+
+		case 5:
+			// mov mem (o), reg
+			generate_ea_pre(block, 0, r1);
+			UML_READ(block, I1, I0, SIZE_DWORD, SPACE_PROGRAM);
+			generate_stall_check(block, compiler, desc);
+			generate_ea_post(block, 0, r1);
+			generate_reg_write(block, r2, uml::I1);
+			break;
+
+		case 6:
+			// mov reg, reg
+			generate_reg_read(block, compiler, desc, r1, uml::I1);
+			generate_reg_write(block, r2, uml::I1);
+			break;
+		}
+	}
+
+	generate_alu_post(block, compiler, alu);
+	return true;
+}
+
+void mb86233_device::generate_branch(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc)
+{
+	u32 opcode = desc->opptr.l[0];
+	u32 cond = (opcode >> 20) & 0x1f;
+	u32 subtype = (opcode >> 17) & 7;
+	int kind = mb86233_frontend::branch_condition_kind(opcode);
+
+	if(kind == mb86233_frontend::COND_NEVER)
+		return;
+
+	uml::condition_t pass = uml::COND_NZ;
+	if(kind == mb86233_frontend::COND_RUNTIME) {
+		switch(cond) {
+		case 0x00: UML_TEST(block, ST, F_ZRD); pass = uml::COND_NZ; break;
+		case 0x01: UML_TEST(block, ST, F_SGD); pass = uml::COND_Z;  break;
+		case 0x02: UML_TEST(block, ST, F_ZRD | F_SGD); pass = uml::COND_NZ; break;
+		case 0x0a: LOAD8(I0, gpio0); UML_TEST(block, I0, 0xff); pass = uml::COND_NZ; break;
+		case 0x0b: LOAD8(I0, gpio1); UML_TEST(block, I0, 0xff); pass = uml::COND_NZ; break;
+		case 0x0c: LOAD8(I0, gpio2); UML_TEST(block, I0, 0xff); pass = uml::COND_NZ; break;
+		case 0x10: UML_TEST(block, ST, F_ZC0); pass = uml::COND_Z;  break;
+		case 0x11: UML_TEST(block, ST, F_ZC1); pass = uml::COND_Z;  break;
+		case 0x12: LOAD8(I0, gpio3); UML_TEST(block, I0, 0xff); pass = uml::COND_NZ; break;
+		}
+		if(opcode & 0x40000000)
+			pass = pass == uml::COND_Z ? uml::COND_NZ : uml::COND_Z;
+
+		// brif on zc0/zc1 counts down the loop counter after testing it
+		if(subtype == 0 && (cond == 0x10 || cond == 0x11)) {
+			uml::code_label counted = compiler.labelnum++;
+			UML_SETc(block, pass, I2);
+			if(cond == 0x10)
+				LOAD8(I1, c0);
+			else
+				LOAD8(I1, c1);
+			UML_CMP(block, I1, 1);
+			UML_JMPc(block, COND_E, counted);
+			UML_SUB(block, I1, I1, 1);
+			if(cond == 0x10)
+				STORE8(c0, I1);
+			else
+				STORE8(c1, I1);
+			UML_AND(block, I1, I1, 0xff);
+			UML_CMP(block, I1, 1);
+			UML_JMPc(block, COND_NE, counted);
+			UML_OR(block, ST, ST, cond == 0x10 ? F_ZC0 : F_ZC1);
+			UML_LABEL(block, counted);
+			UML_TEST(block, I2, 1);
+			pass = uml::COND_NZ;
+		}
+	}
+
+	uml::code_label skip = compiler.labelnum++;
+	if(kind == mb86233_frontend::COND_RUNTIME)
+		UML_JMPc(block, pass == uml::COND_Z ? uml::COND_NZ : uml::COND_Z, skip);
+
+	switch(subtype) {
+	case 2: // bsif #adr
+		for(int i = 3; i; i--) {
+			LOAD16(I0, pcs[i-1]);
+			STORE16(pcs[i], I0);
+		}
+		STORE16(pcs[0], (desc->pc + 1) & 0xffff);
+		[[fallthrough]];
+
+	case 0: // brif #adr
+		generate_jump(block, compiler, desc, opcode & 0xffff);
+		break;
+
+	case 5: { // rtif
+		LOAD16(I1, pcs[0]);
+		for(int i = 0; i != 3; i++) {
+			LOAD16(I0, pcs[i+1]);
+			STORE16(pcs[i], I0);
+		}
+		compiler_state compiler_temp(compiler);
+		generate_update_cycles(block, compiler_temp, uml::I1);
+		UML_HASHJMP(block, 0, I1, *m_nocode);
+		break;
+	}
+	}
+
+	if(kind == mb86233_frontend::COND_RUNTIME)
+		UML_LABEL(block, skip);
+}
+
+
+/*-------------------------------------------------
+    alu - same two-stage split as alu_pre and
+    alu_post, with the results kept in the same
+    temporaries
+-------------------------------------------------*/
+
+bool mb86233_device::alu_supported(u32 alu)
+{
+	// cfxd depends on the rounding mode in m at run time
+	return alu <= 0x1b && alu != 0x0f && alu != 0x12 && alu != 0x15;
+}
+
+void mb86233_device::generate_set_sz(drcuml_block &block, uml::parameter val, u32 mask, uml::parameter dst)
+{
+	UML_SHR(block, I3, val, 28);
+	UML_AND(block, I3, I3, F_SGD);
+	UML_TEST(block, val, mask);
+	UML_MOVc(block, COND_Z, I3, F_ZRD);
+	UML_MOV(block, dst, I3);
+}
+
+bool mb86233_device::generate_alu_pre(drcuml_block &block, compiler_state &compiler, u32 alu)
+{
+	switch(alu) {
+	case 0x00: break; // no alu
+
+	case 0x01: // andd
+		UML_AND(block, ALU_R1, D, A);
+		generate_set_sz(block, ALU_R1, 0xffffffff, ALU_STSET);
+		break;
+
+	case 0x02: // orad
+		UML_OR(block, ALU_R1, D, A);
+		generate_set_sz(block, ALU_R1, 0xffffffff, ALU_STSET);
+		break;
+
+	case 0x03: // eord
+		UML_XOR(block, ALU_R1, D, A);
+		generate_set_sz(block, ALU_R1, 0xffffffff, ALU_STSET);
+		break;
+
+	case 0x04: // notd
+		UML_XOR(block, ALU_R1, D, 0xffffffff);
+		generate_set_sz(block, ALU_R1, 0xffffffff, ALU_STSET);
+		break;
+
+	case 0x05: // fcpd
+		UML_FSSUB(block, F0, D, A);
+		UML_ICOPYFS(block, I0, F0);
+		generate_set_sz(block, uml::I0, 0x7fffffff, ALU_STSET);
+		break;
+
+	case 0x06: // fmad
+		UML_FSADD(block, ALU_R1, D, A);
+		generate_set_sz(block, ALU_R1, 0x7fffffff, ALU_STSET);
+		break;
+
+	case 0x07: // fsbd
+		UML_FSSUB(block, ALU_R1, D, A);
+		generate_set_sz(block, ALU_R1, 0x7fffffff, ALU_STSET);
+		break;
+
+	case 0x08: // fml
+		UML_FSMUL(block, ALU_R1, A, B);
+		UML_MOV(block, ALU_STSET, 0);
+		break;
+
+	case 0x09: // fmsd
+		UML_FSADD(block, ALU_R1, D, P);
+		UML_FSMUL(block, ALU_R2, A, B);
+		generate_set_sz(block, ALU_R1, 0x7fffffff, ALU_STSET);
+		break;
+
+	case 0x0a: // fmrd
+		UML_FSSUB(block, ALU_R1, D, P);
+		UML_FSMUL(block, ALU_R2, A, B);
+		generate_set_sz(block, ALU_R1, 0x7fffffff, ALU_STSET);
+		break;
+
+	case 0x0b: // fabd
+		UML_AND(block, ALU_R1, D, 0x7fffffff);
+		generate_set_sz(block, ALU_R1, 0x7fffffff, ALU_STSET);
+		break;
+
+	case 0x0c: // fsmd
+		UML_FSADD(block, ALU_R1, D, P);
+		generate_set_sz(block, ALU_R1, 0x7fffffff, ALU_STSET);
+		break;
+
+	case 0x0d: // fspd
+		UML_MOV(block, ALU_R1, P);
+		UML_FSMUL(block, ALU_R2, A, B);
+		generate_set_sz(block, ALU_R1, 0x7fffffff, ALU_STSET);
+		break;
+
+	case 0x0e: // cxfd
+		UML_FSFRINT(block, ALU_R1, D, SIZE_DWORD);
+		generate_set_sz(block, ALU_R1, 0xffffffff, ALU_STSET);
+		break;
+
+	case 0x10: // fdvd
+		UML_FSDIV(block, ALU_R1, D, A);
+		generate_set_sz(block, ALU_R1, 0x7fffffff, ALU_STSET);
+		break;
+
+	case 0x11: // fned
+		UML_XOR(block, I0, D, 0x80000000);
+		UML_CMP(block, D, 0);
+		UML_MOVc(block, COND_E, I0, 0);
+		UML_MOV(block, ALU_R1, I0);
+		generate_set_sz(block, ALU_R1, 0x7fffffff, ALU_STSET);
+		break;
+
+	case 0x13: // d = b + a
+		UML_FSADD(block, ALU_R1, B, A);
+		generate_set_sz(block, ALU_R1, 0x7fffffff, ALU_STSET);
+		break;
+
+	case 0x14: // d = b - a
+		UML_FSSUB(block, ALU_R1, B, A);
+		generate_set_sz(block, ALU_R1, 0x7fffffff, ALU_STSET);
+		break;
+
+	case 0x16: // lsrd
+		LOAD8(I0, sft);
+		UML_SHR(block, ALU_R1, D, I0);
+		generate_set_sz(block, ALU_R1, 0xffffffff, ALU_STSET);
+		break;
+
+	case 0x17: // lsld
+	case 0x19: // asld
+		LOAD8(I0, sft);
+		UML_SHL(block, ALU_R1, D, I0);
+		generate_set_sz(block, ALU_R1, 0xffffffff, ALU_STSET);
+		break;
+
+	case 0x18: // asrd
+		LOAD8(I0, sft);
+		UML_SAR(block, ALU_R1, D, I0);
+		generate_set_sz(block, ALU_R1, 0xffffffff, ALU_STSET);
+		break;
+
+	case 0x1a: // addd
+		UML_ADD(block, ALU_R1, D, A);
+		generate_set_sz(block, ALU_R1, 0xffffffff, ALU_STSET);
+		break;
+
+	case 0x1b: // subd
+		UML_SUB(block, ALU_R1, D, A);
+		generate_set_sz(block, ALU_R1, 0xffffffff, ALU_STSET);
+		break;
+
+	default:
+		return false;
+	}
+	return true;
+}
+
+void mb86233_device::generate_alu_post(drcuml_block &block, compiler_state &compiler, u32 alu)
+{
+	switch(alu) {
+	case 0x00: break; // no alu
+
+	case 0x05:
+		// flags only
+		UML_AND(block, ST, ST, ~ALU_STMASK);
+		UML_OR(block, ST, ST, ALU_STSET);
+		break;
+
+	case 0x01: case 0x02: case 0x03: case 0x04:
+	case 0x06: case 0x07: case 0x0b: case 0x0c:
+	case 0x0e: case 0x10: case 0x11:
+	case 0x13: case 0x14: case 0x16: case 0x17:
+	case 0x18: case 0x19: case 0x1a: case 0x1b:
+		// d update
+		UML_MOV(block, D, ALU_R1);
+		UML_AND(block, ST, ST, ~ALU_STMASK);
+		UML_OR(block, ST, ST, ALU_STSET);
+		break;
+
+	case 0x08:
+		// p update
+		UML_MOV(block, P, ALU_R1);
+		break;
+
+	case 0x09: case 0x0a: case 0x0d:
+		// d, p update
+		UML_MOV(block, D, ALU_R1);
+		UML_MOV(block, P, ALU_R2);
+		UML_AND(block, ST, ST, ~ALU_STMASK);
+		UML_OR(block, ST, ST, ALU_STSET);
+		break;
+	}
+}
+
+
+/*-------------------------------------------------
+    effective addresses - pre leaves the address
+    in I0, both use I3 and I4 as scratch
+-------------------------------------------------*/
+
+void mb86233_device::generate_ea_pre(drcuml_block &block, int bank, u32 r)
+{
+	u16 *const base = bank ? &m_core->b1 : &m_core->b0;
+	u16 *const index = bank ? &m_core->x1 : &m_core->x0;
+
+	switch(r & 0x180) {
+	case 0x000:
+		UML_MOV(block, I0, r & 0x7f);
+		return;
+
+	case 0x080: case 0x100:
+		UML_LOAD(block, I0, base, 0, SIZE_WORD, SCALE_x1);
+		UML_LOAD(block, I3, index, 0, SIZE_WORD, SCALE_x1);
+		UML_ADD(block, I0, I0, I3);
+		UML_ADD(block, I0, I0, r & 0x7f);
+		break;
+
+	case 0x180:
+		UML_LOAD(block, I0, index, 0, SIZE_WORD, SCALE_x1);
+		if(r & 0x40) {
+			LOAD16(I3, vsmr);
+			UML_AND(block, I0, I0, I3);
+		}
+		if(!(r & 0x20)) {
+			UML_LOAD(block, I3, base, 0, SIZE_WORD, SCALE_x1);
+			UML_ADD(block, I0, I0, I3);
+		}
+		break;
+	}
+	UML_AND(block, I0, I0, 0xffff);
+}
+
+void mb86233_device::generate_ea_post(drcuml_block &block, int bank, u32 r)
+{
+	if(!(r & 0x100))
+		return;
+
+	u16 *const index = bank ? &m_core->x1 : &m_core->x0;
+	UML_LOAD(block, I3, index, 0, SIZE_WORD, SCALE_x1);
+	if(!(r & 0x080)) {
+		UML_LOAD(block, I4, bank ? &m_core->i1 : &m_core->i0, 0, SIZE_WORD, SCALE_x1);
+		UML_ADD(block, I3, I3, I4);
+	} else
+		UML_ADD(block, I3, I3, (r & 0x10) ? (r & 0xf) - 0x10 : r & 0xf);
+	UML_STORE(block, index, 0, I3, SIZE_WORD, SCALE_x1);
+}
+
+
+/*-------------------------------------------------
+    registers - the common ones are accessed
+    directly, the rest through read_reg/write_reg
+-------------------------------------------------*/
+
+void mb86233_device::generate_reg_read(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, u32 r, uml::parameter dst)
+{
+	switch(r & 0x3f) {
+	case 0x00: LOAD16(dst, b0); break;
+	case 0x01: LOAD16(dst, b1); break;
+	case 0x02: LOAD16(dst, x0); break;
+	case 0x03: LOAD16(dst, x1); break;
+
+	case 0x0c: LOAD8(dst, c0); break;
+	case 0x0d: LOAD8(dst, c1); break;
+
+	case 0x10: UML_MOV(block, dst, A); break;
+	case 0x13: UML_MOV(block, dst, B); break;
+	case 0x19: UML_MOV(block, dst, D); break;
+	case 0x1c: UML_MOV(block, dst, P); break;
+	case 0x1f: LOAD8(dst, sft); break;
+
+	case 0x34: LOAD8(dst, rpc); break;
+
+	default:
+		// register file reads may stall
+		UML_MOV(block, ARG0, r & 0x3f);
+		UML_CALLC(block, ::cfunc_read_reg, this);
+		generate_stall_check(block, compiler, desc);
+		UML_MOV(block, dst, ARG1);
+		break;
+	}
+}
+
+void mb86233_device::generate_testdz(drcuml_block &block)
+{
+	generate_set_sz(block, D, 0xffffffff, uml::I3);
+	UML_AND(block, ST, ST, ~(F_ZRD | F_SGD));
+	UML_OR(block, ST, ST, I3);
+}
+
+void mb86233_device::generate_reg_write(drcuml_block &block, u32 r, uml::parameter src)
+{
+	switch(r & 0x3f) {
+	case 0x00: STORE16(b0, src); break;
+	case 0x01: STORE16(b1, src); break;
+	case 0x02: STORE16(x0, src); break;
+	case 0x03: STORE16(x1, src); break;
+
+	case 0x05: STORE16(i0, src); break;
+	case 0x06: STORE16(i1, src); break;
+
+	case 0x08: STORE16(sp, src); break;
+
+	case 0x0c: case 0x0d: {
+		u32 flag = (r & 1) ? F_ZC1 : F_ZC0;
+		if(r & 1)
+			STORE8(c1, src);
+		else
+			STORE8(c0, src);
+		if(src.is_immediate()) {
+			if((src.immediate() & 0xff) == 1)
+				UML_OR(block, ST, ST, flag);
+			else
+				UML_AND(block, ST, ST, ~flag);
+		} else {
+			UML_AND(block, I3, src, 0xff);
+			UML_CMP(block, I3, 1);
+			UML_SETc(block, COND_E, I3);
+			UML_SHL(block, I3, I3, (r & 1) ? 31 : 30);
+			UML_AND(block, ST, ST, ~flag);
+			UML_OR(block, ST, ST, I3);
+		}
+		break;
+	}
+
+	case 0x0f: break;
+
+	case 0x10: UML_MOV(block, A, src); break;
+	case 0x13: UML_MOV(block, B, src); break;
+	case 0x19: UML_MOV(block, D, src); generate_testdz(block); break;
+	case 0x1c: UML_MOV(block, P, src); break;
+	case 0x1f: STORE8(sft, src); break;
+
+	case 0x34: STORE8(rpc, src); break;
+	case 0x3c: STORE16(mask, src); break;
+
+	default:
+		UML_MOV(block, ARG0, r & 0x3f);
+		UML_MOV(block, ARG1, src);
+		UML_CALLC(block, ::cfunc_write_reg, this);
+		break;
+	}
+}
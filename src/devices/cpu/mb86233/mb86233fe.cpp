@@ -0,0 +1,111 @@
+// license:BSD-3-Clause
+// copyright-holders:Olivier Galibert
+
+/******************************************************************************
+
+    Front-end for MB86233 recompiler
+
+******************************************************************************/
+
+#include "emu.h"
+#include "mb86233fe.h"
+
+
+mb86233_frontend::mb86233_frontend(mb86233_device *core, u32 window_start, u32 window_end, u32 max_sequence)
+	: drc_frontend(*core, window_start, window_end, max_sequence)
+	, m_core(core)
+{
+}
+
+int mb86233_frontend::branch_condition_kind(u32 opcode)
+{
+	u32 cond = (opcode >> 20) & 0x1f;
+	bool invert = opcode & 0x40000000;
+
+	switch(cond) {
+	case 0x00: case 0x01: case 0x02:
+	case 0x0a: case 0x0b: case 0x0c:
+	case 0x10: case 0x11: case 0x12:
+		return COND_RUNTIME;
+
+	case 0x16:
+		return invert ? COND_NEVER : COND_ALWAYS;
+
+	default:
+		// unimplemented conditions never pass in the interpreter
+		return invert ? COND_ALWAYS : COND_NEVER;
+	}
+}
+
+bool mb86233_frontend::describe(opcode_desc &desc, const opcode_desc *prev)
+{
+	u32 opcode = desc.opptr.l[0] = m_core->m_cache.read_dword(desc.pc);
+
+	desc.length = 1;
+	desc.cycles = 1;
+
+	// the instruction after a rep loops in place, and needs an entry
+	// point of its own to resume there after running out of cycles
+	if(is_rep(m_core->m_cache.read_dword((desc.pc - 1) & 0xffff)))
+		desc.userflags |= OP_USERFLAG_REPEATED_OP;
+
+	switch((opcode >> 26) & 0x3f) {
+	case 0x00:
+		desc.flags |= OPFLAG_READS_MEMORY;
+		break;
+
+	case 0x07:
+		desc.flags |= OPFLAG_READS_MEMORY | OPFLAG_WRITES_MEMORY;
+		break;
+
+	case 0x0f:
+		if(is_rep(opcode))
+			desc.flags |= OPFLAG_END_SEQUENCE;
+		break;
+
+	case 0x2f: case 0x3f:
+		describe_branch(desc, opcode);
+		break;
+	}
+
+	return true;
+}
+
+void mb86233_frontend::describe_branch(opcode_desc &desc, u32 opcode)
+{
+	int kind = branch_condition_kind(opcode);
+	u32 subtype = (opcode >> 17) & 7;
+
+	if(kind == COND_NEVER && subtype != 1 && subtype != 3)
+		return;
+
+	switch(subtype) {
+	case 0: // brif #adr
+	case 2: // bsif #adr
+		desc.targetpc = opcode & 0xffff;
+		break;
+
+	case 1: // brul
+	case 3: // bsul
+		// executed through the interpreter, which also counts down c0/c1
+		desc.targetpc = BRANCH_TARGET_DYNAMIC;
+		desc.flags |= OPFLAG_IS_UNCONDITIONAL_BRANCH | OPFLAG_END_SEQUENCE | OPFLAG_READS_MEMORY;
+		return;
+
+	case 5: // rtif
+		desc.targetpc = BRANCH_TARGET_DYNAMIC;
+		break;
+
+	case 6: // ldif
+		desc.flags |= OPFLAG_READS_MEMORY;
+		return;
+
+	default:
+		return;
+	}
+
+	if(kind == COND_ALWAYS)
+		desc.flags |= OPFLAG_IS_UNCONDITIONAL_BRANCH | OPFLAG_END_SEQUENCE;
+	else
+		desc.flags |= OPFLAG_IS_CONDITIONAL_BRANCH;
+}
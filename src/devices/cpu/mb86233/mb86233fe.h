@@ -0,0 +1,42 @@
+// license:BSD-3-Clause
+// copyright-holders:Olivier Galibert
+
+/******************************************************************************
+
+    Front-end for MB86233 recompiler
+
+******************************************************************************/
+
+#ifndef MAME_CPU_MB86233_MB86233FE_H
+#define MAME_CPU_MB86233_MB86233FE_H
+
+#pragma once
+
+#include "mb86233.h"
+#include "cpu/drcfe.h"
+
+// instruction follows a rep and must loop on the repeat counter
+constexpr u32 OP_USERFLAG_REPEATED_OP = 0x01;
+
+class mb86233_frontend : public drc_frontend
+{
+public:
+	mb86233_frontend(mb86233_device *core, u32 window_start, u32 window_end, u32 max_sequence);
+
+	static bool is_rep(u32 opcode) { return ((opcode >> 26) & 0x3f) == 0x0f && ((opcode >> 17) & 7) == 2; }
+
+	// branch condition evaluation, shared with the code generator
+	enum { COND_NEVER, COND_ALWAYS, COND_RUNTIME };
+	static int branch_condition_kind(u32 opcode);
+
+protected:
+	// required overrides
+	virtual bool describe(opcode_desc &desc, const opcode_desc *prev) override;
+
+private:
+	mb86233_device *m_core;
+
+	void describe_branch(opcode_desc &desc, u32 opcode);
+};
+
+#endif // MAME_CPU_MB86233_MB86233FE_H
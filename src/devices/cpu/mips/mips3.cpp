@@ -167,8 +167,11 @@ mips3_device::mips3_device(const machine_config &mconfig, device_type type, cons
 	, c_dcache_size(0)
 	, c_secondary_cache_line_size(0)
 	, m_fastram_select(0)
+	, m_fastram_auto(true)
+	, m_fastram_remap(true)
+	, m_fastram_auto_count(0)
 	, m_debugger_temp(0)
-	, m_drc_cache(DRC_CACHE_SIZE + sizeof(internal_mips3_state) + 0x800000)
+	, m_drc_cache(mconfig, DRC_CACHE_SIZE + sizeof(internal_mips3_state) + 0x800000)
 	, m_drcuml(nullptr)
 	, m_drcfe(nullptr)
 	, m_drcoptions(0)
@@ -429,6 +432,9 @@ void mips3_device::device_start()
 	/* set up the endianness */
 	m_program->accessors(m_memory);
 
+	/* follow the address map for fast RAM until a driver sets it up by hand */
+	m_fastram_subscription = m_program->add_change_notifier([this] (read_or_write mode) { fastram_map_changed(); });
+
 	/* allocate a timer for the compare interrupt */
 	m_compare_int_timer = timer_alloc(FUNC(mips3_device::compare_int_callback), this);
 
@@ -5312,6 +5318,10 @@ void r5900_device::handle_sdc2(uint32_t op)
 
 void mips3_device::execute_run()
 {
+	/* pick up fast RAM changes from the address map */
+	if (m_fastram_remap)
+		update_fastram();
+
 	if (m_isdrc)
 	{
 		int execute_result;
@@ -463,6 +463,10 @@ protected:
 
 	/* fast RAM */
 	uint32_t        m_fastram_select;
+	bool            m_fastram_auto;             /* true if the regions follow the address map */
+	bool            m_fastram_remap;            /* true if the map changed since the regions were computed */
+	uint32_t        m_fastram_auto_count;       /* number of regions last taken from the map */
+	util::notifier_subscription m_fastram_subscription;
 	struct {
 		offs_t      start;                      /* start of the RAM block */
 		offs_t      end;                        /* end of the RAM block */
@@ -540,6 +544,9 @@ public:
 	void mips3com_tlbwr();
 	void mips3com_tlbp();
 private:
+	void fastram_map_changed();
+	void update_fastram();
+
 	uint32_t compute_config_register();
 	uint32_t compute_prid_register();
 	uint32_t compute_fpu_prid_register();
@@ -1047,6 +1054,7 @@ COMPILER-SPECIFIC OPTIONS
 #define MIPS3DRC_CHECK_OVERFLOWS    0x0020          /* actually check overflows on add/sub instructions */
 #define MIPS3DRC_ACCURATE_DIVZERO   0x0040          /* load correct values into HI/LO on integer divide-by-zero */
 #define MIPS3DRC_EXTRA_INSTR_CHECK  0x0080          /* adds the last instruction value to all validation entry locations, used with STRICT_VERIFY */
+#define MIPS3DRC_NO_IDLE_SKIP       0x0100          /* keep running detected idle loops instead of ending the timeslice */
 
 #define MIPS3DRC_COMPATIBLE_OPTIONS (MIPS3DRC_STRICT_VERIFY | MIPS3DRC_STRICT_COP1 | MIPS3DRC_STRICT_COP0 | MIPS3DRC_STRICT_COP2)
 #define MIPS3DRC_FASTEST_OPTIONS    (0)
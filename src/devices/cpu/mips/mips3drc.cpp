@@ -175,6 +175,11 @@ uint32_t mips3_device::mips3drc_get_options()
 -------------------------------------------------*/
 void mips3_device::clear_fastram(uint32_t select_start)
 {
+	if (m_fastram_auto)
+	{
+		m_fastram_auto = false;
+		select_start = 0;
+	}
 	m_fastram_select=select_start;
 	// Set cache to dirty so that re-mapping occurs
 	m_drc_cache_dirty = true;
@@ -187,6 +192,13 @@ void mips3_device::clear_fastram(uint32_t select_start)
 
 void mips3_device::add_fastram(offs_t start, offs_t end, uint8_t readonly, void *base)
 {
+	/* regions set up by hand replace the ones taken from the address map */
+	if (m_fastram_auto)
+	{
+		m_fastram_auto = false;
+		m_fastram_select = 0;
+	}
+
 	if (m_fastram_select < std::size(m_fastram))
 	{
 		m_fastram[m_fastram_select].start = start;
@@ -203,6 +215,74 @@ void mips3_device::add_fastram(offs_t start, offs_t end, uint8_t readonly, void
 }
 
 
+/*-------------------------------------------------
+    fastram_map_changed - stop using the regions
+    taken from the address map until recomputed
+-------------------------------------------------*/
+
+void mips3_device::fastram_map_changed()
+{
+	if (!m_fastram_auto)
+		return;
+
+	// the interpreter stops using them right away, recompiled code at the
+	// end of the current block
+	m_fastram_select = 0;
+	m_fastram_remap = true;
+	abort_timeslice();
+}
+
+
+/*-------------------------------------------------
+    update_fastram - take the fast RAM regions
+    from the plain memory of the address map
+-------------------------------------------------*/
+
+void mips3_device::update_fastram()
+{
+	m_fastram_remap = false;
+
+	// the recompiled accessors assume 32-bit words
+	if (!m_fastram_auto || m_data_bits != 32)
+		return;
+
+	// keep the largest readable ranges, writable if the same memory is written
+	std::vector<memory_direct_range> ranges = m_program->direct_ranges(read_or_write::READ);
+	std::vector<memory_direct_range> const writable = m_program->direct_ranges(read_or_write::WRITE);
+	std::stable_sort(ranges.begin(), ranges.end(), [] (memory_direct_range const &a, memory_direct_range const &b) { return (a.end - a.start) > (b.end - b.start); });
+	if (ranges.size() > std::size(m_fastram))
+		ranges.resize(std::size(m_fastram));
+
+	bool changed = ranges.size() != m_fastram_auto_count;
+	for (uint32_t ramnum = 0; ramnum < ranges.size(); ramnum++)
+	{
+		memory_direct_range const &range = ranges[ramnum];
+		bool const readonly = std::find_if(
+				writable.begin(),
+				writable.end(),
+				[&range] (memory_direct_range const &w) { return (w.start <= range.start) && (w.end >= range.end) && ((uint8_t *)w.base + (range.start - w.start) == range.base); }) == writable.end();
+
+		auto &fastram = m_fastram[ramnum];
+		if (fastram.start != range.start || fastram.end != range.end || fastram.readonly != readonly || fastram.base != range.base)
+		{
+			fastram.start = range.start;
+			fastram.end = range.end;
+			fastram.readonly = readonly;
+			fastram.base = range.base;
+			fastram.offset_base8 = (uint8_t*)range.base - range.start;
+			fastram.offset_base16 = (uint16_t*)((uint8_t*)range.base - range.start);
+			fastram.offset_base32 = (uint32_t*)((uint8_t*)range.base - range.start);
+			changed = true;
+		}
+	}
+	m_fastram_select = m_fastram_auto_count = ranges.size();
+
+	// the recompiled accessors embed the regions
+	if (changed)
+		m_drc_cache_dirty = true;
+}
+
+
 /*-------------------------------------------------
     mips3drc_add_hotspot - add a new hotspot
 -------------------------------------------------*/
@@ -1503,6 +1583,9 @@ void mips3_device::generate_delay_slot_and_branch(drcuml_block &block, compiler_
 	/* update the cycles and jump through the hash table to the target */
 	if (desc->targetpc != BRANCH_TARGET_DYNAMIC)
 	{
+		/* going round a loop that only polls again can't change anything until another device runs, so give up the timeslice */
+		if (!(m_drcoptions & MIPS3DRC_NO_IDLE_SKIP) && (desc->flags & OPFLAG_IDLE_LOOP))
+			UML_MOV(block, mem(&m_core->icount), 0);                                 // mov     icount,0
 		generate_update_cycles(block, compiler_temp, desc->targetpc, true); // <subtract cycles>
 		if (!(m_drcoptions & MIPS3DRC_DISABLE_INTRABLOCK) && (desc->flags & OPFLAG_INTRABLOCK_BRANCH))
 		{
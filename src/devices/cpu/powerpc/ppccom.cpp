@@ -226,7 +226,7 @@ ppc_device::ppc_device(const machine_config &mconfig, device_type type, const ch
 	, m_dcstore_cb(*this)
 	, m_ext_dma_read_cb(*this)
 	, m_ext_dma_write_cb(*this)
-	, m_cache(CACHE_SIZE + sizeof(internal_ppc_state))
+	, m_cache(mconfig, CACHE_SIZE + sizeof(internal_ppc_state))
 	, m_drcuml(nullptr)
 	, m_drcfe(nullptr)
 	, m_drcoptions(0)
@@ -1751,6 +1751,10 @@ void ppc_device::generate_sequence_instruction(drcuml_block &block, compiler_sta
 	{
 		const vtlb_entry *tlbtable = vtlb_table();
 
+		/* data access permissions are added to an entry as they're filled in, but the code only */
+		/* depends on the physical page and fetch permission, so leave them out of the check */
+		const vtlb_entry datamask = READ_ALLOWED | WRITE_ALLOWED | USER_READ_ALLOWED | USER_WRITE_ALLOWED;
+
 		/* if we currently have a valid TLB read entry, we just verify */
 		if (tlbtable[desc->pc >> 12] != 0)
 		{
@@ -1765,7 +1769,8 @@ void ppc_device::generate_sequence_instruction(drcuml_block &block, compiler_sta
 				UML_CALLC(block, cfunc_printf_debug, this);                                  // callc   printf_debug
 			}
 			UML_LOAD(block, I0, &tlbtable[desc->pc >> 12], 0, SIZE_DWORD, SCALE_x4);// load    i0,tlbtable[desc->pc >> 12],dword
-			UML_CMP(block, I0, tlbtable[desc->pc >> 12]);                           // cmp     i0,*tlbentry
+			UML_AND(block, I0, I0, ~datamask);                                      // and     i0,i0,~datamask
+			UML_CMP(block, I0, tlbtable[desc->pc >> 12] & ~datamask);               // cmp     i0,*tlbentry & ~datamask
 			UML_EXHc(block, COND_NE, *m_tlb_mismatch, 0);                  // exh     tlb_mismatch,0,NE
 		}
 
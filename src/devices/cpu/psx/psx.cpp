@@ -381,10 +381,29 @@ void psxcpu_device::cache_writeword( uint32_t offset, uint32_t data )
 	}
 }
 
+// returns the offset into main ram, or m_fast_ram_size if the address
+// has to go through the memory system
+inline uint32_t psxcpu_device::fast_ram_offset( uint32_t address ) const
+{
+	// kuseg, kseg0 and kseg1 all map ram at the bottom of the physical space
+	if( ( ( 0x31 >> ( address >> 29 ) ) & 1 ) != 0 && ( address & 0x1fffffff ) < m_fast_ram_size )
+	{
+		return address & 0x1fffffff;
+	}
+
+	return m_fast_ram_size;
+}
+
 uint8_t psxcpu_device::readbyte( uint32_t address )
 {
 	if( m_bus_attached )
 	{
+		uint32_t offset = fast_ram_offset( address );
+		if( offset < m_fast_ram_size )
+		{
+			return reinterpret_cast<uint8_t *>( m_fast_ram )[ BYTE4_XOR_LE( offset ) ];
+		}
+
 		return m_data.read_byte( address );
 	}
 
@@ -395,6 +414,12 @@ uint16_t psxcpu_device::readhalf( uint32_t address )
 {
 	if( m_bus_attached )
 	{
+		uint32_t offset = fast_ram_offset( address );
+		if( offset < m_fast_ram_size )
+		{
+			return reinterpret_cast<uint16_t *>( m_fast_ram )[ WORD_XOR_LE( offset >> 1 ) ];
+		}
+
 		return m_data.read_word( address );
 	}
 
@@ -405,6 +430,12 @@ uint32_t psxcpu_device::readword( uint32_t address )
 {
 	if( m_bus_attached )
 	{
+		uint32_t offset = fast_ram_offset( address );
+		if( offset < m_fast_ram_size )
+		{
+			return m_fast_ram[ offset >> 2 ];
+		}
+
 		return m_data.read_dword( address );
 	}
 
@@ -415,6 +446,12 @@ uint32_t psxcpu_device::readword_masked( uint32_t address, uint32_t mask )
 {
 	if( m_bus_attached )
 	{
+		uint32_t offset = fast_ram_offset( address );
+		if( offset < m_fast_ram_size )
+		{
+			return m_fast_ram[ offset >> 2 ];
+		}
+
 		return m_data.read_dword( address, mask );
 	}
 
@@ -425,7 +462,15 @@ void psxcpu_device::writeword( uint32_t address, uint32_t data )
 {
 	if( m_bus_attached )
 	{
-		m_data.write_dword( address, data );
+		uint32_t offset = fast_ram_offset( address );
+		if( offset < m_fast_ram_size )
+		{
+			m_fast_ram[ offset >> 2 ] = data;
+		}
+		else
+		{
+			m_data.write_dword( address, data );
+		}
 	}
 	else
 	{
@@ -437,7 +482,15 @@ void psxcpu_device::writeword_masked( uint32_t address, uint32_t data, uint32_t
 {
 	if( m_bus_attached )
 	{
-		m_data.write_dword( address, data, mask );
+		uint32_t offset = fast_ram_offset( address );
+		if( offset < m_fast_ram_size )
+		{
+			m_fast_ram[ offset >> 2 ] = ( m_fast_ram[ offset >> 2 ] & ~mask ) | ( data & mask );
+		}
+		else
+		{
+			m_data.write_dword( address, data, mask );
+		}
 	}
 	else
 	{
@@ -1335,6 +1388,9 @@ void psxcpu_device::update_address_masks()
 
 void psxcpu_device::update_scratchpad()
 {
+	// the scratchpad doesn't overlap main ram
+	m_fast_ram_updating = true;
+
 	if( ( m_biu & BIU_RAM ) == 0 )
 	{
 		m_program->install_readwrite_handler( 0x1f800000, 0x1f8003ff, read32smo_delegate(*this, FUNC(psxcpu_device::berr_r)), write32smo_delegate(*this, FUNC(psxcpu_device::berr_w)) );
@@ -1348,6 +1404,8 @@ void psxcpu_device::update_scratchpad()
 	{
 		m_program->install_ram( 0x1f800000, 0x1f8003ff, m_dcache );
 	}
+
+	m_fast_ram_updating = false;
 }
 
 void psxcpu_device::update_ram_config()
@@ -1383,6 +1441,9 @@ void psxcpu_device::update_ram_config()
 		ram_size = window_size;
 	}
 
+	m_fast_ram_updating = true;
+	m_fast_ram_window = ram_size;
+
 	if( ram_size > 0 )
 	{
 		int start = 0;
@@ -1399,6 +1460,39 @@ void psxcpu_device::update_ram_config()
 	m_program->install_readwrite_handler( 0x00000000 + window_size, 0x1effffff, read32smo_delegate(*this, FUNC(psxcpu_device::berr_r)), write32smo_delegate(*this, FUNC(psxcpu_device::berr_w)) );
 	m_program->install_readwrite_handler( 0x80000000 + window_size, 0x9effffff, read32smo_delegate(*this, FUNC(psxcpu_device::berr_r)), write32smo_delegate(*this, FUNC(psxcpu_device::berr_w)) );
 	m_program->install_readwrite_handler( 0xa0000000 + window_size, 0xbeffffff, read32smo_delegate(*this, FUNC(psxcpu_device::berr_r)), write32smo_delegate(*this, FUNC(psxcpu_device::berr_w)) );
+
+	m_fast_ram_updating = false;
+	update_fast_ram();
+}
+
+// loads and stores that hit main ram skip the memory system, as long as
+// nothing else has been installed over it (watchpoints, taps, drivers)
+void psxcpu_device::update_fast_ram()
+{
+	m_fast_ram = nullptr;
+	m_fast_ram_size = 0;
+	m_fast_ram_stale = false;
+
+	if( ( machine().debug_flags & DEBUG_FLAG_ENABLED ) != 0 || m_fast_ram_window == 0 )
+	{
+		return;
+	}
+
+	uint8_t *pointer = m_ram->pointer();
+	for( uint32_t segment : { 0x00000000U, 0x80000000U, 0xa0000000U } )
+	{
+		for( uint32_t offset = 0; offset < m_fast_ram_window; offset += 4 )
+		{
+			if( m_program->get_read_ptr( segment + offset ) != pointer + offset ||
+				m_program->get_write_ptr( segment + offset ) != pointer + offset )
+			{
+				return;
+			}
+		}
+	}
+
+	m_fast_ram = reinterpret_cast<uint32_t *>( pointer );
+	m_fast_ram_size = m_fast_ram_window;
 }
 
 void psxcpu_device::update_rom_config()
@@ -1418,6 +1512,9 @@ void psxcpu_device::update_rom_config()
 		rom_size = window_size;
 	}
 
+	// the rom window doesn't overlap main ram
+	m_fast_ram_updating = true;
+
 	if( rom_size > 0 )
 	{
 		int start = 0;
@@ -1437,6 +1534,8 @@ void psxcpu_device::update_rom_config()
 		m_program->install_readwrite_handler( 0x9fc00000 + window_size, 0x9fffffff, read32smo_delegate(*this, FUNC(psxcpu_device::berr_r)), write32smo_delegate(*this, FUNC(psxcpu_device::berr_w)) );
 		m_program->install_readwrite_handler( 0xbfc00000 + window_size, 0xbfffffff, read32smo_delegate(*this, FUNC(psxcpu_device::berr_r)), write32smo_delegate(*this, FUNC(psxcpu_device::berr_w)) );
 	}
+
+	m_fast_ram_updating = false;
 }
 
 void psxcpu_device::update_cop0(int reg)
@@ -1840,6 +1939,22 @@ void psxcpu_device::device_start()
 	m_program->cache(m_instruction);
 	m_program->specific(m_data);
 
+	m_fast_ram = nullptr;
+	m_fast_ram_size = 0;
+	m_fast_ram_window = 0;
+	m_fast_ram_stale = false;
+	m_fast_ram_updating = false;
+	m_fast_ram_subscription = m_program->add_change_notifier(
+			[this] ( read_or_write mode )
+			{
+				if( !m_fast_ram_updating )
+				{
+					m_fast_ram = nullptr;
+					m_fast_ram_size = 0;
+					m_fast_ram_stale = true;
+				}
+			} );
+
 	save_item( NAME( m_op ) );
 	save_item( NAME( m_pc ) );
 	save_item( NAME( m_delayv ) );
@@ -2327,6 +2442,11 @@ void psxcpu_device::execute_set_input( int inputnum, int state )
 
 void psxcpu_device::execute_run()
 {
+	if( m_fast_ram_stale )
+	{
+		update_fast_ram();
+	}
+
 	do
 	{
 		if( LOG_BIOSCALL ) log_bioscall();
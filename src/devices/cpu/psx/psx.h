@@ -232,6 +232,14 @@ protected:
 	uint32_t m_ram_config;
 	uint32_t m_rom_config;
 
+	// direct access to the first copy of main ram in each segment
+	uint32_t *m_fast_ram;
+	uint32_t m_fast_ram_size;
+	uint32_t m_fast_ram_window;
+	bool m_fast_ram_stale;
+	bool m_fast_ram_updating;
+	util::notifier_subscription m_fast_ram_subscription;
+
 	void stop();
 	uint32_t cache_readword( uint32_t offset );
 	void cache_writeword( uint32_t offset, uint32_t data );
@@ -241,6 +249,8 @@ protected:
 	uint32_t readword_masked( uint32_t address, uint32_t mask );
 	void writeword( uint32_t address, uint32_t data );
 	void writeword_masked( uint32_t address, uint32_t data, uint32_t mask );
+	uint32_t fast_ram_offset( uint32_t address ) const;
+	void update_fast_ram();
 	uint32_t log_bioscall_parameter( int parm );
 	const char *log_bioscall_string( int parm );
 	const char *log_bioscall_hex( int parm );
@@ -14,6 +14,8 @@
 
 #include "rsp_dasm.h"
 
+#include "video/simd.h"
+
 DEFINE_DEVICE_TYPE(RSP, rsp_device, "rsp", "Nintendo & SGI Reality Signal Processor RSP")
 
 
@@ -89,6 +91,143 @@ static const int vector_elements_2[16][8] =
 	{ 7, 7, 7, 7, 7, 7, 7, 7 },     // 7
 };
 
+#if defined(MAME_SIMD_SSE2)
+
+/***************************************************************************
+    SSE2 Vector Helpers
+***************************************************************************/
+
+namespace {
+
+// VS2 with the elements selected by an instruction's element field, as VEC_EL_2 does
+inline __m128i rsp_vt_elements(__m128i v, int el)
+{
+	switch (el)
+	{
+	case 2:  return _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 2, 0, 0)), _MM_SHUFFLE(2, 2, 0, 0));
+	case 3:  return _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, _MM_SHUFFLE(3, 3, 1, 1)), _MM_SHUFFLE(3, 3, 1, 1));
+	case 4:  return _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, _MM_SHUFFLE(0, 0, 0, 0)), _MM_SHUFFLE(0, 0, 0, 0));
+	case 5:  return _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, _MM_SHUFFLE(1, 1, 1, 1)), _MM_SHUFFLE(1, 1, 1, 1));
+	case 6:  return _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 2, 2, 2));
+	case 7:  return _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+	case 8:  return _mm_shuffle_epi32(_mm_shufflelo_epi16(v, _MM_SHUFFLE(0, 0, 0, 0)), _MM_SHUFFLE(0, 0, 0, 0));
+	case 9:  return _mm_shuffle_epi32(_mm_shufflelo_epi16(v, _MM_SHUFFLE(1, 1, 1, 1)), _MM_SHUFFLE(0, 0, 0, 0));
+	case 10: return _mm_shuffle_epi32(_mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(0, 0, 0, 0));
+	case 11: return _mm_shuffle_epi32(_mm_shufflelo_epi16(v, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(0, 0, 0, 0));
+	case 12: return _mm_shuffle_epi32(_mm_shufflehi_epi16(v, _MM_SHUFFLE(0, 0, 0, 0)), _MM_SHUFFLE(2, 2, 2, 2));
+	case 13: return _mm_shuffle_epi32(_mm_shufflehi_epi16(v, _MM_SHUFFLE(1, 1, 1, 1)), _MM_SHUFFLE(2, 2, 2, 2));
+	case 14: return _mm_shuffle_epi32(_mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 2, 2, 2));
+	case 15: return _mm_shuffle_epi32(_mm_shufflehi_epi16(v, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 2, 2, 2));
+	default: return v;
+	}
+}
+
+// a lane of all ones for each element whose bit is set in a flag register
+inline __m128i rsp_flag_lanes(uint8_t flags)
+{
+	__m128i const bits = _mm_setr_epi16(1, 2, 4, 8, 16, 32, 64, 128);
+	return _mm_cmpeq_epi16(_mm_and_si128(_mm_set1_epi16(flags), bits), bits);
+}
+
+// high halves of the 32-bit products of 16-bit lanes, either of which may be unsigned
+inline __m128i rsp_mulhi(__m128i s, __m128i t, bool s_signed, bool t_signed)
+{
+	if (s_signed && t_signed)
+		return _mm_mulhi_epi16(s, t);
+
+	__m128i hi = _mm_mulhi_epu16(s, t);
+	if (s_signed)
+		hi = _mm_sub_epi16(hi, _mm_and_si128(_mm_srai_epi16(s, 15), t));
+	if (t_signed)
+		hi = _mm_sub_epi16(hi, _mm_and_si128(_mm_srai_epi16(t, 15), s));
+	return hi;
+}
+
+// the accumulators hold the 48-bit H:M:L value in bits 16-63 of a 64-bit lane (on a
+// little-endian host, which any SSE2 host is), so they're worked on two at a time;
+// values are given as 32-bit lanes for elements 0-3 and 4-7, and sign-extended
+inline void rsp_widen(__m128i p, __m128i &lo, __m128i &hi)
+{
+	__m128i const sign = _mm_srai_epi32(p, 31);
+	lo = _mm_unpacklo_epi32(p, sign);
+	hi = _mm_unpackhi_epi32(p, sign);
+}
+
+// add values shifted left by a number of bits to the accumulators
+inline void rsp_accumulate(uint64_t *accum, __m128i p0, __m128i p1, int shift)
+{
+	__m128i w[4];
+	rsp_widen(p0, w[0], w[1]);
+	rsp_widen(p1, w[2], w[3]);
+	__m128i const count = _mm_cvtsi32_si128(shift);
+	__m128i *const a = reinterpret_cast<__m128i *>(accum);
+	for (int k = 0; k < 4; k++)
+		_mm_storeu_si128(a + k, _mm_add_epi64(_mm_loadu_si128(a + k), _mm_sll_epi64(w[k], count)));
+}
+
+// replace the accumulators with values shifted left by a number of bits plus a constant, leaving bits 0-15 alone
+inline void rsp_set_accum(uint64_t *accum, __m128i p0, __m128i p1, int shift, int64_t round)
+{
+	__m128i w[4];
+	rsp_widen(p0, w[0], w[1]);
+	rsp_widen(p1, w[2], w[3]);
+	__m128i const count = _mm_cvtsi32_si128(shift);
+	__m128i const keep = _mm_set_epi32(0, 0x0000ffff, 0, 0x0000ffff);
+	__m128i const add = _mm_set_epi32(int32_t(round >> 32), int32_t(round), int32_t(round >> 32), int32_t(round));
+	__m128i *const a = reinterpret_cast<__m128i *>(accum);
+	for (int k = 0; k < 4; k++)
+		_mm_storeu_si128(a + k, _mm_or_si128(_mm_and_si128(_mm_loadu_si128(a + k), keep), _mm_add_epi64(_mm_sll_epi64(w[k], count), add)));
+}
+
+// replace the low slice of the accumulators
+inline void rsp_set_accum_low(uint64_t *accum, __m128i l)
+{
+	__m128i const zero = _mm_setzero_si128();
+	__m128i const w0 = _mm_unpacklo_epi16(zero, l);
+	__m128i const w1 = _mm_unpackhi_epi16(zero, l);
+	__m128i const keep = _mm_set_epi32(-1, 0x0000ffff, -1, 0x0000ffff);
+	__m128i *const a = reinterpret_cast<__m128i *>(accum);
+	_mm_storeu_si128(a + 0, _mm_or_si128(_mm_and_si128(_mm_loadu_si128(a + 0), keep), _mm_unpacklo_epi32(w0, zero)));
+	_mm_storeu_si128(a + 1, _mm_or_si128(_mm_and_si128(_mm_loadu_si128(a + 1), keep), _mm_unpackhi_epi32(w0, zero)));
+	_mm_storeu_si128(a + 2, _mm_or_si128(_mm_and_si128(_mm_loadu_si128(a + 2), keep), _mm_unpacklo_epi32(w1, zero)));
+	_mm_storeu_si128(a + 3, _mm_or_si128(_mm_and_si128(_mm_loadu_si128(a + 3), keep), _mm_unpackhi_epi32(w1, zero)));
+}
+
+// either the high or the low 32 bits of four accumulators
+inline __m128i rsp_accum_dwords(const uint64_t *accum, bool high)
+{
+	__m128i const *const a = reinterpret_cast<__m128i const *>(accum);
+	if (high)
+		return _mm_unpacklo_epi64(_mm_shuffle_epi32(_mm_loadu_si128(a), _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_epi32(_mm_loadu_si128(a + 1), _MM_SHUFFLE(3, 1, 3, 1)));
+	else
+		return _mm_unpacklo_epi64(_mm_shuffle_epi32(_mm_loadu_si128(a), _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_epi32(_mm_loadu_si128(a + 1), _MM_SHUFFLE(2, 0, 2, 0)));
+}
+
+// the middle slice of the accumulators, signed saturated from H:M as SATURATE_ACCUM(i, 1, 0x8000, 0x7fff) does
+inline __m128i rsp_saturate_mid(const uint64_t *accum)
+{
+	return _mm_packs_epi32(rsp_accum_dwords(accum, true), rsp_accum_dwords(accum + 4, true));
+}
+
+// the low slice of the accumulators, clamped as SATURATE_ACCUM(i, 0, 0x0000, 0xffff) does
+inline __m128i rsp_clamp_low(const uint64_t *accum)
+{
+	__m128i const hm0 = rsp_accum_dwords(accum, true);
+	__m128i const hm1 = rsp_accum_dwords(accum + 4, true);
+	__m128i const in_range = _mm_packs_epi32(
+			_mm_cmpeq_epi32(hm0, _mm_srai_epi32(_mm_slli_epi32(hm0, 16), 16)),
+			_mm_cmpeq_epi32(hm1, _mm_srai_epi32(_mm_slli_epi32(hm1, 16), 16)));
+	__m128i const negative = _mm_packs_epi32(_mm_srai_epi32(hm0, 31), _mm_srai_epi32(hm1, 31));
+	__m128i const low = _mm_packs_epi32(
+			_mm_srai_epi32(rsp_accum_dwords(accum, false), 16),
+			_mm_srai_epi32(rsp_accum_dwords(accum + 4, false), 16));
+	return _mm_or_si128(_mm_and_si128(in_range, low), _mm_andnot_si128(_mm_or_si128(in_range, negative), _mm_set1_epi32(-1)));
+}
+
+} // anonymous namespace
+
+#endif // MAME_SIMD_SSE2
+
 /***************************************************************************
     DEBUGGING
 ***************************************************************************/
@@ -581,10 +720,199 @@ uint16_t rsp_device::SATURATE_ACCUM(int accum, int slice, uint16_t negative, uin
 	return 0;
 }
 
+#if defined(MAME_SIMD_SSE2)
+
+// handles the vector operations microcode spends most of its time in, with
+// exactly the results of the scalar implementations in handle_vector_ops
+bool rsp_device::handle_vector_ops_sse2(uint32_t op)
+{
+	__m128i const vs = _mm_loadu_si128(reinterpret_cast<__m128i const *>(m_v[VS1REG].s));
+	__m128i const vt = rsp_vt_elements(_mm_loadu_si128(reinterpret_cast<__m128i const *>(m_v[VS2REG].s)), EL);
+	uint64_t *const accum = &m_accum[0].q;
+	__m128i const zero = _mm_setzero_si128();
+	__m128i vres;
+
+	switch (op & 0x3f)
+	{
+		case 0x00:      /* VMULF */
+		{
+			// (-32768 * -32768 * 2) + 0x8000 only overflows the destination, which is clamped
+			__m128i const lo = _mm_mullo_epi16(vs, vt);
+			__m128i const hi = _mm_mulhi_epi16(vs, vt);
+			__m128i const p0 = _mm_unpacklo_epi16(lo, hi);
+			__m128i const p1 = _mm_unpackhi_epi16(lo, hi);
+			rsp_set_accum(accum, p0, p1, 17, 0x80000000);
+			__m128i const round = _mm_set1_epi32(0x8000);
+			__m128i const mid = _mm_packs_epi32(
+					_mm_srai_epi32(_mm_add_epi32(_mm_slli_epi32(p0, 1), round), 16),
+					_mm_srai_epi32(_mm_add_epi32(_mm_slli_epi32(p1, 1), round), 16));
+			__m128i const min = _mm_set1_epi16(-32768);
+			vres = _mm_xor_si128(mid, _mm_and_si128(_mm_cmpeq_epi16(vs, min), _mm_cmpeq_epi16(vt, min)));
+			break;
+		}
+
+		case 0x04:      /* VMUDL */
+		{
+			__m128i const hi = _mm_mulhi_epu16(vs, vt);
+			rsp_set_accum(accum, _mm_unpacklo_epi16(hi, zero), _mm_unpackhi_epi16(hi, zero), 16, 0);
+			vres = hi;
+			break;
+		}
+
+		case 0x05:      /* VMUDM */
+		{
+			__m128i const lo = _mm_mullo_epi16(vs, vt);
+			__m128i const hi = rsp_mulhi(vs, vt, true, false);
+			rsp_set_accum(accum, _mm_unpacklo_epi16(lo, hi), _mm_unpackhi_epi16(lo, hi), 16, 0);
+			vres = hi;
+			break;
+		}
+
+		case 0x06:      /* VMUDN */
+		{
+			__m128i const lo = _mm_mullo_epi16(vs, vt);
+			__m128i const hi = rsp_mulhi(vs, vt, false, true);
+			rsp_set_accum(accum, _mm_unpacklo_epi16(lo, hi), _mm_unpackhi_epi16(lo, hi), 16, 0);
+			vres = lo;
+			break;
+		}
+
+		case 0x07:      /* VMUDH */
+		{
+			__m128i const lo = _mm_mullo_epi16(vs, vt);
+			__m128i const hi = _mm_mulhi_epi16(vs, vt);
+			__m128i const p0 = _mm_unpacklo_epi16(lo, hi);
+			__m128i const p1 = _mm_unpackhi_epi16(lo, hi);
+			rsp_set_accum(accum, p0, p1, 32, 0);
+			vres = _mm_packs_epi32(p0, p1);
+			break;
+		}
+
+		case 0x08:      /* VMACF */
+		{
+			__m128i const lo = _mm_mullo_epi16(vs, vt);
+			__m128i const hi = _mm_mulhi_epi16(vs, vt);
+			rsp_accumulate(accum, _mm_unpacklo_epi16(lo, hi), _mm_unpackhi_epi16(lo, hi), 17);
+			vres = rsp_saturate_mid(accum);
+			break;
+		}
+
+		case 0x0c:      /* VMADL */
+		{
+			__m128i const hi = _mm_mulhi_epu16(vs, vt);
+			rsp_accumulate(accum, _mm_unpacklo_epi16(hi, zero), _mm_unpackhi_epi16(hi, zero), 16);
+			vres = rsp_clamp_low(accum);
+			break;
+		}
+
+		case 0x0d:      /* VMADM */
+		{
+			__m128i const lo = _mm_mullo_epi16(vs, vt);
+			__m128i const hi = rsp_mulhi(vs, vt, true, false);
+			rsp_accumulate(accum, _mm_unpacklo_epi16(lo, hi), _mm_unpackhi_epi16(lo, hi), 16);
+			vres = rsp_saturate_mid(accum);
+			break;
+		}
+
+		case 0x0e:      /* VMADN */
+		{
+			__m128i const lo = _mm_mullo_epi16(vs, vt);
+			__m128i const hi = rsp_mulhi(vs, vt, false, true);
+			rsp_accumulate(accum, _mm_unpacklo_epi16(lo, hi), _mm_unpackhi_epi16(lo, hi), 16);
+			vres = rsp_clamp_low(accum);
+			break;
+		}
+
+		case 0x0f:      /* VMADH */
+		{
+			__m128i const lo = _mm_mullo_epi16(vs, vt);
+			__m128i const hi = _mm_mulhi_epi16(vs, vt);
+			rsp_accumulate(accum, _mm_unpacklo_epi16(lo, hi), _mm_unpackhi_epi16(lo, hi), 32);
+			vres = rsp_saturate_mid(accum);
+			break;
+		}
+
+		case 0x10:      /* VADD */
+		{
+			// adding the carry to the smaller operand first can only saturate if the sum would anyway
+			__m128i const carry = _mm_srli_epi16(rsp_flag_lanes(m_vcarry), 15);
+			rsp_set_accum_low(accum, _mm_add_epi16(_mm_add_epi16(vs, vt), carry));
+			vres = _mm_adds_epi16(_mm_adds_epi16(_mm_min_epi16(vs, vt), carry), _mm_max_epi16(vs, vt));
+			m_vzero = 0;
+			m_vcarry = 0;
+			break;
+		}
+
+		case 0x11:      /* VSUB */
+		{
+			// if VT plus the carry saturates, the difference is one too high
+			__m128i const carry = _mm_srli_epi16(rsp_flag_lanes(m_vcarry), 15);
+			__m128i const unsat = _mm_add_epi16(vt, carry);
+			__m128i const sat = _mm_adds_epi16(vt, carry);
+			rsp_set_accum_low(accum, _mm_sub_epi16(vs, unsat));
+			vres = _mm_adds_epi16(_mm_subs_epi16(vs, sat), _mm_cmpgt_epi16(sat, unsat));
+			m_vzero = 0;
+			m_vcarry = 0;
+			break;
+		}
+
+		case 0x27:      /* VMRG */
+		{
+			__m128i const compare = rsp_flag_lanes(m_vcompare);
+			vres = _mm_or_si128(_mm_and_si128(compare, vs), _mm_andnot_si128(compare, vt));
+			rsp_set_accum_low(accum, vres);
+			break;
+		}
+
+		case 0x28:      /* VAND */
+			vres = _mm_and_si128(vs, vt);
+			rsp_set_accum_low(accum, vres);
+			break;
+
+		case 0x29:      /* VNAND */
+			vres = _mm_andnot_si128(_mm_and_si128(vs, vt), _mm_set1_epi32(-1));
+			rsp_set_accum_low(accum, vres);
+			break;
+
+		case 0x2a:      /* VOR */
+			vres = _mm_or_si128(vs, vt);
+			rsp_set_accum_low(accum, vres);
+			break;
+
+		case 0x2b:      /* VNOR */
+			vres = _mm_andnot_si128(_mm_or_si128(vs, vt), _mm_set1_epi32(-1));
+			rsp_set_accum_low(accum, vres);
+			break;
+
+		case 0x2c:      /* VXOR */
+			vres = _mm_xor_si128(vs, vt);
+			rsp_set_accum_low(accum, vres);
+			break;
+
+		case 0x2d:      /* VNXOR */
+			vres = _mm_andnot_si128(_mm_xor_si128(vs, vt), _mm_set1_epi32(-1));
+			rsp_set_accum_low(accum, vres);
+			break;
+
+		default:
+			return false;
+	}
+
+	_mm_storeu_si128(reinterpret_cast<__m128i *>(m_v[VDREG].s), vres);
+	return true;
+}
+
+#endif // MAME_SIMD_SSE2
+
 void rsp_device::handle_vector_ops(uint32_t op)
 {
 	uint16_t vres[8];
 
+#if defined(MAME_SIMD_SSE2)
+	if (handle_vector_ops_sse2(op))
+		return;
+#endif
+
 	// Opcode legend:
 	//    E = VS2 element type
 	//    S = VS1, Source vector 1
@@ -206,6 +206,7 @@ private:
 	void              handle_lwc2(uint32_t op);
 	void              handle_swc2(uint32_t op);
 	void              handle_vector_ops(uint32_t op);
+	bool              handle_vector_ops_sse2(uint32_t op);
 
 	uint32_t          m_div_in;
 	uint32_t          m_div_out;
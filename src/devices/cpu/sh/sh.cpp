@@ -51,6 +51,7 @@ void sh_common_execution::device_start()
 	m_sh2_state->icount = 0;
 	m_sh2_state->sleep_mode = 0;
 	m_sh2_state->arg0 = 0;
+	m_sh2_state->m_drc_mode = 0;
 
 	state_add(SH4_PC, "PC", m_sh2_state->pc).formatstr("%08X").callimport();
 	state_add(SH_SR, "SR", m_sh2_state->sr).formatstr("%08X").callimport();
@@ -86,7 +87,7 @@ void sh_common_execution::device_start()
 }
 
 
-void sh_common_execution::drc_start()
+void sh_common_execution::drc_start(int modes)
 {
 	/* DRC helpers */
 	memset(m_pcflushes, 0, sizeof(m_pcflushes));
@@ -99,7 +100,7 @@ void sh_common_execution::drc_start()
 
 	/* initialize the UML generator */
 	uint32_t flags = 0;
-	m_drcuml = std::make_unique<drcuml_state>(*this, m_cache, flags, 1, 32, 1);
+	m_drcuml = std::make_unique<drcuml_state>(*this, m_cache, flags, modes, 32, 1);
 
 	/* add symbols for our stuff */
 	m_drcuml->symbol_add(&m_sh2_state->pc, sizeof(m_sh2_state->pc), "pc");
@@ -2317,7 +2318,7 @@ void sh_common_execution::execute_run_drc()
 		/* if we need to recompile, do it */
 		if (execute_result == EXECUTE_MISSING_CODE)
 		{
-			code_compile_block(0, m_sh2_state->pc);
+			code_compile_block(m_sh2_state->m_drc_mode, m_sh2_state->pc);
 		}
 		else if (execute_result == EXECUTE_UNMAPPED_CODE)
 		{
@@ -2343,6 +2344,8 @@ void sh_common_execution::code_compile_block(uint8_t mode, offs_t pc)
 	const opcode_desc *desclist;
 	bool override = false;
 
+	compiler.mode = mode;
+
 	auto profile = g_profiler.start(PROFILER_DRC_COMPILE);
 
 	/* get a description of this sequence */
@@ -2391,7 +2394,7 @@ void sh_common_execution::code_compile_block(uint8_t mode, offs_t pc)
 				else
 				{
 					UML_LABEL(block, seqhead->pc | 0x80000000);                             // label   seqhead->pc | 0x80000000
-					UML_HASHJMP(block, 0, seqhead->pc, *m_nocode);
+					UML_HASHJMP(block, mode, seqhead->pc, *m_nocode);
 																							// hashjmp <mode>,seqhead->pc,nocode
 					continue;
 				}
@@ -2407,9 +2410,12 @@ void sh_common_execution::code_compile_block(uint8_t mode, offs_t pc)
 				}
 
 				/* iterate over instructions in the sequence and compile them */
+				compiler.modechange = false;
 				for (curdesc = seqhead; curdesc != seqlast->next(); curdesc = curdesc->next())
 				{
 					generate_sequence_instruction(block, compiler, curdesc, 0xffffffff);
+					if (curdesc->flags & OPFLAG_CAN_CHANGE_MODES)
+						compiler.modechange = true;
 				}
 
 				/* if we need to return to the start, do it */
@@ -2426,12 +2432,15 @@ void sh_common_execution::code_compile_block(uint8_t mode, offs_t pc)
 				/* count off cycles and go there */
 				generate_update_cycles(block, compiler, nextpc, true);                // <subtract cycles>
 
-				/* SH2 has no modes */
-				if (seqlast->next() == nullptr || seqlast->next()->pc != nextpc)
+				/* if the sequence can change modes, use a variable mode; otherwise, assume the same mode (SH2 has only one) */
+				if (compiler.modechange)
+				{
+					UML_HASHJMP(block, mem(&m_sh2_state->m_drc_mode), nextpc, *m_nocode); // hashjmp <mode>,nextpc,nocode
+				}
+				else if (seqlast->next() == nullptr || seqlast->next()->pc != nextpc)
 				{
-					UML_HASHJMP(block, 0, nextpc, *m_nocode);
+					UML_HASHJMP(block, mode, nextpc, *m_nocode);                            // hashjmp <mode>,nextpc,nocode
 				}
-																							// hashjmp <mode>,nextpc,nocode
 			}
 
 			/* end the sequence */
@@ -2637,6 +2646,23 @@ void sh_common_execution::generate_delay_slot(drcuml_block &block, compiler_stat
 
 	/* update the label */
 	compiler.labelnum = compiler_temp.labelnum;
+
+	/* a mode change in the delay slot must be seen by the branch's hash jump */
+	if (desc->delay.first()->flags & OPFLAG_CAN_CHANGE_MODES)
+		compiler.modechange = true;
+}
+
+/*-------------------------------------------------
+    drc_hash_mode - return the mode parameter for
+    a hash jump out of the current sequence
+-------------------------------------------------*/
+
+uml::parameter sh_common_execution::drc_hash_mode(const compiler_state &compiler) const
+{
+	/* the mode the block was compiled for, unless an instruction may have changed it */
+	if (compiler.modechange)
+		return uml::mem(&m_sh2_state->m_drc_mode);
+	return compiler.mode;
 }
 
 void sh_common_execution::func_unimplemented()
@@ -2858,7 +2884,7 @@ bool sh_common_execution::generate_opcode(drcuml_block &block, compiler_state &c
 			generate_delay_slot(block, compiler, desc, m_sh2_state->ea-2);
 
 			generate_update_cycles(block, compiler, m_sh2_state->ea, true);    // <subtract cycles>
-			UML_HASHJMP(block, 0, m_sh2_state->ea, *m_nocode);   // hashjmp m_sh2_state->ea
+			UML_HASHJMP(block, drc_hash_mode(compiler), m_sh2_state->ea, *m_nocode);   // hashjmp m_sh2_state->ea
 			return true;
 
 		case 11:    // BSR
@@ -2872,7 +2898,7 @@ bool sh_common_execution::generate_opcode(drcuml_block &block, compiler_state &c
 			generate_delay_slot(block, compiler, desc, m_sh2_state->ea-2);
 
 			generate_update_cycles(block, compiler, m_sh2_state->ea, true);    // <subtract cycles>
-			UML_HASHJMP(block, 0, m_sh2_state->ea, *m_nocode);   // hashjmp m_sh2_state->ea
+			UML_HASHJMP(block, drc_hash_mode(compiler), m_sh2_state->ea, *m_nocode);   // hashjmp m_sh2_state->ea
 			return true;
 
 		case 12:
@@ -3404,7 +3430,7 @@ bool sh_common_execution::generate_group_8(drcuml_block &block, compiler_state &
 		m_sh2_state->ea = (desc->pc + 2) + disp * 2 + 2;    // m_sh2_state->ea = destination
 
 		generate_update_cycles(block, compiler, m_sh2_state->ea, true);    // <subtract cycles>
-		UML_HASHJMP(block, 0, m_sh2_state->ea, *m_nocode);   // jmp m_sh2_state->ea
+		UML_HASHJMP(block, drc_hash_mode(compiler), m_sh2_state->ea, *m_nocode);   // jmp m_sh2_state->ea
 
 		UML_LABEL(block, compiler.labelnum++);         // labelnum:
 		return true;
@@ -3417,7 +3443,7 @@ bool sh_common_execution::generate_group_8(drcuml_block &block, compiler_state &
 		m_sh2_state->ea = (desc->pc + 2) + disp * 2 + 2;        // m_sh2_state->ea = destination
 
 		generate_update_cycles(block, compiler, m_sh2_state->ea, true);    // <subtract cycles>
-		UML_HASHJMP(block, 0, m_sh2_state->ea, *m_nocode);   // jmp m_sh2_state->ea
+		UML_HASHJMP(block, drc_hash_mode(compiler), m_sh2_state->ea, *m_nocode);   // jmp m_sh2_state->ea
 
 		UML_LABEL(block, compiler.labelnum++);         // labelnum:
 		return true;
@@ -3436,7 +3462,7 @@ bool sh_common_execution::generate_group_8(drcuml_block &block, compiler_state &
 			generate_delay_slot(block, compiler, desc, m_sh2_state->ea-2);
 
 			generate_update_cycles(block, compiler, m_sh2_state->ea, true);    // <subtract cycles>
-			UML_HASHJMP(block, 0, m_sh2_state->ea, *m_nocode);   // jmp m_sh2_state->ea
+			UML_HASHJMP(block, drc_hash_mode(compiler), m_sh2_state->ea, *m_nocode);   // jmp m_sh2_state->ea
 
 			UML_LABEL(block, templabel);            // labelnum:
 			return true;
@@ -3457,7 +3483,7 @@ bool sh_common_execution::generate_group_8(drcuml_block &block, compiler_state &
 			generate_delay_slot(block, compiler, desc, m_sh2_state->ea-2); // delay slot only if the branch is taken
 
 			generate_update_cycles(block, compiler, m_sh2_state->ea, true);    // <subtract cycles>
-			UML_HASHJMP(block, 0, m_sh2_state->ea, *m_nocode);   // jmp m_sh2_state->ea
+			UML_HASHJMP(block, drc_hash_mode(compiler), m_sh2_state->ea, *m_nocode);   // jmp m_sh2_state->ea
 
 			UML_LABEL(block, templabel);            // labelnum:
 			return true;
@@ -3485,7 +3511,7 @@ bool sh_common_execution::generate_group_12_TRAPA(drcuml_block &block, compiler_
 
 	UML_MOV(block, I0, mem(&m_sh2_state->ea));              // mov r0, ea
 	UML_CALLH(block, *m_read32);                 // read32
-	UML_HASHJMP(block, 0, I0, *m_nocode);        // jmp (r0)
+	UML_HASHJMP(block, drc_hash_mode(compiler), I0, *m_nocode);        // jmp (r0)
 
 	return true;
 }
@@ -3656,7 +3682,7 @@ bool sh_common_execution::generate_group_0_RTE(drcuml_block &block, compiler_sta
 	compiler.checkints = true;
 	UML_MOV(block, mem(&m_sh2_state->ea), mem(&m_sh2_state->pc));       // mov ea, pc
 	generate_update_cycles(block, compiler, uml::mem(&m_sh2_state->ea), true);  // <subtract cycles>
-	UML_HASHJMP(block, 0, mem(&m_sh2_state->pc), *m_nocode); // and jump to the "resume PC"
+	UML_HASHJMP(block, drc_hash_mode(compiler), mem(&m_sh2_state->pc), *m_nocode); // and jump to the "resume PC"
 
 	return true;
 }
@@ -3703,7 +3729,7 @@ bool sh_common_execution::generate_group_0(drcuml_block &block, compiler_state &
 			generate_delay_slot(block, compiler, desc, m_sh2_state->target);
 
 			generate_update_cycles(block, compiler, uml::mem(&m_sh2_state->target), true);  // <subtract cycles>
-			UML_HASHJMP(block, 0, mem(&m_sh2_state->target), *m_nocode); // jmp target
+			UML_HASHJMP(block, drc_hash_mode(compiler), mem(&m_sh2_state->target), *m_nocode); // jmp target
 			return true;
 		}
 		break;
@@ -3769,7 +3795,7 @@ bool sh_common_execution::generate_group_0(drcuml_block &block, compiler_state &
 		generate_delay_slot(block, compiler, desc, m_sh2_state->target);
 
 		generate_update_cycles(block, compiler, uml::mem(&m_sh2_state->target), true);  // <subtract cycles>
-		UML_HASHJMP(block, 0, mem(&m_sh2_state->target), *m_nocode);
+		UML_HASHJMP(block, drc_hash_mode(compiler), mem(&m_sh2_state->target), *m_nocode);
 		return true;
 
 	case 0x0c: // MOVBL0(Rm, Rn);
@@ -3867,7 +3893,7 @@ bool sh_common_execution::generate_group_0(drcuml_block &block, compiler_state &
 			generate_delay_slot(block, compiler, desc, m_sh2_state->target);
 
 			generate_update_cycles(block, compiler, uml::mem(&m_sh2_state->target), true);  // <subtract cycles>
-			UML_HASHJMP(block, 0, mem(&m_sh2_state->target), *m_nocode); // jmp target
+			UML_HASHJMP(block, drc_hash_mode(compiler), mem(&m_sh2_state->target), *m_nocode); // jmp target
 			return true;
 		}
 		break;
@@ -4017,7 +4043,7 @@ bool sh_common_execution::generate_group_4(drcuml_block &block, compiler_state &
 		generate_delay_slot(block, compiler, desc, m_sh2_state->target-4);
 
 		generate_update_cycles(block, compiler, uml::mem(&m_sh2_state->target), true);  // <subtract cycles>
-		UML_HASHJMP(block, 0, mem(&m_sh2_state->target), *m_nocode); // and do the jump
+		UML_HASHJMP(block, drc_hash_mode(compiler), mem(&m_sh2_state->target), *m_nocode); // and do the jump
 		return true;
 
 	case 0x0e: // LDCSR(Rn);
@@ -4232,7 +4258,7 @@ bool sh_common_execution::generate_group_4(drcuml_block &block, compiler_state &
 		generate_delay_slot(block, compiler, desc, m_sh2_state->target);
 
 		generate_update_cycles(block, compiler, uml::mem(&m_sh2_state->target), true);  // <subtract cycles>
-		UML_HASHJMP(block, 0, mem(&m_sh2_state->target), *m_nocode); // jmp (target)
+		UML_HASHJMP(block, drc_hash_mode(compiler), mem(&m_sh2_state->target), *m_nocode); // jmp (target)
 		return true;
 
 	case 0x2e: // LDCVBR(Rn);
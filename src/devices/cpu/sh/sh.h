@@ -104,7 +104,7 @@ public:
 	sh_common_execution(const machine_config &mconfig, device_type type, const char *tag, device_t *owner, uint32_t clock, endianness_t endianness, address_map_constructor internal)
 		: cpu_device(mconfig, type, tag, owner, clock)
 		, m_sh2_state(nullptr)
-		, m_cache(CACHE_SIZE + sizeof(internal_sh2_state))
+		, m_cache(mconfig, CACHE_SIZE + sizeof(internal_sh2_state))
 		, m_drcuml(nullptr)
 		, m_drcoptions(0)
 		, m_entry(nullptr)
@@ -164,6 +164,8 @@ public:
 		int     m_frt_input;
 		int     m_fpu_sz;
 		int     m_fpu_pr;
+
+		uint32_t  m_drc_mode;         // current DRC hash mode (SH4: FPSCR.PR/SZ)
 	};
 
 	internal_sh2_state *m_sh2_state;
@@ -378,7 +380,7 @@ public:
 
 	virtual void init_drc_frontend() = 0;
 
-	void drc_start();
+	void drc_start(int modes = 1);
 
 	void sh2drc_add_fastram(offs_t start, offs_t end, uint8_t readonly, void *base);
 
@@ -418,6 +420,8 @@ public:
 		uint32_t          cycles;                     /* accumulated cycles */
 		uint8_t           checkints;                  /* need to check interrupts before next instruction */
 		uml::code_label  labelnum;                   /* index for local labels */
+		uint8_t           mode;                       /* hash mode the block is being compiled for */
+		bool              modechange;                 /* the current sequence may have changed modes */
 	};
 
 	virtual void sh2_exception(const char *message, int irqline) { fatalerror("sh2_exception in base classs\n"); }
@@ -475,6 +479,7 @@ public:
 	void code_flush_cache();
 	void execute_run_drc();
 	void code_compile_block(uint8_t mode, offs_t pc);
+	uml::parameter drc_hash_mode(const compiler_state &compiler) const;
 
 
 protected:
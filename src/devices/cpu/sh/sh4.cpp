@@ -623,6 +623,7 @@ inline void sh34_base_device::LDSMFPSCR(const uint16_t opcode)
 #endif
 	m_sh2_state->m_fpu_sz = (m_sh2_state->m_fpscr & SZ) ? 1 : 0;
 	m_sh2_state->m_fpu_pr = (m_sh2_state->m_fpscr & PR) ? 1 : 0;
+	sh4_update_drc_mode();
 }
 
 /*  LDC.L   @Rm+,DBR */
@@ -680,6 +681,7 @@ inline void sh34_base_device::LDSFPSCR(const uint16_t opcode)
 #endif
 	m_sh2_state->m_fpu_sz = (m_sh2_state->m_fpscr & SZ) ? 1 : 0;
 	m_sh2_state->m_fpu_pr = (m_sh2_state->m_fpscr & PR) ? 1 : 0;
+	sh4_update_drc_mode();
 }
 
 /*  LDC     Rm,DBR */
@@ -1153,6 +1155,7 @@ void sh34_base_device::FSCHG()
 {
 	m_sh2_state->m_fpscr ^= SZ;
 	m_sh2_state->m_fpu_sz = (m_sh2_state->m_fpscr & SZ) ? 1 : 0;
+	sh4_update_drc_mode();
 }
 
 /* FTRC FRm,FPUL PR=0 1111mmmm00111101 */
@@ -1607,6 +1610,7 @@ void sh34_base_device::device_reset()
 	m_sh2_state->m_fpscr = 0x00040001;
 	m_sh2_state->m_fpu_sz = (m_sh2_state->m_fpscr & SZ) ? 1 : 0;
 	m_sh2_state->m_fpu_pr = (m_sh2_state->m_fpscr & PR) ? 1 : 0;
+	sh4_update_drc_mode();
 	m_sh2_state->m_fpul = 0;
 	m_sh2_state->m_dbr = 0;
 
@@ -2162,6 +2166,7 @@ void sh34_base_device::device_start()
 
 	save_item(NAME(m_sh2_state->m_fpu_sz));
 	save_item(NAME(m_sh2_state->m_fpu_pr));
+	save_item(NAME(m_sh2_state->m_drc_mode));
 	save_item(NAME(m_ioport16_pullup));
 	save_item(NAME(m_ioport16_direction));
 	save_item(NAME(m_ioport4_pullup));
@@ -2244,7 +2249,7 @@ void sh34_base_device::device_start()
 		m_fd_regmap[regnum] = uml::mem(((double *)(m_sh2_state->m_fr+(regnum))));
 	}
 
-	drc_start();
+	drc_start(SH4_MODE_COUNT);
 }
 
 void sh34_base_device::state_import(const device_state_entry &entry)
@@ -2640,7 +2645,7 @@ void sh34_base_device::generate_update_cycles(drcuml_block &block, compiler_stat
 		/* generate a hash jump via the current mode and PC
 		   pc should be pointing to either the exception address
 		   or have been left on the next PC set above? */
-		UML_HASHJMP(block, 0, mem(&m_sh2_state->pc), *m_nocode);     // hashjmp <mode>,<pc>,nocode
+		UML_HASHJMP(block, drc_hash_mode(compiler), mem(&m_sh2_state->pc), *m_nocode);     // hashjmp <mode>,<pc>,nocode
 	}
 
 	/* account for cycles */
@@ -2678,7 +2683,7 @@ void sh34_base_device::static_generate_entry_point()
 	load_fast_iregs(block);
 
 	/* generate a hash jump via the current mode and PC */
-	UML_HASHJMP(block, 0, mem(&m_sh2_state->pc), *m_nocode);     // hashjmp <mode>,<pc>,nocode
+	UML_HASHJMP(block, mem(&m_sh2_state->m_drc_mode), mem(&m_sh2_state->pc), *m_nocode);     // hashjmp <mode>,<pc>,nocode
 
 	block.end();
 }
@@ -3023,7 +3028,7 @@ bool sh34_base_device::generate_group_0_RTE(drcuml_block &block, compiler_state
 
 	UML_MOV(block, mem(&m_sh2_state->pc), mem(&m_sh2_state->m_delay));
 	generate_update_cycles(block, compiler, uml::mem(&m_sh2_state->ea), true);  // <subtract cycles>
-	UML_HASHJMP(block, 0, mem(&m_sh2_state->pc), *m_nocode); // and jump to the "resume PC"
+	UML_HASHJMP(block, mem(&m_sh2_state->m_drc_mode), mem(&m_sh2_state->pc), *m_nocode); // and jump to the "resume PC" in the current FPSCR mode
 	return true;
 }
 
@@ -3037,7 +3042,7 @@ bool sh34_base_device::generate_group_12_TRAPA(drcuml_block &block, compiler_sta
 	UML_MOV(block, mem(&m_sh2_state->pc), desc->pc + 2); // copy the PC because we need to use it
 	UML_CALLC(block, cfunc_TRAPA, this);
 	load_fast_iregs(block);
-	UML_HASHJMP(block, 0, mem(&m_sh2_state->pc), *m_nocode);
+	UML_HASHJMP(block, drc_hash_mode(compiler), mem(&m_sh2_state->pc), *m_nocode);
 	return true;
 }
 
@@ -3461,107 +3466,63 @@ bool sh34_base_device::generate_group_15(drcuml_block &block, compiler_state &co
 }
 bool sh34_base_device::generate_group_15_FADD(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint16_t opcode, int in_delay_slot, uint32_t ovrpc)
 {
-	UML_TEST(block, mem(&m_sh2_state->m_fpu_pr), 0);
-	UML_JMPc(block, COND_Z, compiler.labelnum);
-
-	UML_FDADD(block, FPD32(Rn), FPD32(Rn), FPD32(Rm));
-	UML_JMP(block, compiler.labelnum+1);
-
-	UML_LABEL(block, compiler.labelnum++);  // labelnum:
-	UML_FSADD(block, FPS32(Rn), FPS32(Rn), FPS32(Rm));
-
-	UML_LABEL(block, compiler.labelnum++);  // labelnum+1:
+	if (compiler.mode & SH4_MODE_PR)
+		UML_FDADD(block, FPD32(Rn), FPD32(Rn), FPD32(Rm));
+	else
+		UML_FSADD(block, FPS32(Rn), FPS32(Rn), FPS32(Rm));
 
 	return true;
 }
 
 bool sh34_base_device::generate_group_15_FSUB(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint16_t opcode, int in_delay_slot, uint32_t ovrpc)
 {
-	UML_TEST(block, mem(&m_sh2_state->m_fpu_pr), 0);
-	UML_JMPc(block, COND_Z, compiler.labelnum);
-
-	UML_FDSUB(block, FPD32(Rn), FPD32(Rn), FPD32(Rm));
-	UML_JMP(block, compiler.labelnum+1);
-
-	UML_LABEL(block, compiler.labelnum++);  // labelnum:
-	UML_FSSUB(block, FPS32(Rn), FPS32(Rn), FPS32(Rm));
-
-	UML_LABEL(block, compiler.labelnum++);  // labelnum+1:
+	if (compiler.mode & SH4_MODE_PR)
+		UML_FDSUB(block, FPD32(Rn), FPD32(Rn), FPD32(Rm));
+	else
+		UML_FSSUB(block, FPS32(Rn), FPS32(Rn), FPS32(Rm));
 
 	return true;
 }
 
 bool sh34_base_device::generate_group_15_FMUL(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint16_t opcode, int in_delay_slot, uint32_t ovrpc)
 {
-	UML_TEST(block, mem(&m_sh2_state->m_fpu_pr), 0);
-	UML_JMPc(block, COND_Z, compiler.labelnum);
-
-	UML_FDMUL(block, FPD32(Rn), FPD32(Rn), FPD32(Rm));
-	UML_JMP(block, compiler.labelnum+1);
-
-	UML_LABEL(block, compiler.labelnum++);  // labelnum:
-	UML_FSMUL(block, FPS32(Rn), FPS32(Rn), FPS32(Rm));
-
-	UML_LABEL(block, compiler.labelnum++);  // labelnum+1:
+	if (compiler.mode & SH4_MODE_PR)
+		UML_FDMUL(block, FPD32(Rn), FPD32(Rn), FPD32(Rm));
+	else
+		UML_FSMUL(block, FPS32(Rn), FPS32(Rn), FPS32(Rm));
 
 	return true;
 }
 
 bool sh34_base_device::generate_group_15_FDIV(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint16_t opcode, int in_delay_slot, uint32_t ovrpc)
 {
-	UML_TEST(block, mem(&m_sh2_state->m_fpu_pr), 0);
-	UML_JMPc(block, COND_Z, compiler.labelnum);
-
-	UML_FDDIV(block, FPD32(Rn), FPD32(Rn), FPD32(Rm));
-	UML_JMP(block, compiler.labelnum+1);
-
-	UML_LABEL(block, compiler.labelnum++);  // labelnum:
-	UML_FSDIV(block, FPS32(Rn), FPS32(Rn), FPS32(Rm));
-
-	UML_LABEL(block, compiler.labelnum++);  // labelnum+1:
+	if (compiler.mode & SH4_MODE_PR)
+		UML_FDDIV(block, FPD32(Rn), FPD32(Rn), FPD32(Rm));
+	else
+		UML_FSDIV(block, FPS32(Rn), FPS32(Rn), FPS32(Rm));
 
 	return true;
 }
 
 bool sh34_base_device::generate_group_15_FCMP_EQ(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint16_t opcode, int in_delay_slot, uint32_t ovrpc)
 {
-	UML_TEST(block, uml::mem(&m_sh2_state->m_fpu_pr), 0);
-	UML_JMPc(block, COND_Z, compiler.labelnum);
-
-	UML_FDCMP(block, FPD32(Rm & 14), FPD32(Rn & 14));
-	UML_SETc(block, COND_Z, I0);
-	UML_ROLINS(block, uml::mem(&m_sh2_state->sr), I0, T_SHIFT, SH_T);
-
-	UML_JMP(block, compiler.labelnum+1);
-
-	UML_LABEL(block, compiler.labelnum++);  // labelnum:
-
-	UML_FSCMP(block, FPS32(Rm), FPS32(Rn));
+	if (compiler.mode & SH4_MODE_PR)
+		UML_FDCMP(block, FPD32(Rm & 14), FPD32(Rn & 14));
+	else
+		UML_FSCMP(block, FPS32(Rm), FPS32(Rn));
 	UML_SETc(block, COND_Z, I0);
 	UML_ROLINS(block, uml::mem(&m_sh2_state->sr), I0, T_SHIFT, SH_T);
-
-	UML_LABEL(block, compiler.labelnum++);  // labelnum+1:
 	return true;
 }
 
 bool sh34_base_device::generate_group_15_FCMP_GT(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint16_t opcode, int in_delay_slot, uint32_t ovrpc)
 {
-	UML_TEST(block, uml::mem(&m_sh2_state->m_fpu_pr), 0);
-	UML_JMPc(block, COND_Z, compiler.labelnum);
-
-	UML_FDCMP(block, FPD32(Rm & 14), FPD32(Rn & 14));
-	UML_SETc(block, COND_C, I0);
-	UML_ROLINS(block, uml::mem(&m_sh2_state->sr), I0, T_SHIFT, SH_T);
-
-	UML_JMP(block, compiler.labelnum+1);
-
-	UML_LABEL(block, compiler.labelnum++);  // labelnum:
-
-	UML_FSCMP(block, FPS32(Rm), FPS32(Rn));
+	if (compiler.mode & SH4_MODE_PR)
+		UML_FDCMP(block, FPD32(Rm & 14), FPD32(Rn & 14));
+	else
+		UML_FSCMP(block, FPS32(Rm), FPS32(Rn));
 	UML_SETc(block, COND_C, I0);
 	UML_ROLINS(block, uml::mem(&m_sh2_state->sr), I0, T_SHIFT, SH_T);
-
-	UML_LABEL(block, compiler.labelnum++);  // labelnum+1:
 	return true;
 }
 
@@ -3637,27 +3598,36 @@ bool sh34_base_device::generate_group_15_FMOVFRMDR(drcuml_block &block, compiler
 	return true;
 }
 
-void sh34_base_device::func_FMOVFR() { FMOVFR(m_sh2_state->arg0); }
-static void cfunc_FMOVFR(void *param) { ((sh34_base_device *)param)->func_FMOVFR(); };
-
 bool sh34_base_device::generate_group_15_FMOVFR(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint16_t opcode, int in_delay_slot, uint32_t ovrpc)
 {
-	save_fast_iregs(block);
-	UML_MOV(block, mem(&m_sh2_state->arg0), desc->opptr.w[0]);
-	UML_CALLC(block, cfunc_FMOVFR, this);
-	load_fast_iregs(block);
+	uint32_t m = Rm; uint32_t n = Rn;
+
+	/* SZ and PR are fixed for the block, so the register selection is resolved here */
+	if (!(compiler.mode & SH4_MODE_SZ))
+	{
+#ifdef LSB_FIRST
+		n ^= compiler.mode & SH4_MODE_PR;
+		m ^= compiler.mode & SH4_MODE_PR;
+#endif
+		UML_MOV(block, FPS32(n), FPS32(m));
+	}
+	else
+	{
+		uint32_t *const src = (m & 1) ? m_sh2_state->m_xf : m_sh2_state->m_fr;
+		uint32_t *const dst = (n & 1) ? m_sh2_state->m_xf : m_sh2_state->m_fr;
+		UML_MOV(block, mem(&dst[n & 14]), mem(&src[m & 14]));
+		UML_MOV(block, mem(&dst[n | 1]), mem(&src[m | 1]));
+	}
 	return true;
 }
 
 bool sh34_base_device::generate_group_15_FMAC(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint16_t opcode, int in_delay_slot, uint32_t ovrpc)
 {
-	UML_TEST(block, mem(&m_sh2_state->m_fpu_pr), 0);
-	UML_JMPc(block, COND_NZ, compiler.labelnum);
-
-	UML_FSMUL(block, F0, FPS32(0), FPS32(Rm));
-	UML_FSADD(block, FPS32(Rn), F0, FPS32(Rn));
-
-	UML_LABEL(block, compiler.labelnum++);
+	if (!(compiler.mode & SH4_MODE_PR))
+	{
+		UML_FSMUL(block, F0, FPS32(0), FPS32(Rm));
+		UML_FSADD(block, FPS32(Rn), F0, FPS32(Rn));
+	}
 	return true;
 }
 
@@ -3688,8 +3658,7 @@ bool sh34_base_device::generate_group_15_op1111_0x13(drcuml_block &block, compil
 bool sh34_base_device::generate_group_15_op1111_0x13_FSTS(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint16_t opcode, int in_delay_slot, uint32_t ovrpc)
 {
 #ifdef LSB_FIRST
-	UML_XOR(block, I0, Rn, uml::mem(&m_sh2_state->m_fpu_pr));
-	UML_STORE(block, m_sh2_state->m_fr, I0, uml::mem(&m_sh2_state->m_fpul), SIZE_DWORD, SCALE_x4);
+	UML_MOV(block, FPS32(Rn ^ (compiler.mode & SH4_MODE_PR)), uml::mem(&m_sh2_state->m_fpul));
 #else
 	UML_MOV(block, FPS32(Rn), uml::mem(&m_sh2_state->m_fpul));
 #endif
@@ -3710,34 +3679,20 @@ bool sh34_base_device::generate_group_15_op1111_0x13_FLDS(drcuml_block &block, c
 
 bool sh34_base_device::generate_group_15_op1111_0x13_FLOAT(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint16_t opcode, int in_delay_slot, uint32_t ovrpc)
 {
-	UML_TEST(block, uml::mem(&m_sh2_state->m_fpu_pr), 0);
-	UML_JMPc(block, COND_Z, compiler.labelnum);
-
-	UML_FDFRINT(block, FPD32(Rn & 14), uml::mem(&m_sh2_state->m_fpul), SIZE_DWORD);
-	UML_JMP(block, compiler.labelnum+1);
-
-	UML_LABEL(block, compiler.labelnum++);  // labelnum:
-
-	UML_FSFRINT(block, FPS32(Rn), uml::mem(&m_sh2_state->m_fpul), SIZE_DWORD);
-
-	UML_LABEL(block, compiler.labelnum++);  // labelnum+1:
+	if (compiler.mode & SH4_MODE_PR)
+		UML_FDFRINT(block, FPD32(Rn & 14), uml::mem(&m_sh2_state->m_fpul), SIZE_DWORD);
+	else
+		UML_FSFRINT(block, FPS32(Rn), uml::mem(&m_sh2_state->m_fpul), SIZE_DWORD);
 
 	return true;
 }
 
 bool sh34_base_device::generate_group_15_op1111_0x13_FTRC(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint16_t opcode, int in_delay_slot, uint32_t ovrpc)
 {
-	UML_TEST(block, uml::mem(&m_sh2_state->m_fpu_pr), 0);
-	UML_JMPc(block, COND_Z, compiler.labelnum);
-
-	UML_FDTOINT(block, uml::mem(&m_sh2_state->m_fpul), FPD32(Rn & 14), SIZE_DWORD, ROUND_TRUNC);
-	UML_JMP(block, compiler.labelnum+1);
-
-	UML_LABEL(block, compiler.labelnum++);  // labelnum:
-
-	UML_FSTOINT(block, uml::mem(&m_sh2_state->m_fpul), FPS32(Rn), SIZE_DWORD, ROUND_TRUNC);
-
-	UML_LABEL(block, compiler.labelnum++);  // labelnum+1:
+	if (compiler.mode & SH4_MODE_PR)
+		UML_FDTOINT(block, uml::mem(&m_sh2_state->m_fpul), FPD32(Rn & 14), SIZE_DWORD, ROUND_TRUNC);
+	else
+		UML_FSTOINT(block, uml::mem(&m_sh2_state->m_fpul), FPS32(Rn), SIZE_DWORD, ROUND_TRUNC);
 	return true;
 }
 
@@ -3745,41 +3700,33 @@ bool sh34_base_device::generate_group_15_op1111_0x13_FNEG(drcuml_block &block, c
 {
 	UML_MOV(block, I0, 0);
 
-	UML_TEST(block, mem(&m_sh2_state->m_fpu_pr), 0);
-	UML_JMPc(block, COND_Z, compiler.labelnum);
-
-	UML_FDFRINT(block, F1, I0, SIZE_DWORD);
-	UML_FDSUB(block, FPD32(Rn), F1, FPD32(Rn));
-
-	UML_JMP(block, compiler.labelnum+1);
-
-	UML_LABEL(block, compiler.labelnum++);  // labelnum:
-
-	UML_FSFRINT(block, F1, I0, SIZE_DWORD);
-	UML_FSSUB(block, FPS32(Rn), F1, FPS32(Rn));
-
-	UML_LABEL(block, compiler.labelnum++);  // labelnum+1:
+	if (compiler.mode & SH4_MODE_PR)
+	{
+		UML_FDFRINT(block, F1, I0, SIZE_DWORD);
+		UML_FDSUB(block, FPD32(Rn), F1, FPD32(Rn));
+	}
+	else
+	{
+		UML_FSFRINT(block, F1, I0, SIZE_DWORD);
+		UML_FSSUB(block, FPS32(Rn), F1, FPS32(Rn));
+	}
 	return true;
 }
 
 bool sh34_base_device::generate_group_15_op1111_0x13_FABS(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint16_t opcode, int in_delay_slot, uint32_t ovrpc)
 {
-	UML_TEST(block, mem(&m_sh2_state->m_fpu_pr), 0);
-	UML_JMPc(block, COND_Z, compiler.labelnum);
-
+	if (compiler.mode & SH4_MODE_PR)
+	{
 #ifdef LSB_FIRST
-	UML_AND(block, FPS32(((Rn&14)|1)), FPS32(((Rn&14)|1)), 0x7fffffff);
+		UML_AND(block, FPS32(((Rn&14)|1)), FPS32(((Rn&14)|1)), 0x7fffffff);
 #else
-	UML_AND(block, FPS32(Rn&14), FPS32(Rn&14), 0x7fffffff);
+		UML_AND(block, FPS32(Rn&14), FPS32(Rn&14), 0x7fffffff);
 #endif
-
-	UML_JMP(block, compiler.labelnum+1);
-
-	UML_LABEL(block, compiler.labelnum++);  // labelnum:
-
-	UML_AND(block, FPS32(Rn), FPS32(Rn), 0x7fffffff);
-
-	UML_LABEL(block, compiler.labelnum++);  // labelnum+1:
+	}
+	else
+	{
+		UML_AND(block, FPS32(Rn), FPS32(Rn), 0x7fffffff);
+	}
 	return true;
 }
 
@@ -3810,9 +3757,7 @@ bool sh34_base_device::generate_group_15_op1111_0x13_FSRRA(drcuml_block &block,
 bool sh34_base_device::generate_group_15_op1111_0x13_FLDI0(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint16_t opcode, int in_delay_slot, uint32_t ovrpc)
 {
 #ifdef LSB_FIRST
-	UML_MOV(block, I0, Rn);
-	UML_XOR(block, I0, I0, uml::mem(&m_sh2_state->m_fpu_pr));
-	UML_STORE(block, m_sh2_state->m_fr, I0, 0, SIZE_DWORD, SCALE_x4);
+	UML_MOV(block, FPS32(Rn ^ (compiler.mode & SH4_MODE_PR)), 0);
 #else
 	UML_MOV(block, FP_RFS(Rn), 0);
 #endif
@@ -3822,9 +3767,7 @@ bool sh34_base_device::generate_group_15_op1111_0x13_FLDI0(drcuml_block &block,
 bool sh34_base_device::generate_group_15_op1111_0x13_FLDI1(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint16_t opcode, int in_delay_slot, uint32_t ovrpc)
 {
 #ifdef LSB_FIRST
-	UML_MOV(block, I0, Rn);
-	UML_XOR(block, I0, I0, uml::mem(&m_sh2_state->m_fpu_pr));
-	UML_STORE(block, m_sh2_state->m_fr, I0, 0x3F800000, SIZE_DWORD, SCALE_x4);
+	UML_MOV(block, FPS32(Rn ^ (compiler.mode & SH4_MODE_PR)), 0x3F800000);
 #else
 	UML_MOV(block, FP_RFS(Rn), 0x3F800000);
 #endif
@@ -3855,15 +3798,19 @@ bool sh34_base_device::generate_group_15_op1111_0x13_FCNVDS(drcuml_block &block,
 	return true;
 }
 
-void sh34_base_device::func_FIPR() { FIPR(m_sh2_state->arg0); }
-static void cfunc_FIPR(void *param) { ((sh34_base_device *)param)->func_FIPR(); };
-
 bool sh34_base_device::generate_group_15_op1111_0x13_FIPR(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint16_t opcode, int in_delay_slot, uint32_t ovrpc)
 {
-	save_fast_iregs(block);
-	UML_MOV(block, mem(&m_sh2_state->arg0), desc->opptr.w[0]);
-	UML_CALLC(block, cfunc_FIPR, this);
-	load_fast_iregs(block);
+	uint32_t const m = (Rn & 3) << 2;
+	uint32_t const n = Rn & 12;
+
+	/* same summation order as the interpreter: ((m0 + m1) + m2) + m3 */
+	UML_FSMUL(block, F0, FPS32(n + 0), FPS32(m + 0));
+	UML_FSMUL(block, F1, FPS32(n + 1), FPS32(m + 1));
+	UML_FSMUL(block, F2, FPS32(n + 2), FPS32(m + 2));
+	UML_FSMUL(block, F3, FPS32(n + 3), FPS32(m + 3));
+	UML_FSADD(block, F0, F0, F1);
+	UML_FSADD(block, F0, F0, F2);
+	UML_FSADD(block, FPS32(n + 3), F0, F3);
 	return true;
 }
 
@@ -3900,6 +3847,7 @@ bool sh34_base_device::generate_group_15_op1111_0x13_op1111_0xf13_FSCHG(drcuml_b
 	UML_MOV(block, uml::mem(&m_sh2_state->m_fpscr), I0);
 	UML_TEST(block, I0, SZ);
 	UML_SETc(block, COND_NZ, uml::mem(&m_sh2_state->m_fpu_sz));
+	UML_XOR(block, uml::mem(&m_sh2_state->m_drc_mode), uml::mem(&m_sh2_state->m_drc_mode), SH4_MODE_SZ);
 	return true;
 }
 
@@ -3922,15 +3870,25 @@ bool sh34_base_device::generate_group_15_op1111_0x13_op1111_0xf13_FRCHG(drcuml_b
 	return true;
 }
 
-void sh34_base_device::func_FTRV() { FTRV(m_sh2_state->arg0); }
-static void cfunc_FTRV(void *param) { ((sh34_base_device *)param)->func_FTRV(); };
-
 bool sh34_base_device::generate_group_15_op1111_0x13_op1111_0xf13_FTRV(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint16_t opcode, int in_delay_slot, uint32_t ovrpc)
 {
-	save_fast_iregs(block);
-	UML_MOV(block, mem(&m_sh2_state->arg0), desc->opptr.w[0]);
-	UML_CALLC(block, cfunc_FTRV, this);
-	load_fast_iregs(block);
+	uint32_t const n = Rn & 12;
+
+	/* each row is accumulated from 0.0 in the interpreter's order, into F0-F3, before FVn is overwritten */
+	UML_MOV(block, I0, 0);
+	UML_FSFRINT(block, F5, I0, SIZE_DWORD);
+	for (int i = 0; i < 4; i++)
+	{
+		uml::parameter const sum = uml::freg(i);
+		UML_FSMOV(block, sum, F5);
+		for (int j = 0; j < 4; j++)
+		{
+			UML_FSMUL(block, F4, uml::mem(&m_sh2_state->m_xf[(j << 2) + i]), FPS32(n + j));
+			UML_FSADD(block, sum, sum, F4);
+		}
+	}
+	for (int i = 0; i < 4; i++)
+		UML_FSMOV(block, FPS32(n + i), uml::freg(i));
 	return true;
 }
 
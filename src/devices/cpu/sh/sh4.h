@@ -216,7 +216,6 @@ public:
 	void func_STSFPSCR();
 	void func_FLDI0();
 	void func_FLDI1();
-	void func_FMOVFR();
 	void func_FMOVFRS0();
 	void func_FTRC();
 	void func_FMOVMRFR();
@@ -231,11 +230,9 @@ public:
 	void func_FMAC();
 	void func_FABS();
 	void func_FLDS();
-	void func_FTRV();
 	void func_FSTS();
 	void func_FSSCA();
 	void func_FCNVSD();
-	void func_FIPR();
 	void func_FSRRA();
 	void func_FSQRT();
 	void func_FCNVDS();
@@ -413,6 +410,7 @@ protected:
 	void sh4_change_register_bank(int to);
 	void sh4_swap_fp_registers();
 	void sh4_swap_fp_couples();
+	void sh4_update_drc_mode();
 	void sh4_syncronize_register_bank(int to);
 	void sh4_default_exception_priorities();
 	void sh4_exception_recompute();
@@ -261,6 +261,11 @@ void sh34_base_device::sh4_swap_fp_couples()
 	}
 }
 
+void sh34_base_device::sh4_update_drc_mode()
+{
+	m_sh2_state->m_drc_mode = (m_sh2_state->m_fpu_pr ? SH4_MODE_PR : 0) | (m_sh2_state->m_fpu_sz ? SH4_MODE_SZ : 0);
+}
+
 
 void sh34_base_device::sh4_change_register_bank(int to)
 {
@@ -36,6 +36,11 @@
 #define FP_XFS2(r) *( (float  *)(m_sh2_state->m_xf+((r) ^ m_sh2_state->m_fpu_pr)) )
 #endif
 
+/* DRC hash modes: FPU code is compiled separately for each FPSCR.PR/SZ combination */
+#define SH4_MODE_PR     1
+#define SH4_MODE_SZ     2
+#define SH4_MODE_COUNT  4
+
 #define FPSCR           mem(&m_sh2_state->m_fpscr)
 #define FPS32(reg)      m_fs_regmap[reg]
 #define FPD32(reg)      m_fd_regmap[reg & 14]
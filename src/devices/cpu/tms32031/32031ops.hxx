@@ -97,6 +97,31 @@ inline void tms3203x_device::execute_one()
 }
 
 
+// RPTS fetches the repeated instruction only once, so run the repeats
+// back to back without going through the block check every time
+void tms3203x_device::execute_repeat_single()
+{
+	uint32_t const pc = m_pc;
+	uint32_t const op = ROPCODE(pc);
+	auto const handler = s_tms32031ops[op >> 21];
+	for (;;)
+	{
+		burn_cycle(1);
+		m_pc = pc + 1;
+#if (TMS_3203X_LOG_OPCODE_USAGE)
+		m_hits[op >> 21]++;
+#endif
+		(this->*handler)(op);
+
+		// stop as soon as the instruction changes anything the repeat depends on
+		if (m_icount <= 0 || m_is_idling || m_pc != pc + 1 || !(IREG(TMR_ST) & RMFLAG) ||
+				IREG(TMR_RS) != pc || IREG(TMR_RE) != pc || (int32_t)IREG(TMR_RC) <= 0)
+			break;
+		--IREG(TMR_RC);
+	}
+}
+
+
 void tms3203x_device::update_special(int dreg)
 {
 	if (dreg == TMR_BK)
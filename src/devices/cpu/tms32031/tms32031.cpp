@@ -977,7 +977,13 @@ void tms3203x_device::execute_run()
 			if ((IREG(TMR_ST) & RMFLAG) && m_pc == IREG(TMR_RE) + 1)
 			{
 				if ((int32_t)--IREG(TMR_RC) >= 0)
+				{
 					m_pc = IREG(TMR_RS);
+
+					// single instruction repeated by RPTS
+					if (m_delayed && IREG(TMR_RS) == IREG(TMR_RE))
+						execute_repeat_single();
+				}
 				else
 				{
 					IREG(TMR_ST) &= ~RMFLAG;
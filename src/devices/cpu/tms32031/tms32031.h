@@ -184,6 +184,7 @@ protected:
 	// misc helpers
 	void check_irqs();
 	void execute_one();
+	void execute_repeat_single();
 	void update_special(int dreg);
 	void burn_cycle(int cycle);
 	bool condition(int which);
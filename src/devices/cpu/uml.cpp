@@ -804,6 +804,69 @@ u8 uml::instruction::modified_flags() const
 }
 
 
+//-------------------------------------------------
+//  param_is_input - return true if the given
+//  parameter is read by the instruction
+//-------------------------------------------------
+
+bool uml::instruction::param_is_input(int paramnum) const
+{
+	assert(paramnum < m_numparams);
+	return (s_opcode_info_table[m_opcode].param[paramnum].output & PIO_IN) != 0;
+}
+
+
+//-------------------------------------------------
+//  param_is_output - return true if the given
+//  parameter is written by the instruction
+//-------------------------------------------------
+
+bool uml::instruction::param_is_output(int paramnum) const
+{
+	assert(paramnum < m_numparams);
+	return (s_opcode_info_table[m_opcode].param[paramnum].output & PIO_OUT) != 0;
+}
+
+
+//-------------------------------------------------
+//  param_allows - return true if the given
+//  parameter may be of the specified type
+//-------------------------------------------------
+
+bool uml::instruction::param_allows(int paramnum, parameter::parameter_type type) const
+{
+	assert(paramnum < m_numparams);
+	u16 const typemask = s_opcode_info_table[m_opcode].param[paramnum].typemask;
+
+	// pointer and state parameters name a block of memory, not a value
+	if ((type == parameter::PTYPE_MEMORY) && (typemask & (PTYPES_PTR | PTYPES_STATE) & ~PTYPES_MEM))
+		return false;
+	return BIT(typemask, type);
+}
+
+
+//-------------------------------------------------
+//  param_bytes - return the number of bytes of
+//  the given parameter the instruction accesses
+//-------------------------------------------------
+
+u8 uml::instruction::param_bytes(int paramnum) const
+{
+	assert(paramnum < m_numparams);
+	switch (s_opcode_info_table[m_opcode].param[paramnum].size)
+	{
+		case PSIZE_4:   return 4;
+		case PSIZE_8:   return 8;
+		case PSIZE_P1:  return 1 << m_param[0].size();
+		case PSIZE_P2:  return 1 << m_param[1].size();
+		case PSIZE_P3:  return 1 << m_param[2].size();
+		case PSIZE_P4:  return 1 << m_param[3].size();
+		default:
+		case PSIZE_OP:  return m_size;
+	}
+}
+
+
 //-------------------------------------------------
 //  disasm - disassemble an instruction to the
 //  given buffer
@@ -405,6 +405,13 @@ namespace uml
 		// setters
 		void set_flags(u8 flags) { m_flags = flags; }
 		void set_mapvar(int paramnum, u32 value) { assert(paramnum < m_numparams); assert(m_param[paramnum].is_mapvar()); m_param[paramnum] = value; }
+		void set_param(int paramnum, parameter const &value) { assert(paramnum < m_numparams); assert(param_allows(paramnum, value.type())); m_param[paramnum] = value; }
+
+		// parameter information
+		bool param_is_input(int paramnum) const;
+		bool param_is_output(int paramnum) const;
+		bool param_allows(int paramnum, parameter::parameter_type type) const;
+		u8 param_bytes(int paramnum) const;
 
 		// misc
 		std::string disasm(drcuml_state *drcuml = nullptr) const;
@@ -43,7 +43,7 @@ unsp_device::unsp_device(const machine_config &mconfig, device_type type, const
 #if UNSP_LOG_OPCODES || UNSP_LOG_REGS
 	, m_log_ops(0)
 #endif
-	, m_drccache(CACHE_SIZE + sizeof(unsp_device))
+	, m_drccache(mconfig, CACHE_SIZE + sizeof(unsp_device))
 	, m_drcuml(nullptr)
 	, m_drcfe(nullptr)
 	, m_drcoptions(0)
@@ -528,7 +528,9 @@ uint8_t z80_device::rop()
 {
 	// Use leftovers from previous instruction. Mainly to support recursive EXEC(.., rop())
 	if(m_icount_executing) T(m_icount_executing);
-	uint8_t res = m_opcodes.read_byte(translate_memory_address(PCD));
+	u16 const pc = PC;
+	const u8 *const page = ((pc & ~m_fetch_mask) == m_fetch_base[0]) ? m_fetch_ptr[0] : fetch_page(0, pc);
+	uint8_t res = page ? page[pc & m_fetch_mask] : m_opcodes.read_byte(translate_memory_address(PCD));
 	T(execute_min_cycles());
 	m_refresh_cb((m_i << 8) | (m_r2 & 0x80) | (m_r & 0x7f), 0x00, 0xff);
 	T(execute_min_cycles());
@@ -546,7 +548,9 @@ uint8_t z80_device::rop()
  ***************************************************************/
 uint8_t z80_device::arg()
 {
-	u8 res = m_args.read_byte(translate_memory_address(PCD));
+	u16 const pc = PC;
+	const u8 *const page = ((pc & ~m_fetch_mask) == m_fetch_base[1]) ? m_fetch_ptr[1] : fetch_page(1, pc);
+	u8 res = page ? page[pc & m_fetch_mask] : m_args.read_byte(translate_memory_address(PCD));
 	T(MTM);
 	PC++;
 
@@ -560,6 +564,32 @@ uint16_t z80_device::arg16()
 	return (u16(arg()) << 8) | res;
 }
 
+/***************************************************************
+ * Opcode and argument bytes in plain RAM/ROM pages are read
+ * straight from host memory.  The host pointer for a page is
+ * looked up in the flattened page table when fetching leaves
+ * the current page, and dropped whenever the space map changes.
+ * Nothing is copied, so writes to RAM are seen immediately, and
+ * pages with handlers (e.g. contended memory, decrypting banks)
+ * keep going through the memory system.
+ ***************************************************************/
+const u8 *z80_device::fetch_page(int index, u16 addr)
+{
+	m_fetch_base[index] = addr & ~m_fetch_mask;
+	m_fetch_ptr[index] = nullptr;
+
+	address_space *const space = m_fetch_space[index];
+	if (space)
+	{
+		uintptr_t entry = space->flat_read_table()[addr >> space->flat_page_shift()];
+		if (entry == emu::detail::FLAT_UNKNOWN)
+			entry = space->flat_fill(read_or_write::READ, addr);
+		if (entry != emu::detail::FLAT_NONE)
+			m_fetch_ptr[index] = reinterpret_cast<const u8 *>(entry);
+	}
+	return m_fetch_ptr[index];
+}
+
 /***************************************************************
  * Calculate the effective address EA of an opcode using
  * IX+offset resp. IY+offset addressing.
@@ -3547,6 +3577,28 @@ void z80_device::device_start()
 	space(AS_PROGRAM).specific(m_data);
 	space(AS_IO).specific(m_io);
 
+	// direct fetching needs flattened pages and untranslated addresses
+	address_space *const fetch_spaces[2] = { &space(has_space(AS_OPCODES) ? AS_OPCODES : AS_PROGRAM), &space(AS_PROGRAM) };
+	m_fetch_mask = 0xffff;
+	for (int i = 0; i < 2; i++)
+	{
+		address_space &fetch = *fetch_spaces[i];
+		bool const direct = fetch.flat_read_table() && (fetch.addr_width() == 16);
+		m_fetch_space[i] = direct ? &fetch : nullptr;
+		m_fetch_ptr[i] = nullptr;
+		m_fetch_base[i] = ~u32(0);
+		if (direct)
+		{
+			m_fetch_mask = std::min<u16>(m_fetch_mask, make_bitmask<u16>(fetch.flat_page_shift()));
+			m_fetch_notifier[i] = fetch.add_change_notifier(
+					[this, i] (read_or_write mode)
+					{
+						if (u32(mode) & u32(read_or_write::READ))
+							m_fetch_base[i] = ~u32(0);
+					});
+		}
+	}
+
 	IX = IY = 0xffff; /* IX and IY are FFFF after a reset! */
 	F = ZF;           /* Zero flag is set */
 
@@ -3845,6 +3897,8 @@ z80_device::z80_device(const machine_config &mconfig, device_type type, const ch
 	m_halt_cb(*this),
 	m_mtm_cycles(3)
 {
+	m_program_config.m_flat_access = true;
+	m_opcodes_config.m_flat_access = true;
 }
 
 device_memory_interface::space_config_vector z80_device::memory_space_config() const
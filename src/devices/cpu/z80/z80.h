@@ -159,6 +159,7 @@ protected:
 	void wm16_sp(PAIR &r);
 	virtual uint8_t rop();
 	virtual uint8_t arg();
+	const u8 *fetch_page(int index, u16 addr);
 	virtual uint16_t arg16();
 	void eax();
 	void eay();
@@ -241,14 +242,21 @@ protected:
 	void nomreq_addr(u16 addr, s8 cycles);
 
 	// address spaces
-	const address_space_config m_program_config;
-	const address_space_config m_opcodes_config;
+	address_space_config m_program_config;
+	address_space_config m_opcodes_config;
 	const address_space_config m_io_config;
 	memory_access<16, 0, 0, ENDIANNESS_LITTLE>::cache m_args;
 	memory_access<16, 0, 0, ENDIANNESS_LITTLE>::cache m_opcodes;
 	memory_access<16, 0, 0, ENDIANNESS_LITTLE>::specific m_data;
 	memory_access<16, 0, 0, ENDIANNESS_LITTLE>::specific m_io;
 
+	// host memory backing the pages opcodes (0) and arguments (1) are fetched from
+	address_space *   m_fetch_space[2];     // space to look pages up in, nullptr if it has no flattened pages
+	const u8 *        m_fetch_ptr[2];       // host pointer for m_fetch_base, nullptr if fetches must go through the memory system
+	u32               m_fetch_base[2];      // address of the current page, ~0 if none
+	u16               m_fetch_mask;         // offset mask within a page
+	util::notifier_subscription m_fetch_notifier[2];
+
 	devcb_write_line m_irqack_cb;
 	devcb_write8 m_refresh_cb;
 	devcb_write8 m_nomreq_cb;
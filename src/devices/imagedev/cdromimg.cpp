@@ -9,6 +9,7 @@
 #include "emu.h"
 #include "cdromimg.h"
 
+#include "emuopts.h"
 #include "romload.h"
 
 // device type definition
@@ -118,6 +119,10 @@ std::pair<std::error_condition, std::string> cdrom_image_device::call_load()
 			if (err)
 				goto error;
 			chd = &m_self_chd;
+
+			const int cache_hunks = device().machine().options().chd_cache();
+			if (cache_hunks > 0)
+				m_self_chd.set_hunk_cache(cache_hunks, cache_hunks / 4);
 		}
 	} else {
 		chd = device().machine().rom_load().get_disk_handle(device().subtag("cdrom").c_str());
@@ -200,6 +205,21 @@ bool cdrom_image_device::read_data(uint32_t lbasector, void *buffer, uint32_t da
 	return 0;
 }
 
+bool cdrom_image_device::read_sectors(uint32_t lbasector, uint32_t count, void *buffer, uint32_t datatype, bool phys)
+{
+	if (m_cdrom_handle)
+		return m_cdrom_handle->read_sectors(lbasector, count, buffer, datatype, phys);
+	if (m_dvdrom_handle)
+	{
+		bool result = true;
+		for (uint32_t i = 0; i < count; i++)
+			if (m_dvdrom_handle->read_data(lbasector + i, reinterpret_cast<uint8_t *>(buffer) + (i * 2048)))
+				result = false;
+		return result;
+	}
+	return 0;
+}
+
 bool cdrom_image_device::read_subcode(uint32_t lbasector, void *buffer, bool phys)
 {
 	if (m_cdrom_handle)
@@ -62,6 +62,7 @@ public:
 	uint32_t get_track(uint32_t frame) const;
 	uint32_t get_track_start(uint32_t track) const;
 	bool read_data(uint32_t lbasector, void *buffer, uint32_t datatype, bool phys=false);
+	bool read_sectors(uint32_t lbasector, uint32_t count, void *buffer, uint32_t datatype, bool phys=false);
 	bool read_subcode(uint32_t lbasector, void *buffer, bool phys=false);
 	int get_adr_control(int track) const;
 	const cdrom_file::toc &get_toc() const;
@@ -116,6 +116,7 @@ void harddisk_image_device::device_start()
 void harddisk_image_device::device_stop()
 {
 	m_hard_disk_handle.reset();
+	m_overlay_file.reset();
 }
 
 std::pair<std::error_condition, std::string> harddisk_image_device::call_load()
@@ -177,6 +178,7 @@ void harddisk_image_device::call_unload()
 		m_device_image_unload(*this);
 
 	m_hard_disk_handle.reset();
+	m_overlay_file.reset();
 
 	if (m_chd)
 	{
@@ -229,6 +231,27 @@ static std::error_condition open_disk_diff(emu_options &options, const char *nam
 	return std::errc::no_such_file_or_directory;
 }
 
+/*-------------------------------------------------
+    open_disk_overlay - open a DISK overlay file
+-------------------------------------------------*/
+
+static std::error_condition open_disk_overlay(emu_options &options, const char *name, std::unique_ptr<emu_file> &file)
+{
+	std::string fname = std::string(name).append(".ovl");
+
+	// try to open an existing overlay, then try creating it instead
+	file = std::make_unique<emu_file>(options.diff_directory(), OPEN_FLAG_READ | OPEN_FLAG_WRITE);
+	std::error_condition filerr = file->open(fname);
+	if (filerr)
+	{
+		file->set_openflags(OPEN_FLAG_READ | OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+		filerr = file->open(fname);
+	}
+	if (filerr)
+		file.reset();
+	return filerr;
+}
+
 std::error_condition harddisk_image_device::internal_load_hd()
 {
 	if (has_preset_images())
@@ -242,6 +265,7 @@ std::error_condition harddisk_image_device::internal_load_hd()
 	uint8_t header[64];
 
 	m_hard_disk_handle.reset();
+	m_overlay_file.reset();
 
 	// open the CHD file
 	if (loaded_through_softlist())
@@ -285,10 +309,29 @@ std::error_condition harddisk_image_device::internal_load_hd()
 
 	if (m_chd)
 	{
+		// cache decompressed hunks if requested; softlist disks are set up by the ROM loader
+		const int cache_hunks = machine().options().chd_cache();
+		if (!loaded_through_softlist() && (cache_hunks > 0))
+			m_chd->set_hunk_cache(cache_hunks, cache_hunks / 4);
+
 		// open the hard disk file
 		m_hard_disk_handle.reset(new hard_disk_file(m_chd));
 		if (m_hard_disk_handle)
+		{
+			// compressed CHDs can't be written in place, so keep writes in an overlay
+			if ((m_chd == &m_origchd) && m_chd->compressed())
+			{
+				err = open_disk_overlay(device().machine().options(), basename_noext(), m_overlay_file);
+				if (!err)
+					err = m_hard_disk_handle->set_overlay(&static_cast<util::core_file &>(*m_overlay_file));
+				if (err)
+				{
+					osd_printf_warning("%s: can't open overlay, writes to the compressed image will fail (%s)\n", tag(), err.message());
+					m_overlay_file.reset();
+				}
+			}
 			return std::error_condition();
+		}
 	}
 	else
 	{
@@ -341,14 +384,14 @@ const hard_disk_file::info &harddisk_image_device::get_info() const
 	return m_hard_disk_handle->get_info();
 }
 
-bool harddisk_image_device::read(uint32_t lbasector, void *buffer)
+bool harddisk_image_device::read(uint32_t lbasector, void *buffer, uint32_t count)
 {
-	return m_hard_disk_handle->read(lbasector, buffer);
+	return m_hard_disk_handle->read(lbasector, buffer, count);
 }
 
-bool harddisk_image_device::write(uint32_t lbasector, const void *buffer)
+bool harddisk_image_device::write(uint32_t lbasector, const void *buffer, uint32_t count)
 {
-	return m_hard_disk_handle->write(lbasector, buffer);
+	return m_hard_disk_handle->write(lbasector, buffer, count);
 }
 
 
@@ -22,6 +22,9 @@
 #include <utility>
 
 
+class emu_file;
+
+
 /***************************************************************************
     TYPE DEFINITIONS
 ***************************************************************************/
@@ -75,8 +78,8 @@ public:
 	virtual const util::option_guide &create_option_guide() const override;
 
 	const hard_disk_file::info &get_info() const;
-	bool read(uint32_t lbasector, void *buffer);
-	bool write(uint32_t lbasector, const void *buffer);
+	bool read(uint32_t lbasector, void *buffer, uint32_t count = 1);
+	bool write(uint32_t lbasector, const void *buffer, uint32_t count = 1);
 
 	bool set_block_size(uint32_t blocksize);
 
@@ -101,6 +104,7 @@ protected:
 	chd_file        *m_chd;
 	chd_file        m_origchd;              // handle to the original CHD
 	chd_file        m_diffchd;              // handle to the diff CHD
+	std::unique_ptr<emu_file> m_overlay_file; // writes to a compressed CHD go here
 	std::unique_ptr<hard_disk_file> m_hard_disk_handle;
 
 	load_delegate   m_device_image_load;
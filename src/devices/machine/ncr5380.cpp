@@ -489,16 +489,36 @@ int ncr5380_device::state_step()
 				m_idata = scsi_bus->data_r();
 				LOGMASKED(LOG_DMA, "dma in: 0x%02x\n", m_idata);
 
-				m_state = DMA_IN_ACK;
+				m_state = DMA_IN_DRQ;
 				set_drq(true);
-
-				// assert ACK
-				scsi_bus->ctrl_w(scsi_refid, S_ACK, S_ACK);
 			}
 
 			delay = -1;
 		}
 		break;
+	case DMA_IN_DRQ:
+		// wait for the byte to be read
+		if (m_drq_state)
+		{
+			delay = -1;
+			break;
+		}
+
+		// take the byte without a handshake if the target supports it
+		if (u8 data; scsi_bus->data_block_in(scsi_refid, &data, 1))
+		{
+			m_state = (m_bas & BAS_ENDOFDMA) ? IDLE : DMA_IN_REQ;
+			if (!(ctrl & S_REQ))
+				delay = -1;
+		}
+		else
+		{
+			m_state = DMA_IN_ACK;
+
+			// assert ACK
+			scsi_bus->ctrl_w(scsi_refid, S_ACK, S_ACK);
+		}
+		break;
 	case DMA_IN_ACK:
 		if (!(ctrl & S_REQ))
 		{
@@ -516,32 +536,35 @@ int ncr5380_device::state_step()
 		delay = -1;
 		break;
 	case DMA_OUT_REQ:
-		if (ctrl & S_REQ)
+		// wait for the byte to be written
+		if (m_drq_state)
+			delay = -1;
+		else if (ctrl & S_REQ)
 		{
 			if ((ctrl & S_PHASE_MASK) == (m_tcmd & TC_PHASE))
 			{
 				LOGMASKED(LOG_DMA, "dma out: 0x%02x\n", m_odata);
 
-				m_state = DMA_OUT_ACK;
-
-				// assert data and ACK
-				scsi_bus->data_w(scsi_refid, m_odata);
-				scsi_bus->ctrl_w(scsi_refid, S_ACK, S_ACK);
+				if (scsi_bus->data_block_out(scsi_refid, &m_odata, 1))
+				{
+					// the target took the byte without a handshake
+					m_state = dma_out_done();
+				}
+				else
+				{
+					m_state = DMA_OUT_ACK;
+
+					// assert data and ACK
+					scsi_bus->data_w(scsi_refid, m_odata);
+					scsi_bus->ctrl_w(scsi_refid, S_ACK, S_ACK);
+				}
 			}
 		}
 		break;
 	case DMA_OUT_ACK:
 		if (!(ctrl & S_REQ))
 		{
-			if (m_bas & BAS_ENDOFDMA)
-			{
-				m_state = IDLE;
-
-				if (m_has_lbs)
-					m_tcmd |= TC_LBS;
-			}
-			else
-				m_state = DMA_OUT_DRQ;
+			m_state = dma_out_done();
 
 			// clear data and ACK
 			scsi_bus->data_w(scsi_refid, 0);
@@ -553,6 +576,19 @@ int ncr5380_device::state_step()
 	return delay;
 }
 
+ncr5380_device::state ncr5380_device::dma_out_done()
+{
+	if (m_bas & BAS_ENDOFDMA)
+	{
+		if (m_has_lbs)
+			m_tcmd |= TC_LBS;
+
+		return IDLE;
+	}
+	else
+		return DMA_OUT_DRQ;
+}
+
 void ncr5380_device::eop_w(int state)
 {
 	LOGMASKED(LOG_DMA, "eop_w %d\n", state);
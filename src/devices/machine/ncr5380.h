@@ -144,12 +144,14 @@ private:
 
 		// dma transfer
 		DMA_IN_REQ,
+		DMA_IN_DRQ,
 		DMA_IN_ACK,
 		DMA_OUT_REQ,
 		DMA_OUT_DRQ,
 		DMA_OUT_ACK,
 	}
 	m_state;
+	state dma_out_done();
 
 	// registers
 	u8 m_odata;
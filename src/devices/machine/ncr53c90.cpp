@@ -617,7 +617,8 @@ void ncr53c90_device::step(bool timeout)
 			if (xfr_phase == S_PHASE_MSG_OUT && remaining_bytes == 1)
 				scsi_bus->ctrl_w(scsi_refid, 0, S_ATN);
 
-			send_byte();
+			if (!block_xfer())
+				send_byte();
 			break;
 		}
 
@@ -631,7 +632,8 @@ void ncr53c90_device::step(bool timeout)
 			// if it's the last message byte, ACK remains asserted, terminate with function_complete()
 			state = (xfr_phase == S_PHASE_MSG_IN && (!dma_command || tcounter == 1)) ? INIT_XFR_RECV_BYTE_NACK : INIT_XFR_RECV_BYTE_ACK;
 
-			recv_byte();
+			if (!block_xfer())
+				recv_byte();
 			break;
 
 		default:
@@ -661,6 +663,15 @@ void ncr53c90_device::step(bool timeout)
 		step(false);
 		break;
 
+	case INIT_XFR_BLOCK_WAIT:
+		if(!timeout)
+			break;
+
+		state = INIT_XFR_WAIT_REQ;
+		scsi_bus->ctrl_wait(scsi_refid, S_REQ, S_REQ);
+		step(false);
+		break;
+
 	case INIT_XFR_SEND_BYTE:
 		state = INIT_XFR_WAIT_REQ;
 		step(false);
@@ -763,6 +774,43 @@ void ncr53c90_device::send_byte()
 	delay_cycles(sync_period);
 }
 
+bool ncr53c90_device::block_xfer()
+{
+	// move as much of an asynchronous dma data phase as the fifo allows
+	// in one go, if the target supports it and is already requesting
+	if (!dma_command || sync_offset || (status & S_TC0) || (xfr_phase != S_PHASE_DATA_IN && xfr_phase != S_PHASE_DATA_OUT))
+		return false;
+
+	// the target drops REQ during the call, so don't let that look like a handshake
+	int const prev = state;
+	state = INIT_XFR_BLOCK_WAIT;
+	int count;
+	if (xfr_phase == S_PHASE_DATA_IN) {
+		uint8_t buf[16];
+		count = scsi_bus->data_block_in(scsi_refid, buf, std::min<int>(16 - fifo_pos, tcounter ? tcounter : tcounter_mask + 1));
+		for (int i = 0; i < count; i++)
+			fifo_push(buf[i]);
+		// in async mode data in phase, tcount is decremented on ACKO, not DACK
+		if (count)
+			decrement_tcounter(count);
+	} else {
+		count = scsi_bus->data_block_out(scsi_refid, fifo, fifo_pos);
+		if (count) {
+			fifo_pos -= count;
+			memmove(fifo, fifo + count, fifo_pos);
+			check_drq();
+		}
+	}
+	if (!count) {
+		state = prev;
+		return false;
+	}
+
+	LOGMASKED(LOG_FIFO, "block transfer %d bytes, fifo_pos %d tcounter %d\n", count, fifo_pos, tcounter);
+	delay_cycles(sync_period * count);
+	return true;
+}
+
 void ncr53c90_device::recv_byte()
 {
 	scsi_bus->ctrl_wait(scsi_refid, S_REQ, S_REQ);
@@ -110,6 +110,7 @@ protected:
 		INIT_XFR_FUNCTION_COMPLETE,
 		INIT_XFR_BUS_COMPLETE,
 		INIT_XFR_WAIT_REQ,
+		INIT_XFR_BLOCK_WAIT,
 		INIT_CPT_RECV_BYTE_ACK,
 		INIT_CPT_RECV_WAIT_REQ,
 		INIT_CPT_RECV_BYTE_NACK
@@ -232,6 +233,7 @@ protected:
 	void delay_cycles(int cycles);
 
 	void decrement_tcounter(int count = 1);
+	bool block_xfer();
 
 	devcb_write_line m_irq_handler;
 	devcb_write_line m_drq_handler;
@@ -16,14 +16,22 @@
 #include "netlist/nl_parser.h"
 #include "netlist/nl_interface.h"
 
+#include "netlist/solver/nld_solver.h"
+
 #include "netlist/plib/pdynlib.h"
 #include "netlist/plib/pstonum.h"
 
 #include "debugger.h"
 #include "romload.h"
 #include "emuopts.h"
+#include "fileio.h"
+
+#include "corestr.h"
+#include "hashing.h"
 
 #include <cmath>
+#include <cstdio>
+#include <cstdlib>
 #include <memory>
 #include <string>
 #include <utility>
@@ -66,6 +74,39 @@ DEFINE_DEVICE_TYPE(NETLIST_STREAM_OUTPUT, netlist_mame_stream_output_device, "nl
 
 extern const plib::static_library::symbol nl_static_solver_syms[];
 
+#if defined(_WIN32)
+static constexpr char NL_SOLVER_LIB_EXT[] = ".dll";
+#elif defined(__APPLE__)
+static constexpr char NL_SOLVER_LIB_EXT[] = ".dylib";
+#else
+static constexpr char NL_SOLVER_LIB_EXT[] = ".so";
+#endif
+
+// solvers compiled into MAME, backed by ones compiled for this system at runtime
+class netlist_solver_library : public plib::dynamic_library_base
+{
+public:
+	netlist_solver_library(const plib::static_library::symbol *builtin, std::unique_ptr<plib::dynamic_library> &&cached)
+		: m_builtin(builtin)
+		, m_cached(std::move(cached))
+	{
+		set_loaded(true);
+	}
+
+protected:
+	void *get_symbol_pointer(const pstring &name) const noexcept override
+	{
+		void *const sym = m_builtin.get_symbol<void *>(name);
+		if (sym || !m_cached || !m_cached->isLoaded())
+			return sym;
+		return m_cached->get_symbol<void *>(name);
+	}
+
+private:
+	plib::static_library m_builtin;
+	std::unique_ptr<plib::dynamic_library> m_cached;
+};
+
 static netlist::netlist_time_ext nltime_from_attotime(attotime t)
 {
 	netlist::netlist_time_ext nlmtime = netlist::netlist_time_ext::from_sec(t.seconds());
@@ -1030,7 +1071,38 @@ void netlist_mame_device::device_start_common()
 {
 	m_netlist = std::make_unique<netlist_mame_t>(*this, "netlist");
 
-	m_netlist->set_static_solver_lib(std::make_unique<plib::static_library>(nl_static_solver_syms));
+	// solvers are bound when the netlist is set up, so an existing cached library has to be loaded first
+	std::unique_ptr<plib::dynamic_library> cached;
+	std::string cachename;
+	std::string cachehash;
+	if (*machine().options().netlist_cache_directory())
+	{
+		cachename = solver_cache_name();
+		emu_file hashfile(machine().options().netlist_cache_directory(), OPEN_FLAG_READ);
+		if (!hashfile.open(cachename + ".sha1"))
+		{
+			char buffer[64];
+			if (hashfile.gets(buffer, std::size(buffer)))
+				cachehash = strtrimspace(buffer);
+			hashfile.close();
+		}
+		emu_file libfile(machine().options().netlist_cache_directory(), OPEN_FLAG_READ);
+		if (!cachehash.empty() && !libfile.open(cachename + "_" + cachehash + NL_SOLVER_LIB_EXT))
+		{
+			std::string const path = libfile.fullpath();
+			libfile.close();
+			cached = std::make_unique<plib::dynamic_library>(pstring(path));
+			if (cached->isLoaded())
+				osd_printf_verbose("Loaded cached netlist solvers from %s\n", path);
+			else
+				cachehash.clear();
+		}
+		else
+		{
+			cachehash.clear();
+		}
+	}
+	m_netlist->set_static_solver_lib(std::make_unique<netlist_solver_library>(nl_static_solver_syms, std::move(cached)));
 
 	if (!machine().options().verbose())
 	{
@@ -1041,6 +1113,9 @@ void netlist_mame_device::device_start_common()
 	common_dev_start(m_netlist.get());
 	m_netlist->setup().prepare_to_run();
 
+	if (!cachename.empty())
+		update_solver_cache(cachename, cachehash);
+
 
 	m_device_reset_called = false;
 
@@ -1056,6 +1131,73 @@ void netlist_mame_device::device_start_common()
 }
 
 
+std::string netlist_mame_device::solver_cache_name() const
+{
+	std::string name = machine().system().name;
+	name += tag();
+	for (char &c : name)
+		if (c == ':')
+			c = '_';
+	return name;
+}
+
+
+void netlist_mame_device::update_solver_cache(const std::string &name, const std::string &loaded_hash)
+{
+	auto const solvers = m_netlist->exec().solver()->create_solver_code(netlist::solver::CXX_EXTERNAL_C);
+	if (solvers.empty())
+		return;
+
+	// the generated code only needs this much of plib
+	std::string code = "// netlist solvers generated by MAME\n\nnamespace plib { template <typename... Ts> inline void unused_var(Ts &&...) noexcept { } }\n\n";
+	for (auto const &solver : solvers)
+	{
+		code += putf8string(solver.second);
+		code += '\n';
+	}
+
+	// the symbol names already depend on matrix structure, cover everything else by hashing the source
+	std::string const hash = util::sha1_creator::simple(code.data(), code.size()).as_string();
+	if (hash == loaded_hash)
+		return;
+
+	emu_file srcfile(machine().options().netlist_cache_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (srcfile.open(name + ".cpp"))
+	{
+		osd_printf_warning("Unable to write netlist solver source %s.cpp\n", name);
+		return;
+	}
+	srcfile.puts(code);
+	std::string const srcpath = srcfile.fullpath();
+	srcfile.close();
+
+	// build next to the source so the search path finds the library next time
+	std::string const libpath = srcpath.substr(0, srcpath.length() - 4) + "_" + hash + NL_SOLVER_LIB_EXT;
+	std::string command = machine().options().netlist_compiler();
+	strreplace(command, "%s", "\"" + srcpath + "\"");
+	strreplace(command, "%o", "\"" + libpath + "\"");
+	osd_printf_info("Compiling %u netlist solvers for %s...\n", unsigned(solvers.size()), tag());
+	osd_printf_verbose("%s\n", command);
+	if (std::system(command.c_str()) != 0)
+	{
+		osd_printf_warning("Compiling netlist solvers failed, using generic solvers\n");
+		return;
+	}
+
+	emu_file hashfile(machine().options().netlist_cache_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (!hashfile.open(name + ".sha1"))
+	{
+		hashfile.puts(hash);
+		hashfile.close();
+	}
+
+	// the previous library may still be mapped on some hosts, so failing to remove it is fine
+	if (!loaded_hash.empty())
+		std::remove((srcpath.substr(0, srcpath.length() - 4) + "_" + loaded_hash + NL_SOLVER_LIB_EXT).c_str());
+	osd_printf_info("Netlist solvers for %s will be used from the next run\n", tag());
+}
+
+
 void netlist_mame_device::device_start()
 {
 	LOGDEVCALLS("device_start entry\n");
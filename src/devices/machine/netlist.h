@@ -149,6 +149,8 @@ protected:
 private:
 
 	void common_dev_start(netlist::netlist_state_t *lnetlist) const;
+	std::string solver_cache_name() const;
+	void update_solver_cache(const std::string &name, const std::string &loaded_hash);
 
 	std::unique_ptr<netlist_mame_t> m_netlist;
 
@@ -19,7 +19,7 @@ DEFINE_DEVICE_TYPE(NSCSI_CONNECTOR, nscsi_connector,  "nscsi_connector", "SCSI C
 
 
 nscsi_bus_device::nscsi_bus_device(const machine_config &mconfig, const char *tag, device_t *owner, uint32_t clock) :
-	device_t(mconfig, NSCSI_BUS, tag, owner, clock), data(0), ctrl(0)
+	device_t(mconfig, NSCSI_BUS, tag, owner, clock), data(0), ctrl(0), block_transfer(true)
 {
 	devcnt = 0;
 	std::fill(std::begin(dev), std::end(dev), dev_t{ nullptr, 0, 0, 0 });
@@ -118,6 +118,30 @@ void nscsi_bus_device::data_w(int refid, uint32_t lines)
 	regen_data();
 }
 
+nscsi_device *nscsi_bus_device::block_target(int refid, uint32_t phase) const
+{
+	// REQ must be up in the expected data phase, and ACK must not be
+	uint32_t const busy = nscsi_device::S_REQ|nscsi_device::S_ACK|nscsi_device::S_SEL|nscsi_device::S_RST;
+	if(!block_transfer || (ctrl & busy) != nscsi_device::S_REQ || (ctrl & nscsi_device::S_PHASE_MASK) != phase)
+		return nullptr;
+	for(int i=0; i<devcnt; i++)
+		if(i != refid && (dev[i].ctrl & nscsi_device::S_REQ))
+			return dev[i].dev;
+	return nullptr;
+}
+
+int nscsi_bus_device::data_block_in(int refid, uint8_t *buf, int length)
+{
+	nscsi_device *target = length > 0 ? block_target(refid, nscsi_device::S_PHASE_DATA_IN) : nullptr;
+	return target ? target->scsi_data_block_in(buf, length) : 0;
+}
+
+int nscsi_bus_device::data_block_out(int refid, const uint8_t *buf, int length)
+{
+	nscsi_device *target = length > 0 ? block_target(refid, nscsi_device::S_PHASE_DATA_OUT) : nullptr;
+	return target ? target->scsi_data_block_out(buf, length) : 0;
+}
+
 void nscsi_bus_device::ctrl_wait(int refid, uint32_t lines, uint32_t mask)
 {
 	uint32_t w = dev[refid].wait_ctrl;
@@ -185,6 +209,16 @@ void nscsi_device::scsi_ctrl_changed()
 {
 }
 
+int nscsi_device::scsi_data_block_in(uint8_t *buf, int length)
+{
+	return 0;
+}
+
+int nscsi_device::scsi_data_block_out(const uint8_t *buf, int length)
+{
+	return 0;
+}
+
 void nscsi_device::device_start()
 {
 	save_item(NAME(scsi_id));
@@ -503,6 +537,47 @@ void nscsi_full_device::target_send_byte(uint8_t val)
 	step(false);
 }
 
+int nscsi_full_device::scsi_data_block_in(uint8_t *buf, int length)
+{
+	// the first byte is the one already on the bus
+	if(scsi_state != (TARGET_WAIT_DATA_IN_BYTE | (SEND_BYTE_T_WAIT_ACK_1 << SUB_SHIFT)) &&
+		scsi_state != (TARGET_NEXT_CONTROL | (SEND_BYTE_T_WAIT_ACK_1 << SUB_SHIFT)))
+		return 0;
+
+	int count = std::min(length, data_buffer_size - data_buffer_pos + 1);
+	buf[0] = scsi_bus->data_r();
+	for(int i=1; i<count; i++)
+		buf[i] = scsi_get_data(data_buffer_id, data_buffer_pos++);
+
+	scsi_bus->data_w(scsi_refid, 0);
+	target_block_done(count);
+	return count;
+}
+
+int nscsi_full_device::scsi_data_block_out(const uint8_t *buf, int length)
+{
+	if(scsi_state != (TARGET_WAIT_DATA_OUT_BYTE | (RECV_BYTE_T_WAIT_ACK_1 << SUB_SHIFT)) &&
+		scsi_state != (TARGET_NEXT_CONTROL | (RECV_BYTE_T_WAIT_ACK_1 << SUB_SHIFT)))
+		return 0;
+
+	int count = std::min(length, data_buffer_size - data_buffer_pos);
+	for(int i=0; i<count; i++)
+		scsi_put_data(data_buffer_id, data_buffer_pos++, buf[i]);
+
+	target_block_done(count);
+	return count;
+}
+
+void nscsi_full_device::target_block_done(int count)
+{
+	// leave things as the last handshake would have, then take the
+	// time the whole run would have taken before asserting REQ again
+	scsi_state = data_buffer_pos == data_buffer_size ? TARGET_NEXT_CONTROL : scsi_state & STATE_MASK;
+	scsi_bus->ctrl_wait(scsi_refid, 0, S_ACK);
+	scsi_bus->ctrl_w(scsi_refid, 0, S_REQ);
+	scsi_timer->adjust(scsi_data_byte_period() * count, false);
+}
+
 uint8_t nscsi_full_device::scsi_get_data(int id, int pos)
 {
 	switch(id) {
@@ -21,6 +21,16 @@ public:
 	uint32_t ctrl_r() const;
 	uint32_t data_r() const;
 
+	// Transaction-level data phase transfers.  When the target
+	// currently asserting REQ supports it, an initiator may move a run
+	// of bytes in one call instead of handshaking each of them.  The
+	// return value is the number of bytes moved, 0 meaning the caller
+	// must fall back to REQ/ACK.  Afterwards the target has dropped
+	// REQ and raises it again once the run's aggregate time is up.
+	void set_block_transfer(bool enable) { block_transfer = enable; }
+	int data_block_in(int refid, uint8_t *buf, int length);
+	int data_block_out(int refid, const uint8_t *buf, int length);
+
 protected:
 	virtual void device_start() override;
 	virtual void device_reset() override;
@@ -37,7 +47,9 @@ private:
 	int devcnt;
 
 	uint32_t data, ctrl;
+	bool block_transfer;
 
+	nscsi_device *block_target(int refid, uint32_t phase) const;
 	void regen_data();
 	void regen_ctrl(int refid);
 };
@@ -130,6 +142,10 @@ public:
 	void connect_to_bus(nscsi_bus_device *bus, int refid, int default_scsi_id);
 	virtual void scsi_ctrl_changed();
 
+	// target side of the transaction-level data transfers, see nscsi_bus_device
+	virtual int scsi_data_block_in(uint8_t *buf, int length);
+	virtual int scsi_data_block_out(const uint8_t *buf, int length);
+
 protected:
 	nscsi_device(const machine_config &mconfig, device_type type, const char *tag, device_t *owner, uint32_t clock);
 
@@ -145,6 +161,9 @@ class nscsi_full_device : public nscsi_device, public nscsi_slot_card_interface
 public:
 	virtual void scsi_ctrl_changed() override;
 
+	virtual int scsi_data_block_in(uint8_t *buf, int length) override;
+	virtual int scsi_data_block_out(const uint8_t *buf, int length) override;
+
 protected:
 	// SCSI status returns
 	enum {
@@ -501,6 +520,7 @@ private:
 	void target_recv_byte();
 	void target_send_byte(uint8_t val);
 	void target_send_buffer_byte();
+	void target_block_done(int count);
 };
 
 
@@ -87,6 +87,7 @@ pci_device::pci_device(const machine_config &mconfig, device_type type, const ch
 		bank_infos[i].adr = -1;
 		bank_infos[i].size = 0;
 		bank_infos[i].flags = 0;
+		bank_infos[i].decoded = UNKNOWN_DECODE;
 		bank_reg_infos[i].bank = -1;
 		bank_reg_infos[i].hi = 0;
 	}
@@ -115,6 +116,9 @@ void pci_device::device_start()
 	bank_count = 0;
 	bank_reg_count = 0;
 
+	m_remap_timer = timer_alloc(FUNC(pci_device::deferred_remap), this);
+	m_expansion_rom_decoded = UNKNOWN_DECODE;
+
 	save_item(STRUCT_MEMBER(bank_infos, adr));
 	save_item(NAME(command));
 	save_item(NAME(command_mask));
@@ -176,7 +180,7 @@ void pci_device::address_base_w(offs_t offset, uint32_t data)
 	else {
 		bank_infos[bid].adr = (bank_infos[bid].adr & 0xffffffff00000000U) | data;
 	}
-	remap_cb();
+	bank_changed();
 }
 
 uint16_t pci_device::vendor_r()
@@ -203,6 +207,11 @@ void pci_device::command_w(offs_t offset, uint16_t data, uint16_t mem_mask)
 	logerror("command = %04x\n", command);
 	if ((old ^ command) & 3)
 		remap_cb();
+	else if (m_remap_timer->enabled()) {
+		// decoding is being (re)confirmed, so stop holding back
+		m_remap_timer->enable(false);
+		deferred_remap(0);
+	}
 }
 
 uint16_t pci_device::status_r()
@@ -265,7 +274,8 @@ void pci_device::expansion_base_w(offs_t offset, uint32_t data, uint32_t mem_mas
 		// Trick to get an address resolution at expansion_rom_size with minimal granularity of 0x800, plus bit 1 set to keep the on/off information
 		expansion_rom_base &= 0xfffff801 & (1-expansion_rom_size);
 	}
-	remap_cb();
+	if(m_expansion_rom_decoded != ((expansion_rom_base & 1) ? expansion_rom_base & ~1 : NOT_DECODED))
+		remap_cb();
 }
 
 // if non-zero a CAPability PoinTeR marks an offset in PCI config space where a standard extension is located
@@ -317,25 +327,63 @@ void pci_device::reset_all_mappings()
 {
 }
 
+uint64_t pci_device::bank_decode(const bank_info &bi) const
+{
+	// this must follow the tests in map_device
+	if(uint32_t(bi.adr) >= 0xfffffffc)
+		return NOT_DECODED;
+	if(~command & ((bi.flags & M_IO) ? 1 : 2))
+		return NOT_DECODED;
+	if(!bi.size || (bi.flags & M_DISABLED))
+		return NOT_DECODED;
+	return bi.adr & ~(bi.size - 1);
+}
+
+void pci_device::bank_changed()
+{
+	bool sizing = false;
+	for(int i=0; i<bank_count; i++) {
+		bank_info const &bi = bank_infos[i];
+		uint64_t const decode = bank_decode(bi);
+		if(decode == bi.decoded)
+			continue;
+		if(decode != NOT_DECODED || bi.decoded == UNKNOWN_DECODE || uint32_t(bi.adr) < 0xfffffffc) {
+			m_remap_timer->enable(false);
+			remap_cb();
+			return;
+		}
+		sizing = true;
+	}
+
+	// a BAR that's all ones is being sized, and will usually be
+	// written back right away - if not, take it away shortly
+	if(sizing)
+		m_remap_timer->adjust(attotime::from_usec(100));
+	else
+		m_remap_timer->enable(false);
+}
+
+TIMER_CALLBACK_MEMBER(pci_device::deferred_remap)
+{
+	for(int i=0; i<bank_count; i++)
+		if(bank_decode(bank_infos[i]) != bank_infos[i].decoded) {
+			remap_cb();
+			return;
+		}
+}
+
 void pci_device::map_device(uint64_t memory_window_start, uint64_t memory_window_end, uint64_t memory_offset, address_space *memory_space,
 							uint64_t io_window_start, uint64_t io_window_end, uint64_t io_offset, address_space *io_space)
 {
+	m_expansion_rom_decoded = (expansion_rom_base & 1) ? expansion_rom_base & ~1 : NOT_DECODED;
 	for(int i=0; i<bank_count; i++) {
 		bank_info &bi = bank_infos[i];
-		if(uint32_t(bi.adr) >= 0xfffffffc)
-			continue;
-		if (bi.flags & M_IO) {
-			if (~command & 1)
-				continue;
-		} else {
-			if (~command & 2)
-				continue;
-		}
-		if(!bi.size || (bi.flags & M_DISABLED))
+		bi.decoded = bank_decode(bi);
+		if(bi.decoded == NOT_DECODED)
 			continue;
 
 		address_space *space;
-		uint64_t start = bi.adr & ~(bi.size - 1);
+		uint64_t start = bi.decoded;
 
 		if(bi.flags & M_IO) {
 			space = io_space;
@@ -397,6 +445,7 @@ void pci_device::add_map(uint64_t size, int flags, const address_map_constructor
 	bank_infos[bid].adr = 0;
 	bank_infos[bid].size = size;
 	bank_infos[bid].flags = flags;
+	bank_infos[bid].decoded = UNKNOWN_DECODE;
 
 	if(flags & M_64A) {
 		assert(bank_reg_count < 5);
@@ -92,6 +92,7 @@ protected:
 		uint64_t adr;
 		uint32_t size;
 		int flags;
+		uint64_t decoded;  // what map_device last installed, see bank_decode
 	};
 
 	struct bank_reg_info {
@@ -132,6 +133,20 @@ protected:
 	void set_map_address(int id, uint64_t adr);
 	void set_map_size(int id, uint64_t size);
 	void set_map_flags(int id, int flags);
+
+private:
+	// BAR changes that don't move anything are dropped, and ones that
+	// only take a BAR away while it's being sized are held back briefly
+	// in case the old value is written straight back
+	static constexpr uint64_t NOT_DECODED = ~uint64_t(0);
+	static constexpr uint64_t UNKNOWN_DECODE = ~uint64_t(1);
+
+	emu_timer *m_remap_timer;
+	uint64_t m_expansion_rom_decoded;
+
+	uint64_t bank_decode(const bank_info &bi) const;
+	void bank_changed();
+	TIMER_CALLBACK_MEMBER(deferred_remap);
 };
 
 class agp_device : public pci_device {
@@ -923,6 +923,7 @@ void aica_device::w16(u32 addr,u16 val)
 		else if (addr < 0x3c00)
 		{
 			*((u16 *)(m_DSP.MPRO+(addr - 0x3400) / 2)) = val;
+			m_DSP.Dirty = true;
 
 			if (addr == 0x3bfe)
 			{
@@ -1485,6 +1486,8 @@ void aica_device::device_post_load()
 {
 	for (int slot = 0; slot < 64; slot++)
 		Compute_LFO(&m_Slots[slot]);
+
+	m_DSP.Dirty = true;
 }
 
 //-------------------------------------------------
@@ -58,6 +58,42 @@ void AICADSP::init()
 	Stopped = true;
 }
 
+void AICADSP::decode()
+{
+	for (int step = 0; step < 128; ++step)
+	{
+		u16 const *const IPtr = MPRO + (step * 8);
+		STEP &op = Program[step];
+
+		op.TRA   = (IPtr[0] >>  9) & 0x7F;
+		op.TWT   = (IPtr[0] >>  8) & 0x01;
+		op.TWA   = (IPtr[0] >>  1) & 0x7F;
+		op.XSEL  = (IPtr[2] >> 15) & 0x01;
+		op.YSEL  = (IPtr[2] >> 13) & 0x03;
+		op.IRA   = (IPtr[2] >>  7) & 0x3F;
+		op.IWT   = (IPtr[2] >>  6) & 0x01;
+		op.IWA   = (IPtr[2] >>  1) & 0x1F;
+		op.TABLE = (IPtr[4] >> 15) & 0x01;
+		op.MWT   = ((IPtr[4] >> 14) & 0x01) & (step & 1); // memory is only accessed on odd steps
+		op.MRD   = ((IPtr[4] >> 13) & 0x01) & (step & 1); // memory is only accessed on odd steps
+		op.EWT   = (IPtr[4] >> 12) & 0x01;
+		op.EWA   = (IPtr[4] >>  8) & 0x0F;
+		op.ADRL  = (IPtr[4] >>  7) & 0x01;
+		op.FRCL  = (IPtr[4] >>  6) & 0x01;
+		op.SHIFT = (IPtr[4] >>  4) & 0x03;
+		op.YRL   = (IPtr[4] >>  3) & 0x01;
+		op.NEGB  = (IPtr[4] >>  2) & 0x01;
+		op.ZERO  = (IPtr[4] >>  1) & 0x01;
+		op.BSEL  = (IPtr[4] >>  0) & 0x01;
+		op.NOFL  = (IPtr[6] >> 15) & 1;
+		op.COEF  = step;
+		op.MASA  = (IPtr[6] >>  9) & 0x1f;
+		op.ADREB = (IPtr[6] >>  8) & 0x1;
+		op.NXADR = (IPtr[6] >>  7) & 0x1;
+	}
+	Dirty = false;
+}
+
 void AICADSP::step()
 {
 	s32 ACC=0;    //26 bit
@@ -69,6 +105,9 @@ void AICADSP::step()
 	if (Stopped)
 		return;
 
+	if (Dirty)
+		decode();
+
 	std::fill(std::begin(EFREG), std::end(EFREG), 0);
 #if 0
 	int dump=0;
@@ -78,46 +117,13 @@ void AICADSP::step()
 #endif
 	for (int step = 0; step < /*128*/LastStep; ++step)
 	{
-		u16 *IPtr=MPRO+step*8;
-
-//      if (IPtr[0]==0 && IPtr[1]==0 && IPtr[2]==0 && IPtr[3]==0)
-//          break;
-
-		const u32 TRA   = (IPtr[0] >>  9) & 0x7F;
-		const u32 TWT   = (IPtr[0] >>  8) & 0x01;
-		const u32 TWA   = (IPtr[0] >>  1) & 0x7F;
-
-		const u32 XSEL  = (IPtr[2] >> 15) & 0x01;
-		const u32 YSEL  = (IPtr[2] >> 13) & 0x03;
-		const u32 IRA   = (IPtr[2] >>  7) & 0x3F;
-		const u32 IWT   = (IPtr[2] >>  6) & 0x01;
-		const u32 IWA   = (IPtr[2] >>  1) & 0x1F;
-
-		const u32 TABLE = (IPtr[4] >> 15) & 0x01;
-		const u32 MWT   = (IPtr[4] >> 14) & 0x01;
-		const u32 MRD   = (IPtr[4] >> 13) & 0x01;
-		const u32 EWT   = (IPtr[4] >> 12) & 0x01;
-		const u32 EWA   = (IPtr[4] >>  8) & 0x0F;
-		const u32 ADRL  = (IPtr[4] >>  7) & 0x01;
-		const u32 FRCL  = (IPtr[4] >>  6) & 0x01;
-		const u32 SHIFT = (IPtr[4] >>  4) & 0x03;
-		const u32 YRL   = (IPtr[4] >>  3) & 0x01;
-		const u32 NEGB  = (IPtr[4] >>  2) & 0x01;
-		const u32 ZERO  = (IPtr[4] >>  1) & 0x01;
-		const u32 BSEL  = (IPtr[4] >>  0) & 0x01;
-
-		const u32 NOFL  = (IPtr[6] >> 15) & 1;        //????
-		const u32 COEF  = step;
-
-		const u32 MASA  = (IPtr[6] >>  9) & 0x1f;  //???
-		const u32 ADREB = (IPtr[6] >>  8) & 0x1;
-		const u32 NXADR = (IPtr[6] >>  7) & 0x1;
+		STEP const &op = Program[step];
 
 		//operations are done at 24 bit precision
 #if 0
-		if (MASA)
+		if (op.MASA)
 			int a=1;
-		if (NOFL)
+		if (op.NOFL)
 			int a=1;
 
 //      int dump=0;
@@ -142,43 +148,43 @@ void AICADSP::step()
 		}
 #endif
 		//INPUTS RW
-		assert(IRA<0x32);
+		assert(op.IRA<0x32);
 		s32 INPUTS=0; //24 bit
-		if (IRA <= 0x1f)
-			INPUTS = MEMS[IRA];
-		else if (IRA <= 0x2F)
-			INPUTS = MIXS[IRA - 0x20] << 4;  //MIXS is 20 bit
-		else if (IRA <= 0x31)
-			INPUTS = EXTS[IRA - 0x30] << 8;  //EXTS is 16 bit
+		if (op.IRA <= 0x1f)
+			INPUTS = MEMS[op.IRA];
+		else if (op.IRA <= 0x2F)
+			INPUTS = MIXS[op.IRA - 0x20] << 4;  //MIXS is 20 bit
+		else if (op.IRA <= 0x31)
+			INPUTS = EXTS[op.IRA - 0x30] << 8;  //EXTS is 16 bit
 
 		INPUTS <<= 8;
 		INPUTS >>= 8;
 		//if (INPUTS & 0x00800000)
 		//  INPUTS |= 0xFF000000;
 
-		if (IWT)
+		if (op.IWT)
 		{
-			MEMS[IWA] = MEMVAL;  //MEMVAL was selected in previous MRD
-			if (IRA == IWA)
+			MEMS[op.IWA] = MEMVAL;  //MEMVAL was selected in previous MRD
+			if (op.IRA == op.IWA)
 				INPUTS = MEMVAL;
 		}
 
 		//Operand sel
 		//B
 		s32 B;  //26 bit
-		if (!ZERO)
+		if (!op.ZERO)
 		{
-			if (BSEL)
+			if (op.BSEL)
 				B = ACC;
 			else
 			{
-				B = TEMP[(TRA + DEC) & 0x7F];
+				B = TEMP[(op.TRA + DEC) & 0x7F];
 				B <<= 8;
 				B >>= 8;
 				//if (B & 0x00800000)
 				//  B |= 0xFF000000;  //Sign extend
 			}
-			if (NEGB)
+			if (op.NEGB)
 				B = 0 - B;
 		}
 		else
@@ -186,11 +192,11 @@ void AICADSP::step()
 
 		//X
 		s32 X;  //24 bit
-		if (XSEL)
+		if (op.XSEL)
 			X = INPUTS;
 		else
 		{
-			X = TEMP[(TRA + DEC) & 0x7F];
+			X = TEMP[(op.TRA + DEC) & 0x7F];
 			X <<= 8;
 			X >>= 8;
 			//if (X & 0x00800000)
@@ -199,25 +205,25 @@ void AICADSP::step()
 
 		//Y
 		s32 Y = 0;  //13 bit
-		if (YSEL == 0)
+		if (op.YSEL == 0)
 			Y = FRC_REG;
-		else if (YSEL == 1)
-			Y = this->COEF[COEF << 1] >> 3;    //COEF is 16 bits
-		else if (YSEL == 2)
+		else if (op.YSEL == 1)
+			Y = this->COEF[op.COEF << 1] >> 3;    //COEF is 16 bits
+		else if (op.YSEL == 2)
 			Y = (Y_REG >> 11) & 0x1FFF;
-		else if (YSEL == 3)
+		else if (op.YSEL == 3)
 			Y = (Y_REG >> 4) & 0x0FFF;
 
-		if (YRL)
+		if (op.YRL)
 			Y_REG = INPUTS;
 
 		//Shifter
 		s32 SHIFTED = 0;    //24 bit
-		if (SHIFT == 0)
+		if (op.SHIFT == 0)
 			SHIFTED = std::clamp<s32>(ACC, -0x00800000, 0x007FFFFF);
-		else if (SHIFT == 1)
+		else if (op.SHIFT == 1)
 			SHIFTED = std::clamp<s32>(ACC * 2, -0x00800000, 0x007FFFFF);
-		else if (SHIFT == 2)
+		else if (op.SHIFT == 2)
 		{
 			SHIFTED = ACC * 2;
 			SHIFTED <<= 8;
@@ -226,7 +232,7 @@ void AICADSP::step()
 			//if (SHIFTED & 0x00800000)
 			//  SHIFTED |= 0xFF000000;
 		}
-		else if (SHIFT == 3)
+		else if (op.SHIFT == 3)
 		{
 			SHIFTED = ACC;
 			SHIFTED <<= 8;
@@ -245,29 +251,28 @@ void AICADSP::step()
 		const s64 v = (((s64)X * (s64)Y) >> 12);
 		ACC = (int)v + B;
 
-		if (TWT)
-			TEMP[(TWA + DEC) & 0x7F] = SHIFTED;
+		if (op.TWT)
+			TEMP[(op.TWA + DEC) & 0x7F] = SHIFTED;
 
-		if (FRCL)
+		if (op.FRCL)
 		{
-			if (SHIFT == 3)
+			if (op.SHIFT == 3)
 				FRC_REG = SHIFTED & 0x0FFF;
 			else
 				FRC_REG = (SHIFTED >> 11) & 0x1FFF;
 		}
 
 		u32 ADDR;
-		if (MRD || MWT)
-		//if (0)
+		if (op.MRD || op.MWT) // only on odd steps, checked when decoding
 		{
-			ADDR = MADRS[MASA << 1];
-			if (!TABLE)
+			ADDR = MADRS[op.MASA << 1];
+			if (!op.TABLE)
 				ADDR += DEC;
-			if (ADREB)
+			if (op.ADREB)
 				ADDR += ADRS_REG & 0x0FFF;
-			if (NXADR)
+			if (op.NXADR)
 				ADDR++;
-			if (!TABLE)
+			if (!op.TABLE)
 				ADDR &= RBL - 1;
 			else
 				ADDR &= 0xFFFF;
@@ -275,32 +280,32 @@ void AICADSP::step()
 			//ADDR += RBP << 13;
 			//MEMVAL = space.read_word(ADDR >> 1);
 			ADDR += RBP << 10;
-			if (MRD && (step & 1)) //memory only allowed on odd? DoA inserts NOPs on even
+			if (op.MRD) //memory only allowed on odd? DoA inserts NOPs on even
 			{
-				if (NOFL)
+				if (op.NOFL)
 					MEMVAL = cache.read_word(ADDR) << 8;
 				else
 					MEMVAL = UNPACK(cache.read_word(ADDR));
 			}
-			if (MWT && (step&1))
+			if (op.MWT)
 			{
-				if (NOFL)
+				if (op.NOFL)
 					space.write_word(ADDR, SHIFTED>>8);
 				else
 					space.write_word(ADDR, PACK(SHIFTED));
 			}
 		}
 
-		if (ADRL)
+		if (op.ADRL)
 		{
-			if (SHIFT == 3)
+			if (op.SHIFT == 3)
 				ADRS_REG = (SHIFTED >> 12) & 0xFFF;
 			else
 				ADRS_REG = (INPUTS >> 16);
 		}
 
-		if (EWT)
-			EFREG[EWA] += SHIFTED >> 8;
+		if (op.EWT)
+			EFREG[op.EWA] += SHIFTED >> 8;
 
 	}
 	--DEC;
@@ -321,6 +326,7 @@ void AICADSP::start()
 {
 	int i;
 	Stopped = false;
+	Dirty = true;
 	for (i = 127; i >= 0; --i)
 	{
 		u16 *IPtr = MPRO + i * 8;
@@ -12,6 +12,7 @@ struct AICADSP
 	void setsample(s32 sample, u8 SEL, s32 MXL);
 	void step();
 	void start();
+	void decode();
 
 //Config
 	memory_access<23, 1, 0, ENDIANNESS_LITTLE>::cache cache;
@@ -37,6 +38,17 @@ struct AICADSP
 
 	bool Stopped;
 	int LastStep;
+
+//decoded program, rebuilt from MPRO after it has been written
+	struct STEP
+	{
+		u8 TRA, TWT, TWA;
+		u8 XSEL, YSEL, IRA, IWT, IWA;
+		u8 TABLE, MWT, MRD, EWT, EWA, ADRL, FRCL, SHIFT, YRL, NEGB, ZERO, BSEL;
+		u8 NOFL, COEF, MASA, ADREB, NXADR;
+	};
+	STEP Program[128];
+	bool Dirty;
 };
 
 #endif // MAME_SOUND_AICADSP_H
@@ -579,6 +579,8 @@ be induced by cutoff currents from the 15 FETs.
 #include "emu.h"
 #include "ay8910.h"
 
+#include <limits>
+
 #define LOG_IGNORED_WRITES (1U << 1)
 #define LOG_WARNINGS       (1U << 2)
 #define VERBOSE (LOG_WARNINGS)
@@ -594,6 +596,9 @@ be induced by cutoff currents from the 15 FETs.
 
 static constexpr stream_buffer::sample_t MAX_OUTPUT = 1.0;
 
+// register writes queued before forcing a stream update anyway
+static constexpr size_t MAX_PENDING_WRITES = 1024;
+
 
 /*************************************
  *
@@ -1052,6 +1057,40 @@ void ay8910_device::ay8910_write_reg(int r, int v)
 	}
 }
 
+//-------------------------------------------------
+//  apply_pending_writes - apply the oldest queued
+//  register writes
+//-------------------------------------------------
+
+void ay8910_device::apply_pending_writes(u32 count)
+{
+	for ( ; count && (m_pending_head < m_pending_writes.size()); count--)
+	{
+		pending_write const &write = m_pending_writes[m_pending_head++];
+		ay8910_write_reg(write.reg, write.data);
+	}
+
+	if (m_pending_head == m_pending_writes.size())
+	{
+		m_pending_writes.clear();
+		m_pending_head = 0;
+	}
+}
+
+//-------------------------------------------------
+//  flush_pending_writes - bring the stream up to
+//  date and apply every queued register write
+//-------------------------------------------------
+
+void ay8910_device::flush_pending_writes()
+{
+	if (m_pending_head < m_pending_writes.size())
+	{
+		m_channel->update();
+		apply_pending_writes(m_pending_writes.size() - m_pending_head);
+	}
+}
+
 //-------------------------------------------------
 //  sound_stream_update - handle a stream update
 //-------------------------------------------------
@@ -1063,6 +1102,24 @@ void ay8910_device::sound_stream_update(sound_stream &stream, std::vector<read_s
 
 	int samples = outputs[0].samples();
 
+	// queued register writes take effect on the first sample at or after the time they were made
+	attotime const start = outputs[0].start_time();
+	attoseconds_t const period = outputs[0].sample_period_attoseconds();
+	auto const write_sample =
+		[this, &start, period] () -> s64
+		{
+			if (m_pending_head >= m_pending_writes.size())
+				return std::numeric_limits<s64>::max();
+			attotime const &time = m_pending_writes[m_pending_head].time;
+			if (time <= start)
+				return 0;
+			attotime const delta = time - start;
+			if (delta.seconds())
+				return std::numeric_limits<s64>::max() - 1;
+			return (delta.attoseconds() + period - 1) / period;
+		};
+	s64 next_write = write_sample();
+
 	// hack to prevent us from hanging when starting filtered outputs
 	if (!m_ready)
 	{
@@ -1080,6 +1137,12 @@ void ay8910_device::sound_stream_update(sound_stream &stream, std::vector<read_s
 	// buffering loop
 	for (int sampindex = 0; sampindex < samples; sampindex++)
 	{
+		while (next_write <= sampindex)
+		{
+			apply_pending_writes(1);
+			next_write = write_sample();
+		}
+
 		for (int chan = 0; chan < NUM_CHANNELS; chan++)
 		{
 			tone = &m_tone[chan];
@@ -1207,6 +1270,13 @@ void ay8910_device::sound_stream_update(sound_stream &stream, std::vector<read_s
 			outputs[0].put(sampindex, mix_3D());
 		}
 	}
+
+	// writes made exactly at the end of the update belong before the next sample
+	while (next_write <= samples)
+	{
+		apply_pending_writes(1);
+		next_write = write_sample();
+	}
 }
 
 void ay8910_device::build_mixer_table()
@@ -1378,13 +1448,23 @@ void ay8910_device::ay8910_write_ym(int addr, u8 data)
 		{
 			const u8 register_latch = m_register_latch + get_register_bank();
 			// Data port
-			if (m_register_latch == AY_EASHAPE || m_regs[register_latch] != data)
+			if ((register_latch < AY_EASHAPE) && (register_latch != AY_ENABLE) && (m_channel->sample_rate() >= SAMPLE_RATE_MINIMUM) && (m_pending_writes.size() < MAX_PENDING_WRITES))
 			{
-				// update the output buffer before changing the register
-				m_channel->update();
+				// tone, noise and envelope settings only affect the output, so let the stream apply them when it gets there
+				m_pending_writes.push_back(pending_write{ machine().time(), register_latch, data });
 			}
+			else
+			{
+				// the mixer, envelope shape and ports have side effects, so catch up first
+				flush_pending_writes();
+				if (m_register_latch == AY_EASHAPE || m_regs[register_latch] != data)
+				{
+					// update the output buffer before changing the register
+					m_channel->update();
+				}
 
-			ay8910_write_reg(register_latch, data);
+				ay8910_write_reg(register_latch, data);
+			}
 		}
 	}
 	else
@@ -1415,6 +1495,9 @@ u8 ay8910_device::ay8910_read_ym()
 	// There are no state dependent register in the AY8910!
 	// m_channel->update();
 
+	// queued writes must land before the registers are read back
+	flush_pending_writes();
+
 	switch (r)
 	{
 	case AY_PORTA:
@@ -1481,10 +1564,34 @@ u8 ay8910_device::ay8910_read_ym()
 
 void ay8910_device::device_reset()
 {
+	flush_pending_writes();
 	ay8910_reset_ym();
 }
 
 
+//-------------------------------------------------
+//  device_pre_save - apply queued writes so the
+//  saved registers are current
+//-------------------------------------------------
+
+void ay8910_device::device_pre_save()
+{
+	flush_pending_writes();
+}
+
+
+//-------------------------------------------------
+//  device_post_load - drop writes queued before
+//  the state was loaded
+//-------------------------------------------------
+
+void ay8910_device::device_post_load()
+{
+	m_pending_writes.clear();
+	m_pending_head = 0;
+}
+
+
 /*************************************
  *
  * Read/Write Handlers
@@ -1582,6 +1689,7 @@ ay8910_device::ay8910_device(const machine_config &mconfig, device_type type, co
 	m_channel(nullptr),
 	m_active(false),
 	m_register_latch(0),
+	m_pending_head(0),
 	m_last_enable(0),
 	m_prescale_noise(0),
 	m_noise_value(0),
@@ -138,6 +138,8 @@ protected:
 	virtual void device_start() override;
 	virtual void device_reset() override;
 	virtual void device_clock_changed() override;
+	virtual void device_pre_save() override;
+	virtual void device_post_load() override;
 
 	// sound stream update overrides
 	virtual void sound_stream_update(sound_stream &stream, std::vector<read_stream_view> const &inputs, std::vector<write_stream_view> &outputs) override;
@@ -218,6 +220,14 @@ private:
 		}
 	};
 
+	// a register write waiting for the stream to catch up
+	struct pending_write
+	{
+		attotime time;
+		u8 reg;
+		u8 data;
+	};
+
 	struct envelope_t
 	{
 		u32 period;
@@ -296,6 +306,8 @@ private:
 	void set_type(psg_type_t psg_type);
 	inline stream_buffer::sample_t mix_3D();
 	void ay8910_write_reg(int r, int v);
+	void apply_pending_writes(u32 count);
+	void flush_pending_writes();
 	void build_mixer_table();
 	void ay8910_statesave();
 
@@ -308,6 +320,8 @@ private:
 	bool m_active;
 	u8 m_register_latch;
 	u8 m_regs[16 * 2];
+	std::vector<pending_write> m_pending_writes;
+	u32 m_pending_head;
 	s16 m_last_enable;
 	tone_t m_tone[NUM_CHANNELS];
 	envelope_t m_envelope[NUM_CHANNELS];
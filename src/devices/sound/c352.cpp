@@ -18,6 +18,7 @@
 
 #include "emu.h"
 #include "c352.h"
+#include "voicemix.h"
 #include "wavwrite.h"
 
 //#define VERBOSE 1
@@ -123,61 +124,89 @@ void c352_device::ramp_volume(c352_voice_t &v, int ch, u8 val)
 		v.curr_vol[ch] += (vol_delta > 0) ? -1 : 1;
 }
 
-void c352_device::sound_stream_update(sound_stream &stream, std::vector<read_stream_view> const &inputs, std::vector<write_stream_view> &outputs)
-{
-	auto &buffer_fl = outputs[0];
-	auto &buffer_fr = outputs[1];
-	auto &buffer_rl = outputs[2];
-	auto &buffer_rr = outputs[3];
+//-------------------------------------------------
+//  render_voice - advance one busy voice through
+//  the current block and mix it into the outputs
+//-------------------------------------------------
 
-	for (int i = 0; i < buffer_fl.samples(); i++)
+void c352_device::render_voice(c352_voice_t &v, voice_mixer<4> &mixer)
+{
+	// phase inversion folds into the gain; note that rear right follows the front right flag
+	s32 const sign[4] = {
+			(v.flags & C352_FLG_PHASEFL) ? -1 : 1,
+			(v.flags & C352_FLG_PHASEFR) ? -1 : 1,
+			(v.flags & C352_FLG_PHASERL) ? -1 : 1,
+			(v.flags & C352_FLG_PHASEFR) ? -1 : 1 };
+	bool const interpolate = (v.flags & C352_FLG_FILTER) == 0;
+
+	s32 last[voice_mixer<4>::BLOCK], next[voice_mixer<4>::BLOCK], frac[voice_mixer<4>::BLOCK];
+	s32 gain[4][voice_mixer<4>::BLOCK];
+
+	// step the voice serially; it contributes nothing once it stops
+	int i;
+	for (i = 0; (i < mixer.samples()) && (v.flags & C352_FLG_BUSY); i++)
 	{
-		int out[4] = { 0, 0, 0, 0 };
+		s32 next_counter = v.counter + v.freq;
 
-		for (int j = 0; j < 32; j++)
+		if (next_counter & 0x10000)
 		{
-			c352_voice_t &v = m_c352_v[j];
-			s16 s = 0;
+			fetch_sample(v);
+		}
 
-			if (v.flags & C352_FLG_BUSY)
-			{
-				s32 next_counter = v.counter + v.freq;
+		if ((next_counter ^ v.counter) & 0x18000)
+		{
+			ramp_volume(v, 0, v.vol_f >> 8);
+			ramp_volume(v, 1, v.vol_f & 0xff);
+			ramp_volume(v, 2, v.vol_r >> 8);
+			ramp_volume(v, 3, v.vol_r & 0xff);
+		}
 
-				if (next_counter & 0x10000)
-				{
-					fetch_sample(v);
-				}
+		v.counter = next_counter & 0xffff;
 
-				if ((next_counter ^ v.counter) & 0x18000)
-				{
-					ramp_volume(v, 0, v.vol_f >> 8);
-					ramp_volume(v, 1, v.vol_f & 0xff);
-					ramp_volume(v, 2, v.vol_r >> 8);
-					ramp_volume(v, 3, v.vol_r & 0xff);
-				}
+		last[i] = v.last_sample;
+		next[i] = v.sample;
+		frac[i] = v.counter;
+		for (int ch = 0; ch < 4; ch++)
+			gain[ch][i] = sign[ch] * v.curr_vol[ch];
+	}
 
-				v.counter = next_counter & 0xffff;
+	// interpolate samples
+	s32 const *src = next;
+	if (interpolate)
+	{
+		voicemix::interpolate_linear(last, last, next, frac, 16, i);
+		src = last;
+	}
 
-				s = v.sample;
+	for (int ch = 0; ch < 4; ch++)
+		mixer.mix(ch, src, gain[ch], 8, i);
+}
 
-				// Interpolate samples
-				if ((v.flags & C352_FLG_FILTER) == 0)
-					s = v.last_sample + (v.counter * (v.sample - v.last_sample) >> 16);
-			}
+void c352_device::sound_stream_update(sound_stream &stream, std::vector<read_stream_view> const &inputs, std::vector<write_stream_view> &outputs)
+{
+	auto &buffer_fl = outputs[0];
+	auto &buffer_fr = outputs[1];
+	auto &buffer_rl = outputs[2];
+	auto &buffer_rr = outputs[3];
+
+	int const samples = buffer_fl.samples();
+	voice_mixer<4> mixer;
+	for (int base = 0; base < samples; base += mixer.BLOCK)
+	{
+		mixer.begin(std::min(samples - base, mixer.BLOCK));
 
-			// Left
-			out[0] += (((v.flags & C352_FLG_PHASEFL) ? -s : s) * v.curr_vol[0]) >> 8;
-			out[2] += (((v.flags & C352_FLG_PHASERL) ? -s : s) * v.curr_vol[2]) >> 8;
+		// idle voices output silence, so only busy ones need rendering
+		for (c352_voice_t &v : m_c352_v)
+			if (v.flags & C352_FLG_BUSY)
+				render_voice(v, mixer);
 
-			// Right
-			out[1] += (((v.flags & C352_FLG_PHASEFR) ? -s : s) * v.curr_vol[1]) >> 8;
-			out[3] += (((v.flags & C352_FLG_PHASEFR) ? -s : s) * v.curr_vol[3]) >> 8;
+		for (int i = 0; i < mixer.samples(); i++)
+		{
+			buffer_fl.put_int(base + i, s16(mixer.output(0)[i] >> 3), 32768);
+			buffer_fr.put_int(base + i, s16(mixer.output(1)[i] >> 3), 32768);
+			buffer_rl.put_int(base + i, s16(mixer.output(2)[i] >> 3), 32768);
+			buffer_rr.put_int(base + i, s16(mixer.output(3)[i] >> 3), 32768);
 		}
-
-		buffer_fl.put_int(i, s16(out[0] >> 3), 32768);
-		buffer_fr.put_int(i, s16(out[1] >> 3), 32768);
-		buffer_rl.put_int(i, s16(out[2] >> 3), 32768);
-		buffer_rr.put_int(i, s16(out[3] >> 3), 32768);
 	}
 }
 
@@ -11,6 +11,9 @@
 //  TYPE DEFINITIONS
 //**************************************************************************
 
+template <int Channels> class voice_mixer;
+
+
 // ======================> asc_device
 
 class c352_device : public device_t,
@@ -90,6 +93,7 @@ private:
 
 	void fetch_sample(c352_voice_t &v);
 	void ramp_volume(c352_voice_t &v, int ch, u8 val);
+	void render_voice(c352_voice_t &v, voice_mixer<4> &mixer);
 
 	sound_stream *m_stream;
 
@@ -201,12 +201,8 @@ void cdda_device::get_audio_data(write_stream_view &bufL, write_stream_view &buf
 				sectors = MAX_SECTORS;
 			}
 
-			for (i = 0; i < sectors; i++)
-			{
-				m_disc->read_data(m_audio_lba, &m_audio_cache[cdrom_file::MAX_SECTOR_DATA*i], cdrom_file::CD_TRACK_AUDIO);
-
-				m_audio_lba++;
-			}
+			m_disc->read_sectors(m_audio_lba, sectors, &m_audio_cache[0], cdrom_file::CD_TRACK_AUDIO);
+			m_audio_lba += sectors;
 
 			m_audio_samples = (cdrom_file::MAX_SECTOR_DATA*sectors)/4;
 			m_audio_length -= sectors;
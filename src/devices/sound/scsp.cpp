@@ -285,6 +285,8 @@ void scsp_device::device_post_load()
 	for (int slot = 0; slot < 32; slot++)
 		Compute_LFO(&m_Slots[slot]);
 
+	m_DSP.Dirty = true;
+
 	set_output_gain(0, MVOL() / 15.0);
 	set_output_gain(1, MVOL() / 15.0);
 }
@@ -980,6 +982,7 @@ void scsp_device::w16(u32 addr, u16 val)
 		else if (addr < 0xC00)
 		{
 			*((uint16_t *) (m_DSP.MPRO + (addr - 0x800) / 2)) = val;
+			m_DSP.Dirty = true;
 
 			if (addr == 0xBF0)
 			{
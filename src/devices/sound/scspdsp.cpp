@@ -63,6 +63,43 @@ void SCSPDSP::Init()
 	std::memset(this, 0, sizeof(*this));
 	RBL = (8*1024); // Initial RBL is 0
 	Stopped = true;
+	Dirty = true;
+}
+
+void SCSPDSP::Decode()
+{
+	for (int step = 0; step < 128; ++step)
+	{
+		u16 const *const IPtr = MPRO + (step * 4);
+		STEP &op = Program[step];
+
+		op.TRA   = (IPtr[0] >>  8) & 0x7F;
+		op.TWT   = (IPtr[0] >>  7) & 0x01;
+		op.TWA   = (IPtr[0] >>  0) & 0x7F;
+		op.XSEL  = (IPtr[1] >> 15) & 0x01;
+		op.YSEL  = (IPtr[1] >> 13) & 0x03;
+		op.IRA   = (IPtr[1] >>  6) & 0x3F;
+		op.IWT   = (IPtr[1] >>  5) & 0x01;
+		op.IWA   = (IPtr[1] >>  0) & 0x1F;
+		op.TABLE = (IPtr[2] >> 15) & 0x01;
+		op.MWT   = ((IPtr[2] >> 14) & 0x01) & (step & 1); // memory is only accessed on odd steps
+		op.MRD   = ((IPtr[2] >> 13) & 0x01) & (step & 1); // memory is only accessed on odd steps
+		op.EWT   = (IPtr[2] >> 12) & 0x01;
+		op.EWA   = (IPtr[2] >>  8) & 0x0F;
+		op.ADRL  = (IPtr[2] >>  7) & 0x01;
+		op.FRCL  = (IPtr[2] >>  6) & 0x01;
+		op.SHIFT = (IPtr[2] >>  4) & 0x03;
+		op.YRL   = (IPtr[2] >>  3) & 0x01;
+		op.NEGB  = (IPtr[2] >>  2) & 0x01;
+		op.ZERO  = (IPtr[2] >>  1) & 0x01;
+		op.BSEL  = (IPtr[2] >>  0) & 0x01;
+		op.NOFL  = (IPtr[3] >> 15) & 0x01;
+		op.COEF  = (IPtr[3] >>  9) & 0x3f;
+		op.MASA  = (IPtr[3] >>  2) & 0x1f;
+		op.ADREB = (IPtr[3] >>  1) & 0x01;
+		op.NXADR = (IPtr[3] >>  0) & 0x01;
+	}
+	Dirty = false;
 }
 
 void SCSPDSP::Step()
@@ -70,6 +107,9 @@ void SCSPDSP::Step()
 	if (Stopped)
 		return;
 
+	if (Dirty)
+		Decode();
+
 	std::fill(std::begin(EFREG), std::end(EFREG), 0);
 
 #if 0
@@ -87,46 +127,13 @@ void SCSPDSP::Step()
 
 	for (int step = 0; step < /*128*/LastStep; ++step)
 	{
-		u16 *const IPtr = MPRO + (step * 4);
-
-		//if (!IPtr[0] && !IPtr[1] && !IPtr[2] && !IPtr[3])
-			//break;
-
-		u32 const TRA   = (IPtr[0] >>  8) & 0x7F;
-		u32 const TWT   = (IPtr[0] >>  7) & 0x01;
-		u32 const TWA   = (IPtr[0] >>  0) & 0x7F;
-
-		u32 const XSEL  = (IPtr[1] >> 15) & 0x01;
-		u32 const YSEL  = (IPtr[1] >> 13) & 0x03;
-		u32 const IRA   = (IPtr[1] >>  6) & 0x3F;
-		u32 const IWT   = (IPtr[1] >>  5) & 0x01;
-		u32 const IWA   = (IPtr[1] >>  0) & 0x1F;
-
-		u32 const TABLE = (IPtr[2] >> 15) & 0x01;
-		u32 const MWT   = (IPtr[2] >> 14) & 0x01;
-		u32 const MRD   = (IPtr[2] >> 13) & 0x01;
-		u32 const EWT   = (IPtr[2] >> 12) & 0x01;
-		u32 const EWA   = (IPtr[2] >>  8) & 0x0F;
-		u32 const ADRL  = (IPtr[2] >>  7) & 0x01;
-		u32 const FRCL  = (IPtr[2] >>  6) & 0x01;
-		u32 const SHIFT = (IPtr[2] >>  4) & 0x03;
-		u32 const YRL   = (IPtr[2] >>  3) & 0x01;
-		u32 const NEGB  = (IPtr[2] >>  2) & 0x01;
-		u32 const ZERO  = (IPtr[2] >>  1) & 0x01;
-		u32 const BSEL  = (IPtr[2] >>  0) & 0x01;
-
-		u32 const NOFL  = (IPtr[3] >> 15) & 0x01;  //????
-		u32 const COEF  = (IPtr[3] >>  9) & 0x3f;
-
-		u32 const MASA  = (IPtr[3] >>  2) & 0x1f;  //???
-		u32 const ADREB = (IPtr[3] >>  1) & 0x01;
-		u32 const NXADR = (IPtr[3] >>  0) & 0x01;
+		STEP const &op = Program[step];
 
 		//operations are done at 24 bit precision
 #if 0
-		if (MASA)
+		if (op.MASA)
 			int a=1;
-		if (NOFL)
+		if (op.NOFL)
 			int a=1;
 
 		//int dump=0;
@@ -155,12 +162,12 @@ void SCSPDSP::Step()
 		// colmns97 hits this
 		//assert(IRA < 0x32);
 		s32 INPUTS; // 24-bit
-		if (IRA <= 0x1f)
-			INPUTS = MEMS[IRA];
-		else if (IRA <= 0x2F)
-			INPUTS = MIXS[IRA - 0x20] << 4;  //MIXS is 20 bit
-		else if (IRA <= 0x31)
-			INPUTS = EXTS[IRA - 0x30] << 8;  //EXTS is 16 bit
+		if (op.IRA <= 0x1f)
+			INPUTS = MEMS[op.IRA];
+		else if (op.IRA <= 0x2F)
+			INPUTS = MIXS[op.IRA - 0x20] << 4;  //MIXS is 20 bit
+		else if (op.IRA <= 0x31)
+			INPUTS = EXTS[op.IRA - 0x30] << 8;  //EXTS is 16 bit
 		else
 			return;
 
@@ -169,39 +176,39 @@ void SCSPDSP::Step()
 		//if(INPUTS & 0x00800000)
 			//INPUTS |= 0xFF000000;
 
-		if (IWT)
+		if (op.IWT)
 		{
-			MEMS[IWA] = MEMVAL;  // MEMVAL was selected in previous MRD
-			if (IRA == IWA)
+			MEMS[op.IWA] = MEMVAL;  // MEMVAL was selected in previous MRD
+			if (op.IRA == op.IWA)
 				INPUTS = MEMVAL;
 		}
 
 		//Operand sel
 		s32 B; // 26-bit
-		if (!ZERO)
+		if (!op.ZERO)
 		{
-			if (BSEL)
+			if (op.BSEL)
 				B = ACC;
 			else
 			{
-				B = TEMP[(TRA + DEC) & 0x7F];
+				B = TEMP[(op.TRA + DEC) & 0x7F];
 				B <<= 8;
 				B >>= 8;
 				//if (B & 0x00800000)
 					//B |= 0xFF000000;  //Sign extend
 			}
-			if (NEGB)
+			if (op.NEGB)
 				B = 0 - B;
 		}
 		else
 			B = 0;
 
 		s32 X; // 24-bit
-		if (XSEL)
+		if (op.XSEL)
 			X = INPUTS;
 		else
 		{
-			X = TEMP[(TRA + DEC) & 0x7F];
+			X = TEMP[(op.TRA + DEC) & 0x7F];
 			X <<= 8;
 			X >>= 8;
 			//if (X & 0x00800000)
@@ -209,25 +216,25 @@ void SCSPDSP::Step()
 		}
 
 		s32 Y = 0;  //13 bit
-		if (YSEL == 0)
+		if (op.YSEL == 0)
 			Y = FRC_REG;
-		else if (YSEL == 1)
-			Y = this->COEF[COEF] >> 3;   //COEF is 16 bits
-		else if (YSEL == 2)
+		else if (op.YSEL == 1)
+			Y = this->COEF[op.COEF] >> 3;   //COEF is 16 bits
+		else if (op.YSEL == 2)
 			Y = (Y_REG >> 11) & 0x1FFF;
-		else if (YSEL == 3)
+		else if (op.YSEL == 3)
 			Y = (Y_REG >> 4) & 0x0FFF;
 
-		if (YRL)
+		if (op.YRL)
 			Y_REG = INPUTS;
 
 		//Shifter
 		s32 SHIFTED = 0;    //24 bit
-		if (SHIFT == 0)
+		if (op.SHIFT == 0)
 			SHIFTED = std::clamp<s32>(ACC, -0x00800000, 0x007FFFFF);
-		else if (SHIFT == 1)
+		else if (op.SHIFT == 1)
 			SHIFTED = std::clamp<s32>(ACC * 2, -0x00800000, 0x007FFFFF);
-		else if (SHIFT == 2)
+		else if (op.SHIFT == 2)
 		{
 			SHIFTED = ACC * 2;
 			SHIFTED <<= 8;
@@ -236,7 +243,7 @@ void SCSPDSP::Step()
 			//if (SHIFTED & 0x00800000)
 				//SHIFTED |= 0xFF000000;
 		}
-		else if (SHIFT == 3)
+		else if (op.SHIFT == 3)
 		{
 			SHIFTED = ACC;
 			SHIFTED <<= 8;
@@ -255,59 +262,58 @@ void SCSPDSP::Step()
 		int64_t const v = (int64_t(X) * int64_t(Y)) >> 12;
 		ACC = int(v + B);
 
-		if (TWT)
-			TEMP[(TWA + DEC) & 0x7F] = SHIFTED;
+		if (op.TWT)
+			TEMP[(op.TWA + DEC) & 0x7F] = SHIFTED;
 
-		if (FRCL)
+		if (op.FRCL)
 		{
-			if (SHIFT == 3)
+			if (op.SHIFT == 3)
 				FRC_REG = SHIFTED & 0x0FFF;
 			else
 				FRC_REG = (SHIFTED >> 11) & 0x1FFF;
 		}
 
-		if (MRD || MWT)
-		//if (0)
+		if (op.MRD || op.MWT) // only on odd steps, checked when decoding
 		{
-			u32 ADDR = MADRS[MASA];
-			if (!TABLE)
+			u32 ADDR = MADRS[op.MASA];
+			if (!op.TABLE)
 				ADDR += DEC;
-			if (ADREB)
+			if (op.ADREB)
 				ADDR += ADRS_REG & 0x0FFF;
-			if (NXADR)
+			if (op.NXADR)
 				ADDR++;
-			if (!TABLE)
+			if (!op.TABLE)
 				ADDR &= RBL - 1;
 			else
 				ADDR &= 0xFFFF;
 			ADDR += RBP << 12;
 			ADDR <<= 1;
-			if (MRD && (step & 1)) //memory only allowed on odd? DoA inserts NOPs on even
+			if (op.MRD) //memory only allowed on odd? DoA inserts NOPs on even
 			{
-				if (NOFL)
+				if (op.NOFL)
 					MEMVAL = space->read_word(ADDR) << 8;
 				else
 					MEMVAL = UNPACK(space->read_word(ADDR));
 			}
-			if (MWT && (step & 1))
+			if (op.MWT)
 			{
-				if (NOFL)
+				if (op.NOFL)
 					space->write_word(ADDR, SHIFTED >> 8);
 				else
 					space->write_word(ADDR, PACK(SHIFTED));
 			}
 		}
 
-		if (ADRL)
+		if (op.ADRL)
 		{
-			if (SHIFT == 3)
+			if (op.SHIFT == 3)
 				ADRS_REG = (SHIFTED >> 12) & 0xFFF;
 			else
 				ADRS_REG = INPUTS >> 16;
 		}
 
-		if (EWT)
-			EFREG[EWA] += SHIFTED >> 8;
+		if (op.EWT)
+			EFREG[op.EWA] += SHIFTED >> 8;
 	}
 	--DEC;
 	std::fill(std::begin(MIXS), std::end(MIXS), 0);
@@ -326,6 +332,7 @@ void SCSPDSP::SetSample(s32 sample, int SEL, int MXL)
 void SCSPDSP::Start()
 {
 	Stopped = false;
+	Dirty = true;
 	int i;
 	for (i = 127; i >= 0; --i)
 	{
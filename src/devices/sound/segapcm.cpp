@@ -6,6 +6,7 @@
 
 #include "emu.h"
 #include "segapcm.h"
+#include "voicemix.h"
 
 #include <algorithm>
 
@@ -74,10 +75,6 @@ void segapcm_device::rom_bank_pre_change()
 
 void segapcm_device::sound_stream_update(sound_stream &stream, std::vector<read_stream_view> const &inputs, std::vector<write_stream_view> &outputs)
 {
-	/* clear the buffers */
-	outputs[0].fill(0);
-	outputs[1].fill(0);
-
 	// reg      function
 	// ------------------------------------------------
 	// 0x00     ?
@@ -99,49 +96,61 @@ void segapcm_device::sound_stream_update(sound_stream &stream, std::vector<read_
 	//          other bits: bank
 	// 0x87     ?
 
-	/* loop over channels */
-	for (int ch = 0; ch < 16; ch++)
+	/* mix in blocks; channel state lives in the registers between blocks */
+	int const samples = outputs[0].samples();
+	voice_mixer<2> mixer;
+	for (int base = 0; base < samples; base += mixer.BLOCK)
 	{
-		uint8_t *regs = m_ram.get()+8*ch;
+		mixer.begin(std::min(samples - base, mixer.BLOCK));
 
-		/* only process active channels */
-		if (!(regs[0x86]&1))
+		/* loop over channels */
+		for (int ch = 0; ch < 16; ch++)
 		{
-			int offset = (regs[0x86] & m_bankmask) << m_bankshift;
-			uint32_t addr = (regs[0x85] << 16) | (regs[0x84] << 8) | m_low[ch];
-			uint32_t loop = (regs[0x05] << 16) | (regs[0x04] << 8);
-			uint8_t end = regs[6] + 1;
-			int i;
-
-			/* loop over samples on this channel */
-			for (i = 0; i < outputs[0].samples(); i++)
-			{
-				int8_t v;
+			uint8_t *regs = m_ram.get()+8*ch;
 
-				/* handle looping if we've hit the end */
-				if ((addr >> 16) == end)
+			/* only process active channels */
+			if (!(regs[0x86]&1))
+			{
+				int offset = (regs[0x86] & m_bankmask) << m_bankshift;
+				uint32_t addr = (regs[0x85] << 16) | (regs[0x84] << 8) | m_low[ch];
+				uint32_t loop = (regs[0x05] << 16) | (regs[0x04] << 8);
+				uint8_t end = regs[6] + 1;
+				s32 buffer[voice_mixer<2>::BLOCK];
+				int i;
+
+				/* loop over samples on this channel */
+				for (i = 0; i < mixer.samples(); i++)
 				{
-					if (regs[0x86] & 2)
+					/* handle looping if we've hit the end */
+					if ((addr >> 16) == end)
 					{
-						regs[0x86] |= 1;
-						break;
+						if (regs[0x86] & 2)
+						{
+							regs[0x86] |= 1;
+							break;
+						}
+						else addr = loop;
 					}
-					else addr = loop;
+
+					/* fetch the sample and advance */
+					buffer[i] = int8_t(read_byte(offset + (addr >> 8)) - 0x80);
+					addr = (addr + regs[7]) & 0xffffff;
 				}
 
-				/* fetch the sample */
-				v = read_byte(offset + (addr >> 8)) - 0x80;
+				/* apply panning */
+				mixer.mix_pan(0, buffer, regs[2] & 0x7f, regs[3] & 0x7f, 0, i);
 
-				/* apply panning and advance */
-				outputs[0].add_int(i, v * (regs[2] & 0x7f), 32768);
-				outputs[1].add_int(i, v * (regs[3] & 0x7f), 32768);
-				addr = (addr + regs[7]) & 0xffffff;
+				/* store back the updated address */
+				regs[0x84] = addr >> 8;
+				regs[0x85] = addr >> 16;
+				m_low[ch] = regs[0x86] & 1 ? 0 : addr;
 			}
+		}
 
-			/* store back the updated address */
-			regs[0x84] = addr >> 8;
-			regs[0x85] = addr >> 16;
-			m_low[ch] = regs[0x86] & 1 ? 0 : addr;
+		for (int i = 0; i < mixer.samples(); i++)
+		{
+			outputs[0].put_int(base + i, mixer.output(0)[i], 32768);
+			outputs[1].put_int(base + i, mixer.output(1)[i], 32768);
 		}
 	}
 }
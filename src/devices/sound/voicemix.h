@@ -0,0 +1,197 @@
+// license:BSD-3-Clause
+// copyright-holders:Vas Crabb
+/***************************************************************************
+
+    voicemix.h
+
+    Block-based voice mixing helpers for PCM sample playback chips.
+
+    Chips with many voices traditionally step every voice once per
+    output sample, interleaving address generation, interpolation,
+    volume and panning for all of them in one loop.  The helpers here
+    let a chip render each voice for a block of samples instead: the
+    chip-specific adapter runs the serial part (sample fetch, looping,
+    envelope stepping) into small per-voice arrays, and the mixer does
+    the data-parallel part (interpolation, gain and accumulation into
+    each output) with SSE2 or NEON where available.
+
+    All arithmetic is 32-bit integer with the same wrapping and
+    arithmetic shift behaviour as the scalar expressions documented
+    on each function, so converting a chip does not change its output.
+
+***************************************************************************/
+
+#ifndef MAME_SOUND_VOICEMIX_H
+#define MAME_SOUND_VOICEMIX_H
+
+#pragma once
+
+#include "video/simd.h"
+
+#include <algorithm>
+
+
+//**************************************************************************
+//  VECTOR KERNELS
+//**************************************************************************
+
+namespace voicemix {
+
+// number of samples processed per block; per-voice scratch arrays are
+// sized to this
+constexpr int BLOCK_SIZE = 64;
+
+#if defined(MAME_SIMD_SSE2)
+
+// SSE2 has no 32-bit low multiply; build one from two 32x32->64 multiplies
+inline __m128i mullo_epi32(__m128i a, __m128i b)
+{
+	__m128i const even = _mm_mul_epu32(a, b);
+	__m128i const odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+	return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+
+#endif
+
+
+//-------------------------------------------------
+//  interpolate_linear - dst[i] = s16(prev[i] +
+//  ((frac[i] * (next[i] - prev[i])) >> fracbits))
+//  for 16-bit samples; the result is truncated to
+//  16 bits and sign extended
+//-------------------------------------------------
+
+inline void interpolate_linear(s32 *dst, s32 const *prev, s32 const *next, s32 const *frac, int fracbits, int count)
+{
+	int i = 0;
+#if defined(MAME_SIMD_SSE2)
+	__m128i const shift = _mm_cvtsi32_si128(fracbits);
+	for ( ; (count - i) >= 4; i += 4)
+	{
+		__m128i const p = _mm_loadu_si128(reinterpret_cast<__m128i const *>(prev + i));
+		__m128i const d = _mm_sub_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const *>(next + i)), p);
+		__m128i const r = _mm_add_epi32(p, _mm_sra_epi32(mullo_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const *>(frac + i)), d), shift));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_srai_epi32(_mm_slli_epi32(r, 16), 16));
+	}
+#elif defined(MAME_SIMD_NEON)
+	int32x4_t const shift = vdupq_n_s32(-fracbits);
+	for ( ; (count - i) >= 4; i += 4)
+	{
+		int32x4_t const p = vld1q_s32(prev + i);
+		int32x4_t const d = vsubq_s32(vld1q_s32(next + i), p);
+		int32x4_t const r = vaddq_s32(p, vshlq_s32(vmulq_s32(vld1q_s32(frac + i), d), shift));
+		vst1q_s32(dst + i, vmovl_s16(vmovn_s32(r)));
+	}
+#endif
+	for ( ; i < count; i++)
+		dst[i] = s16(prev[i] + (s32(u32(frac[i]) * u32(next[i] - prev[i])) >> fracbits));
+}
+
+
+//-------------------------------------------------
+//  accumulate - acc[i] += (src[i] * gain[i]) >>
+//  shift, with a per-sample gain for ramped
+//  envelopes
+//-------------------------------------------------
+
+inline void accumulate(s32 *acc, s32 const *src, s32 const *gain, int shift, int count)
+{
+	int i = 0;
+#if defined(MAME_SIMD_SSE2)
+	__m128i const sh = _mm_cvtsi32_si128(shift);
+	for ( ; (count - i) >= 4; i += 4)
+	{
+		__m128i const prod = mullo_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const *>(src + i)), _mm_loadu_si128(reinterpret_cast<__m128i const *>(gain + i)));
+		__m128i *const dst = reinterpret_cast<__m128i *>(acc + i);
+		_mm_storeu_si128(dst, _mm_add_epi32(_mm_loadu_si128(dst), _mm_sra_epi32(prod, sh)));
+	}
+#elif defined(MAME_SIMD_NEON)
+	int32x4_t const sh = vdupq_n_s32(-shift);
+	for ( ; (count - i) >= 4; i += 4)
+	{
+		int32x4_t const prod = vmulq_s32(vld1q_s32(src + i), vld1q_s32(gain + i));
+		vst1q_s32(acc + i, vaddq_s32(vld1q_s32(acc + i), vshlq_s32(prod, sh)));
+	}
+#endif
+	for ( ; i < count; i++)
+		acc[i] += (src[i] * gain[i]) >> shift;
+}
+
+
+//-------------------------------------------------
+//  accumulate - acc[i] += (src[i] * gain) >>
+//  shift, with a constant gain
+//-------------------------------------------------
+
+inline void accumulate(s32 *acc, s32 const *src, s32 gain, int shift, int count)
+{
+	int i = 0;
+#if defined(MAME_SIMD_SSE2)
+	__m128i const g = _mm_set1_epi32(gain);
+	__m128i const sh = _mm_cvtsi32_si128(shift);
+	for ( ; (count - i) >= 4; i += 4)
+	{
+		__m128i const prod = mullo_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const *>(src + i)), g);
+		__m128i *const dst = reinterpret_cast<__m128i *>(acc + i);
+		_mm_storeu_si128(dst, _mm_add_epi32(_mm_loadu_si128(dst), _mm_sra_epi32(prod, sh)));
+	}
+#elif defined(MAME_SIMD_NEON)
+	int32x4_t const g = vdupq_n_s32(gain);
+	int32x4_t const sh = vdupq_n_s32(-shift);
+	for ( ; (count - i) >= 4; i += 4)
+	{
+		int32x4_t const prod = vmulq_s32(vld1q_s32(src + i), g);
+		vst1q_s32(acc + i, vaddq_s32(vld1q_s32(acc + i), vshlq_s32(prod, sh)));
+	}
+#endif
+	for ( ; i < count; i++)
+		acc[i] += (src[i] * gain) >> shift;
+}
+
+} // namespace voicemix
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// ======================> voice_mixer
+
+// per-output accumulators for one block of samples
+template <int Channels>
+class voice_mixer
+{
+public:
+	static constexpr int BLOCK = voicemix::BLOCK_SIZE;
+
+	// start a new block of up to BLOCK samples with silent outputs
+	void begin(int samples)
+	{
+		m_samples = samples;
+		for (auto &acc : m_acc)
+			std::fill_n(acc, samples, 0);
+	}
+
+	// number of samples in the current block
+	int samples() const { return m_samples; }
+
+	// mixed result for one output
+	s32 const *output(int ch) const { return m_acc[ch]; }
+
+	// add the first count samples of a voice to one output
+	void mix(int ch, s32 const *src, s32 const *gain, int shift, int count) { voicemix::accumulate(m_acc[ch], src, gain, shift, count); }
+	void mix(int ch, s32 const *src, s32 gain, int shift, int count) { voicemix::accumulate(m_acc[ch], src, gain, shift, count); }
+
+	// add a voice to a stereo pair with constant left/right gains
+	void mix_pan(int ch, s32 const *src, s32 left, s32 right, int shift, int count)
+	{
+		voicemix::accumulate(m_acc[ch], src, left, shift, count);
+		voicemix::accumulate(m_acc[ch + 1], src, right, shift, count);
+	}
+
+private:
+	alignas(16) s32 m_acc[Channels][BLOCK];
+	int m_samples = 0;
+};
+
+#endif // MAME_SOUND_VOICEMIX_H
@@ -196,6 +196,7 @@ static const rgb_t PALETTE_MOS[] =
 #define FOREGROUNDCOLOR         (m_reg[0x24] & 0x0f)
 
 #define VIC2_LINES              (IS_PAL ? VIC6569_LINES : VIC6567_LINES)
+#define VIC2_LINE_CYCLES        (IS_PAL ? 63 : 65)
 #define VIC2_FIRST_DMA_LINE     (IS_PAL ? VIC6569_FIRST_DMA_LINE : VIC6567_FIRST_DMA_LINE)
 #define VIC2_LAST_DMA_LINE      (IS_PAL ? VIC6569_LAST_DMA_LINE : VIC6567_LAST_DMA_LINE)
 #define VIC2_FIRST_DISP_LINE    (IS_PAL ? VIC6569_FIRST_DISP_LINE : VIC6567_FIRST_DISP_LINE)
@@ -580,7 +581,9 @@ mos6566_device::mos6566_device(const machine_config &mconfig, device_type type,
 		m_cpu(*this, finder_base::DUMMY_TAG),
 		m_phi0(1),
 		m_ba(ASSERT_LINE),
-		m_aec(ASSERT_LINE)
+		m_aec(ASSERT_LINE),
+		m_catch_up(false),
+		m_sync_timer(nullptr)
 {
 }
 
@@ -741,6 +744,12 @@ void mos6566_device::device_start()
 
 	save_item(NAME(m_first_ba_cycle));
 	save_item(NAME(m_device_suspended));
+
+	if (m_catch_up)
+	{
+		m_sync_timer = timer_alloc(FUNC(mos6566_device::sync_tick), this);
+		save_item(NAME(m_sync_time));
+	}
 }
 
 
@@ -832,6 +841,119 @@ void mos6566_device::device_reset()
 
 	set_ba(ASSERT_LINE);
 	set_aec(ASSERT_LINE);
+
+	if (m_catch_up)
+	{
+		// keep the scheduler from running us; catch_up() does it when something looks
+		suspend(SUSPEND_REASON_DISABLE, true);
+		m_sync_time = machine().time();
+		schedule_sync();
+	}
+}
+
+
+//-------------------------------------------------
+//  catch_up - run the state machine up to the
+//  current time
+//-------------------------------------------------
+
+void mos6566_device::catch_up()
+{
+	attotime const now = machine().time();
+	if (now <= m_sync_time)
+		return;
+
+	u64 const cycles = attotime_to_cycles(now - m_sync_time);
+	if (!cycles)
+		return;
+
+	m_sync_time += cycles_to_attotime(cycles);
+	m_icount = int(cycles);
+	execute_run();
+
+	// halt the CPU for whatever DMA the cycles we just ran stole
+	if (m_rdy_cycles > 0)
+	{
+		m_cpu->spin_until_time(m_cpu->cycles_to_attotime(m_rdy_cycles));
+		m_rdy_cycles = 0;
+	}
+}
+
+
+//-------------------------------------------------
+//  cycles_to_next_event - count the cycles up to
+//  and including the next one that can pull BA
+//  low or raise an interrupt
+//-------------------------------------------------
+
+int mos6566_device::cycles_to_next_event() const
+{
+	int const line_cycles = VIC2_LINE_CYCLES;
+	bool const sprites = m_spr_dma_on || m_reg[0x15];
+	bool const raster_irq = m_reg[0x1a] & IRQ_RST;
+	bool const bad_lines = m_bad_lines_enabled || SCREENON;
+
+	int line = m_rasterline;
+	bool vblanking = m_vblanking;
+	int cycle = m_cycle;
+	int count;
+	for (count = 1; count < VIC2_LINES * line_cycles; count++)
+	{
+		if (cycle == 1)
+		{
+			if (line == (VIC2_LINES - 1))
+				vblanking = true;
+			else
+				line++;
+		}
+		else if (cycle == 2)
+		{
+			if (vblanking)
+			{
+				line = 0;
+				vblanking = false;
+			}
+
+			// raster compare
+			if (raster_irq && (line == RASTERLINE))
+				break;
+		}
+
+		// sprite pointer and data fetches, and the collision checks after drawing them
+		if (sprites && ((cycle >= 55) || (cycle <= 7)))
+			break;
+
+		// bad line DMA starts at cycle 12, or right away when a register write made this a bad line
+		if ((cycle >= 12) && (cycle <= 54) && ((cycle == 12) || ((count == 1) && m_ba)) && bad_lines &&
+				(line >= VIC2_FIRST_DMA_LINE) && (line <= VIC2_LAST_DMA_LINE) && ((line & 0x07) == YSCROLL))
+			break;
+
+		cycle = (cycle == line_cycles) ? 1 : (cycle + 1);
+	}
+
+	return count;
+}
+
+
+//-------------------------------------------------
+//  schedule_sync - wake up at the next cycle that
+//  matters to the CPU
+//-------------------------------------------------
+
+void mos6566_device::schedule_sync()
+{
+	m_sync_timer->adjust(m_sync_time + cycles_to_attotime(cycles_to_next_event()) - machine().time());
+}
+
+
+//-------------------------------------------------
+//  sync_tick - catch up at a predicted event
+//-------------------------------------------------
+
+TIMER_CALLBACK_MEMBER(mos6566_device::sync_tick)
+{
+	catch_up();
+	schedule_sync();
 }
 
 
@@ -1414,7 +1536,7 @@ void mos6566_device::execute_run()
 		m_raster_x += 8;
 		if (m_raster_x == 0x1fc) m_raster_x = 0x004;
 
-		if ((cpu_cycles == vic_cycles) && (m_rdy_cycles > 0))
+		if (!m_catch_up && (cpu_cycles == vic_cycles) && (m_rdy_cycles > 0))
 		{
 			m_cpu->spin_until_time(m_cpu->cycles_to_attotime(m_rdy_cycles));
 			m_rdy_cycles = 0;
@@ -1985,7 +2107,7 @@ void mos6569_device::execute_run()
 		m_raster_x += 8;
 		if (m_raster_x == 0x1fc) m_raster_x = 0x004;
 
-		if ((cpu_cycles == vic_cycles) && (m_rdy_cycles > 0))
+		if (!m_catch_up && (cpu_cycles == vic_cycles) && (m_rdy_cycles > 0))
 		{
 			m_cpu->spin_until_time(m_cpu->cycles_to_attotime(m_rdy_cycles));
 			m_rdy_cycles = 0;
@@ -2381,6 +2503,9 @@ void mos6566_device::draw_sprites()
 
 uint32_t mos6566_device::screen_update(screen_device &screen, bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
+	if (m_catch_up)
+		catch_up();
+
 	bitmap.fill(PALETTE_MOS[0], cliprect);
 
 	if (m_on)
@@ -2398,6 +2523,9 @@ uint8_t mos6566_device::read(offs_t offset)
 {
 	uint8_t val = 0;
 
+	if (m_catch_up && !machine().side_effects_disabled())
+		catch_up();
+
 	offset &= 0x3f;
 
 	switch (offset)
@@ -2544,6 +2672,9 @@ void mos6566_device::write(offs_t offset, uint8_t data)
 	DBG_LOG(2, "vic write", ("%.2x:%.2x\n", offset, data));
 	offset &= 0x3f;
 
+	if (m_catch_up)
+		catch_up();
+
 	switch (offset)
 	{
 	case 0x01:
@@ -2767,6 +2898,10 @@ void mos6566_device::write(offs_t offset, uint8_t data)
 		m_reg[offset] = data;
 		break;
 	}
+
+	// the write may have moved the next bad line, sprite DMA or raster interrupt
+	if (m_catch_up)
+		schedule_sync();
 }
 
 
@@ -2776,6 +2911,9 @@ void mos6566_device::write(offs_t offset, uint8_t data)
 
 void mos6566_device::lp_w(int state)
 {
+	if (m_catch_up)
+		catch_up();
+
 	if (m_lp && !state && !(m_reg[REGISTER_IRQ] & IRQ_LP))
 	{
 		m_reg[REGISTER_LPX] = m_raster_x >> 1;
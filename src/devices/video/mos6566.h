@@ -192,6 +192,9 @@ public:
 	mos6566_device(const machine_config &mconfig, const char *tag, device_t *owner, uint32_t clock);
 
 	template <class T> void set_cpu(T &&tag) { m_cpu.set_tag(tag); }
+
+	// only run the raster state machine when the CPU could notice, instead of in lockstep with it
+	void set_catch_up(bool catch_up) { m_catch_up = catch_up; }
 	auto irq_callback() { return m_write_irq.bind(); }
 	auto ba_callback() { return m_write_ba.bind(); }
 	auto aec_callback() { return m_write_aec.bind(); }
@@ -235,6 +238,12 @@ protected:
 	virtual void device_reset() override;
 	virtual void execute_run() override;
 
+	TIMER_CALLBACK_MEMBER(sync_tick);
+
+	void catch_up();
+	void schedule_sync();
+	int cycles_to_next_event() const;
+
 	inline void set_interrupt( int mask );
 	inline void clear_interrupt( int mask );
 	inline void set_ba(int state);
@@ -347,6 +356,11 @@ protected:
 	/* Cycles */
 	uint64_t m_first_ba_cycle;
 	uint8_t m_device_suspended;
+
+	/* Catch up on demand */
+	bool m_catch_up;
+	emu_timer *m_sync_timer;
+	attotime m_sync_time;
 };
 
 
@@ -1214,6 +1214,7 @@ uint8_t vga_device::vga_latch_write(int offs, uint8_t data)
 
 void vga_device::vga_vh_text(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
+	rectangle const visarea = screen().visible_area();
 	int width=VGA_CH_WIDTH, height = (vga.crtc.maximum_scan_line) * (vga.crtc.scan_doubling + 1);
 
 	if(vga.crtc.cursor_enable)
@@ -1250,7 +1251,7 @@ void vga_device::vga_vh_text(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 					else
 						pen = vga.pens[back_col];
 
-					if(!screen().visible_area().contains(column*width+w, line+h))
+					if(!visarea.contains(column*width+w, line+h))
 						continue;
 					bitmapline[column*width+w] = pen;
 
@@ -1264,7 +1265,7 @@ void vga_device::vga_vh_text(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 					else
 						pen = vga.pens[back_col];
 
-					if(!screen().visible_area().contains(column*width+w, line+h))
+					if(!visarea.contains(column*width+w, line+h))
 						continue;
 					bitmapline[column*width+w] = pen;
 				}
@@ -1275,7 +1276,7 @@ void vga_device::vga_vh_text(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 						(h<=vga.crtc.cursor_scan_end)&&(h<height)&&(line+h<TEXT_LINES);
 						h++)
 				{
-					if(!screen().visible_area().contains(column*width, line+h))
+					if(!visarea.contains(column*width, line+h))
 						continue;
 					bitmap.plot_box(column*width, line+h, width, 1, vga.pens[attr&0xf]);
 				}
@@ -1286,6 +1287,7 @@ void vga_device::vga_vh_text(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 void vga_device::vga_vh_ega(bitmap_rgb32 &bitmap,  const rectangle &cliprect)
 {
+	rectangle const visarea = screen().visible_area();
 	int height = vga.crtc.maximum_scan_line * (vga.crtc.scan_doubling + 1);
 	int pel_shift = (vga.attribute.pel_shift & 7);
 
@@ -1318,7 +1320,7 @@ void vga_device::vga_vh_ega(bitmap_rgb32 &bitmap,  const rectangle &cliprect)
 					data[2]>>=1;
 					data[3]>>=1;
 
-					if(!screen().visible_area().contains(c+i-pel_shift, line + yi))
+					if(!visarea.contains(c+i-pel_shift, line + yi))
 						continue;
 					bitmapline[c+i-pel_shift] = pen;
 				}
@@ -1331,6 +1333,7 @@ void vga_device::vga_vh_ega(bitmap_rgb32 &bitmap,  const rectangle &cliprect)
 // i.e. a 320x200 is really 640x400
 void vga_device::vga_vh_vga(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
+	rectangle const visarea = screen().visible_area();
 	int height = vga.crtc.maximum_scan_line * (vga.crtc.scan_doubling + 1);
 	int pel_shift = (vga.attribute.pel_shift & 6);
 	int addrmask = vga.crtc.no_wrap ? -1 : 0xffff;
@@ -1362,7 +1365,7 @@ void vga_device::vga_vh_vga(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 					for(int xi=0;xi<8;xi++)
 					{
-						if (!screen().visible_area().contains(c+xi-(pel_shift), line + yi))
+						if (!visarea.contains(c+xi-(pel_shift), line + yi))
 							continue;
 						bitmapline[c+xi-(pel_shift)] = pen(vga.memory[(pos & addrmask)+((xi >> 1)*0x10000)]);
 					}
@@ -1389,7 +1392,7 @@ void vga_device::vga_vh_vga(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 					for (int xi=0;xi<0x10;xi++)
 					{
-						if(!screen().visible_area().contains(c+xi-(pel_shift), line + yi))
+						if(!visarea.contains(c+xi-(pel_shift), line + yi))
 							continue;
 						bitmapline[c+xi-pel_shift] = pen(vga.memory[(pos+(xi >> 1)) & addrmask]);
 					}
@@ -1401,6 +1404,7 @@ void vga_device::vga_vh_vga(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 void vga_device::vga_vh_cga(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
+	rectangle const visarea = screen().visible_area();
 	int height = (vga.crtc.scan_doubling + 1);
 
 	int width = (vga.crtc.horz_disp_end + 1) * 8;
@@ -1418,7 +1422,7 @@ void vga_device::vga_vh_cga(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 				for(int xi=0;xi<4;xi++)
 				{
 					pen_t pen = vga.pens[(vga.memory[addr] >> (6-xi*2)) & 3];
-					if(!screen().visible_area().contains(x+xi, y * height + yi))
+					if(!visarea.contains(x+xi, y * height + yi))
 						continue;
 					bitmapline[x+xi] = pen;
 				}
@@ -1431,6 +1435,7 @@ void vga_device::vga_vh_cga(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 void vga_device::vga_vh_mono(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
+	rectangle const visarea = screen().visible_area();
 	int height = (vga.crtc.scan_doubling + 1);
 
 	int width = (vga.crtc.horz_disp_end + 1) * 8;
@@ -1448,7 +1453,7 @@ void vga_device::vga_vh_mono(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 				for(int xi=0;xi<8;xi++)
 				{
 					pen_t pen = vga.pens[(vga.memory[addr] >> (7-xi)) & 1];
-					if(!screen().visible_area().contains(x+xi, y * height + yi))
+					if(!visarea.contains(x+xi, y * height + yi))
 						continue;
 					bitmapline[x+xi] = pen;
 				}
@@ -1809,6 +1814,7 @@ u16 svga_device::line_compare_mask()
 
 void svga_device::svga_vh_rgb8(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
+	rectangle const visarea = screen().visible_area();
 	int height = vga.crtc.maximum_scan_line * (vga.crtc.scan_doubling + 1);
 
 	uint16_t mask_comp = line_compare_mask();
@@ -1839,7 +1845,7 @@ void svga_device::svga_vh_rgb8(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 				for (int xi=0;xi<8;xi++)
 				{
-					if(!screen().visible_area().contains(c+xi, line + yi))
+					if(!visarea.contains(c+xi, line + yi))
 						continue;
 					bitmapline[c+xi] = pen(vga.memory[(pos+(xi))]);
 				}
@@ -1850,6 +1856,7 @@ void svga_device::svga_vh_rgb8(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 void svga_device::svga_vh_rgb15(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
+	rectangle const visarea = screen().visible_area();
 	#define MV(x) (vga.memory[x]+(vga.memory[x+1]<<8))
 	constexpr uint32_t IV = 0xff000000;
 	int height = vga.crtc.maximum_scan_line * (vga.crtc.scan_doubling + 1);
@@ -1868,7 +1875,7 @@ void svga_device::svga_vh_rgb15(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 				return;
 			for(int xi=0,xm=0;xi<8;xi++,xm+=2)
 			{
-				if(!screen().visible_area().contains(c+xi, line + yi))
+				if(!visarea.contains(c+xi, line + yi))
 					continue;
 
 				int r = (MV(pos+xm)&0x7c00)>>10;
@@ -1885,6 +1892,7 @@ void svga_device::svga_vh_rgb15(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 void svga_device::svga_vh_rgb16(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
+	rectangle const visarea = screen().visible_area();
 	#define MV(x) (vga.memory[x]+(vga.memory[x+1]<<8))
 	constexpr uint32_t IV = 0xff000000;
 	int height = vga.crtc.maximum_scan_line * (vga.crtc.scan_doubling + 1);
@@ -1903,7 +1911,7 @@ void svga_device::svga_vh_rgb16(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 				return;
 			for (int xi=0,xm=0;xi<8;xi++,xm+=2)
 			{
-				if(!screen().visible_area().contains(c+xi, line + yi))
+				if(!visarea.contains(c+xi, line + yi))
 					continue;
 
 				int r = (MV(pos+xm)&0xf800)>>11;
@@ -1920,6 +1928,7 @@ void svga_device::svga_vh_rgb16(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 void svga_device::svga_vh_rgb24(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
+	rectangle const visarea = screen().visible_area();
 	#define MD(x) (vga.memory[x]+(vga.memory[x+1]<<8)+(vga.memory[x+2]<<16))
 	constexpr uint32_t ID = 0xff000000;
 	int height = vga.crtc.maximum_scan_line * (vga.crtc.scan_doubling + 1);
@@ -1938,7 +1947,7 @@ void svga_device::svga_vh_rgb24(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 				return;
 			for (int xi=0,xm=0;xi<8;xi++,xm+=3)
 			{
-				if(!screen().visible_area().contains(c+xi, line + yi))
+				if(!visarea.contains(c+xi, line + yi))
 					continue;
 
 				int r = (MD(pos+xm)&0xff0000)>>16;
@@ -1952,6 +1961,7 @@ void svga_device::svga_vh_rgb24(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 void svga_device::svga_vh_rgb32(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
+	rectangle const visarea = screen().visible_area();
 	#define MD(x) (vga.memory[x]+(vga.memory[x+1]<<8)+(vga.memory[x+2]<<16))
 	constexpr uint32_t ID = 0xff000000;
 	int height = vga.crtc.maximum_scan_line * (vga.crtc.scan_doubling + 1);
@@ -1972,7 +1982,7 @@ void svga_device::svga_vh_rgb32(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 				return;
 			for (int xi=0,xm=0;xi<8;xi++,xm+=4)
 			{
-				if(!screen().visible_area().contains(c+xi, line + yi))
+				if(!visarea.contains(c+xi, line + yi))
 					continue;
 
 				int r = (MD(pos+xm)&0xff0000)>>16;
@@ -37,8 +37,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <climits>
 #include <atomic>
+#include <thread>
 
 
 #define KEEP_POLY_STATISTICS 0
@@ -383,28 +385,44 @@ private:
 		return primitive;
 	}
 
-	// enqueue work items in contiguous chunks
+	// publish new work units and make sure enough workers are running to claim them
 	void queue_items(u32 start)
 	{
 		// do nothing if no queue; items will be processed on the next wait
 		if (m_queue == nullptr)
 			return;
 
-		// enqueue the items in contiguous chunks
-		while (start < m_unit.count())
-		{
-			u32 chunk;
-			work_unit *base = m_unit.contiguous(start, m_unit.count() - start, chunk);
-			osd_work_item_queue_multiple(m_queue, work_item_callback, chunk, base, m_unit.itemsize(), WORK_ITEM_FLAG_AUTO_RELEASE);
-			start += chunk;
-		}
+		// make the new units visible to the workers
+		u32 const published = m_unit.count();
+		m_unit_published.store(published);
+
+		// start additional workers for as long as there is more pending work than workers
+		int active = m_active_workers.load();
+		while (active < m_max_workers && u32(active) < published - m_unit_cursor.load())
+			if (m_active_workers.compare_exchange_weak(active, active + 1))
+				osd_work_item_queue(m_queue, worker_callback, this, WORK_ITEM_FLAG_AUTO_RELEASE);
+	}
+
+	// claim the next published work unit, returning 0xffffffff if none remain
+	u32 claim_unit()
+	{
+		u32 cursor = m_unit_cursor.load(std::memory_order_relaxed);
+		while (cursor < m_unit_published.load(std::memory_order_acquire))
+			if (m_unit_cursor.compare_exchange_weak(cursor, cursor + 1, std::memory_order_acq_rel, std::memory_order_relaxed))
+				return cursor;
+		return 0xffffffff;
 	}
 
+	static void *worker_callback(void *param, int threadid);
 	static void *work_item_callback(void *param, int threadid);
 	void presave() { wait("pre-save"); }
 
 	// queue management
 	osd_work_queue *m_queue;               // work queue
+	int m_max_workers;                     // maximum number of concurrent workers
+	std::atomic<int> m_active_workers;     // number of workers currently claiming units
+	std::atomic<u32> m_unit_published;     // number of units visible to the workers
+	std::atomic<u32> m_unit_cursor;        // index of the next unit to be claimed
 
 	// arrays
 	primitive_array m_primitive;           // array of primitives
@@ -464,6 +482,10 @@ private:
 template<typename BaseType, class ObjectType, int MaxParams, u8 Flags>
 poly_manager<BaseType, ObjectType, MaxParams, Flags>::poly_manager(running_machine &machine) :
 	m_queue(nullptr),
+	m_max_workers(std::clamp<int>(std::thread::hardware_concurrency(), 1, WORK_MAX_THREADS)),
+	m_active_workers(0),
+	m_unit_published(0),
+	m_unit_cursor(0),
 	m_tiles(0),
 	m_triangles(0),
 	m_polygons(0),
@@ -578,6 +600,32 @@ poly_manager<BaseType, ObjectType, MaxParams, Flags>::~poly_manager()
 }
 
 
+//-------------------------------------------------
+//  worker_callback - claim and process work units
+//  until none remain
+//-------------------------------------------------
+
+template<typename BaseType, class ObjectType, int MaxParams, u8 Flags>
+void *poly_manager<BaseType, ObjectType, MaxParams, Flags>::worker_callback(void *param, int threadid)
+{
+	poly_manager &owner = *reinterpret_cast<poly_manager *>(param);
+	while (1)
+	{
+		// process units for as long as we can claim them
+		for (u32 unitnum = owner.claim_unit(); unitnum != 0xffffffff; unitnum = owner.claim_unit())
+			work_item_callback(&owner.m_unit.byindex(unitnum), threadid);
+
+		// retire, but re-check in case units were published after the producer
+		// saw us as active and decided not to start another worker
+		owner.m_active_workers.fetch_sub(1);
+		if (owner.m_unit_cursor.load() >= owner.m_unit_published.load())
+			break;
+		owner.m_active_workers.fetch_add(1);
+	}
+	return nullptr;
+}
+
+
 //-------------------------------------------------
 //  work_item_callback - process a work item
 //-------------------------------------------------
@@ -656,9 +704,15 @@ void poly_manager<BaseType, ObjectType, MaxParams, Flags>::wait(char const *debu
 	osd_ticks_t time = get_profile_ticks();
 #endif
 
-	// wait for all pending work items to complete
+	// wait for all pending work items to complete, then pick up anything left unclaimed
 	if (m_queue != nullptr)
+	{
 		osd_work_queue_wait(m_queue, osd_ticks_per_second() * 100);
+		for (u32 unitnum = claim_unit(); unitnum != 0xffffffff; unitnum = claim_unit())
+			work_item_callback(&m_unit.byindex(unitnum), 0);
+		m_unit_published.store(0);
+		m_unit_cursor.store(0);
+	}
 
 	// if we don't have a queue, just run the whole list now
 	else
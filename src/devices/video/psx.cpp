@@ -799,12 +799,9 @@ uint32_t psxgpu_device::update_screen(screen_device &screen, bitmap_rgb32 &bitma
 
 #define WRITE_PIXEL( p ) \
 	{ \
-		if( !m_check_stp || ( *( p_vram ) & 0x8000 ) == 0 ) \
+		if( ( *( p_vram ) & ( m_check_stp ? 0x8000 : 0 ) ) == 0 ) \
 		{ \
-			if( m_draw_stp ) \
-				*( p_vram ) = ( p ) | 0x8000; \
-			else \
-				*( p_vram ) = p; \
+			*( p_vram ) = ( p ) | ( m_draw_stp ? 0x8000 : 0 ); \
 		} \
 	}
 
@@ -1087,6 +1084,17 @@ void psxgpu_device::decode_tpage( uint32_t tpage )
 		n_distance--; \
 	TEXTURE_ENDLOOP
 
+/* raw textures are shaded by 0x80, which leaves every component unchanged */
+#define RAWPIXEL( PIXELUPDATE ) \
+		if( n_bgr != 0 ) \
+		{ \
+			WRITE_PIXEL( n_bgr ) \
+		} \
+		p_vram++; \
+		PIXELUPDATE \
+		n_distance--; \
+	TEXTURE_ENDLOOP
+
 #define TRANSPARENTPIXEL( PIXELUPDATE ) \
 		if( n_bgr != 0 ) \
 		{ \
@@ -1284,6 +1292,29 @@ void psxgpu_device::decode_tpage( uint32_t tpage )
 			switch( n_cmd & 0x02 ) \
 			{ \
 			case 0x00: \
+				if( ( n_cmd & 0x01 ) != 0 ) \
+				{ \
+					/* raw texture */ \
+					switch( n_tp ) \
+					{ \
+					case 0: \
+						/* 4 bit clut */ \
+						TEXTURE4BIT( TXV, TXU ) \
+						RAWPIXEL( PIXELUPDATE ) \
+						break; \
+					case 1: \
+						/* 8 bit clut */ \
+						TEXTURE8BIT( TXV, TXU ) \
+						RAWPIXEL( PIXELUPDATE ) \
+						break; \
+					case 2: \
+						/* 15 bit */ \
+						TEXTURE15BIT( TXV, TXU ) \
+						RAWPIXEL( PIXELUPDATE ) \
+						break; \
+					} \
+					break; \
+				} \
 				/* shading */ \
 				switch( n_tp ) \
 				{ \
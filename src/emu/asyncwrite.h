@@ -0,0 +1,157 @@
+// license:BSD-3-Clause
+// copyright-holders:Vas Crabb
+/***************************************************************************
+
+    asyncwrite.h
+
+    Writing buffers to a file on the I/O work queue.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_ASYNCWRITE_H
+#define MAME_EMU_ASYNCWRITE_H
+
+#pragma once
+
+#include "osdcore.h"
+
+#include <deque>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// ======================> async_write_queue
+
+// hands filled buffers to the I/O work queue to be written in order,
+// reuses completed buffers, and holds up the caller once too many are
+// in flight; after a write fails, further buffers are dropped
+template <typename T>
+class async_write_queue
+{
+public:
+	// writes a buffer, usually on the I/O thread
+	using write_func = std::function<bool (T &)>;
+
+	// construction/destruction
+	async_write_queue(write_func &&write, size_t max_pending)
+		: m_write(std::move(write))
+		, m_max_pending(max_pending)
+		, m_queue(osd_work_queue_alloc(WORK_QUEUE_FLAG_IO))
+		, m_error(false)
+		, m_stalls(0)
+	{
+	}
+
+	~async_write_queue()
+	{
+		flush();
+		if (m_queue)
+			osd_work_queue_free(m_queue);
+	}
+
+	// getters
+	bool failed() const { return m_error; }
+	unsigned stalls() const { return m_stalls; }
+
+	// get a buffer to fill, reusing a completed one if possible
+	std::unique_ptr<T> alloc()
+	{
+		if (m_free.empty())
+			return std::make_unique<T>();
+
+		std::unique_ptr<T> result = std::move(m_free.back());
+		m_free.pop_back();
+		return result;
+	}
+
+	// hand a filled buffer to the I/O thread; returns false if this or
+	// an earlier write failed
+	bool queue(std::unique_ptr<T> &&data)
+	{
+		// retire writes that have finished, and throttle the caller if the writer falls behind
+		if (m_pending.size() >= m_max_pending)
+			m_stalls++;
+		while (!m_pending.empty() && ((m_pending.size() >= m_max_pending) || osd_work_item_wait(m_pending.front()->item, 0)))
+			complete();
+		if (m_error)
+		{
+			release(std::move(data));
+			return false;
+		}
+
+		auto write = std::make_unique<pending>(pending{ this, nullptr, false, std::move(data) });
+		if (m_queue)
+			write->item = osd_work_item_queue(m_queue, &async_write_queue::write_callback, write.get(), 0);
+		if (write->item)
+		{
+			m_pending.emplace_back(std::move(write));
+			return true;
+		}
+
+		// couldn't queue it, so write it now
+		if (!m_write(*write->data))
+			m_error = true;
+		release(std::move(write->data));
+		return !m_error;
+	}
+
+	// wait for all queued writes to complete
+	void flush()
+	{
+		while (!m_pending.empty())
+			complete();
+	}
+
+private:
+	// a buffer in flight
+	struct pending
+	{
+		async_write_queue * owner;          // queue the write belongs to
+		osd_work_item *     item;           // work item
+		bool                success;        // result of the write
+		std::unique_ptr<T>  data;           // buffer being written
+	};
+
+	// wait for the oldest pending write and collect its result
+	void complete()
+	{
+		std::unique_ptr<pending> write = std::move(m_pending.front());
+		m_pending.pop_front();
+		while (!osd_work_item_wait(write->item, osd_ticks_per_second())) { }
+		osd_work_item_release(write->item);
+		if (!write->success)
+			m_error = true;
+		release(std::move(write->data));
+	}
+
+	// keep a completed buffer for reuse
+	void release(std::unique_ptr<T> &&data)
+	{
+		if (m_free.size() < m_max_pending)
+			m_free.emplace_back(std::move(data));
+	}
+
+	static void *write_callback(void *param, int threadid)
+	{
+		pending &write = *reinterpret_cast<pending *>(param);
+		write.success = write.owner->m_write(*write.data);
+		return nullptr;
+	}
+
+	// internal state
+	write_func                              m_write;        // writes a buffer
+	size_t const                            m_max_pending;  // writes in flight before the caller waits
+	osd_work_queue *                        m_queue;        // I/O work queue, or nullptr
+	std::deque<std::unique_ptr<pending> >   m_pending;      // writes in flight, oldest first
+	std::vector<std::unique_ptr<T> >        m_free;         // completed buffers available for reuse
+	bool                                    m_error;        // a write has failed
+	unsigned                                m_stalls;       // times the caller had to wait for the writer
+};
+
+#endif // MAME_EMU_ASYNCWRITE_H
@@ -0,0 +1,281 @@
+// license:BSD-3-Clause
+// copyright-holders:Vas Crabb
+/***************************************************************************
+
+    bootstate.cpp
+
+    Cached power-on states for skipping long boot sequences.
+
+****************************************************************************
+
+    Many systems spend tens of seconds in BIOS checks before they're
+    usable.  With -bootstate, the machine is saved -bootstate_time
+    emulated seconds after power-on (or when a script calls
+    machine:capture_boot_state()), and later starts restore that state
+    instead of running the boot again.
+
+    Each system keeps a single boot state, boot.sta, alongside a
+    boot.key file holding a hash of everything that can change how the
+    machine boots: the build, the device tree (which covers slot cards
+    and BIOS selections), the state registrations (which cover RAM
+    sizes), the contents of ROM and cartridge regions, mounted media,
+    DIP switch and configuration settings, and the NVRAM as it was
+    loaded (other than real-time clocks).  The state is only restored
+    if the hash matches, so a stale state is never used.  Otherwise a
+    new state is captured and replaces the old one.
+
+    The key is cleared before a capture is written and only recorded
+    once the write succeeds, so a partly written state is never
+    paired with a valid key.  If restoring fails (for example the file
+    is damaged), the machine boots normally and the state is captured
+    again.  Systems that update NVRAM on every boot will capture a
+    new state each time, replacing the previous one.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "bootstate.h"
+
+#include "dirtc.h"
+#include "emuopts.h"
+#include "fileio.h"
+#include "main.h"
+
+#include "hashing.h"
+
+#include <algorithm>
+#include <vector>
+
+
+
+//**************************************************************************
+//  BOOT STATE CACHE
+//**************************************************************************
+
+//-------------------------------------------------
+//  boot_state_cache - constructor
+//-------------------------------------------------
+
+boot_state_cache::boot_state_cache(running_machine &machine, const attotime &delay)
+	: m_machine(machine)
+	, m_delay(delay)
+	, m_timer(nullptr)
+	, m_key(string_format("%016x", compute_key()))
+	, m_pending(false)
+{
+	m_filename = machine.compose_saveload_filename(std::string(NAME));
+	m_keyfile = m_filename.substr(0, m_filename.length() - 4) + ".key";
+	m_timer = machine.scheduler().timer_alloc(timer_expired_delegate(FUNC(boot_state_cache::timer_expired), this));
+	m_state_saved_subscription = machine.add_state_saved_notifier(delegate<void (std::string_view, save_error)>(&boot_state_cache::state_saved, this));
+
+	// only restore the state if it was captured with the same configuration
+	bool usable = false;
+	emu_file keyfile(machine.options().state_directory(), OPEN_FLAG_READ);
+	if (!keyfile.open(m_keyfile))
+	{
+		char buffer[32];
+		char const *const line = keyfile.gets(buffer, std::size(buffer));
+		usable = line && (std::string_view(line).substr(0, m_key.length()) == m_key);
+		keyfile.close();
+	}
+	if (usable)
+	{
+		emu_file file(machine.options().state_directory(), OPEN_FLAG_READ);
+		usable = !file.open(m_filename);
+	}
+
+	if (usable)
+	{
+		osd_printf_verbose("Restoring boot state %s\n", m_filename);
+		machine.schedule_load(std::string(NAME));
+	}
+	else
+	{
+		osd_printf_verbose("No boot state %s for this configuration, will capture one\n", m_filename);
+		arm();
+	}
+}
+
+
+//-------------------------------------------------
+//  capture - save the boot state unless it was
+//  restored or has already been saved
+//-------------------------------------------------
+
+bool boot_state_cache::capture()
+{
+	if (!m_pending)
+		return false;
+
+	m_pending = false;
+	m_timer->enable(false);
+
+	// the old key no longer describes the file once it starts being replaced
+	if (!write_key(""))
+		return false;
+
+	osd_printf_verbose("Capturing boot state %s\n", m_filename);
+	m_machine.schedule_save(std::string(NAME));
+	return true;
+}
+
+
+//-------------------------------------------------
+//  state_loaded - fall back to booting normally
+//  if the boot state couldn't be restored
+//-------------------------------------------------
+
+void boot_state_cache::state_loaded(std::string_view filename, save_error error)
+{
+	if (filename != m_filename)
+		return;
+
+	if (error == STATERR_NONE)
+	{
+		// real-time clocks would otherwise report the time of the capture
+		system_time systime;
+		m_machine.base_datetime(systime);
+		m_machine.set_rtc_datetime(systime);
+	}
+	else
+	{
+		osd_printf_warning("Unable to restore boot state %s, it will be captured again\n", m_filename);
+		arm();
+	}
+}
+
+
+//-------------------------------------------------
+//  state_saved - record the key once the boot
+//  state has been written
+//-------------------------------------------------
+
+void boot_state_cache::state_saved(std::string_view filename, save_error error)
+{
+	if ((filename == m_filename) && (error == STATERR_NONE))
+		write_key(m_key);
+}
+
+
+//-------------------------------------------------
+//  timer_expired - the machine has had long
+//  enough to boot
+//-------------------------------------------------
+
+void boot_state_cache::timer_expired(s32 param)
+{
+	capture();
+}
+
+
+//-------------------------------------------------
+//  arm - start waiting for the machine to boot
+//-------------------------------------------------
+
+void boot_state_cache::arm()
+{
+	m_pending = true;
+	if (m_delay > attotime::zero)
+		m_timer->adjust((m_delay > m_machine.time()) ? (m_delay - m_machine.time()) : attotime::zero);
+}
+
+
+//-------------------------------------------------
+//  write_key - replace the contents of the key
+//  file
+//-------------------------------------------------
+
+bool boot_state_cache::write_key(std::string_view key)
+{
+	emu_file file(m_machine.options().state_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (file.open(m_keyfile) || (file.puts(key) != int(key.length())))
+	{
+		osd_printf_error("Error writing boot state key %s\n", m_keyfile);
+		return false;
+	}
+	return true;
+}
+
+
+//-------------------------------------------------
+//  compute_key - hash everything that affects
+//  how the machine boots
+//-------------------------------------------------
+
+u64 boot_state_cache::compute_key() const
+{
+	util::xxh64_creator hash;
+	auto const append_string =
+			[&hash] (std::string_view value)
+			{
+				hash.append(value.data(), value.length());
+				hash.append("", 1);
+			};
+	auto const append_value =
+			[&hash] (u64 value)
+			{
+				value = little_endianize_int64(value);
+				hash.append(&value, sizeof(value));
+			};
+
+	append_string(emulator_info::get_bare_build_version());
+	append_string(m_machine.system().name);
+	append_value(m_machine.save().signature());
+
+	// the device tree reflects slot options and BIOS selections
+	for (device_t &device : device_enumerator(m_machine.root_device()))
+	{
+		append_string(device.tag());
+		append_string(device.shortname());
+		append_value(device.clock());
+		append_value(device.system_bios());
+	}
+
+	// ROM and cartridge contents, in a stable order
+	std::vector<memory_region *> regions;
+	for (auto const &region : m_machine.memory().regions())
+		regions.emplace_back(region.second.get());
+	std::sort(
+			regions.begin(),
+			regions.end(),
+			[] (memory_region const *a, memory_region const *b) { return a->name() < b->name(); });
+	for (memory_region *region : regions)
+	{
+		append_string(region->name());
+		append_value(region->bytes());
+		hash.append(region->base(), region->bytes());
+	}
+
+	// media that isn't loaded into a region
+	for (device_image_interface &image : image_interface_enumerator(m_machine.root_device()))
+	{
+		append_string(image.device().tag());
+		append_string(image.exists() ? image.filename() : "");
+		append_value(image.is_open() ? image.length() : 0);
+	}
+
+	// DIP switches and configuration settings
+	for (auto const &port : m_machine.ioport().ports())
+	{
+		for (ioport_field const &field : port.second->fields())
+		{
+			if ((field.type() == IPT_DIPSWITCH) || (field.type() == IPT_CONFIG))
+			{
+				append_string(port.first);
+				append_value(field.mask());
+				append_value(field.live().value & field.mask());
+			}
+		}
+	}
+
+	// NVRAM as loaded, since systems often boot differently once it's
+	// initialised; clock chips are skipped as their time always differs
+	for (device_nvram_interface &nvram : nvram_interface_enumerator(m_machine.root_device()))
+	{
+		device_rtc_interface *rtc;
+		if (!nvram.device().interface(rtc))
+			append_value(m_machine.save().state_hash(&nvram.device()));
+	}
+
+	return hash.finish();
+}
@@ -0,0 +1,62 @@
+// license:BSD-3-Clause
+// copyright-holders:Vas Crabb
+/***************************************************************************
+
+    bootstate.h
+
+    Cached power-on states for skipping long boot sequences.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_BOOTSTATE_H
+#define MAME_EMU_BOOTSTATE_H
+
+#pragma once
+
+#include "notifier.h"
+
+#include <string>
+#include <string_view>
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// ======================> boot_state_cache
+
+// restores a state saved after a previous boot with an identical
+// configuration, or saves one once the machine has booted
+class boot_state_cache
+{
+public:
+	// construction/destruction
+	boot_state_cache(running_machine &machine, const attotime &delay);
+
+	// save the boot state now if one is still wanted
+	bool capture();
+
+	// called by the save/load handler after loading a state
+	void state_loaded(std::string_view filename, save_error error);
+
+private:
+	static constexpr char const NAME[] = "boot";
+
+	void state_saved(std::string_view filename, save_error error);
+	void timer_expired(s32 param);
+	void arm();
+	bool write_key(std::string_view key);
+	u64 compute_key() const;
+
+	// internal state
+	running_machine &   m_machine;          // reference to our machine
+	attotime            m_delay;            // emulated time to capture at, or zero for scripts only
+	emu_timer *         m_timer;            // capture timer
+	std::string const   m_key;              // hash of the configuration, in hex
+	std::string         m_filename;         // composed state name, relative to the state directory
+	std::string         m_keyfile;          // key file name, relative to the state directory
+	util::notifier_subscription m_state_saved_subscription;
+	bool                m_pending;          // still waiting to capture?
+};
+
+#endif // MAME_EMU_BOOTSTATE_H
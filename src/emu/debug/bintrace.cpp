@@ -0,0 +1,264 @@
+// license:BSD-3-Clause
+// copyright-holders:Vas Crabb
+/*********************************************************************
+
+    bintrace.cpp
+
+    Debugger binary instruction trace writer.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "bintrace.h"
+
+#include "ioprocsfilter.h"
+
+#include <algorithm>
+
+
+//**************************************************************************
+//  BINARY TRACE WRITER
+//**************************************************************************
+
+// a chunk of records, or the file header, waiting to be written
+struct binary_trace_writer::chunk
+{
+	bool                    header;         // replaces the header at the start of the file
+	std::vector<u8>         data;           // encoded records
+};
+
+
+//-------------------------------------------------
+//  binary_trace_writer - constructor
+//-------------------------------------------------
+
+binary_trace_writer::binary_trace_writer(util::random_read_write::ptr &&file, util::write_stream::ptr &&stream)
+	: m_file(std::move(file))
+	, m_stream(std::move(stream))
+	, m_writer([this] (chunk &c) { return perform_write(c); }, MAX_PENDING_CHUNKS)
+	, m_write_error(false)
+{
+	m_current.reserve(CHUNK_SIZE + 256);
+}
+
+
+//-------------------------------------------------
+//  ~binary_trace_writer - destructor
+//-------------------------------------------------
+
+binary_trace_writer::~binary_trace_writer()
+{
+	if (!m_current.empty())
+		queue_chunk();
+	m_writer.flush();
+
+	m_stream->finalize();
+	m_stream.reset();
+	m_file.reset();
+}
+
+
+//-------------------------------------------------
+//  open - create a trace file, leaving space
+//  for the header
+//-------------------------------------------------
+
+std::error_condition binary_trace_writer::open(std::string const &filename, std::unique_ptr<binary_trace_writer> &result)
+{
+	result.reset();
+
+	osd_file::ptr file;
+	u64 size;
+	std::error_condition err = osd_file::open(filename, OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS, file, size);
+	if (err)
+		return err;
+
+	util::random_read_write::ptr stream = util::osd_file_read_write(std::move(file));
+	if (!stream)
+		return std::errc::not_enough_memory;
+
+	// leave space for the header, which is written once the device is known
+	u8 const header[16] = { 0 };
+	size_t written;
+	err = stream->write(header, sizeof(header), written);
+	if (err)
+		return err;
+
+	util::write_stream::ptr compressed = util::zlib_write(*stream, 6, 16384);
+	if (!compressed)
+		return std::errc::not_enough_memory;
+
+	result.reset(new binary_trace_writer(std::move(stream), std::move(compressed)));
+	return std::error_condition();
+}
+
+
+//-------------------------------------------------
+//  header - fill in the file header and describe
+//  the traced device
+//-------------------------------------------------
+
+void binary_trace_writer::header(std::string_view tag, u8 flags, int addr_shift, int addr_bits, int unit_bytes, const std::vector<std::string> &registers)
+{
+	// the writer thread may be using the file, so the header is written in turn with the chunks
+	std::unique_ptr<chunk> c = m_writer.alloc();
+	c->header = true;
+	c->data.assign({
+			'M', 'T', 'R', 'C',
+			FORMAT_VERSION,
+			flags,
+			u8(s8(addr_shift)),
+			u8(addr_bits),
+			u8(unit_bytes) });
+	c->data.resize(16, 0);
+	if (!m_writer.queue(std::move(c)))
+		m_write_error = true;
+
+	tag = tag.substr(0, 0xffff);
+	put8(u8(tag.length()));
+	put8(u8(tag.length() >> 8));
+	put_string(tag);
+
+	size_t const count = std::min<size_t>(registers.size(), 0x100);
+	put8(u8(count));
+	put8(u8(count >> 8));
+	for (size_t i = 0; count > i; ++i)
+	{
+		std::string_view const name = std::string_view(registers[i]).substr(0, 0xff);
+		put8(u8(name.length()));
+		put_string(name);
+	}
+	check_chunk();
+}
+
+
+//-------------------------------------------------
+//  instruction - log a traced instruction
+//-------------------------------------------------
+
+void binary_trace_writer::instruction(offs_t pc, const std::vector<u8> &opcodes)
+{
+	size_t const length = std::min<size_t>(opcodes.size(), 0xff);
+	put8(RECORD_INSTRUCTION);
+	put32(pc);
+	put8(u8(length));
+	m_current.insert(m_current.end(), opcodes.begin(), opcodes.begin() + length);
+	check_chunk();
+}
+
+
+//-------------------------------------------------
+//  registers - log registers that changed
+//-------------------------------------------------
+
+void binary_trace_writer::registers(const std::vector<std::pair<u8, u64> > &changed)
+{
+	for (size_t base = 0; changed.size() > base; base += 0xff)
+	{
+		size_t const count = std::min<size_t>(changed.size() - base, 0xff);
+		put8(RECORD_REGISTERS);
+		put8(u8(count));
+		for (size_t i = 0; count > i; ++i)
+		{
+			put8(changed[base + i].first);
+			put64(changed[base + i].second);
+		}
+	}
+	check_chunk();
+}
+
+
+//-------------------------------------------------
+//  memory - log a memory access
+//-------------------------------------------------
+
+void binary_trace_writer::memory(int spacenum, bool write, offs_t address, u64 data, u64 mem_mask)
+{
+	put8(RECORD_MEMORY);
+	put8(u8(spacenum & 0x7f) | (write ? 0x80 : 0x00));
+	put32(address);
+	put64(data);
+	put64(mem_mask);
+	check_chunk();
+}
+
+
+//-------------------------------------------------
+//  interrupt - log an interrupt being taken
+//-------------------------------------------------
+
+void binary_trace_writer::interrupt(int irqline, offs_t pc)
+{
+	put8(RECORD_INTERRUPT);
+	put32(u32(irqline));
+	put32(pc);
+	check_chunk();
+}
+
+
+//-------------------------------------------------
+//  text - log free-form text
+//-------------------------------------------------
+
+void binary_trace_writer::text(std::string_view text)
+{
+	put8(RECORD_TEXT);
+	put32(u32(text.length()));
+	put_string(text);
+	check_chunk();
+}
+
+
+//-------------------------------------------------
+//  flush - wait for everything logged so far to
+//  reach the file
+//-------------------------------------------------
+
+void binary_trace_writer::flush()
+{
+	if (!m_current.empty())
+		queue_chunk();
+	m_writer.flush();
+	if (m_writer.failed())
+		m_write_error = true;
+	if (!m_write_error && m_stream->flush())
+		m_write_error = true;
+}
+
+
+//-------------------------------------------------
+//  queue_chunk - hand the current chunk to the
+//  writer thread
+//-------------------------------------------------
+
+void binary_trace_writer::queue_chunk()
+{
+	if (m_write_error)
+	{
+		m_current.clear();
+		return;
+	}
+
+	std::unique_ptr<chunk> c = m_writer.alloc();
+	c->header = false;
+	c->data.swap(m_current);
+	m_current.clear();
+	m_current.reserve(CHUNK_SIZE + 256);
+	if (!m_writer.queue(std::move(c)))
+		m_write_error = true;
+}
+
+
+//-------------------------------------------------
+//  perform_write - compress a chunk into the
+//  file, or fill in the header
+//-------------------------------------------------
+
+bool binary_trace_writer::perform_write(chunk &c)
+{
+	size_t written;
+	if (c.header)
+		return !m_file->write_at(0, c.data.data(), c.data.size(), written) && (c.data.size() == written);
+	else
+		return !m_stream->write(c.data.data(), c.data.size(), written) && (c.data.size() == written);
+}
@@ -0,0 +1,128 @@
+// license:BSD-3-Clause
+// copyright-holders:Vas Crabb
+/*********************************************************************
+
+    bintrace.h
+
+    Debugger binary instruction trace writer.
+
+**********************************************************************
+
+    A binary trace starts with a 16-byte uncompressed header:
+
+        0   magic "MTRC"
+        4   format version (currently 1)
+        5   flags (FLAG_REGISTERS, FLAG_MEMORY)
+        6   address shift of the program space (signed)
+        7   width of a logical program address in bits
+        8   bytes per opcode unit
+        9   reserved (zero)
+
+    The rest of the file is a zlib stream.  It starts with the device
+    tag (u16 length, characters) and the registers whose changes are
+    logged (u16 count, then u8 length and characters for each name),
+    followed by records, each introduced by a type byte.  All values
+    are little-endian:
+
+        INSTRUCTION u32 pc, u8 length, opcode bytes
+        REGISTERS   u8 count, count x (u8 register, u64 value)
+        MEMORY      u8 space | 0x80 for writes, u32 address,
+                    u64 data, u64 mem_mask
+        INTERRUPT   s32 irq line, u32 pc
+        TEXT        u32 length, characters
+
+    Opcode bytes are stored as the debugger reads them: each opcode
+    unit in little-endian order.  Register values are those on entry
+    to the preceding instruction that changed since the last record,
+    and memory records follow the instruction that made the access.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_DEBUG_BINTRACE_H
+#define MAME_EMU_DEBUG_BINTRACE_H
+
+#pragma once
+
+#include "asyncwrite.h"
+
+#include "ioprocs.h"
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// ======================> binary_trace_writer
+
+// gathers trace records into chunks on the emulation thread and leaves
+// compressing and writing them to the I/O work queue
+class binary_trace_writer
+{
+public:
+	static constexpr u8 FORMAT_VERSION = 1;
+
+	// header flags
+	static constexpr u8 FLAG_REGISTERS = 0x01;
+	static constexpr u8 FLAG_MEMORY    = 0x02;
+
+	// record types
+	enum : u8
+	{
+		RECORD_INSTRUCTION = 1,
+		RECORD_REGISTERS,
+		RECORD_MEMORY,
+		RECORD_INTERRUPT,
+		RECORD_TEXT
+	};
+
+	// construction/destruction
+	~binary_trace_writer();
+	static std::error_condition open(std::string const &filename, std::unique_ptr<binary_trace_writer> &result);
+
+	// getters
+	bool failed() const { return m_write_error; }
+
+	// records
+	void header(std::string_view tag, u8 flags, int addr_shift, int addr_bits, int unit_bytes, const std::vector<std::string> &registers);
+	void instruction(offs_t pc, const std::vector<u8> &opcodes);
+	void registers(const std::vector<std::pair<u8, u64> > &changed);
+	void memory(int spacenum, bool write, offs_t address, u64 data, u64 mem_mask);
+	void interrupt(int irqline, offs_t pc);
+	void text(std::string_view text);
+
+	// hand everything gathered so far to the file
+	void flush();
+
+private:
+	static constexpr size_t CHUNK_SIZE = 256 * 1024;
+	static constexpr size_t MAX_PENDING_CHUNKS = 8;
+
+	struct chunk;
+
+	binary_trace_writer(util::random_read_write::ptr &&file, util::write_stream::ptr &&stream);
+
+	void put8(u8 value) { m_current.emplace_back(value); }
+	void put32(u32 value) { for (int i = 0; 4 > i; ++i) m_current.emplace_back(u8(value >> (i * 8))); }
+	void put64(u64 value) { for (int i = 0; 8 > i; ++i) m_current.emplace_back(u8(value >> (i * 8))); }
+	void put_string(std::string_view str) { m_current.insert(m_current.end(), str.begin(), str.end()); }
+	void check_chunk() { if (m_current.size() >= CHUNK_SIZE) queue_chunk(); }
+
+	void queue_chunk();
+	bool perform_write(chunk &c);
+
+	// internal state
+	util::random_read_write::ptr m_file;                // underlying file
+	util::write_stream::ptr      m_stream;              // compressing stream over the file
+	std::vector<u8>              m_current;             // chunk being filled
+	async_write_queue<chunk>     m_writer;              // writes chunks on another thread
+	bool                         m_write_error;         // a write has failed, so further records are dropped
+};
+
+#endif // MAME_EMU_DEBUG_BINTRACE_H
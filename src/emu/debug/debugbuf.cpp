@@ -6,6 +6,9 @@
 #include "emu.h"
 #include "debugbuf.h"
 
+#include "debugcpu.h"
+#include "debugger.h"
+
 debug_disasm_buffer::debug_data_buffer::debug_data_buffer(util::disasm_interface const &intf) : m_intf(intf)
 {
 	m_space = nullptr;
@@ -1328,6 +1331,8 @@ void debug_disasm_buffer::debug_data_buffer::setup_methods()
 debug_disasm_buffer::debug_disasm_buffer(device_t &device) :
 	m_dintf(dynamic_cast<device_disasm_interface *>(&device)->get_disassembler()),
 	m_mintf(dynamic_cast<device_memory_interface *>(&device)),
+	m_debugcpu(device.machine().debugger().cpu()),
+	m_cache(device.debug() ? &device.debug()->disasm_cache() : nullptr),
 	m_buf_raw(dynamic_cast<device_disasm_interface &>(device).get_disassembler()),
 	m_buf_opcodes(dynamic_cast<device_disasm_interface &>(device).get_disassembler()),
 	m_buf_params(dynamic_cast<device_disasm_interface &>(device).get_disassembler()),
@@ -1471,21 +1476,48 @@ debug_disasm_buffer::debug_disasm_buffer(device_t &device) :
 	}
 }
 
-void debug_disasm_buffer::disassemble(offs_t pc, std::string &instruction, offs_t &next_pc, offs_t &size, u32 &info) const
+debug_disasm_cache::entry const &debug_disasm_buffer::cached(offs_t pc) const
 {
+	// reuse the last disassembly at this pc if nothing could have changed it
+	u64 const generation = m_debugcpu.memory_generation();
+	debug_disasm_cache::entry &entry = m_cache ? m_cache->slot(pc) : m_uncached;
+	if(m_cache && (entry.generation == generation) && (entry.pc == pc)) {
+		data_get(pc, entry.size, true, m_check);
+		if(m_check == entry.opcodes) {
+			data_get(pc, entry.size, false, m_check);
+			if(m_check == entry.params)
+				return entry;
+		}
+	}
+
 	std::ostringstream out;
 	u32 result = m_dintf.disassemble(out, pc, m_buf_opcodes, m_buf_params.active() ? m_buf_params : m_buf_opcodes);
-	instruction = out.str();
-	size = result & util::disasm_interface::LENGTHMASK;
-	next_pc = m_next_pc(pc, size);
-	info = result;
+	entry.generation = generation;
+	entry.pc = pc;
+	entry.instruction = out.str();
+	entry.size = result & util::disasm_interface::LENGTHMASK;
+	entry.next_pc = m_next_pc(pc, entry.size);
+	entry.info = result;
+	if(m_cache) {
+		data_get(pc, entry.size, true, entry.opcodes);
+		data_get(pc, entry.size, false, entry.params);
+	}
+	return entry;
+}
+
+void debug_disasm_buffer::disassemble(offs_t pc, std::string &instruction, offs_t &next_pc, offs_t &size, u32 &info) const
+{
+	debug_disasm_cache::entry const &entry = cached(pc);
+	instruction = entry.instruction;
+	size = entry.size;
+	next_pc = entry.next_pc;
+	info = entry.info;
 }
 
 
 u32 debug_disasm_buffer::disassemble_info(offs_t pc) const
 {
-	std::ostringstream out;
-	return m_dintf.disassemble(out, pc, m_buf_opcodes, m_buf_params.active() ? m_buf_params : m_buf_opcodes);
+	return cached(pc).info;
 }
 
 std::string debug_disasm_buffer::pc_to_string(offs_t pc) const
@@ -8,6 +8,33 @@
 
 #pragma once
 
+// Recently disassembled instructions for one device, shared by every
+// buffer and view.  An entry is only reused if the debugger's memory
+// generation hasn't moved on and the instruction bytes still match.
+class debug_disasm_cache
+{
+public:
+	struct entry
+	{
+		u64 generation = 0;
+		offs_t pc = 0;
+		offs_t next_pc = 0;
+		offs_t size = 0;
+		u32 info = 0;
+		std::string instruction;
+		std::vector<u8> opcodes, params;
+	};
+
+	debug_disasm_cache() : m_entries(ENTRIES) { }
+
+	entry &slot(offs_t pc) { return m_entries[(pc ^ (pc >> 12)) & (ENTRIES - 1)]; }
+
+private:
+	static constexpr unsigned ENTRIES = 4096;
+
+	std::vector<entry> m_entries;
+};
+
 class debug_disasm_buffer
 {
 public:
@@ -23,6 +50,8 @@ public:
 	offs_t next_pc_wrap(offs_t pc, offs_t step) const;
 
 private:
+	debug_disasm_cache::entry const &cached(offs_t pc) const;
+
 	class debug_data_buffer : public util::disasm_interface::data_buffer
 	{
 	public:
@@ -79,6 +108,10 @@ private:
 
 	util::disasm_interface &m_dintf;
 	device_memory_interface *const m_mintf;
+	debugger_cpu &m_debugcpu;
+	debug_disasm_cache *const m_cache;
+	mutable debug_disasm_cache::entry m_uncached;
+	mutable std::vector<u8> m_check;
 
 	std::function<offs_t (offs_t, offs_t)> m_next_pc;
 	std::function<offs_t (offs_t, offs_t)> m_next_pc_wrap;
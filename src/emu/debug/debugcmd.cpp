@@ -11,6 +11,7 @@
 #include "emu.h"
 #include "debugcmd.h"
 
+#include "bintrace.h"
 #include "debugbuf.h"
 #include "debugcon.h"
 #include "debugcpu.h"
@@ -18,6 +19,7 @@
 #include "debugvw.h"
 #include "express.h"
 #include "points.h"
+#include "reverse.h"
 
 #include "debugger.h"
 #include "emuopts.h"
@@ -247,6 +249,8 @@ debugger_commands::debugger_commands(running_machine& machine, debugger_cpu& cpu
 	m_console.register_command("wpdisable", CMDFLAG_NONE, 0, MAX_COMMAND_PARAMS, std::bind(&debugger_commands::execute_wpdisenable, this, false, _1));
 	m_console.register_command("wpenable",  CMDFLAG_NONE, 0, MAX_COMMAND_PARAMS, std::bind(&debugger_commands::execute_wpdisenable, this, true, _1));
 	m_console.register_command("wplist",    CMDFLAG_NONE, 0, 1, std::bind(&debugger_commands::execute_wplist, this, _1));
+	m_console.register_command("wplog",     CMDFLAG_NONE, 1, 2, std::bind(&debugger_commands::execute_wplog, this, _1));
+	m_console.register_command("wplogdump", CMDFLAG_NONE, 1, 2, std::bind(&debugger_commands::execute_wplogdump, this, _1));
 
 	m_console.register_command("rpset",     CMDFLAG_NONE, 1, 2, std::bind(&debugger_commands::execute_rpset, this, _1));
 	m_console.register_command("rp",        CMDFLAG_NONE, 1, 2, std::bind(&debugger_commands::execute_rpset, this, _1));
@@ -269,6 +273,11 @@ debugger_commands::debugger_commands(running_machine& machine, debugger_cpu& cpu
 
 	m_console.register_command("rewind",    CMDFLAG_NONE, 0, 0, std::bind(&debugger_commands::execute_rewind, this, _1));
 	m_console.register_command("rw",        CMDFLAG_NONE, 0, 0, std::bind(&debugger_commands::execute_rewind, this, _1));
+	m_console.register_command("reverse",   CMDFLAG_NONE, 0, 4, std::bind(&debugger_commands::execute_reverse, this, _1));
+	m_console.register_command("stepback",  CMDFLAG_NONE, 0, 1, std::bind(&debugger_commands::execute_stepback, this, _1));
+	m_console.register_command("sb",        CMDFLAG_NONE, 0, 1, std::bind(&debugger_commands::execute_stepback, this, _1));
+	m_console.register_command("reversego", CMDFLAG_NONE, 0, 0, std::bind(&debugger_commands::execute_reversego, this, _1));
+	m_console.register_command("rg",        CMDFLAG_NONE, 0, 0, std::bind(&debugger_commands::execute_reversego, this, _1));
 
 	m_console.register_command("save",      CMDFLAG_NONE, 3, 3, std::bind(&debugger_commands::execute_save, this, -1, _1));
 	m_console.register_command("saved",     CMDFLAG_NONE, 3, 3, std::bind(&debugger_commands::execute_save, this, AS_DATA, _1));
@@ -330,6 +339,7 @@ debugger_commands::debugger_commands(running_machine& machine, debugger_cpu& cpu
 	m_console.register_command("traceflush",CMDFLAG_NONE, 0, 0, std::bind(&debugger_commands::execute_traceflush, this, _1));
 
 	m_console.register_command("history",   CMDFLAG_NONE, 0, 2, std::bind(&debugger_commands::execute_history, this, _1));
+	m_console.register_command("trackhistory", CMDFLAG_NONE, 0, 2, std::bind(&debugger_commands::execute_trackhistory, this, _1));
 	m_console.register_command("trackpc",   CMDFLAG_NONE, 0, 3, std::bind(&debugger_commands::execute_trackpc, this, _1));
 
 	m_console.register_command("trackmem",  CMDFLAG_NONE, 0, 3, std::bind(&debugger_commands::execute_trackmem, this, _1));
@@ -347,6 +357,10 @@ debugger_commands::debugger_commands(running_machine& machine, debugger_cpu& cpu
 	m_console.register_command("mapi",      CMDFLAG_NONE, 1, 1, std::bind(&debugger_commands::execute_map, this, AS_IO, _1));
 	m_console.register_command("mapo",      CMDFLAG_NONE, 1, 1, std::bind(&debugger_commands::execute_map, this, AS_OPCODES, _1));
 	m_console.register_command("memdump",   CMDFLAG_NONE, 0, 2, std::bind(&debugger_commands::execute_memdump, this, _1));
+	m_console.register_command("memprof",   CMDFLAG_NONE, 0, 2, std::bind(&debugger_commands::execute_memprof, this, _1));
+	m_console.register_command("memprofstop", CMDFLAG_NONE, 0, 1, std::bind(&debugger_commands::execute_memprofstop, this, _1));
+	m_console.register_command("memproflist", CMDFLAG_NONE, 0, 2, std::bind(&debugger_commands::execute_memproflist, this, _1));
+	m_console.register_command("memprofsave", CMDFLAG_NONE, 1, 2, std::bind(&debugger_commands::execute_memprofsave, this, _1));
 
 	m_console.register_command("symlist",   CMDFLAG_NONE, 0, 1, std::bind(&debugger_commands::execute_symlist, this, _1));
 
@@ -1616,6 +1630,8 @@ void debugger_commands::execute_wplist(const std::vector<std::string_view> &para
 								buffer.append(string_format(" if %s", wp->condition()));
 							if (std::string(wp->action()).compare("") != 0)
 								buffer.append(string_format(" do %s", wp->action()));
+							if (wp->log_size())
+								buffer.append(string_format(" log %d/%d", std::min<u64>(wp->log_hits(), wp->log_size()), wp->log_size()));
 							m_console.printf("%s\n", buffer);
 							printed++;
 						}
@@ -1643,6 +1659,134 @@ void debugger_commands::execute_wplist(const std::vector<std::string_view> &para
 }
 
 
+/*-------------------------------------------------
+    execute_wplog - execute the watchpoint log
+    command
+-------------------------------------------------*/
+
+void debugger_commands::execute_wplog(const std::vector<std::string_view> &params)
+{
+	// param 1 is the watchpoint number
+	u64 wpnum;
+	if (!m_console.validate_number_parameter(params[0], wpnum))
+		return;
+
+	// param 2 is the number of hits to keep
+	u64 count = 4096;
+	if (params.size() > 1 && !m_console.validate_number_parameter(params[1], count))
+		return;
+	if (count > 0x100000)
+	{
+		m_console.printf("Log size too large (maximum %d hits)\n", 0x100000);
+		return;
+	}
+
+	debug_watchpoint *wp = nullptr;
+	for (device_t &device : device_enumerator(m_machine.root_device()))
+	{
+		wp = device.debug()->watchpoint_find(wpnum);
+		if (wp)
+			break;
+	}
+	if (!wp)
+	{
+		m_console.printf("Invalid watchpoint number %X\n", wpnum);
+		return;
+	}
+
+	wp->set_log_size(count);
+	if (count)
+		m_console.printf("Watchpoint %X logging up to %d hits\n", wpnum, count);
+	else
+		m_console.printf("Watchpoint %X stopping on hits\n", wpnum);
+}
+
+
+/*-------------------------------------------------
+    execute_wplogdump - execute the watchpoint log
+    dump command
+-------------------------------------------------*/
+
+void debugger_commands::execute_wplogdump(const std::vector<std::string_view> &params)
+{
+	// param 1 is the watchpoint number
+	u64 wpnum;
+	if (!m_console.validate_number_parameter(params[0], wpnum))
+		return;
+
+	debug_watchpoint *wp = nullptr;
+	for (device_t &device : device_enumerator(m_machine.root_device()))
+	{
+		wp = device.debug()->watchpoint_find(wpnum);
+		if (wp)
+			break;
+	}
+	if (!wp)
+	{
+		m_console.printf("Invalid watchpoint number %X\n", wpnum);
+		return;
+	}
+	if (!wp->log_size())
+	{
+		m_console.printf("Watchpoint %X is not logging hits\n", wpnum);
+		return;
+	}
+
+	// param 2 is the optional file name
+	std::unique_ptr<std::ofstream> f;
+	if (params.size() > 1)
+	{
+		f = std::make_unique<std::ofstream>(std::string(params[1]));
+		if (!f->good())
+		{
+			m_console.printf("Error opening file '%s'\n", params[1]);
+			return;
+		}
+	}
+
+	address_space &space = wp->space();
+	int const ashift = space.addr_shift();
+	int const unit_size = ashift <= 0 ? 8 << -ashift : 8 >> ashift;
+	int const pcchars = space.device().debug()->logaddrchars();
+	u64 const hits = wp->log_hits();
+	std::vector<debug_watchpoint::hit_record> const log = wp->logged_hits();
+	if (f)
+		*f << "cycles,pc,type,address,data,size\n";
+	for (auto const &entry : log)
+	{
+		if (f)
+		{
+			util::stream_format(*f, "%d,%0*X,%s,%0*X,%0*X,%d\n",
+					entry.cycles,
+					pcchars, entry.pc,
+					(entry.type == read_or_write::READ) ? "r" : "w",
+					space.addrchars(), entry.address,
+					(entry.size * unit_size + 3) / 4, entry.data,
+					entry.size);
+		}
+		else
+		{
+			m_console.printf("%12d  %0*X: %s %0*X %s %0*X\n",
+					entry.cycles,
+					pcchars, entry.pc,
+					(entry.type == read_or_write::READ) ? "read " : "write",
+					(entry.size * unit_size + 3) / 4, entry.data,
+					(entry.type == read_or_write::READ) ? "from" : "to  ",
+					space.addrchars(), entry.address);
+		}
+	}
+
+	if (hits > log.size())
+		m_console.printf("Watchpoint %X: %d hits, oldest %d dropped\n", wpnum, hits, hits - log.size());
+	else
+		m_console.printf("Watchpoint %X: %d hits\n", wpnum, hits);
+	if (f)
+		m_console.printf("Wrote hits to '%s'\n", params[1]);
+
+	wp->clear_log();
+}
+
+
 /*-------------------------------------------------
     execute_rpset - execute the registerpoint set
     command
@@ -1967,6 +2111,112 @@ void debugger_commands::execute_rewind(const std::vector<std::string_view> &para
 }
 
 
+/*-------------------------------------------------
+    execute_reverse - execute the reverse command
+-------------------------------------------------*/
+
+void debugger_commands::execute_reverse(const std::vector<std::string_view> &params)
+{
+	debug_reverse &reverse = m_machine.debugger().cpu().reverse();
+
+	// with no parameters, report the status
+	if (params.empty())
+	{
+		if (!reverse.device())
+		{
+			m_console.printf("Reverse execution is disabled\n");
+		}
+		else
+		{
+			u64 const position = reverse.position();
+			u64 const oldest = reverse.oldest_position();
+			m_console.printf(
+					"Reverse execution on CPU '%s': %d checkpoints every %d instructions, %.1f of %d MB used, reaching %d instructions back\n",
+					reverse.device()->tag(),
+					reverse.checkpoint_count(),
+					reverse.interval(),
+					double(reverse.memory_used()) / double(1 << 20),
+					reverse.budget(),
+					(position > oldest) ? (position - oldest - 1) : 0);
+		}
+		return;
+	}
+
+	// param 1 is the on/off switch
+	bool turn_on;
+	if (!m_console.validate_boolean_parameter(params[0], turn_on))
+		return;
+	if (!turn_on)
+	{
+		reverse.stop();
+		m_console.printf("Reverse execution disabled\n");
+		return;
+	}
+
+	// param 2 is the CPU
+	device_t *cpu = nullptr;
+	if (!m_console.validate_cpu_parameter((params.size() > 1) ? params[1] : std::string_view(), cpu))
+		return;
+	device_execute_interface const *execute;
+	if (!cpu->interface(execute))
+	{
+		m_console.printf("Device %s is not a CPU\n", cpu->name());
+		return;
+	}
+
+	// param 3 is the checkpoint interval, param 4 is the memory budget
+	u64 interval = reverse.interval();
+	if (params.size() > 2 && !m_console.validate_number_parameter(params[2], interval))
+		return;
+	u64 budget = reverse.budget();
+	if (params.size() > 3 && !m_console.validate_number_parameter(params[3], budget))
+		return;
+	if (!interval || !budget)
+	{
+		m_console.printf("Checkpoint interval and memory budget must be greater than zero\n");
+		return;
+	}
+
+	reverse.start(*cpu, interval, budget);
+	m_console.printf("Reverse execution enabled on CPU '%s', checkpoint every %d instructions, up to %d MB\n", cpu->tag(), interval, budget);
+	if (!(m_machine.system().flags & MACHINE_SUPPORTS_SAVE))
+		m_console.printf("Warning: save states are not officially supported for this machine\n");
+
+	// every instruction counts from here on
+	if (m_machine.debugger().cpu().live_cpu() == cpu)
+		cpu->debug()->compute_debug_flags();
+}
+
+
+/*-------------------------------------------------
+    execute_stepback - execute the stepback
+    command
+-------------------------------------------------*/
+
+void debugger_commands::execute_stepback(const std::vector<std::string_view> &params)
+{
+	// if we have a parameter, use it instead
+	u64 steps = 1;
+	if (params.size() > 0 && !m_console.validate_number_parameter(params[0], steps))
+		return;
+	if (!steps)
+		return;
+
+	m_machine.debugger().cpu().reverse().step_back(steps);
+}
+
+
+/*-------------------------------------------------
+    execute_reversego - execute the reversego
+    command
+-------------------------------------------------*/
+
+void debugger_commands::execute_reversego(const std::vector<std::string_view> &params)
+{
+	m_machine.debugger().cpu().reverse().reverse_continue();
+}
+
+
 /*-------------------------------------------------
     execute_save - execute the save command
 -------------------------------------------------*/
@@ -3446,6 +3696,8 @@ void debugger_commands::execute_trace(const std::vector<std::string_view> &param
 	std::string_view action;
 	bool detect_loops = true;
 	bool logerror = false;
+	bool binary = false;
+	u8 binary_flags = 0;
 	std::string filename(params[0]);
 
 	// replace macros
@@ -3468,19 +3720,51 @@ void debugger_commands::execute_trace(const std::vector<std::string_view> &param
 				detect_loops = false;
 			else if (util::streqlower(flag, "logerror"sv))
 				logerror = true;
+			else if (util::streqlower(flag, "binary"sv))
+				binary = true;
+			else if (util::streqlower(flag, "regs"sv))
+				binary_flags |= binary_trace_writer::FLAG_REGISTERS;
+			else if (util::streqlower(flag, "mem"sv))
+				binary_flags |= binary_trace_writer::FLAG_MEMORY;
 			else
 			{
 				m_console.printf("Invalid flag '%s'\n", flag);
 				return;
 			}
 		}
+		if (binary_flags && !binary)
+		{
+			m_console.printf("The 'regs' and 'mem' flags require the 'binary' flag\n");
+			return;
+		}
 	}
 	if (params.size() > 3 && !m_console.validate_command_parameter(action = params[3]))
 		return;
 
+	// binary traces are written by their own writer
+	using namespace std::literals;
+	if (binary && !util::streqlower(filename, "off"sv))
+	{
+		if ((filename[0] == '>') && (filename[1] == '>'))
+		{
+			m_console.printf("Binary traces cannot be appended to\n");
+			return;
+		}
+
+		std::unique_ptr<binary_trace_writer> writer;
+		std::error_condition const err = binary_trace_writer::open(filename, writer);
+		if (err)
+		{
+			m_console.printf("Error opening file '%s' (%s)\n", params[0], err.message());
+			return;
+		}
+		cpu->debug()->trace_binary(std::move(writer), binary_flags, trace_over, logerror, action);
+		m_console.printf("Tracing CPU '%s' to binary file %s\n", cpu->tag(), filename);
+		return;
+	}
+
 	// open the file
 	std::unique_ptr<std::ofstream> f;
-	using namespace std::literals;
 	if (!util::streqlower(filename, "off"sv))
 	{
 		std::ios_base::openmode mode = std::ios_base::out;
@@ -3549,6 +3833,8 @@ void debugger_commands::execute_history(const std::vector<std::string_view> &par
 		m_console.printf("No disassembler available for device %s\n", device->name());
 		return;
 	}
+	if (!debug->track_history())
+		m_console.printf("PC history tracking is disabled on CPU '%s'\n", device->tag());
 
 	// loop over lines
 	std::string instruction;
@@ -3570,6 +3856,31 @@ void debugger_commands::execute_history(const std::vector<std::string_view> &par
 }
 
 
+/*-------------------------------------------------
+    execute_trackhistory - execute the
+    trackhistory command
+-------------------------------------------------*/
+
+void debugger_commands::execute_trackhistory(const std::vector<std::string_view> &params)
+{
+	// gather the on/off switch (if present)
+	bool turn_on = true;
+	if (params.size() > 0 && !m_console.validate_boolean_parameter(params[0], turn_on))
+		return;
+
+	// gather the cpu id (if present)
+	device_t *cpu = nullptr;
+	if (!m_console.validate_cpu_parameter((params.size() > 1) ? params[1] : std::string_view(), cpu))
+		return;
+
+	cpu->debug()->set_track_history(turn_on);
+	if (turn_on)
+		m_console.printf("PC history tracking enabled on CPU '%s'\n", cpu->tag());
+	else
+		m_console.printf("PC history tracking disabled on CPU '%s'\n", cpu->tag());
+}
+
+
 /*-------------------------------------------------
     execute_trackpc - execute the trackpc command
 -------------------------------------------------*/
@@ -3869,6 +4180,153 @@ void debugger_commands::execute_memdump(const std::vector<std::string_view> &par
 }
 
 
+/*-------------------------------------------------
+    execute_memprof - start profiling accesses to
+    an address space
+-------------------------------------------------*/
+
+void debugger_commands::execute_memprof(const std::vector<std::string_view> &params)
+{
+	address_space *space;
+	if (!m_console.validate_device_space_parameter(!params.empty() ? params[0] : std::string_view(), AS_PROGRAM, space))
+		return;
+
+	u64 pagebits = u64(s64(-1));
+	if ((params.size() > 1) && !m_console.validate_number_parameter(params[1], pagebits))
+		return;
+
+	auto &profiler = m_profilers[space];
+	if (!profiler || ((params.size() > 1) && (profiler->page_shift() != int(pagebits))))
+		profiler = std::make_unique<memory_profiler>(*space, int(s64(pagebits)));
+	profiler->start();
+
+	m_console.printf("Profiling '%s' %s space with %u-byte pages\n", space->device().tag(), space->name(), 1U << profiler->page_shift());
+}
+
+
+/*-------------------------------------------------
+    execute_memprofstop - stop profiling accesses
+    to one or all address spaces
+-------------------------------------------------*/
+
+void debugger_commands::execute_memprofstop(const std::vector<std::string_view> &params)
+{
+	if (params.empty())
+	{
+		for (auto &profiler : m_profilers)
+			profiler.second->stop();
+		m_console.printf("Stopped all memory profiling\n");
+		return;
+	}
+
+	address_space *space;
+	if (!m_console.validate_device_space_parameter(params[0], AS_PROGRAM, space))
+		return;
+
+	auto const found = m_profilers.find(space);
+	if (m_profilers.end() == found)
+	{
+		m_console.printf("'%s' %s space is not being profiled\n", space->device().tag(), space->name());
+		return;
+	}
+	found->second->stop();
+	m_console.printf("Stopped profiling '%s' %s space\n", space->device().tag(), space->name());
+}
+
+
+/*-------------------------------------------------
+    execute_memproflist - list the busiest
+    handlers and pages in a profiled space
+-------------------------------------------------*/
+
+void debugger_commands::execute_memproflist(const std::vector<std::string_view> &params)
+{
+	address_space *space;
+	if (!m_console.validate_device_space_parameter(!params.empty() ? params[0] : std::string_view(), AS_PROGRAM, space))
+		return;
+
+	u64 count = 10;
+	if ((params.size() > 1) && !m_console.validate_number_parameter(params[1], count))
+		return;
+
+	auto const found = m_profilers.find(space);
+	if (m_profilers.end() == found)
+	{
+		m_console.printf("'%s' %s space is not being profiled\n", space->device().tag(), space->name());
+		return;
+	}
+	memory_profiler const &profiler = *found->second;
+
+	int const nc = (space->addr_width() + 3) / 4;
+	m_console.printf("'%s' %s space%s%s\n", space->device().tag(), space->name(), profiler.running() ? "" : " (stopped)", profiler.map_changed() ? " (map changed since start)" : "");
+	for (read_or_write mode : { read_or_write::READ, read_or_write::WRITE })
+	{
+		char const *const modestr = (mode == read_or_write::READ) ? "read" : "write";
+
+		// sort handlers by count, dropping the ones never hit
+		std::vector<memory_profiler::handler_stats const *> handlers;
+		for (memory_profiler::handler_stats const &h : profiler.handlers(mode))
+			if (h.count)
+				handlers.emplace_back(&h);
+		std::stable_sort(handlers.begin(), handlers.end(), [] (auto const *a, auto const *b) { return a->count > b->count; });
+		if (handlers.size() > count)
+			handlers.resize(count);
+
+		m_console.printf("Busiest %s handlers:\n", modestr);
+		for (memory_profiler::handler_stats const *h : handlers)
+			m_console.printf("  %0*X-%0*X %12u %s\n", nc, h->start, nc, h->end, h->count, h->name);
+
+		// then the same for pages
+		std::vector<u64> const &counts = profiler.pages(mode);
+		std::vector<size_t> pages;
+		for (size_t i = 0; counts.size() > i; ++i)
+			if (counts[i])
+				pages.emplace_back(i);
+		std::stable_sort(pages.begin(), pages.end(), [&counts] (size_t a, size_t b) { return counts[a] > counts[b]; });
+		if (pages.size() > count)
+			pages.resize(count);
+
+		m_console.printf("Busiest %s pages:\n", modestr);
+		for (size_t p : pages)
+		{
+			offs_t const start = offs_t(p) << profiler.page_shift();
+			offs_t const end = (start | make_bitmask<offs_t>(profiler.page_shift())) & space->addrmask();
+			m_console.printf("  %0*X-%0*X %12u\n", nc, start, nc, end, counts[p]);
+		}
+	}
+}
+
+
+/*-------------------------------------------------
+    execute_memprofsave - save profiled handler
+    and page counts as CSV
+-------------------------------------------------*/
+
+void debugger_commands::execute_memprofsave(const std::vector<std::string_view> &params)
+{
+	address_space *space;
+	if (!m_console.validate_device_space_parameter((params.size() > 1) ? params[1] : std::string_view(), AS_PROGRAM, space))
+		return;
+
+	auto const found = m_profilers.find(space);
+	if (m_profilers.end() == found)
+	{
+		m_console.printf("'%s' %s space is not being profiled\n", space->device().tag(), space->name());
+		return;
+	}
+
+	std::string const filename(params[0]);
+	std::ofstream file(filename);
+	if (!file.good())
+	{
+		m_console.printf("Error opening file '%s'\n", params[0]);
+		return;
+	}
+	found->second->write_csv(file);
+	m_console.printf("Memory profile saved to %s\n", filename);
+}
+
+
 /*-------------------------------------------------
     execute_symlist - execute the symlist command
 -------------------------------------------------*/
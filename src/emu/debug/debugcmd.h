@@ -15,7 +15,10 @@
 
 #include "debugcpu.h"
 #include "debugcon.h"
+#include "memprof.h"
 
+#include <map>
+#include <memory>
 #include <string_view>
 
 
@@ -118,6 +121,8 @@ private:
 	void execute_wpclear(const std::vector<std::string_view> &params);
 	void execute_wpdisenable(bool enable, const std::vector<std::string_view> &params);
 	void execute_wplist(const std::vector<std::string_view> &params);
+	void execute_wplog(const std::vector<std::string_view> &params);
+	void execute_wplogdump(const std::vector<std::string_view> &params);
 	void execute_rpset(const std::vector<std::string_view> &params);
 	void execute_rpclear(const std::vector<std::string_view> &params);
 	void execute_rpdisenable(bool enable, const std::vector<std::string_view> &params);
@@ -129,6 +134,9 @@ private:
 	void execute_statesave(const std::vector<std::string_view> &params);
 	void execute_stateload(const std::vector<std::string_view> &params);
 	void execute_rewind(const std::vector<std::string_view> &params);
+	void execute_reverse(const std::vector<std::string_view> &params);
+	void execute_stepback(const std::vector<std::string_view> &params);
+	void execute_reversego(const std::vector<std::string_view> &params);
 	void execute_save(int spacenum, const std::vector<std::string_view> &params);
 	void execute_saveregion(const std::vector<std::string_view> &params);
 	void execute_load(int spacenum, const std::vector<std::string_view> &params);
@@ -145,6 +153,7 @@ private:
 	void execute_trace(const std::vector<std::string_view> &params, bool trace_over);
 	void execute_traceflush(const std::vector<std::string_view> &params);
 	void execute_history(const std::vector<std::string_view> &params);
+	void execute_trackhistory(const std::vector<std::string_view> &params);
 	void execute_trackpc(const std::vector<std::string_view> &params);
 	void execute_trackmem(const std::vector<std::string_view> &params);
 	void execute_pcatmem(int spacenum, const std::vector<std::string_view> &params);
@@ -152,6 +161,10 @@ private:
 	void execute_source(const std::vector<std::string_view> &params);
 	void execute_map(int spacenum, const std::vector<std::string_view> &params);
 	void execute_memdump(const std::vector<std::string_view> &params);
+	void execute_memprof(const std::vector<std::string_view> &params);
+	void execute_memprofstop(const std::vector<std::string_view> &params);
+	void execute_memproflist(const std::vector<std::string_view> &params);
+	void execute_memprofsave(const std::vector<std::string_view> &params);
 	void execute_symlist(const std::vector<std::string_view> &params);
 	void execute_softreset(const std::vector<std::string_view> &params);
 	void execute_hardreset(const std::vector<std::string_view> &params);
@@ -167,6 +180,8 @@ private:
 	std::unique_ptr<global_entry []> m_global_array;
 	cheat_system m_cheat;
 
+	std::map<address_space *, std::unique_ptr<memory_profiler> > m_profilers;
+
 	static const size_t MAX_GLOBALS;
 };
 
@@ -10,10 +10,12 @@
 
 #include "emu.h"
 #include "debugcpu.h"
+#include "bintrace.h"
 #include "debugbuf.h"
 
 #include "express.h"
 #include "points.h"
+#include "reverse.h"
 #include "debugcon.h"
 #include "debugvw.h"
 
@@ -43,6 +45,8 @@ debugger_cpu::debugger_cpu(running_machine &machine)
 	, m_breakcpu(nullptr)
 	, m_symtable(nullptr)
 	, m_vblank_occurred(false)
+	, m_memory_modified(false)
+	, m_memory_generation(1)
 	, m_execution_state(exec_state::STOPPED)
 	, m_stop_when_not_device(nullptr)
 	, m_bpindex(1)
@@ -61,6 +65,8 @@ debugger_cpu::debugger_cpu(running_machine &machine)
 	m_symtable = std::make_unique<symbol_table>(machine);
 	m_symtable->set_memory_modified_func([this]() { set_memory_modified(true); });
 
+	m_reverse = std::make_unique<debug_reverse>(machine);
+
 	/* add "wpaddr", "wpdata", "wpsize" to the global symbol table */
 	m_symtable->add("wpaddr", symbol_table::READ_ONLY, &m_wpaddr);
 	m_symtable->add("wpdata", symbol_table::READ_ONLY, &m_wpdata);
@@ -99,6 +105,10 @@ debugger_cpu::debugger_cpu(running_machine &machine)
 	}
 }
 
+debugger_cpu::~debugger_cpu()
+{
+}
+
 
 /*-------------------------------------------------
     flush_traces - flushes all traces; this is
@@ -530,6 +540,16 @@ device_debug::device_debug(device_t &device)
 	{
 		m_flags = DEBUG_FLAG_OBSERVING | DEBUG_FLAG_HISTORY;
 
+		// size the breakpoint page map so it stays small for wide address spaces
+		offs_t mask = ~offs_t(0);
+		if (m_memory && m_memory->has_space(AS_PROGRAM))
+			mask = m_memory->space(AS_PROGRAM).logaddrmask();
+		int const shift = std::max(32 - count_leading_zeros_32(mask) - HOOK_PAGE_BITS, 0);
+		m_hook_pages.resize((size_t(mask >> shift) >> 3) + 1, 0);
+		m_exec->m_debug_hook_pages = &m_hook_pages[0];
+		m_exec->m_debug_hook_mask = mask;
+		m_exec->m_debug_hook_shift = shift;
+
 		// if no curpc, add one
 		if (m_state && !m_symtable->find("curpc"))
 			m_symtable->add("curpc", std::bind(&device_state_interface::pcbase, m_state));
@@ -639,6 +659,10 @@ void device_debug::stop_hook()
 
 void device_debug::interrupt_hook(int irqline, offs_t pc)
 {
+	// ignore interrupts taken while going back in time
+	if (m_device.machine().debugger().cpu().reverse().replaying())
+		return;
+
 	// see if this matches a pending interrupt request
 	if ((m_flags & DEBUG_FLAG_STOP_INTERRUPT) != 0 && (m_stopirq == -1 || m_stopirq == irqline))
 	{
@@ -687,6 +711,10 @@ void device_debug::interrupt_hook(int irqline, offs_t pc)
 
 void device_debug::exception_hook(int exception)
 {
+	// ignore exceptions taken while going back in time
+	if (m_device.machine().debugger().cpu().reverse().replaying())
+		return;
+
 	// see if this matches an exception breakpoint
 	if ((m_flags & DEBUG_FLAG_STOP_EXCEPTION) != 0 && (m_stopexception == -1 || m_stopexception == exception))
 	{
@@ -749,6 +777,10 @@ void device_debug::exception_hook(int exception)
 
 void device_debug::privilege_hook()
 {
+	// ignore privilege changes while going back in time
+	if (m_device.machine().debugger().cpu().reverse().replaying())
+		return;
+
 	if ((m_flags & DEBUG_FLAG_STOP_PRIVILEGE) != 0)
 	{
 		bool matched = true;
@@ -786,16 +818,29 @@ void device_debug::instruction_hook(offs_t curpc)
 	// note that we are in the debugger code
 	debugcpu.set_within_instruction(true);
 
+	// anything disassembled before this instruction may be stale
+	debugcpu.advance_memory_generation();
+
 	// update the history
-	m_pc_history[m_pc_history_index] = curpc;
-	m_pc_history_index = (m_pc_history_index + 1) % std::size(m_pc_history);
-	if (std::size(m_pc_history) > m_pc_history_valid)
-		++m_pc_history_valid;
+	if (m_flags & DEBUG_FLAG_HISTORY)
+	{
+		m_pc_history[m_pc_history_index] = curpc;
+		m_pc_history_index = (m_pc_history_index + 1) % std::size(m_pc_history);
+		if (std::size(m_pc_history) > m_pc_history_valid)
+			++m_pc_history_valid;
+	}
 
 	// update total cycles
 	m_last_total_cycles = m_total_cycles;
 	m_total_cycles = m_exec->total_cycles();
 
+	// while going back in time, nothing else happens until the target is reached
+	if (debugcpu.reverse().instruction_hook(m_device, curpc))
+	{
+		debugcpu.set_within_instruction(false);
+		return;
+	}
+
 	// are we tracking our recent pc visits?
 	if (m_track_pc)
 	{
@@ -1335,6 +1380,21 @@ void device_debug::watchpoint_clear_all()
 }
 
 
+//-------------------------------------------------
+//  watchpoint_find - find a watchpoint by index
+//-------------------------------------------------
+
+debug_watchpoint *device_debug::watchpoint_find(int index)
+{
+	for (auto &wpl : m_wplist)
+		for (auto &wp : wpl)
+			if (wp->index() == index)
+				return wp.get();
+
+	return nullptr;
+}
+
+
 //-------------------------------------------------
 //  watchpoint_enable - enable/disable a watchpoint
 //  by index, returning true if we found it
@@ -1558,6 +1618,33 @@ std::pair<offs_t, bool> device_debug::history_pc(int index) const
 }
 
 
+//-------------------------------------------------
+//  set_track_history - turn PC history tracking
+//  on or off; without it, the instruction hook
+//  can be skipped away from breakpoints
+//-------------------------------------------------
+
+void device_debug::set_track_history(bool value)
+{
+	if (!m_exec)
+		return;
+
+	if (value && !(m_flags & DEBUG_FLAG_HISTORY))
+	{
+		m_flags |= DEBUG_FLAG_HISTORY;
+		m_pc_history_valid = 0;
+	}
+	else if (!value)
+	{
+		m_flags &= ~DEBUG_FLAG_HISTORY;
+	}
+
+	// push the flags out globally
+	if (m_device.machine().debugger().cpu().live_cpu() != nullptr)
+		m_device.machine().debugger().cpu().live_cpu()->debug()->compute_debug_flags();
+}
+
+
 //-------------------------------------------------
 //  set_track_pc - turn visited PC tracking on or
 //  off
@@ -1731,6 +1818,19 @@ u32 device_debug::compute_opcode_crc32(offs_t pc) const
 }
 
 
+//-------------------------------------------------
+//  disasm_cache - get the disassembly cache
+//  shared by all buffers for this device
+//-------------------------------------------------
+
+debug_disasm_cache &device_debug::disasm_cache()
+{
+	if (!m_disasm_cache)
+		m_disasm_cache = std::make_unique<debug_disasm_cache>();
+	return *m_disasm_cache;
+}
+
+
 //-------------------------------------------------
 //  trace - trace execution of a given device
 //-------------------------------------------------
@@ -1746,6 +1846,22 @@ void device_debug::trace(std::unique_ptr<std::ostream> &&file, bool trace_over,
 }
 
 
+//-------------------------------------------------
+//  trace_binary - trace execution of a given
+//  device to a compressed binary file
+//-------------------------------------------------
+
+void device_debug::trace_binary(std::unique_ptr<binary_trace_writer> &&writer, u8 flags, bool trace_over, bool logerror, std::string_view action)
+{
+	// delete any existing tracers
+	m_trace = nullptr;
+
+	// if we have a new writer, make a new tracer
+	if (writer != nullptr)
+		m_trace = std::make_unique<tracer>(*this, std::move(writer), flags, trace_over, logerror, action);
+}
+
+
 //-------------------------------------------------
 //  compute_debug_flags - compute the global
 //  debug flags for optimal efficiency
@@ -1765,21 +1881,32 @@ void device_debug::compute_debug_flags()
 		return;
 
 	// if we're stopped, keep calling the hook
-	if (debugcpu.is_stopped())
-		machine.debug_flags |= DEBUG_FLAG_CALL_HOOK;
+	bool every_instruction = debugcpu.is_stopped();
 
-	// if we're tracking history, or we're hooked, or stepping, or stopping at a breakpoint
-	// make sure we call the hook
-	if ((m_flags & (DEBUG_FLAG_HISTORY | DEBUG_FLAG_STEPPING_ANY | DEBUG_FLAG_STOP_PC | DEBUG_FLAG_LIVE_BP)) != 0)
-		machine.debug_flags |= DEBUG_FLAG_CALL_HOOK;
+	// if we're tracking history or visited PCs, stepping, checking registerpoints or tracing,
+	// every instruction matters
+	if ((m_flags & (DEBUG_FLAG_HISTORY | DEBUG_FLAG_STEPPING_ANY | DEBUG_FLAG_LIVE_RP)) != 0 || m_track_pc || (m_trace != nullptr))
+		every_instruction = true;
 
-	// also call if we are tracing
-	if (m_trace != nullptr)
-		machine.debug_flags |= DEBUG_FLAG_CALL_HOOK;
+	// reverse execution counts every instruction of the device it follows
+	if (debugcpu.reverse().device() == &m_device)
+		every_instruction = true;
 
 	// if we are stopping at a particular time and that time is within the current timeslice, we need to be called
 	if ((m_flags & DEBUG_FLAG_STOP_TIME) && m_endexectime <= m_stoptime)
+		every_instruction = true;
+
+	if (every_instruction)
+	{
 		machine.debug_flags |= DEBUG_FLAG_CALL_HOOK;
+	}
+	else if ((m_flags & (DEBUG_FLAG_STOP_PC | DEBUG_FLAG_LIVE_BP)) != 0)
+	{
+		// breakpoints only need the hook on the pages they're on; cores check the map inline
+		if (m_flags & DEBUG_FLAG_STOP_PC)
+			mark_hook_page(m_stopaddr);
+		machine.debug_flags |= DEBUG_FLAG_CALL_HOOK | DEBUG_FLAG_HOOK_PAGES;
+	}
 }
 
 
@@ -1859,25 +1986,23 @@ void device_debug::prepare_for_step_overout(offs_t pc)
 
 void device_debug::breakpoint_update_flags()
 {
-	// see if there are any enabled breakpoints
-	m_flags &= ~DEBUG_FLAG_LIVE_BP;
+	// see if there are any enabled breakpoints, and note the pages they're on
+	m_flags &= ~(DEBUG_FLAG_LIVE_BP | DEBUG_FLAG_LIVE_RP);
+	std::fill(m_hook_pages.begin(), m_hook_pages.end(), 0);
 	for (auto &bpp : m_bplist)
 		if (bpp.second->m_enabled)
 		{
 			m_flags |= DEBUG_FLAG_LIVE_BP;
-			break;
+			mark_hook_page(bpp.first);
 		}
 
-	if (!(m_flags & DEBUG_FLAG_LIVE_BP))
+	// see if there are any enabled registerpoints, which have to be checked everywhere
+	for (debug_registerpoint &rp : m_rplist)
 	{
-		// see if there are any enabled registerpoints
-		for (debug_registerpoint &rp : m_rplist)
+		if (rp.m_enabled)
 		{
-			if (rp.m_enabled)
-			{
-				m_flags |= DEBUG_FLAG_LIVE_BP;
-				break;
-			}
+			m_flags |= DEBUG_FLAG_LIVE_BP | DEBUG_FLAG_LIVE_RP;
+			break;
 		}
 	}
 
@@ -1887,6 +2012,39 @@ void device_debug::breakpoint_update_flags()
 }
 
 
+//-------------------------------------------------
+//  mark_hook_page - make sure the instruction
+//  hook is called on the page containing a PC
+//-------------------------------------------------
+
+void device_debug::mark_hook_page(offs_t pc)
+{
+	if (m_exec)
+	{
+		offs_t const page = (pc & m_exec->m_debug_hook_mask) >> m_exec->m_debug_hook_shift;
+		m_hook_pages[page >> 3] |= u8(1 << (page & 7));
+	}
+}
+
+
+//-------------------------------------------------
+//  breakpoint_test - see whether a breakpoint
+//  would be hit at a given PC without acting on
+//  it
+//-------------------------------------------------
+
+bool device_debug::breakpoint_test(offs_t pc)
+{
+	auto bpitp = m_bplist.equal_range(pc);
+	for (auto bpit = bpitp.first; bpit != bpitp.second; ++bpit)
+	{
+		if (bpit->second->hit(pc))
+			return true;
+	}
+	return false;
+}
+
+
 //-------------------------------------------------
 //  breakpoint_check - check the breakpoints for
 //  a given device
@@ -1964,18 +2122,105 @@ device_debug::tracer::tracer(device_debug &debug, std::unique_ptr<std::ostream>
 	, m_nextdex(0)
 	, m_trace_over(trace_over)
 	, m_trace_over_target(~0)
+	, m_installing(false)
 {
 	memset(m_history, 0, sizeof(m_history));
 }
 
 
+device_debug::tracer::tracer(device_debug &debug, std::unique_ptr<binary_trace_writer> &&writer, u8 flags, bool trace_over, bool logerror, std::string_view action)
+	: m_debug(debug)
+	, m_binary(std::move(writer))
+	, m_action(action)
+	, m_detect_loops(false)
+	, m_logerror(logerror)
+	, m_loops(0)
+	, m_nextdex(0)
+	, m_trace_over(trace_over)
+	, m_trace_over_target(~0)
+	, m_installing(false)
+{
+	memset(m_history, 0, sizeof(m_history));
+
+	// the whole stream is kept, so looping is left to whatever reads it
+	std::vector<std::string> names;
+	if ((flags & binary_trace_writer::FLAG_REGISTERS) && m_debug.m_state)
+	{
+		for (const auto &entry : m_debug.m_state->state_entries())
+		{
+			if (entry->visible() && !entry->is_float() && (m_registers.size() < 0x100))
+			{
+				m_registers.emplace_back(entry.get());
+				names.emplace_back(entry->symbol());
+			}
+		}
+		m_register_values.resize(m_registers.size(), 0);
+	}
+	if (m_registers.empty())
+		flags &= ~binary_trace_writer::FLAG_REGISTERS;
+	if (!m_debug.m_memory)
+		flags &= ~binary_trace_writer::FLAG_MEMORY;
+
+	// describe the program space so the opcodes can be disassembled later
+	int shift = 0, bits = 32, unit = 1;
+	if (m_debug.m_memory && m_debug.m_memory->has_space(AS_PROGRAM))
+	{
+		address_space &space = m_debug.m_memory->space(AS_PROGRAM);
+		shift = space.addr_shift();
+		bits = 32 - count_leading_zeros_32(space.logaddrmask());
+		unit = (shift < 0) ? (1 << -shift) : (shift == 3) ? 2 : 1;
+	}
+	m_binary->header(m_debug.m_device.tag(), flags, shift, bits, unit, names);
+
+	// log the starting register values in full
+	if (!m_registers.empty())
+	{
+		for (size_t i = 0; m_registers.size() > i; ++i)
+		{
+			m_register_values[i] = m_registers[i]->value();
+			m_changed.emplace_back(u8(i), m_register_values[i]);
+		}
+		m_binary->registers(m_changed);
+		m_changed.clear();
+	}
+
+	// watch accesses to every space the device has
+	if (flags & binary_trace_writer::FLAG_MEMORY)
+	{
+		int const count = m_debug.m_memory->max_space_count();
+		m_taps.resize(count * 2);
+		for (int i = 0; count > i; ++i)
+		{
+			if (m_debug.m_memory->has_space(i))
+			{
+				address_space &s = m_debug.m_memory->space(i);
+				install_taps(s, read_or_write::READWRITE);
+				m_tap_notifiers.emplace_back(s.add_change_notifier(
+						[this, &s] (read_or_write mode)
+						{
+							if (!m_installing)
+								install_taps(s, mode);
+						}));
+			}
+		}
+	}
+}
+
+
 //-------------------------------------------------
 //  ~tracer - destructor
 //-------------------------------------------------
 
 device_debug::tracer::~tracer()
 {
+	// remove the taps before the writer goes away
+	m_tap_notifiers.clear();
+	m_installing = true;
+	for (memory_passthrough_handler &tap : m_taps)
+		tap.remove();
+
 	// make sure we close the file if we can
+	m_binary.reset();
 	m_file.reset();
 }
 
@@ -2021,13 +2266,25 @@ void device_debug::tracer::update(offs_t pc)
 		m_debug.m_device.machine().debugger().console().execute_command(m_action, false);
 
 	debug_disasm_buffer buffer(m_debug.device());
-	std::string instruction;
-	offs_t next_pc, size;
 	u32 dasmresult;
-	buffer.disassemble(pc, instruction, next_pc, size, dasmresult);
+	if (m_binary)
+	{
+		// log the opcode bytes, leaving disassembly for later
+		dasmresult = buffer.disassemble_info(pc);
+		buffer.data_get(pc, dasmresult & util::disasm_interface::LENGTHMASK, true, m_opcodes);
+		m_binary->instruction(pc, m_opcodes);
+		if (!m_registers.empty())
+			log_registers();
+	}
+	else
+	{
+		std::string instruction;
+		offs_t next_pc, size;
+		buffer.disassemble(pc, instruction, next_pc, size, dasmresult);
 
-	// output the result
-	util::stream_format(*m_file, "%s: %s\n", buffer.pc_to_string(pc), instruction);
+		// output the result
+		util::stream_format(*m_file, "%s: %s\n", buffer.pc_to_string(pc), instruction);
+	}
 
 	// do we need to step the trace over this instruction?
 	if (m_trace_over && (dasmresult & util::disasm_interface::SUPPORTED) != 0 && (dasmresult & util::disasm_interface::STEP_OVER) != 0)
@@ -2045,7 +2302,8 @@ void device_debug::tracer::update(offs_t pc)
 	// log this PC
 	m_nextdex = (m_nextdex + 1) % TRACE_LOOPS;
 	m_history[m_nextdex] = pc;
-	m_file->flush();
+	if (m_file)
+		m_file->flush();
 }
 
 
@@ -2062,6 +2320,12 @@ void device_debug::tracer::interrupt_update(int irqline, offs_t pc)
 		m_trace_over_target = pc;
 	}
 
+	if (m_binary)
+	{
+		m_binary->interrupt(irqline, pc);
+		return;
+	}
+
 	// if we just finished looping, indicate as much
 	*m_file << "\n";
 	if (m_detect_loops && m_loops != 0)
@@ -2082,6 +2346,11 @@ void device_debug::tracer::interrupt_update(int irqline, offs_t pc)
 void device_debug::tracer::vprintf(util::format_argument_pack<char> const &args)
 {
 	// pass through to the file
+	if (m_binary)
+	{
+		m_binary->text(util::string_format(args));
+		return;
+	}
 	util::stream_format(*m_file, args);
 	m_file->flush();
 }
@@ -2094,7 +2363,106 @@ void device_debug::tracer::vprintf(util::format_argument_pack<char> const &args)
 
 void device_debug::tracer::flush()
 {
-	m_file->flush();
+	if (m_binary)
+		m_binary->flush();
+	else
+		m_file->flush();
+}
+
+
+//-------------------------------------------------
+//  log_registers - log registers that changed
+//  since the last instruction
+//-------------------------------------------------
+
+void device_debug::tracer::log_registers()
+{
+	for (size_t i = 0; m_registers.size() > i; ++i)
+	{
+		u64 const value = m_registers[i]->value();
+		if (value != m_register_values[i])
+		{
+			m_register_values[i] = value;
+			m_changed.emplace_back(u8(i), value);
+		}
+	}
+	if (!m_changed.empty())
+	{
+		m_binary->registers(m_changed);
+		m_changed.clear();
+	}
+}
+
+
+//-------------------------------------------------
+//  install_taps - (re)install the memory access
+//  taps for a space
+//-------------------------------------------------
+
+void device_debug::tracer::install_taps(address_space &space, read_or_write mode)
+{
+	m_installing = true;
+	try
+	{
+		switch (space.data_width())
+		{
+		case  8: install_taps<u8 >(space, mode); break;
+		case 16: install_taps<u16>(space, mode); break;
+		case 32: install_taps<u32>(space, mode); break;
+		case 64: install_taps<u64>(space, mode); break;
+		}
+	}
+	catch (...)
+	{
+		m_installing = false;
+		throw;
+	}
+	m_installing = false;
+}
+
+
+template <typename T>
+void device_debug::tracer::install_taps(address_space &space, read_or_write mode)
+{
+	int const id = space.spacenum();
+	if (u32(mode) & u32(read_or_write::READ))
+	{
+		memory_passthrough_handler &tap = m_taps[id * 2];
+		tap.remove();
+		tap = space.install_read_tap(
+				0, space.addrmask(), "trace",
+				[this, &space] (offs_t offset, T &data, T mem_mask) { memory_access(space, false, offset, data, mem_mask); },
+				&tap);
+	}
+	if (u32(mode) & u32(read_or_write::WRITE))
+	{
+		memory_passthrough_handler &tap = m_taps[(id * 2) + 1];
+		tap.remove();
+		tap = space.install_write_tap(
+				0, space.addrmask(), "trace",
+				[this, &space] (offs_t offset, T &data, T mem_mask) { memory_access(space, true, offset, data, mem_mask); },
+				&tap);
+	}
+}
+
+
+//-------------------------------------------------
+//  memory_access - log an access made by the
+//  traced instruction
+//-------------------------------------------------
+
+void device_debug::tracer::memory_access(address_space &space, bool write, offs_t address, u64 data, u64 mem_mask)
+{
+	// ignore the debugger's own accesses
+	running_machine &machine = m_debug.m_device.machine();
+	if (machine.debugger().cpu().within_instruction_hook() || machine.side_effects_disabled())
+		return;
+
+	// with trace over, only log accesses made by traced instructions
+	if (m_trace_over && (m_trace_over_target != ~0))
+		return;
+
+	m_binary->memory(space.spacenum(), write, address, data, mem_mask);
 }
 
 
@@ -88,6 +88,7 @@ public:
 	// breakpoints
 	const auto &breakpoint_list() const { return m_bplist; }
 	const debug_breakpoint *breakpoint_find(offs_t address) const;
+	bool breakpoint_test(offs_t pc);
 	int breakpoint_set(offs_t address, const char *condition = nullptr, std::string_view action = {});
 	bool breakpoint_clear(int index);
 	void breakpoint_clear_all();
@@ -98,6 +99,7 @@ public:
 	// watchpoints
 	int watchpoint_space_count() const { return m_wplist.size(); }
 	const std::vector<std::unique_ptr<debug_watchpoint>> &watchpoint_vector(int spacenum) const { return m_wplist[spacenum]; }
+	debug_watchpoint *watchpoint_find(int index);
 	int watchpoint_set(address_space &space, read_or_write type, offs_t address, offs_t length, const char *condition = nullptr, std::string_view action = {});
 	bool watchpoint_clear(int wpnum);
 	void watchpoint_clear_all();
@@ -132,8 +134,14 @@ public:
 	bool comment_import(util::xml::data_node const &node, bool is_inline);
 	u32 compute_opcode_crc32(offs_t pc) const;
 
+	// disassembly shared by all buffers and views of this device
+	debug_disasm_cache &disasm_cache();
+
 	// history
 	std::pair<offs_t, bool> history_pc(int index) const;
+	void history_clear() { m_pc_history_index = 0; m_pc_history_valid = 0; }
+	bool track_history() const { return (m_flags & DEBUG_FLAG_HISTORY) != 0; }
+	void set_track_history(bool value);
 
 	// pc tracking
 	void set_track_pc(bool value);
@@ -150,6 +158,7 @@ public:
 
 	// tracing
 	void trace(std::unique_ptr<std::ostream> &&file, bool trace_over, bool detect_loops, bool logerror, std::string_view action);
+	void trace_binary(std::unique_ptr<binary_trace_writer> &&writer, u8 flags, bool trace_over, bool logerror, std::string_view action);
 	template <typename Format, typename... Params> void trace_printf(Format &&fmt, Params &&...args)
 	{
 		if (m_trace != nullptr)
@@ -160,6 +169,7 @@ public:
 	void reset_transient_flag() { m_flags &= ~DEBUG_FLAG_TRANSIENT; }
 
 	static const int HISTORY_SIZE = 256;
+	static const int HOOK_PAGE_BITS = 18;
 
 	// debugger_cpu helpers
 	void compute_debug_flags();
@@ -174,6 +184,7 @@ private:
 	// breakpoint and watchpoint helpers
 	void breakpoint_update_flags();
 	void breakpoint_check(offs_t pc);
+	void mark_hook_page(offs_t pc);
 	void reinstall_all(read_or_write mode);
 	void reinstall(address_space &space, read_or_write mode);
 	void write_tracking(address_space &space, offs_t address, u64 data);
@@ -216,6 +227,8 @@ private:
 	std::forward_list<debug_registerpoint> m_rplist;                       // list of registerpoints
 	std::multimap<offs_t, std::unique_ptr<debug_exceptionpoint>> m_eplist; // list of exception points
 
+	std::vector<u8>         m_hook_pages;               // pages with breakpoints, one bit each, for filtering the instruction hook
+
 	debug_breakpoint *      m_triggered_breakpoint;     // latest breakpoint that was triggered
 	debug_watchpoint *      m_triggered_watchpoint;     // latest watchpoint that was triggered
 
@@ -224,6 +237,7 @@ private:
 	{
 	public:
 		tracer(device_debug &debug, std::unique_ptr<std::ostream> &&file, bool trace_over, bool detect_loops, bool logerror, std::string_view action);
+		tracer(device_debug &debug, std::unique_ptr<binary_trace_writer> &&writer, u8 flags, bool trace_over, bool logerror, std::string_view action);
 		~tracer();
 
 		void update(offs_t pc);
@@ -235,8 +249,14 @@ private:
 	private:
 		static const int TRACE_LOOPS = 64;
 
+		void log_registers();
+		void install_taps(address_space &space, read_or_write mode);
+		template <typename T> void install_taps(address_space &space, read_or_write mode);
+		void memory_access(address_space &space, bool write, offs_t address, u64 data, u64 mem_mask);
+
 		device_debug &      m_debug;                    // reference to our owner
 		std::unique_ptr<std::ostream> m_file;           // tracing file for this CPU
+		std::unique_ptr<binary_trace_writer> m_binary;  // binary trace writer, used instead of the file
 		std::string         m_action;                   // action to perform during a trace
 		offs_t              m_history[TRACE_LOOPS];     // history of recent PCs
 		bool                m_detect_loops;             // whether or not we should detect loops
@@ -247,6 +267,15 @@ private:
 		offs_t              m_trace_over_target;        // target for tracing over
 														//    (0 = not tracing over,
 														//    ~0 = not currently tracing over)
+
+		// binary trace state
+		std::vector<const device_state_entry *> m_registers;    // registers whose changes are logged
+		std::vector<u64>    m_register_values;          // last logged register values
+		std::vector<std::pair<u8, u64> > m_changed;     // registers changed since the last instruction
+		std::vector<u8>     m_opcodes;                  // opcode bytes of the current instruction
+		std::vector<memory_passthrough_handler> m_taps; // read and write taps for each space
+		std::vector<util::notifier_subscription> m_tap_notifiers; // map change notifiers for each space
+		bool                m_installing;               // suppresses change notifications from our own taps
 	};
 	std::unique_ptr<tracer>                m_trace;     // tracer state
 
@@ -285,6 +314,8 @@ private:
 	std::set<dasm_comment> m_comment_set;               // collection of comments
 	u32                 m_comment_change;            // change counter for comments
 
+	std::unique_ptr<debug_disasm_cache> m_disasm_cache; // recently disassembled instructions
+
 	// memory tracking
 	class dasm_memory_access
 	{
@@ -328,7 +359,8 @@ private:
 	static constexpr u32 DEBUG_FLAG_STOP_VBLANK     = 0x00001000;       // there is a pending stop on the next VBLANK
 	static constexpr u32 DEBUG_FLAG_STOP_TIME       = 0x00002000;       // there is a pending stop at cpu->stoptime
 	static constexpr u32 DEBUG_FLAG_SUSPENDED       = 0x00004000;       // CPU currently suspended
-	static constexpr u32 DEBUG_FLAG_LIVE_BP         = 0x00010000;       // there are live breakpoints for this CPU
+	static constexpr u32 DEBUG_FLAG_LIVE_RP         = 0x00008000;       // there are live registerpoints for this CPU
+	static constexpr u32 DEBUG_FLAG_LIVE_BP         = 0x00010000;       // there are live breakpoints or registerpoints for this CPU
 	static constexpr u32 DEBUG_FLAG_STOP_PRIVILEGE  = 0x00020000;       // run until execution level changes
 	static constexpr u32 DEBUG_FLAG_STEPPING_BRANCH_TRUE  = 0x0040000;  // run until true branch
 	static constexpr u32 DEBUG_FLAG_STEPPING_BRANCH_FALSE = 0x0080000;  // run until false branch
@@ -353,6 +385,7 @@ public:
 	enum class exec_state { STOPPED, RUNNING };
 
 	debugger_cpu(running_machine &machine);
+	~debugger_cpu();
 
 	/* ----- initialization and cleanup ----- */
 
@@ -373,6 +406,12 @@ public:
 	symbol_table &global_symtable() { return *m_symtable; }
 
 
+	/* ----- reverse execution ----- */
+
+	/* return the reverse execution state */
+	debug_reverse &reverse() { return *m_reverse; }
+
+
 	/* ----- debugger comment helpers ----- */
 
 	// save all comments for a given machine
@@ -385,6 +424,7 @@ public:
 	// getters
 	bool within_instruction_hook() const { return m_within_instruction_hook; }
 	bool memory_modified() const { return m_memory_modified; }
+	u64 memory_generation() const { return m_memory_generation; }
 	exec_state execution_state() const { return m_execution_state; }
 	device_t *live_cpu() { return m_livecpu; }
 	u32 get_breakpoint_index() { return m_bpindex++; }
@@ -395,7 +435,8 @@ public:
 	// setters
 	void set_break_cpu(device_t * breakcpu) { m_breakcpu = breakcpu; }
 	void set_within_instruction(bool within_instruction) { m_within_instruction_hook = within_instruction; }
-	void set_memory_modified(bool memory_modified) { m_memory_modified = memory_modified; }
+	void set_memory_modified(bool memory_modified) { m_memory_modified = memory_modified; if (memory_modified) advance_memory_generation(); }
+	void advance_memory_generation() { m_memory_generation++; }
 	void set_execution_stopped() { m_execution_state = exec_state::STOPPED; }
 	void set_execution_running() { m_execution_state = exec_state::RUNNING; }
 	void set_wpinfo(offs_t address, u64 data, offs_t size) { m_wpaddr = address; m_wpdata = data; m_wpsize = size; }
@@ -422,10 +463,12 @@ private:
 	device_t *  m_breakcpu;
 
 	std::unique_ptr<symbol_table> m_symtable;           // global symbol table
+	std::unique_ptr<debug_reverse> m_reverse;           // reverse execution
 
 	bool        m_within_instruction_hook;
 	bool        m_vblank_occurred;
 	bool        m_memory_modified;
+	u64         m_memory_generation;  // advances whenever memory or state may have changed
 
 	exec_state  m_execution_state;
 	device_t *  m_stop_when_not_device; // stop execution when the device ceases to be this
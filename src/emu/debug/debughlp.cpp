@@ -70,6 +70,7 @@ const help_item f_static_help_list[] =
 		"  tracelog <format>[,<item>[,...]] -- outputs one or more <item>s to the trace file using <format>\n"
 		"  tracesym <item>[,...]] -- outputs one or more <item>s to the trace file\n"
 		"  history [<CPU>,[<length>]] -- outputs a brief history of visited opcodes\n"
+		"  trackhistory [<bool>,[<CPU>]] -- turn tracking of visited opcodes for history on or off\n"
 		"  trackpc [<bool>,[<CPU>,[<bool>]]] -- visually track visited opcodes [boolean to turn on and off, for CPU, clear]\n"
 		"  trackmem [<bool>,[<CPU>,[<bool>]]] -- record which PC writes to each memory address [boolean to turn on and off, for CPU, clear]\n"
 		"  pcatmem <address>[:<space>] -- query which PC wrote to a given memory address\n"
@@ -77,7 +78,10 @@ const help_item f_static_help_list[] =
 		"  pcatmemi <address>[:<space>] -- query which PC wrote to a given I/O memory address\n"
 		"  pcatmemo <address>[:<space>] -- query which PC wrote to a given opcode memory address\n"
 		"                                (Note: you can also query this info by right-clicking in a memory window)\n"
-		"  rewind[rw] -- go back in time by loading the most recent rewind state"
+		"  rewind[rw] -- go back in time by loading the most recent rewind state\n"
+		"  reverse [<bool>[,<CPU>[,<interval>[,<budget>]]]] -- record checkpoints for going back in time on a CPU\n"
+		"  stepback[sb] [<count>] -- go back <count> instructions (default 1)\n"
+		"  reversego[rg] -- go back to the previous breakpoint or watchpoint hit\n"
 		"  statesave[ss] <filename> -- save a state file for the current driver\n"
 		"  stateload[sl] <filename> -- load a state file for the current driver\n"
 		"  snap [<filename>] -- save a screen snapshot.\n"
@@ -123,6 +127,10 @@ const help_item f_static_help_list[] =
 		"  mapi <address>[:<space>] -- map logical I/O address to physical address and bank\n"
 		"  mapo <address>[:<space>] -- map logical opcode address to physical address and bank\n"
 		"  memdump [<filename>,[<root>]] -- dump current memory maps to <filename>\n"
+		"  memprof [<space>[,<pagebits>]] -- start counting accesses to <space> per handler and page\n"
+		"  memprofstop [<space>] -- stop counting accesses to <space>, or to all spaces\n"
+		"  memproflist [<space>[,<count>]] -- list the most accessed handlers and pages of <space>\n"
+		"  memprofsave <filename>[,<space>] -- save access counts for <space> to <filename> as CSV\n"
 	},
 	{
 		"execution",
@@ -179,6 +187,8 @@ const help_item f_static_help_list[] =
 		"  wpdisable [<wpnum>[,...]] -- disables given watchpoints or all if no <wpnum> specified\n"
 		"  wpenable [<wpnum>[,...]] -- enables given watchpoints or all if no <wpnum> specified\n"
 		"  wplist [<CPU>] -- lists all the watchpoints\n"
+		"  wplog <wpnum>[,<count>] -- records up to <count> hits of a watchpoint instead of stopping\n"
+		"  wplogdump <wpnum>[,<filename>] -- shows or saves the hits recorded by a watchpoint\n"
 	},
 	{
 		"registerpoints",
@@ -447,6 +457,30 @@ const help_item f_static_help_list[] =
 		"history audiocpu,1\n"
 		"  Displays the most recently visited PC addresses for the CPU ':audiocpu'.\n"
 	},
+	{
+		"trackhistory",
+		"\n"
+		"  trackhistory [<bool>,[<CPU>]]\n"
+		"\n"
+		"The trackhistory command turns recording of recently visited PC addresses for the "
+		"'history' command on or off.  It is on by default.  The first Boolean argument turns it "
+		"on or off.  The second argument is a CPU selector (either a tag or a debugger CPU number); "
+		"if no CPU is specified, the current CPU is assumed.\n"
+		"\n"
+		"Recording the history means the debugger has to look at every instruction the CPU "
+		"executes.  With it turned off, a running CPU that is not being stepped, traced or "
+		"checked for registerpoints or visited PCs only enters the debugger on address ranges "
+		"containing breakpoints, and otherwise runs close to full speed.  The 'totalcycles' and "
+		"'lastinstructioncycles' symbols are only updated when the debugger is entered.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"trackhistory 0\n"
+		"  Stop recording the history of the current CPU.\n"
+		"\n"
+		"trackhistory 0,audiocpu\n"
+		"  Stop recording the history of the CPU ':audiocpu'.\n"
+	},
 	{
 		"trackpc",
 		"\n"
@@ -529,6 +563,73 @@ const help_item f_static_help_list[] =
 		"currently echoed into the running machine window.  Previous memory and PC tracking statistics "
 		"are cleared, actual reverse execution does not occur.\n"
 	},
+	{
+		"reverse",
+		"\n"
+		"  reverse [<bool>[,<CPU>[,<interval>[,<budget>]]]]\n"
+		"\n"
+		"The reverse command records checkpoints of the machine state so the stepback and reversego "
+		"commands can go back in time on <CPU>.  A checkpoint is captured every <interval> "
+		"instructions executed by <CPU>, 200000 by default, and checkpoints may occupy up to "
+		"<budget> megabytes, 256 by default; the oldest checkpoints are discarded to stay within "
+		"the budget.  Going back loads the newest checkpoint before the target and runs the machine "
+		"forward to it, so a shorter interval makes going back faster at the cost of memory.  "
+		"Passing false as <bool> stops recording and discards the checkpoints.  If no CPU is "
+		"specified, the currently visible CPU is used.  With no parameters, the current status is "
+		"shown.\n"
+		"\n"
+		"Inputs are not recorded, and changes made from the debugger are not replayed, so going "
+		"back past either may not reproduce what happened.  Checkpoints after the point going "
+		"back stops at are discarded.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"reverse 1\n"
+		"  Record checkpoints for the currently visible CPU.\n"
+		"\n"
+		"reverse 1,maincpu,50000,1024\n"
+		"  Record checkpoints for the CPU ':maincpu' every 50000 instructions, using up to 1024 "
+		"megabytes of memory.\n"
+		"\n"
+		"reverse 0\n"
+		"  Stop recording checkpoints.\n"
+	},
+	{
+		"stepback",
+		"\n"
+		"  stepback[sb] [<count>]\n"
+		"\n"
+		"The stepback command goes back <count> instructions on the CPU recorded with the reverse "
+		"command, or one instruction if <count> is omitted.  If the checkpoints don't reach that "
+		"far back, execution goes back to the oldest one.  Breakpoints and watchpoints are ignored "
+		"on the way.  Execution must be stopped on the recorded CPU.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"sb\n"
+		"  Go back one instruction.\n"
+		"\n"
+		"stepback 1000\n"
+		"  Go back 1000 instructions.\n"
+	},
+	{ "sb", "#stepback" },
+	{
+		"reversego",
+		"\n"
+		"  reversego[rg]\n"
+		"\n"
+		"The reversego command goes back to the most recent instruction on the CPU recorded with "
+		"the reverse command that hit an enabled breakpoint or watchpoint, stopping before the "
+		"instruction executes.  Breakpoint and watchpoint conditions are evaluated, but actions "
+		"are not run.  If there is no earlier hit, execution goes back to the oldest checkpoint.  "
+		"Execution must be stopped on the recorded CPU.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"rg\n"
+		"  Go back to the previous breakpoint or watchpoint hit.\n"
+	},
+	{ "rg", "#reversego" },
 	{
 		"statesave[ss]",
 		"\n"
@@ -1171,7 +1272,7 @@ const help_item f_static_help_list[] =
 	{
 		"trace",
 		"\n"
-		"  trace {<filename>|off}[,<CPU>[,[noloop|logerror][,<action>]]]\n"
+		"  trace {<filename>|off}[,<CPU>[,[noloop|logerror|binary|regs|mem][,<action>]]]\n"
 		"\n"
 		"Starts or stops tracing of the execution of the specified <CPU>, or the currently visible "
 		"CPU if no CPU is specified.  To enable tracing, specify the trace log file name in the "
@@ -1185,6 +1286,12 @@ const help_item f_static_help_list[] =
 		"will not be detected and every instruction will be logged as executed.  If the 'logerror' "
 		"flag is specified, error log output will be included in the trace log.\n"
 		"\n"
+		"The 'binary' flag writes a compressed binary trace instead of disassembled text.  Every "
+		"instruction is logged with its opcode bytes, which is much faster and smaller, and the "
+		"trace can be disassembled later with 'unidasm -trace'.  With 'binary', the 'regs' flag also "
+		"logs registers whose values changed, and the 'mem' flag logs every memory access the CPU "
+		"makes.  Binary traces cannot be appended to.\n"
+		"\n"
 		"The optional <action> parameter is a debugger command to execute before each trace message "
 		"is logged.  Generally, this will include a 'tracelog' or 'tracesym' command to include "
 		"additional information in the trace log.  Note that you may need to embed the action "
@@ -1211,6 +1318,10 @@ const help_item f_static_help_list[] =
 		"  Begin tracing the execution of CPU #0, logging output (along with logerror output) to "
 		"starswep.tr, with loop detection disabled.\n"
 		"\n"
+		"trace dkong.trb,maincpu,binary|regs\n"
+		"  Begin tracing the execution of the CPU ':maincpu' in binary form, logging opcodes and "
+		"register changes to dkong.trb.\n"
+		"\n"
 		"trace >>pigskin.tr\n"
 		"  Begin tracing execution of the currently visible CPU, appending log output to "
 		"pigskin.tr.\n"
@@ -1225,7 +1336,7 @@ const help_item f_static_help_list[] =
 	{
 		"traceover",
 		"\n"
-		"  traceover {<filename>|off}[,<CPU>[,[noloop|logerror][,<action>]]]\n"
+		"  traceover {<filename>|off}[,<CPU>[,[noloop|logerror|binary|regs|mem][,<action>]]]\n"
 		"\n"
 		"Starts or stops tracing for execution of the specified **<CPU>**, or the currently visible "
 		"CPU if no CPU is specified.  When a subroutine call is encountered, tracing will skip over "
@@ -1504,6 +1615,47 @@ const help_item f_static_help_list[] =
 		"wplist maincpu\n"
 		"  List all watchpoints for the CPU ':maincpu'.\n"
 	},
+	{
+		"wplog",
+		"\n"
+		"  wplog <wpnum>[,<count>]\n"
+		"\n"
+		"The wplog command switches a watchpoint to logging mode.  Instead of stopping "
+		"execution, each hit that satisfies the watchpoint's condition is recorded along with "
+		"the PC, the total number of cycles executed, the address and the data, and execution "
+		"continues.  The watchpoint's action is not run in logging mode.  The most recent "
+		"<count> hits are kept, defaulting to 4096 if not specified; older hits are dropped.  A "
+		"<count> of 0 returns the watchpoint to stopping on hits.  Use wplogdump to view the "
+		"recorded hits.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"wplog 3\n"
+		"  Record the most recent 4096 hits of watchpoint 3 without stopping.\n"
+		"\n"
+		"wplog 3,100000\n"
+		"  Record the most recent 100000 hits of watchpoint 3 without stopping.\n"
+		"\n"
+		"wplog 3,0\n"
+		"  Make watchpoint 3 stop execution again.\n"
+	},
+	{
+		"wplogdump",
+		"\n"
+		"  wplogdump <wpnum>[,<filename>]\n"
+		"\n"
+		"The wplogdump command shows the hits recorded by a watchpoint in logging mode, oldest "
+		"first, and clears the log.  If <filename> is specified, the hits are written to the "
+		"file as comma-separated values rather than shown in the console.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"wplogdump 3\n"
+		"  Show the hits recorded by watchpoint 3.\n"
+		"\n"
+		"wplogdump 3,hits.csv\n"
+		"  Write the hits recorded by watchpoint 3 to the file hits.csv.\n"
+	},
 	{
 		"rpset",
 		"\n"
@@ -1726,6 +1878,68 @@ const help_item f_static_help_list[] =
 		"memdump mylog.log,1\n"
 		"  Dumps memory maps for the CPU 1 and all its child devices to the file mylog.log.\n"
 	},
+	{
+		"memprof",
+		"\n"
+		"  memprof [<space>[,<pagebits>]]\n"
+		"\n"
+		"Starts counting read and write accesses to the address space <space>, attributed both "
+		"to the handler that answered and to fixed-size pages of the address space.  If <space> "
+		"is omitted, the program space of the visible CPU is used.  <pagebits> sets the number of "
+		"address bits per page; by default pages are sized so there are at most 65536 of them.  "
+		"Starting again clears the counts.  The counting is done with memory taps, so it slows "
+		"down emulation while active, and handlers installed after profiling starts are not "
+		"counted until it is restarted.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"memprof\n"
+		"  Starts profiling the program space of the visible CPU.\n"
+		"\n"
+		"memprof audiocpu:program,12\n"
+		"  Starts profiling the program space of CPU ':audiocpu' with 4 KiB pages.\n"
+	},
+	{
+		"memprofstop",
+		"\n"
+		"  memprofstop [<space>]\n"
+		"\n"
+		"Stops counting accesses to the address space <space>, keeping the counts gathered so "
+		"far.  If <space> is omitted, all profiling is stopped.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"memprofstop\n"
+		"  Stops profiling all address spaces.\n"
+	},
+	{
+		"memproflist",
+		"\n"
+		"  memproflist [<space>[,<count>]]\n"
+		"\n"
+		"Lists the <count> most accessed read and write handlers and pages of the profiled "
+		"address space <space>.  If <space> is omitted, the program space of the visible CPU is "
+		"used.  <count> defaults to 10.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"memproflist ,20\n"
+		"  Lists the 20 busiest handlers and pages of the visible CPU's program space.\n"
+	},
+	{
+		"memprofsave",
+		"\n"
+		"  memprofsave <filename>[,<space>]\n"
+		"\n"
+		"Saves the per-handler and per-page access counts of the profiled address space <space> "
+		"to <filename> as comma-separated values.  If <space> is omitted, the program space of "
+		"the visible CPU is used.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"memprofsave heat.csv\n"
+		"  Saves the counts for the visible CPU's program space to heat.csv.\n"
+	},
 	{
 		"comlist",
 		"\n"
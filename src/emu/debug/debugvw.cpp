@@ -413,6 +413,10 @@ void debug_view_manager::update_all_except(debug_view_type type)
 
 void debug_view_manager::update_all(debug_view_type type)
 {
+	// a full refresh follows anything that may have changed registers or memory
+	if (type == DVT_NONE)
+		m_machine.debugger().cpu().advance_memory_generation();
+
 	// loop over each view and force an update
 	for (debug_view *view = m_viewlist; view != nullptr; view = view->next())
 		if (type == DVT_NONE || type == view->type())
@@ -101,6 +101,14 @@ enum
 	TVL_EXECUTEFUNC
 };
 
+// additional operations used only by compiled expressions
+enum
+{
+	CVL_PUSH = TVL_EXECUTEFUNC + 1,
+	CVL_RESOLVE_SYMBOL,
+	CVL_RESOLVE_MEMORY
+};
+
 
 
 //**************************************************************************
@@ -1054,12 +1062,16 @@ void parsed_expression::parse(std::string_view expression)
 	m_original_string.assign(expression);
 	m_tokenlist.clear();
 	m_stringlist.clear();
+	m_program.clear();
 
 	// first parse the tokens into the token array in order
 	parse_string_into_tokens();
 
 	// convert the infix order to postfix order
 	infix_to_postfix();
+
+	// compile it if it only reads values
+	compile();
 }
 
 
@@ -1072,6 +1084,7 @@ void parsed_expression::copy(const parsed_expression &src)
 	m_symtable = src.m_symtable;
 	m_default_base = src.m_default_base;
 	m_original_string.assign(src.m_original_string);
+	m_program.clear();
 	if (!m_original_string.empty())
 		parse_string_into_tokens();
 }
@@ -2201,6 +2214,199 @@ inline void parsed_expression::parse_token::set_lval_value(symbol_table &table,
 }
 
 
+//-------------------------------------------------
+//  compile - convert the postfix token list into
+//  a program on a plain value stack, if it only
+//  contains operations that read values
+//-------------------------------------------------
+
+void parsed_expression::compile()
+{
+	// symbols and memory are read when an operator pops them, so track what each slot holds
+	struct slot
+	{
+		const parse_token * pending;            // symbol or memory operator still to be read
+		int                 offset;             // string offset in the interpreter's result
+	};
+	std::vector<slot> stack;
+	std::size_t maxdepth = 0;
+	m_program.clear();
+
+	// emit reads for pending slots in the same order as the interpreter
+	auto const resolve =
+			[this, &stack] (u8 depth)
+			{
+				slot &entry = stack[stack.size() - 1 - depth];
+				if (entry.pending)
+				{
+					m_program.emplace_back(compiled_op{ u8(entry.pending->is_symbol() ? CVL_RESOLVE_SYMBOL : CVL_RESOLVE_MEMORY), depth, entry.offset, 0, entry.pending });
+					entry.pending = nullptr;
+				}
+			};
+
+	for (const parse_token &token : m_tokenlist)
+	{
+		if (token.is_number())
+		{
+			m_program.emplace_back(compiled_op{ CVL_PUSH, 0, token.offset(), token.value(), nullptr });
+			stack.emplace_back(slot{ nullptr, token.offset() });
+		}
+		else if (token.is_symbol() && !token.symbol().is_function())
+		{
+			m_program.emplace_back(compiled_op{ CVL_PUSH, 0, token.offset(), 0, nullptr });
+			stack.emplace_back(slot{ &token, token.offset() });
+		}
+		else if (!token.is_operator() || token.is_function_separator())
+		{
+			// strings, functions and anything unexpected are left to the interpreter
+			m_program.clear();
+			return;
+		}
+		else
+		{
+			switch (token.optype())
+			{
+			case TVL_COMPLEMENT:
+			case TVL_NOT:
+			case TVL_UPLUS:
+			case TVL_UMINUS:
+				if (stack.empty())
+				{
+					m_program.clear();
+					return;
+				}
+				resolve(0);
+				m_program.emplace_back(compiled_op{ token.optype(), 0, stack.back().offset, 0, nullptr });
+				break;
+
+			case TVL_MULTIPLY:
+			case TVL_DIVIDE:
+			case TVL_MODULO:
+			case TVL_ADD:
+			case TVL_SUBTRACT:
+			case TVL_LSHIFT:
+			case TVL_RSHIFT:
+			case TVL_LESS:
+			case TVL_LESSOREQUAL:
+			case TVL_GREATER:
+			case TVL_GREATEROREQUAL:
+			case TVL_EQUAL:
+			case TVL_NOTEQUAL:
+			case TVL_BAND:
+			case TVL_BXOR:
+			case TVL_BOR:
+			case TVL_LAND:
+			case TVL_LOR:
+			case TVL_COMMA:
+				if (stack.size() < 2)
+				{
+					m_program.clear();
+					return;
+				}
+				resolve(0);
+				resolve(1);
+				m_program.emplace_back(compiled_op{ token.optype(), 0, stack.back().offset, 0, nullptr });
+				if (TVL_COMMA == token.optype())
+					stack[stack.size() - 2].offset = stack.back().offset;
+				else
+					stack[stack.size() - 2].offset = std::min(stack[stack.size() - 2].offset, stack.back().offset);
+				stack.pop_back();
+				break;
+
+			case TVL_MEMORYAT:
+				if (stack.empty())
+				{
+					m_program.clear();
+					return;
+				}
+				resolve(0);
+				stack.back().pending = &token;
+				break;
+
+			default:
+				// assignments, increments and function calls need lvals or the token stack
+				m_program.clear();
+				return;
+			}
+		}
+		maxdepth = std::max(maxdepth, stack.size());
+	}
+
+	// there must be exactly one value left
+	if (stack.size() != 1)
+	{
+		m_program.clear();
+		return;
+	}
+	resolve(0);
+	m_program_stack.resize(maxdepth);
+}
+
+
+//-------------------------------------------------
+//  execute_program - execute a compiled
+//  expression
+//-------------------------------------------------
+
+u64 parsed_expression::execute_program()
+{
+	u64 *sp = m_program_stack.data();
+	for (const compiled_op &op : m_program)
+	{
+		switch (op.opcode)
+		{
+		case CVL_PUSH:              *sp++ = op.value;                                       break;
+		case CVL_RESOLVE_SYMBOL:    sp[-1 - op.depth] = op.token->symbol().value();         break;
+
+		case CVL_RESOLVE_MEMORY:
+			{
+				u64 &address = sp[-1 - op.depth];
+				address = m_symtable.get().memory_value(op.token->memory_source(), op.token->memory_space(), u32(address), 1 << op.token->memory_size(), op.token->memory_side_effects());
+			}
+			break;
+
+		case TVL_COMPLEMENT:        sp[-1] = !sp[-1];                                       break;
+		case TVL_NOT:               sp[-1] = ~sp[-1];                                       break;
+		case TVL_UPLUS:                                                                     break;
+		case TVL_UMINUS:            sp[-1] = -sp[-1];                                       break;
+
+		case TVL_DIVIDE:
+			if (!sp[-1])
+				throw expression_error(expression_error::DIVIDE_BY_ZERO, op.offset);
+			sp[-2] = sp[-2] / sp[-1];
+			--sp;
+			break;
+
+		case TVL_MODULO:
+			if (!sp[-1])
+				throw expression_error(expression_error::DIVIDE_BY_ZERO, op.offset);
+			sp[-2] = sp[-2] % sp[-1];
+			--sp;
+			break;
+
+		case TVL_MULTIPLY:          sp[-2] = sp[-2] * sp[-1];           --sp;               break;
+		case TVL_ADD:               sp[-2] = sp[-2] + sp[-1];           --sp;               break;
+		case TVL_SUBTRACT:          sp[-2] = sp[-2] - sp[-1];           --sp;               break;
+		case TVL_LSHIFT:            sp[-2] = sp[-2] << sp[-1];          --sp;               break;
+		case TVL_RSHIFT:            sp[-2] = sp[-2] >> sp[-1];          --sp;               break;
+		case TVL_LESS:              sp[-2] = sp[-2] < sp[-1];           --sp;               break;
+		case TVL_LESSOREQUAL:       sp[-2] = sp[-2] <= sp[-1];          --sp;               break;
+		case TVL_GREATER:           sp[-2] = sp[-2] > sp[-1];           --sp;               break;
+		case TVL_GREATEROREQUAL:    sp[-2] = sp[-2] >= sp[-1];          --sp;               break;
+		case TVL_EQUAL:             sp[-2] = sp[-2] == sp[-1];          --sp;               break;
+		case TVL_NOTEQUAL:          sp[-2] = sp[-2] != sp[-1];          --sp;               break;
+		case TVL_BAND:              sp[-2] = sp[-2] & sp[-1];           --sp;               break;
+		case TVL_BXOR:              sp[-2] = sp[-2] ^ sp[-1];           --sp;               break;
+		case TVL_BOR:               sp[-2] = sp[-2] | sp[-1];           --sp;               break;
+		case TVL_LAND:              sp[-2] = sp[-2] && sp[-1];          --sp;               break;
+		case TVL_LOR:               sp[-2] = sp[-2] || sp[-1];          --sp;               break;
+		case TVL_COMMA:             sp[-2] = sp[-1];                    --sp;               break;
+		}
+	}
+	return sp[-1];
+}
+
+
 //-------------------------------------------------
 //  execute_function - handle an execute function
 //  operator
@@ -20,6 +20,7 @@
 #include <list>
 #include <string_view>
 #include <unordered_map>
+#include <vector>
 
 
 
@@ -247,7 +248,7 @@ public:
 
 	// execution
 	void parse(std::string_view string);
-	u64 execute() { return execute_tokens(); }
+	u64 execute() { return m_program.empty() ? execute_tokens() : execute_program(); }
 
 private:
 	// a single token
@@ -309,6 +310,7 @@ private:
 		expression_space memory_space() const { assert(m_type == OPERATOR || m_type == MEMORY); return expression_space((m_flags & TIN_MEMORY_SPACE_MASK) >> TIN_MEMORY_SPACE_SHIFT); }
 		int memory_size() const { assert(m_type == OPERATOR || m_type == MEMORY); return (m_flags & TIN_MEMORY_SIZE_MASK) >> TIN_MEMORY_SIZE_SHIFT; }
 		bool memory_side_effects() const { assert(m_type == OPERATOR || m_type == MEMORY); return (m_flags & TIN_SIDE_EFFECT_MASK) >> TIN_SIDE_EFFECT_SHIFT; }
+		const char *memory_source() const { assert(m_type == OPERATOR || m_type == MEMORY); return m_string; }
 
 		// setters
 		parse_token &set_offset(int offset) { m_offset = offset; return *this; }
@@ -342,6 +344,16 @@ private:
 		symbol_entry *          m_symbol;           // symbol pointer
 	};
 
+	// a single step of a compiled expression
+	struct compiled_op
+	{
+		u8                  opcode;             // operation to perform
+		u8                  depth;              // stack slot to resolve, counting down from the top
+		int                 offset;             // string offset for errors
+		u64                 value;              // constant to push
+		const parse_token * token;              // symbol or memory operator to resolve
+	};
+
 	// internal helpers
 	void copy(const parsed_expression &src);
 	void print_tokens();
@@ -355,6 +367,7 @@ private:
 	void parse_memory_operator(parse_token &token, const char *string, bool disable_se);
 	void normalize_operator(parse_token &thistoken, parse_token *prevtoken, parse_token *nexttoken, const std::list<parse_token> &stack, bool was_rparen);
 	void infix_to_postfix();
+	void compile();
 
 	// execution helpers
 	void push_token(parse_token &token);
@@ -362,6 +375,7 @@ private:
 	void pop_token_lval(parse_token &token);
 	void pop_token_rval(parse_token &token);
 	u64 execute_tokens();
+	u64 execute_program();
 	void execute_function(parse_token &token);
 
 	// constants
@@ -374,6 +388,8 @@ private:
 	std::list<parse_token> m_tokenlist;                 // token list
 	std::list<std::string> m_stringlist;                // string list
 	std::deque<parse_token> m_token_stack;              // token stack (used during execution)
+	std::vector<compiled_op> m_program;                 // compiled form of the token list (if possible)
+	std::vector<u64>    m_program_stack;                // value stack for the compiled form
 };
 
 #endif // MAME_EMU_DEBUG_EXPRESS_H
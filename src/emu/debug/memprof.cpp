@@ -0,0 +1,286 @@
+// license:BSD-3-Clause
+// copyright-holders:Vas Crabb
+/*********************************************************************
+
+    memprof.cpp
+
+    Debugger memory access profiler.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "memprof.h"
+
+#include "corestr.h"
+
+#include <algorithm>
+#include <ostream>
+
+
+//**************************************************************************
+//  CONSTANTS
+//**************************************************************************
+
+// never keep more than this many page counters per mode
+constexpr int MAX_PAGE_BITS = 16;
+constexpr int MIN_PAGE_SHIFT = 8;
+
+
+
+//**************************************************************************
+//  MEMORY PROFILER
+//**************************************************************************
+
+//-------------------------------------------------
+//  memory_profiler - constructor
+//-------------------------------------------------
+
+memory_profiler::memory_profiler(address_space &space, int page_bits)
+	: m_space(space)
+	, m_page_shift(0)
+	, m_running(false)
+	, m_map_changed(false)
+	, m_installing(false)
+{
+	int const addrbits = 32 - count_leading_zeros_32(space.addrmask());
+	if (page_bits < 0)
+		page_bits = std::min(addrbits, std::max(MIN_PAGE_SHIFT, addrbits - MAX_PAGE_BITS));
+	m_page_shift = std::clamp(page_bits, std::max(0, addrbits - MAX_PAGE_BITS), std::clamp(addrbits, 0, 31));
+
+	size_t const pages = size_t(space.addrmask() >> m_page_shift) + 1;
+	for (mode_state &s : m_state)
+		s.pages.resize(pages, 0);
+}
+
+
+//-------------------------------------------------
+//  ~memory_profiler - destructor
+//-------------------------------------------------
+
+memory_profiler::~memory_profiler()
+{
+	stop();
+}
+
+
+//-------------------------------------------------
+//  start - snapshot the current map and install
+//  counting taps over it
+//-------------------------------------------------
+
+void memory_profiler::start()
+{
+	stop();
+
+	std::vector<memory_entry> entries[2];
+	m_space.dump_maps(entries[0], entries[1]);
+	build(m_state[0], entries[0]);
+	build(m_state[1], entries[1]);
+	reset();
+
+	m_installing = true;
+	try
+	{
+		for (read_or_write mode : { read_or_write::READ, read_or_write::WRITE })
+		{
+			switch (m_space.data_width())
+			{
+			case  8: install<u8>(mode);  break;
+			case 16: install<u16>(mode); break;
+			case 32: install<u32>(mode); break;
+			case 64: install<u64>(mode); break;
+			}
+		}
+	}
+	catch (...)
+	{
+		m_installing = false;
+		stop();
+		throw;
+	}
+	m_installing = false;
+
+	m_subscription = m_space.add_change_notifier(
+			[this] (read_or_write mode)
+			{
+				if (!m_installing)
+					m_map_changed = true;
+			});
+	m_map_changed = false;
+	m_running = true;
+}
+
+
+//-------------------------------------------------
+//  stop - remove the taps, keeping the counts
+//-------------------------------------------------
+
+void memory_profiler::stop()
+{
+	m_subscription.reset();
+	m_installing = true;
+	for (mode_state &s : m_state)
+		s.taps.remove();
+	m_installing = false;
+	m_running = false;
+}
+
+
+//-------------------------------------------------
+//  reset - clear the accumulated counts
+//-------------------------------------------------
+
+void memory_profiler::reset()
+{
+	for (mode_state &s : m_state)
+	{
+		for (handler_stats &h : s.handlers)
+			h.count = 0;
+		std::fill(s.pages.begin(), s.pages.end(), 0);
+	}
+}
+
+
+//-------------------------------------------------
+//  write_csv - write handler and page counts in
+//  comma-separated form
+//-------------------------------------------------
+
+void memory_profiler::write_csv(std::ostream &stream) const
+{
+	int const nc = (32 - count_leading_zeros_32(m_space.addrmask()) + 3) / 4;
+
+	stream << "kind,mode,start,end,name,count\n";
+	for (read_or_write mode : { read_or_write::READ, read_or_write::WRITE })
+	{
+		char const *const modestr = (mode == read_or_write::READ) ? "r" : "w";
+		for (const handler_stats &h : handlers(mode))
+		{
+			std::string name(h.name);
+			strreplace(name, "\"", "\"\"");
+			util::stream_format(stream, "handler,%s,%0*X,%0*X,\"%s\",%u\n", modestr, nc, h.start, nc, h.end, name, h.count);
+		}
+
+		const std::vector<u64> &p = pages(mode);
+		for (size_t i = 0; p.size() > i; ++i)
+		{
+			if (p[i])
+			{
+				offs_t const start = offs_t(i) << m_page_shift;
+				offs_t const end = (start | make_bitmask<offs_t>(m_page_shift)) & m_space.addrmask();
+				util::stream_format(stream, "page,%s,%0*X,%0*X,,%u\n", modestr, nc, start, nc, end, p[i]);
+			}
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  build - turn a map dump into handler entries
+//  and non-overlapping tap segments
+//-------------------------------------------------
+
+void memory_profiler::build(mode_state &state, const std::vector<memory_entry> &entries)
+{
+	state.handlers.clear();
+	state.segments.clear();
+
+	// entries in different view slots overlap, so collect every boundary
+	std::vector<offs_t> bounds;
+	bounds.reserve(entries.size() * 2);
+	for (const memory_entry &e : entries)
+	{
+		std::string name;
+		for (const memory_entry_context &c : e.context)
+		{
+			if (c.disabled)
+				name += util::string_format("%s[off] ", c.view->name());
+			else
+				name += util::string_format("%s[%d] ", c.view->name(), c.slot);
+		}
+		name += e.entry->name();
+		state.handlers.emplace_back(handler_stats{ e.start, e.end, std::move(name), 0 });
+
+		bounds.emplace_back(e.start);
+		if (e.end != m_space.addrmask())
+			bounds.emplace_back(e.end + 1);
+	}
+	std::sort(bounds.begin(), bounds.end());
+	bounds.erase(std::unique(bounds.begin(), bounds.end()), bounds.end());
+
+	// sweep the segments in order, keeping track of the entries covering each
+	std::vector<size_t> order(entries.size());
+	for (size_t i = 0; order.size() > i; ++i)
+		order[i] = i;
+	std::stable_sort(order.begin(), order.end(), [&entries] (size_t a, size_t b) { return entries[a].start < entries[b].start; });
+
+	std::vector<size_t> active;
+	auto next = order.begin();
+	for (size_t i = 0; bounds.size() > i; ++i)
+	{
+		offs_t const start = bounds[i];
+		offs_t const end = ((bounds.size() - 1) > i) ? (bounds[i + 1] - 1) : m_space.addrmask();
+
+		active.erase(std::remove_if(active.begin(), active.end(), [&entries, start] (size_t e) { return entries[e].end < start; }), active.end());
+		while ((order.end() != next) && (entries[*next].start <= start))
+			active.emplace_back(*next++);
+
+		if (!active.empty())
+		{
+			segment &seg = state.segments.emplace_back(segment{ start, end, { } });
+			for (size_t e : active)
+				seg.candidates.emplace_back(segment::candidate{ e, entries[e].context });
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  install - install one tap per segment, all
+//  sharing a single passthrough handler
+//-------------------------------------------------
+
+template <typename T>
+void memory_profiler::install(read_or_write mode)
+{
+	mode_state &s = state(mode);
+	s.taps.remove();
+	for (const segment &seg : s.segments)
+	{
+		auto tap =
+				[this, &s, &seg] (offs_t offset, T &data, T mem_mask)
+				{
+					count(s, seg, offset);
+				};
+		if (mode == read_or_write::READ)
+			s.taps = m_space.install_read_tap(seg.start, seg.end, "memprof", tap, &s.taps);
+		else
+			s.taps = m_space.install_write_tap(seg.start, seg.end, "memprof", tap, &s.taps);
+	}
+}
+
+
+//-------------------------------------------------
+//  count - attribute an access to the handler
+//  that is currently visible in the segment
+//-------------------------------------------------
+
+void memory_profiler::count(mode_state &state, const segment &seg, offs_t address)
+{
+	for (const segment::candidate &c : seg.candidates)
+	{
+		bool const visible = std::all_of(
+				c.context.begin(),
+				c.context.end(),
+				[] (const memory_entry_context &ctx)
+				{
+					return ctx.disabled ? !ctx.view->entry() : (ctx.view->entry() == ctx.slot);
+				});
+		if (visible)
+		{
+			++state.handlers[c.handler].count;
+			break;
+		}
+	}
+	++state.pages[(address & m_space.addrmask()) >> m_page_shift];
+}
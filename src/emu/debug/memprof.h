@@ -0,0 +1,103 @@
+// license:BSD-3-Clause
+// copyright-holders:Vas Crabb
+/*********************************************************************
+
+    memprof.h
+
+    Debugger memory access profiler.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_DEBUG_MEMPROF_H
+#define MAME_EMU_DEBUG_MEMPROF_H
+
+#pragma once
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// ======================> memory_profiler
+
+// counts accesses per handler and per page of an address space using
+// taps; nothing is installed until start() is called, so the cost is
+// only paid while profiling
+class memory_profiler
+{
+public:
+	// accumulated statistics for one handler of the current map
+	struct handler_stats
+	{
+		offs_t      start;
+		offs_t      end;
+		std::string name;
+		u64         count;
+	};
+
+	// construction/destruction
+	memory_profiler(address_space &space, int page_bits = -1);
+	~memory_profiler();
+
+	// getters
+	address_space &space() const { return m_space; }
+	bool running() const { return m_running; }
+	bool map_changed() const { return m_map_changed; }
+	int page_shift() const { return m_page_shift; }
+	const std::vector<handler_stats> &handlers(read_or_write mode) const { return state(mode).handlers; }
+	const std::vector<u64> &pages(read_or_write mode) const { return state(mode).pages; }
+
+	// control
+	void start();
+	void stop();
+	void reset();
+
+	// output
+	void write_csv(std::ostream &stream) const;
+
+private:
+	// a piece of the map covered by one tap, with the handlers that may
+	// answer there depending on the state of the views
+	struct segment
+	{
+		struct candidate
+		{
+			size_t                              handler;
+			std::vector<memory_entry_context>   context;
+		};
+
+		offs_t                  start;
+		offs_t                  end;
+		std::vector<candidate>  candidates;
+	};
+
+	struct mode_state
+	{
+		std::vector<handler_stats>  handlers;
+		std::vector<segment>        segments;
+		std::vector<u64>            pages;
+		memory_passthrough_handler  taps;
+	};
+
+	mode_state &state(read_or_write mode) { return m_state[(mode == read_or_write::WRITE) ? 1 : 0]; }
+	const mode_state &state(read_or_write mode) const { return m_state[(mode == read_or_write::WRITE) ? 1 : 0]; }
+
+	void build(mode_state &state, const std::vector<memory_entry> &entries);
+	template <typename T> void install(read_or_write mode);
+	void count(mode_state &state, const segment &seg, offs_t address);
+
+	// internal state
+	address_space &             m_space;            // space being profiled
+	int                         m_page_shift;       // address bits per page
+	bool                        m_running;          // taps are installed
+	bool                        m_map_changed;      // map changed since start
+	bool                        m_installing;       // suppresses change notifications from our own taps
+	mode_state                  m_state[2];         // read and write statistics
+	util::notifier_subscription m_subscription;     // map change notifications
+};
+
+#endif // MAME_EMU_DEBUG_MEMPROF_H
@@ -12,6 +12,7 @@
 #include "points.h"
 #include "debugger.h"
 #include "debugcon.h"
+#include "reverse.h"
 
 
 //**************************************************************************
@@ -100,8 +101,16 @@ debug_watchpoint::debug_watchpoint(
 	m_length(length),
 	m_condition(symbols, condition ? condition : "1"),
 	m_action(action),
-	m_installing(false)
+	m_installing(false),
+	m_unconditional(!condition),
+	m_state(nullptr),
+	m_execute(nullptr),
+	m_log_next(0),
+	m_log_hits(0)
 {
+	debugInterface->device().interface(m_state);
+	debugInterface->device().interface(m_execute);
+
 	std::fill(std::begin(m_start_address), std::end(m_start_address), 0);
 	std::fill(std::begin(m_end_address), std::end(m_end_address), 0);
 	std::fill(std::begin(m_masks), std::end(m_masks), 0);
@@ -110,6 +119,7 @@ debug_watchpoint::debug_watchpoint(
 	endianness_t endian = m_space.endianness();
 	offs_t subamask = m_space.alignment() - 1;
 	offs_t unit_size = ashift <= 0 ? 8 << -ashift : 8 >> ashift;
+	m_unit_size = unit_size;
 	offs_t start = m_address;
 	offs_t end = (m_address + m_length - 1) & space.addrmask();
 	if (end < start)
@@ -206,6 +216,44 @@ void debug_watchpoint::setEnabled(bool value)
 	}
 }
 
+//-------------------------------------------------
+//  set_log_size - record up to the given number
+//  of hits instead of stopping, or stop again if
+//  zero
+//-------------------------------------------------
+
+void debug_watchpoint::set_log_size(size_t size)
+{
+	m_log.clear();
+	m_log.shrink_to_fit();
+	m_log.resize(size);
+	m_log_next = 0;
+	m_log_hits = 0;
+}
+
+
+//-------------------------------------------------
+//  logged_hits - get the recorded hits, oldest
+//  first
+//-------------------------------------------------
+
+std::vector<debug_watchpoint::hit_record> debug_watchpoint::logged_hits() const
+{
+	std::vector<hit_record> result;
+	if (m_log_hits > m_log.size())
+	{
+		// the log has wrapped, so the oldest entry is the next to be overwritten
+		result.reserve(m_log.size());
+		result.insert(result.end(), m_log.begin() + m_log_next, m_log.end());
+		result.insert(result.end(), m_log.begin(), m_log.begin() + m_log_next);
+	}
+	else
+	{
+		result.assign(m_log.begin(), m_log.begin() + m_log_next);
+	}
+	return result;
+}
+
 void debug_watchpoint::install(read_or_write mode)
 {
 	if (m_installing)
@@ -320,9 +368,8 @@ void debug_watchpoint::triggered(read_or_write type, offs_t address, u64 data, u
 
 	// adjust address, size & value_to_write based on mem_mask.
 	offs_t size = 0;
-	int ashift = m_space.addr_shift();
-	offs_t unit_size = ashift <= 0 ? 8 << -ashift : 8 >> ashift;
-	u64 unit_mask = make_bitmask<u64>(unit_size);
+	offs_t const unit_size = m_unit_size;
+	u64 const unit_mask = make_bitmask<u64>(unit_size);
 
 	offs_t address_offset = 0;
 
@@ -349,30 +396,57 @@ void debug_watchpoint::triggered(read_or_write type, offs_t address, u64 data, u
 	else
 		address += m_space.alignment() - size - address_offset;
 
-	// stash the value that will be written or has just been read
-	debug.cpu().set_wpinfo(address, data, size * unit_size);
-
-	// protect against recursion
-	debug.cpu().set_within_instruction(true);
-
 	// must satisfy the condition
-	if (!m_condition.is_empty())
+	if (!m_unconditional)
 	{
+		// stash the value that will be written or has just been read
+		debug.cpu().set_wpinfo(address, data, size * unit_size);
+
+		// protect against recursion
+		debug.cpu().set_within_instruction(true);
+
+		bool result;
 		try
 		{
-			if (!m_condition.execute())
-			{
-				debug.cpu().set_within_instruction(false);
-				return;
-			}
+			result = m_condition.execute();
 		}
 		catch (expression_error &)
 		{
-			debug.cpu().set_within_instruction(false);
-			return;
+			result = false;
 		}
+
+		debug.cpu().set_within_instruction(false);
+		if (!result)
+			return;
 	}
 
+	// while going back in time, only note the hit
+	if (debug.cpu().reverse().replaying())
+	{
+		debug.cpu().reverse().watchpoint_hit(m_debugInterface->device());
+		return;
+	}
+
+	// in logging mode, record the hit and carry on
+	if (!m_log.empty())
+	{
+		hit_record &entry = m_log[m_log_next];
+		entry.cycles = m_execute ? m_execute->total_cycles() : 0;
+		entry.pc = m_state ? m_state->pcbase() : 0;
+		entry.address = address;
+		entry.data = data;
+		entry.size = u8(size);
+		entry.type = type;
+		if (++m_log_next == m_log.size())
+			m_log_next = 0;
+		++m_log_hits;
+		return;
+	}
+
+	if (m_unconditional)
+		debug.cpu().set_wpinfo(address, data, size * unit_size);
+	debug.cpu().set_within_instruction(true);
+
 	// halt in the debugger by default
 	bool was_stopped = debug.cpu().is_stopped();
 	debug.cpu().set_execution_stopped();
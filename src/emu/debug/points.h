@@ -67,6 +67,17 @@ class debug_watchpoint
 	friend class device_debug;
 
 public:
+	// a hit recorded in logging mode
+	struct hit_record
+	{
+		u64                 cycles;     // total cycles executed by the device
+		offs_t              pc;         // PC of the accessing instruction
+		offs_t              address;    // address of the access
+		u64                 data;       // value read or written
+		u8                  size;       // access size in address units
+		read_or_write       type;       // read or write
+	};
+
 	// construction/destruction
 	debug_watchpoint(
 					device_debug* debugInterface,
@@ -90,9 +101,14 @@ public:
 	offs_t length() const { return m_length; }
 	const char *condition() const { return m_condition.original_string(); }
 	const std::string &action() const { return m_action; }
+	size_t log_size() const { return m_log.size(); }
+	u64 log_hits() const { return m_log_hits; }
+	std::vector<hit_record> logged_hits() const;
 
 	// setters
 	void setEnabled(bool value);
+	void set_log_size(size_t size);
+	void clear_log() { m_log_next = 0; m_log_hits = 0; }
 
 	// internals
 	bool hit(int type, offs_t address, int size);
@@ -118,6 +134,14 @@ private:
 	offs_t               m_end_address[3];           // the end addresses
 	u64                  m_masks[3];                 // the access masks
 	bool                 m_installing;               // prevent recursive multiple installs
+	bool                 m_unconditional;            // no condition to evaluate
+	offs_t               m_unit_size;                // bits per address unit
+
+	device_state_interface *m_state;                 // state interface for reading the PC
+	device_execute_interface *m_execute;             // execute interface for reading the cycle count
+	std::vector<hit_record> m_log;                   // hits recorded instead of stopping, if non-empty
+	size_t               m_log_next;                 // next entry to fill in the log
+	u64                  m_log_hits;                 // hits recorded since the log was last cleared
 };
 
 // ======================> debug_registerpoint
@@ -0,0 +1,454 @@
+// license:BSD-3-Clause
+// copyright-holders:Vas Crabb
+/*********************************************************************
+
+    reverse.cpp
+
+    Debugger reverse execution.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "reverse.h"
+
+#include "debugcon.h"
+#include "debugcpu.h"
+#include "debugger.h"
+
+
+//**************************************************************************
+//  DEBUG REVERSE EXECUTION
+//**************************************************************************
+
+//-------------------------------------------------
+//  debug_reverse - constructor
+//-------------------------------------------------
+
+debug_reverse::debug_reverse(running_machine &machine)
+	: m_machine(machine)
+	, m_device(nullptr)
+	, m_interval(DEFAULT_INTERVAL)
+	, m_budget(DEFAULT_BUDGET)
+	, m_bytes(0)
+	, m_shadow_state(nullptr)
+	, m_mode(mode::RECORD)
+	, m_position(0)
+	, m_capture_pending(false)
+	, m_capture_request(0)
+	, m_pending_load(-1)
+	, m_next_sync(0)
+	, m_target(0)
+	, m_search_end(0)
+	, m_search_index(0)
+	, m_search_hit(false)
+	, m_search_last(0)
+	, m_origin(0)
+{
+}
+
+
+//-------------------------------------------------
+//  ~debug_reverse - destructor
+//-------------------------------------------------
+
+debug_reverse::~debug_reverse()
+{
+	// release the states before the byte count they update
+	m_checkpoints.clear();
+}
+
+
+//-------------------------------------------------
+//  start - start recording a device, discarding
+//  any existing checkpoints
+//-------------------------------------------------
+
+void debug_reverse::start(device_t &device, u64 interval, size_t budget)
+{
+	stop();
+	m_device = &device;
+	m_interval = interval;
+	m_budget = budget;
+}
+
+
+//-------------------------------------------------
+//  stop - stop recording and discard all
+//  checkpoints
+//-------------------------------------------------
+
+void debug_reverse::stop()
+{
+	m_checkpoints.clear();
+	m_shadow.clear();
+	m_shadow.shrink_to_fit();
+	m_shadow_state = nullptr;
+
+	m_device = nullptr;
+	m_mode = mode::RECORD;
+	m_position = 0;
+	m_capture_pending = false;
+	m_pending_load = -1;
+	m_next_sync = 0;
+}
+
+
+//-------------------------------------------------
+//  step_back - go back the given number of
+//  instructions, or to the oldest checkpoint if
+//  they don't go back that far
+//-------------------------------------------------
+
+bool debug_reverse::step_back(u64 count)
+{
+	if (!check_stopped())
+		return false;
+
+	// the instruction we're stopped at has been counted
+	u64 const current = m_position - 1;
+	u64 const oldest = m_checkpoints.front().position;
+	if (current == oldest)
+	{
+		m_machine.debugger().console().printf("Already at the oldest checkpoint\n");
+		return false;
+	}
+	u64 const target = (count > (current - oldest)) ? oldest : (current - count);
+
+	m_origin = current;
+	request_load(find_checkpoint(target));
+	replay(target, string_format("Stepped back %d instructions\n", current - target));
+	m_machine.debugger().cpu().set_execution_running();
+	return true;
+}
+
+
+//-------------------------------------------------
+//  reverse_continue - go back to the previous
+//  breakpoint or watchpoint hit, or to the oldest
+//  checkpoint if there isn't one
+//-------------------------------------------------
+
+bool debug_reverse::reverse_continue()
+{
+	if (!check_stopped())
+		return false;
+
+	u64 const current = m_position - 1;
+	if (current == m_checkpoints.front().position)
+	{
+		m_machine.debugger().console().printf("Already at the oldest checkpoint\n");
+		return false;
+	}
+
+	// search from the newest checkpoint before the current instruction
+	m_origin = current;
+	m_mode = mode::SEARCH;
+	m_search_end = current;
+	m_search_index = find_checkpoint(current - 1);
+	m_search_hit = false;
+	request_load(m_search_index);
+	m_machine.debugger().cpu().set_execution_running();
+	return true;
+}
+
+
+//-------------------------------------------------
+//  instruction_hook - count an instruction and
+//  act on it, returning true if the debugger
+//  should otherwise ignore it
+//-------------------------------------------------
+
+bool debug_reverse::instruction_hook(device_t &device, offs_t curpc)
+{
+	if (!m_device)
+		return false;
+
+	// other devices are left alone while we're going back
+	if (&device != m_device)
+		return replaying();
+
+	// nothing counts until a pending checkpoint has been loaded
+	if (m_pending_load >= 0)
+		return true;
+
+	debugger_cpu &debugcpu = m_machine.debugger().cpu();
+	u64 const position = m_position++;
+	switch (m_mode)
+	{
+	case mode::RECORD:
+		if (!m_capture_pending && (m_checkpoints.empty() || (position >= (m_checkpoints.back().request + m_interval))))
+		{
+			m_capture_pending = true;
+			m_capture_request = position;
+			request_sync();
+		}
+		return false;
+
+	case mode::REPLAY:
+		if (debugcpu.is_stopped() || (position == m_target))
+		{
+			stop_at(position, position != m_target);
+			return false;
+		}
+		break;
+
+	case mode::SEARCH:
+		if (debugcpu.is_stopped())
+		{
+			stop_at(position, true);
+			return false;
+		}
+		if (position == m_search_end)
+		{
+			finish_search();
+			return true;
+		}
+		if (device.debug()->breakpoint_test(curpc))
+		{
+			m_search_hit = true;
+			m_search_last = position;
+		}
+		break;
+	}
+
+	// cut timeslices short where they were when the checkpoints were captured
+	if ((m_checkpoints.size() > m_next_sync) && (m_checkpoints[m_next_sync].request == position))
+	{
+		m_machine.scheduler().abort_timeslice();
+		++m_next_sync;
+	}
+	return true;
+}
+
+
+//-------------------------------------------------
+//  watchpoint_hit - note a watchpoint hit while
+//  searching
+//-------------------------------------------------
+
+void debug_reverse::watchpoint_hit(device_t &device)
+{
+	// the access belongs to the instruction last counted
+	if ((&device == m_device) && (m_mode == mode::SEARCH) && (m_pending_load < 0) && m_position && ((m_position - 1) < m_search_end))
+	{
+		m_search_hit = true;
+		m_search_last = m_position - 1;
+	}
+}
+
+
+//-------------------------------------------------
+//  timeslice_boundary - capture or load a
+//  checkpoint between timeslices
+//-------------------------------------------------
+
+void debug_reverse::timeslice_boundary()
+{
+	if (!m_device)
+		return;
+
+	if (m_pending_load >= 0)
+	{
+		checkpoint const &cp = m_checkpoints[m_pending_load];
+		save_error const err = cp.state->load();
+		if (err != STATERR_NONE)
+		{
+			m_machine.debugger().console().printf("Error %d loading checkpoint, reverse execution stopped\n", int(err));
+			stop();
+			m_machine.debugger().cpu().set_execution_stopped();
+			return;
+		}
+		m_position = cp.position;
+		m_next_sync = m_pending_load + 1;
+		m_pending_load = -1;
+		m_capture_pending = false;
+
+		// tracking data and history describe instructions that haven't run any more
+		for (device_t &device : device_enumerator(m_machine.root_device()))
+		{
+			device.debug()->track_pc_data_clear();
+			device.debug()->track_mem_data_clear();
+		}
+		m_device->debug()->history_clear();
+	}
+	else if (m_capture_pending)
+	{
+		m_capture_pending = false;
+		capture();
+	}
+}
+
+
+//-------------------------------------------------
+//  check_stopped - make sure we can go back from
+//  here, complaining if not
+//-------------------------------------------------
+
+bool debug_reverse::check_stopped()
+{
+	debugger_console &console = m_machine.debugger().console();
+	debugger_cpu &debugcpu = m_machine.debugger().cpu();
+	if (!m_device)
+	{
+		console.printf("Reverse execution is not enabled\n");
+		return false;
+	}
+	if (!debugcpu.is_stopped() || (debugcpu.live_cpu() != m_device) || replaying())
+	{
+		console.printf("Execution must be stopped on CPU '%s' to go back\n", m_device->tag());
+		return false;
+	}
+	if (!m_position || m_checkpoints.empty() || ((m_position - 1) < m_checkpoints.front().position))
+	{
+		console.printf("No checkpoints to go back to\n");
+		return false;
+	}
+	return true;
+}
+
+
+//-------------------------------------------------
+//  find_checkpoint - get the newest checkpoint at
+//  or before an instruction
+//-------------------------------------------------
+
+int debug_reverse::find_checkpoint(u64 position) const
+{
+	int index = m_checkpoints.size() - 1;
+	while ((index > 0) && (m_checkpoints[index].position > position))
+		--index;
+	return index;
+}
+
+
+//-------------------------------------------------
+//  request_sync - end the current timeslice so
+//  pending work can be done
+//-------------------------------------------------
+
+void debug_reverse::request_sync()
+{
+	m_machine.scheduler().abort_timeslice();
+	m_machine.request_debug_sync();
+}
+
+
+//-------------------------------------------------
+//  request_load - load a checkpoint at the end
+//  of the current timeslice
+//-------------------------------------------------
+
+void debug_reverse::request_load(int index)
+{
+	m_pending_load = index;
+	request_sync();
+}
+
+
+//-------------------------------------------------
+//  capture - capture a checkpoint, sharing
+//  unchanged pages with the previous one
+//-------------------------------------------------
+
+void debug_reverse::capture()
+{
+	save_manager &save = m_machine.save();
+	ram_state const *const reference = m_checkpoints.empty() ? nullptr : m_checkpoints.back().state.get();
+	if (m_shadow.empty())
+		m_shadow.resize(ram_state::get_size(save));
+	if (reference && (reference != m_shadow_state))
+		reference->decode(m_shadow.data());
+
+	auto state = std::make_unique<ram_state>(save, &m_bytes);
+	save_error const err = state->save(reference, m_shadow.data());
+	if (err != STATERR_NONE)
+	{
+		m_machine.debugger().console().printf("Error %d capturing checkpoint, reverse execution stopped\n", int(err));
+		state.reset();
+		stop();
+		return;
+	}
+	m_shadow_state = state.get();
+	m_checkpoints.emplace_back(checkpoint{ std::move(state), m_capture_request, m_position });
+
+	// drop the oldest checkpoints to stay within budget; newer checkpoints store
+	// deltas against their pages, so the new oldest one is flattened to let them go
+	while ((m_bytes > (m_budget << 20)) && (m_checkpoints.size() > 1))
+	{
+		m_checkpoints.pop_front();
+		m_checkpoints.front().state->flatten();
+	}
+}
+
+
+//-------------------------------------------------
+//  replay - run forward to an instruction once
+//  the pending checkpoint has been loaded
+//-------------------------------------------------
+
+void debug_reverse::replay(u64 target, std::string &&message)
+{
+	m_mode = mode::REPLAY;
+	m_target = target;
+	m_message = std::move(message);
+}
+
+
+//-------------------------------------------------
+//  finish_search - act on the end of a search
+//  segment
+//-------------------------------------------------
+
+void debug_reverse::finish_search()
+{
+	if (m_search_hit)
+	{
+		// go to the last hit in this segment
+		request_load(m_search_index);
+		replay(m_search_last, string_format("Reversed %d instructions to the previous breakpoint or watchpoint hit\n", m_origin - m_search_last));
+	}
+	else if (m_search_index > 0)
+	{
+		// try the segment before
+		m_search_end = m_checkpoints[m_search_index].position;
+		request_load(--m_search_index);
+	}
+	else
+	{
+		// nothing found, so settle for the oldest checkpoint
+		request_load(0);
+		replay(m_checkpoints.front().position, string_format("No previous breakpoint or watchpoint hit, reversed %d instructions to the oldest checkpoint\n", m_origin - m_checkpoints.front().position));
+	}
+}
+
+
+//-------------------------------------------------
+//  stop_at - stop going back at an instruction
+//-------------------------------------------------
+
+void debug_reverse::stop_at(u64 position, bool interrupted)
+{
+	m_mode = mode::RECORD;
+	discard_after(position);
+	m_machine.debugger().cpu().set_execution_stopped();
+	if (interrupted)
+		m_machine.debugger().console().printf("Reverse execution interrupted %d instructions back\n", m_origin - position);
+	else
+		m_machine.debugger().console().printf("%s", m_message);
+}
+
+
+//-------------------------------------------------
+//  discard_after - discard checkpoints captured
+//  after an instruction
+//-------------------------------------------------
+
+void debug_reverse::discard_after(u64 position)
+{
+	while (!m_checkpoints.empty() && (m_checkpoints.back().position > position))
+	{
+		if (m_checkpoints.back().state.get() == m_shadow_state)
+			m_shadow_state = nullptr;
+		m_checkpoints.pop_back();
+	}
+}
@@ -0,0 +1,136 @@
+// license:BSD-3-Clause
+// copyright-holders:Vas Crabb
+/*********************************************************************
+
+    reverse.h
+
+    Debugger reverse execution.
+
+**********************************************************************
+
+    Reverse execution follows one CPU.  Its instructions are numbered
+    from the point recording started, and every so many instructions a
+    checkpoint of the whole machine is captured using the same RAM
+    states as the rewinder.  Checkpoints are only captured and loaded
+    between timeslices, where the scheduler is in a consistent state:
+    when one is due, the current timeslice is cut short and the work
+    is done once it ends.
+
+    Going back loads the newest checkpoint before the target and runs
+    the machine forward again until the target instruction is reached,
+    with breakpoints and watchpoints ignored on the way.  Timeslices
+    are cut short at the same instructions as when the checkpoints
+    were captured, so the machine is scheduled the same way.  Going
+    back to the previous breakpoint or watchpoint hit runs forward from
+    each checkpoint in turn, newest first, noting hits until one is
+    found.
+
+    Inputs are not recorded, and changes made from the debugger are not
+    replayed, so going back past either may not reproduce what
+    happened.  Checkpoints after the instruction going back stops at
+    are discarded, as execution may take a different path from there.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_DEBUG_REVERSE_H
+#define MAME_EMU_DEBUG_REVERSE_H
+
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// ======================> debug_reverse
+
+class debug_reverse
+{
+public:
+	static constexpr u64 DEFAULT_INTERVAL = 200'000;
+	static constexpr size_t DEFAULT_BUDGET = 256;   // megabytes
+
+	// construction/destruction
+	debug_reverse(running_machine &machine);
+	~debug_reverse();
+
+	// getters
+	device_t *device() const { return m_device; }
+	bool replaying() const { return m_device && ((m_mode != mode::RECORD) || (m_pending_load >= 0)); }
+	u64 interval() const { return m_interval; }
+	size_t budget() const { return m_budget; }
+	size_t memory_used() const { return m_bytes; }
+	size_t checkpoint_count() const { return m_checkpoints.size(); }
+	u64 position() const { return m_position; }
+	u64 oldest_position() const { return m_checkpoints.empty() ? m_position : m_checkpoints.front().position; }
+
+	// recording control
+	void start(device_t &device, u64 interval, size_t budget);
+	void stop();
+
+	// going back; these must be called while stopped on the recorded device
+	bool step_back(u64 count);
+	bool reverse_continue();
+
+	// hooks
+	bool instruction_hook(device_t &device, offs_t curpc);
+	void watchpoint_hit(device_t &device);
+	void timeslice_boundary();
+
+private:
+	enum class mode
+	{
+		RECORD,     // capturing checkpoints as execution proceeds
+		REPLAY,     // running forward to a target instruction
+		SEARCH      // running forward looking for breakpoint and watchpoint hits
+	};
+
+	// a captured machine state
+	struct checkpoint
+	{
+		std::unique_ptr<ram_state> state;   // machine state
+		u64             request;            // instruction at which the capture was requested
+		u64             position;           // instruction executed next after the capture
+	};
+
+	bool check_stopped();
+	int find_checkpoint(u64 position) const;
+	void request_sync();
+	void request_load(int index);
+	void capture();
+	void replay(u64 target, std::string &&message);
+	void finish_search();
+	void stop_at(u64 position, bool interrupted);
+	void discard_after(u64 position);
+
+	// internal state
+	running_machine &       m_machine;          // reference to our machine
+	device_t *              m_device;           // device being recorded, or nullptr
+	u64                     m_interval;         // instructions between checkpoints
+	size_t                  m_budget;           // memory checkpoints can occupy, in megabytes
+	size_t                  m_bytes;            // memory held by checkpoint pages
+	std::deque<checkpoint>  m_checkpoints;      // checkpoints, oldest first
+	std::vector<u8>         m_shadow;           // decoded contents of the newest checkpoint
+	const ram_state *       m_shadow_state;     // state the shadow buffer holds
+
+	mode                    m_mode;             // what we're doing
+	u64                     m_position;         // number of instructions seen so far
+	bool                    m_capture_pending;  // capture a checkpoint at the end of the timeslice
+	u64                     m_capture_request;  // instruction at which the capture was requested
+	int                     m_pending_load;     // checkpoint to load at the end of the timeslice
+	size_t                  m_next_sync;        // next checkpoint whose timeslice cut is replayed
+	u64                     m_target;           // instruction to stop at when replaying
+	u64                     m_search_end;       // instruction the current search segment ends at
+	int                     m_search_index;     // checkpoint the current search segment starts at
+	bool                    m_search_hit;       // a hit was found in the current search segment
+	u64                     m_search_last;      // the last hit found in the current search segment
+	u64                     m_origin;           // instruction going back started from
+	std::string             m_message;          // message to show once the target is reached
+};
+
+#endif // MAME_EMU_DEBUG_REVERSE_H
@@ -865,6 +865,11 @@ template <typename Result, std::make_unsigned_t<Result> DefaultMask>
 Result devcb_read<Result, DefaultMask>::operator()(offs_t offset, std::make_unsigned_t<Result> mem_mask)
 {
 	assert(m_creators.empty() && !m_functions.empty());
+
+	// unconnected inputs are common, so don't call through a function object for them
+	if (m_unset)
+		return m_default;
+
 	typename std::vector<func_t>::const_iterator it(m_functions.begin());
 	std::make_unsigned_t<Result> result((*it)(offset, mem_mask));
 	while (m_functions.end() != ++it)
@@ -2249,6 +2254,11 @@ template <typename Input, std::make_unsigned_t<Input> DefaultMask>
 void devcb_write<Input, DefaultMask>::operator()(offs_t offset, Input data, std::make_unsigned_t<Input> mem_mask)
 {
 	assert(m_creators.empty() && !m_functions.empty());
+
+	// unconnected outputs are common, so don't call through a function object for them
+	if (m_unset)
+		return;
+
 	typename std::vector<func_t>::const_iterator it(m_functions.begin());
 	(*it)(offset, data, mem_mask);
 	while (m_functions.end() != ++it)
@@ -69,6 +69,9 @@ device_execute_interface::device_execute_interface(const machine_config &mconfig
 	, m_cycles_per_second(0)
 	, m_attoseconds_per_cycle(0)
 	, m_spin_end_timer(nullptr)
+	, m_debug_hook_pages(nullptr)
+	, m_debug_hook_mask(0)
+	, m_debug_hook_shift(0)
 {
 	memset(&m_localtime, 0, sizeof(m_localtime));
 
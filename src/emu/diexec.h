@@ -94,6 +94,7 @@ typedef device_delegate<int (device_t &, int)> device_irq_acknowledge_delegate;
 class device_execute_interface : public device_interface
 {
 	friend class device_scheduler;
+	friend class device_debug;
 	friend class testcpu_state;
 
 public:
@@ -227,7 +228,8 @@ protected:
 	bool debugger_enabled() const { return bool(device().machine().debug_flags & DEBUG_FLAG_ENABLED); }
 	void debugger_instruction_hook(offs_t curpc)
 	{
-		if (device().machine().debug_flags & DEBUG_FLAG_CALL_HOOK)
+		u32 const flags = device().machine().debug_flags;
+		if ((flags & DEBUG_FLAG_CALL_HOOK) && (!(flags & DEBUG_FLAG_HOOK_PAGES) || debugger_hook_page(curpc)))
 			device().debug()->instruction_hook(curpc);
 	}
 	void debugger_exception_hook(int exception)
@@ -328,6 +330,13 @@ private:
 	emu_timer *             m_spin_end_timer;           // timer for triggering the end of spin_until_time
 	emu_timer *             m_pulse_end_timers[MAX_INPUT_LINES]; // timer for ending input-line pulses
 
+	// pages the debugger needs to see when it doesn't need every instruction
+	const u8 *              m_debug_hook_pages;         // one bit per page, owned by device_debug
+	offs_t                  m_debug_hook_mask;          // mask applied to the PC first
+	u8                      m_debug_hook_shift;         // address bits per page
+
+	bool debugger_hook_page(offs_t pc) const { offs_t const page = (pc & m_debug_hook_mask) >> m_debug_hook_shift; return BIT(m_debug_hook_pages[page >> 3], page & 7); }
+
 	// callbacks
 	TIMER_CALLBACK_MEMBER(timed_trigger_callback) { trigger(param); }
 
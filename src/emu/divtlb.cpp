@@ -37,7 +37,9 @@ device_vtlb_interface::device_vtlb_interface(const machine_config &mconfig, devi
 		m_dynindex(0),
 		m_pageshift(0),
 		m_addrwidth(0),
-		m_table_base(nullptr)
+		m_table_base(nullptr),
+		m_fill_count(0),
+		m_flush_count(0)
 {
 }
 
@@ -167,6 +169,7 @@ bool device_vtlb_interface::vtlb_fill(offs_t address, offs_t taddress, int inten
 	if ((entry & FLAGS_MASK) == 0)
 	{
 		int liveindex = m_dynindex;
+		m_fill_count++;
 
 		m_dynindex = (m_dynindex + 1) % m_dynamic;
 
@@ -268,6 +271,7 @@ void device_vtlb_interface::vtlb_dynload(u32 index, offs_t address, vtlb_entry v
 	}
 
 	int liveindex = m_dynindex;
+	m_fill_count++;
 
 	m_dynindex = (m_dynindex + 1) % m_dynamic;
 
@@ -305,6 +309,7 @@ void device_vtlb_interface::vtlb_flush_dynamic()
 #if PRINTF_TLB
 	osd_printf_debug("vtlb_flush_dynamic\n");
 #endif
+	m_flush_count++;
 
 	// loop over live entries and release them from the table
 	for (int liveindex = 0; liveindex < m_dynamic; liveindex++)
@@ -62,6 +62,10 @@ public:
 	// accessors
 	const vtlb_entry *vtlb_table() const;
 
+	// statistics
+	u64 vtlb_fill_count() const { return m_fill_count; }
+	u64 vtlb_flush_count() const { return m_flush_count; }
+
 protected:
 	// interface-level overrides
 	virtual void interface_validity_check(validity_checker &valid) const override;
@@ -82,6 +86,10 @@ private:
 	std::vector<vtlb_entry> m_table;        // table of entries by address
 	std::vector<offs_t> m_refcnt;           // table of entry reference counts by address
 	vtlb_entry          *m_table_base;      // pointer to m_table[0]
+
+	// statistics
+	u64                 m_fill_count;       // number of dynamic entries filled in (misses)
+	u64                 m_flush_count;      // number of dynamic flushes
 };
 
 
@@ -11,11 +11,113 @@
 #include "emu.h"
 #include "drawgfxt.ipp"
 
+#include "video/simd.h"
+
 
 /***************************************************************************
     INLINE FUNCTIONS
 ***************************************************************************/
 
+/*-------------------------------------------------
+    rebase_opaque_row - render a run of 8bpp
+    source pixels to a 16bpp row, adding a color
+    base; returns the number of pixels rendered,
+    always a multiple of 16
+-------------------------------------------------*/
+
+static inline u32 rebase_opaque_row(u16 *dest, const u8 *src, u32 count, u16 color)
+{
+#if defined(MAME_SIMD_SSE2)
+	u32 const blocks = count & ~u32(15);
+	__m128i const base = _mm_set1_epi16(s16(color));
+	__m128i const zero = _mm_setzero_si128();
+	for (u32 x = 0; x < blocks; x += 16)
+	{
+		__m128i const pix = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&src[x]));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[x]), _mm_add_epi16(_mm_unpacklo_epi8(pix, zero), base));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[x + 8]), _mm_add_epi16(_mm_unpackhi_epi8(pix, zero), base));
+	}
+	return blocks;
+#elif defined(MAME_SIMD_NEON)
+	u32 const blocks = count & ~u32(15);
+	uint16x8_t const base = vdupq_n_u16(color);
+	for (u32 x = 0; x < blocks; x += 16)
+	{
+		uint8x16_t const pix = vld1q_u8(&src[x]);
+		vst1q_u16(&dest[x], vaddw_u8(base, vget_low_u8(pix)));
+		vst1q_u16(&dest[x + 8], vaddw_u8(base, vget_high_u8(pix)));
+	}
+	return blocks;
+#else
+	return 0;
+#endif
+}
+
+
+/*-------------------------------------------------
+    rebase_transpen_row - render a run of 8bpp
+    source pixels to a 16bpp row, adding a color
+    base and skipping a single transparent pen;
+    returns the number of pixels rendered, always
+    a multiple of 16
+-------------------------------------------------*/
+
+static inline u32 rebase_transpen_row(u16 *dest, const u8 *src, u32 count, u16 color, u8 trans_pen)
+{
+#if defined(MAME_SIMD_SSE2)
+	u32 const blocks = count & ~u32(15);
+	__m128i const base = _mm_set1_epi16(s16(color));
+	__m128i const trans = _mm_set1_epi8(s8(trans_pen));
+	__m128i const zero = _mm_setzero_si128();
+	for (u32 x = 0; x < blocks; x += 16)
+	{
+		__m128i const pix = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&src[x]));
+		__m128i const transmask = _mm_cmpeq_epi8(pix, trans);
+		int const transbits = _mm_movemask_epi8(transmask);
+
+		// skip runs that are entirely transparent, which is common for sprites
+		if (transbits == 0xffff)
+			continue;
+
+		__m128i const lo = _mm_add_epi16(_mm_unpacklo_epi8(pix, zero), base);
+		__m128i const hi = _mm_add_epi16(_mm_unpackhi_epi8(pix, zero), base);
+		__m128i *const destptr = reinterpret_cast<__m128i *>(&dest[x]);
+		if (!transbits)
+		{
+			_mm_storeu_si128(destptr, lo);
+			_mm_storeu_si128(destptr + 1, hi);
+		}
+		else
+		{
+			__m128i const masklo = _mm_unpacklo_epi8(transmask, transmask);
+			__m128i const maskhi = _mm_unpackhi_epi8(transmask, transmask);
+			__m128i const oldlo = _mm_loadu_si128(destptr);
+			__m128i const oldhi = _mm_loadu_si128(destptr + 1);
+			_mm_storeu_si128(destptr, _mm_or_si128(_mm_and_si128(masklo, oldlo), _mm_andnot_si128(masklo, lo)));
+			_mm_storeu_si128(destptr + 1, _mm_or_si128(_mm_and_si128(maskhi, oldhi), _mm_andnot_si128(maskhi, hi)));
+		}
+	}
+	return blocks;
+#elif defined(MAME_SIMD_NEON)
+	u32 const blocks = count & ~u32(15);
+	uint16x8_t const base = vdupq_n_u16(color);
+	uint8x16_t const trans = vdupq_n_u8(trans_pen);
+	for (u32 x = 0; x < blocks; x += 16)
+	{
+		uint8x16_t const pix = vld1q_u8(&src[x]);
+		uint8x16_t const transmask = vceqq_u8(pix, trans);
+		uint16x8_t const masklo = vreinterpretq_u16_s16(vmovl_s8(vreinterpret_s8_u8(vget_low_u8(transmask))));
+		uint16x8_t const maskhi = vreinterpretq_u16_s16(vmovl_s8(vreinterpret_s8_u8(vget_high_u8(transmask))));
+		vst1q_u16(&dest[x], vbslq_u16(masklo, vld1q_u16(&dest[x]), vaddw_u8(base, vget_low_u8(pix))));
+		vst1q_u16(&dest[x + 8], vbslq_u16(maskhi, vld1q_u16(&dest[x + 8]), vaddw_u8(base, vget_high_u8(pix))));
+	}
+	return blocks;
+#else
+	return 0;
+#endif
+}
+
+
 /*-------------------------------------------------
     readbit - read a single bit from a base
     offset
@@ -95,6 +197,7 @@ gfx_element::gfx_element(device_palette_interface *palette, u8 *base, u16 width,
 		m_dirtyseq(1),
 		m_gfxdata(base),
 		m_layout_is_raw(true),
+		m_layout_is_packed(false),
 		m_layout_planes(0),
 		m_layout_xormask(0),
 		m_layout_charincrement(0)
@@ -120,6 +223,7 @@ gfx_element::gfx_element(device_palette_interface *palette, const gfx_layout &gl
 		m_dirtyseq(1),
 		m_gfxdata(nullptr),
 		m_layout_is_raw(false),
+		m_layout_is_packed(false),
 		m_layout_planes(0),
 		m_layout_xormask(xormask),
 		m_layout_charincrement(0)
@@ -146,6 +250,7 @@ void gfx_element::set_layout(const gfx_layout &gl, const u8 *srcdata)
 
 	// copy data from the layout
 	m_layout_is_raw = (gl.planeoffset[0] == GFX_RAW);
+	m_layout_is_packed = false;
 	m_layout_planes = gl.planes;
 	m_layout_charincrement = gl.charincrement;
 
@@ -182,6 +287,20 @@ void gfx_element::set_layout(const gfx_layout &gl, const u8 *srcdata)
 		for (int x = 0; x < m_width; x++)
 			m_layout_xoffset[x] = gl.xoffs(x);
 
+		// packed 4bpp and 8bpp layouts can be decoded a pixel at a time
+		if ((m_layout_planes == 4) || (m_layout_planes == 8))
+		{
+			u32 const align = m_layout_planes - 1;
+			bool packed = !(m_layout_planeoffset[0] & align) && !(m_layout_charincrement & align);
+			for (int p = 1; packed && (p < m_layout_planes); p++)
+				packed = (m_layout_planeoffset[p] == (m_layout_planeoffset[0] + p));
+			for (int y = 0; packed && (y < m_height); y++)
+				packed = !(m_layout_yoffset[y] & align);
+			for (int x = 0; packed && (x < m_width); x++)
+				packed = !(m_layout_xoffset[x] & align);
+			m_layout_is_packed = packed;
+		}
+
 		// we get to pick our own modulos
 		m_line_modulo = m_origwidth;
 		m_char_modulo = m_line_modulo * m_origheight;
@@ -291,28 +410,56 @@ void gfx_element::decode(u32 code)
 	// don't decode GFX_RAW
 	if (!m_layout_is_raw)
 	{
-		// zap the data to 0
 		u8 *decode_base = m_gfxdata + code * m_char_modulo;
-		memset(decode_base, 0, m_char_modulo);
 
-		// iterate over planes
-		int plane, planebit;
-		for (plane = 0, planebit = 1 << (m_layout_planes - 1);
-				plane < m_layout_planes;
-				plane++, planebit >>= 1)
+		// the xor mask is set after the layout, so check it hasn't split pixels
+		if (m_layout_is_packed && !(m_layout_xormask & (m_layout_planes - 1)))
 		{
-			int planeoffs = code * m_layout_charincrement + m_layout_planeoffset[plane];
-
-			// iterate over rows
+			int const charoffs = code * m_layout_charincrement + m_layout_planeoffset[0];
 			for (int y = 0; y < m_origheight; y++)
 			{
-				int yoffs = planeoffs + m_layout_yoffset[y];
-				u8 *dp = decode_base + y * m_line_modulo;
-
-				// iterate over columns
-				for (int x = 0; x < m_origwidth; x++)
-					if (readbit(m_srcdata, (yoffs + m_layout_xoffset[x]) ^ m_layout_xormask))
-						dp[x] |= planebit;
+				int const yoffs = charoffs + m_layout_yoffset[y];
+				u8 *const dp = decode_base + y * m_line_modulo;
+				if (m_layout_planes == 8)
+				{
+					for (int x = 0; x < m_origwidth; x++)
+						dp[x] = m_srcdata[((yoffs + m_layout_xoffset[x]) ^ m_layout_xormask) / 8];
+				}
+				else
+				{
+					// plane 0 is the most significant bit, and comes first in the source
+					for (int x = 0; x < m_origwidth; x++)
+					{
+						u32 const bitnum = (yoffs + m_layout_xoffset[x]) ^ m_layout_xormask;
+						dp[x] = (m_srcdata[bitnum / 8] >> (~bitnum & 4)) & 0x0f;
+					}
+				}
+			}
+		}
+		else
+		{
+			// zap the data to 0
+			memset(decode_base, 0, m_char_modulo);
+
+			// iterate over planes
+			int plane, planebit;
+			for (plane = 0, planebit = 1 << (m_layout_planes - 1);
+					plane < m_layout_planes;
+					plane++, planebit >>= 1)
+			{
+				int planeoffs = code * m_layout_charincrement + m_layout_planeoffset[plane];
+
+				// iterate over rows
+				for (int y = 0; y < m_origheight; y++)
+				{
+					int yoffs = planeoffs + m_layout_yoffset[y];
+					u8 *dp = decode_base + y * m_line_modulo;
+
+					// iterate over columns
+					for (int x = 0; x < m_origwidth; x++)
+						if (readbit(m_srcdata, (yoffs + m_layout_xoffset[x]) ^ m_layout_xormask))
+							dp[x] |= planebit;
+				}
 			}
 		}
 	}
@@ -354,7 +501,9 @@ void gfx_element::opaque(bitmap_ind16 &dest, const rectangle &cliprect,
 {
 	color = colorbase() + granularity() * (color % colors());
 	code %= elements();
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, [color](u16 &destp, const u8 &srcp) { PIXEL_OP_REBASE_OPAQUE(destp, srcp); });
+	drawgfx_core_rows(dest, cliprect, code, flipx, flipy, destx, desty,
+			[color](u16 &destp, const u8 &srcp) { PIXEL_OP_REBASE_OPAQUE(destp, srcp); },
+			[color](u16 *destp, const u8 *srcp, u32 count) { return rebase_opaque_row(destp, srcp, count, color); });
 }
 
 void gfx_element::opaque(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -395,7 +544,9 @@ void gfx_element::transpen(bitmap_ind16 &dest, const rectangle &cliprect,
 
 	// render
 	color = colorbase() + granularity() * (color % colors());
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, [trans_pen, color](u16 &destp, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN(destp, srcp); });
+	drawgfx_core_rows(dest, cliprect, code, flipx, flipy, destx, desty,
+			[trans_pen, color](u16 &destp, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN(destp, srcp); },
+			[trans_pen, color](u16 *destp, const u8 *srcp, u32 count) { return rebase_transpen_row(destp, srcp, count, color, trans_pen); });
 }
 
 void gfx_element::transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -442,7 +593,18 @@ void gfx_element::transpen_raw(bitmap_ind16 &dest, const rectangle &cliprect,
 		return;
 
 	// render
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, [trans_pen, color](u16 &destp, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN(destp, srcp); });
+	if (trans_pen > 0xff)
+	{
+		drawgfx_core_rows(dest, cliprect, code, flipx, flipy, destx, desty,
+				[trans_pen, color](u16 &destp, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN(destp, srcp); },
+				[color](u16 *destp, const u8 *srcp, u32 count) { return rebase_opaque_row(destp, srcp, count, color); });
+	}
+	else
+	{
+		drawgfx_core_rows(dest, cliprect, code, flipx, flipy, destx, desty,
+				[trans_pen, color](u16 &destp, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN(destp, srcp); },
+				[trans_pen, color](u16 *destp, const u8 *srcp, u32 count) { return rebase_transpen_row(destp, srcp, count, color, trans_pen); });
+	}
 }
 
 void gfx_element::transpen_raw(bitmap_rgb32 &dest, const rectangle &cliprect,
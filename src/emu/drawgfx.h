@@ -167,6 +167,7 @@ public:
 	u32 rowbytes() const { return m_line_modulo; }
 	bool has_pen_usage() const { return !m_pen_usage.empty(); }
 	bool has_palette() const { return m_palette; }
+	size_t allocated_bytes() const { return m_gfxdata_allocated.size() + m_dirty.size() + (m_pen_usage.size() * sizeof(u32)); }
 
 	// used by tilemaps
 	u32 dirtyseq() const { return m_dirtyseq; }
@@ -205,6 +206,7 @@ public:
 
 	// core drawgfx implementation
 	template <typename BitmapType, typename FunctionClass> void drawgfx_core(BitmapType &dest, const rectangle &cliprect, u32 code, int flipx, int flipy, s32 destx, s32 desty, FunctionClass pixel_op);
+	template <typename BitmapType, typename FunctionClass, typename RowFunctionClass> void drawgfx_core_rows(BitmapType &dest, const rectangle &cliprect, u32 code, int flipx, int flipy, s32 destx, s32 desty, FunctionClass pixel_op, RowFunctionClass row_op);
 
 	// specific drawgfx implementations for each transparency type
 	void opaque(bitmap_ind16 &dest, const rectangle &cliprect, u32 code, u32 color, int flipx, int flipy, s32 destx, s32 desty);
@@ -311,6 +313,7 @@ private:
 	std::vector<u32>  m_pen_usage;      // bitmask of pens that are used (pens 0-31 only)
 
 	bool            m_layout_is_raw;        // raw layout?
+	bool            m_layout_is_packed;     // each pixel's planes are one aligned nibble or byte?
 	u8              m_layout_planes;        // bit planes in the layout
 	u32             m_layout_xormask;       // xor mask applied to each bit offset
 	u32             m_layout_charincrement; // per-character increment in source data
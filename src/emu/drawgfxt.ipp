@@ -415,11 +415,22 @@ while (0)
         s32 destx - the top-left X coordinate to render to
         s32 desty - the top-left Y coordinate to render to
         bitmap_t &priority - the priority bitmap (if and only if priority is to be applied)
+
+    The row variant additionally takes a row_op that is offered each
+    non-flipped row first; it returns the number of leading pixels it
+    rendered (used for vectorised kernels), and pixel_op handles the rest.
 */
 
 
 template <typename BitmapType, typename FunctionClass>
 inline void gfx_element::drawgfx_core(BitmapType &dest, const rectangle &cliprect, u32 code, int flipx, int flipy, s32 destx, s32 desty, FunctionClass pixel_op)
+{
+	drawgfx_core_rows(dest, cliprect, code, flipx, flipy, destx, desty, pixel_op, [] (auto *destp, const u8 *srcp, u32 count) -> u32 { return 0; });
+}
+
+
+template <typename BitmapType, typename FunctionClass, typename RowFunctionClass>
+inline void gfx_element::drawgfx_core_rows(BitmapType &dest, const rectangle &cliprect, u32 code, int flipx, int flipy, s32 destx, s32 desty, FunctionClass pixel_op, RowFunctionClass row_op)
 {
 	auto profile = g_profiler.start(PROFILER_DRAWGFX);
 	do {
@@ -481,8 +492,9 @@ inline void gfx_element::drawgfx_core(BitmapType &dest, const rectangle &cliprec
 		const u8 *srcdata = get_data(code);
 
 		// compute how many blocks of 4 pixels we have
-		u32 numblocks = (destendx + 1 - destx) / 4;
-		u32 leftovers = (destendx + 1 - destx) - 4 * numblocks;
+		u32 const numpixels = destendx + 1 - destx;
+		u32 const numblocks = numpixels / 4;
+		u32 const leftovers = numpixels - 4 * numblocks;
 
 		// adjust srcdata to point to the first source pixel of the row
 		srcdata += srcy * rowbytes() + srcx;
@@ -497,8 +509,15 @@ inline void gfx_element::drawgfx_core(BitmapType &dest, const rectangle &cliprec
 				const u8 *srcptr = srcdata;
 				srcdata += dy;
 
+				// let the row kernel take as much of the row as it can
+				u32 const rowdone = row_op(destptr, srcptr, numpixels);
+				destptr += rowdone;
+				srcptr += rowdone;
+				u32 const rowblocks = (numpixels - rowdone) / 4;
+				u32 const rowleftovers = (numpixels - rowdone) - 4 * rowblocks;
+
 				// iterate over unrolled blocks of 4
-				for (s32 curx = 0; curx < numblocks; curx++)
+				for (s32 curx = 0; curx < rowblocks; curx++)
 				{
 					pixel_op(destptr[0], srcptr[0]);
 					pixel_op(destptr[1], srcptr[1]);
@@ -510,7 +529,7 @@ inline void gfx_element::drawgfx_core(BitmapType &dest, const rectangle &cliprec
 				}
 
 				// iterate over leftover pixels
-				for (s32 curx = 0; curx < leftovers; curx++)
+				for (s32 curx = 0; curx < rowleftovers; curx++)
 				{
 					pixel_op(destptr[0], srcptr[0]);
 					srcptr++;
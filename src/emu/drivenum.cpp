@@ -16,11 +16,77 @@
 #include "unicode.h"
 
 #include <algorithm>
+#include <memory>
 
 #include <cctype>
 
 
 
+namespace {
+
+//-------------------------------------------------
+//  driver_name_hash - case-insensitive hash of a
+//  driver short name
+//-------------------------------------------------
+
+inline std::size_t driver_name_hash(char const *name)
+{
+	// FNV-1a over the lowercased name
+	std::size_t result = 2166136261U;
+	for ( ; *name; ++name)
+		result = (result ^ u8(std::tolower(u8(*name)))) * 16777619U;
+	return result;
+}
+
+
+//-------------------------------------------------
+//  driver_name_index - open-addressed hash table
+//  of indices into the sorted driver list
+//-------------------------------------------------
+
+class driver_name_index
+{
+public:
+	driver_name_index(game_driver const *const drivers[], std::size_t count)
+		: m_mask(0)
+	{
+		// keep the table at most half full so probe sequences stay short
+		std::size_t size = 1;
+		while (size < (count * 2))
+			size <<= 1;
+		m_mask = size - 1;
+		m_slots = std::make_unique<u32 []>(size);
+		std::fill_n(m_slots.get(), size, EMPTY);
+		for (std::size_t i = 0; count > i; ++i)
+		{
+			std::size_t slot = driver_name_hash(drivers[i]->name) & m_mask;
+			while (EMPTY != m_slots[slot])
+				slot = (slot + 1) & m_mask;
+			m_slots[slot] = u32(i);
+		}
+	}
+
+	int find(game_driver const *const drivers[], char const *name) const
+	{
+		for (std::size_t slot = driver_name_hash(name) & m_mask; EMPTY != m_slots[slot]; slot = (slot + 1) & m_mask)
+		{
+			if (!core_stricmp(drivers[m_slots[slot]]->name, name))
+				return int(m_slots[slot]);
+		}
+		return -1;
+	}
+
+private:
+	static constexpr u32 EMPTY = ~u32(0);
+
+	std::size_t             m_mask;
+	std::unique_ptr<u32 []> m_slots;
+};
+
+} // anonymous namespace
+
+
+
 //**************************************************************************
 //  DRIVER LIST
 //**************************************************************************
@@ -44,12 +110,9 @@ int driver_list::find(const char *name)
 	if (!name)
 		return -1;
 
-	// binary search to find it
-	game_driver const *const *const begin = s_drivers_sorted;
-	game_driver const *const *const end = begin + s_driver_count;
-	auto const cmp = [] (game_driver const *driver, char const *name) { return core_stricmp(driver->name, name) < 0; };
-	game_driver const *const *const result = std::lower_bound(begin, end, name, cmp);
-	return ((result == end) || core_stricmp((*result)->name, name)) ? -1 : std::distance(begin, result);
+	// look it up in an index built the first time it's needed
+	static driver_name_index const index(s_drivers_sorted, s_driver_count);
+	return index.find(s_drivers_sorted, name);
 }
 
 
@@ -53,6 +53,9 @@ class address_map_entry;
 // declared in bookkeeping.h
 class bookkeeping_manager;
 
+// declared in bootstate.h
+class boot_state_cache;
+
 // declared in config.h
 enum class config_type : int;
 enum class config_level : int;
@@ -61,6 +64,12 @@ class configuration_manager;
 // declared in crsshair.h
 class crosshair_manager;
 
+// declared in debug/bintrace.h
+class binary_trace_writer;
+
+// declared in debug/debugbuf.h
+class debug_disasm_cache;
+
 // declared in debug/debugcmd.h
 class debugger_commands;
 
@@ -85,6 +94,9 @@ class debug_watchpoint;
 class debug_registerpoint;
 class debug_exceptionpoint;
 
+// declared in debug/reverse.h
+class debug_reverse;
+
 // declared in debugger.h
 class debugger_manager;
 
@@ -186,6 +198,9 @@ class machine_manager;
 // declared in natkeyboard.h
 class natural_keyboard;
 
+// declared in netplay.h
+class netplay_manager;
+
 // declared in network.h
 class network_manager;
 
@@ -228,6 +243,9 @@ class software_part;
 class software_list_device;
 class software_list_loader;
 
+// declared in nvcheckpoint.h
+class nvram_checkpoint;
+
 // declared in sound.h
 class sound_manager;
 class sound_stream;
@@ -235,6 +253,9 @@ class sound_stream;
 // declared in speaker.h
 class speaker_device;
 
+// declared in telemetry.h
+class machine_telemetry;
+
 // declared in tilemap.h
 class tilemap_device;
 class tilemap_manager;
@@ -147,6 +147,11 @@ template<int Width, int AddrShift> void *handler_entry_read<Width, AddrShift>::g
 	return nullptr;
 }
 
+template<int Width, int AddrShift> void *handler_entry_read<Width, AddrShift>::get_linear_ptr(offs_t start, offs_t end) const
+{
+	return nullptr;
+}
+
 template<int Width, int AddrShift> handler_entry_read<Width, AddrShift> *handler_entry_read<Width, AddrShift>::dup()
 {
 	ref();
@@ -209,6 +214,11 @@ template<int Width, int AddrShift> void *handler_entry_write<Width, AddrShift>::
 	return nullptr;
 }
 
+template<int Width, int AddrShift> void *handler_entry_write<Width, AddrShift>::get_linear_ptr(offs_t start, offs_t end) const
+{
+	return nullptr;
+}
+
 template<int Width, int AddrShift> handler_entry_write<Width, AddrShift> *handler_entry_write<Width, AddrShift>::dup()
 {
 	ref();
@@ -332,6 +342,38 @@ memory_region *memory_manager::region_alloc(std::string name, u32 length, u8 wid
 }
 
 
+//-------------------------------------------------
+//  region_map - creates a region backed by a
+//  copy-on-write mapping of a file, returning
+//  nullptr if the file can't be mapped
+//-------------------------------------------------
+
+memory_region *memory_manager::region_map(std::string name, std::string const &path, u32 length, u8 width, endianness_t endian)
+{
+	// make sure we don't have a region of the same name; also find the end of the list
+	if (m_regionlist.find(name) != m_regionlist.end())
+		fatalerror("region_map called with duplicate region name \"%s\"\n", name);
+
+	// map the file
+	void *mapping = nullptr;
+	if (osd_map_file(path, length, mapping))
+		return nullptr;
+
+	// create the region
+	std::unique_ptr<memory_region> region;
+	try
+	{
+		region = std::make_unique<memory_region>(machine(), name, mapping, length, width, endian);
+	}
+	catch (...)
+	{
+		osd_unmap_file(mapping, length);
+		throw;
+	}
+	return m_regionlist.emplace(name, std::move(region)).first->second.get();
+}
+
+
 //-------------------------------------------------
 //  region_find - find a region by name
 //-------------------------------------------------
@@ -439,6 +481,7 @@ address_space_config::address_space_config()
 		m_logaddr_width(0),
 		m_page_shift(0),
 		m_is_octal(false),
+		m_flat_access(false),
 		m_internal_map(address_map_constructor())
 {
 }
@@ -460,6 +503,7 @@ address_space_config::address_space_config(const char *name, endianness_t endian
 		m_logaddr_width(addrwidth),
 		m_page_shift(0),
 		m_is_octal(false),
+		m_flat_access(false),
 		m_internal_map(internal)
 {
 }
@@ -473,6 +517,7 @@ address_space_config::address_space_config(const char *name, endianness_t endian
 		m_logaddr_width(logwidth),
 		m_page_shift(pageshift),
 		m_is_octal(false),
+		m_flat_access(false),
 		m_internal_map(internal)
 {
 }
@@ -968,7 +1013,8 @@ memory_passthrough_handler address_space_installer::install_readwrite_tap(offs_t
 
 memory_bank::memory_bank(device_t &device, std::string tag)
 	: m_machine(device.machine()),
-	  m_curentry(0)
+	  m_curentry(0),
+	  m_set_count(0)
 {
 	m_tag = std::move(tag);
 	m_name = string_format("Bank '%s'", m_tag);
@@ -1011,6 +1057,7 @@ void memory_bank::set_base(void *base)
 
 void memory_bank::set_entry(int entrynum)
 {
+	m_set_count++;
 	if(entrynum == -1 && m_entries.empty())
 		return;
 
@@ -1070,6 +1117,9 @@ memory_region::memory_region(running_machine &machine, std::string name, u32 len
 	: m_machine(machine),
 		m_name(std::move(name)),
 		m_buffer(length),
+		m_base(length ? &m_buffer[0] : nullptr),
+		m_length(length),
+		m_mapped(false),
 		m_endianness(endian),
 		m_bitwidth(width * 8),
 		m_bytewidth(width)
@@ -1077,6 +1127,26 @@ memory_region::memory_region(running_machine &machine, std::string name, u32 len
 	assert(width == 1 || width == 2 || width == 4 || width == 8);
 }
 
+memory_region::memory_region(running_machine &machine, std::string name, void *mapping, u32 length, u8 width, endianness_t endian)
+	: m_machine(machine),
+		m_name(std::move(name)),
+		m_buffer(),
+		m_base(reinterpret_cast<u8 *>(mapping)),
+		m_length(length),
+		m_mapped(true),
+		m_endianness(endian),
+		m_bitwidth(width * 8),
+		m_bytewidth(width)
+{
+	assert(width == 1 || width == 2 || width == 4 || width == 8);
+}
+
+memory_region::~memory_region()
+{
+	if (m_mapped)
+		osd_unmap_file(m_base, m_length);
+}
+
 std::string memory_share::compare(u8 width, size_t bytes, endianness_t endianness) const
 {
 	if (width != m_bitwidth)
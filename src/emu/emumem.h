@@ -104,6 +104,12 @@ struct memory_entry {
 	std::vector<memory_entry_context> context;
 };
 
+// a range of the current map backed by contiguous host memory
+struct memory_direct_range {
+	offs_t start, end;
+	void *base;
+};
+
 
 // ======================> read_delegate
 
@@ -688,6 +694,7 @@ public:
 	virtual std::pair<uX, u16> read_flags(offs_t offset, uX mem_mask) const = 0;
 	virtual u16 lookup_flags(offs_t offset, uX mem_mask) const = 0;
 	virtual void *get_ptr(offs_t offset) const;
+	virtual void *get_linear_ptr(offs_t start, offs_t end) const;
 	virtual void lookup(offs_t address, offs_t &start, offs_t &end, handler_entry_read<Width, AddrShift> *&handler) const;
 
 	inline void populate(offs_t start, offs_t end, offs_t mirror, handler_entry_read<Width, AddrShift> *handler) {
@@ -763,6 +770,7 @@ public:
 	virtual u16 write_flags(offs_t offset, uX data, uX mem_mask) const = 0;
 	virtual u16 lookup_flags(offs_t offset, uX mem_mask) const = 0;
 	virtual void *get_ptr(offs_t offset) const;
+	virtual void *get_linear_ptr(offs_t start, offs_t end) const;
 	virtual void lookup(offs_t address, offs_t &start, offs_t &end, handler_entry_write<Width, AddrShift> *&handler) const;
 
 	inline void populate(offs_t start, offs_t end, offs_t mirror, handler_entry_write<Width, AddrShift> *handler) {
@@ -1701,6 +1709,10 @@ template<int Level, int Width, int AddrShift> void dispatch_write_interruptible(
 
 namespace emu::detail {
 
+// flattened access page table states, any other value is a host pointer to the start of the page
+constexpr uintptr_t FLAT_UNKNOWN = 0;      // not looked up since the last map change
+constexpr uintptr_t FLAT_NONE    = 1;      // not plain memory, go through handler dispatch
+
 template<int Level, int Width, int AddrShift, endianness_t Endian> class memory_access_specific
 {
 	friend class ::address_space;
@@ -1715,7 +1727,11 @@ public:
 		: m_space(nullptr),
 		  m_addrmask(0),
 		  m_dispatch_read(nullptr),
-		  m_dispatch_write(nullptr)
+		  m_dispatch_write(nullptr),
+		  m_flat_read(nullptr),
+		  m_flat_write(nullptr),
+		  m_flat_shift(0),
+		  m_flat_mask(0)
 	{
 	}
 
@@ -1816,11 +1832,18 @@ public:
 	u16 lookup_write_qword_unaligned_flags(offs_t address, u64 mask) { return lookup_memory_write_generic_flags<Width, AddrShift, Endian, 3, false>(lwopf(), address, mask); }
 
 	NativeType read_interruptible(offs_t address, NativeType mask = ~NativeType(0)) {
-		return dispatch_read_interruptible<Level, Width, AddrShift>(offs_t(-1), address & m_addrmask, mask, m_dispatch_read);
+		address &= m_addrmask;
+		if(const NativeType *const ptr = flat_read_ptr(address))
+			return *ptr;
+		return dispatch_read_interruptible<Level, Width, AddrShift>(offs_t(-1), address, mask, m_dispatch_read);
 	}
 
 	void write_interruptible(offs_t address, NativeType data, NativeType mask = ~NativeType(0)) {
-		dispatch_write_interruptible<Level, Width, AddrShift>(offs_t(-1), address & m_addrmask, data, mask, m_dispatch_write);
+		address &= m_addrmask;
+		if(NativeType *const ptr = flat_write_ptr(address))
+			*ptr = (*ptr & ~mask) | (data & mask);
+		else
+			dispatch_write_interruptible<Level, Width, AddrShift>(offs_t(-1), address, data, mask, m_dispatch_write);
 	}
 
 private:
@@ -1831,12 +1854,49 @@ private:
 	const handler_entry_read<Width, AddrShift> *const *m_dispatch_read;
 	const handler_entry_write<Width, AddrShift> *const *m_dispatch_write;
 
+	const uintptr_t *           m_flat_read;               // flattened read page table, nullptr if disabled
+	const uintptr_t *           m_flat_write;              // flattened write page table, nullptr if disabled
+	u8                          m_flat_shift;              // log2 of the flattened page size
+	offs_t                      m_flat_mask;               // offset mask within a flattened page
+
+	// host pointer for plain RAM/ROM at a masked address, nullptr when handler dispatch is needed
+	const NativeType *flat_read_ptr(offs_t address) {
+		if(!m_flat_read)
+			return nullptr;
+		uintptr_t entry = m_flat_read[address >> m_flat_shift];
+		if(entry == FLAT_UNKNOWN)
+			entry = flat_fill(read_or_write::READ, address);
+		if(entry == FLAT_NONE)
+			return nullptr;
+		return reinterpret_cast<const NativeType *>(entry) + ((address & m_flat_mask) >> (Width + AddrShift));
+	}
+
+	NativeType *flat_write_ptr(offs_t address) {
+		if(!m_flat_write)
+			return nullptr;
+		uintptr_t entry = m_flat_write[address >> m_flat_shift];
+		if(entry == FLAT_UNKNOWN)
+			entry = flat_fill(read_or_write::WRITE, address);
+		if(entry == FLAT_NONE)
+			return nullptr;
+		return reinterpret_cast<NativeType *>(entry) + ((address & m_flat_mask) >> (Width + AddrShift));
+	}
+
+	uintptr_t flat_fill(read_or_write readorwrite, offs_t address);
+
 	NativeType read_native(offs_t address, NativeType mask = ~NativeType(0)) {
-		return dispatch_read<Level, Width, AddrShift>(offs_t(-1), address & m_addrmask, mask, m_dispatch_read);
+		address &= m_addrmask;
+		if(const NativeType *const ptr = flat_read_ptr(address))
+			return *ptr;
+		return dispatch_read<Level, Width, AddrShift>(offs_t(-1), address, mask, m_dispatch_read);
 	}
 
 	void write_native(offs_t address, NativeType data, NativeType mask = ~NativeType(0)) {
-		dispatch_write<Level, Width, AddrShift>(offs_t(-1), address & m_addrmask, data, mask, m_dispatch_write);
+		address &= m_addrmask;
+		if(NativeType *const ptr = flat_write_ptr(address))
+			*ptr = (*ptr & ~mask) | (data & mask);
+		else
+			dispatch_write<Level, Width, AddrShift>(offs_t(-1), address, data, mask, m_dispatch_write);
 	}
 
 	std::pair<NativeType, u16> read_native_flags(offs_t address, NativeType mask = ~NativeType(0)) {
@@ -1882,8 +1942,11 @@ public:
 		  m_addrend_w(0),
 		  m_cache_r(nullptr),
 		  m_cache_w(nullptr),
+		  m_ptr_r(nullptr),
+		  m_ptr_w(nullptr),
 		  m_root_read(nullptr),
-		  m_root_write(nullptr)
+		  m_root_write(nullptr),
+		  m_flat(false)
 	{
 	}
 
@@ -1894,12 +1957,16 @@ public:
 		if(address >= m_addrstart_r && address <= m_addrend_r)
 			return;
 		m_root_read->lookup(address, m_addrstart_r, m_addrend_r, m_cache_r);
+		if(m_flat)
+			m_ptr_r = reinterpret_cast<const NativeType *>(m_cache_r->get_linear_ptr(m_addrstart_r, m_addrend_r));
 	}
 
 	void check_address_w(offs_t address) {
 		if(address >= m_addrstart_w && address <= m_addrend_w)
 			return;
 		m_root_write->lookup(address, m_addrstart_w, m_addrend_w, m_cache_w);
+		if(m_flat)
+			m_ptr_w = reinterpret_cast<NativeType *>(m_cache_w->get_linear_ptr(m_addrstart_w, m_addrend_w));
 	}
 
 	// accessor methods
@@ -2017,10 +2084,14 @@ private:
 	offs_t                      m_addrend_w;               // maximum valid address for writing
 	handler_entry_read <Width, AddrShift> *m_cache_r;  // read cache
 	handler_entry_write<Width, AddrShift> *m_cache_w;  // write cache
+	const NativeType *          m_ptr_r;                   // host memory at m_addrstart_r when the read cache is plain RAM/ROM
+	NativeType *                m_ptr_w;                   // host memory at m_addrstart_w when the write cache is plain RAM
 
 	handler_entry_read <Width, AddrShift> *m_root_read;  // decode tree roots
 	handler_entry_write<Width, AddrShift> *m_root_write;
 
+	bool                        m_flat;                    // space uses flattened access
+
 	util::notifier_subscription m_subscription;
 
 	NativeType read_native(offs_t address, NativeType mask = ~NativeType(0));
@@ -2069,6 +2140,7 @@ public:
 	int logaddr_width() const { return m_logaddr_width; }
 	int page_shift() const { return m_page_shift; }
 	bool is_octal() const { return m_is_octal; }
+	bool flat_access() const { return m_flat_access; }
 
 	// Actual alignment of the bus addresses
 	int alignment() const { int bytes = m_data_width / 8; return m_addr_shift < 0 ? bytes >> -m_addr_shift : bytes << m_addr_shift; }
@@ -2090,6 +2162,7 @@ public:
 	u8                  m_logaddr_width;
 	u8                  m_page_shift;
 	bool                m_is_octal;                 // to determine if messages/debugger will show octal or hex
+	bool                m_flat_access;              // look up plain RAM/ROM through a page table of host pointers
 
 	address_map_constructor m_internal_map;
 };
@@ -2384,11 +2457,23 @@ public:
 		if(u32(mode) & ~m_in_notification) {
 			u32 old = m_in_notification;
 			m_in_notification |= u32(mode);
+			if(m_flat_read)
+				flat_invalidate(mode);
 			m_notifiers(mode);
 			m_in_notification = old;
 		}
 	}
 
+	// plain RAM/ROM ranges of the current map, for recompilers that want to
+	// access them inline; use add_change_notifier to learn when they change
+	virtual std::vector<memory_direct_range> direct_ranges(read_or_write readorwrite) const = 0;
+
+	// flattened access page tables, nullptr unless requested by the space config
+	const uintptr_t *flat_read_table() const { return m_flat_read.get(); }
+	const uintptr_t *flat_write_table() const { return m_flat_write.get(); }
+	u8 flat_page_shift() const { return m_flat_shift; }
+	uintptr_t flat_fill(read_or_write readorwrite, offs_t address);
+
 	virtual void validate_reference_counts() const = 0;
 
 	virtual void remove_passthrough(std::unordered_set<handler_entry *> &handlers) = 0;
@@ -2457,6 +2542,8 @@ protected:
 	// internal helpers
 	virtual std::pair<void *, void *> get_cache_info() = 0;
 	virtual std::pair<const void *, const void *> get_specific_info() = 0;
+	virtual void *flat_lookup(read_or_write readorwrite, offs_t start, offs_t end) const = 0;
+	void flat_invalidate(read_or_write mode);
 
 	void prepare_map_generic(address_map &map, bool allow_alloc);
 
@@ -2479,6 +2566,13 @@ protected:
 	util::notifier<read_or_write> m_notifiers;  // notifier list for address map change
 	u32                     m_in_notification;  // notification(s) currently being done
 
+	// flattened access tables for plain RAM/ROM pages
+	std::unique_ptr<uintptr_t []> m_flat_read;  // per-page host pointer or FLAT_* state for reads
+	std::unique_ptr<uintptr_t []> m_flat_write; // per-page host pointer or FLAT_* state for writes
+	std::vector<offs_t>     m_flat_read_used;   // read pages looked up since the last map change
+	std::vector<offs_t>     m_flat_write_used;  // write pages looked up since the last map change
+	u8                      m_flat_shift;       // log2 of the page size in address units
+
 	// passthrough handler used for wait states
 	std::shared_ptr<emu::detail::memory_passthrough_handler_impl> m_default_mpl;
 };
@@ -2497,6 +2591,7 @@ public:
 	// getters
 	running_machine &machine() const { return m_machine; }
 	int entry() const { return m_curentry; }
+	u64 set_count() const { return m_set_count; }
 	void *base() const { return m_entries.empty() ? nullptr : m_entries[m_curentry]; }
 	const std::string &tag() const { return m_tag; }
 	const std::string &name() const { return m_name; }
@@ -2514,6 +2609,7 @@ private:
 	running_machine &       m_machine;              // need the machine to free our memory
 	std::vector<u8 *>       m_entries;              // the entries
 	int                     m_curentry;             // current entry
+	u64                     m_set_count;            // number of set_entry calls, for profiling
 	std::string             m_name;                 // friendly name for this bank
 	std::string             m_tag;                  // tag for this bank
 };
@@ -2566,13 +2662,16 @@ class memory_region
 public:
 	// construction/destruction
 	memory_region(running_machine &machine, std::string name, u32 length, u8 width, endianness_t endian);
+	memory_region(running_machine &machine, std::string name, void *mapping, u32 length, u8 width, endianness_t endian);
+	~memory_region();
 
 	// getters
 	running_machine &machine() const { return m_machine; }
-	u8 *base() { return (m_buffer.size() > 0) ? &m_buffer[0] : nullptr; }
-	u8 *end() { return base() + m_buffer.size(); }
-	u32 bytes() const { return m_buffer.size(); }
+	u8 *base() { return m_base; }
+	u8 *end() { return base() + m_length; }
+	u32 bytes() const { return m_length; }
 	const std::string &name() const { return m_name; }
+	bool mapped() const { return m_mapped; }
 
 	// flag expansion
 	endianness_t endianness() const { return m_endianness; }
@@ -2580,7 +2679,7 @@ public:
 	u8 bytewidth() const { return m_bytewidth; }
 
 	// data access
-	u8 &as_u8(offs_t offset = 0) { return m_buffer[offset]; }
+	u8 &as_u8(offs_t offset = 0) { return m_base[offset]; }
 	u16 &as_u16(offs_t offset = 0) { return reinterpret_cast<u16 *>(base())[offset]; }
 	u32 &as_u32(offs_t offset = 0) { return reinterpret_cast<u32 *>(base())[offset]; }
 	u64 &as_u64(offs_t offset = 0) { return reinterpret_cast<u64 *>(base())[offset]; }
@@ -2589,7 +2688,10 @@ private:
 	// internal data
 	running_machine &       m_machine;
 	std::string             m_name;
-	std::vector<u8>         m_buffer;
+	std::vector<u8>         m_buffer;       // storage, unless the region is mapped from a file
+	u8 *                    m_base;
+	u32                     m_length;
+	bool                    m_mapped;       // storage is a copy-on-write mapping of a file
 	endianness_t            m_endianness;
 	u8                      m_bitwidth;
 	u8                      m_bytewidth;
@@ -2647,6 +2749,7 @@ public:
 	void disable();
 
 	std::optional<int> entry() const { return m_cur_id == -1 ? std::optional<int>() : m_cur_slot; }
+	u64 select_count() const { return m_select_count; }
 
 	const std::string &name() const { return m_name; }
 
@@ -2664,6 +2767,7 @@ private:
 	handler_entry *                                 m_handler_write;
 	int                                             m_cur_id;
 	int                                             m_cur_slot;
+	u64                                             m_select_count;
 	std::string                                     m_context;
 
 	void initialize_from_address_map(offs_t addrstart, offs_t addrend, const address_space_config &config);
@@ -2711,6 +2815,7 @@ public:
 
 	// regions
 	memory_region *region_alloc(std::string name, u32 length, u8 width, endianness_t endian);
+	memory_region *region_map(std::string name, std::string const &path, u32 length, u8 width, endianness_t endian);
 	memory_region *region_find(std::string name);
 	void region_free(std::string name);
 
@@ -2773,6 +2878,8 @@ read_native(offs_t address, emu::detail::handler_entry_size_t<Width> mask)
 {
 	address &= m_addrmask;
 	check_address_r(address);
+	if(m_ptr_r)
+		return m_ptr_r[(address - m_addrstart_r) >> (Width + AddrShift)];
 	return m_cache_r->read(address, mask);
 }
 
@@ -2782,7 +2889,11 @@ write_native(offs_t address, emu::detail::handler_entry_size_t<Width> data, emu:
 {
 	address &= m_addrmask;
 	check_address_w(address);
-	m_cache_w->write(address, data, mask);
+	if(m_ptr_w) {
+		NativeType &target = m_ptr_w[(address - m_addrstart_w) >> (Width + AddrShift)];
+		target = (target & ~mask) | (data & mask);
+	} else
+		m_cache_w->write(address, data, mask);
 }
 
 inline void emu::detail::memory_passthrough_handler_impl::remove()
@@ -2799,6 +2910,17 @@ set(address_space *space, std::pair<const void *, const void *> rw)
 	m_addrmask = space->addrmask();
 	m_dispatch_read  = (const handler_entry_read <Width, AddrShift> *const *)(rw.first);
 	m_dispatch_write = (const handler_entry_write<Width, AddrShift> *const *)(rw.second);
+	m_flat_read = space->flat_read_table();
+	m_flat_write = space->flat_write_table();
+	m_flat_shift = space->flat_page_shift();
+	m_flat_mask = make_bitmask<offs_t>(m_flat_shift);
+}
+
+template<int Level, int Width, int AddrShift, endianness_t Endian>
+uintptr_t emu::detail::memory_access_specific<Level, Width, AddrShift, Endian>::
+flat_fill(read_or_write readorwrite, offs_t address)
+{
+	return m_space->flat_fill(readorwrite, address);
 }
 
 
@@ -2815,23 +2937,28 @@ set(address_space *space, std::pair<void *, void *> rw)
 				   m_addrend_r = 0;
 				   m_addrstart_r = 1;
 				   m_cache_r = nullptr;
+				   m_ptr_r = nullptr;
 			   }
 			   if(u32(mode) & u32(read_or_write::WRITE)) {
 				   m_addrend_w = 0;
 				   m_addrstart_w = 1;
 				   m_cache_w = nullptr;
+				   m_ptr_w = nullptr;
 			   }
 		   });
 	m_root_read  = (handler_entry_read <Width, AddrShift> *)(rw.first);
 	m_root_write = (handler_entry_write<Width, AddrShift> *)(rw.second);
+	m_flat = space->flat_read_table() != nullptr;
 
 	// Protect against a wandering memset
 	m_addrstart_r = 1;
 	m_addrend_r = 0;
 	m_cache_r = nullptr;
+	m_ptr_r = nullptr;
 	m_addrstart_w = 1;
 	m_addrend_w = 0;
 	m_cache_w = nullptr;
+	m_ptr_w = nullptr;
 }
 
 template<int Width, int AddrShift, endianness_t Endian>
@@ -51,6 +51,10 @@ template <typename Format, typename... Params> static void VPRINTF(Format &&, Pa
 
 using emu::detail::handler_width_v;
 
+// flattened access page tables: pages of at least 256 address units, at most 16384 pages
+constexpr int FLAT_MIN_PAGE_BITS = 8;
+constexpr int FLAT_TABLE_BITS = 14;
+
 
 //**************************************************************************
 //  TYPE DEFINITIONS
@@ -80,6 +84,7 @@ public:
 
 	std::string get_handler_string(read_or_write readorwrite, offs_t byteaddress) const override;
 	void dump_maps(std::vector<memory_entry> &read_map, std::vector<memory_entry> &write_map) const override;
+	std::vector<memory_direct_range> direct_ranges(read_or_write readorwrite) const override;
 
 	void unmap_generic(offs_t addrstart, offs_t addrend, offs_t addrmirror, u16 flags, read_or_write readorwrite, bool quiet) override;
 	void install_ram_generic(offs_t addrstart, offs_t addrend, offs_t addrmirror, u16 flags, read_or_write readorwrite, void *baseptr) override;
@@ -280,6 +285,20 @@ public:
 		return rw;
 	}
 
+	// host pointer for a flattened page, if it is entirely covered by plain memory
+	void *flat_lookup(read_or_write readorwrite, offs_t start, offs_t end) const override {
+		offs_t hstart, hend;
+		if(readorwrite == read_or_write::READ) {
+			handler_entry_read<Width, AddrShift> *handler;
+			m_root_read->lookup(start, hstart, hend, handler);
+			return (hstart <= start && hend >= end) ? handler->get_linear_ptr(start, end) : nullptr;
+		} else {
+			handler_entry_write<Width, AddrShift> *handler;
+			m_root_write->lookup(start, hstart, hend, handler);
+			return (hstart <= start && hend >= end) ? handler->get_linear_ptr(start, end) : nullptr;
+		}
+	}
+
 	void delayed_ref(handler_entry *e) {
 		e->ref();
 		m_delayed_unrefs.insert(e);
@@ -614,8 +633,20 @@ address_space::address_space(memory_manager &manager, device_memory_interface &m
 		m_log_unmap(true),
 		m_name(memory.space_config(spacenum)->name()),
 		m_in_notification(0),
+		m_flat_shift(0),
 		m_default_mpl(make_mph(nullptr))
 {
+	// the page tables are filled lazily and cleared on every map change
+	if(m_config.flat_access())
+	{
+		int const width = m_config.addr_width();
+		m_flat_shift = std::min(width, std::max(FLAT_MIN_PAGE_BITS, width - FLAT_TABLE_BITS));
+		size_t const pages = size_t(1) << (width - m_flat_shift);
+		m_flat_read = std::make_unique<uintptr_t []>(pages);
+		m_flat_write = std::make_unique<uintptr_t []>(pages);
+		std::fill_n(m_flat_read.get(), pages, emu::detail::FLAT_UNKNOWN);
+		std::fill_n(m_flat_write.get(), pages, emu::detail::FLAT_UNKNOWN);
+	}
 }
 
 
@@ -632,6 +663,55 @@ address_space::~address_space()
 }
 
 
+//-------------------------------------------------
+//  flat_fill - look up the flattened read or
+//  write page holding an address
+//-------------------------------------------------
+
+uintptr_t address_space::flat_fill(read_or_write readorwrite, offs_t address)
+{
+	offs_t const page = address >> m_flat_shift;
+	offs_t const start = page << m_flat_shift;
+	offs_t const end = start | make_bitmask<offs_t>(m_flat_shift);
+	void *const ptr = flat_lookup(readorwrite, start, end);
+	uintptr_t const entry = ptr ? reinterpret_cast<uintptr_t>(ptr) : emu::detail::FLAT_NONE;
+
+	if(readorwrite == read_or_write::READ)
+	{
+		m_flat_read[page] = entry;
+		m_flat_read_used.push_back(page);
+	}
+	else
+	{
+		m_flat_write[page] = entry;
+		m_flat_write_used.push_back(page);
+	}
+	return entry;
+}
+
+
+//-------------------------------------------------
+//  flat_invalidate - forget the flattened pages
+//  looked up since the last map change
+//-------------------------------------------------
+
+void address_space::flat_invalidate(read_or_write mode)
+{
+	if(u32(mode) & u32(read_or_write::READ))
+	{
+		for(offs_t page : m_flat_read_used)
+			m_flat_read[page] = emu::detail::FLAT_UNKNOWN;
+		m_flat_read_used.clear();
+	}
+	if(u32(mode) & u32(read_or_write::WRITE))
+	{
+		for(offs_t page : m_flat_write_used)
+			m_flat_write[page] = emu::detail::FLAT_UNKNOWN;
+		m_flat_write_used.clear();
+	}
+}
+
+
 //-------------------------------------------------
 //  prepare_map_generic - walk through an address
 //  map to find implicit memory regions and
@@ -829,6 +909,50 @@ template<int Level, int Width, int AddrShift, endianness_t Endian> void address_
 }
 
 
+//-------------------------------------------------
+//  direct_ranges - walk the active map and
+//  collect the ranges handled by plain memory
+//-------------------------------------------------
+
+template<int Level, int Width, int AddrShift, endianness_t Endian> std::vector<memory_direct_range> address_space_specific<Level, Width, AddrShift, Endian>::direct_ranges(read_or_write readorwrite) const
+{
+	std::vector<memory_direct_range> ranges;
+	offs_t address = 0;
+	for(;;)
+	{
+		offs_t start, end;
+		void *base;
+		if(readorwrite == read_or_write::READ)
+		{
+			handler_entry_read<Width, AddrShift> *handler;
+			m_root_read->lookup(address, start, end, handler);
+			base = handler->get_linear_ptr(start, end);
+		}
+		else
+		{
+			handler_entry_write<Width, AddrShift> *handler;
+			m_root_write->lookup(address, start, end, handler);
+			base = handler->get_linear_ptr(start, end);
+		}
+
+		if(base)
+		{
+			// merge with the previous range when the host memory follows on
+			memory_direct_range *const last = ranges.empty() ? nullptr : &ranges.back();
+			if(last && last->end + 1 == start && reinterpret_cast<u8 *>(last->base) + offset_to_byte(start - last->start) == base)
+				last->end = end;
+			else
+				ranges.push_back(memory_direct_range{ start, end, base });
+		}
+
+		if(end >= m_addrmask)
+			break;
+		address = end + 1;
+	}
+	return ranges;
+}
+
+
 //**************************************************************************
 //  DYNAMIC ADDRESS SPACE MAPPING
 //**************************************************************************
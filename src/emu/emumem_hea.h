@@ -20,6 +20,17 @@ public:
 
 protected:
 	offs_t m_address_base, m_address_mask;
+
+	// check whether the masked offsets are contiguous over start-end
+	bool is_linear(offs_t start, offs_t end) const {
+		offs_t span = (start - m_address_base) ^ (end - m_address_base);
+		span |= span >> 1;
+		span |= span >> 2;
+		span |= span >> 4;
+		span |= span >> 8;
+		span |= span >> 16;
+		return (m_address_mask & span) == span;
+	}
 };
 
 template<int Width, int AddrShift> class handler_entry_write_address : public handler_entry_write<Width, AddrShift>
@@ -39,4 +50,15 @@ public:
 
 protected:
 	offs_t m_address_base, m_address_mask;
+
+	// check whether the masked offsets are contiguous over start-end
+	bool is_linear(offs_t start, offs_t end) const {
+		offs_t span = (start - m_address_base) ^ (end - m_address_base);
+		span |= span >> 1;
+		span |= span >> 2;
+		span |= span >> 4;
+		span |= span >> 8;
+		span |= span >> 16;
+		return (m_address_mask & span) == span;
+	}
 };
@@ -30,6 +30,11 @@ template<int Width, int AddrShift> void *handler_entry_read_memory<Width, AddrSh
 	return m_base + (((offset - this->m_address_base) & this->m_address_mask) >> (Width + AddrShift));
 }
 
+template<int Width, int AddrShift> void *handler_entry_read_memory<Width, AddrShift>::get_linear_ptr(offs_t start, offs_t end) const
+{
+	return this->is_linear(start, end) ? get_ptr(start) : nullptr;
+}
+
 template<int Width, int AddrShift> std::string handler_entry_read_memory<Width, AddrShift>::name() const
 {
 	return util::string_format("memory@%x", this->m_address_base);
@@ -81,6 +86,11 @@ template<int Width, int AddrShift> void *handler_entry_write_memory<Width, AddrS
 	return m_base + (((offset - this->m_address_base) & this->m_address_mask) >> (Width + AddrShift));
 }
 
+template<int Width, int AddrShift> void *handler_entry_write_memory<Width, AddrShift>::get_linear_ptr(offs_t start, offs_t end) const
+{
+	return this->is_linear(start, end) ? get_ptr(start) : nullptr;
+}
+
 template<int Width, int AddrShift> std::string handler_entry_write_memory<Width, AddrShift>::name() const
 {
 	return util::string_format("memory@%x", this->m_address_base);
@@ -22,6 +22,7 @@ public:
 	std::pair<uX, u16> read_flags(offs_t offset, uX mem_mask) const override;
 	u16 lookup_flags(offs_t offset, uX mem_mask) const override;
 	void *get_ptr(offs_t offset) const override;
+	void *get_linear_ptr(offs_t start, offs_t end) const override;
 
 	std::string name() const override;
 
@@ -42,6 +43,7 @@ public:
 	u16 write_flags(offs_t offset, uX data, uX mem_mask) const override;
 	u16 lookup_flags(offs_t offset, uX mem_mask) const override;
 	void *get_ptr(offs_t offset) const override;
+	void *get_linear_ptr(offs_t start, offs_t end) const override;
 
 	std::string name() const override;
 
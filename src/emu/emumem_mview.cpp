@@ -488,7 +488,7 @@ std::string memory_view::memory_view_entry::key() const
 }
 
 
-memory_view::memory_view(device_t &device, std::string name) : m_device(device), m_name(name), m_config(nullptr), m_addrstart(0), m_addrend(0), m_space(nullptr), m_handler_read(nullptr), m_handler_write(nullptr), m_cur_id(-1), m_cur_slot(-1)
+memory_view::memory_view(device_t &device, std::string name) : m_device(device), m_name(name), m_config(nullptr), m_addrstart(0), m_addrend(0), m_space(nullptr), m_handler_read(nullptr), m_handler_write(nullptr), m_cur_id(-1), m_cur_slot(-1), m_select_count(0)
 {
 	device.view_register(this);
 }
@@ -505,7 +505,12 @@ void memory_view::register_state()
 {
 	m_device.machine().save().save_item(&m_device, "view", m_device.subtag(m_name).c_str(), 0, NAME(m_cur_slot));
 	m_device.machine().save().save_item(&m_device, "view", m_device.subtag(m_name).c_str(), 0, NAME(m_cur_id));
-	m_device.machine().save().register_postload(save_prepost_delegate(NAME([this]() { m_handler_read->select_a(m_cur_id); m_handler_write->select_a(m_cur_id); })));
+	m_device.machine().save().register_postload(save_prepost_delegate(NAME([this]() {
+		m_handler_read->select_a(m_cur_id);
+		m_handler_write->select_a(m_cur_id);
+		if(m_space)
+			m_space->invalidate_caches(read_or_write::READWRITE);
+	})));
 }
 
 void memory_view::disable()
@@ -521,6 +526,12 @@ void memory_view::disable()
 
 void memory_view::select(int slot)
 {
+	m_select_count++;
+
+	// paging registers are often rewritten with the same value; nothing changes then
+	if((slot == m_cur_slot) && (m_cur_id != -1))
+		return;
+
 	auto i = m_entry_mapping.find(slot);
 	if (i == m_entry_mapping.end())
 		fatalerror("memory_view %s: select of unknown slot %d", m_name, slot);
@@ -64,6 +64,8 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_DIFF_DIRECTORY,                             "diff",      core_options::option_type::PATH,       "directory to save hard drive image difference files" },
 	{ OPTION_COMMENT_DIRECTORY,                          "comments",  core_options::option_type::PATH,       "directory to save debugger comments" },
 	{ OPTION_SHARE_DIRECTORY,                            "share",     core_options::option_type::PATH,       "directory to share with emulated machines" },
+	{ OPTION_NETLIST_CACHE_DIRECTORY,                    "",          core_options::option_type::PATH,       "directory to cache natively compiled netlist solvers in; leave empty to disable" },
+	{ OPTION_ROM_CACHE_DIRECTORY,                        "",          core_options::option_type::PATH,       "directory to share large loaded ROM regions between instances through; leave empty to disable" },
 
 	// state/playback options
 	{ nullptr,                                           nullptr,     core_options::option_type::HEADER,     "CORE STATE/PLAYBACK OPTIONS" },
@@ -71,6 +73,9 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_AUTOSAVE,                                   "0",         core_options::option_type::BOOLEAN,    "automatically restore state on start and save on exit for supported systems" },
 	{ OPTION_REWIND,                                     "0",         core_options::option_type::BOOLEAN,    "enable rewind savestates" },
 	{ OPTION_REWIND_CAPACITY "(1-2048)",                 "100",       core_options::option_type::INTEGER,    "rewind buffer size in megabytes" },
+	{ OPTION_STATE_HASH,                                 "0",         core_options::option_type::INTEGER,    "log a hash of the machine state every <n> frames (0 = never)" },
+	{ OPTION_BOOT_STATE,                                 "0",         core_options::option_type::BOOLEAN,    "save the state once the system has booted, and restore it on later starts with the same configuration" },
+	{ OPTION_BOOT_STATE_TIME,                            "30",        core_options::option_type::FLOAT,      "emulated seconds after power-on to save the boot state at (0 = only when requested by a script)" },
 	{ OPTION_PLAYBACK ";pb",                             nullptr,     core_options::option_type::STRING,     "playback an input file" },
 	{ OPTION_RECORD ";rec",                              nullptr,     core_options::option_type::STRING,     "record an input file" },
 	{ OPTION_EXIT_AFTER_PLAYBACK,                        "0",         core_options::option_type::BOOLEAN,    "close the program at the end of playback" },
@@ -91,10 +96,19 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_FRAMESKIP ";fs(0-10)",                      "0",         core_options::option_type::INTEGER,    "set frameskip to fixed value, 0-10 (upper limit with autoframeskip)" },
 	{ OPTION_SECONDS_TO_RUN ";str",                      "0",         core_options::option_type::INTEGER,    "number of emulated seconds to run before automatically exiting" },
 	{ OPTION_THROTTLE,                                   "1",         core_options::option_type::BOOLEAN,    "throttle emulation to keep system running in sync with real time" },
+	{ OPTION_TURBO,                                      "0",         core_options::option_type::BOOLEAN,    "run as fast as possible, only drawing a few frames a second and not mixing sound for output" },
 	{ OPTION_SLEEP,                                      "1",         core_options::option_type::BOOLEAN,    "enable sleeping, which gives time back to other applications when idle" },
 	{ OPTION_SPEED "(0.01-100)",                         "1.0",       core_options::option_type::FLOAT,      "controls the speed of gameplay, relative to realtime; smaller numbers are slower" },
 	{ OPTION_REFRESHSPEED ";rs",                         "0",         core_options::option_type::BOOLEAN,    "automatically adjust emulation speed to keep the emulated refresh rate slower than the host screen" },
 	{ OPTION_LOWLATENCY ";lolat",                        "0",         core_options::option_type::BOOLEAN,    "draws new frame before throttling to reduce input latency" },
+	{ OPTION_FRAME_DELAY "(0-9)",                        "0",         core_options::option_type::INTEGER,    "wait this many tenths of a frame after throttling before polling inputs, to reduce input latency" },
+	{ OPTION_FRAME_DELAY_AUTO,                           "0",         core_options::option_type::BOOLEAN,    "shorten the frame delay as needed to leave enough time to emulate each frame" },
+	{ OPTION_BENCH_REPORT,                               nullptr,     core_options::option_type::PATH,       "write a JSON performance report for the session to the specified file on exit" },
+	{ OPTION_BATCH,                                      nullptr,     core_options::option_type::PATH,       "run each system listed in the specified file in turn, one per line, optionally followed by the number of seconds to run it for" },
+	{ OPTION_BATCH_REPORT,                               nullptr,     core_options::option_type::PATH,       "write a line of JSON describing how each batch run ended to the specified file instead of the console" },
+	{ OPTION_CHD_CACHE "(0-4096)",                       "0",         core_options::option_type::INTEGER,    "number of decompressed hunks to cache per CHD, with read-ahead for sequential access; 0 to disable" },
+	{ OPTION_RUNAHEAD "(0-8)",                           "0",         core_options::option_type::INTEGER,    "number of frames to emulate ahead of the displayed frame to reduce input latency; 0 to disable" },
+	{ OPTION_BEAM_RACING "(0-16)",                       "0",         core_options::option_type::INTEGER,    "present the screen in this many horizontal slices as it is drawn, following the emulated beam; needs vsync off and a host refresh rate matching the system; 0 to disable" },
 
 	// render options
 	{ nullptr,                                           nullptr,     core_options::option_type::HEADER,     "CORE RENDER OPTIONS" },
@@ -145,6 +159,8 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_SAMPLES,                                    "1",         core_options::option_type::BOOLEAN,    "enable the use of external samples if available" },
 	{ OPTION_VOLUME ";vol",                              "0",         core_options::option_type::INTEGER,    "sound volume in decibels (-32 min, 0 max)" },
 	{ OPTION_COMPRESSOR,                                 "1",         core_options::option_type::BOOLEAN,    "enable compressor for sound" },
+	{ OPTION_HQ_RESAMPLER,                               "0",         core_options::option_type::BOOLEAN,    "use a polyphase FIR resampler for sound streams; higher quality but slower" },
+	{ OPTION_PARALLEL_SOUND,                             "0",         core_options::option_type::BOOLEAN,    "update independent groups of sound streams on worker threads" },
 	{ OPTION_SPEAKER_REPORT "(0-4)",                     "0",         core_options::option_type::INTEGER,    "print report of speaker ouput maxima (0=none, or 1-4 for more detail)" },
 
 	// input options
@@ -187,6 +203,9 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_UPDATEINPAUSE,                              "0",         core_options::option_type::BOOLEAN,    "keep calling video updates while in pause" },
 	{ OPTION_DEBUGSCRIPT,                                nullptr,     core_options::option_type::PATH,       "script for debugger" },
 	{ OPTION_DEBUGLOG,                                   "0",         core_options::option_type::BOOLEAN,    "write debug console output to debug.log" },
+	{ OPTION_PROFILE_SCHEDULER,                          "0",         core_options::option_type::BOOLEAN,    "collect scheduler statistics and print them on exit" },
+	{ OPTION_MEMREPORT,                                  "0",         core_options::option_type::BOOLEAN,    "print host memory used by each device on exit" },
+	{ OPTION_TRACEFILE,                                  nullptr,     core_options::option_type::PATH,       "record a timeline trace and write it to this file on exit" },
 
 	// comm options
 	{ nullptr,                                           nullptr,     core_options::option_type::HEADER,     "CORE COMM OPTIONS" },
@@ -196,22 +215,35 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_COMM_REMOTE_PORT,                           "15112",     core_options::option_type::STRING,     "remote port to connect to" },
 	{ OPTION_COMM_FRAME_SYNC,                            "0",         core_options::option_type::BOOLEAN,    "sync frames" },
 
+	// network play options
+	{ nullptr,                                           nullptr,     core_options::option_type::HEADER,     "CORE NETWORK PLAY OPTIONS" },
+	{ OPTION_NETPLAY_PEER,                               "",          core_options::option_type::STRING,     "host:port of the other instance to play against over the network; empty to disable" },
+	{ OPTION_NETPLAY_PORT "(1-65535)",                   "15200",     core_options::option_type::INTEGER,    "local UDP port for network play" },
+	{ OPTION_NETPLAY_DELAY "(0-8)",                      "1",         core_options::option_type::INTEGER,    "frames of input delay for network play" },
+	{ OPTION_NETPLAY_ROLLBACK "(1-30)",                  "8",         core_options::option_type::INTEGER,    "most frames network play will predict and roll back" },
+
 	// misc options
 	{ nullptr,                                           nullptr,     core_options::option_type::HEADER,     "CORE MISC OPTIONS" },
 	{ OPTION_DRC,                                        "1",         core_options::option_type::BOOLEAN,    "enable DRC CPU core if available" },
 	{ OPTION_DRC_USE_C,                                  "0",         core_options::option_type::BOOLEAN,    "force DRC to use C backend" },
 	{ OPTION_DRC_LOG_UML,                                "0",         core_options::option_type::BOOLEAN,    "write DRC UML disassembly log" },
 	{ OPTION_DRC_LOG_NATIVE,                             "0",         core_options::option_type::BOOLEAN,    "write DRC native disassembly log" },
+	{ OPTION_DRC_OPTIMIZE,                               "1",         core_options::option_type::BOOLEAN,    "propagate known values between DRC UML instructions" },
+	{ OPTION_DRC_PERF_MAP,                               "0",         core_options::option_type::BOOLEAN,    "write DRC native code symbols to /tmp/perf-<pid>.map for Linux perf" },
+	{ OPTION_DRC_CACHE_SIZE "(0-2047)",                  "0",         core_options::option_type::INTEGER,    "size of each DRC code cache in megabytes (0 = CPU default)" },
 	{ OPTION_BIOS,                                       nullptr,     core_options::option_type::STRING,     "select the system BIOS to use" },
+	{ OPTION_MAP_ROMS,                                   "0",         core_options::option_type::BOOLEAN,    "map large ROMs loaded whole from uncompressed files instead of copying them" },
 	{ OPTION_CHEAT ";c",                                 "0",         core_options::option_type::BOOLEAN,    "enable cheat subsystem" },
 	{ OPTION_SKIP_GAMEINFO,                              "0",         core_options::option_type::BOOLEAN,    "skip displaying the system information screen at startup" },
 	{ OPTION_UI_FONT,                                    "default",   core_options::option_type::STRING,     "specify a font to use" },
 	{ OPTION_UI,                                         "cabinet",   core_options::option_type::STRING,     "type of UI (simple|cabinet)" },
 	{ OPTION_RAMSIZE ";ram",                             nullptr,     core_options::option_type::STRING,     "size of RAM (if supported by driver)" },
 	{ OPTION_CONFIRM_QUIT,                               "0",         core_options::option_type::BOOLEAN,    "ask for confirmation before exiting" },
+	{ OPTION_NETLIST_COMPILER,                           "c++ -O2 -shared -fPIC -o %o %s", core_options::option_type::STRING, "command used to compile netlist solvers (%s is replaced with the source file and %o with the library)" },
 	{ OPTION_UI_MOUSE,                                   "1",         core_options::option_type::BOOLEAN,    "display UI mouse cursor" },
 	{ OPTION_LANGUAGE ";lang",                           "",          core_options::option_type::STRING,     "set UI display language" },
 	{ OPTION_NVRAM_SAVE ";nvwrite",                      "1",         core_options::option_type::BOOLEAN,    "save NVRAM data on exit" },
+	{ OPTION_NVRAM_CHECKPOINT,                           "0",         core_options::option_type::INTEGER,    "also save changed NVRAM data in the background every <n> seconds (0 = never)" },
 
 	{ nullptr,                                           nullptr,     core_options::option_type::HEADER,     "SCRIPTING OPTIONS" },
 	{ OPTION_AUTOBOOT_COMMAND ";ab",                     nullptr,     core_options::option_type::STRING,     "command to execute after machine boot" },
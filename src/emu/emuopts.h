@@ -48,12 +48,17 @@
 #define OPTION_DIFF_DIRECTORY       "diff_directory"
 #define OPTION_COMMENT_DIRECTORY    "comment_directory"
 #define OPTION_SHARE_DIRECTORY      "share_directory"
+#define OPTION_NETLIST_CACHE_DIRECTORY  "netlist_cache_directory"
+#define OPTION_ROM_CACHE_DIRECTORY  "rom_cache_directory"
 
 // core state/playback options
 #define OPTION_STATE                "state"
 #define OPTION_AUTOSAVE             "autosave"
 #define OPTION_REWIND               "rewind"
 #define OPTION_REWIND_CAPACITY      "rewind_capacity"
+#define OPTION_STATE_HASH           "statehash"
+#define OPTION_BOOT_STATE           "bootstate"
+#define OPTION_BOOT_STATE_TIME      "bootstate_time"
 #define OPTION_PLAYBACK             "playback"
 #define OPTION_RECORD               "record"
 #define OPTION_EXIT_AFTER_PLAYBACK  "exit_after_playback"
@@ -72,10 +77,19 @@
 #define OPTION_FRAMESKIP            "frameskip"
 #define OPTION_SECONDS_TO_RUN       "seconds_to_run"
 #define OPTION_THROTTLE             "throttle"
+#define OPTION_TURBO                "turbo"
 #define OPTION_SLEEP                "sleep"
 #define OPTION_SPEED                "speed"
 #define OPTION_REFRESHSPEED         "refreshspeed"
 #define OPTION_LOWLATENCY           "lowlatency"
+#define OPTION_FRAME_DELAY          "frame_delay"
+#define OPTION_FRAME_DELAY_AUTO     "frame_delay_auto"
+#define OPTION_BENCH_REPORT         "bench_report"
+#define OPTION_BATCH                "batch"
+#define OPTION_BATCH_REPORT         "batch_report"
+#define OPTION_CHD_CACHE            "chd_cache"
+#define OPTION_RUNAHEAD             "runahead"
+#define OPTION_BEAM_RACING          "beam_racing"
 
 // core render options
 #define OPTION_KEEPASPECT           "keepaspect"
@@ -120,6 +134,8 @@
 #define OPTION_SAMPLES              "samples"
 #define OPTION_VOLUME               "volume"
 #define OPTION_COMPRESSOR           "compressor"
+#define OPTION_HQ_RESAMPLER         "hq_resampler"
+#define OPTION_PARALLEL_SOUND       "parallel_sound"
 #define OPTION_SPEAKER_REPORT       "speaker_report"
 
 // core input options
@@ -159,19 +175,27 @@
 #define OPTION_UPDATEINPAUSE        "update_in_pause"
 #define OPTION_DEBUGSCRIPT          "debugscript"
 #define OPTION_DEBUGLOG             "debuglog"
+#define OPTION_PROFILE_SCHEDULER    "profile_scheduler"
+#define OPTION_MEMREPORT            "memreport"
+#define OPTION_TRACEFILE            "tracefile"
 
 // core misc options
 #define OPTION_DRC                  "drc"
 #define OPTION_DRC_USE_C            "drc_use_c"
 #define OPTION_DRC_LOG_UML          "drc_log_uml"
 #define OPTION_DRC_LOG_NATIVE       "drc_log_native"
+#define OPTION_DRC_OPTIMIZE         "drc_optimize"
+#define OPTION_DRC_PERF_MAP         "drc_perf_map"
+#define OPTION_DRC_CACHE_SIZE       "drc_cache_size"
 #define OPTION_BIOS                 "bios"
+#define OPTION_MAP_ROMS             "maproms"
 #define OPTION_CHEAT                "cheat"
 #define OPTION_SKIP_GAMEINFO        "skip_gameinfo"
 #define OPTION_UI_FONT              "uifont"
 #define OPTION_UI                   "ui"
 #define OPTION_RAMSIZE              "ramsize"
 #define OPTION_NVRAM_SAVE           "nvram_save"
+#define OPTION_NVRAM_CHECKPOINT     "nvram_checkpoint"
 
 // core comm options
 #define OPTION_COMM_LOCAL_HOST      "comm_localhost"
@@ -180,7 +204,14 @@
 #define OPTION_COMM_REMOTE_PORT     "comm_remoteport"
 #define OPTION_COMM_FRAME_SYNC      "comm_framesync"
 
+// core network play options
+#define OPTION_NETPLAY_PEER         "netplay_peer"
+#define OPTION_NETPLAY_PORT         "netplay_port"
+#define OPTION_NETPLAY_DELAY        "netplay_delay"
+#define OPTION_NETPLAY_ROLLBACK     "netplay_rollback"
+
 #define OPTION_CONFIRM_QUIT         "confirm_quit"
+#define OPTION_NETLIST_COMPILER     "netlist_compiler"
 #define OPTION_UI_MOUSE             "ui_mouse"
 
 #define OPTION_AUTOBOOT_COMMAND     "autoboot_command"
@@ -334,12 +365,17 @@ public:
 	const char *diff_directory() const { return value(OPTION_DIFF_DIRECTORY); }
 	const char *comment_directory() const { return value(OPTION_COMMENT_DIRECTORY); }
 	const char *share_directory() const { return value(OPTION_SHARE_DIRECTORY); }
+	const char *netlist_cache_directory() const { return value(OPTION_NETLIST_CACHE_DIRECTORY); }
+	const char *rom_cache_directory() const { return value(OPTION_ROM_CACHE_DIRECTORY); }
 
 	// core state/playback options
 	const char *state() const { return value(OPTION_STATE); }
 	bool autosave() const { return bool_value(OPTION_AUTOSAVE); }
 	int rewind() const { return bool_value(OPTION_REWIND); }
 	int rewind_capacity() const { return int_value(OPTION_REWIND_CAPACITY); }
+	int state_hash() const { return int_value(OPTION_STATE_HASH); }
+	bool boot_state() const { return bool_value(OPTION_BOOT_STATE); }
+	float boot_state_time() const { return float_value(OPTION_BOOT_STATE_TIME); }
 	const char *playback() const { return value(OPTION_PLAYBACK); }
 	const char *record() const { return value(OPTION_RECORD); }
 	bool exit_after_playback() const { return bool_value(OPTION_EXIT_AFTER_PLAYBACK); }
@@ -358,10 +394,19 @@ public:
 	int frameskip() const { return int_value(OPTION_FRAMESKIP); }
 	int seconds_to_run() const { return int_value(OPTION_SECONDS_TO_RUN); }
 	bool throttle() const { return bool_value(OPTION_THROTTLE); }
+	bool turbo() const { return bool_value(OPTION_TURBO); }
 	bool sleep() const { return m_sleep; }
 	float speed() const { return float_value(OPTION_SPEED); }
 	bool refresh_speed() const { return m_refresh_speed; }
 	bool low_latency() const { return bool_value(OPTION_LOWLATENCY); }
+	int frame_delay() const { return int_value(OPTION_FRAME_DELAY); }
+	bool frame_delay_auto() const { return bool_value(OPTION_FRAME_DELAY_AUTO); }
+	const char *bench_report() const { return value(OPTION_BENCH_REPORT); }
+	const char *batch() const { return value(OPTION_BATCH); }
+	const char *batch_report() const { return value(OPTION_BATCH_REPORT); }
+	int chd_cache() const { return int_value(OPTION_CHD_CACHE); }
+	int runahead() const { return int_value(OPTION_RUNAHEAD); }
+	int beam_racing() const { return int_value(OPTION_BEAM_RACING); }
 
 	// core render options
 	bool keep_aspect() const { return bool_value(OPTION_KEEPASPECT); }
@@ -406,6 +451,8 @@ public:
 	bool samples() const { return bool_value(OPTION_SAMPLES); }
 	int volume() const { return int_value(OPTION_VOLUME); }
 	bool compressor() const { return bool_value(OPTION_COMPRESSOR); }
+	bool hq_resampler() const { return bool_value(OPTION_HQ_RESAMPLER); }
+	bool parallel_sound() const { return bool_value(OPTION_PARALLEL_SOUND); }
 	int speaker_report() const { return int_value(OPTION_SPEAKER_REPORT); }
 
 	// core input options
@@ -443,19 +490,27 @@ public:
 	const char *debug_script() const { return value(OPTION_DEBUGSCRIPT); }
 	bool update_in_pause() const { return bool_value(OPTION_UPDATEINPAUSE); }
 	bool debuglog() const { return bool_value(OPTION_DEBUGLOG); }
+	bool profile_scheduler() const { return bool_value(OPTION_PROFILE_SCHEDULER); }
+	bool memreport() const { return bool_value(OPTION_MEMREPORT); }
+	const char *trace_file() const { return value(OPTION_TRACEFILE); }
 
 	// core misc options
 	bool drc() const { return bool_value(OPTION_DRC); }
 	bool drc_use_c() const { return bool_value(OPTION_DRC_USE_C); }
 	bool drc_log_uml() const { return bool_value(OPTION_DRC_LOG_UML); }
 	bool drc_log_native() const { return bool_value(OPTION_DRC_LOG_NATIVE); }
+	bool drc_optimize() const { return bool_value(OPTION_DRC_OPTIMIZE); }
+	bool drc_perf_map() const { return bool_value(OPTION_DRC_PERF_MAP); }
+	int drc_cache_size() const { return int_value(OPTION_DRC_CACHE_SIZE); }
 	const char *bios() const { return value(OPTION_BIOS); }
+	bool map_roms() const { return bool_value(OPTION_MAP_ROMS); }
 	bool cheat() const { return bool_value(OPTION_CHEAT); }
 	bool skip_gameinfo() const { return bool_value(OPTION_SKIP_GAMEINFO); }
 	const char *ui_font() const { return value(OPTION_UI_FONT); }
 	ui_option ui() const { return m_ui; }
 	const char *ram_size() const { return value(OPTION_RAMSIZE); }
 	bool nvram_save() const { return bool_value(OPTION_NVRAM_SAVE); }
+	int nvram_checkpoint() const { return int_value(OPTION_NVRAM_CHECKPOINT); }
 
 	// core comm options
 	const char *comm_localhost() const { return value(OPTION_COMM_LOCAL_HOST); }
@@ -464,8 +519,15 @@ public:
 	const char *comm_remoteport() const { return value(OPTION_COMM_REMOTE_PORT); }
 	bool comm_framesync() const { return bool_value(OPTION_COMM_FRAME_SYNC); }
 
+	// core network play options
+	const char *netplay_peer() const { return value(OPTION_NETPLAY_PEER); }
+	int netplay_port() const { return int_value(OPTION_NETPLAY_PORT); }
+	int netplay_delay() const { return int_value(OPTION_NETPLAY_DELAY); }
+	int netplay_rollback() const { return int_value(OPTION_NETPLAY_ROLLBACK); }
+
 
 	bool confirm_quit() const { return bool_value(OPTION_CONFIRM_QUIT); }
+	const char *netlist_compiler() const { return value(OPTION_NETLIST_COMPILER); }
 	bool ui_mouse() const { return bool_value(OPTION_UI_MOUSE); }
 
 	const char *autoboot_command() const { return value(OPTION_AUTOBOOT_COMMAND); }
@@ -148,6 +148,7 @@ public:
 	bool is_open() const { return bool(m_file); }
 	const char *filename() const { return m_filename.c_str(); }
 	const char *fullpath() const { return m_fullpath.c_str(); }
+	bool archived() const { return bool(m_zipfile) || !m_zipdata.empty(); }
 	u32 openflags() const { return m_openflags; }
 	util::hash_collection &hashes(std::string_view types);
 
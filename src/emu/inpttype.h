@@ -276,6 +276,7 @@ enum ioport_type : osd::u32
 		IPT_UI_FRAMESKIP_INC,
 		IPT_UI_THROTTLE,
 		IPT_UI_FAST_FORWARD,
+		IPT_UI_TURBO,
 		IPT_UI_SHOW_FPS,
 		IPT_UI_SNAPSHOT,
 		IPT_UI_RECORD_MNG,
@@ -16,6 +16,7 @@
 #include "inputdev.h"
 #include "main.h"
 #include "natkeyboard.h"
+#include "netplay.h"
 #include "profiler.h"
 
 #include "ui/uimain.h"
@@ -1330,6 +1331,27 @@ void ioport_field::frame_update(ioport_value &result)
 }
 
 
+//-------------------------------------------------
+//  late_update - refresh a plain digital input
+//  from a mid-frame host input poll; anything
+//  with state carried between frames is left
+//  alone until the next frame
+//-------------------------------------------------
+
+void ioport_field::late_update(ioport_value &result)
+{
+	if (!enabled() || m_live->analog || m_live->joystick || m_live->lockout || m_live->toggle || m_impulse || m_digital_value)
+		return;
+	if ((m_type >= IPT_COIN1 && m_type <= IPT_COIN12) || (m_type >= IPT_UI_FIRST && m_type <= IPT_UI_LAST))
+		return;
+
+	if (machine().input().seq_pressed(seq()))
+		result |= m_mask;
+	else
+		result &= ~m_mask;
+}
+
+
 //-------------------------------------------------
 //  crosshair_read - compute the crosshair
 //  position
@@ -1524,7 +1546,9 @@ ioport_port::ioport_port(device_t &owner, const char *tag)
 		m_device(owner),
 		m_tag(tag),
 		m_modcount(0),
-		m_active(0)
+		m_active(0),
+		m_late_poll(false),
+		m_late_generation(0)
 {
 }
 
@@ -1584,6 +1608,10 @@ ioport_value ioport_port::read()
 	if (!manager().safe_to_read())
 		throw emu_fatalerror("Input ports cannot be read at init time!");
 
+	// drivers that sample inputs several times a frame can ask for them to be polled again
+	if (m_late_poll)
+		manager().late_poll(*this);
+
 	// start with the digital state
 	ioport_value result = m_live->digital;
 
@@ -1631,6 +1659,22 @@ void ioport_port::frame_update()
 }
 
 
+//-------------------------------------------------
+//  late_update - refresh the digital portion
+//  from a mid-frame host input poll
+//-------------------------------------------------
+
+void ioport_port::late_update(u32 generation)
+{
+	if (generation == m_late_generation)
+		return;
+	m_late_generation = generation;
+
+	for (ioport_field &field : m_fieldlist)
+		field.late_update(m_live->digital);
+}
+
+
 //-------------------------------------------------
 //  collapse_fields - remove any fields that are
 //  wholly overlapped by other fields
@@ -1786,6 +1830,10 @@ ioport_manager::ioport_manager(running_machine &machine)
 	, m_last_delta_nsec(0)
 	, m_playback_accumulated_speed(0)
 	, m_playback_accumulated_frames(0)
+	, m_netplay(nullptr)
+	, m_late_poll_allowed(!machine.options().runahead())
+	, m_late_poll_ticks(0)
+	, m_late_poll_generation(0)
 	, m_deselected_card_config()
 	, m_applied_device_defaults(false)
 {
@@ -2147,6 +2195,30 @@ digital_joystick &ioport_manager::digjoystick(int player, int number)
 }
 
 
+//-------------------------------------------------
+//  late_poll - poll host inputs again, at most
+//  once a millisecond, and update a port from
+//  them; inputs only change at frame boundaries
+//  while recording, playing back, playing over
+//  the network or running ahead
+//-------------------------------------------------
+
+void ioport_manager::late_poll(ioport_port &port)
+{
+	if (!m_late_poll_allowed || m_netplay || m_record_stream || m_playback_stream || machine().paused() || machine().ui().is_menu_active())
+		return;
+
+	osd_ticks_t const now = osd_ticks();
+	if ((now - m_late_poll_ticks) >= (osd_ticks_per_second() / 1000))
+	{
+		m_late_poll_ticks = now;
+		machine().osd().input_update(false);
+		++m_late_poll_generation;
+	}
+	port.late_update(m_late_poll_generation);
+}
+
+
 //-------------------------------------------------
 //  frame_update - callback for once/frame updating
 //-------------------------------------------------
@@ -2189,6 +2261,9 @@ void ioport_manager::frame_update()
 		port.second->update_defvalue(false);
 
 	// loop over all input ports
+	if (m_netplay)
+		m_netplay->begin_frame();
+	size_t index = 0;
 	for (auto &port : m_portlist)
 	{
 		port.second->frame_update();
@@ -2197,12 +2272,18 @@ void ioport_manager::frame_update()
 		playback_port(*port.second.get());
 		record_port(*port.second.get());
 
+		// handle network play
+		if (m_netplay)
+			m_netplay->port_update(index++, port.second->live().digital);
+
 		// call device line write handlers
 		ioport_value newvalue = port.second->read();
 		for (dynamic_field &dynfield : port.second->live().writelist)
 			if (dynfield.field().type() != IPT_OUTPUT)
 				dynfield.write(newvalue);
 	}
+	if (m_netplay)
+		m_netplay->end_frame();
 }
 
 
@@ -646,6 +646,7 @@ public:
 	float crosshair_read() const;
 	void init_live_state(analog_field *analog);
 	void frame_update(ioport_value &result);
+	void late_update(ioport_value &result);
 	void reduce_mask(ioport_value bits_to_remove) { m_mask &= ~bits_to_remove; }
 
 	// user-controllable settings for a field
@@ -772,6 +773,10 @@ public:
 	int modcount() const { return m_modcount; }
 	ioport_value active() const { return m_active; }
 	ioport_port_live &live() const { assert(m_live != nullptr); return *m_live; }
+	bool late_poll() const { return m_late_poll; }
+
+	// setters
+	void set_late_poll(bool late_poll) { m_late_poll = late_poll; }
 
 	// read/write to the port
 	ioport_value read();
@@ -781,6 +786,7 @@ public:
 	ioport_field *field(ioport_value mask) const;
 	void collapse_fields(std::string &errorbuf);
 	void frame_update();
+	void late_update(u32 generation);
 	void init_live_state();
 	void update_defvalue(bool flush_defaults);
 
@@ -794,6 +800,8 @@ private:
 	std::string                 m_tag;          // copy of this port's tag
 	int                         m_modcount;     // modification count
 	ioport_value                m_active;       // mask of active bits in the port
+	bool                        m_late_poll;    // poll inputs again when read?
+	u32                         m_late_generation; // host input poll this port was last updated from
 	std::unique_ptr<ioport_port_live> m_live;      // live state of port (nullptr if not live)
 };
 
@@ -956,6 +964,12 @@ public:
 	digital_joystick &digjoystick(int player, int joysticknum);
 	int count_players() const noexcept;
 	s32 frame_interpolate(s32 oldval, s32 newval);
+
+	// network play
+	void set_netplay(netplay_manager *netplay) noexcept { m_netplay = netplay; }
+
+	// poll host inputs again for a port being read mid-frame
+	void late_poll(ioport_port &port);
 	ioport_type token_to_input_type(const char *string, int &player) const;
 	std::string input_type_to_token(ioport_type type, int player);
 
@@ -1020,6 +1034,14 @@ private:
 	u64                     m_playback_accumulated_speed; // accumulated speed during playback
 	u32                     m_playback_accumulated_frames; // accumulated frames during playback
 
+	// network play session replacing the digital inputs (nullptr if not playing)
+	netplay_manager *       m_netplay;
+
+	// mid-frame input polling
+	bool                    m_late_poll_allowed;    // clear if inputs must only change at frame boundaries
+	osd_ticks_t             m_late_poll_ticks;      // osd_ticks of the last mid-frame poll
+	u32                     m_late_poll_generation; // number of mid-frame polls
+
 	// storage for inactive configuration
 	std::unique_ptr<util::xml::file> m_deselected_card_config;
 	bool m_applied_device_defaults;
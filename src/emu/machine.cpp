@@ -10,10 +10,12 @@
 
 #include "emu.h"
 
+#include "bootstate.h"
 #include "config.h"
 #include "crsshair.h"
 #include "debug/debugcpu.h"
 #include "debug/debugvw.h"
+#include "debug/reverse.h"
 #include "debugger.h"
 #include "dirtc.h"
 #include "emuopts.h"
@@ -22,9 +24,12 @@
 #include "image.h"
 #include "main.h"
 #include "natkeyboard.h"
+#include "netplay.h"
 #include "network.h"
+#include "nvcheckpoint.h"
 #include "render.h"
 #include "romload.h"
+#include "telemetry.h"
 #include "tilemap.h"
 #include "uiinput.h"
 
@@ -38,7 +43,9 @@
 #include <rapidjson/writer.h>
 #include <rapidjson/stringbuffer.h>
 
+#include <algorithm>
 #include <ctime>
+#include <unordered_map>
 
 #if defined(__EMSCRIPTEN__)
 #include <emscripten.h>
@@ -76,6 +83,11 @@ running_machine::running_machine(const machine_config &_config, machine_manager
 	, m_saveload_schedule(saveload_schedule::NONE)
 	, m_saveload_schedule_time(attotime::zero)
 	, m_saveload_searchpath(nullptr)
+	, m_saveload_queue(nullptr)
+	, m_saveload_item(nullptr)
+	, m_saveload_result(STATERR_NONE)
+	, m_debug_sync_pending(false)
+	, m_startup_phase_start(osd_ticks())
 
 	, m_save(*this)
 	, m_memory(*this)
@@ -102,6 +114,14 @@ running_machine::running_machine(const machine_config &_config, machine_manager
 
 running_machine::~running_machine()
 {
+	// run() waits for states being written, but it may have been left early
+	if (m_saveload_item)
+	{
+		while (!osd_work_item_wait(m_saveload_item, osd_ticks_per_second())) { }
+		osd_work_item_release(m_saveload_item);
+	}
+	if (m_saveload_queue)
+		osd_work_queue_free(m_saveload_queue);
 }
 
 
@@ -143,6 +163,7 @@ void running_machine::start()
 	m_output = std::make_unique<output_manager>(*this);
 	m_render = std::make_unique<render_manager>(*this);
 	m_bookkeeping = std::make_unique<bookkeeping_manager>(*this);
+	startup_phase("core managers");
 
 	// allocate a soft_reset timer
 	m_soft_reset_timer = m_scheduler.timer_alloc(timer_expired_delegate(FUNC(running_machine::soft_reset), this));
@@ -152,11 +173,13 @@ void running_machine::start()
 
 	// init the OSD layer
 	m_manager.osd().init(*this);
+	startup_phase("OSD");
 
 	// create the video manager and UI manager
 	m_video = std::make_unique<video_manager>(*this);
 	m_ui = manager().create_ui(*this);
 	m_ui->set_startup_text("Initializing...", true);
+	startup_phase("video and UI");
 
 	// initialize the base time (needed for doing record/playback)
 	::time(&m_base_time);
@@ -170,6 +193,7 @@ void running_machine::start()
 
 	// initialize natural keyboard support after ports have been initialized
 	m_natkeyboard = std::make_unique<natural_keyboard>(*this);
+	startup_phase("input ports");
 
 	// initialize the streams engine before the sound devices start
 	m_sound = std::make_unique<sound_manager>(*this);
@@ -184,7 +208,9 @@ void running_machine::start()
 	// complete address spaces).  These operations must proceed in this
 	// order
 	m_rom_load = std::make_unique<rom_load_manager>(*this);
+	startup_phase("ROM loading");
 	m_memory.initialize();
+	startup_phase("address maps");
 
 	// save the random seed or save states might be broken in drivers that use the rand() method
 	save().save_item(NAME(m_rand_seed));
@@ -203,6 +229,7 @@ void running_machine::start()
 	}
 
 	manager().create_custom(*this);
+	startup_phase("front-end managers");
 
 	// resolve objects that are created by memory maps
 	for (device_t &device : device_enumerator(root_device()))
@@ -214,6 +241,7 @@ void running_machine::start()
 	save().register_presave(save_prepost_delegate(FUNC(running_machine::presave_all_devices), this));
 	start_all_devices();
 	save().register_postload(save_prepost_delegate(FUNC(running_machine::postload_all_devices), this));
+	startup_phase("device start");
 
 	// save outputs created before start time
 	output().register_save();
@@ -222,6 +250,7 @@ void running_machine::start()
 
 	// load cheat files
 	manager().load_cheatfiles(*this);
+	startup_phase("cheats");
 
 	// start recording movie if specified
 	const char *filename = options().mng_write();
@@ -287,6 +316,7 @@ int running_machine::run(bool quiet)
 		// load the configuration settings
 		manager().before_load_settings(*this);
 		m_configuration->load_settings();
+		startup_phase("configuration");
 
 		// disallow save state registrations starting here.
 		// Don't do it earlier, config load can create network
@@ -295,6 +325,16 @@ int running_machine::run(bool quiet)
 
 		// load the NVRAM
 		nvram_load();
+		startup_phase("NVRAM");
+
+		// start periodic NVRAM checkpoints if requested
+		if (options().nvram_save() && (options().nvram_checkpoint() > 0))
+			m_nvram_checkpoint = std::make_unique<nvram_checkpoint>(*this, attotime::from_seconds(options().nvram_checkpoint()));
+
+		// restore or prepare to capture a boot state, hashing NVRAM before clocks are set
+		if (options().boot_state() && (m_system.flags & MACHINE_SUPPORTS_SAVE) && (m_saveload_schedule == saveload_schedule::NONE) &&
+				!*options().playback() && !*options().record() && !*options().netplay_peer())
+			m_boot_state = std::make_unique<boot_state_cache>(*this, attotime::from_double(options().boot_state_time()));
 
 		// set the time on RTCs (this may overwrite parts of NVRAM)
 		set_rtc_datetime(system_time(m_base_time));
@@ -308,6 +348,7 @@ int running_machine::run(bool quiet)
 		// initialize ui lists
 		// display the startup screens
 		manager().ui_initialize(*this);
+		startup_phase("UI initialization");
 
 		// perform a soft reset -- this takes us to the running phase
 		soft_reset();
@@ -315,9 +356,32 @@ int running_machine::run(bool quiet)
 		// handle initial load
 		if (m_saveload_schedule != saveload_schedule::NONE)
 			handle_saveload();
+		startup_phase("reset");
+		report_startup_phases();
 
 		export_http_api();
 
+		// record a timeline trace if requested
+		if (*options().trace_file())
+		{
+			if (g_tracer.available())
+			{
+				g_tracer.name_thread("emulation");
+				g_tracer.enable();
+			}
+			else
+			{
+				osd_printf_warning("Timeline tracing is not supported by this build\n");
+			}
+		}
+
+		// start network play if requested
+		if (*options().netplay_peer())
+		{
+			m_netplay = std::make_unique<netplay_manager>(*this);
+			m_ioport.set_netplay(m_netplay.get());
+		}
+
 #if defined(__EMSCRIPTEN__)
 		// break out to our async javascript loop and halt
 		emscripten_set_running_machine(this);
@@ -335,20 +399,65 @@ int running_machine::run(bool quiet)
 			else
 				m_video->frame_update();
 
+			// let the debugger capture or restore states between timeslices
+			if (UNEXPECTED(m_debug_sync_pending))
+			{
+				m_debug_sync_pending = false;
+				m_debugger->cpu().reverse().timeslice_boundary();
+			}
+
+			// let network play capture states and roll back between frames
+			if (m_netplay)
+				m_netplay->timeslice_boundary();
+
+			// emulate ahead of the frame that was just completed
+			if (m_video->runahead_pending())
+				run_ahead();
+
 			// handle save/load
 			if (m_saveload_schedule != saveload_schedule::NONE)
 				handle_saveload();
+
+			// report states finished writing in the background
+			if (m_saveload_item)
+				complete_state_write(false);
 		}
 		m_manager.http()->clear();
 
+		// stop network play
+		m_ioport.set_netplay(nullptr);
+		m_netplay.reset();
+
+		// make sure any state being written has made it to disk
+		complete_state_write(true);
+
 		// and out via the exit phase
 		m_current_phase = machine_phase::EXIT;
 
-		// save the NVRAM and configuration
+		// save the NVRAM and configuration, after any checkpoint in flight
 		sound().ui_mute(true);
+		m_nvram_checkpoint.reset();
+		m_boot_state.reset();
 		if (options().nvram_save())
 			nvram_save();
 		m_configuration->save_settings();
+
+		// report scheduler statistics if requested
+		if (options().profile_scheduler())
+			m_scheduler.dump_profile();
+
+		// report memory usage if requested
+		if (options().memreport())
+			dump_memory_usage();
+
+		// write the timeline trace
+		if (g_tracer.enabled())
+		{
+			g_tracer.enable(false);
+			std::error_condition const filerr = g_tracer.write(options().trace_file());
+			if (filerr)
+				osd_printf_error("Error writing trace file %s (%s)\n", options().trace_file(), filerr.message());
+		}
 	}
 	catch (emu_fatalerror const &fatal)
 	{
@@ -528,6 +637,89 @@ std::string running_machine::get_statename(const char *option) const
 }
 
 
+//-------------------------------------------------
+//  memory_usage - attribute host memory held by
+//  regions, shares, decoded graphics and saved
+//  state to the devices that own them
+//-------------------------------------------------
+
+std::vector<device_memory_usage> running_machine::memory_usage()
+{
+	std::vector<device_memory_usage> result;
+	std::unordered_map<device_t *, size_t> index;
+	auto const usage =
+		[this, &result, &index] (device_t *device) -> device_memory_usage &
+		{
+			if (!device)
+				device = &root_device();
+			auto const found = index.emplace(device, result.size());
+			if (found.second)
+				result.emplace_back().device = device;
+			return result[found.first->second];
+		};
+
+	// regions and shares are named by their owner's tag plus their own
+	auto const owner =
+		[this] (std::string const &name) -> device_t *
+		{
+			std::string::size_type const pos = name.find_last_of(':');
+			if ((std::string::npos == pos) || !pos)
+				return &root_device();
+			return root_device().subdevice(std::string_view(name).substr(0, pos));
+		};
+	for (auto const &region : m_memory.regions())
+		usage(owner(region.first)).regions += region.second->bytes();
+	for (auto const &share : m_memory.shares())
+		usage(owner(share.first)).shares += share.second->bytes();
+
+	for (device_gfx_interface &gfx : gfx_interface_enumerator(root_device()))
+	{
+		for (int i = 0; i < MAX_GFX_ELEMENTS; i++)
+		{
+			if (gfx.gfx(i))
+				usage(&gfx.device()).gfx += gfx.gfx(i)->allocated_bytes();
+		}
+	}
+
+	std::vector<std::pair<device_t *, u64> > state;
+	m_save.device_state_sizes(state);
+	for (auto const &entry : state)
+		usage(entry.first).state += entry.second;
+
+	std::sort(
+			result.begin(),
+			result.end(),
+			[] (device_memory_usage const &a, device_memory_usage const &b) { return a.total() > b.total(); });
+	return result;
+}
+
+
+//-------------------------------------------------
+//  dump_memory_usage - print the memory usage
+//  report
+//-------------------------------------------------
+
+void running_machine::dump_memory_usage()
+{
+	std::vector<device_memory_usage> const usage = memory_usage();
+	u64 regions = 0, shares = 0, gfx = 0, state = 0;
+
+	osd_printf_info("Memory usage (bytes):\n");
+	osd_printf_info("  %-32s %12s %12s %12s %12s\n", "device", "regions", "shares", "gfx", "state");
+	for (device_memory_usage const &device : usage)
+	{
+		osd_printf_info("  %-32s %12u %12u %12u %12u\n", device.device->tag(), device.regions, device.shares, device.gfx, device.state);
+		regions += device.regions;
+		shares += device.shares;
+		gfx += device.gfx;
+		state += device.state;
+	}
+	osd_printf_info("  %-32s %12u %12u %12u %12u\n", "total", regions, shares, gfx, state);
+	if (m_save.ramstate_bytes())
+		osd_printf_info("  rewind/run-ahead states: %u\n", u64(m_save.ramstate_bytes()));
+}
+
+
 //-------------------------------------------------
 //  compose_saveload_filename - composes a filename
 //  for state loading/saving
@@ -606,6 +798,9 @@ void running_machine::immediate_save(std::string_view filename)
 
 	// jump right into the save, anonymous timers can't hurt us!
 	handle_saveload();
+
+	// callers expect the file to be complete
+	complete_state_write(true);
 }
 
 
@@ -878,15 +1073,36 @@ void running_machine::handle_saveload()
 		{
 			u32 const openflags = (m_saveload_schedule == saveload_schedule::LOAD) ? OPEN_FLAG_READ : (OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
 
+			// only one state write can be in flight, and a load may need the file being written
+			complete_state_write(true);
+
 			// open the file
-			emu_file file(m_saveload_searchpath ? m_saveload_searchpath : "", openflags);
-			auto const filerr = file.open(m_saveload_pending_file);
-			if (!filerr)
+			auto file = std::make_unique<emu_file>(m_saveload_searchpath ? m_saveload_searchpath : "", openflags);
+			auto const filerr = file->open(m_saveload_pending_file);
+			if (!filerr && (m_saveload_schedule == saveload_schedule::SAVE))
+			{
+				// take a snapshot now, and compress and write it in the background
+				m_saveload_result = m_save.write_snapshot(m_saveload_buffer);
+				m_saveload_file = std::move(file);
+				m_saveload_filename = m_saveload_pending_file;
+				if (m_saveload_result == STATERR_NONE)
+				{
+					if (!m_saveload_queue)
+						m_saveload_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
+					if (m_saveload_queue)
+						m_saveload_item = osd_work_item_queue(m_saveload_queue, &running_machine::write_state_callback, this, 0);
+					if (!m_saveload_item)
+						write_state_callback(this, 0);
+				}
+				if (!m_saveload_item)
+					complete_state_write(false);
+			}
+			else if (!filerr)
 			{
-				const char *const opnamed = (m_saveload_schedule == saveload_schedule::LOAD) ? "loaded" : "saved";
+				const char *const opnamed = "loaded";
 
-				// read/write the save state
-				save_error saverr = (m_saveload_schedule == saveload_schedule::LOAD) ? m_save.read_file(file) : m_save.write_file(file);
+				// read the save state
+				save_error saverr = m_save.read_file(*file);
 
 				// handle the result
 				switch (saverr)
@@ -919,9 +1135,8 @@ void running_machine::handle_saveload()
 					break;
 				}
 
-				// close and perhaps delete the file
-				if (saverr != STATERR_NONE && m_saveload_schedule == saveload_schedule::SAVE)
-					file.remove_on_close();
+				if (m_boot_state)
+					m_boot_state->state_loaded(m_saveload_pending_file, saverr);
 			}
 			else if ((openflags == OPEN_FLAG_READ) && (std::errc::no_such_file_or_directory == filerr))
 			{
@@ -942,6 +1157,112 @@ void running_machine::handle_saveload()
 }
 
 
+//-------------------------------------------------
+//  run_ahead - snapshot the machine, emulate
+//  frames ahead without output, display the last
+//  one, and restore the snapshot
+//-------------------------------------------------
+
+void running_machine::run_ahead()
+{
+	if (m_save.write_snapshot(m_runahead_state) != STATERR_NONE)
+	{
+		m_video->begin_runahead();
+		m_video->end_runahead();
+		return;
+	}
+
+	// inputs stay as polled for the frame just completed
+	int const frames = options().runahead();
+	sound().set_output_suppressed(true);
+	m_video->begin_runahead();
+	for (int frame = 0; (frames > frame) && !m_exit_pending && !m_hard_reset_pending; frame++)
+	{
+		if ((frames - 1) == frame)
+			m_video->set_runahead_last_frame();
+		u32 const count = m_video->frame_count();
+		while ((m_video->frame_count() == count) && !m_exit_pending && !m_hard_reset_pending)
+			m_scheduler.timeslice();
+	}
+	m_video->end_runahead();
+	sound().set_output_suppressed(false);
+
+	// go back to where the displayed frame was completed
+	save_error const err = m_save.read_buffer(m_runahead_state.data(), m_runahead_state.size());
+	if (err != STATERR_NONE)
+		logerror("Run-ahead: unable to restore state (error %d)\n", int(err));
+}
+
+
+//-------------------------------------------------
+//  complete_state_write - report the result of a
+//  state written in the background once it has
+//  finished, optionally waiting for it
+//-------------------------------------------------
+
+void running_machine::complete_state_write(bool wait)
+{
+	if (m_saveload_item)
+	{
+		if (!wait && !osd_work_item_wait(m_saveload_item, 0))
+			return;
+		while (!osd_work_item_wait(m_saveload_item, osd_ticks_per_second())) { }
+		osd_work_item_release(m_saveload_item);
+		m_saveload_item = nullptr;
+	}
+	else if (!m_saveload_file)
+	{
+		return;
+	}
+
+	// report the result
+	save_error const saverr = m_saveload_result;
+	switch (saverr)
+	{
+	case STATERR_ILLEGAL_REGISTRATIONS:
+		popmessage("Error: Unable to save state due to illegal registrations. See error.log for details.");
+		break;
+
+	case STATERR_WRITE_ERROR:
+		popmessage("Error: Unable to save state due to a write error. Verify there is enough disk space.");
+		break;
+
+	case STATERR_NONE:
+		if (!(m_system.flags & MACHINE_SUPPORTS_SAVE))
+			popmessage("State successfully saved.\nWarning: Save states are not officially supported for this machine.");
+		else
+			popmessage("State successfully saved.");
+		break;
+
+	default:
+		popmessage("Error: Unknown error during state save.");
+		break;
+	}
+
+	// close and perhaps delete the file
+	if (saverr != STATERR_NONE)
+		m_saveload_file->remove_on_close();
+	m_saveload_file.reset();
+
+	std::string const filename(std::move(m_saveload_filename));
+	m_saveload_filename.clear();
+	m_state_saved_notifier(filename, saverr);
+}
+
+
+//-------------------------------------------------
+//  write_state_callback - compress and write a
+//  state snapshot to its file
+//-------------------------------------------------
+
+void *running_machine::write_state_callback(void *param, int threadid)
+{
+	running_machine &machine = *reinterpret_cast<running_machine *>(param);
+	machine.m_saveload_result = save_manager::write_snapshot_file(*machine.m_saveload_file, machine.m_saveload_buffer);
+	return nullptr;
+}
+
+
 //-------------------------------------------------
 //  soft_reset - actually perform a soft-reset
 //  of the system
@@ -1185,6 +1506,39 @@ void running_machine::popup_message(util::format_argument_pack<char> const &args
 }
 
 
+//-------------------------------------------------
+//  startup_phase - record the time taken by the
+//  startup phase that just finished
+//-------------------------------------------------
+
+void running_machine::startup_phase(const char *name)
+{
+	osd_ticks_t const now = osd_ticks();
+	m_startup_phases.emplace_back(name, now - m_startup_phase_start);
+	m_startup_phase_start = now;
+}
+
+
+//-------------------------------------------------
+//  report_startup_phases - print the startup
+//  timeline in verbose mode
+//-------------------------------------------------
+
+void running_machine::report_startup_phases()
+{
+	double const ms_per_tick = 1000.0 / double(osd_ticks_per_second());
+	osd_ticks_t total = 0;
+	osd_printf_verbose("Startup timeline:\n");
+	for (auto const &phase : m_startup_phases)
+	{
+		osd_printf_verbose("  %-20s %9.2f ms\n", phase.first, double(phase.second) * ms_per_tick);
+		total += phase.second;
+	}
+	osd_printf_verbose("  %-20s %9.2f ms\n", "total", double(total) * ms_per_tick);
+	m_startup_phases.clear();
+}
+
+
 //**************************************************************************
 //  CALLBACK ITEMS
 //**************************************************************************
@@ -1233,6 +1587,8 @@ void running_machine::export_http_api()
 			response->set_content_type("application/json");
 			response->set_body(s.GetString());
 		});
+
+		m_telemetry = std::make_unique<machine_telemetry>(*this, *m_manager.http());
 	}
 }
 
@@ -1316,6 +1672,11 @@ void running_machine::emscripten_main_loop()
 		while (!machine->m_paused && !machine->scheduled_event_pending() && scheduler->time() < stoptime)
 		{
 			scheduler->timeslice();
+			if (machine->m_debug_sync_pending)
+			{
+				machine->m_debug_sync_pending = false;
+				machine->m_debugger->cpu().reverse().timeslice_boundary();
+			}
 			// handle save/load
 			if (machine->m_saveload_schedule != saveload_schedule::NONE)
 			{
@@ -51,6 +51,7 @@ enum machine_notification
 // debug flags
 constexpr int DEBUG_FLAG_ENABLED        = 0x00000001;       // debugging is enabled
 constexpr int DEBUG_FLAG_CALL_HOOK      = 0x00000002;       // CPU cores must call instruction hook
+constexpr int DEBUG_FLAG_HOOK_PAGES     = 0x00000004;       // only call the instruction hook on pages marked by the debugger
 constexpr int DEBUG_FLAG_OSD_ENABLED    = 0x00001000;       // The OSD debugger is enabled
 
 
@@ -91,6 +92,22 @@ public:
 
 
 
+// ======================> device_memory_usage
+
+// host memory attributed to a device, in bytes
+struct device_memory_usage
+{
+	device_t *  device = nullptr;   // owning device
+	u64         regions = 0;        // memory regions (ROM copies and the like)
+	u64         shares = 0;         // memory shares (RAM and other mapped buffers)
+	u64         gfx = 0;            // decoded graphics elements
+	u64         state = 0;          // save-registered items; largely overlaps the shares
+
+	u64 total() const { return regions + shares + gfx; }
+};
+
+
+
 // ======================> running_machine
 
 typedef delegate<void ()> machine_notify_delegate;
@@ -104,6 +121,7 @@ class running_machine
 
 	friend class sound_manager;
 	friend class memory_manager;
+	friend class nvram_checkpoint;
 
 	typedef std::function<void (const char*)> logerror_callback;
 
@@ -148,6 +166,8 @@ public:
 	const std::string &basename() const { return m_basename; }
 	int sample_rate() const { return m_sample_rate; }
 	bool save_or_load_pending() const { return !m_saveload_pending_file.empty(); }
+	bool state_write_pending() const { return m_saveload_item != nullptr; }
+	boot_state_cache *boot_state() const { return m_boot_state.get(); }
 
 	// RAII-based side effect disable
 	// NOP-ed when passed false, to make it more easily conditional
@@ -169,6 +189,8 @@ public:
 	void resume();
 	void toggle_pause();
 	void add_notifier(machine_notification event, machine_notify_delegate callback, bool first = false);
+	util::notifier_subscription add_state_saved_notifier(delegate<void (std::string_view, save_error)> &&n) { return m_state_saved_notifier.subscribe(std::move(n)); }
+	template <typename T> util::notifier_subscription add_state_saved_notifier(T &&n) { return add_state_saved_notifier(delegate<void (std::string_view, save_error)>(std::forward<T>(n))); }
 	void call_notifiers(machine_notification which);
 	void add_logerror_callback(logerror_callback callback);
 	void debug_break();
@@ -183,6 +205,9 @@ public:
 	bool rewind_step();
 	void rewind_invalidate();
 
+	// have the debugger called back between timeslices
+	void request_debug_sync() { m_debug_sync_pending = true; }
+
 	// scheduled operations
 	void schedule_exit();
 	void schedule_hard_reset();
@@ -205,6 +230,10 @@ public:
 	std::string compose_saveload_filename(std::string &&base_filename, const char **searchpath = nullptr);
 	std::string get_statename(const char *statename_opt) const;
 
+	// memory accounting
+	std::vector<device_memory_usage> memory_usage();
+	void dump_memory_usage();
+
 private:
 	// side effect disable counter
 	u32                     m_side_effects_disabled;
@@ -246,12 +275,17 @@ private:
 	void start();
 	void set_saveload_filename(std::string &&filename);
 	void handle_saveload();
+	void complete_state_write(bool wait);
+	void run_ahead();
+	static void *write_state_callback(void *param, int threadid);
 	void soft_reset(s32 param = 0);
 	std::string nvram_filename(device_t &device) const;
 	void nvram_load();
 	void nvram_save();
 	void popup_clear() const;
 	void popup_message(util::format_argument_pack<char> const &args) const;
+	void startup_phase(const char *name);
+	void report_startup_phases();
 
 	// internal callbacks
 	void logfile_callback(const char *buffer);
@@ -285,6 +319,10 @@ private:
 	std::unique_ptr<rom_load_manager> m_rom_load;      // internal data from romload.cpp
 	std::unique_ptr<debugger_manager> m_debugger;      // internal data from debugger.cpp
 	std::unique_ptr<natural_keyboard> m_natkeyboard;   // internal data from natkeyboard.cpp
+	std::unique_ptr<machine_telemetry> m_telemetry;    // internal data from telemetry.cpp
+	std::unique_ptr<nvram_checkpoint> m_nvram_checkpoint; // internal data from nvcheckpoint.cpp
+	std::unique_ptr<boot_state_cache> m_boot_state;    // internal data from bootstate.cpp
+	std::unique_ptr<netplay_manager> m_netplay;        // internal data from netplay.cpp
 
 	// system state
 	machine_phase           m_current_phase;        // current execution phase
@@ -313,6 +351,25 @@ private:
 	std::string             m_saveload_pending_file;
 	const char *            m_saveload_searchpath;
 
+	// background state writing
+	osd_work_queue *        m_saveload_queue;       // queue for compressing and writing states
+	osd_work_item *         m_saveload_item;        // state write in progress
+	std::unique_ptr<emu_file> m_saveload_file;      // file being written
+	std::string             m_saveload_filename;    // name of the file being written
+	std::vector<u8>         m_saveload_buffer;      // snapshot being written, reused between saves
+	save_error              m_saveload_result;      // result of the state write
+	util::notifier<std::string_view, save_error> m_state_saved_notifier;
+
+	// run-ahead
+	std::vector<u8>         m_runahead_state;       // snapshot taken before emulating ahead
+
+	// debugger
+	bool                    m_debug_sync_pending;   // debugger wants to work between timeslices
+
+	// startup profiling
+	osd_ticks_t             m_startup_phase_start;  // when the current startup phase began
+	std::vector<std::pair<const char *, osd_ticks_t> > m_startup_phases; // completed startup phases and their durations
+
 	// notifier callbacks
 	struct notifier_callback_item
 	{
@@ -0,0 +1,621 @@
+// license:BSD-3-Clause
+// copyright-holders:Vas Crabb
+/***************************************************************************
+
+    netplay.cpp
+
+    Rollback network play.
+
+****************************************************************************
+
+    Two instances running the same system exchange the digital state of
+    every input port each frame; each instance plays with its own
+    controls mapped to its own player, and the states from both sides are
+    ORed together.  Local inputs are applied a few frames after they're
+    sampled (-netplay_delay), which hides some of the network latency.
+
+    When the other side's inputs for a frame haven't arrived in time,
+    they're predicted to be the same as the last ones received, and the
+    frame is emulated anyway.  A state is captured after every frame, so
+    when inputs arrive that differ from the prediction, the machine goes
+    back to the state before the first mispredicted frame and emulates up
+    to the present again, with sound and video output suppressed.  Only
+    -netplay_rollback frames may be predicted; beyond that emulation waits
+    for the other side.
+
+    Packets carry all the local inputs the other side hasn't acknowledged
+    yet, so lost packets are made up for by later ones, along with a CRC
+    of the latest state whose inputs are confirmed on both sides.  The
+    CRCs are compared to detect desynchronisation, in which case the
+    session carries on but the user is told.
+
+    Analog inputs aren't exchanged, and both instances must start with the
+    same system, settings and NVRAM.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "netplay.h"
+
+#include "emuopts.h"
+
+#include "hashing.h"
+
+#include "asio.h"
+
+#include <algorithm>
+#include <cstring>
+
+
+namespace {
+
+// packet layout (all values little-endian)
+constexpr u32 PACKET_MAGIC = 0x4c504e4d; // 'MNPL'
+constexpr u16 PACKET_VERSION = 1;
+constexpr size_t HEADER_BYTES = 4 + 2 + 2 + 4 + 4 + 4 + 4 + 2;
+constexpr size_t MAX_PACKET_BYTES = 1400;
+
+// waiting for the other side
+constexpr int FIRST_CONTACT_SECONDS = 60;
+constexpr int TIMEOUT_SECONDS = 5;
+
+void put_u16(std::vector<u8> &buf, u16 value)
+{
+	buf.push_back(u8(value));
+	buf.push_back(u8(value >> 8));
+}
+
+void put_u32(std::vector<u8> &buf, u32 value)
+{
+	put_u16(buf, u16(value));
+	put_u16(buf, u16(value >> 16));
+}
+
+u16 get_u16(const u8 *buf)
+{
+	return buf[0] | (u16(buf[1]) << 8);
+}
+
+u32 get_u32(const u8 *buf)
+{
+	return get_u16(buf) | (u32(get_u16(buf + 2)) << 16);
+}
+
+} // anonymous namespace
+
+
+
+//**************************************************************************
+//  TRANSPORT
+//**************************************************************************
+
+class netplay_manager::transport
+{
+public:
+	transport() : m_socket(m_context) { }
+
+	bool open(int port, std::string_view peer)
+	{
+		// the peer is given as host:port
+		auto const colon = peer.rfind(':');
+		if ((std::string_view::npos == colon) || !colon)
+		{
+			osd_printf_error("Netplay: peer \"%s\" must be given as host:port\n", peer);
+			return false;
+		}
+
+		std::error_code err;
+		asio::ip::udp::resolver resolver(m_context);
+		auto const results = resolver.resolve(asio::ip::udp::v4(), std::string(peer.substr(0, colon)), std::string(peer.substr(colon + 1)), err);
+		if (err || results.empty())
+		{
+			osd_printf_error("Netplay: unable to resolve %s (%s)\n", peer, err.message());
+			return false;
+		}
+		m_peer = *results.begin();
+
+		m_socket.open(asio::ip::udp::v4(), err);
+		if (!err)
+			m_socket.bind(asio::ip::udp::endpoint(asio::ip::udp::v4(), asio::ip::port_type(port)), err);
+		if (!err)
+			m_socket.non_blocking(true, err);
+		if (err)
+		{
+			osd_printf_error("Netplay: unable to listen on UDP port %d (%s)\n", port, err.message());
+			return false;
+		}
+		return true;
+	}
+
+	void send(const std::vector<u8> &packet)
+	{
+		std::error_code err;
+		m_socket.send_to(asio::buffer(packet), m_peer, 0, err);
+	}
+
+	size_t receive(u8 *buffer, size_t length)
+	{
+		// only take packets from the peer
+		for (;;)
+		{
+			std::error_code err;
+			asio::ip::udp::endpoint sender;
+			size_t const received = m_socket.receive_from(asio::buffer(buffer, length), sender, 0, err);
+			if (err)
+				return 0;
+			if (sender == m_peer)
+				return received;
+		}
+	}
+
+private:
+	asio::io_context                m_context;
+	asio::ip::udp::socket           m_socket;
+	asio::ip::udp::endpoint         m_peer;
+};
+
+
+
+//**************************************************************************
+//  NETWORK PLAY
+//**************************************************************************
+
+//-------------------------------------------------
+//  netplay_manager - constructor
+//-------------------------------------------------
+
+netplay_manager::netplay_manager(running_machine &machine)
+	: m_machine(machine)
+	, m_transport(std::make_unique<transport>())
+	, m_active(false)
+	, m_ports(machine.ioport().ports().size())
+	, m_delay(std::clamp(machine.options().netplay_delay(), 0, 8))
+	, m_window(std::clamp(machine.options().netplay_rollback(), 1, 30))
+	, m_frame(0)
+	, m_remote_received(0)
+	, m_peer_ack(0)
+	, m_rollback_frame(NO_FRAME)
+	, m_resimulating(false)
+	, m_capture_pending(false)
+	, m_local(HISTORY_SIZE * m_ports, 0)
+	, m_remote(HISTORY_SIZE * m_ports, 0)
+	, m_used(HISTORY_SIZE * m_ports, 0)
+	, m_used_frame(HISTORY_SIZE, NO_FRAME)
+	, m_bytes(0)
+	, m_shadow_state(nullptr)
+	, m_peer_hash_frame(NO_FRAME)
+	, m_peer_hash(0)
+	, m_desynced(false)
+	, m_rollbacks(0)
+	, m_resimulated(0)
+	, m_stalls(0)
+{
+	// run-ahead restores states behind our back
+	if (machine.options().runahead())
+		throw emu_fatalerror("Network play can't be used with run-ahead");
+	if (!(machine.system().flags & MACHINE_SUPPORTS_SAVE))
+		osd_printf_warning("Netplay: this system doesn't officially support save states, rolling back may desynchronise\n");
+
+	if (!m_transport->open(machine.options().netplay_port(), machine.options().netplay_peer()))
+		throw emu_fatalerror("Unable to start network play");
+
+	m_active = true;
+	osd_printf_info("Netplay: playing against %s with %u frame(s) of delay\n", machine.options().netplay_peer(), m_delay);
+}
+
+
+//-------------------------------------------------
+//  ~netplay_manager - destructor
+//-------------------------------------------------
+
+netplay_manager::~netplay_manager()
+{
+	if (m_rollbacks)
+		osd_printf_verbose("Netplay: %u rollbacks, %u frames emulated again, %u waits for the peer\n", m_rollbacks, m_resimulated, m_stalls);
+
+	// release the states before the byte count they update
+	m_states.clear();
+}
+
+
+//-------------------------------------------------
+//  begin_frame - get ready to apply a frame's
+//  inputs
+//-------------------------------------------------
+
+void netplay_manager::begin_frame()
+{
+	if (!m_active)
+		return;
+
+	if (!m_resimulating)
+	{
+		receive();
+
+		// don't get further ahead of the peer than we can roll back
+		if (m_frame >= (m_remote_received + m_window))
+			wait_for_peer();
+	}
+	predict(m_frame);
+}
+
+
+//-------------------------------------------------
+//  port_update - note a port's local input state
+//  and replace it with the one to emulate
+//-------------------------------------------------
+
+void netplay_manager::port_update(size_t index, ioport_value &digital)
+{
+	if (!m_active || (m_ports <= index))
+		return;
+
+	// local inputs sampled now are applied after the delay; inputs sampled
+	// while emulating frames again have been superseded
+	if (!m_resimulating)
+		local(m_frame + m_delay)[index] = digital;
+
+	digital = ((m_frame >= m_delay) ? local(m_frame)[index] : 0) | used(m_frame)[index];
+}
+
+
+//-------------------------------------------------
+//  end_frame - finish applying a frame's inputs
+//-------------------------------------------------
+
+void netplay_manager::end_frame()
+{
+	if (!m_active)
+		return;
+
+	m_frame++;
+	m_capture_pending = true;
+	if (!m_resimulating)
+		send();
+}
+
+
+//-------------------------------------------------
+//  timeslice_boundary - capture a state if a
+//  frame's inputs were applied, and roll back if
+//  inputs were mispredicted
+//-------------------------------------------------
+
+void netplay_manager::timeslice_boundary()
+{
+	if (!m_capture_pending)
+		return;
+	m_capture_pending = false;
+	if (!m_active)
+		return;
+
+	capture();
+	if (NO_FRAME != m_rollback_frame)
+		rollback();
+	check_desync();
+}
+
+
+//-------------------------------------------------
+//  predict - choose remote inputs for a frame
+//-------------------------------------------------
+
+void netplay_manager::predict(u32 frame)
+{
+	// until they're known, assume the peer hasn't changed what it's doing
+	ioport_value *const dest = used(frame);
+	if (frame < m_remote_received)
+		std::copy_n(remote(frame), m_ports, dest);
+	else if (m_remote_received)
+		std::copy_n(remote(m_remote_received - 1), m_ports, dest);
+	else
+		std::fill_n(dest, m_ports, 0);
+	m_used_frame[frame % HISTORY_SIZE] = frame;
+}
+
+
+//-------------------------------------------------
+//  apply_inputs - put a frame's inputs back into
+//  the ports after loading a state
+//-------------------------------------------------
+
+void netplay_manager::apply_inputs(u32 frame)
+{
+	size_t index = 0;
+	for (auto &port : m_machine.ioport().ports())
+	{
+		if (m_ports <= index)
+			break;
+		port.second->live().digital = ((frame >= m_delay) ? local(frame)[index] : 0) | used(frame)[index];
+		++index;
+	}
+}
+
+
+//-------------------------------------------------
+//  send - send the local inputs the peer doesn't
+//  have yet
+//-------------------------------------------------
+
+void netplay_manager::send()
+{
+	// local inputs are known up to the delay ahead of the frame being emulated
+	u32 const end = m_frame + m_delay;
+	u32 const limit = std::max<u32>(1, (MAX_PACKET_BYTES - HEADER_BYTES) / std::max<size_t>(1, m_ports * 4));
+	u32 first = std::max(m_peer_ack, (end > MAX_RESEND) ? (end - MAX_RESEND) : 0);
+	u32 const count = std::min(end - std::min(first, end), std::min(limit, MAX_RESEND));
+
+	// report the newest state confirmed on our side
+	u32 hash_frame = NO_FRAME;
+	u32 hash = 0;
+	u32 const confirmed = std::min(m_remote_received, m_frame);
+	if (confirmed && (NO_FRAME == m_rollback_frame))
+	{
+		snapshot const *const state = find_state(confirmed - 1);
+		if (state)
+		{
+			hash_frame = state->frame;
+			hash = state->hash;
+		}
+	}
+
+	std::vector<u8> packet;
+	packet.reserve(HEADER_BYTES + (count * m_ports * 4));
+	put_u32(packet, PACKET_MAGIC);
+	put_u16(packet, PACKET_VERSION);
+	put_u16(packet, u16(m_ports));
+	put_u32(packet, m_remote_received);
+	put_u32(packet, hash_frame);
+	put_u32(packet, hash);
+	put_u32(packet, first);
+	put_u16(packet, u16(count));
+	for (u32 frame = first; (first + count) > frame; ++frame)
+	{
+		ioport_value const *const inputs = local(frame);
+		for (size_t i = 0; m_ports > i; ++i)
+			put_u32(packet, (frame >= m_delay) ? inputs[i] : 0);
+	}
+	m_transport->send(packet);
+}
+
+
+//-------------------------------------------------
+//  receive - take in packets from the peer
+//-------------------------------------------------
+
+void netplay_manager::receive()
+{
+	u8 buffer[65536];
+	size_t length;
+	while ((length = m_transport->receive(buffer, sizeof(buffer))) != 0)
+	{
+		if ((HEADER_BYTES > length) || (get_u32(&buffer[0]) != PACKET_MAGIC) || (get_u16(&buffer[4]) != PACKET_VERSION))
+			continue;
+		if (get_u16(&buffer[6]) != m_ports)
+		{
+			stop("the other side is running a different system");
+			return;
+		}
+
+		u32 const ack = get_u32(&buffer[8]);
+		u32 const hash_frame = get_u32(&buffer[12]);
+		u32 const hash = get_u32(&buffer[16]);
+		u32 const first = get_u32(&buffer[20]);
+		u32 const count = get_u16(&buffer[24]);
+		if ((HEADER_BYTES + (count * m_ports * 4)) > length)
+			continue;
+
+		m_peer_ack = std::max(m_peer_ack, ack);
+		if ((NO_FRAME != hash_frame) && ((NO_FRAME == m_peer_hash_frame) || (hash_frame > m_peer_hash_frame)))
+		{
+			m_peer_hash_frame = hash_frame;
+			m_peer_hash = hash;
+		}
+
+		// only take frames in order - anything after a gap will be sent again
+		for (u32 frame = first; (first + count) > frame; ++frame)
+		{
+			if (frame != m_remote_received)
+				continue;
+
+			ioport_value *const dest = remote(frame);
+			u8 const *const src = &buffer[HEADER_BYTES + ((frame - first) * m_ports * 4)];
+			for (size_t i = 0; m_ports > i; ++i)
+				dest[i] = get_u32(&src[i * 4]);
+			m_remote_received++;
+
+			// if we've already emulated this frame with different inputs, it'll need doing again
+			if ((frame < m_frame) && (m_used_frame[frame % HISTORY_SIZE] == frame) && !std::equal(dest, dest + m_ports, used(frame)))
+				m_rollback_frame = std::min(m_rollback_frame, frame);
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  wait_for_peer - wait for remote inputs when
+//  we're too far ahead to keep predicting
+//-------------------------------------------------
+
+void netplay_manager::wait_for_peer()
+{
+	osd_ticks_t const tps = osd_ticks_per_second();
+	osd_ticks_t const start = osd_ticks();
+	osd_ticks_t const timeout = tps * (m_remote_received ? TIMEOUT_SECONDS : FIRST_CONTACT_SECONDS);
+	osd_ticks_t last_send = start;
+	if (!m_remote_received)
+		osd_printf_info("Netplay: waiting for %s\n", m_machine.options().netplay_peer());
+
+	m_stalls++;
+	while (m_active && (m_frame >= (m_remote_received + m_window)))
+	{
+		osd_sleep(tps / 1000);
+		receive();
+
+		// the peer may be waiting for us too, so keep our inputs coming
+		osd_ticks_t const now = osd_ticks();
+		if ((now - last_send) >= (tps / 60))
+		{
+			send();
+			last_send = now;
+		}
+		if ((now - start) >= timeout)
+			stop(m_remote_received ? "lost contact with the other side" : "the other side didn't respond");
+	}
+}
+
+
+//-------------------------------------------------
+//  stop - give up on network play, carrying on
+//  with local inputs only
+//-------------------------------------------------
+
+void netplay_manager::stop(const char *reason)
+{
+	if (!m_active)
+		return;
+
+	osd_printf_error("Netplay: %s, network play stopped\n", reason);
+	m_machine.popmessage("Network play stopped: %s", reason);
+	m_active = false;
+	m_rollback_frame = NO_FRAME;
+	m_states.clear();
+	m_shadow_state = nullptr;
+}
+
+
+//-------------------------------------------------
+//  capture - capture a state after the last
+//  frame's inputs were applied, sharing unchanged
+//  pages with the previous one
+//-------------------------------------------------
+
+void netplay_manager::capture()
+{
+	save_manager &save = m_machine.save();
+	ram_state const *const reference = m_states.empty() ? nullptr : m_states.back().state.get();
+	if (m_shadow.empty())
+		m_shadow.resize(ram_state::get_size(save));
+	if (reference && (reference != m_shadow_state))
+		reference->decode(m_shadow.data());
+
+	auto state = std::make_unique<ram_state>(save, &m_bytes);
+	save_error const err = state->save(reference, m_shadow.data());
+	if (err != STATERR_NONE)
+	{
+		state.reset();
+		stop("unable to capture a state");
+		return;
+	}
+
+	// the shadow now holds exactly what was saved
+	m_shadow_state = state.get();
+	m_states.emplace_back(snapshot{ m_frame - 1, std::move(state), util::crc32_creator::simple(m_shadow.data(), m_shadow.size()) });
+
+	// keep enough to go back to just before the oldest frame that may be mispredicted
+	while (m_states.size() > (m_window + 2))
+		m_states.pop_front();
+}
+
+
+//-------------------------------------------------
+//  rollback - go back to before the first
+//  mispredicted frame and emulate up to the
+//  present again
+//-------------------------------------------------
+
+void netplay_manager::rollback()
+{
+	u32 const target = m_frame;
+	u32 const from = m_rollback_frame;
+	m_rollback_frame = NO_FRAME;
+
+	// find the state captured before the mispredicted frame's inputs were applied
+	auto found = m_states.end();
+	if (from)
+		found = std::find_if(m_states.begin(), m_states.end(), [from] (snapshot const &s) { return (from - 1) == s.frame; });
+	if (m_states.end() == found)
+	{
+		stop("unable to roll back far enough");
+		return;
+	}
+	save_error const err = found->state->load();
+	if (err != STATERR_NONE)
+	{
+		stop("unable to load a state");
+		return;
+	}
+
+	// states after it are about to be replaced
+	while (&m_states.back() != &*found)
+	{
+		if (m_states.back().state.get() == m_shadow_state)
+			m_shadow_state = nullptr;
+		m_states.pop_back();
+	}
+	apply_inputs(from - 1);
+	m_frame = from;
+
+	// emulate the frames again without output; the frame notifiers still
+	// run, so inputs are applied at the same points as the first time
+	sound_manager &sound = m_machine.sound();
+	video_manager &video = m_machine.video();
+	device_scheduler &scheduler = m_machine.scheduler();
+	m_resimulating = true;
+	sound.set_output_suppressed(true);
+	video.begin_resimulation();
+	while (m_active && (target > m_frame) && !m_machine.scheduled_event_pending())
+	{
+		while (!m_capture_pending && !m_machine.scheduled_event_pending())
+			scheduler.timeslice();
+		if (m_capture_pending)
+		{
+			m_capture_pending = false;
+			capture();
+		}
+	}
+	video.end_resimulation();
+	sound.set_output_suppressed(false);
+	m_resimulating = false;
+
+	m_rollbacks++;
+	m_resimulated += target - from;
+}
+
+
+//-------------------------------------------------
+//  find_state - get the state captured after a
+//  frame's inputs were applied
+//-------------------------------------------------
+
+netplay_manager::snapshot const *netplay_manager::find_state(u32 frame) const
+{
+	for (auto it = m_states.rbegin(); m_states.rend() != it; ++it)
+	{
+		if (frame == it->frame)
+			return &*it;
+		if (frame > it->frame)
+			break;
+	}
+	return nullptr;
+}
+
+
+//-------------------------------------------------
+//  check_desync - compare the peer's hash with
+//  ours once both are confirmed
+//-------------------------------------------------
+
+void netplay_manager::check_desync()
+{
+	if (m_desynced || (NO_FRAME == m_peer_hash_frame) || (NO_FRAME != m_rollback_frame) || (m_peer_hash_frame >= m_remote_received))
+		return;
+
+	snapshot const *const state = find_state(m_peer_hash_frame);
+	if (state && (state->hash != m_peer_hash))
+	{
+		osd_printf_error("Netplay: desynchronised from the other side at frame %u\n", m_peer_hash_frame);
+		m_machine.popmessage("Network play is out of sync");
+		m_desynced = true;
+	}
+}
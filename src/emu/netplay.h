@@ -0,0 +1,117 @@
+// license:BSD-3-Clause
+// copyright-holders:Vas Crabb
+/***************************************************************************
+
+    netplay.h
+
+    Rollback network play.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_NETPLAY_H
+#define MAME_EMU_NETPLAY_H
+
+#pragma once
+
+#include "save.h"
+
+#include <deque>
+#include <memory>
+#include <vector>
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// ======================> netplay_manager
+
+// exchanges digital inputs with one other instance over UDP, predicting the
+// other side's inputs when they haven't arrived yet and rolling back to a
+// saved state to emulate the mispredicted frames again when they differ
+class netplay_manager
+{
+public:
+	// construction/destruction
+	netplay_manager(running_machine &machine);
+	~netplay_manager();
+
+	// getters
+	running_machine &machine() const { return m_machine; }
+	bool active() const { return m_active; }
+	bool resimulating() const { return m_resimulating; }
+
+	// input port manager interface
+	void begin_frame();
+	void port_update(size_t index, ioport_value &digital);
+	void end_frame();
+
+	// capture a state after each frame and roll back if necessary
+	void timeslice_boundary();
+
+private:
+	class transport;
+
+	static constexpr u32 HISTORY_SIZE = 128;        // frames of inputs kept
+	static constexpr u32 MAX_RESEND = 32;           // most frames of inputs in a packet
+	static constexpr u32 NO_FRAME = ~u32(0);
+
+	// a state captured after applying a frame's inputs
+	struct snapshot
+	{
+		u32                         frame;          // frame whose inputs were last applied
+		std::unique_ptr<ram_state>  state;          // machine state
+		u32                         hash;           // CRC of the state data for desync detection
+	};
+
+	ioport_value *local(u32 frame) { return &m_local[(frame % HISTORY_SIZE) * m_ports]; }
+	ioport_value *remote(u32 frame) { return &m_remote[(frame % HISTORY_SIZE) * m_ports]; }
+	ioport_value *used(u32 frame) { return &m_used[(frame % HISTORY_SIZE) * m_ports]; }
+
+	void predict(u32 frame);
+	void apply_inputs(u32 frame);
+	void send();
+	void receive();
+	void wait_for_peer();
+	void stop(const char *reason);
+	void capture();
+	void rollback();
+	snapshot const *find_state(u32 frame) const;
+	void check_desync();
+
+	// internal state
+	running_machine &           m_machine;          // reference to our machine
+	std::unique_ptr<transport>  m_transport;        // UDP socket
+	bool                        m_active;           // still exchanging inputs?
+	size_t                      m_ports;            // number of input ports
+	u32                         m_delay;            // frames between sampling and applying local inputs
+	u32                         m_window;           // most frames the remote inputs may be predicted
+	u32                         m_frame;            // next frame to apply inputs for
+	u32                         m_remote_received;  // number of consecutive frames of remote inputs
+	u32                         m_peer_ack;         // number of frames of local inputs the peer has
+	u32                         m_rollback_frame;   // first mispredicted frame, or NO_FRAME
+	bool                        m_resimulating;     // emulating mispredicted frames again?
+	bool                        m_capture_pending;  // a frame's inputs were applied in the last timeslice
+	std::vector<ioport_value>   m_local;            // local inputs, by frame
+	std::vector<ioport_value>   m_remote;           // remote inputs received, by frame
+	std::vector<ioport_value>   m_used;             // remote inputs emulated with, by frame
+	std::vector<u32>            m_used_frame;       // frame each group of m_used belongs to
+
+	// rollback states
+	size_t                      m_bytes;            // memory used by states - must outlive them
+	std::deque<snapshot>        m_states;           // oldest first
+	std::vector<u8>             m_shadow;           // decoded contents of m_shadow_state
+	ram_state const *           m_shadow_state;     // state the shadow holds, if any
+
+	// desync detection
+	u32                         m_peer_hash_frame;  // frame the peer last sent a hash for
+	u32                         m_peer_hash;        // its hash
+	bool                        m_desynced;         // already reported a desync?
+
+	// statistics
+	u32                         m_rollbacks;        // number of rollbacks
+	u64                         m_resimulated;      // frames emulated again
+	u32                         m_stalls;           // times we waited for the peer
+};
+
+#endif // MAME_EMU_NETPLAY_H
@@ -0,0 +1,241 @@
+// license:BSD-3-Clause
+// copyright-holders:Vas Crabb
+/***************************************************************************
+
+    nvcheckpoint.cpp
+
+    Periodic background NVRAM checkpoints.
+
+****************************************************************************
+
+    NVRAM is normally only saved when the machine exits, so power loss
+    or a crash loses anything written since it started.  With
+    -nvram_checkpoint <seconds>, each NVRAM device is also serialised
+    to memory at that interval.  Devices have no common way to report
+    writes, so a checkpoint compares the serialised data with what was
+    last persisted and writes only the files that changed.
+
+    Files are written behind the emulation by a work queue, first to
+    "<name>.tmp" and then renamed over the real file, so an
+    interrupted write never leaves a truncated NVRAM file behind.  If
+    the previous checkpoint is still being written when the next one
+    is due, that one is skipped.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "nvcheckpoint.h"
+
+#include "emuopts.h"
+#include "fileio.h"
+
+#include "util/ioprocs.h"
+#include "util/path.h"
+
+#include "osdfile.h"
+
+
+namespace {
+
+// collects serialised NVRAM in memory
+class vector_write_stream : public util::write_stream
+{
+public:
+	vector_write_stream(std::vector<u8> &data) noexcept : m_data(data) { m_data.clear(); }
+
+	virtual std::error_condition finalize() noexcept override { return std::error_condition(); }
+	virtual std::error_condition flush() noexcept override { return std::error_condition(); }
+
+	virtual std::error_condition write(void const *buffer, std::size_t length, std::size_t &actual) noexcept override
+	{
+		actual = 0;
+		try
+		{
+			u8 const *const src = reinterpret_cast<u8 const *>(buffer);
+			m_data.insert(m_data.end(), src, src + length);
+		}
+		catch (...)
+		{
+			return std::errc::not_enough_memory;
+		}
+		actual = length;
+		return std::error_condition();
+	}
+
+private:
+	std::vector<u8> &m_data;
+};
+
+} // anonymous namespace
+
+
+
+//**************************************************************************
+//  NVRAM CHECKPOINT
+//**************************************************************************
+
+//-------------------------------------------------
+//  nvram_checkpoint - constructor
+//-------------------------------------------------
+
+nvram_checkpoint::nvram_checkpoint(running_machine &machine, const attotime &period)
+	: m_machine(machine)
+	, m_timer(nullptr)
+	, m_queue(nullptr)
+	, m_item(nullptr)
+{
+	// take a baseline of each device as it is now, just after loading
+	for (device_nvram_interface &nvram : nvram_interface_enumerator(machine.root_device()))
+	{
+		if (!nvram.nvram_can_save())
+			continue;
+
+		region &r = m_regions.emplace_back(region{ nvram, machine.nvram_filename(nvram.device()), { }, { }, nullptr, std::error_condition() });
+		vector_write_stream stream(r.persisted);
+		if (!nvram.nvram_save(stream))
+			r.persisted.clear();
+	}
+
+	if (!m_regions.empty())
+	{
+		m_timer = machine.scheduler().timer_alloc(timer_expired_delegate(FUNC(nvram_checkpoint::timer_expired), this));
+		m_timer->adjust(period, 0, period);
+	}
+}
+
+
+//-------------------------------------------------
+//  ~nvram_checkpoint - destructor
+//-------------------------------------------------
+
+nvram_checkpoint::~nvram_checkpoint()
+{
+	complete(true);
+	if (m_queue)
+		osd_work_queue_free(m_queue);
+}
+
+
+//-------------------------------------------------
+//  timer_expired - start a checkpoint unless the
+//  last one is still being written
+//-------------------------------------------------
+
+void nvram_checkpoint::timer_expired(s32 param)
+{
+	complete(false);
+	if (!m_item)
+		checkpoint();
+}
+
+
+//-------------------------------------------------
+//  checkpoint - serialise every device, and queue
+//  the ones that changed for writing
+//-------------------------------------------------
+
+void nvram_checkpoint::checkpoint()
+{
+	for (region &r : m_regions)
+	{
+		vector_write_stream stream(r.pending);
+		if (!r.nvram.nvram_save(stream) || (r.pending == r.persisted))
+			continue;
+
+		// open the temporary file here, so the path is resolved as it is for a normal save
+		auto file = std::make_unique<emu_file>(m_machine.options().nvram_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+		if (file->open(r.filename + ".tmp"))
+		{
+			osd_printf_error("Error opening NVRAM checkpoint file %s.tmp\n", r.filename);
+			continue;
+		}
+		r.file = std::move(file);
+		m_dirty.emplace_back(&r);
+	}
+	if (m_dirty.empty())
+		return;
+
+	if (!m_queue)
+		m_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
+	if (m_queue)
+		m_item = osd_work_item_queue(m_queue, &nvram_checkpoint::write_callback, this, 0);
+	if (!m_item)
+	{
+		write_callback(this, 0);
+		complete(true);
+	}
+}
+
+
+//-------------------------------------------------
+//  complete - collect the results of the
+//  checkpoint being written, optionally waiting
+//  for it to finish
+//-------------------------------------------------
+
+void nvram_checkpoint::complete(bool wait)
+{
+	if (m_item)
+	{
+		if (!wait && !osd_work_item_wait(m_item, 0))
+			return;
+		while (!osd_work_item_wait(m_item, osd_ticks_per_second())) { }
+		osd_work_item_release(m_item);
+		m_item = nullptr;
+	}
+
+	for (region *r : m_dirty)
+	{
+		if (r->result)
+			osd_printf_error("Error writing NVRAM checkpoint of %s (%s)\n", r->filename, r->result.message());
+		else
+			r->persisted.swap(r->pending);
+	}
+	m_dirty.clear();
+}
+
+
+//-------------------------------------------------
+//  write_callback - write the changed devices and
+//  move them into place
+//-------------------------------------------------
+
+void *nvram_checkpoint::write_callback(void *param, int threadid)
+{
+	nvram_checkpoint &checkpoint = *reinterpret_cast<nvram_checkpoint *>(param);
+	for (region *r : checkpoint.m_dirty)
+	{
+		std::string const tmppath(r->file->fullpath());
+		bool const written = r->file->write(r->pending.data(), u32(r->pending.size())) == r->pending.size();
+		r->file->close();
+		r->file.reset();
+
+		if (!written)
+		{
+			r->result = std::errc::io_error;
+			osd_file::remove(tmppath);
+		}
+		else
+		{
+			// the data must be on disk before the rename, or a crash could leave an
+			// empty or partial file under the real name
+			r->result = osd_file::sync(tmppath);
+			if (r->result)
+			{
+				osd_file::remove(tmppath);
+				continue;
+			}
+
+			// the temporary name is the real one with ".tmp" on the end, and syncing the
+			// directory makes the rename itself durable
+			std::string const path(tmppath.substr(0, tmppath.length() - 4));
+			r->result = osd_file::rename(tmppath, path);
+			if (!r->result)
+			{
+				std::string const dir(path.substr(0, path.length() - core_filename_extract_base(path).length()));
+				osd_file::sync(dir.empty() ? std::string(".") : dir);
+			}
+		}
+	}
+	return nullptr;
+}
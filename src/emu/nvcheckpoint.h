@@ -0,0 +1,65 @@
+// license:BSD-3-Clause
+// copyright-holders:Vas Crabb
+/***************************************************************************
+
+    nvcheckpoint.h
+
+    Periodic background NVRAM checkpoints.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_NVCHECKPOINT_H
+#define MAME_EMU_NVCHECKPOINT_H
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <system_error>
+#include <vector>
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// ======================> nvram_checkpoint
+
+// every so often, serialises each NVRAM device to memory and writes the
+// ones whose contents changed since they were last persisted, on a work
+// queue, to a temporary file that is then renamed over the real one
+class nvram_checkpoint
+{
+public:
+	// construction/destruction
+	nvram_checkpoint(running_machine &machine, const attotime &period);
+	~nvram_checkpoint();
+
+	// wait for any checkpoint in flight
+	void complete(bool wait);
+
+private:
+	struct region
+	{
+		device_nvram_interface &    nvram;              // device being checkpointed
+		std::string                 filename;           // relative name within the NVRAM path
+		std::vector<u8>             persisted;          // contents as last loaded or written
+		std::vector<u8>             pending;            // contents being written
+		std::unique_ptr<emu_file>   file;               // temporary file being written
+		std::error_condition        result;             // outcome of the write
+	};
+
+	void timer_expired(s32 param);
+	void checkpoint();
+	static void *write_callback(void *param, int threadid);
+
+	// internal state
+	running_machine &           m_machine;          // reference to our machine
+	emu_timer *                 m_timer;            // checkpoint timer
+	std::vector<region>         m_regions;          // NVRAM devices that can be saved
+	std::vector<region *>       m_dirty;            // regions in the checkpoint being written
+	osd_work_queue *            m_queue;            // queue for writing in the background
+	osd_work_item *             m_item;             // checkpoint being written
+};
+
+#endif // MAME_EMU_NVCHECKPOINT_H
@@ -31,6 +31,7 @@ output_manager::output_item::output_item(
 	, m_name(std::move(name))
 	, m_id(id)
 	, m_value(value)
+	, m_pending(false)
 	, m_notifylist()
 {
 }
@@ -46,9 +47,20 @@ void output_manager::output_item::notify(s32 value)
 	for (auto const &notify : m_notifylist)
 		notify(m_name.c_str(), value);
 
-	// call the global notifiers next
+	// global notifiers get the latest value once per frame
+	if (!m_pending && !m_manager.m_global_notifylist.empty())
+	{
+		m_pending = true;
+		m_manager.m_pending.emplace_back(this);
+	}
+}
+
+
+void output_manager::output_item::notify_global()
+{
+	m_pending = false;
 	for (auto const &notify : m_manager.m_global_notifylist)
-		notify(m_name.c_str(), value);
+		notify(m_name.c_str(), m_value);
 }
 
 
@@ -241,6 +253,23 @@ void output_manager::set_global_notifier(notifier_func callback, void *param)
 }
 
 
+//-------------------------------------------------
+//  notify_pending - call global notifiers for
+//  outputs that changed since the last call;
+//  lamps toggling many times a frame are only
+//  reported once with their final value
+//-------------------------------------------------
+
+void output_manager::notify_pending()
+{
+	// a notifier may set outputs, which are reported next time
+	m_notifying.swap(m_pending);
+	for (output_item *item : m_notifying)
+		item->notify_global();
+	m_notifying.clear();
+}
+
+
 /*-------------------------------------------------
     output_name_to_id - returns a unique ID for
     a given name
@@ -73,11 +73,14 @@ private:
 
 		void set_notifier(notifier_func callback, void *param) { m_notifylist.emplace_back(callback, param); }
 
+		void notify_global();
+
 	private:
 		output_manager      &m_manager;     // parent output manager
 		std::string const   m_name;         // string name of the item
 		u32 const           m_id;           // unique ID for this item
 		s32                 m_value;        // current value
+		bool                m_pending;      // global notifiers not told about the current value yet
 		notify_vector       m_notifylist;   // list of notifier callbacks
 	};
 
@@ -181,6 +184,9 @@ public:
 	// set a notifier globally
 	void set_global_notifier(notifier_func callback, void *param);
 
+	// tell global notifiers about outputs changed since the last call
+	void notify_pending();
+
 	// immdediately call a notifier for all outputs
 	template <typename T> void notify_all(T &&notifier) const
 	{
@@ -209,6 +215,8 @@ private:
 	running_machine &m_machine;                  // reference to our machine
 	std::unordered_map<std::string, output_item> m_itemtable;
 	notify_vector m_global_notifylist;
+	std::vector<output_item *> m_pending;        // items changed since global notifiers were called
+	std::vector<output_item *> m_notifying;      // items being reported to global notifiers
 	std::vector<std::reference_wrapper<output_item> > m_save_order;
 	std::unique_ptr<s32 []> m_save_data;
 	u32 m_uniqueid;
@@ -24,6 +24,10 @@
 #include "emu.h"
 #include "profiler.h"
 
+#include "corefile.h"
+
+#include <algorithm>
+
 
 
 //**************************************************************************
@@ -43,6 +47,9 @@ struct profile_string
 //**************************************************************************
 
 profiler_state g_profiler;
+tracer_state g_tracer;
+
+thread_local real_tracer_state::thread_buffer *real_tracer_state::s_buffer = nullptr;
 
 
 
@@ -232,3 +239,160 @@ void real_profiler_state::update_text(running_machine &machine)
 	memset(m_data, 0, sizeof(m_data));
 	m_text = stream.str();
 }
+
+
+
+
+//**************************************************************************
+//  REAL TRACER STATE
+//**************************************************************************
+
+namespace {
+
+//-------------------------------------------------
+//  json_escape - escape a name for use in a JSON
+//  string
+//-------------------------------------------------
+
+std::string json_escape(std::string_view text)
+{
+	std::string result;
+	result.reserve(text.length());
+	for (char const ch : text)
+	{
+		if ((ch == '"') || (ch == '\\'))
+			result.push_back('\\');
+		if (u8(ch) >= 0x20)
+			result.push_back(ch);
+	}
+	return result;
+}
+
+} // anonymous namespace
+
+
+//-------------------------------------------------
+//  real_tracer_state - constructor
+//-------------------------------------------------
+
+real_tracer_state::real_tracer_state()
+	: m_enabled(false)
+	, m_origin(0)
+{
+}
+
+
+//-------------------------------------------------
+//  ~real_tracer_state - destructor
+//-------------------------------------------------
+
+real_tracer_state::~real_tracer_state()
+{
+	m_enabled = false;
+}
+
+
+//-------------------------------------------------
+//  enable - start or stop recording
+//-------------------------------------------------
+
+void real_tracer_state::enable(bool state)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (state && !enabled())
+	{
+		// start from a clean timeline; threads keep their buffers
+		for (auto &buffer : m_buffers)
+			buffer->head.store(0, std::memory_order_relaxed);
+		m_origin = osd_ticks();
+	}
+	m_enabled = state;
+}
+
+
+//-------------------------------------------------
+//  name_thread - set the name shown for the
+//  calling thread
+//-------------------------------------------------
+
+void real_tracer_state::name_thread(char const *name)
+{
+	if (!s_buffer)
+		s_buffer = &add_thread();
+	std::lock_guard<std::mutex> lock(m_mutex);
+	s_buffer->name = name;
+}
+
+
+//-------------------------------------------------
+//  add_thread - allocate a buffer for the calling
+//  thread
+//-------------------------------------------------
+
+real_tracer_state::thread_buffer &real_tracer_state::add_thread()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	auto &buffer = m_buffers.emplace_back(std::make_unique<thread_buffer>());
+	buffer->events = std::make_unique<event []>(BUFFER_EVENTS);
+	buffer->head = 0;
+	buffer->id = u32(m_buffers.size());
+	buffer->name = util::string_format("thread %u", buffer->id);
+	return *buffer;
+}
+
+
+//-------------------------------------------------
+//  write - save the recorded events as a Chrome
+//  trace event file
+//-------------------------------------------------
+
+std::error_condition real_tracer_state::write(std::string_view filename)
+{
+	util::core_file::ptr file;
+	std::error_condition const filerr = util::core_file::open(filename, OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_NO_BOM, file);
+	if (filerr)
+		return filerr;
+
+	// timestamps and durations are in microseconds
+	double const scale = 1'000'000.0 / double(osd_ticks_per_second());
+	std::lock_guard<std::mutex> lock(m_mutex);
+	file->puts("{\"traceEvents\":[\n");
+	char const *separator = "";
+	for (auto const &buffer : m_buffers)
+	{
+		file->printf(
+				"%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+				separator,
+				buffer->id,
+				json_escape(buffer->name));
+		separator = ",\n";
+
+		// only the most recent events survive in each ring
+		u32 const head = buffer->head.load(std::memory_order_acquire);
+		u32 const count = std::min(head, BUFFER_EVENTS);
+		for (u32 i = head - count; i != head; ++i)
+		{
+			event const &ev = buffer->events[i & (BUFFER_EVENTS - 1)];
+			double const start = double(s64(ev.start - m_origin)) * scale;
+			if (ev.end)
+			{
+				file->printf(
+						",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+						json_escape(ev.name),
+						buffer->id,
+						start,
+						double(ev.end - ev.start) * scale);
+			}
+			else
+			{
+				file->printf(
+						",\n{\"name\":\"%s\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":%u,\"ts\":%.3f}",
+						json_escape(ev.name),
+						buffer->id,
+						start);
+			}
+		}
+	}
+	file->puts("\n],\"displayTimeUnit\":\"ms\"}\n");
+	return std::error_condition();
+}
@@ -19,6 +19,19 @@
 
     the profiler handles a FILO list so calls may be nested.
 
+    Tracing records named spans on a timeline instead, one ring buffer
+    per thread, and writes them out in Chrome trace event format (which
+    Perfetto and chrome://tracing load):
+
+    {
+        auto trace = g_tracer.begin("screen update");
+
+        your_work_here();
+    }
+
+    Names are not copied, so they must stay valid until the trace is
+    written.  Both are compiled out unless MAME_PROFILER is defined.
+
 ***************************************************************************/
 
 #ifndef MAME_EMU_PROFILER_H
@@ -33,9 +46,15 @@
 #include "eminline.h" // for get_profile_ticks()
 #include "osdcore.h"
 
+#include <atomic>
 #include <cstdio>
 #include <cstdlib>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
 
 
 //**************************************************************************
@@ -261,12 +280,157 @@ private:
 };
 
 
+// ======================> real_tracer_state
+
+class real_tracer_state
+{
+public:
+	class scope
+	{
+	private:
+		real_tracer_state &m_host;
+		char const *m_name;
+		osd_ticks_t m_start;
+
+	public:
+		scope(scope const &) = delete;
+		scope &operator=(scope const &) = delete;
+
+		scope(scope &&that) noexcept : m_host(that.m_host), m_name(that.m_name), m_start(that.m_start)
+		{
+			that.m_name = nullptr;
+		}
+
+		scope(real_tracer_state &host, char const *name) noexcept
+			: m_host(host)
+			, m_name(host.enabled() ? name : nullptr)
+			, m_start(m_name ? osd_ticks() : 0)
+		{
+		}
+
+		~scope()
+		{
+			stop();
+		}
+
+		void stop() noexcept
+		{
+			if (m_name)
+			{
+				m_host.record(m_name, m_start, osd_ticks());
+				m_name = nullptr;
+			}
+		}
+	};
+
+	// construction/destruction
+	real_tracer_state();
+	~real_tracer_state();
+
+	// getters
+	static constexpr bool available() noexcept { return true; }
+	bool enabled() const noexcept { return m_enabled.load(std::memory_order_relaxed); }
+
+	// enable/disable; enabling discards anything recorded before
+	void enable(bool state = true);
+
+	// name the calling thread in the exported trace
+	void name_thread(char const *name);
+
+	// record a span or a single point in time
+	[[nodiscard]] auto begin(char const *name) noexcept { return scope(*this, name); }
+	void instant(char const *name) noexcept { if (enabled()) record(name, osd_ticks(), 0); }
+
+	// write everything recorded in Chrome trace event format
+	std::error_condition write(std::string_view filename);
+
+private:
+	static constexpr u32 BUFFER_EVENTS = 1 << 16;
+
+	// a recorded span; an end of zero marks an instant
+	struct event
+	{
+		char const *    name;
+		osd_ticks_t     start;
+		osd_ticks_t     end;
+	};
+
+	// events recorded by one thread, oldest overwritten first
+	struct thread_buffer
+	{
+		std::unique_ptr<event []>   events;
+		std::atomic<u32>            head;
+		u32                         id;
+		std::string                 name;
+	};
+
+	thread_buffer &add_thread();
+
+	//-------------------------------------------------
+	//  record - append an event to the calling
+	//  thread's buffer
+	//-------------------------------------------------
+	void record(char const *name, osd_ticks_t start, osd_ticks_t end) noexcept
+	{
+		thread_buffer *buffer = s_buffer;
+		if (UNEXPECTED(!buffer))
+			buffer = s_buffer = &add_thread();
+
+		u32 const head = buffer->head.load(std::memory_order_relaxed);
+		buffer->events[head & (BUFFER_EVENTS - 1)] = event{ name, start, end };
+		buffer->head.store(head + 1, std::memory_order_release);
+	}
+
+	// internal state
+	std::atomic<bool>                           m_enabled;  // whether events are being recorded
+	osd_ticks_t                                 m_origin;   // time tracing was enabled
+	std::mutex                                  m_mutex;    // protects the buffer list
+	std::vector<std::unique_ptr<thread_buffer> > m_buffers; // per-thread buffers
+	static thread_local thread_buffer *         s_buffer;   // calling thread's buffer
+};
+
+
+// ======================> dummy_tracer_state
+
+class dummy_tracer_state
+{
+public:
+	class scope
+	{
+	public:
+		scope(scope const &) = delete;
+		scope &operator=(scope const &) = delete;
+		scope(scope &&that) noexcept = default;
+		scope() noexcept { }
+		~scope() { }
+		void stop() noexcept { }
+	};
+
+	// getters
+	static constexpr bool available() noexcept { return false; }
+	bool enabled() const noexcept { return false; }
+
+	// enable/disable
+	void enable(bool state = true) { }
+	void name_thread(char const *name) { }
+
+	// record a span or a single point in time
+	[[nodiscard]] auto begin(char const *name) noexcept { return scope(); }
+	void instant(char const *name) noexcept { }
+
+	// write everything recorded
+	std::error_condition write(std::string_view filename) { return std::errc::not_supported; }
+};
+
+
 // ======================> profiler_state
 
 #ifdef MAME_PROFILER
 typedef real_profiler_state profiler_state;
+typedef real_tracer_state tracer_state;
 #else
 typedef dummy_profiler_state profiler_state;
+typedef dummy_tracer_state tracer_state;
 #endif
 
 
@@ -276,6 +440,7 @@ typedef dummy_profiler_state profiler_state;
 //**************************************************************************
 
 extern profiler_state g_profiler;
+extern tracer_state g_tracer;
 
 
 #endif // MAME_EMU_PROFILER_H
@@ -17,6 +17,8 @@
 #include "aviio.h"
 #include "png.h"
 
+#include <algorithm>
+
 
 namespace
 {
@@ -28,11 +30,13 @@ namespace
 		{
 		}
 
+		~avi_movie_recording();
+
 		bool initialize(running_machine &machine, std::unique_ptr<emu_file> &&file, int32_t width, int32_t height);
-		virtual bool add_sound_to_recording(const s16 *sound, int numsamples) override;
 
 	protected:
 		virtual bool append_single_video_frame(bitmap_rgb32 &bitmap, const rgb_t *palette, int palette_entries) override;
+		virtual bool append_sound_samples(const s16 *sound, int numsamples) override;
 
 	private:
 		avi_file::ptr m_avi_file; // handle to the open movie file
@@ -46,14 +50,15 @@ namespace
 		~mng_movie_recording();
 
 		bool initialize(std::unique_ptr<emu_file> &&file, bitmap_t &snap_bitmap);
-		virtual bool add_sound_to_recording(const s16 *sound, int numsamples) override;
 
 	protected:
 		virtual bool append_single_video_frame(bitmap_rgb32 &bitmap, const rgb_t *palette, int palette_entries) override;
+		virtual bool append_sound_samples(const s16 *sound, int numsamples) override;
 
 	private:
 		std::unique_ptr<emu_file> m_mng_file; // handle to the open movie file
 		std::map<std::string, std::string> m_info_fields;
+		osd_work_queue *m_compress_queue; // queue for compressing large frames in slices
 	};
 };
 
@@ -62,6 +67,18 @@ namespace
 //  MOVIE RECORDING
 //**************************************************************************
 
+// a copy of a frame or a chunk of sound waiting to be written
+struct movie_recording::pending_write
+{
+	bool                video;          // video frame or sound samples
+	bitmap_rgb32        bitmap;         // copy of the frame
+	std::vector<rgb_t>  palette;        // copy of the adjusted palette
+	int                 repeat;         // number of times to append the frame
+	std::vector<s16>    sound;          // copy of the interleaved stereo samples
+	int                 numsamples;     // number of samples per channel
+};
+
+
 //-------------------------------------------------
 //  movie_recording - constructor
 //-------------------------------------------------
@@ -71,6 +88,7 @@ movie_recording::movie_recording(screen_device *screen)
 	, m_frame_period(attotime::zero)
 	, m_next_frame_time(attotime::zero)
 	, m_frame(0)
+	, m_writer([this] (pending_write &write) { return perform_write(write); }, MAX_PENDING_WRITES)
 {
 }
 
@@ -81,6 +99,12 @@ movie_recording::movie_recording(screen_device *screen)
 
 movie_recording::~movie_recording()
 {
+	// derived classes should have flushed already
+	flush();
+
+	// frames are never dropped, so report how often recording held up emulation
+	if (m_writer.stalls())
+		osd_printf_verbose("Movie recording waited for the writer %u time(s) over %d frame(s)\n", m_writer.stalls(), m_frame);
 }
 
 
@@ -90,23 +114,84 @@ movie_recording::~movie_recording()
 
 bool movie_recording::append_video_frame(bitmap_rgb32 &bitmap, attotime curtime)
 {
-	// identify the palette
-	bool has_palette = screen() && screen()->has_palette();
-	const rgb_t *palette = has_palette ? screen()->palette().palette()->entry_list_adjusted() : nullptr;
-	int palette_entries = has_palette ? screen()->palette().entries() : 0;
-
-	// keep appending frames until we're at curtime
+	// work out how many frames it takes to get to curtime
+	int repeat = 0;
 	while (next_frame_time() <= curtime)
 	{
-		// append this bitmap as a single frame
-		if (!append_single_video_frame(bitmap, palette, palette_entries))
-			return false;
-		m_frame++;
-
-		// advance time
+		repeat++;
 		set_next_frame_time(next_frame_time() + frame_period());
 	}
-	return true;
+	if (!repeat)
+		return !m_writer.failed();
+
+	// take a copy of the bitmap and palette, as they'll change before the writer gets to them
+	std::unique_ptr<pending_write> write = m_writer.alloc();
+	write->video = true;
+	write->repeat = repeat;
+	if ((write->bitmap.width() != bitmap.width()) || (write->bitmap.height() != bitmap.height()))
+		write->bitmap.allocate(bitmap.width(), bitmap.height());
+	copybitmap(write->bitmap, bitmap, 0, 0, 0, 0, bitmap.cliprect());
+	if (screen() && screen()->has_palette())
+	{
+		const rgb_t *palette = screen()->palette().palette()->entry_list_adjusted();
+		write->palette.assign(palette, palette + screen()->palette().entries());
+	}
+	else
+	{
+		write->palette.clear();
+	}
+	return m_writer.queue(std::move(write));
+}
+
+
+//-------------------------------------------------
+//  movie_recording::add_sound_to_recording
+//-------------------------------------------------
+
+bool movie_recording::add_sound_to_recording(const s16 *sound, int numsamples)
+{
+	auto profile = g_profiler.start(PROFILER_MOVIE_REC);
+
+	std::unique_ptr<pending_write> write = m_writer.alloc();
+	write->video = false;
+	write->sound.assign(sound, sound + (numsamples * 2));
+	write->numsamples = numsamples;
+	return m_writer.queue(std::move(write));
+}
+
+
+//-------------------------------------------------
+//  movie_recording::flush - wait for all queued
+//  writes to complete
+//-------------------------------------------------
+
+void movie_recording::flush()
+{
+	m_writer.flush();
+}
+
+
+//-------------------------------------------------
+//  movie_recording::perform_write - write a frame
+//  or sound samples to the file
+//-------------------------------------------------
+
+bool movie_recording::perform_write(pending_write &write)
+{
+	if (write.video)
+	{
+		for (int i = 0; write.repeat > i; i++)
+		{
+			if (!append_single_video_frame(write.bitmap, write.palette.empty() ? nullptr : &write.palette[0], write.palette.size()))
+				return false;
+			m_frame++;
+		}
+		return true;
+	}
+	else
+	{
+		return append_sound_samples(&write.sound[0], write.numsamples);
+	}
 }
 
 
@@ -166,6 +251,16 @@ const char *movie_recording::format_file_extension(movie_recording::format fmt)
 }
 
 
+//-------------------------------------------------
+//  avi_movie_recording - destructor
+//-------------------------------------------------
+
+avi_movie_recording::~avi_movie_recording()
+{
+	flush();
+}
+
+
 //-------------------------------------------------
 //  avi_movie_recording::initialize
 //-------------------------------------------------
@@ -217,13 +312,11 @@ bool avi_movie_recording::append_single_video_frame(bitmap_rgb32 &bitmap, const
 
 
 //-------------------------------------------------
-//  avi_movie_recording::append_video_frame
+//  avi_movie_recording::append_sound_samples
 //-------------------------------------------------
 
-bool avi_movie_recording::add_sound_to_recording(const s16 *sound, int numsamples)
+bool avi_movie_recording::append_sound_samples(const s16 *sound, int numsamples)
 {
-	auto profile = g_profiler.start(PROFILER_MOVIE_REC);
-
 	// write the next frame
 	avi_file::error avierr = m_avi_file->append_sound_samples(0, sound + 0, numsamples, 1);
 	if (avierr == avi_file::error::NONE)
@@ -240,6 +333,7 @@ bool avi_movie_recording::add_sound_to_recording(const s16 *sound, int numsample
 mng_movie_recording::mng_movie_recording(screen_device *screen, std::map<std::string, std::string> &&info_fields)
 	: movie_recording(screen)
 	, m_info_fields(std::move(info_fields))
+	, m_compress_queue(nullptr)
 {
 }
 
@@ -250,8 +344,11 @@ mng_movie_recording::mng_movie_recording(screen_device *screen, std::map<std::st
 
 mng_movie_recording::~mng_movie_recording()
 {
+	flush();
 	if (m_mng_file)
 		util::mng_capture_stop(*m_mng_file);
+	if (m_compress_queue)
+		osd_work_queue_free(m_compress_queue);
 }
 
 
@@ -267,6 +364,7 @@ bool mng_movie_recording::initialize(std::unique_ptr<emu_file> &&file, bitmap_t
 	set_frame_period(attotime::from_hz(rate));
 
 	m_mng_file = std::move(file);
+	m_compress_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
 	std::error_condition const pngerr = util::mng_capture_start(*m_mng_file, snap_bitmap, rate);
 	if (pngerr)
 		osd_printf_error("Error capturing MNG (%s:%d %s)\n", pngerr.category().name(), pngerr.value(), pngerr.message());
@@ -288,16 +386,16 @@ bool mng_movie_recording::append_single_video_frame(bitmap_rgb32 &bitmap, const
 			pnginfo.add_text(ent.first, ent.second);
 	}
 
-	std::error_condition const error = util::mng_capture_frame(*m_mng_file, pnginfo, bitmap, palette_entries, palette);
+	std::error_condition const error = util::mng_capture_frame(*m_mng_file, pnginfo, bitmap, palette_entries, palette, m_compress_queue);
 	return !error;
 }
 
 
 //-------------------------------------------------
-//  mng_movie_recording::add_sound_to_recording
+//  mng_movie_recording::append_sound_samples
 //-------------------------------------------------
 
-bool mng_movie_recording::add_sound_to_recording(const s16 *sound, int numsamples)
+bool mng_movie_recording::append_sound_samples(const s16 *sound, int numsamples)
 {
 	// not supported; do nothing
 	return true;
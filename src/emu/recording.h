@@ -18,7 +18,9 @@
 #define MAME_EMU_RECORDING_H
 
 #include <memory>
+#include <vector>
 
+#include "asyncwrite.h"
 #include "attotime.h"
 #include "palette.h"
 
@@ -54,9 +56,7 @@ public:
 
 	// methods
 	bool append_video_frame(bitmap_rgb32 &bitmap, attotime curtime);
-
-	// virtuals
-	virtual bool add_sound_to_recording(const s16 *sound, int numsamples) = 0;
+	bool add_sound_to_recording(const s16 *sound, int numsamples);
 
 	// statics
 	static movie_recording::ptr create(running_machine &machine, screen_device *screen, format fmt, std::unique_ptr<emu_file> &&file, bitmap_rgb32 &snap_bitmap);
@@ -68,18 +68,30 @@ protected:
 	movie_recording(const movie_recording &) = delete;
 	movie_recording(movie_recording &&) = delete;
 
-	// virtuals
+	// virtuals - called from the writer thread
 	virtual bool append_single_video_frame(bitmap_rgb32 &bitmap, const rgb_t *palette, int palette_entries) = 0;
+	virtual bool append_sound_samples(const s16 *sound, int numsamples) = 0;
 
 	// accessors
 	int current_frame() const { return m_frame; }
 	void set_frame_period(attotime time) { m_frame_period = time; }
 
+	// wait for queued writes; must be called before the derived class closes its file
+	void flush();
+
 private:
+	struct pending_write;
+
+	// maximum number of writes in flight before the caller waits
+	static constexpr size_t MAX_PENDING_WRITES = 8;
+
+	bool perform_write(pending_write &write);
+
 	screen_device * m_screen;               // screen associated with this movie (can be nullptr)
 	attotime        m_frame_period;         // duration of movie frame
 	attotime        m_next_frame_time;      // time of next frame
-	int             m_frame;                // current movie frame number
+	int             m_frame;                // current movie frame number (only touched by the writer)
+	async_write_queue<pending_write> m_writer; // writes frames and sound on another thread
 };
 
 
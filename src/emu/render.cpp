@@ -57,6 +57,7 @@
 #include "util/xmlfile.h"
 
 #include <algorithm>
+#include <thread>
 
 
 
@@ -99,6 +100,49 @@ struct render_target::object_transform
 };
 
 
+// retained geometry of a layout element primitive, reused on later
+// frames as long as everything it was computed from is unchanged
+struct render_target::element_geometry
+{
+	// inputs
+	layout_view_item const *item = nullptr;    // item the geometry belongs to
+	render_texture *    texture = nullptr;      // element state texture
+	float               xoffs, yoffs;           // item transform
+	float               xscale, yscale;
+	int                 orientation;
+	float               scroll[4];              // scroll size and position
+	bool                wrapx, wrapy;           // scroll wrapping
+	s32                 width, height;          // target size
+	int                 maxwidth, maxheight;    // maximum texture size
+
+	// outputs
+	render_bounds       bounds;                 // clipped primitive bounds
+	render_bounds       full_bounds;            // unclipped primitive bounds
+	render_quad_texuv   texcoords;              // clipped texture coordinates
+	s32                 texwidth, texheight;    // scaled texture size
+	bool                clipped;                // primitive is entirely clipped out
+};
+
+
+// a layout element texture variant to be rasterised ahead of building
+// the primitive list
+struct render_target::element_scale_job
+{
+	layout_element *    element;                // element being drawn
+	render_texture *    texture;                // element state texture
+	bitmap_argb32 *     bitmap;                 // scaled bitmap to fill
+};
+
+
+// a run of jobs for the same element, which must be drawn on a single
+// thread as components keep per-component drawing state
+struct render_target::element_scale_batch
+{
+	element_scale_job const *   jobs;
+	size_t                      count;
+};
+
+
 
 //**************************************************************************
 //  GLOBAL VARIABLES
@@ -438,48 +482,12 @@ void render_texture::get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo
 	}
 	else
 	{
-		// make sure we can recover the original argb32 bitmap
-		bitmap_argb32 dummy;
-		bitmap_argb32 &srcbitmap = (m_bitmap != nullptr) ? downcast<bitmap_argb32 &>(*m_bitmap) : dummy;
-
-		// is it a size we already have?
-		scaled_texture *scaled = nullptr;
-		int scalenum;
-		for (scalenum = 0; scalenum < std::size(m_scaled); scalenum++)
+		// is it a size we already have?  if not, let the scaler do the work
+		scaled_texture *scaled = find_scaled(dwidth, dheight);
+		if (!scaled)
 		{
-			scaled = &m_scaled[scalenum];
-
-			// we need a non-NULL bitmap with matching dest size
-			if (scaled->bitmap != nullptr && dwidth == scaled->bitmap->width() && dheight == scaled->bitmap->height())
-				break;
-		}
-
-		// did we get one?
-		if (scalenum == std::size(m_scaled))
-		{
-			int lowest = -1;
-
-			// didn't find one -- take the entry with the lowest seqnum
-			for (scalenum = 0; scalenum < std::size(m_scaled); scalenum++)
-				if ((lowest == -1 || m_scaled[scalenum].seqid < m_scaled[lowest].seqid) && !primlist.has_reference(m_scaled[scalenum].bitmap.get()))
-					lowest = scalenum;
-			if (-1 == lowest)
-				throw emu_fatalerror("render_texture::get_scaled: Too many live texture instances!");
-
-			// throw out any existing entries
-			scaled = &m_scaled[lowest];
-			if (scaled->bitmap)
-			{
-				m_manager->invalidate_all(scaled->bitmap.get());
-				scaled->bitmap.reset();
-			}
-
-			// allocate a new bitmap
-			scaled->bitmap = std::make_unique<bitmap_argb32>(dwidth, dheight);
-			scaled->seqid = ++m_curseq;
-
-			// let the scaler do the work
-			(*m_scaler)(*scaled->bitmap, srcbitmap, m_sbounds, m_param);
+			scaled = &alloc_scaled(dwidth, dheight, primlist);
+			scale(*scaled->bitmap);
 		}
 
 		// finally fill out the new info
@@ -494,6 +502,89 @@ void render_texture::get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo
 }
 
 
+//-------------------------------------------------
+//  prepare_scaled - allocate a scaled bitmap to
+//  be filled by scale() ahead of get_scaled(),
+//  or return nullptr if there's nothing to do
+//-------------------------------------------------
+
+bitmap_argb32 *render_texture::prepare_scaled(u32 dwidth, u32 dheight, render_primitive_list &primlist)
+{
+	if (dwidth == 0) dwidth = 1;
+	if (dheight == 0) dheight = 1;
+
+	// get_scaled() uses the source bitmap directly in these cases
+	if (m_scaler == nullptr || (m_bitmap != nullptr && m_sbounds.width() == dwidth && m_sbounds.height() == dheight))
+		return nullptr;
+	if (find_scaled(dwidth, dheight))
+		return nullptr;
+
+	return alloc_scaled(dwidth, dheight, primlist).bitmap.get();
+}
+
+
+//-------------------------------------------------
+//  scale - run the scaler into a bitmap
+//-------------------------------------------------
+
+void render_texture::scale(bitmap_argb32 &dest)
+{
+	// make sure we can recover the original argb32 bitmap
+	bitmap_argb32 dummy;
+	bitmap_argb32 &srcbitmap = (m_bitmap != nullptr) ? downcast<bitmap_argb32 &>(*m_bitmap) : dummy;
+
+	(*m_scaler)(dest, srcbitmap, m_sbounds, m_param);
+}
+
+
+//-------------------------------------------------
+//  find_scaled - find a scaled variant with the
+//  given size
+//-------------------------------------------------
+
+render_texture::scaled_texture *render_texture::find_scaled(u32 dwidth, u32 dheight)
+{
+	// we need a non-NULL bitmap with matching dest size
+	for (scaled_texture &scaled : m_scaled)
+	{
+		if (scaled.bitmap != nullptr && dwidth == scaled.bitmap->width() && dheight == scaled.bitmap->height())
+			return &scaled;
+	}
+	return nullptr;
+}
+
+
+//-------------------------------------------------
+//  alloc_scaled - replace the least recently
+//  allocated unreferenced variant with a new
+//  bitmap of the given size
+//-------------------------------------------------
+
+render_texture::scaled_texture &render_texture::alloc_scaled(u32 dwidth, u32 dheight, render_primitive_list &primlist)
+{
+	// take the entry with the lowest seqnum
+	int lowest = -1;
+	for (int scalenum = 0; scalenum < std::size(m_scaled); scalenum++)
+		if ((lowest == -1 || m_scaled[scalenum].seqid < m_scaled[lowest].seqid) && !primlist.has_reference(m_scaled[scalenum].bitmap.get()))
+			lowest = scalenum;
+	if (-1 == lowest)
+		throw emu_fatalerror("render_texture::get_scaled: Too many live texture instances!");
+
+	// throw out any existing entries
+	scaled_texture &scaled = m_scaled[lowest];
+	if (scaled.bitmap)
+	{
+		m_manager->invalidate_all(scaled.bitmap.get());
+		scaled.bitmap.reset();
+	}
+
+	// allocate a new bitmap
+	scaled.bitmap = std::make_unique<bitmap_argb32>(dwidth, dheight);
+	scaled.seqid = ++m_curseq;
+	return scaled;
+}
+
+
 //-------------------------------------------------
 //  get_adjusted_palette - return the adjusted
 //  palette for a texture
@@ -643,6 +734,10 @@ void render_container::add_char(float x0, float y0, float height, float aspect,
 	bounds.y0 = y0;
 	render_texture *texture = font.get_char_texture_and_bounds(height, aspect, ch, bounds);
 
+	// nothing to draw for blank characters
+	if (!texture)
+		return;
+
 	// add it like a quad
 	item &newitem = add_generic(CONTAINER_ITEM_QUAD, bounds.x0, bounds.y0, bounds.x1, bounds.y1, argb);
 	newitem.m_texture = texture;
@@ -911,6 +1006,7 @@ template <typename T> render_target::render_target(render_manager &manager, T &&
 	, m_base_orientation(ROT0)
 	, m_maxtexwidth(65536)
 	, m_maxtexheight(65536)
+	, m_scale_queue(nullptr)
 	, m_transform_container(true)
 	, m_external_artwork(false)
 {
@@ -980,6 +1076,8 @@ template <typename T> render_target::render_target(render_manager &manager, T &&
 
 render_target::~render_target()
 {
+	if (m_scale_queue)
+		osd_work_queue_free(m_scale_queue);
 }
 
 
@@ -1380,6 +1478,8 @@ void render_target::compute_minimum_size(s32 &minwidth, s32 &minheight)
 
 render_primitive_list &render_target::get_primitives()
 {
+	auto trace = g_tracer.begin("render primitives");
+
 	// switch to the next primitive list
 	render_primitive_list &list = m_primlist[m_listindex];
 	m_listindex = (m_listindex + 1) % std::size(m_primlist);
@@ -1406,28 +1506,23 @@ render_primitive_list &render_target::get_primitives()
 	{
 		// we're running - iterate over items in the view
 		current_view().prepare_items();
-		for (layout_view_item &curitem : current_view().visible_items())
-		{
-			// first apply orientation to the bounds
-			render_bounds bounds = curitem.bounds();
-			apply_orientation(bounds, root_xform.orientation);
-			normalize_bounds(bounds);
+		auto const &items(current_view().visible_items());
+		if (m_element_geometry.size() < items.size())
+			m_element_geometry.resize(items.size());
+
+		// rasterise element textures that aren't cached yet
+		prescale_elements(list, root_xform);
 
-			// apply the transform to the item
-			object_transform item_xform;
-			item_xform.xoffs = root_xform.xoffs + bounds.x0 * root_xform.xscale;
-			item_xform.yoffs = root_xform.yoffs + bounds.y0 * root_xform.yscale;
-			item_xform.xscale = (bounds.x1 - bounds.x0) * root_xform.xscale;
-			item_xform.yscale = (bounds.y1 - bounds.y0) * root_xform.yscale;
-			item_xform.color = curitem.color() * root_xform.color;
-			item_xform.orientation = orientation_add(curitem.orientation(), root_xform.orientation);
-			item_xform.no_center = false;
+		for (size_t index = 0; items.size() > index; ++index)
+		{
+			layout_view_item &curitem(items[index]);
+			object_transform const item_xform(item_transform(root_xform, curitem));
 
 			// if there is no associated element, it must be a screen element
 			if (curitem.screen())
 				add_container_primitives(list, root_xform, item_xform, curitem.screen()->container(), curitem.blend_mode());
 			else
-				add_element_primitives(list, item_xform, curitem);
+				add_element_primitives(list, item_xform, curitem, m_element_geometry[index]);
 		}
 	}
 	else
@@ -2106,48 +2201,9 @@ void render_target::load_additional_layout_files(const char *basename, bool have
 
 bool render_target::load_layout_file(const char *dirname, const internal_layout &layout_data, device_t *device)
 {
-	// +1 to ensure data is terminated for XML parser
-	std::unique_ptr<u8 []> tempout(new (std::nothrow) u8 [layout_data.decompressed_size + 1]);
-	auto inflater(util::zlib_read(util::ram_read(layout_data.data, layout_data.compressed_size), 8192));
-	if (!tempout || !inflater)
-	{
-		osd_printf_error("render_target::load_layout_file: not enough memory to decompress layout\n");
+	util::xml::data_node const *const rootnode(m_manager.internal_layout_root(layout_data));
+	if (!rootnode)
 		return false;
-	}
-
-	size_t decompressed = 0;
-	do
-	{
-		size_t actual;
-		std::error_condition const err = inflater->read(
-				&tempout[decompressed],
-				layout_data.decompressed_size - decompressed,
-				actual);
-		decompressed += actual;
-		if (err)
-		{
-			osd_printf_error(
-					"render_target::load_layout_file: error decompressing layout (%s:%d %s)\n",
-					err.category().name(),
-					err.value(),
-					err.message());
-			return false;
-		}
-		if (!actual && (layout_data.decompressed_size < decompressed))
-		{
-			osd_printf_warning(
-					"render_target::load_layout_file: expected %u bytes of decompressed data but only got %u\n",
-					layout_data.decompressed_size,
-					decompressed);
-			break;
-		}
-	}
-	while (layout_data.decompressed_size > decompressed);
-	inflater.reset();
-
-	tempout[decompressed] = 0U;
-	util::xml::file::ptr rootnode(util::xml::file::string_read(reinterpret_cast<char const *>(tempout.get()), nullptr));
-	tempout.reset();
 
 	// if we didn't get a properly-formatted XML file, record a warning and exit
 	if (!load_layout_file(device ? *device : m_manager.machine().root_device(), *rootnode, m_manager.machine().options().art_path(), dirname))
@@ -2506,22 +2562,192 @@ void render_target::add_container_primitives(render_primitive_list &list, const
 
 
 //-------------------------------------------------
-//  add_element_primitives - add the primitive
-//  for an element in the current state
+//  item_transform - compute the transform for a
+//  view item
+//-------------------------------------------------
+
+render_target::object_transform render_target::item_transform(const object_transform &root_xform, layout_view_item &item)
+{
+	// first apply orientation to the bounds
+	render_bounds bounds = item.bounds();
+	apply_orientation(bounds, root_xform.orientation);
+	normalize_bounds(bounds);
+
+	// apply the transform to the item
+	object_transform item_xform;
+	item_xform.xoffs = root_xform.xoffs + bounds.x0 * root_xform.xscale;
+	item_xform.yoffs = root_xform.yoffs + bounds.y0 * root_xform.yscale;
+	item_xform.xscale = (bounds.x1 - bounds.x0) * root_xform.xscale;
+	item_xform.yscale = (bounds.y1 - bounds.y0) * root_xform.yscale;
+	item_xform.color = item.color() * root_xform.color;
+	item_xform.orientation = orientation_add(item.orientation(), root_xform.orientation);
+	item_xform.no_center = false;
+	return item_xform;
+}
+
+
+//-------------------------------------------------
+//  prescale_elements - rasterise element
+//  textures missing at their current sizes,
+//  spreading the work across threads
+//-------------------------------------------------
+
+void render_target::prescale_elements(render_primitive_list &list, const object_transform &root_xform)
+{
+	auto const &items(current_view().visible_items());
+	m_scale_jobs.clear();
+	for (size_t index = 0; items.size() > index; ++index)
+	{
+		layout_view_item &curitem(items[index]);
+		if (curitem.screen())
+			continue;
+
+		element_geometry &geometry(m_element_geometry[index]);
+		render_texture *const texture(update_element_geometry(item_transform(root_xform, curitem), curitem, geometry));
+		if (!texture || geometry.clipped)
+			continue;
+
+		// nothing to do if this size is already cached
+		bitmap_argb32 *const bitmap(texture->prepare_scaled(geometry.texwidth, geometry.texheight, list));
+		if (!bitmap)
+			continue;
+
+		// keep it from being thrown out before it's used
+		list.add_reference(bitmap);
+		layout_element &element(*curitem.element());
+		if (!element.thread_safe())
+		{
+			texture->scale(*bitmap);
+			continue;
+		}
+		m_scale_jobs.emplace_back(element_scale_job{ &element, texture, bitmap });
+
+		// elements with few states (e.g. lamps) are likely to be switched
+		// between them, so draw the other states at the new size as well
+		if (element.state_count() <= MAX_PREWARM_STATES)
+		{
+			for (int state = 0; element.state_count() > state; ++state)
+			{
+				render_texture *const other(element.state_texture(state));
+				bitmap_argb32 *const otherbitmap(other ? other->prepare_scaled(geometry.texwidth, geometry.texheight, list) : nullptr);
+				if (otherbitmap)
+				{
+					list.add_reference(otherbitmap);
+					m_scale_jobs.emplace_back(element_scale_job{ &element, other, otherbitmap });
+				}
+			}
+		}
+	}
+	if (m_scale_jobs.empty())
+		return;
+
+	// jobs for the same element have to be drawn in sequence
+	if ((m_scale_jobs.size() > 1) && !m_scale_queue && (std::thread::hardware_concurrency() > 1))
+		m_scale_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	std::stable_sort(
+			m_scale_jobs.begin(),
+			m_scale_jobs.end(),
+			[] (element_scale_job const &a, element_scale_job const &b) { return std::less<layout_element *>()(a.element, b.element); });
+	m_scale_batches.clear();
+	for (size_t first = 0, last; m_scale_jobs.size() > first; first = last)
+	{
+		for (last = first + 1; (m_scale_jobs.size() > last) && (m_scale_jobs[last].element == m_scale_jobs[first].element); ++last) { }
+		m_scale_batches.emplace_back(element_scale_batch{ &m_scale_jobs[first], last - first });
+	}
+
+	// queue them all and wait; the waiting thread helps with the work
+	if (m_scale_queue && (m_scale_batches.size() > 1))
+	{
+		osd_work_item_queue_multiple(m_scale_queue, prescale_callback, m_scale_batches.size(), &m_scale_batches[0], sizeof(m_scale_batches[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+		while (!osd_work_queue_wait(m_scale_queue, osd_ticks_per_second() * 10)) { }
+	}
+	else
+	{
+		for (element_scale_batch &batch : m_scale_batches)
+			prescale_callback(&batch, 0);
+	}
+}
+
+
+//-------------------------------------------------
+//  prescale_callback - draw a batch of element
+//  textures
+//-------------------------------------------------
+
+void *render_target::prescale_callback(void *param, int threadid)
+{
+	element_scale_batch const &batch(*reinterpret_cast<element_scale_batch const *>(param));
+	for (size_t i = 0; batch.count > i; ++i)
+		batch.jobs[i].texture->scale(*batch.jobs[i].bitmap);
+	return nullptr;
+}
+
+
+//-------------------------------------------------
+//  update_element_geometry - get the texture for
+//  an element in the current state, updating
+//  the retained geometry if needed
 //-------------------------------------------------
 
-void render_target::add_element_primitives(render_primitive_list &list, const object_transform &xform, layout_view_item &item)
+render_texture *render_target::update_element_geometry(const object_transform &xform, layout_view_item &item, element_geometry &geometry)
 {
 	layout_element &element(*item.element());
-	int const blendmode(item.blend_mode());
 
 	// limit state range to non-negative values
 	int const state((std::max)(item.element_state(), 0));
 
 	// get a pointer to the relevant texture
 	render_texture *texture = element.state_texture(state);
+	if (!texture)
+		return nullptr;
+
+	// the geometry only needs to be recomputed if something it depends on changed
+	bool const wrapx(item.scroll_wrap_x());
+	bool const wrapy(item.scroll_wrap_y());
+	float const scroll[4] = { item.scroll_size_x(), item.scroll_size_y(), item.scroll_pos_x(), item.scroll_pos_y() };
+	if ((geometry.item != &item) || (geometry.texture != texture) ||
+			(geometry.xoffs != xform.xoffs) || (geometry.yoffs != xform.yoffs) ||
+			(geometry.xscale != xform.xscale) || (geometry.yscale != xform.yscale) ||
+			(geometry.orientation != xform.orientation) ||
+			!std::equal(std::begin(scroll), std::end(scroll), std::begin(geometry.scroll)) ||
+			(geometry.wrapx != wrapx) || (geometry.wrapy != wrapy) || (geometry.width != m_width) || (geometry.height != m_height) ||
+			(geometry.maxwidth != m_maxtexwidth) || (geometry.maxheight != m_maxtexheight))
+	{
+		geometry.item = &item;
+		geometry.texture = texture;
+		geometry.xoffs = xform.xoffs;
+		geometry.yoffs = xform.yoffs;
+		geometry.xscale = xform.xscale;
+		geometry.yscale = xform.yscale;
+		geometry.orientation = xform.orientation;
+		std::copy(std::begin(scroll), std::end(scroll), std::begin(geometry.scroll));
+		geometry.wrapx = wrapx;
+		geometry.wrapy = wrapy;
+		geometry.width = m_width;
+		geometry.height = m_height;
+		geometry.maxwidth = m_maxtexwidth;
+		geometry.maxheight = m_maxtexheight;
+		compute_element_geometry(xform, item, geometry);
+	}
+	return texture;
+}
+
+
+//-------------------------------------------------
+//  add_element_primitives - add the primitive
+//  for an element in the current state
+//-------------------------------------------------
+
+void render_target::add_element_primitives(render_primitive_list &list, const object_transform &xform, layout_view_item &item, element_geometry &geometry)
+{
+	// get a pointer to the relevant texture
+	render_texture *texture = update_element_geometry(xform, item, geometry);
 	if (texture)
 	{
+		// nothing to draw if we're clipped out
+		if (geometry.clipped)
+			return;
+
 		render_primitive *prim = list.alloc(render_primitive::QUAD);
 
 		// configure the basics
@@ -2529,72 +2755,89 @@ void render_target::add_element_primitives(render_primitive_list &list, const ob
 		prim->flags =
 				PRIMFLAG_TEXORIENT(xform.orientation) |
 				PRIMFLAG_TEXFORMAT(texture->format()) |
-				PRIMFLAG_BLENDMODE(blendmode) |
-				PRIMFLAG_TEXWRAP((item.scroll_wrap_x() || item.scroll_wrap_y()) ? 1 : 0);
-
-		// compute the bounds
-		float const primwidth(render_round_nearest(xform.xscale));
-		float const primheight(render_round_nearest(xform.yscale));
-		prim->bounds.set_wh(render_round_nearest(xform.xoffs), render_round_nearest(xform.yoffs), primwidth, primheight);
-		prim->full_bounds = prim->bounds;
+				PRIMFLAG_BLENDMODE(item.blend_mode()) |
+				PRIMFLAG_TEXWRAP((geometry.wrapx || geometry.wrapy) ? 1 : 0);
+		prim->bounds = geometry.bounds;
+		prim->full_bounds = geometry.full_bounds;
+		prim->texcoords = geometry.texcoords;
 
 		// get the scaled texture and append it
-		float const xsize(item.scroll_size_x());
-		float const ysize(item.scroll_size_y());
-		s32 texwidth = render_round_nearest(((xform.orientation & ORIENTATION_SWAP_XY) ? primheight : primwidth) / xsize);
-		s32 texheight = render_round_nearest(((xform.orientation & ORIENTATION_SWAP_XY) ? primwidth : primheight) / ysize);
-		texwidth = (std::min)(texwidth, m_maxtexwidth);
-		texheight = (std::min)(texheight, m_maxtexheight);
-		texture->get_scaled(texwidth, texheight, prim->texture, list, prim->flags);
-
-		// compute the clip rect
-		render_bounds cliprect = prim->bounds & m_bounds;
-
-		// determine UV coordinates and apply clipping
-		float const xwindow((xform.orientation & ORIENTATION_SWAP_XY) ? primheight : primwidth);
-		float const ywindow((xform.orientation & ORIENTATION_SWAP_XY) ? primwidth : primheight);
-		float const xrange(float(texwidth) - (item.scroll_wrap_x() ? 0.0f : xwindow));
-		float const yrange(float(texheight) - (item.scroll_wrap_y() ? 0.0f : ywindow));
-		float const xoffset(render_round_nearest(item.scroll_pos_x() * xrange) / float(texwidth));
-		float const yoffset(render_round_nearest(item.scroll_pos_y() * yrange) / float(texheight));
-		float const xend(xoffset + (xwindow / float(texwidth)));
-		float const yend(yoffset + (ywindow / float(texheight)));
-		switch (xform.orientation)
-		{
-		default:
-		case 0:
-			prim->texcoords = render_quad_texuv{ { xoffset, yoffset }, { xend, yoffset }, { xoffset, yend }, { xend, yend } };
-			break;
-		case ORIENTATION_FLIP_X:
-			prim->texcoords = render_quad_texuv{ { xend, yoffset }, { xoffset, yoffset }, { xend, yend }, { xoffset, yend } };
-			break;
-		case ORIENTATION_FLIP_Y:
-			prim->texcoords = render_quad_texuv{ { xoffset, yend }, { xend, yend }, { xoffset, yoffset }, { xend, yoffset } };
-			break;
-		case ORIENTATION_FLIP_X | ORIENTATION_FLIP_Y:
-			prim->texcoords = render_quad_texuv{ { xend, yend }, { xoffset, yend }, { xend, yoffset }, { xoffset, yoffset } };
-			break;
-		case ORIENTATION_SWAP_XY:
-			prim->texcoords = render_quad_texuv{ { xoffset, yoffset }, { xoffset, yend }, { xend, yoffset }, { xend, yend } };
-			break;
-		case ORIENTATION_SWAP_XY | ORIENTATION_FLIP_X:
-			prim->texcoords = render_quad_texuv{ { xoffset, yend }, { xoffset, yoffset }, { xend, yend }, { xend, yoffset } };
-			break;
-		case ORIENTATION_SWAP_XY | ORIENTATION_FLIP_Y:
-			prim->texcoords = render_quad_texuv{ { xend, yoffset }, { xend, yend }, { xoffset, yoffset }, { xoffset, yend } };
-			break;
-		case ORIENTATION_SWAP_XY | ORIENTATION_FLIP_X | ORIENTATION_FLIP_Y:
-			prim->texcoords = render_quad_texuv{ { xend, yend }, { xend, yoffset }, { xoffset, yend }, { xoffset, yoffset } };
-			break;
-		}
-
-		// add to the list or free if we're clipped out
-		bool const clipped = render_clip_quad(prim->bounds, cliprect, &prim->texcoords);
-		list.append_or_return(*prim, clipped);
+		texture->get_scaled(geometry.texwidth, geometry.texheight, prim->texture, list, prim->flags);
+		list.append(*prim);
 	}
 }
 
 
+//-------------------------------------------------
+//  compute_element_geometry - compute the bounds
+//  and texture coordinates of an element
+//  primitive
+//-------------------------------------------------
+
+void render_target::compute_element_geometry(const object_transform &xform, layout_view_item &item, element_geometry &geometry)
+{
+	// compute the bounds
+	float const primwidth(render_round_nearest(xform.xscale));
+	float const primheight(render_round_nearest(xform.yscale));
+	geometry.bounds.set_wh(render_round_nearest(xform.xoffs), render_round_nearest(xform.yoffs), primwidth, primheight);
+	geometry.full_bounds = geometry.bounds;
+
+	// get the scaled texture size
+	float const xsize(item.scroll_size_x());
+	float const ysize(item.scroll_size_y());
+	s32 texwidth = render_round_nearest(((xform.orientation & ORIENTATION_SWAP_XY) ? primheight : primwidth) / xsize);
+	s32 texheight = render_round_nearest(((xform.orientation & ORIENTATION_SWAP_XY) ? primwidth : primheight) / ysize);
+	texwidth = (std::min)(texwidth, m_maxtexwidth);
+	texheight = (std::min)(texheight, m_maxtexheight);
+	geometry.texwidth = texwidth;
+	geometry.texheight = texheight;
+
+	// compute the clip rect
+	render_bounds cliprect = geometry.bounds & m_bounds;
+
+	// determine UV coordinates and apply clipping
+	float const xwindow((xform.orientation & ORIENTATION_SWAP_XY) ? primheight : primwidth);
+	float const ywindow((xform.orientation & ORIENTATION_SWAP_XY) ? primwidth : primheight);
+	float const xrange(float(texwidth) - (item.scroll_wrap_x() ? 0.0f : xwindow));
+	float const yrange(float(texheight) - (item.scroll_wrap_y() ? 0.0f : ywindow));
+	float const xoffset(render_round_nearest(item.scroll_pos_x() * xrange) / float(texwidth));
+	float const yoffset(render_round_nearest(item.scroll_pos_y() * yrange) / float(texheight));
+	float const xend(xoffset + (xwindow / float(texwidth)));
+	float const yend(yoffset + (ywindow / float(texheight)));
+	switch (xform.orientation)
+	{
+	default:
+	case 0:
+		geometry.texcoords = render_quad_texuv{ { xoffset, yoffset }, { xend, yoffset }, { xoffset, yend }, { xend, yend } };
+		break;
+	case ORIENTATION_FLIP_X:
+		geometry.texcoords = render_quad_texuv{ { xend, yoffset }, { xoffset, yoffset }, { xend, yend }, { xoffset, yend } };
+		break;
+	case ORIENTATION_FLIP_Y:
+		geometry.texcoords = render_quad_texuv{ { xoffset, yend }, { xend, yend }, { xoffset, yoffset }, { xend, yoffset } };
+		break;
+	case ORIENTATION_FLIP_X | ORIENTATION_FLIP_Y:
+		geometry.texcoords = render_quad_texuv{ { xend, yend }, { xoffset, yend }, { xend, yoffset }, { xoffset, yoffset } };
+		break;
+	case ORIENTATION_SWAP_XY:
+		geometry.texcoords = render_quad_texuv{ { xoffset, yoffset }, { xoffset, yend }, { xend, yoffset }, { xend, yend } };
+		break;
+	case ORIENTATION_SWAP_XY | ORIENTATION_FLIP_X:
+		geometry.texcoords = render_quad_texuv{ { xoffset, yend }, { xoffset, yoffset }, { xend, yend }, { xend, yoffset } };
+		break;
+	case ORIENTATION_SWAP_XY | ORIENTATION_FLIP_Y:
+		geometry.texcoords = render_quad_texuv{ { xend, yoffset }, { xend, yend }, { xoffset, yoffset }, { xoffset, yend } };
+		break;
+	case ORIENTATION_SWAP_XY | ORIENTATION_FLIP_X | ORIENTATION_FLIP_Y:
+		geometry.texcoords = render_quad_texuv{ { xend, yend }, { xend, yoffset }, { xoffset, yend }, { xoffset, yoffset } };
+		break;
+	}
+
+	// note if we're clipped out
+	geometry.clipped = render_clip_quad(geometry.bounds, cliprect, &geometry.texcoords);
+}
+
+
 //-------------------------------------------------
 //  map_point_internal - internal logic for
 //  mapping points
@@ -3332,6 +3575,68 @@ void render_manager::resolve_tags()
 }
 
 
+//-------------------------------------------------
+//  internal_layout_root - get the parsed XML for
+//  an internal layout, decompressing and parsing
+//  it the first time it's requested
+//-------------------------------------------------
+
+util::xml::data_node const *render_manager::internal_layout_root(const internal_layout &layout_data)
+{
+	// every target loads the same internal layouts, so only do the work once
+	auto const entry(m_internal_layouts.emplace(&layout_data, nullptr));
+	if (!entry.second)
+		return entry.first->second.get();
+
+	// +1 to ensure data is terminated for XML parser
+	std::unique_ptr<u8 []> tempout(new (std::nothrow) u8 [layout_data.decompressed_size + 1]);
+	auto inflater(util::zlib_read(util::ram_read(layout_data.data, layout_data.compressed_size), 8192));
+	if (!tempout || !inflater)
+	{
+		osd_printf_error("render_manager::internal_layout_root: not enough memory to decompress layout\n");
+		return nullptr;
+	}
+
+	size_t decompressed = 0;
+	do
+	{
+		size_t actual;
+		std::error_condition const err = inflater->read(
+				&tempout[decompressed],
+				layout_data.decompressed_size - decompressed,
+				actual);
+		decompressed += actual;
+		if (err)
+		{
+			osd_printf_error(
+					"render_manager::internal_layout_root: error decompressing layout (%s:%d %s)\n",
+					err.category().name(),
+					err.value(),
+					err.message());
+			return nullptr;
+		}
+		if (!actual && (layout_data.decompressed_size < decompressed))
+		{
+			osd_printf_warning(
+					"render_manager::internal_layout_root: expected %u bytes of decompressed data but only got %u\n",
+					layout_data.decompressed_size,
+					decompressed);
+			break;
+		}
+	}
+	while (layout_data.decompressed_size > decompressed);
+	inflater.reset();
+
+	tempout[decompressed] = 0U;
+	util::xml::file::ptr rootnode(util::xml::file::string_read(reinterpret_cast<char const *>(tempout.get()), nullptr));
+	tempout.reset();
+	if (!rootnode)
+		osd_printf_warning("render_manager::internal_layout_root: Improperly formatted XML string, ignoring\n");
+
+	return (entry.first->second = std::move(rootnode)).get();
+}
+
+
 //-------------------------------------------------
 //  config_load - read and apply data from the
 //  configuration file
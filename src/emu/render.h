@@ -52,10 +52,14 @@
 #include <list>
 #include <memory>
 #include <mutex>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 
+struct osd_work_queue;
+
+
 //**************************************************************************
 //  CONSTANTS
 //**************************************************************************
@@ -336,12 +340,6 @@ public:
 	static void hq_scale(bitmap_argb32 &dest, bitmap_argb32 &source, const rectangle &sbounds, void *param);
 
 private:
-	// internal helpers
-	void get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo, render_primitive_list &primlist, u32 flags = 0);
-	const rgb_t *get_adjusted_palette(render_container &container, u32 &out_length);
-
-	static constexpr int MAX_TEXTURE_SCALES = 100;
-
 	// a scaled_texture contains a single scaled entry for a texture
 	struct scaled_texture
 	{
@@ -349,6 +347,16 @@ private:
 		u32                             seqid;      // sequence number
 	};
 
+	// internal helpers
+	void get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo, render_primitive_list &primlist, u32 flags = 0);
+	bitmap_argb32 *prepare_scaled(u32 dwidth, u32 dheight, render_primitive_list &primlist);
+	void scale(bitmap_argb32 &dest);
+	scaled_texture *find_scaled(u32 dwidth, u32 dheight);
+	scaled_texture &alloc_scaled(u32 dwidth, u32 dheight, render_primitive_list &primlist);
+	const rgb_t *get_adjusted_palette(render_container &container, u32 &out_length);
+
+	static constexpr int MAX_TEXTURE_SCALES = 100;
+
 	// internal state
 	render_manager *    m_manager;                  // reference to our manager
 	render_texture *    m_next;                     // next texture (for free list)
@@ -564,6 +572,9 @@ private:
 
 	// private classes declared in render.cpp
 	struct object_transform;
+	struct element_geometry;
+	struct element_scale_job;
+	struct element_scale_batch;
 
 	// internal helpers
 	enum constructor_impl_t { CONSTRUCTOR_IMPL };
@@ -576,7 +587,12 @@ private:
 	bool load_layout_file(const char *dirname, const internal_layout &layout_data, device_t *device = nullptr);
 	bool load_layout_file(device_t &device, util::xml::data_node const &rootnode, const char *searchpath, const char *dirname);
 	void add_container_primitives(render_primitive_list &list, const object_transform &root_xform, const object_transform &xform, render_container &container, int blendmode);
-	void add_element_primitives(render_primitive_list &list, const object_transform &xform, layout_view_item &item);
+	static object_transform item_transform(const object_transform &root_xform, layout_view_item &item);
+	void prescale_elements(render_primitive_list &list, const object_transform &root_xform);
+	static void *prescale_callback(void *param, int threadid);
+	render_texture *update_element_geometry(const object_transform &xform, layout_view_item &item, element_geometry &geometry);
+	void add_element_primitives(render_primitive_list &list, const object_transform &xform, layout_view_item &item, element_geometry &geometry);
+	void compute_element_geometry(const object_transform &xform, layout_view_item &item, element_geometry &geometry);
 	std::pair<float, float> map_point_internal(s32 target_x, s32 target_y);
 
 	// config callbacks
@@ -596,6 +612,7 @@ private:
 	// constants
 	static constexpr int NUM_PRIMLISTS = 3;
 	static constexpr int MAX_CLEAR_EXTENTS = 1000;
+	static constexpr int MAX_PREWARM_STATES = 4;
 
 	// internal state
 	render_target *         m_next;                     // link to next target
@@ -626,6 +643,10 @@ private:
 	int                     m_maxtexheight;             // maximum height of a texture
 	s32                     m_clear_extent_count;       // number of clear extents
 	s32                     m_clear_extents[MAX_CLEAR_EXTENTS]; // array of clear extents
+	std::vector<element_geometry> m_element_geometry;   // element primitive geometry from the previous frame, per visible item
+	std::vector<element_scale_job> m_scale_jobs;        // element textures to rasterise this frame
+	std::vector<element_scale_batch> m_scale_batches;   // scale jobs grouped by element
+	osd_work_queue *        m_scale_queue;              // work queue for rasterising element textures
 	bool                    m_transform_container;      // determines whether the screen container is transformed by the core renderer,
 														// otherwise the respective render API will handle the transformation (scale, offset)
 	bool                    m_external_artwork;         // external artwork was loaded (driver file or override)
@@ -685,6 +706,9 @@ private:
 	void config_load(config_type cfg_type, config_level cfg_lvl, util::xml::data_node const *parentnode);
 	void config_save(config_type cfg_type, util::xml::data_node *parentnode);
 
+	// internal layouts
+	util::xml::data_node const *internal_layout_root(const internal_layout &layout_data);
+
 	// internal state
 	running_machine &               m_machine;          // reference back to the machine
 
@@ -700,6 +724,9 @@ private:
 	// containers for the UI and for screens
 	std::unique_ptr<render_container> m_ui_container;   // UI container
 	std::list<render_container>     m_screen_container_list; // list of containers for the screen
+
+	// internal layouts are decompressed and parsed once and shared by all targets
+	std::unordered_map<const internal_layout *, std::unique_ptr<util::xml::file> > m_internal_layouts;
 };
 
 #endif  // MAME_EMU_RENDER_H
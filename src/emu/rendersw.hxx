@@ -123,6 +123,30 @@ private:
 	}
 
 
+	//-------------------------------------------------
+	//  is_texel_run - true if a row of the quad maps
+	//  1:1 onto consecutive in-bounds source texels,
+	//  so the fast cases can step a source pointer
+	//  in a loop the compiler can vectorise
+	//-------------------------------------------------
+
+	static inline bool is_texel_run(const render_texinfo &texture, quad_setup_data const &setup, s32 curu, s32 curv)
+	{
+		if constexpr (BilinearFilter)
+		{
+			return false;
+		}
+		else
+		{
+			s32 const u = curu >> 16;
+			s32 const v = curv >> 16;
+			return (setup.dudx == 0x10000) && !setup.dvdx &&
+					(u >= 0) && ((u + setup.endx - setup.startx) <= s32(texture.width)) &&
+					(v >= 0) && (v < s32(texture.height));
+		}
+	}
+
+
 	//-------------------------------------------------
 	//  get_texel_palette16 - return a texel from a
 	//  palettized 16bpp source
@@ -678,13 +702,24 @@ private:
 				s32 curu = setup.startu + (y - setup.starty) * setup.dudy;
 				s32 curv = setup.startv + (y - setup.starty) * setup.dvdy;
 
-				// loop over cols
-				for (s32 x = setup.startx; x < setup.endx; x++)
+				if (is_texel_run(prim.texture, setup, curu, curv))
 				{
-					u32 const pix = get_texel_palette16(prim.texture, curu, curv);
-					*dest++ = source32_to_dest(pix);
-					curu += setup.dudx;
-					curv += setup.dvdx;
+					// unscaled row: step through the source directly
+					rgb_t const *const palbase = prim.texture.palette;
+					u16 const *src = reinterpret_cast<u16 const *>(prim.texture.base) + (curv >> 16) * prim.texture.rowpixels + (curu >> 16);
+					for (s32 x = setup.startx; x < setup.endx; x++)
+						*dest++ = source32_to_dest(palbase[*src++]);
+				}
+				else
+				{
+					// loop over cols
+					for (s32 x = setup.startx; x < setup.endx; x++)
+					{
+						u32 const pix = get_texel_palette16(prim.texture, curu, curv);
+						*dest++ = source32_to_dest(pix);
+						curu += setup.dudx;
+						curv += setup.dvdx;
+					}
 				}
 			}
 		}
@@ -1033,7 +1068,14 @@ private:
 				s32 curu = setup.startu + (y - setup.starty) * setup.dudy;
 				s32 curv = setup.startv + (y - setup.starty) * setup.dvdy;
 
-				if (!palbase)
+				if (!palbase && is_texel_run(prim.texture, setup, curu, curv))
+				{
+					// no lookup, unscaled row: step through the source directly
+					u32 const *src = reinterpret_cast<u32 const *>(prim.texture.base) + (curv >> 16) * prim.texture.rowpixels + (curu >> 16);
+					for (s32 x = setup.startx; x < setup.endx; x++)
+						*dest++ = source32_to_dest(*src++);
+				}
+				else if (!palbase)
 				{
 					// no lookup case
 
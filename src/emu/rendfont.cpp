@@ -776,9 +776,21 @@ void render_font::char_expand(char32_t chnum, glyph &gl)
 		}
 	}
 
-	// wrap a texture around the bitmap
-	gl.texture = m_manager.texture_alloc(render_texture::hq_scale);
-	gl.texture->set_bitmap(gl.bitmap, gl.bitmap.cliprect(), TEXFORMAT_ARGB32);
+	// blank glyphs (like spaces) don't get a texture, so no primitives are generated for them
+	for (int y = 0; gl.bitmap.height() > y; ++y)
+	{
+		u32 const *const src(&gl.bitmap.pix(y));
+		for (int x = 0; gl.bitmap.width() > x; ++x)
+		{
+			if (rgb_t(src[x]).a())
+			{
+				// wrap a texture around the bitmap
+				gl.texture = m_manager.texture_alloc(render_texture::hq_scale);
+				gl.texture->set_bitmap(gl.bitmap, gl.bitmap.cliprect(), TEXFORMAT_ARGB32);
+				return;
+			}
+		}
+	}
 }
 
 
@@ -1646,6 +1646,20 @@ render_texture *layout_element::state_texture(int state)
 }
 
 
+//-------------------------------------------------
+//  thread_safe - returns whether states of the
+//  element can be drawn on a worker thread
+//-------------------------------------------------
+
+bool layout_element::thread_safe() const
+{
+	return std::all_of(
+			m_complist.begin(),
+			m_complist.end(),
+			[] (component::ptr const &curcomp) { return curcomp->thread_safe(); });
+}
+
+
 //-------------------------------------------------
 //  preload - perform expensive loading upfront
 //  for all components
@@ -1694,6 +1708,12 @@ public:
 	}
 
 	// overrides
+	virtual bool thread_safe() const override
+	{
+		// loading the image isn't
+		return m_bitmap.valid() || m_svg;
+	}
+
 	virtual void preload(running_machine &machine) override
 	{
 		if (!m_bitmap.valid() && !m_svg)
@@ -2452,6 +2472,13 @@ public:
 		m_textalign = env.get_attribute_int(compnode, "align", 0);
 	}
 
+	// overrides
+	virtual bool thread_safe() const override
+	{
+		// fonts allocate render textures
+		return false;
+	}
+
 protected:
 	// overrides
 	virtual void draw_aligned(running_machine &machine, bitmap_argb32 &dest, const rectangle &bounds, int state) override
@@ -3034,6 +3061,13 @@ public:
 	{
 	}
 
+	// overrides
+	virtual bool thread_safe() const override
+	{
+		// fonts allocate render textures
+		return false;
+	}
+
 protected:
 	// overrides
 	virtual int maxstate() const override { return m_maxstate; }
@@ -3095,6 +3129,12 @@ public:
 	}
 
 	// overrides
+	virtual bool thread_safe() const override
+	{
+		// fonts allocate render textures
+		return false;
+	}
+
 	virtual void preload(running_machine &machine) override
 	{
 		for (int i = 0; i < m_numstops; i++)
@@ -3633,6 +3673,17 @@ render_color layout_element::component::color(int state) const
 }
 
 
+//-------------------------------------------------
+//  thread_safe - returns whether the component
+//  can be drawn on a worker thread
+//-------------------------------------------------
+
+bool layout_element::component::thread_safe() const
+{
+	return true;
+}
+
+
 //-------------------------------------------------
 //  preload - perform expensive operations upfront
 //-------------------------------------------------
@@ -79,6 +79,8 @@ public:
 	// getters
 	running_machine &machine() const { return m_machine; }
 	int default_state() const { return m_defstate; }
+	int state_count() const { return int(m_elemtex.size()); }
+	bool thread_safe() const;
 	render_texture *state_texture(int state);
 
 	// operations
@@ -112,6 +114,7 @@ private:
 		render_bounds overall_bounds() const;
 		render_bounds bounds(int state) const;
 		render_color color(int state) const;
+		virtual bool thread_safe() const;
 
 		// operations
 		virtual void preload(running_machine &machine);
@@ -20,9 +20,11 @@
 #include "ui/uimain.h"
 
 #include "corestr.h"
+#include "path.h"
 
 #include <algorithm>
 #include <cstdarg>
+#include <exception>
 #include <set>
 
 
@@ -35,6 +37,8 @@
 ***************************************************************************/
 
 #define TEMPBUFFER_MAX_SIZE     (1024 * 1024 * 1024)
+#define PREFETCH_MAX_SIZE       (256 * 1024 * 1024)
+#define MAP_MIN_SIZE            (4 * 1024 * 1024)
 
 /***************************************************************************
     HELPERS
@@ -643,13 +647,25 @@ void rom_load_manager::region_post_process(memory_region *region, bool invert)
 
 std::unique_ptr<emu_file> rom_load_manager::open_rom_file(std::initializer_list<std::reference_wrapper<const std::vector<std::string> > > searchpath, const rom_entry *romp, std::vector<std::string> &tried_file_names, bool from_list)
 {
-	std::error_condition filerr = std::errc::no_such_file_or_directory;
-	u32 const romsize = rom_file_size(romp);
-	tried_file_names.clear();
-
 	// update status display
 	display_loading_rom_message(ROM_GETNAME(romp), from_list);
 
+	std::unique_ptr<emu_file> result = find_rom_file(searchpath, romp, tried_file_names);
+
+	// update counters
+	m_romsloaded++;
+	m_romsloadedsize += rom_file_size(romp);
+
+	// return the result
+	return result;
+}
+
+
+std::unique_ptr<emu_file> rom_load_manager::find_rom_file(std::initializer_list<std::reference_wrapper<const std::vector<std::string> > > searchpath, const rom_entry *romp, std::vector<std::string> &tried_file_names)
+{
+	std::error_condition filerr = std::errc::no_such_file_or_directory;
+	tried_file_names.clear();
+
 	// extract CRC to use for searching
 	u32 crc = 0;
 	bool const has_crc = util::hash_collection(romp->hashdata()).crc(crc);
@@ -664,10 +680,6 @@ std::unique_ptr<emu_file> rom_load_manager::open_rom_file(std::initializer_list<
 			break;
 	}
 
-	// update counters
-	m_romsloaded++;
-	m_romsloadedsize += romsize;
-
 	// return the result
 	if (filerr)
 		return nullptr;
@@ -895,6 +907,165 @@ void rom_load_manager::copy_rom_data(const rom_entry *romp)
 }
 
 
+/*-------------------------------------------------
+    file_prefetcher - opens, decompresses and
+    hashes the files for a region on worker
+    threads, ahead of the entries that read them
+-------------------------------------------------*/
+
+class rom_load_manager::file_prefetcher
+{
+public:
+	file_prefetcher(rom_load_manager &manager, std::initializer_list<std::reference_wrapper<const std::vector<std::string> > > searchpath, u8 bios, const rom_entry *romp);
+	~file_prefetcher();
+
+	bool active() const { return m_queue != nullptr; }
+	std::unique_ptr<emu_file> take(const rom_entry *romp, std::vector<std::string> &tried_file_names);
+
+private:
+	struct job
+	{
+		file_prefetcher *           owner = nullptr;    // prefetcher that queued the job
+		const rom_entry *           romp = nullptr;     // file entry to open
+		u32                         length = 0;         // expected length of the file
+		std::vector<std::string>    tried;              // names tried while searching
+		std::unique_ptr<emu_file>   file;               // opened file, or nullptr if not found
+		std::exception_ptr          failure;            // exception thrown while opening
+		osd_work_item *             item = nullptr;     // work item, until it's been waited on
+
+		void wait();
+	};
+
+	bool relevant(const rom_entry *romp) const { return ROMENTRY_ISFILE(romp) && (!ROM_GETBIOSFLAGS(romp) || (ROM_GETBIOSFLAGS(romp) == m_bios)); }
+	void issue();
+	static void *work_callback(void *param, int threadid);
+
+	rom_load_manager &  m_manager;
+	std::initializer_list<std::reference_wrapper<const std::vector<std::string> > > m_searchpath;
+	u8                  m_bios;
+	const rom_entry *   m_next;         // next entry to consider for queueing
+	std::vector<job>    m_jobs;         // one per file, in order
+	std::size_t         m_issued;       // jobs queued so far
+	std::size_t         m_taken;        // jobs consumed so far
+	u64                 m_inflight;     // bytes queued but not yet consumed
+	osd_work_queue *    m_queue;        // queue, or nullptr if loading serially
+};
+
+
+rom_load_manager::file_prefetcher::file_prefetcher(rom_load_manager &manager, std::initializer_list<std::reference_wrapper<const std::vector<std::string> > > searchpath, u8 bios, const rom_entry *romp)
+	: m_manager(manager)
+	, m_searchpath(searchpath)
+	, m_bios(bios)
+	, m_next(romp)
+	, m_issued(0)
+	, m_taken(0)
+	, m_inflight(0)
+	, m_queue(nullptr)
+{
+	// nothing to overlap unless there are at least two files
+	std::size_t files = 0;
+	for (const rom_entry *scan = romp; !ROMENTRY_ISREGIONEND(scan); ++scan)
+	{
+		if (relevant(scan))
+			++files;
+	}
+	if (files < 2)
+		return;
+
+	m_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	if (!m_queue)
+		return;
+
+	m_jobs.resize(files);
+	issue();
+}
+
+
+rom_load_manager::file_prefetcher::~file_prefetcher()
+{
+	// files that were never consumed still need to be waited for
+	for (job &j : m_jobs)
+		j.wait();
+	if (m_queue)
+		osd_work_queue_free(m_queue);
+}
+
+
+std::unique_ptr<emu_file> rom_load_manager::file_prefetcher::take(const rom_entry *romp, std::vector<std::string> &tried_file_names)
+{
+	assert(m_jobs.size() > m_taken);
+	job &j = m_jobs[m_taken++];
+	assert(j.romp == romp);
+
+	// wait for this file, and keep the workers busy with the following ones
+	j.wait();
+	m_inflight -= j.length;
+	issue();
+
+	if (j.failure)
+		std::rethrow_exception(j.failure);
+	tried_file_names = std::move(j.tried);
+	return std::move(j.file);
+}
+
+
+void rom_load_manager::file_prefetcher::issue()
+{
+	// limit the amount of file data held in memory at once
+	while (m_jobs.size() > m_issued)
+	{
+		while (!relevant(m_next))
+			++m_next;
+		u32 const length = rom_file_size(m_next);
+		if ((m_issued != m_taken) && ((m_inflight + length) > PREFETCH_MAX_SIZE))
+			break;
+
+		job &j = m_jobs[m_issued++];
+		j.owner = this;
+		j.romp = m_next++;
+		j.length = length;
+		m_inflight += length;
+		j.item = osd_work_item_queue(m_queue, &file_prefetcher::work_callback, &j, 0);
+		if (!j.item)
+			work_callback(&j, 0);
+	}
+}
+
+
+void *rom_load_manager::file_prefetcher::work_callback(void *param, int threadid)
+{
+	job &j = *reinterpret_cast<job *>(param);
+	try
+	{
+		j.file = j.owner->m_manager.find_rom_file(j.owner->m_searchpath, j.romp, j.tried);
+		if (j.file)
+		{
+			// decompress and hash the data now so verifying it later is cheap
+			util::hash_collection const hashes(j.romp->hashdata());
+			if (!hashes.flag(util::hash_collection::FLAG_NO_DUMP))
+				j.file->hashes(hashes.hash_types());
+			j.file->seek(0, SEEK_SET);
+		}
+	}
+	catch (...)
+	{
+		j.failure = std::current_exception();
+	}
+	return nullptr;
+}
+
+
+void rom_load_manager::file_prefetcher::job::wait()
+{
+	if (item)
+	{
+		while (!osd_work_item_wait(item, osd_ticks_per_second())) { }
+		osd_work_item_release(item);
+		item = nullptr;
+	}
+}
+
+
 /*-------------------------------------------------
     process_rom_entries - process all ROM entries
     for a region
@@ -905,6 +1076,9 @@ void rom_load_manager::process_rom_entries(std::initializer_list<std::reference_
 	u32 lastflags = 0;
 	std::vector<std::string> tried_file_names;
 
+	// start opening the files in the background
+	file_prefetcher prefetcher(*this, searchpath, bios, romp);
+
 	// loop until we hit the end of this region
 	while (!ROMENTRY_ISREGIONEND(romp))
 	{
@@ -942,7 +1116,17 @@ void rom_load_manager::process_rom_entries(std::initializer_list<std::reference_
 			std::unique_ptr<emu_file> file;
 			if (!irrelevantbios)
 			{
-				file = open_rom_file(searchpath, romp, tried_file_names, from_list);
+				if (prefetcher.active())
+				{
+					display_loading_rom_message(ROM_GETNAME(romp), from_list);
+					file = prefetcher.take(romp, tried_file_names);
+					m_romsloaded++;
+					m_romsloadedsize += rom_file_size(romp);
+				}
+				else
+				{
+					file = open_rom_file(searchpath, romp, tried_file_names, from_list);
+				}
 				if (!file)
 					handle_missing_file(romp, tried_file_names, std::error_condition());
 			}
@@ -1001,6 +1185,153 @@ void rom_load_manager::process_rom_entries(std::initializer_list<std::reference_
 }
 
 
+/*-------------------------------------------------
+    map_rom_region - create a region backed by a
+    mapping of its ROM file if it's loaded whole
+    from an uncompressed file
+-------------------------------------------------*/
+
+bool rom_load_manager::map_rom_region(std::initializer_list<std::reference_wrapper<const std::vector<std::string> > > searchpath, const std::string &regiontag, const rom_entry *region, u8 width, endianness_t endian, u8 bios, bool from_list)
+{
+	if (!machine().options().map_roms())
+		return false;
+
+	// only large regions that need no post-processing qualify
+	u32 const regionlength = ROMREGION_GETLENGTH(region);
+	if ((regionlength < MAP_MIN_SIZE) || ROMREGION_ISINVERTED(region) || ((1 < width) && (ENDIANNESS_NATIVE != endian)))
+		return false;
+
+	// the region must be a single file loaded as-is, with nothing following it
+	const rom_entry *const romp = region + 1;
+	if (!ROMENTRY_ISFILE(romp) || !ROMENTRY_ISREGIONEND(romp + 1))
+		return false;
+	if (ROM_GETBIOSFLAGS(romp) && (ROM_GETBIOSFLAGS(romp) != bios))
+		return false;
+	if (ROM_GETOFFSET(romp) || (ROM_GETLENGTH(romp) != regionlength) || (ROM_GETBITWIDTH(romp) != 8) || ROM_GETBITSHIFT(romp) || ROM_GETSKIPCOUNT(romp))
+		return false;
+	if ((ROM_GETGROUPSIZE(romp) != 1) && ROM_ISREVERSED(romp))
+		return false;
+
+	// the file must not come from an archive, and anything unusual is left for the normal path to report
+	LOG("Mapping ROM file: %s\n", ROM_GETNAME(romp));
+	display_loading_rom_message(ROM_GETNAME(romp), from_list);
+	std::vector<std::string> tried_file_names;
+	std::unique_ptr<emu_file> file = find_rom_file(searchpath, romp, tried_file_names);
+	if (!file || file->archived() || (file->size() != regionlength))
+		return false;
+	m_region = machine().memory().region_map(regiontag, file->fullpath(), regionlength, width, endian);
+	if (!m_region)
+		return false;
+	LOG("Mapped %X bytes @ %p\n", m_region->bytes(), m_region->base());
+
+	m_romsloaded++;
+	m_romsloadedsize += regionlength;
+	verify_length_and_hash(file.get(), romp->name(), regionlength, util::hash_collection(romp->hashdata()));
+	return true;
+}
+
+
+/*-------------------------------------------------
+    rom_cache_key - identify the contents of a
+    region in the shared ROM cache, or return an
+    empty string if it can't be cached
+-------------------------------------------------*/
+
+std::string rom_load_manager::rom_cache_key(const rom_entry *region, u8 width, endianness_t endian, u8 bios) const
+{
+	if (!*machine().options().rom_cache_directory())
+		return std::string();
+
+	// only large regions that need no post-processing qualify
+	u32 const regionlength = ROMREGION_GETLENGTH(region);
+	if ((regionlength < MAP_MIN_SIZE) || ROMREGION_ISINVERTED(region) || ((1 < width) && (ENDIANNESS_NATIVE != endian)))
+		return std::string();
+
+	// the contents follow from the layout of the region and the hashes of its files
+	util::sha1_creator key;
+	u32 const header[] = { regionlength, ROMREGION_GETFLAGS(region), bios };
+	key.append(header, sizeof(header));
+	for (const rom_entry *romp = region + 1; !ROMENTRY_ISREGIONEND(romp); romp++)
+	{
+		// copies depend on the contents of other regions
+		if (ROMENTRY_ISCOPY(romp))
+			return std::string();
+
+		// files must have a SHA-1 to identify them
+		if (ROMENTRY_ISFILE(romp))
+		{
+			util::hash_collection const hashes(romp->hashdata());
+			util::sha1_t sha1;
+			if (!hashes.sha1(sha1) || hashes.flag(util::hash_collection::FLAG_NO_DUMP))
+				return std::string();
+		}
+
+		u32 const entry[] = { ROM_GETOFFSET(romp), ROM_GETLENGTH(romp), ROM_GETFLAGS(romp) };
+		key.append(entry, sizeof(entry));
+		key.append(romp->hashdata().c_str(), romp->hashdata().length() + 1);
+	}
+	return key.finish().as_string();
+}
+
+
+/*-------------------------------------------------
+    map_cached_region - create a region backed by
+    a mapping of a file in the shared ROM cache
+-------------------------------------------------*/
+
+bool rom_load_manager::map_cached_region(const std::string &key, const std::string &regiontag, const rom_entry *region, u8 width, endianness_t endian, u8 bios)
+{
+	std::string const path = util::path_concat(machine().options().rom_cache_directory(), key + ".bin");
+	m_region = machine().memory().region_map(regiontag, path, ROMREGION_GETLENGTH(region), width, endian);
+	if (!m_region)
+		return false;
+	LOG("Mapped cached region %s: %X bytes @ %p\n", path, m_region->bytes(), m_region->base());
+
+	// account for the files that would have been loaded
+	for (const rom_entry *romp = region + 1; !ROMENTRY_ISREGIONEND(romp); romp++)
+	{
+		if (ROMENTRY_ISFILE(romp) && (!ROM_GETBIOSFLAGS(romp) || (ROM_GETBIOSFLAGS(romp) == bios)))
+		{
+			m_romsloaded++;
+			m_romsloadedsize += rom_file_size(romp);
+		}
+	}
+	return true;
+}
+
+
+/*-------------------------------------------------
+    store_cached_region - add the loaded contents
+    of the current region to the shared ROM cache
+-------------------------------------------------*/
+
+void rom_load_manager::store_cached_region(const std::string &key)
+{
+	// write to a name of our own and rename it, so other instances never see a partial file
+	std::string const path = util::path_concat(machine().options().rom_cache_directory(), key + ".bin");
+	std::string const temp = util::string_format("%s.%d", path, osd_getpid());
+	osd_file::ptr file;
+	std::uint64_t filesize;
+	std::error_condition err = osd_file::open(temp, OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS, file, filesize);
+	if (!err)
+	{
+		u32 actual = 0;
+		err = file->write(m_region->base(), 0, m_region->bytes(), actual);
+		file.reset();
+		if (!err && (actual != m_region->bytes()))
+			err = std::errc::no_space_on_device;
+		if (!err)
+			err = osd_file::rename(temp, path);
+		if (err)
+			osd_file::remove(temp);
+	}
+	if (err)
+		LOG("Error adding region to ROM cache %s: %s\n", path, err.message());
+	else
+		LOG("Added region to ROM cache %s\n", path);
+}
+
+
 /*-------------------------------------------------
     open_disk_diff - open a DISK diff file
 -------------------------------------------------*/
@@ -1118,6 +1449,11 @@ void rom_load_manager::process_disk_entries(std::initializer_list<std::reference
 				}
 			}
 
+			/* cache decompressed hunks if requested */
+			const int cache_hunks = machine().options().chd_cache();
+			if (cache_hunks > 0)
+				chd->chd().set_hunk_cache(cache_hunks, cache_hunks / 4);
+
 			/* we're okay, add to the list of disks */
 			LOG("Assigning to handle %d\n", DISK_GETINDEX(romp));
 			m_chd_list.push_back(std::move(chd));
@@ -1368,24 +1704,38 @@ void rom_load_manager::process_region_list()
 				endianness_t endianness = ROMREGION_ISBIGENDIAN(region) ? ENDIANNESS_BIG : ENDIANNESS_LITTLE;
 				normalize_flags_for_device(regiontag, width, endianness);
 
-				// remember the base and length
-				m_region = machine().memory().region_alloc(regiontag, regionlength, width, endianness);
-				LOG("Allocated %X bytes @ %p\n", m_region->bytes(), m_region->base());
+				if (searchpath.empty())
+					searchpath = device.searchpath();
+				assert(!searchpath.empty());
 
-				if (ROMREGION_ISERASE(region)) // clear the region if it's requested
-					memset(m_region->base(), ROMREGION_GETERASEVAL(region), m_region->bytes());
-				else if (m_region->bytes() <= 0x400000) // or if it's sufficiently small (<= 4MB)
-					memset(m_region->base(), 0, m_region->bytes());
+				// regions loaded whole from a loose file can share the file's pages, and other
+				// large regions can be shared between instances through the ROM cache
+				std::string const cachekey = rom_cache_key(region, width, endianness, device.system_bios());
+				if (!map_rom_region({ searchpath }, regiontag, region, width, endianness, device.system_bios(), false) &&
+						(cachekey.empty() || !map_cached_region(cachekey, regiontag, region, width, endianness, device.system_bios())))
+				{
+					// remember the base and length
+					m_region = machine().memory().region_alloc(regiontag, regionlength, width, endianness);
+					LOG("Allocated %X bytes @ %p\n", m_region->bytes(), m_region->base());
+
+					if (ROMREGION_ISERASE(region)) // clear the region if it's requested
+						memset(m_region->base(), ROMREGION_GETERASEVAL(region), m_region->bytes());
+					else if (m_region->bytes() <= 0x400000) // or if it's sufficiently small (<= 4MB)
+						memset(m_region->base(), 0, m_region->bytes());
 #ifdef MAME_DEBUG
-				else // if we're debugging, fill region with random data to catch errors
-					fill_random(m_region->base(), m_region->bytes());
+					else // if we're debugging, fill region with random data to catch errors
+						fill_random(m_region->base(), m_region->bytes());
 #endif
 
-				// now process the entries in the region
-				if (searchpath.empty())
-					searchpath = device.searchpath();
-				assert(!searchpath.empty());
-				process_rom_entries({ searchpath }, device.system_bios(), region, region + 1, false);
+					// now process the entries in the region
+					int const errors = m_errors;
+					int const warnings = m_warnings;
+					process_rom_entries({ searchpath }, device.system_bios(), region, region + 1, false);
+
+					// only share the contents if every file was present and correct
+					if (!cachekey.empty() && (m_errors == errors) && (m_warnings == warnings))
+						store_cached_region(cachekey);
+				}
 			}
 			else if (ROMREGION_ISDISKDATA(region))
 			{
@@ -399,6 +399,8 @@ class rom_load_manager
 		chd_file            m_diffchd;              /* handle to the diff CHD */
 	};
 
+	class file_prefetcher;
+
 public:
 	// construction/destruction
 	rom_load_manager(running_machine &machine);
@@ -443,10 +445,15 @@ private:
 	void region_post_process(memory_region *region, bool invert);
 	std::unique_ptr<emu_file> open_rom_file(std::initializer_list<std::reference_wrapper<const std::vector<std::string> > > searchpath, const rom_entry *romp, std::vector<std::string> &tried_file_names, bool from_list);
 	std::unique_ptr<emu_file> open_rom_file(const std::vector<std::string> &paths, std::vector<std::string> &tried, bool has_crc, u32 crc, std::string_view name, std::error_condition &filerr);
+	std::unique_ptr<emu_file> find_rom_file(std::initializer_list<std::reference_wrapper<const std::vector<std::string> > > searchpath, const rom_entry *romp, std::vector<std::string> &tried_file_names);
 	int rom_fread(emu_file *file, u8 *buffer, int length, const rom_entry *parent_region);
 	int read_rom_data(emu_file *file, const rom_entry *parent_region, const rom_entry *romp);
 	void fill_rom_data(const rom_entry *romp);
 	void copy_rom_data(const rom_entry *romp);
+	bool map_rom_region(std::initializer_list<std::reference_wrapper<const std::vector<std::string> > > searchpath, const std::string &regiontag, const rom_entry *region, u8 width, endianness_t endian, u8 bios, bool from_list);
+	std::string rom_cache_key(const rom_entry *region, u8 width, endianness_t endian, u8 bios) const;
+	bool map_cached_region(const std::string &key, const std::string &regiontag, const rom_entry *region, u8 width, endianness_t endian, u8 bios);
+	void store_cached_region(const std::string &key);
 	void process_rom_entries(std::initializer_list<std::reference_wrapper<const std::vector<std::string> > > searchpath, u8 bios, const rom_entry *parent_region, const rom_entry *romp, bool from_list);
 	std::error_condition open_disk_diff(emu_options &options, const rom_entry *romp, chd_file &source, chd_file &diff_chd);
 	void process_disk_entries(std::initializer_list<std::reference_wrapper<const std::vector<std::string> > > searchpath, std::string_view regiontag, const rom_entry *romp, std::function<const rom_entry * ()> next_parent);
@@ -31,6 +31,8 @@
 #include "util/ioprocs.h"
 #include "util/ioprocsfilter.h"
 
+#include <unordered_map>
+
 
 //**************************************************************************
 //  DEBUGGING
@@ -67,8 +69,11 @@ enum
 
 save_manager::save_manager(running_machine &machine)
 	: m_machine(machine)
+	, m_ramstate_bytes(0)
 	, m_reg_allowed(true)
 	, m_illegal_regs(0)
+	, m_hash_interval(0)
+	, m_hash_frames(0)
 {
 	m_rewind = std::make_unique<rewinder>(*this);
 }
@@ -87,14 +92,14 @@ void save_manager::allow_registration(bool allowed)
 	{
 		// look for duplicates
 		std::sort(m_entry_list.begin(), m_entry_list.end(),
-				[] (std::unique_ptr<state_entry> const& a, std::unique_ptr<state_entry> const& b) { return a->m_name < b->m_name; });
+				[] (state_entry const &a, state_entry const &b) { return a.m_name < b.m_name; });
 
 		int dupes_found = 0;
 		for (int i = 1; i < m_entry_list.size(); i++)
 		{
-			if (m_entry_list[i - 1]->m_name == m_entry_list[i]->m_name)
+			if (m_entry_list[i - 1].m_name == m_entry_list[i].m_name)
 			{
-				osd_printf_error("Duplicate save state registration entry (%s)\n", m_entry_list[i]->m_name);
+				osd_printf_error("Duplicate save state registration entry (%s)\n", m_entry_list[i].m_name);
 				dupes_found++;
 			}
 		}
@@ -106,6 +111,12 @@ void save_manager::allow_registration(bool allowed)
 
 		// everything is registered by now, evaluate the savestate size
 		m_rewind->clamp_capacity();
+
+		// log state hashes periodically if requested
+		int const interval = machine().options().state_hash();
+		if ((0 < interval) && !m_hash_interval)
+			machine().add_notifier(MACHINE_NOTIFY_FRAME, machine_notify_delegate(&save_manager::frame_update, this));
+		m_hash_interval = (std::max)(interval, 0);
 	}
 }
 
@@ -120,7 +131,7 @@ const char *save_manager::indexed_item(int index, void *&base, u32 &valsize, u32
 	if (index >= m_entry_list.size() || index < 0)
 		return nullptr;
 
-	state_entry *entry = m_entry_list.at(index).get();
+	state_entry const *entry = &m_entry_list.at(index);
 	base = entry->m_data;
 	valsize = entry->m_typesize;
 	valcount = entry->m_typecount;
@@ -201,7 +212,7 @@ void save_manager::save_memory(device_t *device, const char *module, const char
 		totalname = string_format("%s/%X/%s", module, index, name);
 
 	// insert us into the list
-	m_entry_list.emplace_back(std::make_unique<state_entry>(val, std::move(totalname), device, module, tag ? tag : "", index, valsize, valcount, blockcount, stride));
+	m_entry_list.emplace_back(val, std::move(totalname), device, module, tag ? tag : "", index, valsize, valcount, blockcount, stride);
 }
 
 
@@ -401,6 +412,163 @@ save_error save_manager::read_buffer(const void *buf, size_t size)
 }
 
 
+//-------------------------------------------------
+//  write_snapshot - write the current machine
+//  state to a buffer, reusing its allocation
+//-------------------------------------------------
+
+save_error save_manager::write_snapshot(std::vector<u8> &buf)
+{
+	buf.resize(ram_state::get_size(*this));
+	return write_buffer(buf.data(), buf.size());
+}
+
+
+//-------------------------------------------------
+//  write_snapshot_file - write a snapshot to a
+//  file in the usual format; this only touches
+//  the snapshot and the file, so it can be used
+//  from a worker thread
+//-------------------------------------------------
+
+save_error save_manager::write_snapshot_file(util::core_file &file, const std::vector<u8> &buf)
+{
+	if (buf.size() < HEADER_SIZE)
+		return STATERR_WRITE_ERROR;
+
+	// the header is stored uncompressed, and the rest of the file is compressed
+	size_t written;
+	if (file.seek(0, SEEK_SET) || file.write(buf.data(), HEADER_SIZE, written) || (HEADER_SIZE != written))
+		return STATERR_WRITE_ERROR;
+
+	util::write_stream::ptr writer = util::zlib_write(file, 6, 16384);
+	if (!writer)
+		return STATERR_WRITE_ERROR;
+	const size_t datasize = buf.size() - HEADER_SIZE;
+	if (writer->write(&buf[HEADER_SIZE], datasize, written) || (datasize != written))
+		return STATERR_WRITE_ERROR;
+	return writer->finalize() ? STATERR_WRITE_ERROR : STATERR_NONE;
+}
+
+
+//-------------------------------------------------
+//  state_hash - hash the current machine state,
+//  or just the entries belonging to one device
+//-------------------------------------------------
+
+u64 save_manager::state_hash(const device_t *device)
+{
+	// bring the state up to date, as for saving
+	dispatch_presave();
+
+	util::xxh64_creator hash;
+	for (const auto &entry : m_entry_list)
+	{
+		if (!device || (entry.m_device == device))
+			hash_entry(entry, hash);
+	}
+	return hash.finish();
+}
+
+
+//-------------------------------------------------
+//  device_state_hashes - hash the state of every
+//  device in one pass; entries not belonging to
+//  a device are reported against nullptr
+//-------------------------------------------------
+
+void save_manager::device_state_hashes(std::vector<std::pair<device_t *, u64> > &hashes)
+{
+	dispatch_presave();
+
+	// entries are sorted by name, so group them by device first
+	std::vector<const state_entry *> sorted;
+	sorted.reserve(m_entry_list.size());
+	for (const auto &entry : m_entry_list)
+		sorted.emplace_back(&entry);
+	std::stable_sort(sorted.begin(), sorted.end(),
+			[] (const state_entry *a, const state_entry *b) { return std::less<device_t *>()(a->m_device, b->m_device); });
+
+	hashes.clear();
+	util::xxh64_creator hash;
+	for (auto it = sorted.begin(); sorted.end() != it; )
+	{
+		device_t *const device = (*it)->m_device;
+		hash.reset();
+		for ( ; (sorted.end() != it) && ((*it)->m_device == device); ++it)
+			hash_entry(**it, hash);
+		hashes.emplace_back(device, hash.finish());
+	}
+}
+
+
+//-------------------------------------------------
+//  device_state_sizes - total bytes registered
+//  by each device; entries not belonging to a
+//  device are reported against nullptr
+//-------------------------------------------------
+
+void save_manager::device_state_sizes(std::vector<std::pair<device_t *, u64> > &sizes) const
+{
+	std::unordered_map<device_t *, u64> totals;
+	for (const auto &entry : m_entry_list)
+		totals[entry.m_device] += u64(entry.m_typesize) * entry.m_typecount * entry.m_blockcount;
+
+	sizes.assign(totals.begin(), totals.end());
+}
+
+
+//-------------------------------------------------
+//  hash_entry - append the data for a state entry
+//  to a hash, in little-endian order
+//-------------------------------------------------
+
+void save_manager::hash_entry(const state_entry &entry, util::xxh64_creator &hash)
+{
+	const u32 blocksize = entry.m_typesize * entry.m_typecount;
+	const u8 *data = reinterpret_cast<const u8 *>(entry.m_data);
+	if (NATIVE_ENDIAN_VALUE_LE_BE(true, false) || (1 == entry.m_typesize))
+	{
+		for (u32 b = 0; entry.m_blockcount > b; ++b, data += entry.m_stride)
+			hash.append(data, blocksize);
+	}
+	else
+	{
+		// swap through a small buffer - its size is a multiple of every type size
+		u8 buffer[256];
+		const u32 typesize = entry.m_typesize;
+		for (u32 b = 0; entry.m_blockcount > b; ++b, data += entry.m_stride)
+		{
+			for (u32 offs = 0; blocksize > offs; )
+			{
+				const u32 chunk = (std::min<u32>)(blocksize - offs, sizeof(buffer));
+				for (u32 i = 0; chunk > i; i += typesize)
+				{
+					for (u32 j = 0; typesize > j; ++j)
+						buffer[i + j] = data[offs + i + typesize - 1 - j];
+				}
+				hash.append(buffer, chunk);
+				offs += chunk;
+			}
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  frame_update - log the state hash every so
+//  many frames if requested
+//-------------------------------------------------
+
+void save_manager::frame_update()
+{
+	if (!m_hash_interval || (++m_hash_frames % m_hash_interval))
+		return;
+
+	osd_printf_info("Frame %u: state hash %016X\n", m_hash_frames, state_hash());
+}
+
+
 //-------------------------------------------------
 //  do_write - serialisation logic
 //-------------------------------------------------
@@ -415,7 +583,7 @@ inline save_error save_manager::do_write(T check_space, U write_block, V start_h
 	// check for sufficient space
 	size_t total_size = HEADER_SIZE;
 	for (const auto &entry : m_entry_list)
-		total_size += entry->m_typesize * entry->m_typecount * entry->m_blockcount;
+		total_size += entry.m_typesize * entry.m_typecount * entry.m_blockcount;
 	if (!check_space(total_size))
 		return STATERR_WRITE_ERROR;
 
@@ -438,9 +606,9 @@ inline save_error save_manager::do_write(T check_space, U write_block, V start_h
 	// then write all the data
 	for (auto &entry : m_entry_list)
 	{
-		const u32 blocksize = entry->m_typesize * entry->m_typecount;
-		const u8 *data = reinterpret_cast<const u8 *>(entry->m_data);
-		for (u32 b = 0; entry->m_blockcount > b; ++b, data += entry->m_stride)
+		const u32 blocksize = entry.m_typesize * entry.m_typecount;
+		const u8 *data = reinterpret_cast<const u8 *>(entry.m_data);
+		for (u32 b = 0; entry.m_blockcount > b; ++b, data += entry.m_stride)
 			if (!write_block(data, blocksize))
 				return STATERR_WRITE_ERROR;
 	}
@@ -462,7 +630,7 @@ inline save_error save_manager::do_read(T check_length, U read_block, V start_he
 	// check for sufficient space
 	size_t total_size = HEADER_SIZE;
 	for (const auto &entry : m_entry_list)
-		total_size += entry->m_typesize * entry->m_typecount * entry->m_blockcount;
+		total_size += entry.m_typesize * entry.m_typecount * entry.m_blockcount;
 	if (!check_length(total_size))
 		return STATERR_READ_ERROR;
 
@@ -482,15 +650,15 @@ inline save_error save_manager::do_read(T check_length, U read_block, V start_he
 	// read all the data, flipping if necessary
 	for (auto &entry : m_entry_list)
 	{
-		const u32 blocksize = entry->m_typesize * entry->m_typecount;
-		u8 *data = reinterpret_cast<u8 *>(entry->m_data);
-		for (u32 b = 0; entry->m_blockcount > b; ++b, data += entry->m_stride)
+		const u32 blocksize = entry.m_typesize * entry.m_typecount;
+		u8 *data = reinterpret_cast<u8 *>(entry.m_data);
+		for (u32 b = 0; entry.m_blockcount > b; ++b, data += entry.m_stride)
 			if (!read_block(data, blocksize))
 				return STATERR_READ_ERROR;
 
 		// handle flipping
 		if (flip)
-			entry->flip_data();
+			entry.flip_data();
 	}
 
 	// call the post-load functions
@@ -512,14 +680,14 @@ u32 save_manager::signature() const
 	for (auto &entry : m_entry_list)
 	{
 		// add the entry name to the CRC
-		crc = core_crc32(crc, (u8 *)entry->m_name.c_str(), entry->m_name.length());
+		crc = core_crc32(crc, (u8 *)entry.m_name.c_str(), entry.m_name.length());
 
 		// add the type and size to the CRC
 		u32 temp[4];
-		temp[0] = little_endianize_int32(entry->m_typesize);
-		temp[1] = little_endianize_int32(entry->m_typecount);
-		temp[2] = little_endianize_int32(entry->m_blockcount);
-		temp[3] = little_endianize_int32(entry->m_stride);
+		temp[0] = little_endianize_int32(entry.m_typesize);
+		temp[1] = little_endianize_int32(entry.m_typecount);
+		temp[2] = little_endianize_int32(entry.m_blockcount);
+		temp[3] = little_endianize_int32(entry.m_stride);
 		crc = core_crc32(crc, (u8 *)&temp[0], sizeof(temp));
 	}
 	return crc;
@@ -534,7 +702,7 @@ u32 save_manager::signature() const
 void save_manager::dump_registry() const
 {
 	for (auto &entry : m_entry_list)
-		LOG(("%s: %u x %u x %u (%u)\n", entry->m_name.c_str(), entry->m_typesize, entry->m_typecount, entry->m_blockcount, entry->m_stride));
+		LOG(("%s: %u x %u x %u (%u)\n", entry.m_name.c_str(), entry.m_typesize, entry.m_typecount, entry.m_blockcount, entry.m_stride));
 }
 
 
@@ -596,20 +764,19 @@ save_manager::state_callback::state_callback(save_prepost_delegate callback)
 
 
 //-------------------------------------------------
-//  ram_state - constructor
+//  ram_state - constructor; pages are counted
+//  against the supplied total if there is one, or
+//  against the save manager otherwise
 //-------------------------------------------------
 
-ram_state::ram_state(save_manager &save)
+ram_state::ram_state(save_manager &save, size_t *bytes)
 	: m_save(save)
-	, m_data()
+	, m_bytes(bytes ? *bytes : save.m_ramstate_bytes)
+	, m_size(get_size(save))
 	, m_valid(false)
 	, m_time(m_save.machine().time())
 {
-	m_data.reserve(get_size(save));
-	m_data.clear();
-	m_data.rdbuf()->clear();
-	m_data.seekp(0);
-	m_data.seekg(0);
+	m_pages.resize((m_size + PAGE_SIZE - 1) / PAGE_SIZE);
 }
 
 
@@ -623,27 +790,236 @@ size_t ram_state::get_size(save_manager &save)
 	size_t totalsize = 0;
 
 	for (auto &entry : save.m_entry_list)
-		totalsize += entry->m_typesize * entry->m_typecount * entry->m_blockcount;
+		totalsize += entry.m_typesize * entry.m_typecount * entry.m_blockcount;
 
 	return totalsize + HEADER_SIZE;
 }
 
 
+//-------------------------------------------------
+//  page::assign - encode data as a delta
+//  against the previous contents
+//-------------------------------------------------
+
+void ram_state::page::assign(std::shared_ptr<const page> &&base, const u8 *data, const u8 *prev, size_t length)
+{
+	// XOR deltas against the previous contents are mostly zero, so they're
+	// stored as runs of zero bytes followed by runs of literal bytes; short
+	// runs of zeroes are kept in the literals, so this never grows the data
+	// by more than one run header
+	const auto delta = [data, prev] (size_t i) -> u8 { return prev ? (data[i] ^ prev[i]) : data[i]; };
+	u8 encoded[PAGE_SIZE + 4];
+	size_t out = 0;
+	for (size_t i = 0; length > i; )
+	{
+		size_t lit = i;
+		while ((length > lit) && !delta(lit))
+			++lit;
+		size_t end = lit;
+		while (length > end)
+		{
+			if (delta(end))
+			{
+				++end;
+			}
+			else
+			{
+				size_t zeroes = end;
+				while ((length > zeroes) && !delta(zeroes))
+					++zeroes;
+				if (((zeroes - end) >= 4) || (length == zeroes))
+					break;
+				end = zeroes;
+			}
+		}
+		if (end == lit)
+			break;
+
+		encoded[out++] = u8(lit - i);
+		encoded[out++] = u8((lit - i) >> 8);
+		encoded[out++] = u8(end - lit);
+		encoded[out++] = u8((end - lit) >> 8);
+		for (size_t j = lit; end > j; ++j)
+			encoded[out++] = delta(j);
+		i = end;
+	}
+
+	m_bytes -= m_data.capacity();
+	m_data.assign(&encoded[0], &encoded[out]);
+	m_bytes += m_data.capacity();
+	m_depth = base ? (base->m_depth + 1) : 0;
+	m_base = std::move(base);
+}
+
+
+//-------------------------------------------------
+//  page::apply - XOR the page contents into the
+//  destination, starting from the key page
+//-------------------------------------------------
+
+void ram_state::page::apply(u8 *dest) const
+{
+	if (m_base)
+		m_base->apply(dest);
+
+	const u8 *src = m_data.data();
+	const u8 *const end = src + m_data.size();
+	while (end > src)
+	{
+		dest += src[0] | (src[1] << 8);
+		const u16 count = src[2] | (src[3] << 8);
+		src += 4;
+		for (u16 i = 0; count > i; ++i)
+			*dest++ ^= *src++;
+	}
+}
+
+
+//-------------------------------------------------
+//  page::flatten - store the full contents rather
+//  than a delta, releasing the base; anything
+//  using this page as a base is unaffected, as
+//  the contents don't change
+//-------------------------------------------------
+
+void ram_state::page::flatten(size_t length)
+{
+	if (!m_base)
+		return;
+
+	u8 contents[PAGE_SIZE];
+	memset(contents, 0, length);
+	apply(contents);
+	assign(nullptr, contents, nullptr, length);
+}
+
+
+//-------------------------------------------------
+//  commit_page - store a page of state data,
+//  sharing the page of the reference state if
+//  the contents are unchanged
+//-------------------------------------------------
+
+void ram_state::commit_page(size_t index, const u8 *data, size_t length, const ram_state *reference, u8 *shadow)
+{
+	// the shadow holds the decoded contents of the reference state
+	u8 *const prev = shadow ? &shadow[index * PAGE_SIZE] : nullptr;
+	const std::shared_ptr<page> *const refpage = (reference && shadow && reference->m_pages[index]) ? &reference->m_pages[index] : nullptr;
+	if (refpage && !memcmp(prev, data, length))
+	{
+		m_pages[index] = *refpage;
+		return;
+	}
+
+	// pages shared with other states are left alone, private ones are reused
+	std::shared_ptr<page> &dest = m_pages[index];
+	if (!dest || (dest.use_count() > 1))
+		dest = std::make_shared<page>(m_bytes);
+
+	// store a delta unless the chain is too long, make it a key page otherwise
+	if (refpage && ((*refpage)->depth() < MAX_DELTA_DEPTH))
+		dest->assign(*refpage, data, prev, length);
+	else
+		dest->assign(nullptr, data, nullptr, length);
+
+	if (shadow)
+		memcpy(prev, data, length);
+}
+
+
+//-------------------------------------------------
+//  decode_page - get the contents of a page
+//-------------------------------------------------
+
+void ram_state::decode_page(size_t index, u8 *dest) const
+{
+	memset(dest, 0, std::min(PAGE_SIZE, m_size - (index * PAGE_SIZE)));
+	m_pages[index]->apply(dest);
+}
+
+
+//-------------------------------------------------
+//  decode - get the contents of the whole state
+//-------------------------------------------------
+
+void ram_state::decode(u8 *dest) const
+{
+	for (size_t index = 0; m_pages.size() > index; ++index)
+		decode_page(index, &dest[index * PAGE_SIZE]);
+}
+
+
+//-------------------------------------------------
+//  flatten - make every page independent of the
+//  states this one was captured against, so
+//  they can be freed
+//-------------------------------------------------
+
+void ram_state::flatten()
+{
+	for (size_t index = 0; m_pages.size() > index; ++index)
+	{
+		if (m_pages[index])
+			m_pages[index]->flatten(std::min(PAGE_SIZE, m_size - (index * PAGE_SIZE)));
+	}
+}
+
+
 //-------------------------------------------------
 //  save - write the current machine state to the
-//  allocated stream
+//  pages, only storing changes relative to the
+//  reference state; the shadow buffer must hold
+//  the contents of the reference state and is
+//  updated to hold the new state
 //-------------------------------------------------
 
-save_error ram_state::save()
+save_error ram_state::save(const ram_state *reference, u8 *shadow)
 {
 	// initialize
 	m_valid = false;
-	m_data.seekp(0);
-
-	// get the save manager to write state
-	const save_error err = m_save.write_stream(m_data);
+	if (reference == this)
+		reference = nullptr;
+
+	// small blocks are gathered into a staging page, page-aligned runs of
+	// large blocks are compared and encoded straight from the source
+	u8 stage[PAGE_SIZE];
+	size_t fill = 0;
+	size_t index = 0;
+	const save_error err = m_save.do_write(
+			[this] (size_t total_size) { return m_size == total_size; },
+			[this, reference, shadow, &stage, &fill, &index] (const void *data, size_t size)
+			{
+				const u8 *src = reinterpret_cast<const u8 *>(data);
+				while (size)
+				{
+					if (!fill && (size >= PAGE_SIZE))
+					{
+						commit_page(index++, src, PAGE_SIZE, reference, shadow);
+						src += PAGE_SIZE;
+						size -= PAGE_SIZE;
+					}
+					else
+					{
+						const size_t chunk = std::min(size, PAGE_SIZE - fill);
+						memcpy(&stage[fill], src, chunk);
+						fill += chunk;
+						src += chunk;
+						size -= chunk;
+						if (PAGE_SIZE == fill)
+						{
+							commit_page(index++, stage, PAGE_SIZE, reference, shadow);
+							fill = 0;
+						}
+					}
+				}
+				return true;
+			},
+			[] () { return true; },
+			[] () { return true; });
 	if (err != STATERR_NONE)
 		return err;
+	if (fill)
+		commit_page(index, stage, fill, reference, shadow);
 
 	// final confirmation
 	m_valid = true;
@@ -655,20 +1031,49 @@ save_error ram_state::save()
 
 //-------------------------------------------------
 //  load - restore the machine state from the
-//  stream
+//  pages
 //-------------------------------------------------
 
 save_error ram_state::load()
 {
-	// initialize
-	m_data.seekg(0);
-
 	// if we have illegal registrations, return an error
 	if (m_save.m_illegal_regs > 0)
 		return STATERR_ILLEGAL_REGISTRATIONS;
+	for (const auto &page : m_pages)
+	{
+		if (!page)
+			return STATERR_READ_ERROR;
+	}
 
-	// get the save manager to load state
-	return m_save.read_stream(m_data);
+	// get the save manager to load state, decoding a page at a time
+	u8 current[PAGE_SIZE];
+	size_t index = m_pages.size();
+	size_t offset = 0;
+	return m_save.do_read(
+			[this] (size_t total_size) { return m_size == total_size; },
+			[this, &current, &index, &offset] (void *data, size_t size) -> bool
+			{
+				if ((offset + size) > m_size)
+					return false;
+				u8 *dst = reinterpret_cast<u8 *>(data);
+				while (size)
+				{
+					if ((offset / PAGE_SIZE) != index)
+					{
+						index = offset / PAGE_SIZE;
+						decode_page(index, current);
+					}
+					const size_t pageoffs = offset % PAGE_SIZE;
+					const size_t chunk = std::min(size, PAGE_SIZE - pageoffs);
+					memcpy(dst, &current[pageoffs], chunk);
+					dst += chunk;
+					offset += chunk;
+					size -= chunk;
+				}
+				return true;
+			},
+			[] () { return true; },
+			[] () { return true; });
 }
 
 
@@ -684,6 +1089,7 @@ rewinder::rewinder(save_manager &save)
 	, m_first_invalid_index(REWIND_INDEX_NONE)
 	, m_first_time_warning(true)
 	, m_first_time_note(true)
+	, m_shadow_state(nullptr)
 {
 }
 
@@ -755,9 +1161,9 @@ bool rewinder::capture()
 
 	if (current_index_is_last())
 	{
-		// we need to create a new state
+		// we need to create a new state, sharing unchanged pages with the last one
 		std::unique_ptr<ram_state> state = std::make_unique<ram_state>(m_save);
-		const save_error error = state->save();
+		const save_error error = save_state(*state, m_state_list.empty() ? nullptr : m_state_list.back().get());
 
 		// validate the state
 		if (error == STATERR_NONE)
@@ -777,7 +1183,7 @@ bool rewinder::capture()
 
 		// update the existing state
 		ram_state *state = m_state_list.at(m_current_index).get();
-		const save_error error = state->save();
+		const save_error error = save_state(*state, (m_current_index > REWIND_INDEX_FIRST) ? m_state_list[m_current_index - 1].get() : nullptr);
 
 		// validate the state
 		if (error != STATERR_NONE)
@@ -805,6 +1211,27 @@ bool rewinder::capture()
 }
 
 
+//-------------------------------------------------
+//  save_state - capture into a state, storing
+//  it as a delta against the reference state
+//-------------------------------------------------
+
+save_error rewinder::save_state(ram_state &state, const ram_state *reference)
+{
+	// make sure the shadow buffer holds the contents of the reference state
+	if (m_shadow.empty())
+		m_shadow.resize(ram_state::get_size(m_save));
+	if (reference == &state)
+		reference = nullptr;
+	if (reference && (reference != m_shadow_state))
+		reference->decode(m_shadow.data());
+
+	const save_error error = state.save(reference, m_shadow.data());
+	m_shadow_state = (error == STATERR_NONE) ? &state : nullptr;
+	return error;
+}
+
+
 //-------------------------------------------------
 //  step - single step back in time, returns true
 //  on success
@@ -855,9 +1282,10 @@ bool rewinder::check_size()
 	if (!m_enabled)
 		return false;
 
-	// state sizes in bytes
+	// state sizes in bytes - states share unchanged pages, so count the
+	// memory actually held by pages rather than the number of states
 	const size_t singlesize = ram_state::get_size(m_save);
-	size_t totalsize = m_state_list.size() * singlesize;
+	size_t totalsize = m_save.m_ramstate_bytes;
 
 	// convert our limit from megabytes
 	const size_t capsize = m_capacity * 1024 * 1024;
@@ -865,15 +1293,20 @@ bool rewinder::check_size()
 	// safety check that shouldn't be allowed to trigger
 	if (totalsize > capsize)
 	{
-		// states to remove
-		const u32 count = (totalsize - capsize) / singlesize;
-
 		// drop everything that's beyond capacity
+		size_t count = 0;
+		while ((m_save.m_ramstate_bytes > capsize) && ((count + 1) < m_state_list.size()))
+		{
+			if (m_state_list[count].get() == m_shadow_state)
+				m_shadow_state = nullptr;
+			m_state_list[count++].reset();
+		}
 		m_state_list.erase(m_state_list.begin(), m_state_list.begin() + count);
+		m_current_index = std::max<s32>(m_current_index - s32(count), REWIND_INDEX_FIRST);
 	}
 
 	// update before new check
-	totalsize = m_state_list.size() * singlesize;
+	totalsize = m_save.m_ramstate_bytes;
 
 	// check if capacity will be hit by the newly captured state
 	if (totalsize + singlesize >= capsize)
@@ -22,6 +22,7 @@
 #include <memory>
 #include <string>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 
@@ -159,6 +160,7 @@ public:
 	running_machine &machine() const { return m_machine; }
 	rewinder *rewind() { return m_rewind.get(); }
 	int registration_count() const { return m_entry_list.size(); }
+	size_t ramstate_bytes() const { return m_ramstate_bytes; }
 	bool registration_allowed() const { return m_reg_allowed; }
 
 	// registration control
@@ -310,6 +312,18 @@ public:
 	save_error write_buffer(void *buf, size_t size);
 	save_error read_buffer(const void *buf, size_t size);
 
+	save_error write_snapshot(std::vector<u8> &buf);
+	static save_error write_snapshot_file(util::core_file &file, const std::vector<u8> &buf);
+
+	// state hashing - streams the data through XXH64 without building a buffer;
+	// values are hashed little-endian so the result doesn't depend on the host
+	u64 state_hash(const device_t *device = nullptr);
+	void device_state_hashes(std::vector<std::pair<device_t *, u64> > &hashes);
+	void device_state_sizes(std::vector<std::pair<device_t *, u64> > &sizes) const;
+
+	// CRC of the names and sizes of all registered entries, as stored in the header
+	u32 signature() const;
+
 private:
 	// state callback item
 	class state_callback
@@ -326,17 +340,21 @@ private:
 	save_error do_write(T check_space, U write_block, V start_header, W start_data);
 	template <typename T, typename U, typename V, typename W>
 	save_error do_read(T check_length, U read_block, V start_header, W start_data);
-	u32 signature() const;
 	void dump_registry() const;
+	static void hash_entry(const state_entry &entry, util::xxh64_creator &hash);
+	void frame_update();
 	static save_error validate_header(const u8 *header, const char *gamename, u32 signature, void (CLIB_DECL *errormsg)(const char *fmt, ...), const char *error_prefix);
 
 	// internal state
 	running_machine &         m_machine;              // reference to our machine
+	size_t                    m_ramstate_bytes;       // memory held by ram state pages
 	std::unique_ptr<rewinder> m_rewind;               // rewinder
 	bool                      m_reg_allowed;          // are registrations allowed?
 	s32                       m_illegal_regs;         // number of illegal registrations
+	u32                       m_hash_interval;        // frames between logged state hashes
+	u32                       m_hash_frames;          // frames since the last logged state hash
 
-	std::vector<std::unique_ptr<state_entry>>    m_entry_list;       // list of registered entries
+	std::vector<state_entry>                     m_entry_list;       // list of registered entries
 	std::vector<std::unique_ptr<ram_state>>      m_ramstate_list;    // list of ram states
 	std::vector<std::unique_ptr<state_callback>> m_presave_list;     // list of pre-save functions
 	std::vector<std::unique_ptr<state_callback>> m_postload_list;    // list of post-load functions
@@ -344,17 +362,48 @@ private:
 
 class ram_state
 {
+	// state data is held in fixed-size pages; pages that are identical to
+	// the corresponding page of the reference state are shared with it, and
+	// changed pages are stored as encoded XOR deltas against it
+	static constexpr size_t PAGE_SIZE = 4096;
+	static constexpr u8 MAX_DELTA_DEPTH = 30;
+
+	class page
+	{
+	public:
+		page(size_t &bytes) : m_bytes(bytes), m_depth(0) { }
+		~page() { m_bytes -= m_data.capacity(); }
+
+		u8 depth() const { return m_depth; }
+		void assign(std::shared_ptr<const page> &&base, const u8 *data, const u8 *prev, size_t length);
+		void apply(u8 *dest) const;
+		void flatten(size_t length);
+
+	private:
+		size_t &                    m_bytes;          // memory accounting
+		std::shared_ptr<const page> m_base;           // page this is a delta against, if any
+		std::vector<u8>             m_data;           // zero run encoded data
+		u8                          m_depth;          // number of bases to resolve
+	};
+
 	save_manager &     m_save;                        // reference to save_manager
-	util::vectorstream m_data;                        // save data buffer
+	size_t &           m_bytes;                       // memory accounting for pages
+	std::vector<std::shared_ptr<page>> m_pages;       // save data pages
+	size_t             m_size;                        // total size of state data
+
+	void commit_page(size_t index, const u8 *data, size_t length, const ram_state *reference, u8 *shadow);
+	void decode_page(size_t index, u8 *dest) const;
 
 public:
 	bool               m_valid;                       // can we load this state?
 	attotime           m_time;                        // machine timestamp
 
-	ram_state(save_manager &save);
+	ram_state(save_manager &save, size_t *bytes = nullptr);
 	static size_t get_size(save_manager &save);
-	save_error save();
+	save_error save(const ram_state *reference = nullptr, u8 *shadow = nullptr);
 	save_error load();
+	void decode(u8 *dest) const;
+	void flatten();
 };
 
 class rewinder
@@ -367,6 +416,8 @@ class rewinder
 	bool           m_first_time_warning;              // keep track of warnings we report
 	bool           m_first_time_note;                 // keep track of notes
 	std::vector<std::unique_ptr<ram_state>> m_state_list; // rewinder's own ram states
+	std::vector<u8> m_shadow;                         // decoded contents of the last captured state
+	const ram_state *m_shadow_state;                  // state the shadow buffer holds
 
 	// load/save management
 	enum class rewind_operation
@@ -382,6 +433,7 @@ class rewinder
 	};
 
 	bool check_size();
+	save_error save_state(ram_state &state, const ram_state *reference);
 	bool current_index_is_last() { return m_current_index == m_state_list.size() - 1; }
 	void report_error(save_error type, rewind_operation operation);
 
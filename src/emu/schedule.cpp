@@ -10,6 +10,9 @@
 
 #include "emu.h"
 #include "debugger.h"
+#include "emuopts.h"
+
+#include <algorithm>
 
 //**************************************************************************
 //  DEBUGGING
@@ -48,6 +51,8 @@ inline emu_timer::emu_timer() noexcept :
 	m_scheduler(nullptr),
 	m_next(nullptr),
 	m_prev(nullptr),
+	m_heap_index(NOT_ACTIVE),
+	m_sequence(0),
 	m_param(0),
 	m_enabled(false),
 	m_temporary(false),
@@ -83,6 +88,7 @@ inline emu_timer &emu_timer::init(
 	m_scheduler = &machine.scheduler();
 	m_next = nullptr;
 	m_prev = nullptr;
+	m_heap_index = NOT_ACTIVE;
 	m_callback = std::move(callback);
 	m_param = param;
 	m_temporary = temporary;
@@ -204,7 +210,7 @@ void emu_timer::register_save(save_manager &manager)
 	// determine our instance number - timers are indexed based on the callback function name
 	int index = 0;
 	std::string name = m_callback.name() ? m_callback.name() : "unnamed";
-	for (const emu_timer *curtimer = m_scheduler->first_timer(); curtimer; curtimer = curtimer->m_next)
+	for (const emu_timer *curtimer : m_scheduler->m_timer_heap)
 	{
 		if (!curtimer->m_temporary)
 		{
@@ -283,21 +289,24 @@ device_scheduler::device_scheduler(running_machine &machine) :
 	m_executing_device(nullptr),
 	m_execute_list(nullptr),
 	m_basetime(attotime::zero),
-	m_timer_list(nullptr),
+	m_timer_sequence(0),
 	m_inactive_timers(nullptr),
 	m_callback_timer(nullptr),
 	m_callback_timer_modified(false),
 	m_callback_timer_expire_time(attotime::zero),
 	m_suspend_changes_pending(true),
-	m_quantum_minimum(ATTOSECONDS_IN_NSEC(1) / 1000)
+	m_quantum_minimum(ATTOSECONDS_IN_NSEC(1) / 1000),
+	m_profiling(machine.options().profile_scheduler())
 {
-	// append a single never-expiring timer so there is always one in the list
+	// append a single never-expiring timer so there is always one in the heap
 	// need to subvert it because it would naturally be inserted in the inactive list
-	m_timer_list = &timer_list_remove(m_timer_allocator.alloc()->init(machine, timer_expired_delegate(), attotime::never, 0, true));
+	emu_timer &never = timer_list_remove(m_timer_allocator.alloc()->init(machine, timer_expired_delegate(), attotime::never, 0, true));
+	never.m_heap_index = 0;
+	never.m_sequence = m_timer_sequence++;
+	m_timer_heap.push_back(&never);
 
-	assert(m_timer_list);
-	assert(!m_timer_list->m_prev);
-	assert(!m_timer_list->m_next);
+	assert(!never.m_prev);
+	assert(!never.m_next);
 	assert(!m_inactive_timers);
 
 	// register global states
@@ -316,8 +325,8 @@ device_scheduler::~device_scheduler()
 	// remove all timers
 	while (m_inactive_timers)
 		m_timer_allocator.reclaim(timer_list_remove(*m_inactive_timers));
-	while (m_timer_list)
-		m_timer_allocator.reclaim(timer_list_remove(*m_timer_list));
+	while (!m_timer_heap.empty())
+		m_timer_allocator.reclaim(timer_list_remove(*m_timer_heap.back()));
 }
 
 
@@ -345,7 +354,7 @@ attotime device_scheduler::time() const noexcept
 bool device_scheduler::can_save() const
 {
 	// if any live temporary timers exit, fail
-	for (emu_timer *timer = m_timer_list; timer; timer = timer->m_next)
+	for (emu_timer *timer : m_timer_heap)
 	{
 		if (timer->m_temporary && !timer->expire().is_never())
 		{
@@ -402,14 +411,22 @@ void device_scheduler::timeslice()
 		m_quantum_allocator.reclaim(m_quantum_list.detach_head());
 
 	// loop until we hit the next timer
-	while (m_basetime < m_timer_list->m_expire)
+	bool const profiling = m_profiling;
+	while (m_basetime < m_timer_heap.front()->m_expire)
 	{
-		// by default, assume our target is the end of the next quantum
-		attotime target(m_basetime + attotime(0, m_quantum_list.first()->m_actual));
+		// by default, assume our target is the end of the next quantum; the
+		// target is also tracked as a plain attosecond offset from the base
+		// time so the per-device bookkeeping below avoids normalizing adds
+		// and two-part comparisons
+		attoseconds_t target_offset = m_quantum_list.first()->m_actual;
+		attotime target(m_basetime + attotime(0, target_offset));
 
 		// however, if the next timer is going to fire before then, override
-		if (m_timer_list->m_expire < target)
-			target = m_timer_list->m_expire;
+		if (m_timer_heap.front()->m_expire < target)
+		{
+			target = m_timer_heap.front()->m_expire;
+			target_offset = (target - m_basetime).as_attoseconds();
+		}
 
 		LOG("------------------\n");
 		LOG("cpu_timeslice: target = %s\n", target.as_string(PRECISION));
@@ -418,6 +435,13 @@ void device_scheduler::timeslice()
 		if (m_suspend_changes_pending)
 			apply_suspend_changes();
 
+		if (UNEXPECTED(profiling))
+		{
+			m_profile.timeslices++;
+			if (m_quantum_list.first()->m_requested == 0)
+				m_profile.perfect_timeslices++;
+		}
+
 		// loop over all CPUs
 		for (device_execute_interface *exec = m_execute_list; exec != nullptr; exec = exec->m_nextexec)
 		{
@@ -446,12 +470,14 @@ void device_scheduler::timeslice()
 					if (exec->m_suspend == 0)
 					{
 						auto profile = g_profiler.start(exec->m_profiler);
+						auto trace = g_tracer.begin(exec->device().tag());
 
 						// note that this global variable cycles_stolen can be modified
 						// via the call to cpu_execute
 						exec->m_cycles_stolen = 0;
 						m_executing_device = exec;
 						*exec->m_icountptr = exec->m_cycles_running;
+						osd_ticks_t const start_ticks = UNEXPECTED(profiling) ? osd_ticks() : 0;
 						if (!call_debugger)
 							exec->run();
 						else
@@ -466,29 +492,57 @@ void device_scheduler::timeslice()
 						ran -= *exec->m_icountptr;
 						assert(ran >= exec->m_cycles_stolen);
 						ran -= exec->m_cycles_stolen;
+
+						// update profiling counters if requested
+						if (UNEXPECTED(profiling))
+						{
+							device_profile &prof = m_device_profile[exec];
+							prof.host_ticks += osd_ticks() - start_ticks;
+							prof.cycles += ran;
+							prof.timeslices++;
+							if (exec->m_cycles_stolen)
+								prof.aborted++;
+						}
 					}
 
 					// account for these cycles
 					exec->m_totalcycles += ran;
 
-					// update the local time for this CPU
-					attotime deltatime;
-					if (ran < exec->m_cycles_per_second)
-						deltatime = attotime(0, exec->m_attoseconds_per_cycle * ran);
+					// update the local time for this CPU; less than a second
+					// ran is the common case, and then the remaining distance to
+					// the target follows directly from the attoseconds consumed
+					attoseconds_t remaining;
+					if (EXPECTED(ran < exec->m_cycles_per_second))
+					{
+						attoseconds_t const consumed = exec->m_attoseconds_per_cycle * ran;
+						exec->m_localtime += attotime(0, consumed);
+						remaining = delta - consumed;
+						assert(remaining == (target - exec->m_localtime).as_attoseconds());
+					}
 					else
 					{
 						u32 remainder;
 						s32 secs = divu_64x32_rem(ran, exec->m_cycles_per_second, remainder);
-						deltatime = attotime(secs, u64(remainder) * exec->m_attoseconds_per_cycle);
+						attotime deltatime(secs, u64(remainder) * exec->m_attoseconds_per_cycle);
+						assert(deltatime >= attotime::zero);
+						exec->m_localtime += deltatime;
+						remaining = (exec->m_localtime < target) ? (target - exec->m_localtime).as_attoseconds() : 0;
 					}
-					assert(deltatime >= attotime::zero);
-					exec->m_localtime += deltatime;
 					LOG("         %d ran, %d total, time = %s\n", ran, s32(exec->m_totalcycles), exec->m_localtime.as_string(PRECISION));
 
 					// if the new local CPU time is less than our target, move the target up, but not before the base
-					if (exec->m_localtime < target)
+					if (remaining > 0)
 					{
-						target = std::max(exec->m_localtime, m_basetime);
+						if (remaining <= target_offset)
+						{
+							target = exec->m_localtime;
+							target_offset -= remaining;
+						}
+						else
+						{
+							target = m_basetime;
+							target_offset = 0;
+						}
 						LOG("         (new target)\n");
 					}
 				}
@@ -513,7 +567,11 @@ void device_scheduler::timeslice()
 void device_scheduler::abort_timeslice() noexcept
 {
 	if (m_executing_device != nullptr)
+	{
+		if (UNEXPECTED(m_profiling))
+			m_profile.aborts++;
 		m_executing_device->abort_timeslice();
+	}
 }
 
 
@@ -592,6 +650,8 @@ void device_scheduler::add_quantum(const attotime &quantum, const attotime &dura
 
 void device_scheduler::perfect_quantum(const attotime &duration)
 {
+	if (UNEXPECTED(m_profiling))
+		m_profile.perfect_quantum_calls++;
 	add_quantum(attotime::zero, duration);
 }
 
@@ -632,6 +692,11 @@ void device_scheduler::timer_set(const attotime &duration, timer_expired_delegat
 
 void device_scheduler::synchronize(timer_expired_delegate callback, int param)
 {
+	if (UNEXPECTED(m_profiling))
+	{
+		m_profile.synchronize_calls++;
+		m_synchronize_profile[callback.name() ? callback.name() : "(none)"]++;
+	}
 	m_timer_allocator.alloc()->init(
 			machine(),
 			std::move(callback),
@@ -685,47 +750,54 @@ void device_scheduler::presave()
 void device_scheduler::postload()
 {
 	// remove all timers and make a private list of permanent ones
-	emu_timer *private_list = nullptr;
+	// the expiry times have been overwritten, so the heap order can't be trusted
+	std::vector<emu_timer *> timers;
+	timers.reserve(m_timer_heap.size());
 	while (m_inactive_timers)
 	{
 		emu_timer &timer = *m_inactive_timers;
 		assert(!timer.m_temporary);
 
-		timer_list_remove(timer).m_next = private_list;
-		private_list = &timer;
+		timers.push_back(&timer_list_remove(timer));
 	}
-	while (m_timer_list->m_next)
+	emu_timer *never = nullptr;
+	std::vector<emu_timer *> active;
+	active.swap(m_timer_heap);
+	std::stable_sort(
+			active.begin(),
+			active.end(),
+			[] (emu_timer const *a, emu_timer const *b) { return a->m_sequence < b->m_sequence; });
+	for (emu_timer *const timer : active)
 	{
-		emu_timer &timer = *m_timer_list;
-
-		if (timer.m_temporary)
+		timer->m_heap_index = emu_timer::NOT_ACTIVE;
+		if (timer->m_temporary && timer->m_expire.is_never() && !timer->m_enabled)
+		{
+			// our special never-expiring timer
+			never = timer;
+		}
+		else if (timer->m_temporary)
 		{
-			assert(!timer.expire().is_never());
+			assert(!timer->expire().is_never());
 
 			// temporary timers go away entirely (except our special never-expiring one)
-			timer.m_callback.reset();
-			m_timer_allocator.reclaim(timer_list_remove(timer));
+			timer->m_callback.reset();
+			m_timer_allocator.reclaim(timer);
 		}
 		else
 		{
 			// permanent ones get added to our private list
-			timer_list_remove(timer).m_next = private_list;
-			private_list = &timer;
+			timers.push_back(timer);
 		}
 	}
 
 	// special dummy timer
-	assert(!m_timer_list->m_enabled);
-	assert(m_timer_list->m_temporary);
-	assert(m_timer_list->m_expire.is_never());
+	assert(never);
+	never->m_heap_index = 0;
+	m_timer_heap.push_back(never);
 
-	// now re-insert them; this effectively re-sorts them by time
-	while (private_list)
-	{
-		emu_timer &timer = *private_list;
-		private_list = timer.m_next;
-		timer_list_insert(timer);
-	}
+	// now re-insert them in reverse collection order; this effectively re-sorts them by time
+	for (auto it = timers.rbegin(); timers.rend() != it; ++it)
+		timer_list_insert(**it);
 
 	m_suspend_changes_pending = true;
 	rebuild_execute_list();
@@ -836,43 +908,25 @@ void device_scheduler::rebuild_execute_list()
 
 //-------------------------------------------------
 //  timer_list_insert - insert a new timer into
-//  the list at the appropriate location
+//  the heap at the appropriate location
 //-------------------------------------------------
 
 inline emu_timer &device_scheduler::timer_list_insert(emu_timer &timer)
 {
+	assert(timer.m_heap_index == emu_timer::NOT_ACTIVE);
+
 	// disabled timers never expire
 	if (!timer.m_expire.is_never() && timer.m_enabled)
 	{
-		// loop over the timer list
-		emu_timer *prevtimer = nullptr;
-		for (emu_timer *curtimer = m_timer_list; curtimer; prevtimer = curtimer, curtimer = curtimer->m_next)
-		{
-			// if the current list entry expires after us, we should be inserted before it
-			if (curtimer->m_expire > timer.m_expire)
-			{
-				// link the new guy in before the current list entry
-				timer.m_prev = prevtimer;
-				timer.m_next = curtimer;
-
-				if (prevtimer)
-					prevtimer->m_next = &timer;
-				else
-					m_timer_list = &timer;
-
-				curtimer->m_prev = &timer;
-				return timer;
-			}
-		}
-
-		// need to insert after the last one
-		if (prevtimer)
-			prevtimer->m_next = &timer;
-		else
-			m_timer_list = &timer;
-
-		timer.m_prev = prevtimer;
+		// timers with equal expiry times fire in the order they were inserted
+		timer.m_sequence = m_timer_sequence++;
+		timer.m_prev = nullptr;
 		timer.m_next = nullptr;
+
+		// add at the bottom of the heap and let it bubble up
+		timer.m_heap_index = m_timer_heap.size();
+		m_timer_heap.push_back(&timer);
+		timer_heap_sift_up(timer.m_heap_index);
 	}
 	else
 	{
@@ -891,19 +945,35 @@ inline emu_timer &device_scheduler::timer_list_insert(emu_timer &timer)
 
 //-------------------------------------------------
 //  timer_list_remove - remove a timer from the
-//  linked list
+//  heap or the inactive list
 //-------------------------------------------------
 
 inline emu_timer &device_scheduler::timer_list_remove(emu_timer &timer)
 {
-	// remove it from the list
-	if (timer.m_prev)
+	if (timer.m_heap_index != emu_timer::NOT_ACTIVE)
 	{
-		timer.m_prev->m_next = timer.m_next;
+		// move the last entry into the vacated slot and restore the heap property
+		size_t const index = timer.m_heap_index;
+		assert(m_timer_heap[index] == &timer);
+		emu_timer *const last = m_timer_heap.back();
+		m_timer_heap.pop_back();
+		timer.m_heap_index = emu_timer::NOT_ACTIVE;
+		if (last != &timer)
+		{
+			m_timer_heap[index] = last;
+			last->m_heap_index = index;
+			if (index && last->expires_before(*m_timer_heap[(index - 1) / 2]))
+				timer_heap_sift_up(index);
+			else
+				timer_heap_sift_down(index);
+		}
+		return timer;
 	}
-	else if (&timer == m_timer_list)
+
+	// remove it from the inactive list
+	if (timer.m_prev)
 	{
-		m_timer_list = timer.m_next;
+		timer.m_prev->m_next = timer.m_next;
 	}
 	else
 	{
@@ -918,19 +988,69 @@ inline emu_timer &device_scheduler::timer_list_remove(emu_timer &timer)
 }
 
 
+//-------------------------------------------------
+//  timer_heap_sift_up - move a timer towards the
+//  top of the heap until its parent expires first
+//-------------------------------------------------
+
+inline void device_scheduler::timer_heap_sift_up(size_t index) noexcept
+{
+	emu_timer *const timer = m_timer_heap[index];
+	while (index)
+	{
+		size_t const parent = (index - 1) / 2;
+		if (!timer->expires_before(*m_timer_heap[parent]))
+			break;
+		m_timer_heap[index] = m_timer_heap[parent];
+		m_timer_heap[index]->m_heap_index = index;
+		index = parent;
+	}
+	m_timer_heap[index] = timer;
+	timer->m_heap_index = index;
+}
+
+
+//-------------------------------------------------
+//  timer_heap_sift_down - move a timer towards the
+//  bottom of the heap until its children expire
+//  after it
+//-------------------------------------------------
+
+inline void device_scheduler::timer_heap_sift_down(size_t index) noexcept
+{
+	size_t const count = m_timer_heap.size();
+	emu_timer *const timer = m_timer_heap[index];
+	while (true)
+	{
+		size_t child = (index * 2) + 1;
+		if (child >= count)
+			break;
+		if (((child + 1) < count) && m_timer_heap[child + 1]->expires_before(*m_timer_heap[child]))
+			++child;
+		if (!m_timer_heap[child]->expires_before(*timer))
+			break;
+		m_timer_heap[index] = m_timer_heap[child];
+		m_timer_heap[index]->m_heap_index = index;
+		index = child;
+	}
+	m_timer_heap[index] = timer;
+	timer->m_heap_index = index;
+}
+
+
 //-------------------------------------------------
 //  execute_timers - execute timers that are due
 //-------------------------------------------------
 
 inline void device_scheduler::execute_timers()
 {
-	LOG("execute_timers: new=%s head->expire=%s\n", m_basetime.as_string(PRECISION), m_timer_list->m_expire.as_string(PRECISION));
+	LOG("execute_timers: new=%s head->expire=%s\n", m_basetime.as_string(PRECISION), m_timer_heap.front()->m_expire.as_string(PRECISION));
 
 	// now process any timers that are overdue
-	while (m_timer_list->m_expire <= m_basetime)
+	while (m_timer_heap.front()->m_expire <= m_basetime)
 	{
 		// if this is a one-shot timer, disable it now
-		emu_timer &timer = *m_timer_list;
+		emu_timer &timer = *m_timer_heap.front();
 		bool was_enabled = timer.m_enabled;
 		if (timer.m_period.is_zero() || timer.m_period.is_never())
 			timer.m_enabled = false;
@@ -944,6 +1064,7 @@ inline void device_scheduler::execute_timers()
 		if (was_enabled)
 		{
 			auto profile = g_profiler.start(PROFILER_TIMER_CALLBACK);
+			auto trace = g_tracer.begin(timer.m_callback.name() ? timer.m_callback.name() : "timer callback");
 
 			if (!timer.m_callback.isnull())
 			{
@@ -982,9 +1103,69 @@ void device_scheduler::dump_timers() const
 {
 	machine().logerror("=============================================\n");
 	machine().logerror("Timer Dump: Time = %15s\n", time().as_string(PRECISION));
-	for (emu_timer *timer = m_timer_list; timer; timer = timer->m_next)
+	std::vector<emu_timer *> active(m_timer_heap);
+	std::sort(
+			active.begin(),
+			active.end(),
+			[] (emu_timer const *a, emu_timer const *b) { return a->expires_before(*b); });
+	for (emu_timer *timer : active)
 		timer->dump();
 	for (emu_timer *timer = m_inactive_timers; timer; timer = timer->m_next)
 		timer->dump();
 	machine().logerror("=============================================\n");
 }
+
+
+//-------------------------------------------------
+//  reset_profile - clear profiling counters
+//-------------------------------------------------
+
+void device_scheduler::reset_profile()
+{
+	m_profile = profile_counters();
+	m_device_profile.clear();
+	m_synchronize_profile.clear();
+}
+
+
+//-------------------------------------------------
+//  profile - get profiling counters for a device
+//-------------------------------------------------
+
+const device_scheduler::device_profile *device_scheduler::profile(device_execute_interface const &exec) const
+{
+	auto const found(m_device_profile.find(&exec));
+	return (m_device_profile.end() != found) ? &found->second : nullptr;
+}
+
+
+//-------------------------------------------------
+//  dump_profile - print profiling counters
+//-------------------------------------------------
+
+void device_scheduler::dump_profile() const
+{
+	double const tps = double(osd_ticks_per_second());
+
+	osd_printf_info("Scheduler profile:\n");
+	osd_printf_info("  timeslices: %u (%u with perfect quantum, %u perfect_quantum requests)\n",
+			m_profile.timeslices, m_profile.perfect_timeslices, m_profile.perfect_quantum_calls);
+	osd_printf_info("  timer-triggered abort_timeslice: %u\n", m_profile.aborts);
+	osd_printf_info("  devices:\n");
+	for (device_execute_interface &exec : execute_interface_enumerator(machine().root_device()))
+	{
+		device_profile const *const prof(profile(exec));
+		if (!prof)
+			continue;
+		osd_printf_info("    %-24s %10.3fs host, %14u cycles, %10u runs (%u aborted), %.1f cycles/run\n",
+				exec.device().tag(),
+				double(prof->host_ticks) / tps,
+				prof->cycles,
+				prof->timeslices,
+				prof->aborted,
+				prof->timeslices ? (double(prof->cycles) / double(prof->timeslices)) : 0.0);
+	}
+	osd_printf_info("  synchronize: %u\n", m_profile.synchronize_calls);
+	for (auto const &caller : m_synchronize_profile)
+		osd_printf_info("    %-48s %10u\n", caller.first, caller.second);
+}
@@ -74,10 +74,18 @@ private:
 	void schedule_next_period() noexcept;
 	void dump() const;
 
+	// internal helpers for the active timer heap
+	bool expires_before(const emu_timer &that) const noexcept
+	{
+		return (m_expire < that.m_expire) || ((m_expire == that.m_expire) && (m_sequence < that.m_sequence));
+	}
+
 	// internal state
 	device_scheduler *  m_scheduler;    // reference to the owning machine
-	emu_timer *         m_next;         // next timer in order in the list
-	emu_timer *         m_prev;         // previous timer in order in the list
+	emu_timer *         m_next;         // next timer in the inactive list
+	emu_timer *         m_prev;         // previous timer in the inactive list
+	size_t              m_heap_index;   // index in the active heap, or NOT_ACTIVE
+	u64                 m_sequence;     // insertion order, used to break ties in the active heap
 	timer_expired_delegate m_callback;  // callback function
 	s32                 m_param;        // integer parameter
 	bool                m_enabled;      // is the timer enabled?
@@ -86,6 +94,9 @@ private:
 	attotime            m_start;        // time when the timer was started
 	attotime            m_expire;       // time when the timer will expire
 
+	// heap index value for timers in the inactive list
+	static constexpr size_t NOT_ACTIVE = ~size_t(0);
+
 	friend class device_scheduler;
 	friend class fixed_allocator<emu_timer>;
 	friend class simple_list<emu_timer>; // FIXME: fixed_allocator requires this
@@ -100,6 +111,25 @@ class device_scheduler
 	friend class emu_timer;
 
 public:
+	// per-device counters collected while profiling is enabled
+	struct device_profile
+	{
+		osd_ticks_t             host_ticks = 0;             // host time spent executing the device
+		u64                     cycles = 0;                 // cycles executed
+		u64                     timeslices = 0;             // number of times the device was run
+		u64                     aborted = 0;                // timeslices cut short by abort_timeslice
+	};
+
+	// scheduler-wide counters collected while profiling is enabled
+	struct profile_counters
+	{
+		u64                     timeslices = 0;             // number of scheduling passes over the execute list
+		u64                     perfect_timeslices = 0;     // passes made while a perfect quantum was active
+		u64                     perfect_quantum_calls = 0;  // number of perfect_quantum requests
+		u64                     synchronize_calls = 0;      // number of synchronize requests
+		u64                     aborts = 0;                 // abort_timeslice requests from the timer system
+	};
+
 	// construction/destruction
 	device_scheduler(running_machine &machine);
 	~device_scheduler();
@@ -107,7 +137,7 @@ public:
 	// getters
 	running_machine &machine() const noexcept { return m_machine; }
 	attotime time() const noexcept;
-	emu_timer *first_timer() const noexcept { return m_timer_list; }
+	emu_timer *first_timer() const noexcept { return m_timer_heap.empty() ? nullptr : m_timer_heap.front(); }
 	device_execute_interface *currently_executing() const noexcept { return m_executing_device; }
 	bool can_save() const;
 
@@ -128,6 +158,15 @@ public:
 	// debugging
 	void dump_timers() const;
 
+	// profiling
+	bool profiling() const noexcept { return m_profiling; }
+	void set_profiling(bool enable) noexcept { m_profiling = enable; }
+	void reset_profile();
+	profile_counters const &profile() const noexcept { return m_profile; }
+	device_profile const *profile(device_execute_interface const &exec) const;
+	std::map<std::string, u64> const &synchronize_profile() const noexcept { return m_synchronize_profile; }
+	void dump_profile() const;
+
 	// for emergencies only!
 	void eat_all_cycles();
 
@@ -145,6 +184,8 @@ private:
 	// timer helpers
 	emu_timer &timer_list_insert(emu_timer &timer);
 	emu_timer &timer_list_remove(emu_timer &timer);
+	void timer_heap_sift_up(size_t index) noexcept;
+	void timer_heap_sift_down(size_t index) noexcept;
 	void execute_timers();
 
 	// internal state
@@ -153,8 +194,9 @@ private:
 	device_execute_interface *  m_execute_list;             // list of devices to be executed
 	attotime                    m_basetime;                 // global basetime; everything moves forward from here
 
-	// list of active timers
-	emu_timer *                 m_timer_list;               // head of the active list
+	// active timers are kept in a binary min-heap ordered by expiry time
+	std::vector<emu_timer *>    m_timer_heap;               // heap of active timers; front is the next to fire
+	u64                         m_timer_sequence;           // insertion counter for stable ordering of equal expiry times
 	emu_timer *                 m_inactive_timers;          // head of the inactive timer list
 	fixed_allocator<emu_timer>  m_timer_allocator;          // allocator for timers
 
@@ -180,6 +222,12 @@ private:
 	simple_list<quantum_slot>   m_quantum_list;             // list of active quanta
 	fixed_allocator<quantum_slot> m_quantum_allocator;      // allocator for quanta
 	attoseconds_t               m_quantum_minimum;          // duration of minimum quantum
+
+	// profiling
+	bool                        m_profiling;                // whether profiling counters are updated
+	profile_counters            m_profile;                  // scheduler-wide counters
+	std::map<device_execute_interface const *, device_profile> m_device_profile; // per-device counters
+	std::map<std::string, u64>  m_synchronize_profile;      // synchronize requests by callback name
 };
 
 
@@ -20,7 +20,9 @@
 #include "nanosvg.h"
 #include "png.h"
 
+#include <algorithm>
 #include <set>
+#include <thread>
 
 
 //**************************************************************************
@@ -46,6 +48,7 @@ u32 screen_device::m_id_counter = 0;
 class screen_device::svg_renderer {
 public:
 	svg_renderer(memory_region *region);
+	~svg_renderer();
 
 	int width() const;
 	int height() const;
@@ -71,12 +74,31 @@ private:
 		int x0, y0, x1, y1;
 	};
 
-	util::nsvg_image_ptr m_image;
-	util::nsvg_rasterizer_ptr m_rasterizer;
+	// Shape visibility is kept in the parsed document, so each thread
+	// rebuilding the cache needs a copy of its own
+	struct raster_context {
+		util::nsvg_image_ptr image;
+		util::nsvg_rasterizer_ptr rasterizer;
+		std::vector<std::vector<NSVGshape *>> keyed_shapes;
+		std::vector<bool> state;
+		std::vector<u32> rend;
+	};
+
+	struct raster_pass {
+		svg_renderer *renderer;
+		const std::vector<std::list<int>> *keys;
+		const std::vector<bbox> *bboxes;
+		const std::vector<int> *previous;
+		std::vector<int> doing;
+	};
+
+	memory_region *m_region;
+	std::unique_ptr<raster_context> m_context[WORK_MAX_THREADS + 1];
 	std::vector<bool> m_key_state;
-	std::vector<std::vector<NSVGshape *>> m_keyed_shapes;
 	std::unordered_map<std::string, int> m_key_ids;
 	int m_key_count;
+	bool m_dirty;
+	osd_work_queue *m_queue;
 
 	int m_sx, m_sy;
 	double m_scale;
@@ -85,68 +107,97 @@ private:
 	std::vector<cached_bitmap> m_cache;
 
 	void output_change(const char *outname, s32 value);
-	void render_state(std::vector<u32> &dest, const std::vector<bool> &state);
+	std::unique_ptr<raster_context> parse();
+	void render_state(raster_context &ctx, std::vector<u32> &dest, const std::vector<bool> &state);
 	void compute_initial_bboxes(std::vector<bbox> &bboxes);
 	bool compute_mask_intersection_bbox(int key1, int key2, bbox &bb) const;
 	void compute_diff_image(const std::vector<u32> &rend, const bbox &bb, cached_bitmap &dest) const;
 	void compute_dual_diff_image(const std::vector<u32> &rend, const bbox &bb, const cached_bitmap &src1, const cached_bitmap &src2, cached_bitmap &dest) const;
+	void render_passes(int start, int end, const std::vector<std::list<int>> &keys, const std::vector<bbox> &bboxes, const std::vector<int> *previous);
+	void run_pass(const raster_pass &pass, int threadid);
+	static void *pass_callback(void *param, int threadid);
 	void rebuild_cache();
 	void blit(bitmap_rgb32 &bitmap, const cached_bitmap &src) const;
 };
 
 screen_device::svg_renderer::svg_renderer(memory_region *region)
+	: m_region(region)
+	, m_key_count(0)
+	, m_dirty(true)
+	, m_queue(nullptr)
 {
-	const std::unique_ptr<char []> s(new char[region->bytes() + 1]);
-	memcpy(s.get(), region->base(), region->bytes());
-	s[region->bytes()] = 0;
-	m_image.reset(nsvgParse(s.get(), "px", 72));
-	m_rasterizer.reset(nsvgCreateRasterizer());
+	m_context[0] = parse();
+	m_key_state.resize(m_key_count);
+	std::fill(m_key_state.begin(),m_key_state.end(),false);
+
+	// Rebuilding the cache takes a lot of independent render passes
+	if(std::thread::hardware_concurrency() > 1)
+		m_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+
+	m_sx = m_sy = 0;
+	m_scale = 1.0;
+
+	NSVGimage const &image = *m_context[0]->image;
+	osd_printf_verbose("Parsed SVG '%s', aspect ratio %f\n", region->name(), (image.height == 0.0f) ? 0 : image.width / image.height);
+}
 
-	m_key_count = 0;
+screen_device::svg_renderer::~svg_renderer()
+{
+	if(m_queue)
+		osd_work_queue_free(m_queue);
+}
 
-	for (NSVGshape *shape = m_image->shapes; shape; shape = shape->next)
+std::unique_ptr<screen_device::svg_renderer::raster_context> screen_device::svg_renderer::parse()
+{
+	// nanosvg parses in place, so work on a copy
+	const std::unique_ptr<char []> s(new char[m_region->bytes() + 1]);
+	memcpy(s.get(), m_region->base(), m_region->bytes());
+	s[m_region->bytes()] = 0;
+
+	auto ctx = std::make_unique<raster_context>();
+	ctx->image.reset(nsvgParse(s.get(), "px", 72));
+	ctx->rasterizer.reset(nsvgCreateRasterizer());
+
+	// Keys are numbered on the first parse; later copies have the same
+	// shapes in the same order
+	ctx->keyed_shapes.resize(m_key_count);
+	for (NSVGshape *shape = ctx->image->shapes; shape; shape = shape->next)
 		if(shape->title[0]) {
 			const auto it = m_key_ids.find(shape->title);
 			if(it != m_key_ids.end())
-				m_keyed_shapes[it->second].push_back(shape);
+				ctx->keyed_shapes[it->second].push_back(shape);
 			else {
 				const int id = m_key_count++;
-				m_keyed_shapes.resize(m_key_count);
-				m_keyed_shapes[id].push_back(shape);
+				ctx->keyed_shapes.resize(m_key_count);
+				ctx->keyed_shapes[id].push_back(shape);
 				m_key_ids[shape->title] = id;
 			}
 		}
-	m_key_state.resize(m_key_count);
-	std::fill(m_key_state.begin(),m_key_state.end(),false);
-
-	m_sx = m_sy = 0;
-	m_scale = 1.0;
-
-	osd_printf_verbose("Parsed SVG '%s', aspect ratio %f\n", region->name(), (m_image->height == 0.0f) ? 0 : m_image->width / m_image->height);
+	return ctx;
 }
 
 int screen_device::svg_renderer::width() const
 {
-	return int(m_image->width + 0.5);
+	return int(m_context[0]->image->width + 0.5);
 }
 
 int screen_device::svg_renderer::height() const
 {
-	return int(m_image->height + 0.5);
+	return int(m_context[0]->image->height + 0.5);
 }
 
-void screen_device::svg_renderer::render_state(std::vector<u32> &dest, const std::vector<bool> &state)
+void screen_device::svg_renderer::render_state(raster_context &ctx, std::vector<u32> &dest, const std::vector<bool> &state)
 {
 	for(int key = 0; key != m_key_count; key++) {
 		if (state[key])
-			for(auto s : m_keyed_shapes[key])
+			for(auto s : ctx.keyed_shapes[key])
 				s->flags |= NSVG_FLAGS_VISIBLE;
 		else
-			for(auto s : m_keyed_shapes[key])
+			for(auto s : ctx.keyed_shapes[key])
 				s->flags &= ~NSVG_FLAGS_VISIBLE;
 	}
 
-	nsvgRasterize(m_rasterizer.get(), m_image.get(), 0, 0, m_scale, (unsigned char *)&dest[0], m_sx, m_sy, m_sx*4);
+	nsvgRasterize(ctx.rasterizer.get(), ctx.image.get(), 0, 0, m_scale, (unsigned char *)&dest[0], m_sx, m_sy, m_sx*4);
 
 	// Nanosvg generates non-premultiplied alpha, so remultiply by
 	// alpha to "blend" against a black background.  Plus align the
@@ -192,13 +243,19 @@ int screen_device::svg_renderer::render(screen_device &screen, bitmap_rgb32 &bit
 	if(nsx != m_sx || nsy != m_sy) {
 		m_sx = nsx;
 		m_sy = nsy;
-		double sx = double(m_sx)/m_image->width;
-		double sy = double(m_sy)/m_image->height;
+		double sx = double(m_sx)/m_context[0]->image->width;
+		double sy = double(m_sy)/m_context[0]->image->height;
 		m_scale = sx > sy ? sy : sx;
 		m_background.resize(m_sx * m_sy);
 		rebuild_cache();
+		m_dirty = true;
 	}
 
+	// Nothing to recompose if no element changed state
+	if(!m_dirty)
+		return UPDATE_HAS_NOT_CHANGED;
+	m_dirty = false;
+
 	for(unsigned int y = 0; y < m_sy; y++)
 		memcpy(bitmap.raw_pixptr(y, 0), &m_background[y * m_sx], m_sx * 4);
 
@@ -229,7 +286,10 @@ void screen_device::svg_renderer::output_change(const char *outname, s32 value)
 	auto l = m_key_ids.find(outname);
 	if (l == m_key_ids.end())
 		return;
-	m_key_state[l->second] = value;
+	if (m_key_state[l->second] != bool(value)) {
+		m_key_state[l->second] = value;
+		m_dirty = true;
+	}
 }
 
 void screen_device::svg_renderer::compute_initial_bboxes(std::vector<bbox> &bboxes)
@@ -238,7 +298,7 @@ void screen_device::svg_renderer::compute_initial_bboxes(std::vector<bbox> &bbox
 	for(int key = 0; key != m_key_count; key++) {
 		int x0, y0, x1, y1;
 		x0 = y0 = x1 = y1 = -1;
-		for(auto s : m_keyed_shapes[key]) {
+		for(auto s : m_context[0]->keyed_shapes[key]) {
 			int xx0 = int(floor(s->bounds[0]*m_scale));
 			int yy0 = int(floor(s->bounds[1]*m_scale));
 			int xx1 = int(ceil (s->bounds[2]*m_scale)) + 1;
@@ -409,33 +469,20 @@ void screen_device::svg_renderer::compute_dual_diff_image(const std::vector<u32>
 	}
 }
 
-void screen_device::svg_renderer::rebuild_cache()
+void screen_device::svg_renderer::render_passes(int start, int end, const std::vector<std::list<int>> &keys, const std::vector<bbox> &bboxes, const std::vector<int> *previous)
 {
-	m_cache.clear();
-	std::vector<u32> rend(m_sx*m_sy);
-
-	// Render the background, e.g. with everything off
-	std::vector<bool> state(m_key_count);
-	for(int key=0; key != m_key_count; key++)
-		state[key] = false;
-
-	render_state(m_background, state);
-
-	// Render each individual element independently.  Try to reduce
-	// the actual number of render passes with a greedy algorithm
-	// using the element bounding boxes.
-	std::vector<bbox> bboxes;
-	compute_initial_bboxes(bboxes);
-
-	m_cache.resize(m_key_count);
+	// Render each entry independently.  Try to reduce the actual
+	// number of render passes with a greedy algorithm using the
+	// bounding boxes.
+	std::vector<raster_pass> passes;
 	std::set<int> to_do;
-	for(int key=0; key != m_key_count; key++)
+	for(int key = start; key != end; key++)
 		to_do.insert(key);
 
 	while(!to_do.empty()) {
-		std::list<int> doing;
+		raster_pass &pass = passes.emplace_back(raster_pass{ this, &keys, &bboxes, previous, { } });
 		for(int key : to_do) {
-			for(int okey : doing) {
+			for(int okey : pass.doing) {
 				// The bounding boxes include x1/y1, so the comparisons must be strict
 				if(!(bboxes[key].x0 > bboxes[okey].x1 ||
 						bboxes[key].x1 < bboxes[okey].x0 ||
@@ -443,28 +490,75 @@ void screen_device::svg_renderer::rebuild_cache()
 						bboxes[key].y1 < bboxes[okey].y0))
 					goto conflict;
 			}
-			doing.push_back(key);
+			pass.doing.push_back(key);
 		conflict:
 			;
 		}
-		for(int key : doing)
-			state[key] = true;
-		render_state(rend, state);
-		for(int key : doing) {
-			state[key] = false;
+		for(int key : pass.doing)
 			to_do.erase(key);
-		}
-		for(int key : doing)
-			compute_diff_image(rend, bboxes[key], m_cache[key]);
 	}
 
-	// Then it's time to pick up the interactions.
-	int spos = 0;
-	int epos = m_key_count;
+	// The passes only write their own cache entries, so they can run
+	// in parallel; the waiting thread helps with the work
+	if(m_queue && passes.size() > 1) {
+		osd_work_item_queue_multiple(m_queue, pass_callback, passes.size(), &passes[0], sizeof(passes[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+		while(!osd_work_queue_wait(m_queue, osd_ticks_per_second() * 10)) { }
+	} else {
+		for(const raster_pass &pass : passes)
+			run_pass(pass, 0);
+	}
+}
+
+void *screen_device::svg_renderer::pass_callback(void *param, int threadid)
+{
+	const raster_pass &pass = *reinterpret_cast<const raster_pass *>(param);
+	pass.renderer->run_pass(pass, threadid);
+	return nullptr;
+}
+
+void screen_device::svg_renderer::run_pass(const raster_pass &pass, int threadid)
+{
+	std::unique_ptr<raster_context> &ctx = m_context[threadid];
+	if(!ctx)
+		ctx = parse();
+	ctx->state.assign(m_key_count, false);
+	ctx->rend.resize(m_sx*m_sy);
+
+	for(int key : pass.doing)
+		for(int akey : (*pass.keys)[key])
+			ctx->state[akey] = true;
+	render_state(*ctx, ctx->rend, ctx->state);
+
+	for(int key : pass.doing) {
+		if(pass.previous)
+			compute_dual_diff_image(ctx->rend, (*pass.bboxes)[key], m_cache[(*pass.previous)[key]], m_cache[(*pass.keys)[key].back()], m_cache[key]);
+		else
+			compute_diff_image(ctx->rend, (*pass.bboxes)[key], m_cache[key]);
+	}
+}
+
+void screen_device::svg_renderer::rebuild_cache()
+{
+	m_cache.clear();
+
+	// Render the background, e.g. with everything off
+	render_state(*m_context[0], m_background, std::vector<bool>(m_key_count, false));
+
+	// Render each individual element independently.
+	std::vector<bbox> bboxes;
+	compute_initial_bboxes(bboxes);
+
 	std::vector<std::list<int> > keys(m_key_count);
 	std::vector<int> previous;
 	for(int key = 0; key != m_key_count; key++)
 		keys[key].push_back(key);
+
+	m_cache.resize(m_key_count);
+	render_passes(0, m_key_count, keys, bboxes, nullptr);
+
+	// Then it's time to pick up the interactions.
+	int spos = 0;
+	int epos = m_key_count;
 	int ckey = m_key_count;
 	while(spos != epos) {
 		for(int key = spos; key < epos-1; key++) {
@@ -482,41 +576,16 @@ void screen_device::svg_renderer::rebuild_cache()
 			}
 		}
 		m_cache.resize(ckey);
-		std::set<int> to_do;
-		for(int key = epos; key != ckey; key++)
-			to_do.insert(key);
-
-		while(!to_do.empty()) {
-			std::list<int> doing;
-			for(int key : to_do) {
-				for(int okey : doing) {
-					// The bounding boxes include x1/y1, so the comparisons must be strict
-					if(!(bboxes[key].x0 > bboxes[okey].x1 ||
-							bboxes[key].x1 < bboxes[okey].x0 ||
-							bboxes[key].y0 > bboxes[okey].y1 ||
-							bboxes[key].y1 < bboxes[okey].y0))
-						goto conflict2;
-				}
-				doing.push_back(key);
-			conflict2:
-				;
-			}
-			for(int key : doing)
-				for(int akey : keys[key])
-					state[akey] = true;
-
-			render_state(rend, state);
-			for(int key : doing) {
-				for(int akey : keys[key])
-					state[akey] = false;
-				to_do.erase(key);
-			}
-			for(int key : doing)
-				compute_dual_diff_image(rend, bboxes[key], m_cache[previous[key]], m_cache[keys[key].back()], m_cache[key]);
-		}
+		render_passes(epos, ckey, keys, bboxes, &previous);
 		spos = epos;
 		epos = ckey;
 	}
+
+	// The parsed copies are kept for the next size change, but the
+	// full-size scratch images aren't
+	for(auto &ctx : m_context)
+		if(ctx)
+			std::vector<u32>().swap(ctx->rend);
 }
 
 //**************************************************************************
@@ -569,8 +638,13 @@ screen_device::screen_device(const machine_config &mconfig, const char *tag, dev
 	, m_vblank_end_timer(nullptr)
 	, m_scanline0_timer(nullptr)
 	, m_scanline_timer(nullptr)
+	, m_slice_timer(nullptr)
+	, m_slice_count(0)
+	, m_slice_copied(0)
 	, m_frame_number(0)
 	, m_partial_updates_this_frame(0)
+	, m_band_queue(nullptr)
+	, m_band_count(1)
 {
 	m_unique_id = m_id_counter;
 	m_id_counter++;
@@ -819,6 +893,14 @@ void screen_device::device_start()
 	}
 	register_screen_bitmap(m_priority);
 
+	// allocate a work queue if the update callback can be split into bands
+	if ((m_video_attributes & VIDEO_UPDATE_BANDS) && !(m_video_attributes & VIDEO_VARIABLE_WIDTH) && m_type != SCREEN_TYPE_SVG)
+	{
+		m_band_count = std::clamp<int>(std::thread::hardware_concurrency(), 1, WORK_MAX_THREADS);
+		if (m_band_count > 1)
+			m_band_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	}
+
 	// allocate raw textures
 	m_texture[0] = machine().render().texture_alloc();
 	m_texture[0]->set_id(u64(m_unique_id) << 57);
@@ -844,6 +926,13 @@ void screen_device::device_start()
 	if ((m_video_attributes & VIDEO_UPDATE_SCANLINE) != 0 || !m_scanline_cb.isunset())
 		m_scanline_timer = timer_alloc(FUNC(screen_device::scanline_tick), this);
 
+	// allocate a timer to present the screen in slices as it's drawn
+	m_slice_count = machine().options().beam_racing();
+	if ((m_slice_count > 1) && (m_type == SCREEN_TYPE_RASTER) && !(m_video_attributes & (VIDEO_VARIABLE_WIDTH | VIDEO_SELF_RENDER)) && (screen_device_enumerator(machine().root_device()).count() == 1))
+		m_slice_timer = timer_alloc(FUNC(screen_device::slice_tick), this);
+	else
+		m_slice_count = 0;
+
 	// configure the screen with the default parameters
 	configure(m_width, m_height, m_visarea, m_refresh);
 
@@ -915,6 +1004,11 @@ void screen_device::device_stop()
 	machine().render().texture_free(m_texture[1]);
 	if (m_burnin.valid())
 		finalize_burnin();
+	if (m_band_queue != nullptr)
+	{
+		osd_work_queue_free(m_band_queue);
+		m_band_queue = nullptr;
+	}
 }
 
 
@@ -941,6 +1035,13 @@ TIMER_CALLBACK_MEMBER(screen_device::first_scanline_tick)
 	{
 		pre_update_scanline(0);
 	}
+
+	// start presenting slices of the new frame
+	if (m_slice_timer)
+	{
+		m_slice_copied = m_visarea.top();
+		m_slice_timer->adjust(time_until_pos(slice_line(1)), 1);
+	}
 }
 
 TIMER_CALLBACK_MEMBER(screen_device::scanline_tick)
@@ -965,6 +1066,48 @@ TIMER_CALLBACK_MEMBER(screen_device::scanline_tick)
 	m_scanline_timer->adjust(time_until_pos(param), param);
 }
 
+TIMER_CALLBACK_MEMBER(screen_device::slice_tick)
+{
+	// draw everything above this slice boundary and show it
+	int const line = slice_line(param);
+	update_partial(line - 1);
+	present_slice(line);
+
+	// the last slice is presented along with the rest of the frame at VBLANK
+	if (++param < m_slice_count)
+		m_slice_timer->adjust(time_until_pos(slice_line(param)), param);
+}
+
+
+//-------------------------------------------------
+//  present_slice - copy the scanlines drawn so
+//  far this frame over the displayed frame and
+//  present it; the host is expected to scan out
+//  just behind, so the tear falls where the
+//  frames already agree
+//-------------------------------------------------
+
+void screen_device::present_slice(int line)
+{
+	if (!m_changed || (line <= m_slice_copied) || machine().video().skip_this_frame() || !machine().render().is_live(*this) || !machine().video().beam_racing(*this))
+		return;
+
+	rectangle const rows(m_visarea.left(), m_visarea.right(), m_slice_copied, line - 1);
+	screen_bitmap &source = m_bitmap[m_curbitmap];
+	screen_bitmap &dest = m_bitmap[m_curtexture];
+	switch (source.format())
+	{
+		case BITMAP_FORMAT_IND16:   copybitmap(dest.as_ind16(), source.as_ind16(), 0, 0, 0, 0, rows);   break;
+		case BITMAP_FORMAT_RGB32:   copybitmap(dest.as_rgb32(), source.as_rgb32(), 0, 0, 0, 0, rows);   break;
+		default:                    return;
+	}
+	m_slice_copied = line;
+
+	// setting the same bitmap again invalidates any scaled copies
+	m_texture[m_curtexture]->set_bitmap(dest, m_visarea, dest.texformat());
+	machine().video().present_slice();
+}
+
 
 //-------------------------------------------------
 //  configure - configure screen parameters
@@ -1185,6 +1328,7 @@ bool screen_device::update_partial(int scanline)
 	u32 flags = 0;
 	{
 		auto profile = g_profiler.start(PROFILER_VIDEO);
+		auto trace = g_tracer.begin("screen update");
 		if (m_video_attributes & VIDEO_VARIABLE_WIDTH)
 		{
 			rectangle scan_clip(clip);
@@ -1206,7 +1350,15 @@ bool screen_device::update_partial(int scanline)
 		}
 		else
 		{
-			if (m_type != SCREEN_TYPE_SVG)
+			if (m_type == SCREEN_TYPE_SVG)
+			{
+				flags = m_svg->render(*this, m_bitmap[m_curbitmap].as_rgb32(), clip);
+			}
+			else if (m_band_queue != nullptr && clip.height() >= 2 * BAND_MIN_HEIGHT)
+			{
+				flags = update_bands(clip);
+			}
+			else
 			{
 				screen_bitmap &curbitmap = m_bitmap[m_curbitmap];
 				switch (curbitmap.format())
@@ -1216,10 +1368,6 @@ bool screen_device::update_partial(int scanline)
 					case BITMAP_FORMAT_RGB32:   flags = m_screen_update_rgb32(*this, curbitmap.as_rgb32(), clip);   break;
 				}
 			}
-			else
-			{
-				flags = m_svg->render(*this, m_bitmap[m_curbitmap].as_rgb32(), clip);
-			}
 			m_partial_updates_this_frame++;
 		}
 		// stop profiling
@@ -1235,6 +1383,58 @@ bool screen_device::update_partial(int scanline)
 }
 
 
+//-------------------------------------------------
+//  update_bands - split a partial update into
+//  horizontal bands and render them in parallel
+//-------------------------------------------------
+
+u32 screen_device::update_bands(const rectangle &clip)
+{
+	// split into roughly equal bands, no smaller than the minimum height
+	int const numbands = std::min<int>(std::min<int>(m_band_count, WORK_MAX_THREADS), clip.height() / BAND_MIN_HEIGHT);
+	band_work bands[WORK_MAX_THREADS];
+	int top = clip.top();
+	for (int bandnum = 0; bandnum < numbands; bandnum++)
+	{
+		int const bottom = clip.top() + (clip.height() * (bandnum + 1)) / numbands - 1;
+		bands[bandnum].m_screen = this;
+		bands[bandnum].m_clip.set(clip.left(), clip.right(), top, bottom);
+		bands[bandnum].m_flags = 0;
+		top = bottom + 1;
+	}
+
+	// queue them all and wait; the waiting thread helps with the work
+	osd_work_item_queue_multiple(m_band_queue, band_update_callback, numbands, bands, sizeof(bands[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+	while (!osd_work_queue_wait(m_band_queue, osd_ticks_per_second() * 10)) { }
+
+	// the update has only not changed if no band changed
+	u32 flags = UPDATE_HAS_NOT_CHANGED;
+	for (int bandnum = 0; bandnum < numbands; bandnum++)
+		flags &= bands[bandnum].m_flags;
+	return flags;
+}
+
+
+//-------------------------------------------------
+//  band_update_callback - render a single band
+//  of a parallel update
+//-------------------------------------------------
+
+void *screen_device::band_update_callback(void *param, int threadid)
+{
+	band_work &band = *reinterpret_cast<band_work *>(param);
+	screen_device &screen = *band.m_screen;
+	screen_bitmap &curbitmap = screen.m_bitmap[screen.m_curbitmap];
+	switch (curbitmap.format())
+	{
+		default:
+		case BITMAP_FORMAT_IND16:   band.m_flags = screen.m_screen_update_ind16(screen, curbitmap.as_ind16(), band.m_clip);   break;
+		case BITMAP_FORMAT_RGB32:   band.m_flags = screen.m_screen_update_rgb32(screen, curbitmap.as_rgb32(), band.m_clip);   break;
+	}
+	return nullptr;
+}
+
+
 //-------------------------------------------------
 //  update_now - perform an update from the last
 //  beam position up to the current beam position
@@ -1296,6 +1496,7 @@ void screen_device::update_now()
 			if (!clip.empty())
 			{
 				auto profile = g_profiler.start(PROFILER_VIDEO);
+				auto trace = g_tracer.begin("screen update");
 
 				u32 flags = 0;
 				screen_bitmap &curbitmap = m_bitmap[m_curbitmap];
@@ -1348,6 +1549,7 @@ void screen_device::update_now()
 		if (!clip.empty())
 		{
 			auto profile = g_profiler.start(PROFILER_VIDEO);
+			auto trace = g_tracer.begin("screen update");
 
 			LOG_PARTIAL_UPDATES(("doing scanline partial draw: Y %d X %d-%d\n", clip.bottom(), clip.left(), clip.right()));
 
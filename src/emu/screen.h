@@ -60,6 +60,11 @@ constexpr u32 UPDATE_HAS_NOT_CHANGED = 0x0001;   // the video has not changed
  @def VIDEO_VARIABLE_WIDTH
  causes the screen to construct its final bitmap from a composite upscale of individual scanline bitmaps
 
+ @def VIDEO_UPDATE_BANDS
+ declares that the screen update callback may be called concurrently for disjoint cliprects, allowing
+ partial updates to be split into horizontal bands rendered on worker threads; the callback must not
+ modify shared state (including lazily updating tilemaps or other caches) or touch pixels outside its cliprect
+
  @}
  */
 
@@ -70,6 +75,7 @@ constexpr u32 VIDEO_SELF_RENDER             = 0x0008;
 constexpr u32 VIDEO_ALWAYS_UPDATE           = 0x0080;
 constexpr u32 VIDEO_UPDATE_SCANLINE         = 0x0100;
 constexpr u32 VIDEO_VARIABLE_WIDTH          = 0x0200;
+constexpr u32 VIDEO_UPDATE_BANDS            = 0x0400;
 
 
 //**************************************************************************
@@ -440,6 +446,9 @@ private:
 	TIMER_CALLBACK_MEMBER(vblank_end);
 	TIMER_CALLBACK_MEMBER(first_scanline_tick);
 	TIMER_CALLBACK_MEMBER(scanline_tick);
+	TIMER_CALLBACK_MEMBER(slice_tick);
+	int slice_line(int slice) const { return m_visarea.top() + (m_visarea.height() * slice / m_slice_count); }
+	void present_slice(int line);
 	void finalize_burnin();
 	void load_effect_overlay(const char *filename);
 	void update_scan_bitmap_size(int y);
@@ -447,6 +456,19 @@ private:
 	void create_composited_bitmap();
 	void destroy_scan_bitmaps();
 	void allocate_scan_bitmaps();
+	u32 update_bands(const rectangle &clip);
+	static void *band_update_callback(void *param, int threadid);
+
+	// minimum number of scanlines in a band of a parallel screen update
+	static constexpr int BAND_MIN_HEIGHT = 16;
+
+	// a single band of a parallel screen update
+	struct band_work
+	{
+		screen_device *     m_screen;                   // owning screen
+		rectangle           m_clip;                     // cliprect for this band
+		u32                 m_flags;                    // flags returned by the update callback
+	};
 
 	// inline configuration data
 	screen_type_enum    m_type;                     // type of screen
@@ -503,8 +525,13 @@ private:
 	emu_timer *         m_vblank_end_timer;         // timer to signal VBLANK end
 	emu_timer *         m_scanline0_timer;          // scanline 0 timer
 	emu_timer *         m_scanline_timer;           // scanline timer
+	emu_timer *         m_slice_timer;              // beam racing slice timer
+	int                 m_slice_count;              // slices to present per frame when beam racing
+	s32                 m_slice_copied;             // first scanline not yet copied to the displayed bitmap
 	u64                 m_frame_number;             // the current frame number
 	u32                 m_partial_updates_this_frame;// partial update counter this frame
+	osd_work_queue *    m_band_queue;               // work queue for banded updates
+	int                 m_band_count;               // maximum number of bands to split updates into
 
 	bool                m_is_primary_screen;
 
@@ -282,15 +282,22 @@ softlist_parser::softlist_parser(
 	XML_SetElementHandler(m_parser, &softlist_parser::start_handler, &softlist_parser::end_handler);
 	XML_SetCharacterDataHandler(m_parser, &softlist_parser::data_handler);
 
-	// parse the file contents
-	char buffer[1024];
+	// parse the file contents - some lists are tens of megabytes, so read
+	// large chunks directly into the parser's buffer
+	constexpr size_t CHUNK_SIZE = 64 * 1024;
 	for (bool done = false; !done; )
 	{
+		void *const buffer = XML_GetBuffer(m_parser, CHUNK_SIZE);
+		if (!buffer)
+		{
+			parse_error("%s", parser_error());
+			break;
+		}
 		size_t length;
-		file.read(buffer, sizeof(buffer), length); // TODO: better error handling
+		file.read(buffer, CHUNK_SIZE, length); // TODO: better error handling
 		if (!length)
 			done = true;
-		if (XML_Parse(m_parser, buffer, length, done) == XML_STATUS_ERROR)
+		if (XML_ParseBuffer(m_parser, int(length), done) == XML_STATUS_ERROR)
 		{
 			parse_error("%s", parser_error());
 			break;
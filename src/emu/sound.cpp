@@ -15,11 +15,20 @@
 #include "main.h"
 #include "speaker.h"
 
+#include "video/simd.h"
+
 #include "wavwrite.h"
 #include "xmlfile.h"
 
+#include "lrucache.h"
+
 #include "osdepend.h"
 
+#include <cmath>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
 
 //**************************************************************************
 //  DEBUGGING
@@ -349,6 +358,83 @@ void stream_buffer::backfill_upsample(sample_t const *src, int samples, attotime
 
 
 
+//**************************************************************************
+//  READ STREAM VIEW
+//**************************************************************************
+
+namespace {
+
+//-------------------------------------------------
+//  scale_samples - store or accumulate a run of
+//  samples multiplied by a gain
+//-------------------------------------------------
+
+template <bool Add>
+inline void scale_samples(float *dest, float const *src, float gain, s32 count)
+{
+	s32 index = 0;
+#if defined(MAME_SIMD_SSE2)
+	__m128 const scale = _mm_set1_ps(gain);
+	for ( ; index + 4 <= count; index += 4)
+	{
+		__m128 value = _mm_mul_ps(_mm_loadu_ps(&src[index]), scale);
+		if (Add)
+			value = _mm_add_ps(_mm_loadu_ps(&dest[index]), value);
+		_mm_storeu_ps(&dest[index], value);
+	}
+#elif defined(MAME_SIMD_NEON)
+	float32x4_t const scale = vdupq_n_f32(gain);
+	for ( ; index + 4 <= count; index += 4)
+	{
+		float32x4_t value = vmulq_f32(vld1q_f32(&src[index]), scale);
+		if (Add)
+			value = vaddq_f32(vld1q_f32(&dest[index]), value);
+		vst1q_f32(&dest[index], value);
+	}
+#endif
+	for ( ; index < count; index++)
+	{
+		float const value = src[index] * gain;
+		dest[index] = Add ? (dest[index] + value) : value;
+	}
+}
+
+} // anonymous namespace
+
+
+//-------------------------------------------------
+//  copy_to - store gain-scaled samples from the
+//  view into a native buffer
+//-------------------------------------------------
+
+void read_stream_view::copy_to(sample_t *dest, s32 count) const
+{
+	sound_assert(u32(count) <= samples());
+
+	// the view may wrap around the end of the buffer
+	s32 const first = std::min<s32>(count, m_buffer->size() - m_start);
+	scale_samples<false>(dest, &m_buffer->m_buffer[m_start], m_gain, first);
+	scale_samples<false>(dest + first, &m_buffer->m_buffer[0], m_gain, count - first);
+}
+
+
+//-------------------------------------------------
+//  add_to - accumulate gain-scaled samples from
+//  the view into a native buffer
+//-------------------------------------------------
+
+void read_stream_view::add_to(sample_t *dest, s32 count) const
+{
+	sound_assert(u32(count) <= samples());
+
+	// the view may wrap around the end of the buffer
+	s32 const first = std::min<s32>(count, m_buffer->size() - m_start);
+	scale_samples<true>(dest, &m_buffer->m_buffer[m_start], m_gain, first);
+	scale_samples<true>(dest + first, &m_buffer->m_buffer[0], m_gain, count - first);
+}
+
+
+
 //**************************************************************************
 //  SOUND STREAM OUTPUT
 //**************************************************************************
@@ -385,7 +471,7 @@ void sound_stream_output::init(sound_stream &stream, u32 index, char const *tag)
 	for (int index = 0; index < filename.size(); index++)
 		if (filename[index] == ':')
 			filename[index] = '_';
-	if (dynamic_cast<default_resampler_stream *>(&stream) != nullptr)
+	if (dynamic_cast<default_resampler_stream *>(&stream) != nullptr || dynamic_cast<polyphase_resampler_stream *>(&stream) != nullptr)
 		filename += "_resampler";
 	filename += "_OUT_";
 	char buf[10];
@@ -596,7 +682,10 @@ sound_stream::sound_stream(device_t &device, u32 inputs, u32 outputs, u32 output
 		sound_stream_output *resampler = nullptr;
 		if (!m_resampling_disabled)
 		{
-			m_resampler_list.push_back(std::make_unique<default_resampler_stream>(m_device));
+			if (m_device.machine().options().hq_resampler())
+				m_resampler_list.push_back(std::make_unique<polyphase_resampler_stream>(m_device));
+			else
+				m_resampler_list.push_back(std::make_unique<default_resampler_stream>(m_device));
 			resampler = &m_resampler_list.back()->m_output[0];
 		}
 
@@ -671,6 +760,9 @@ void sound_stream::set_input(int index, sound_stream *input_stream, int output_i
 	m_input[index].set_source((input_stream != nullptr) ? &input_stream->m_output[output_index] : nullptr);
 	m_input[index].set_gain(gain);
 
+	// the parallel update groups need to be worked out again
+	m_device.machine().sound().m_stream_groups_valid = false;
+
 	// update sample rates now that we know the input
 	sample_rate_changed();
 }
@@ -1065,10 +1157,410 @@ void default_resampler_stream::resampler_sound_update(sound_stream &stream, std:
 
 
 
+//**************************************************************************
+//  POLYPHASE RESAMPLER STREAM
+//**************************************************************************
+
+namespace {
+
+//-------------------------------------------------
+//  fir_dot - compute the dot product of a run of
+//  samples with a set of filter coefficients;
+//  count must be a multiple of 4
+//-------------------------------------------------
+
+inline float fir_dot(float const *samples, float const *coeffs, u32 count)
+{
+#if defined(MAME_SIMD_SSE2)
+	__m128 sum0 = _mm_setzero_ps();
+	__m128 sum1 = _mm_setzero_ps();
+	u32 index = 0;
+	for ( ; index + 8 <= count; index += 8)
+	{
+		sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_loadu_ps(&samples[index]), _mm_loadu_ps(&coeffs[index])));
+		sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_loadu_ps(&samples[index + 4]), _mm_loadu_ps(&coeffs[index + 4])));
+	}
+	if (index < count)
+		sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_loadu_ps(&samples[index]), _mm_loadu_ps(&coeffs[index])));
+	sum0 = _mm_add_ps(sum0, sum1);
+	sum0 = _mm_add_ps(sum0, _mm_movehl_ps(sum0, sum0));
+	sum0 = _mm_add_ss(sum0, _mm_shuffle_ps(sum0, sum0, 1));
+	return _mm_cvtss_f32(sum0);
+#elif defined(MAME_SIMD_NEON)
+	float32x4_t sum = vdupq_n_f32(0.0f);
+	for (u32 index = 0; index < count; index += 4)
+		sum = vmlaq_f32(sum, vld1q_f32(&samples[index]), vld1q_f32(&coeffs[index]));
+	float32x2_t const half = vadd_f32(vget_low_f32(sum), vget_high_f32(sum));
+	return vget_lane_f32(vpadd_f32(half, half), 0);
+#else
+	float sum = 0.0f;
+	for (u32 index = 0; index < count; index++)
+		sum += samples[index] * coeffs[index];
+	return sum;
+#endif
+}
+
+} // anonymous namespace
+
+
+//-------------------------------------------------
+//  filter_cache - builds the resampler filter
+//  banks in the background and keeps the most
+//  recently used ones
+//-------------------------------------------------
+
+class polyphase_resampler_stream::filter_cache
+{
+public:
+	filter_cache();
+	~filter_cache();
+
+	// the bank for a rate pair, or nullptr if it's still being built
+	std::shared_ptr<filter_bank const> find(u32 inrate, u32 outrate);
+
+	// a small bank for use until the right one is ready
+	std::shared_ptr<filter_bank const> const &fallback() const { return m_fallback; }
+
+private:
+	// downsampling ratios are rounded up to this fraction, so nearby rates share a bank
+	static constexpr u32 RATIO_STEPS = 32;
+
+	// limits on the bank size
+	static constexpr u32 MAX_PHASES = 256;
+	static constexpr u32 MIN_PHASES = 32;
+	static constexpr u32 MAX_HALF_TAPS = 4096;
+	static constexpr size_t MAX_BANKS = 8;
+
+	struct build_job
+	{
+		filter_cache *cache;
+		u32 key;
+	};
+
+	static std::shared_ptr<filter_bank const> build(u32 key);
+	static void *build_callback(void *param, int threadid);
+
+	std::mutex m_lock;
+	util::lru_cache_map<u32, std::shared_ptr<filter_bank const> > m_banks;
+	std::vector<u32> m_building;
+	std::shared_ptr<filter_bank const> const m_fallback;
+	osd_work_queue *m_queue;
+};
+
+
+polyphase_resampler_stream::filter_cache::filter_cache() :
+	m_banks(MAX_BANKS),
+	m_fallback(build(RATIO_STEPS)),
+	m_queue(nullptr)
+{
+}
+
+
+polyphase_resampler_stream::filter_cache::~filter_cache()
+{
+	if (m_queue)
+	{
+		while (!osd_work_queue_wait(m_queue, osd_ticks_per_second())) { }
+		osd_work_queue_free(m_queue);
+	}
+}
+
+
+std::shared_ptr<polyphase_resampler_stream::filter_bank const> polyphase_resampler_stream::filter_cache::find(u32 inrate, u32 outrate)
+{
+	// all upsampling ratios use the same bank
+	u32 const key = std::max<u32>(RATIO_STEPS, u32(std::ceil(double(inrate) * double(RATIO_STEPS) / double(outrate))));
+	if (key == RATIO_STEPS)
+		return m_fallback;
+
+	std::lock_guard<std::mutex> guard(m_lock);
+	auto const found = m_banks.find(key);
+	if (m_banks.end() != found)
+		return found->second;
+
+	// queue it to be built unless that's already happening
+	if (std::find(m_building.begin(), m_building.end(), key) == m_building.end())
+	{
+		if (!m_queue)
+			m_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
+		if (m_queue && osd_work_item_queue(m_queue, &filter_cache::build_callback, new build_job{ this, key }, WORK_ITEM_FLAG_AUTO_RELEASE))
+		{
+			m_building.emplace_back(key);
+		}
+		else
+		{
+			// no worker available, so there's no choice but to build it now
+			auto bank = build(key);
+			m_banks.emplace(key, bank);
+			return bank;
+		}
+	}
+	return nullptr;
+}
+
+
+void *polyphase_resampler_stream::filter_cache::build_callback(void *param, int threadid)
+{
+	std::unique_ptr<build_job> const job(reinterpret_cast<build_job *>(param));
+	auto bank = build(job->key);
+
+	filter_cache &cache = *job->cache;
+	std::lock_guard<std::mutex> guard(cache.m_lock);
+	cache.m_banks.emplace(job->key, std::move(bank));
+	cache.m_building.erase(std::find(cache.m_building.begin(), cache.m_building.end(), job->key));
+	return nullptr;
+}
+
+
+std::shared_ptr<polyphase_resampler_stream::filter_bank const> polyphase_resampler_stream::filter_cache::build(u32 key)
+{
+	// when downsampling the filter is stretched so its cutoff lands below the output
+	// Nyquist frequency, and it needs proportionally more taps; a wider filter is
+	// smoother between input samples, so it needs fewer phases
+	double const scale = double(key) / double(RATIO_STEPS);
+	double const cutoff = 0.91 / scale;
+	u32 const halftaps = std::min<u32>(MAX_HALF_TAPS, (u32(std::ceil(8.0 * scale)) + 1) & ~1);
+
+	auto bank = std::make_shared<filter_bank>();
+	bank->taps = halftaps * 2;
+	bank->phases = std::clamp<u32>(MAX_PHASES * 8 / halftaps, MIN_PHASES, MAX_PHASES);
+	bank->coeffs.resize((bank->phases + 1) * bank->taps);
+
+	// each row holds a Blackman-windowed sinc sampled at one fractional offset
+	for (u32 phase = 0; phase <= bank->phases; phase++)
+	{
+		float *const row = &bank->coeffs[phase * bank->taps];
+		double sum = 0.0;
+		for (u32 tap = 0; tap < bank->taps; tap++)
+		{
+			double const x = double(phase) / double(bank->phases) + double(halftaps) - 1.0 - double(tap);
+			double const u = x / double(halftaps);
+			double value = 0.0;
+			if (std::abs(u) < 1.0)
+			{
+				double const window = 0.42 + 0.5 * std::cos(M_PI * u) + 0.08 * std::cos(2.0 * M_PI * u);
+				double const arg = M_PI * cutoff * x;
+				value = cutoff * window * ((arg == 0.0) ? 1.0 : (std::sin(arg) / arg));
+			}
+			row[tap] = float(value);
+			sum += value;
+		}
+
+		// normalize each phase to unity gain at DC
+		for (u32 tap = 0; tap < bank->taps; tap++)
+			row[tap] = float(row[tap] / sum);
+	}
+
+	return bank;
+}
+
+
+//-------------------------------------------------
+//  polyphase_resampler_stream - derived
+//  sound_stream class that resamples through a
+//  bank of windowed-sinc FIR filters
+//-------------------------------------------------
+
+polyphase_resampler_stream::polyphase_resampler_stream(device_t &device) :
+	sound_stream(device, 1, 1, 0, SAMPLE_RATE_OUTPUT_ADAPTIVE, stream_update_delegate(&polyphase_resampler_stream::resampler_sound_update, this), STREAM_DISABLE_INPUT_RESAMPLING),
+	m_filter_inrate(0),
+	m_filter_outrate(0),
+	m_max_latency(0)
+{
+	// create a name
+	m_name = "Polyphase Resampler '";
+	m_name += device.tag();
+	m_name += "'";
+}
+
+
+//-------------------------------------------------
+//  resampler_sound_update - stream callback
+//  handler for resampling an input stream to the
+//  target sample rate of the output
+//-------------------------------------------------
+
+void polyphase_resampler_stream::resampler_sound_update(sound_stream &stream, std::vector<read_stream_view> const &inputs, std::vector<write_stream_view> &outputs)
+{
+	sound_assert(inputs.size() == 1);
+	sound_assert(outputs.size() == 1);
+
+	auto &input = inputs[0];
+	auto &output = outputs[0];
+
+	// if the input has an invalid rate, just fill with zeros
+	if (input.sample_rate() <= 1)
+	{
+		output.fill(0);
+		return;
+	}
+
+	// optimize_resampler ensures we should not have equal sample rates
+	sound_assert(input.sample_rate() != output.sample_rate());
+
+	// pick up a new filter bank if the rates have changed; while it's being built,
+	// carry on with the old one
+	if (m_filter_inrate != input.sample_rate() || m_filter_outrate != output.sample_rate())
+	{
+		filter_cache &cache = device().machine().sound().resampler_filters();
+		auto bank = cache.find(input.sample_rate(), output.sample_rate());
+		if (bank)
+		{
+			m_filter = std::move(bank);
+			m_filter_inrate = input.sample_rate();
+			m_filter_outrate = output.sample_rate();
+		}
+		else if (!m_filter)
+		{
+			m_filter = cache.fallback();
+		}
+	}
+	filter_bank const &filter = *m_filter;
+	u32 const halftaps = filter.taps / 2;
+
+	// the filter is centred, so each output sample is delayed by half the taps plus one
+	// input sample; the view must also reach back by another half the taps
+	u32 latency_samples = halftaps + 1;
+	if (latency_samples <= m_max_latency)
+		latency_samples = m_max_latency;
+	else
+		m_max_latency = latency_samples;
+	attotime const history = (latency_samples + halftaps) * input.sample_period();
+
+	// clamp the latency to the start (only relevant at the beginning)
+	s32 dstindex = 0;
+	attotime output_start = output.start_time();
+	auto numsamples = output.samples();
+	while (history > output_start && dstindex < numsamples)
+	{
+		output.put(dstindex++, 0);
+		output_start += output.sample_period();
+	}
+	if (dstindex >= numsamples)
+		return;
+
+	// create a rebased input buffer around the adjusted start time, and copy it
+	// into a contiguous, zero-padded buffer for the filter
+	read_stream_view rebased(input, output_start - history);
+	s32 const available = rebased.samples();
+	m_history.resize(available + filter.taps);
+	for (s32 index = 0; index < available; index++)
+		m_history[index] = rebased.get(index);
+	std::fill(m_history.begin() + available, m_history.end(), 0.0f);
+
+	// compute the filter centre for the first output sample, in input samples
+	double const step = double(input.sample_rate()) / double(output.sample_rate());
+	double srcpos = (output_start - rebased.start_time()).as_double() * double(input.sample_rate()) - double(latency_samples);
+
+	for ( ; dstindex < numsamples; dstindex++, srcpos += step)
+	{
+		s32 const whole = s32(srcpos);
+		u32 const phase = u32((srcpos - double(whole)) * double(filter.phases) + 0.5);
+		s32 const first = whole - s32(halftaps) + 1;
+		sound_assert(first >= 0 && first + filter.taps <= m_history.size());
+		output.put(dstindex, fir_dot(&m_history[first], &filter.coeffs[phase * filter.taps], filter.taps));
+	}
+}
+
+
+
 //**************************************************************************
 //  SOUND MANAGER
 //**************************************************************************
 
+//-------------------------------------------------
+//  update_stream_groups - partition the speaker
+//  streams into groups that share no upstream
+//  streams, and so can be updated concurrently
+//-------------------------------------------------
+
+void sound_manager::update_stream_groups()
+{
+	// the stream graph only changes when streams are allocated or rewired
+	if (m_stream_groups_valid)
+		return;
+	m_stream_groups_valid = true;
+
+	// find the representative stream for a group, compressing paths as we go
+	auto find = [this] (sound_stream *stream)
+	{
+		auto iter = m_stream_group_parent.try_emplace(stream, stream).first;
+		while (iter->second != iter->first)
+		{
+			auto parent = m_stream_group_parent.find(iter->second);
+			iter->second = parent->second;
+			iter = parent;
+		}
+		return iter->first;
+	};
+
+	auto unite = [this, &find] (sound_stream *a, sound_stream *b)
+	{
+		a = find(a);
+		b = find(b);
+		if (a != b)
+			m_stream_group_parent[a] = b;
+	};
+
+	// streams belonging to the same device share its state, so they must be updated
+	// on the same thread even if they aren't connected
+	std::unordered_map<device_t *, sound_stream *> owners;
+	auto unite_owner = [&owners, &unite] (sound_stream *stream)
+	{
+		auto const ins = owners.emplace(&stream->device(), stream);
+		if (!ins.second)
+			unite(stream, ins.first->second);
+	};
+
+	// union every stream with its sources and its device's other streams; resamplers
+	// share their owner's source, so they always end up in the same group as every
+	// stream that uses them
+	m_stream_group_parent.clear();
+	for (auto &stream : m_stream_list)
+	{
+		unite_owner(stream.get());
+		for (unsigned int inputnum = 0; inputnum < stream->input_count(); inputnum++)
+		{
+			sound_stream_input &input = stream->input(inputnum);
+			if (input.valid())
+			{
+				unite_owner(&input.source().stream());
+				unite(stream.get(), &input.source().stream());
+			}
+		}
+	}
+
+	// gather the speaker streams by group
+	std::map<sound_stream *, unsigned> groupindex;
+	for (auto &group : m_stream_groups)
+		group.sinks.clear();
+	unsigned count = 0;
+	for (auto &stream : m_stream_list)
+		if (dynamic_cast<speaker_device *>(&stream->device()) != nullptr)
+		{
+			auto const ins = groupindex.emplace(find(stream.get()), count);
+			if (ins.second && m_stream_groups.size() <= count++)
+				m_stream_groups.emplace_back();
+			m_stream_groups[ins.first->second].sinks.push_back(stream.get());
+		}
+	m_stream_groups.resize(count);
+}
+
+
+//-------------------------------------------------
+//  stream_group_callback - bring all the streams
+//  in a group up to date
+//-------------------------------------------------
+
+void *sound_manager::stream_group_callback(void *param, int threadid)
+{
+	stream_group &group = *reinterpret_cast<stream_group *>(param);
+	for (sound_stream *stream : group.sinks)
+		stream->update_view(group.start, group.end);
+	return nullptr;
+}
+
+
 //-------------------------------------------------
 //  sound_manager - constructor
 //-------------------------------------------------
@@ -1088,10 +1580,14 @@ sound_manager::sound_manager(running_machine &machine) :
 	m_compressor_enabled(machine.options().compressor()),
 	m_muted(0),
 	m_nosound_mode(machine.osd().no_sound()),
+	m_output_suppressed(false),
 	m_attenuation(0),
 	m_unique_id(0),
 	m_wavfile(),
-	m_first_reset(true)
+	m_first_reset(true),
+	m_stream_queue(nullptr),
+	m_stream_groups_valid(false),
+	m_resampler_filters(std::make_unique<polyphase_resampler_stream::filter_cache>())
 {
 	// count the mixers
 #if VERBOSE
@@ -1115,6 +1611,10 @@ sound_manager::sound_manager(running_machine &machine) :
 	// set the starting attenuation
 	set_attenuation(machine.options().volume());
 
+	// allocate a work queue for evaluating independent streams in parallel
+	if (machine.options().parallel_sound())
+		m_stream_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+
 	// start the periodic update flushing timer
 	m_update_timer = machine.scheduler().timer_alloc(timer_expired_delegate(FUNC(sound_manager::update), this));
 	m_update_timer->adjust(STREAMS_UPDATE_ATTOTIME, 0, STREAMS_UPDATE_ATTOTIME);
@@ -1127,6 +1627,8 @@ sound_manager::sound_manager(running_machine &machine) :
 
 sound_manager::~sound_manager()
 {
+	if (m_stream_queue != nullptr)
+		osd_work_queue_free(m_stream_queue);
 }
 
 
@@ -1144,6 +1646,7 @@ sound_stream *sound_manager::stream_alloc(device_t &device, u32 inputs, u32 outp
 			output_base += stream->output_count();
 
 	m_stream_list.push_back(std::make_unique<sound_stream>(device, inputs, outputs, output_base, sample_rate, callback, flags));
+	m_stream_groups_valid = false;
 	return m_stream_list.back().get();
 }
 
@@ -1438,6 +1941,124 @@ void sound_manager::config_save(config_type cfg_type, util::xml::data_node *pare
 }
 
 
+namespace {
+
+//-------------------------------------------------
+//  mix_peak - return the larger of curmax and the
+//  peak absolute value in a run of samples
+//-------------------------------------------------
+
+inline float mix_peak(float const *samples, int count, float curmax)
+{
+	int index = 0;
+#if defined(MAME_SIMD_SSE2)
+	__m128 const absmask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+	__m128 peak = _mm_set1_ps(curmax);
+	for ( ; index + 4 <= count; index += 4)
+		peak = _mm_max_ps(peak, _mm_and_ps(_mm_loadu_ps(&samples[index]), absmask));
+	peak = _mm_max_ps(peak, _mm_movehl_ps(peak, peak));
+	peak = _mm_max_ss(peak, _mm_shuffle_ps(peak, peak, 1));
+	curmax = _mm_cvtss_f32(peak);
+#elif defined(MAME_SIMD_NEON)
+	float32x4_t peak = vdupq_n_f32(curmax);
+	for ( ; index + 4 <= count; index += 4)
+		peak = vmaxq_f32(peak, vabsq_f32(vld1q_f32(&samples[index])));
+	float32x2_t const half = vpmax_f32(vget_low_f32(peak), vget_high_f32(peak));
+	curmax = vget_lane_f32(vpmax_f32(half, half), 0);
+#endif
+	for ( ; index < count; index++)
+	{
+		float sample = samples[index];
+		if (sample < 0)
+			sample = -sample;
+		if (sample > curmax)
+			curmax = sample;
+	}
+	return curmax;
+}
+
+
+#if defined(MAME_SIMD_SSE2)
+
+//-------------------------------------------------
+//  quantize_s32 - convert four clamped samples to
+//  integers; the multiply is done in double
+//  precision to round exactly like the scalar
+//  path
+//-------------------------------------------------
+
+inline __m128i quantize_s32(__m128 value)
+{
+	__m128d const full = _mm_set1_pd(32767.0);
+	__m128i const low = _mm_cvttpd_epi32(_mm_mul_pd(_mm_cvtps_pd(value), full));
+	__m128i const high = _mm_cvttpd_epi32(_mm_mul_pd(_mm_cvtps_pd(_mm_movehl_ps(value, value)), full));
+	return _mm_unpacklo_epi64(low, high);
+}
+
+#elif defined(MAME_SIMD_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+
+inline int16x4_t quantize_s16(float32x4_t value)
+{
+	float64x2_t const full = vdupq_n_f64(32767.0);
+	int64x2_t const low = vcvtq_s64_f64(vmulq_f64(vcvt_f64_f32(vget_low_f32(value)), full));
+	int64x2_t const high = vcvtq_s64_f64(vmulq_f64(vcvt_high_f64_f32(value), full));
+	return vmovn_s32(vcombine_s32(vmovn_s64(low), vmovn_s64(high)));
+}
+
+#endif
+
+
+//-------------------------------------------------
+//  mix_to_s16 - scale, clamp and convert the left
+//  and right mixes into interleaved 16-bit output
+//-------------------------------------------------
+
+inline void mix_to_s16(s16 *dest, float const *left, float const *right, float scale, int count)
+{
+	int index = 0;
+#if defined(MAME_SIMD_SSE2)
+	__m128 const gain = _mm_set1_ps(scale);
+	__m128 const minval = _mm_set1_ps(-1.0f);
+	__m128 const maxval = _mm_set1_ps(1.0f);
+	for ( ; index + 4 <= count; index += 4)
+	{
+		__m128i const l = quantize_s32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(&left[index]), gain), minval), maxval));
+		__m128i const r = quantize_s32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(&right[index]), gain), minval), maxval));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[index * 2]), _mm_unpacklo_epi16(_mm_packs_epi32(l, l), _mm_packs_epi32(r, r)));
+	}
+#elif defined(MAME_SIMD_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+	float32x4_t const gain = vdupq_n_f32(scale);
+	float32x4_t const minval = vdupq_n_f32(-1.0f);
+	float32x4_t const maxval = vdupq_n_f32(1.0f);
+	for ( ; index + 4 <= count; index += 4)
+	{
+		int16x4x2_t result;
+		result.val[0] = quantize_s16(vminq_f32(vmaxq_f32(vmulq_f32(vld1q_f32(&left[index]), gain), minval), maxval));
+		result.val[1] = quantize_s16(vminq_f32(vmaxq_f32(vmulq_f32(vld1q_f32(&right[index]), gain), minval), maxval));
+		vst2_s16(&dest[index * 2], result);
+	}
+#endif
+	for ( ; index < count; index++)
+	{
+		float lsamp = left[index] * scale;
+		if (lsamp > 1.0)
+			lsamp = 1.0;
+		else if (lsamp < -1.0)
+			lsamp = -1.0;
+		dest[index * 2 + 0] = s16(lsamp * 32767.0);
+
+		float rsamp = right[index] * scale;
+		if (rsamp > 1.0)
+			rsamp = 1.0;
+		else if (rsamp < -1.0)
+			rsamp = -1.0;
+		dest[index * 2 + 1] = s16(rsamp * 32767.0);
+	}
+}
+
+} // anonymous namespace
+
+
 //-------------------------------------------------
 //  adjust_toward_compressor_scale - adjust the
 //  current scale factor toward the current goal,
@@ -1487,6 +2108,7 @@ void sound_manager::update(int param)
 	LOG("sound_update\n");
 
 	auto profile = g_profiler.start(PROFILER_SOUND);
+	auto trace = g_tracer.begin("sound update");
 
 	// determine the duration of this update
 	attotime update_period = machine().time() - m_last_update;
@@ -1499,31 +2121,49 @@ void sound_manager::update(int param)
 	// recompute the end time to an even sample boundary
 	attotime endtime = m_last_update + attotime(0, m_samples_this_update * sample_rate_attos);
 
-	// clear out the mix bufers
-	std::fill_n(&m_leftmix[0], m_samples_this_update, 0);
-	std::fill_n(&m_rightmix[0], m_samples_this_update, 0);
+	// if enabled, bring independent groups of streams up to date in parallel first
+	if (m_stream_queue != nullptr)
+	{
+		update_stream_groups();
+		if (m_stream_groups.size() > 1)
+		{
+			for (stream_group &group : m_stream_groups)
+			{
+				group.start = m_last_update;
+				group.end = endtime;
+			}
+			osd_work_item_queue_multiple(m_stream_queue, stream_group_callback, m_stream_groups.size(), &m_stream_groups[0], sizeof(m_stream_groups[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+			while (!osd_work_queue_wait(m_stream_queue, osd_ticks_per_second() * 10)) { }
+		}
+	}
 
-	// force all the speaker streams to generate the proper number of samples
+	// force all the speaker streams to generate the proper number of samples; the
+	// first speaker on each side stores directly, so only a silent side needs clearing
+	bool leftvalid = false, rightvalid = false;
 	for (speaker_device &speaker : m_speakers)
-		speaker.mix(&m_leftmix[0], &m_rightmix[0], m_last_update, endtime, m_samples_this_update, (m_muted & MUTE_REASON_SYSTEM));
-
-	// determine the maximum in this section
-	stream_buffer::sample_t curmax = 0;
-	for (int sampindex = 0; sampindex < m_samples_this_update; sampindex++)
+		speaker.mix(&m_leftmix[0], &m_rightmix[0], leftvalid, rightvalid, m_last_update, endtime, m_samples_this_update, (m_muted & MUTE_REASON_SYSTEM));
+	if (!leftvalid)
+		std::fill_n(&m_leftmix[0], m_samples_this_update, 0);
+	if (!rightvalid)
+		std::fill_n(&m_rightmix[0], m_samples_this_update, 0);
+
+	// audio for frames run ahead is discarded; skip the compressor and final mix
+	// so their state continues from the last frame that was actually played;
+	// turbo mode doesn't play audio either, unless it's being recorded
+	if (m_output_suppressed || (machine().video().turbo() && !m_wavfile && !machine().video().is_recording()))
 	{
-		auto sample = m_leftmix[sampindex];
-		if (sample < 0)
-			sample = -sample;
-		if (sample > curmax)
-			curmax = sample;
-
-		sample = m_rightmix[sampindex];
-		if (sample < 0)
-			sample = -sample;
-		if (sample > curmax)
-			curmax = sample;
+		for (auto &stream : m_orphan_stream_list)
+			stream.first->update();
+		m_last_update = endtime;
+		m_update_number++;
+		apply_sample_rate_changes();
+		return;
 	}
 
+	// determine the maximum in this section
+	stream_buffer::sample_t curmax = mix_peak(&m_leftmix[0], m_samples_this_update, 0);
+	curmax = mix_peak(&m_rightmix[0], m_samples_this_update, curmax);
+
 	// pull in current compressor scale factor before modifying
 	stream_buffer::sample_t lscale = m_compressor_scale;
 	stream_buffer::sample_t rscale = m_compressor_scale;
@@ -1559,42 +2199,59 @@ void sound_manager::update(int param)
 	u32 finalmix_step = machine().video().speed_factor();
 	u32 finalmix_offset = 0;
 	s16 *finalmix = &m_finalmix[0];
-	int sample;
-	for (sample = m_finalmix_leftover; sample < m_samples_this_update * 1000; sample += finalmix_step)
-	{
-		int sampindex = sample / 1000;
-
-		// ensure that changing the compression won't reverse direction to reduce "pops"
-		stream_buffer::sample_t lsamp = m_leftmix[sampindex];
-		if (lscale != m_compressor_scale && sample != m_finalmix_leftover)
-			lscale = adjust_toward_compressor_scale(lscale, lprev, lsamp);
+	int sample = m_finalmix_leftover;
 
-		lprev = lsamp * lscale;
-		if (m_compressor_enabled)
-			lsamp = lprev;
-
-		// clamp the left side
-		if (lsamp > 1.0)
-			lsamp = 1.0;
-		else if (lsamp < -1.0)
-			lsamp = -1.0;
-		finalmix[finalmix_offset++] = s16(lsamp * 32767.0);
-
-		// ensure that changing the compression won't reverse direction to reduce "pops"
-		stream_buffer::sample_t rsamp = m_rightmix[sampindex];
-		if (rscale != m_compressor_scale && sample != m_finalmix_leftover)
-			rscale = adjust_toward_compressor_scale(rscale, rprev, rsamp);
-
-		rprev = rsamp * rscale;
-		if (m_compressor_enabled)
-			rsamp = rprev;
-
-		// clamp the right side
-		if (rsamp > 1.0)
-			rsamp = 1.0;
-		else if (rsamp < -1.0)
-			rsamp = -1.0;
-		finalmix[finalmix_offset++] = s16(rsamp * 32767.0);
+	// at normal speed with the compressor settled, every sample is converted the same way
+	if (finalmix_step == 1000 && lscale == m_compressor_scale && rscale == m_compressor_scale)
+	{
+		int const first = sample / 1000;
+		if (first < m_samples_this_update)
+		{
+			int const count = m_samples_this_update - first;
+			mix_to_s16(finalmix, &m_leftmix[first], &m_rightmix[first], m_compressor_enabled ? m_compressor_scale : 1.0f, count);
+			finalmix_offset = count * 2;
+			sample += count * 1000;
+		}
+	}
+	else
+	{
+		// otherwise step through at the current speed, easing the compressor toward its target
+		for ( ; sample < m_samples_this_update * 1000; sample += finalmix_step)
+		{
+			int sampindex = sample / 1000;
+
+			// ensure that changing the compression won't reverse direction to reduce "pops"
+			stream_buffer::sample_t lsamp = m_leftmix[sampindex];
+			if (lscale != m_compressor_scale && sample != m_finalmix_leftover)
+				lscale = adjust_toward_compressor_scale(lscale, lprev, lsamp);
+
+			lprev = lsamp * lscale;
+			if (m_compressor_enabled)
+				lsamp = lprev;
+
+			// clamp the left side
+			if (lsamp > 1.0)
+				lsamp = 1.0;
+			else if (lsamp < -1.0)
+				lsamp = -1.0;
+			finalmix[finalmix_offset++] = s16(lsamp * 32767.0);
+
+			// ensure that changing the compression won't reverse direction to reduce "pops"
+			stream_buffer::sample_t rsamp = m_rightmix[sampindex];
+			if (rscale != m_compressor_scale && sample != m_finalmix_leftover)
+				rscale = adjust_toward_compressor_scale(rscale, rprev, rsamp);
+
+			rprev = rsamp * rscale;
+			if (m_compressor_enabled)
+				rsamp = rprev;
+
+			// clamp the right side
+			if (rsamp > 1.0)
+				rsamp = 1.0;
+			else if (rsamp < -1.0)
+				rsamp = -1.0;
+			finalmix[finalmix_offset++] = s16(rsamp * 32767.0);
+		}
 	}
 	m_finalmix_leftover = sample - m_samples_this_update * 1000;
 
@@ -328,6 +328,11 @@ public:
 		return m_buffer->get(index);
 	}
 
+	// store or accumulate the first count gain-scaled samples into a
+	// native buffer
+	void copy_to(sample_t *dest, s32 count) const;
+	void add_to(sample_t *dest, s32 count) const;
+
 protected:
 	// normalize start/end
 	void normalize_start_end()
@@ -731,6 +736,38 @@ private:
 };
 
 
+// ======================> polyphase_resampler_stream
+
+class polyphase_resampler_stream : public sound_stream
+{
+public:
+	// filter banks shared by all the resamplers of a machine
+	class filter_cache;
+
+	// construction/destruction
+	polyphase_resampler_stream(device_t &device);
+
+	// update handler
+	void resampler_sound_update(sound_stream &stream, std::vector<read_stream_view> const &inputs, std::vector<write_stream_view> &outputs);
+
+private:
+	// a windowed-sinc filter bank for a quantized downsampling ratio
+	struct filter_bank
+	{
+		u32 taps;                               // taps per phase, a multiple of 4
+		u32 phases;                             // phases per input sample
+		std::vector<float> coeffs;              // (phases + 1) rows of taps coefficients
+	};
+
+	// internal state
+	std::shared_ptr<filter_bank const> m_filter; // current filter bank
+	u32 m_filter_inrate;                    // input rate the filter was built for
+	u32 m_filter_outrate;                   // output rate the filter was built for
+	u32 m_max_latency;                      // maximum latency seen, in input samples
+	std::vector<float> m_history;           // contiguous copy of the input samples
+};
+
+
 // ======================> sound_manager
 
 // structure describing an indexed mixer
@@ -764,6 +801,7 @@ public:
 	// getters
 	running_machine &machine() const { return m_machine; }
 	int attenuation() const { return m_attenuation; }
+	polyphase_resampler_stream::filter_cache &resampler_filters() const { return *m_resampler_filters; }
 	const std::vector<std::unique_ptr<sound_stream>> &streams() const { return m_stream_list; }
 	attotime last_update() const { return m_last_update; }
 	int sample_count() const { return m_samples_this_update; }
@@ -791,6 +829,9 @@ public:
 	void debugger_mute(bool turn_off) { mute(turn_off, MUTE_REASON_DEBUGGER); }
 	void system_mute(bool turn_off) { mute(turn_off, MUTE_REASON_SYSTEM); }
 
+	// discard generated audio instead of playing or recording it (for frames run ahead)
+	void set_output_suppressed(bool suppressed) { m_output_suppressed = suppressed; }
+
 	// return information about the given mixer input, by index
 	bool indexed_mixer_input(int index, mixer_input &info) const;
 
@@ -804,6 +845,10 @@ private:
 	// helper to remove items from the orphan list
 	void recursive_remove_stream_from_orphan_list(sound_stream *stream);
 
+	// parallel stream evaluation
+	void update_stream_groups();
+	static void *stream_group_callback(void *param, int threadid);
+
 	// apply pending sample rate changes
 	void apply_sample_rate_changes();
 
@@ -843,6 +888,7 @@ private:
 
 	u8 m_muted;                           // bitmask of muting reasons
 	bool m_nosound_mode;                  // true if we're in "nosound" mode
+	bool m_output_suppressed;             // true if generated audio is discarded
 	int m_attenuation;                    // current attentuation level (at the OSD)
 	int m_unique_id;                      // unique ID used for stream identification
 	util::wav_file_ptr m_wavfile;         // WAV file for streaming
@@ -851,6 +897,20 @@ private:
 	std::vector<std::unique_ptr<sound_stream>> m_stream_list; // list of streams
 	std::map<sound_stream *, u8> m_orphan_stream_list; // list of orphaned streams
 	bool m_first_reset;                   // is this our first reset?
+
+	// parallel stream evaluation
+	struct stream_group
+	{
+		std::vector<sound_stream *> sinks;  // speaker streams fed only by this group
+		attotime start, end;                // range to update
+	};
+	osd_work_queue *m_stream_queue;       // work queue for parallel evaluation, or nullptr
+	std::vector<stream_group> m_stream_groups; // independent groups of streams
+	bool m_stream_groups_valid;           // do the groups reflect the current graph?
+	std::unordered_map<sound_stream *, sound_stream *> m_stream_group_parent; // union-find scratch
+
+	// polyphase resampler filters
+	std::unique_ptr<polyphase_resampler_stream::filter_cache> m_resampler_filters;
 };
 
 
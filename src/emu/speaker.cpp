@@ -53,10 +53,12 @@ speaker_device::~speaker_device()
 
 
 //-------------------------------------------------
-//  mix - mix in samples from the speaker's stream
+//  mix - mix in samples from the speaker's stream;
+//  a side whose valid flag is still clear is
+//  overwritten rather than added to
 //-------------------------------------------------
 
-void speaker_device::mix(stream_buffer::sample_t *leftmix, stream_buffer::sample_t *rightmix, attotime start, attotime end, int expected_samples, bool suppress)
+void speaker_device::mix(stream_buffer::sample_t *leftmix, stream_buffer::sample_t *rightmix, bool &leftvalid, bool &rightvalid, attotime start, attotime end, int expected_samples, bool suppress)
 {
 	// skip if no stream
 	if (m_mixer_stream == nullptr)
@@ -89,24 +91,25 @@ void speaker_device::mix(stream_buffer::sample_t *leftmix, stream_buffer::sample
 	// mix if sound is enabled
 	if (!suppress)
 	{
-		// if the speaker is centered, send to both left and right
-		if (m_x == 0)
-			for (int sample = 0; sample < expected_samples; sample++)
-			{
-				stream_buffer::sample_t cursample = view.get(sample);
-				leftmix[sample] += cursample;
-				rightmix[sample] += cursample;
-			}
-
-		// if the speaker is to the left, send only to the left
-		else if (m_x < 0)
-			for (int sample = 0; sample < expected_samples; sample++)
-				leftmix[sample] += view.get(sample);
+		// if the speaker is centered or to the left, send to the left
+		if (m_x <= 0)
+		{
+			if (leftvalid)
+				view.add_to(leftmix, expected_samples);
+			else
+				view.copy_to(leftmix, expected_samples);
+			leftvalid = true;
+		}
 
-		// if the speaker is to the right, send only to the right
-		else
-			for (int sample = 0; sample < expected_samples; sample++)
-				rightmix[sample] += view.get(sample);
+		// if the speaker is centered or to the right, send to the right
+		if (m_x >= 0)
+		{
+			if (rightvalid)
+				view.add_to(rightmix, expected_samples);
+			else
+				view.copy_to(rightmix, expected_samples);
+			rightvalid = true;
+		}
 	}
 }
 
@@ -0,0 +1,286 @@
+// license:BSD-3-Clause
+// copyright-holders:Vas Crabb
+/***************************************************************************
+
+    telemetry.cpp
+
+    Live telemetry over the HTTP server's WebSocket support.
+
+****************************************************************************
+
+    Clients connect to ws://<host>:<port>/telemetry and receive one
+    text message every so many frames (every frame by default):
+
+        {
+          "frame": 1234,            video frame number
+          "time": 20.5667,          emulated time in seconds
+          "speed": 1.0002,          most recent emulation speed (1 = 100%)
+          "frame_ms": 16.66,        mean host time per frame since the last message
+          "present_ms": 16.66,      smoothed host time between presented frames
+          "screens": [ { "tag": ":screen", "partial_updates": 3 } ],
+          "devices": [ { "tag": ":maincpu", "cycles": 100000, "host_ms": 4.2 } ]
+        }
+
+    Device cycles and host time count what was executed since the last
+    message.  Host time is only included while scheduler profiling is
+    enabled (-profile_scheduler or from Lua).  Sending a number sets how
+    many frames pass between messages for every client.  Sending the text
+    "memory" adds the host memory held by each device to the next
+    message (see running_machine::memory_usage):
+
+          "memory": [ { "tag": ":maincpu", "regions": 65536, "shares": 0,
+                        "gfx": 0, "state": 4096 } ],
+          "ramstate_bytes": 0       memory held by rewind/run-ahead states
+
+    Nothing is gathered while no clients are connected, so the only cost
+    is checking a counter once per frame.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "telemetry.h"
+
+#include "screen.h"
+
+#include <rapidjson/writer.h>
+#include <rapidjson/stringbuffer.h>
+
+#include <algorithm>
+#include <cstdlib>
+
+
+//**************************************************************************
+//  MACHINE TELEMETRY
+//**************************************************************************
+
+//-------------------------------------------------
+//  machine_telemetry - constructor
+//-------------------------------------------------
+
+machine_telemetry::machine_telemetry(running_machine &machine, http_manager &http)
+	: m_machine(machine)
+	, m_clients(std::make_shared<client_list>())
+	, m_frames(0)
+	, m_last_ticks(0)
+{
+	m_clients->count = 0;
+	m_clients->interval = 1;
+	m_clients->memory = false;
+
+	// the endpoint outlives the machine, so (re)point its handlers at this machine's client list
+	http_manager::websocket_endpoint_ptr endpoint = http.add_endpoint("/telemetry", nullptr, nullptr, nullptr, nullptr);
+	if (endpoint)
+	{
+		std::shared_ptr<client_list> const clients = m_clients;
+		auto const remove =
+			[clients] (http_manager::websocket_connection_ptr const &connection)
+			{
+				std::lock_guard<std::mutex> lock(clients->mutex);
+				auto const found = std::find(clients->clients.begin(), clients->clients.end(), connection);
+				if (clients->clients.end() != found)
+				{
+					clients->clients.erase(found);
+					clients->count = clients->clients.size();
+				}
+			};
+		endpoint->on_open =
+			[clients] (http_manager::websocket_connection_ptr connection)
+			{
+				std::lock_guard<std::mutex> lock(clients->mutex);
+				clients->clients.emplace_back(std::move(connection));
+				clients->count = clients->clients.size();
+			};
+		endpoint->on_message =
+			[clients] (http_manager::websocket_connection_ptr connection, std::string const &payload, int opcode)
+			{
+				if (payload == "memory")
+				{
+					clients->memory = true;
+					return;
+				}
+				unsigned long const interval = std::strtoul(payload.c_str(), nullptr, 10);
+				if (interval)
+					clients->interval = unsigned(std::min<unsigned long>(interval, 3600));
+			};
+		endpoint->on_close =
+			[remove] (http_manager::websocket_connection_ptr connection, int status, std::string const &reason)
+			{
+				remove(connection);
+			};
+		endpoint->on_error =
+			[remove] (http_manager::websocket_connection_ptr connection, std::error_code const &error_code)
+			{
+				remove(connection);
+			};
+	}
+
+	machine.add_notifier(MACHINE_NOTIFY_FRAME, machine_notify_delegate(&machine_telemetry::frame_update, this));
+	machine.add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&machine_telemetry::machine_exit, this));
+}
+
+
+//-------------------------------------------------
+//  ~machine_telemetry - destructor
+//-------------------------------------------------
+
+machine_telemetry::~machine_telemetry()
+{
+	machine_exit();
+}
+
+
+//-------------------------------------------------
+//  frame_update - send a message if one is due
+//-------------------------------------------------
+
+void machine_telemetry::frame_update()
+{
+	if (!m_clients->count)
+	{
+		// start counting afresh when someone connects
+		m_last_ticks = 0;
+		return;
+	}
+
+	osd_ticks_t const now = osd_ticks();
+	if (!m_last_ticks)
+	{
+		// first frame with a client: just establish the baselines
+		m_last_ticks = now;
+		m_frames = 0;
+		build_message(0.0);
+		return;
+	}
+	if (++m_frames < m_clients->interval)
+		return;
+
+	std::string const message = build_message(double(now - m_last_ticks) / double(osd_ticks_per_second()) / m_frames);
+	m_last_ticks = now;
+	m_frames = 0;
+
+	std::vector<http_manager::websocket_connection_ptr> clients;
+	{
+		std::lock_guard<std::mutex> lock(m_clients->mutex);
+		clients = m_clients->clients;
+	}
+	for (auto const &client : clients)
+		client->send_message(message, 1);
+}
+
+
+//-------------------------------------------------
+//  machine_exit - disconnect clients when the
+//  machine stops
+//-------------------------------------------------
+
+void machine_telemetry::machine_exit()
+{
+	std::vector<http_manager::websocket_connection_ptr> clients;
+	{
+		std::lock_guard<std::mutex> lock(m_clients->mutex);
+		clients.swap(m_clients->clients);
+		m_clients->count = 0;
+	}
+	for (auto const &client : clients)
+		client->close();
+}
+
+
+//-------------------------------------------------
+//  build_message - describe what happened since
+//  the last message and update the baselines
+//-------------------------------------------------
+
+std::string machine_telemetry::build_message(double frame_seconds)
+{
+	rapidjson::StringBuffer s;
+	rapidjson::Writer<rapidjson::StringBuffer> writer(s);
+	writer.StartObject();
+
+	writer.Key("frame");
+	writer.Uint(m_machine.video().frame_count());
+	writer.Key("time");
+	writer.Double(m_machine.time().as_double());
+	writer.Key("speed");
+	writer.Double(m_machine.video().speed_percent());
+	writer.Key("frame_ms");
+	writer.Double(frame_seconds * 1000.0);
+	writer.Key("present_ms");
+	writer.Double(m_machine.video().present_period() * 1000.0);
+
+	writer.Key("screens");
+	writer.StartArray();
+	for (screen_device &screen : screen_device_enumerator(m_machine.root_device()))
+	{
+		writer.StartObject();
+		writer.Key("tag");
+		writer.String(screen.tag());
+		writer.Key("partial_updates");
+		writer.Int(screen.partial_updates());
+		writer.EndObject();
+	}
+	writer.EndArray();
+
+	device_scheduler const &scheduler = m_machine.scheduler();
+	bool const profiling = scheduler.profiling();
+	double const tps = double(osd_ticks_per_second());
+	writer.Key("devices");
+	writer.StartArray();
+	size_t index = 0;
+	for (device_execute_interface &exec : execute_interface_enumerator(m_machine.root_device()))
+	{
+		if (m_last_cycles.size() <= index)
+		{
+			m_last_cycles.resize(index + 1, 0);
+			m_last_host.resize(index + 1, 0);
+		}
+
+		u64 const cycles = exec.total_cycles();
+		device_scheduler::device_profile const *const profile = profiling ? scheduler.profile(exec) : nullptr;
+		osd_ticks_t const host = profile ? profile->host_ticks : 0;
+
+		writer.StartObject();
+		writer.Key("tag");
+		writer.String(exec.device().tag());
+		writer.Key("cycles");
+		writer.Uint64((cycles >= m_last_cycles[index]) ? (cycles - m_last_cycles[index]) : cycles);
+		if (profile)
+		{
+			writer.Key("host_ms");
+			writer.Double(double((host >= m_last_host[index]) ? (host - m_last_host[index]) : host) * 1000.0 / tps);
+		}
+		writer.EndObject();
+
+		m_last_cycles[index] = cycles;
+		m_last_host[index] = host;
+		++index;
+	}
+	writer.EndArray();
+
+	if (m_clients->memory.exchange(false))
+	{
+		writer.Key("memory");
+		writer.StartArray();
+		for (device_memory_usage const &usage : m_machine.memory_usage())
+		{
+			writer.StartObject();
+			writer.Key("tag");
+			writer.String(usage.device->tag());
+			writer.Key("regions");
+			writer.Uint64(usage.regions);
+			writer.Key("shares");
+			writer.Uint64(usage.shares);
+			writer.Key("gfx");
+			writer.Uint64(usage.gfx);
+			writer.Key("state");
+			writer.Uint64(usage.state);
+			writer.EndObject();
+		}
+		writer.EndArray();
+		writer.Key("ramstate_bytes");
+		writer.Uint64(m_machine.save().ramstate_bytes());
+	}
+
+	writer.EndObject();
+	return s.GetString();
+}
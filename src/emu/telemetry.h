@@ -0,0 +1,63 @@
+// license:BSD-3-Clause
+// copyright-holders:Vas Crabb
+/***************************************************************************
+
+    telemetry.h
+
+    Live telemetry over the HTTP server's WebSocket support.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_TELEMETRY_H
+#define MAME_EMU_TELEMETRY_H
+
+#pragma once
+
+#include "http.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// ======================> machine_telemetry
+
+// pushes a JSON message describing emulation performance to every client
+// connected to /telemetry every so many frames
+class machine_telemetry
+{
+public:
+	// construction/destruction
+	machine_telemetry(running_machine &machine, http_manager &http);
+	~machine_telemetry();
+
+private:
+	// clients are shared with the endpoint's handlers, which run on the server thread
+	struct client_list
+	{
+		std::mutex                                      mutex;          // protects the client list
+		std::vector<http_manager::websocket_connection_ptr> clients;    // connected clients
+		std::atomic<unsigned>                           count;          // number of connected clients
+		std::atomic<unsigned>                           interval;       // frames between messages
+		std::atomic<bool>                               memory;         // include memory usage in the next message
+	};
+
+	void frame_update();
+	void machine_exit();
+	std::string build_message(double frame_seconds);
+
+	// internal state
+	running_machine &               m_machine;          // reference to our machine
+	std::shared_ptr<client_list>    m_clients;          // connected clients
+	unsigned                        m_frames;           // frames since the last message
+	osd_ticks_t                     m_last_ticks;       // host time of the last message
+	std::vector<u64>                m_last_cycles;      // cycles executed by each device at the last message
+	std::vector<osd_ticks_t>        m_last_host;        // host time spent in each device at the last message
+};
+
+#endif // MAME_EMU_TELEMETRY_H
@@ -11,7 +11,189 @@
 #include "emu.h"
 #include "tilemap.h"
 
+#include "render.h"
 #include "screen.h"
+#include "video/simd.h"
+
+
+//**************************************************************************
+//  VECTOR SCANLINE HELPERS
+//**************************************************************************
+
+// each of these processes as many whole blocks of 16 pixels as fit in
+// the count and returns the number of pixels handled; the caller is
+// responsible for the remainder
+
+namespace {
+
+//-------------------------------------------------
+//  vector_priority_row - apply the tilemap
+//  priority code to a run of priority pixels
+//-------------------------------------------------
+
+inline int vector_priority_row(u8 *pri, int count, u32 pcode)
+{
+	int const blocks = count & ~15;
+#if defined(MAME_SIMD_SSE2)
+	__m128i const andmask = _mm_set1_epi8(s8(pcode >> 8));
+	__m128i const ormask = _mm_set1_epi8(s8(pcode));
+	for (int i = 0; i < blocks; i += 16)
+	{
+		__m128i *const ptr = reinterpret_cast<__m128i *>(&pri[i]);
+		_mm_storeu_si128(ptr, _mm_or_si128(_mm_and_si128(_mm_loadu_si128(ptr), andmask), ormask));
+	}
+	return blocks;
+#elif defined(MAME_SIMD_NEON)
+	uint8x16_t const andmask = vdupq_n_u8(u8(pcode >> 8));
+	uint8x16_t const ormask = vdupq_n_u8(u8(pcode));
+	for (int i = 0; i < blocks; i += 16)
+		vst1q_u8(&pri[i], vorrq_u8(vandq_u8(vld1q_u8(&pri[i]), andmask), ormask));
+	return blocks;
+#else
+	return 0;
+#endif
+}
+
+
+//-------------------------------------------------
+//  vector_masked_priority_row - apply the tilemap
+//  priority code where the flags match
+//-------------------------------------------------
+
+inline int vector_masked_priority_row(const u8 *maskptr, int mask, int value, int count, u8 *pri, u32 pcode)
+{
+	// the flags map is 8 bits wide; anything else never matches and is left to the scalar path
+	if ((mask | value) & ~0xff)
+		return 0;
+
+	int const blocks = count & ~15;
+#if defined(MAME_SIMD_SSE2)
+	__m128i const maskvec = _mm_set1_epi8(s8(mask));
+	__m128i const valuevec = _mm_set1_epi8(s8(value));
+	__m128i const andmask = _mm_set1_epi8(s8(pcode >> 8));
+	__m128i const ormask = _mm_set1_epi8(s8(pcode));
+	for (int i = 0; i < blocks; i += 16)
+	{
+		__m128i const match = _mm_cmpeq_epi8(_mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&maskptr[i])), maskvec), valuevec);
+		__m128i *const ptr = reinterpret_cast<__m128i *>(&pri[i]);
+		__m128i const old = _mm_loadu_si128(ptr);
+		__m128i const updated = _mm_or_si128(_mm_and_si128(old, andmask), ormask);
+		_mm_storeu_si128(ptr, _mm_or_si128(_mm_and_si128(match, updated), _mm_andnot_si128(match, old)));
+	}
+	return blocks;
+#elif defined(MAME_SIMD_NEON)
+	uint8x16_t const maskvec = vdupq_n_u8(u8(mask));
+	uint8x16_t const valuevec = vdupq_n_u8(u8(value));
+	uint8x16_t const andmask = vdupq_n_u8(u8(pcode >> 8));
+	uint8x16_t const ormask = vdupq_n_u8(u8(pcode));
+	for (int i = 0; i < blocks; i += 16)
+	{
+		uint8x16_t const match = vceqq_u8(vandq_u8(vld1q_u8(&maskptr[i]), maskvec), valuevec);
+		uint8x16_t const old = vld1q_u8(&pri[i]);
+		vst1q_u8(&pri[i], vbslq_u8(match, vorrq_u8(vandq_u8(old, andmask), ormask), old));
+	}
+	return blocks;
+#else
+	return 0;
+#endif
+}
+
+
+//-------------------------------------------------
+//  vector_rebase_row16 - copy a run of 16-bit
+//  pixels, adding a palette offset
+//-------------------------------------------------
+
+inline int vector_rebase_row16(u16 *dest, const u16 *source, int count, u16 pal)
+{
+	int const blocks = count & ~15;
+#if defined(MAME_SIMD_SSE2)
+	__m128i const palvec = _mm_set1_epi16(s16(pal));
+	for (int i = 0; i < blocks; i += 16)
+	{
+		__m128i const *const src = reinterpret_cast<__m128i const *>(&source[i]);
+		__m128i *const dst = reinterpret_cast<__m128i *>(&dest[i]);
+		_mm_storeu_si128(dst, _mm_add_epi16(_mm_loadu_si128(src), palvec));
+		_mm_storeu_si128(dst + 1, _mm_add_epi16(_mm_loadu_si128(src + 1), palvec));
+	}
+	return blocks;
+#elif defined(MAME_SIMD_NEON)
+	uint16x8_t const palvec = vdupq_n_u16(pal);
+	for (int i = 0; i < blocks; i += 16)
+	{
+		vst1q_u16(&dest[i], vaddq_u16(vld1q_u16(&source[i]), palvec));
+		vst1q_u16(&dest[i + 8], vaddq_u16(vld1q_u16(&source[i + 8]), palvec));
+	}
+	return blocks;
+#else
+	return 0;
+#endif
+}
+
+
+//-------------------------------------------------
+//  vector_masked_rebase_row16 - copy a run of
+//  16-bit pixels where the flags match, adding a
+//  palette offset
+//-------------------------------------------------
+
+inline int vector_masked_rebase_row16(u16 *dest, const u16 *source, const u8 *maskptr, int mask, int value, int count, u16 pal)
+{
+	// the flags map is 8 bits wide; anything else never matches and is left to the scalar path
+	if ((mask | value) & ~0xff)
+		return 0;
+
+	int const blocks = count & ~15;
+#if defined(MAME_SIMD_SSE2)
+	__m128i const maskvec = _mm_set1_epi8(s8(mask));
+	__m128i const valuevec = _mm_set1_epi8(s8(value));
+	__m128i const palvec = _mm_set1_epi16(s16(pal));
+	for (int i = 0; i < blocks; i += 16)
+	{
+		__m128i const match = _mm_cmpeq_epi8(_mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&maskptr[i])), maskvec), valuevec);
+		int const matchbits = _mm_movemask_epi8(match);
+
+		// skip fully transparent runs
+		if (!matchbits)
+			continue;
+
+		__m128i const *const src = reinterpret_cast<__m128i const *>(&source[i]);
+		__m128i *const dst = reinterpret_cast<__m128i *>(&dest[i]);
+		__m128i const lo = _mm_add_epi16(_mm_loadu_si128(src), palvec);
+		__m128i const hi = _mm_add_epi16(_mm_loadu_si128(src + 1), palvec);
+		if (matchbits == 0xffff)
+		{
+			_mm_storeu_si128(dst, lo);
+			_mm_storeu_si128(dst + 1, hi);
+		}
+		else
+		{
+			__m128i const matchlo = _mm_unpacklo_epi8(match, match);
+			__m128i const matchhi = _mm_unpackhi_epi8(match, match);
+			_mm_storeu_si128(dst, _mm_or_si128(_mm_and_si128(matchlo, lo), _mm_andnot_si128(matchlo, _mm_loadu_si128(dst))));
+			_mm_storeu_si128(dst + 1, _mm_or_si128(_mm_and_si128(matchhi, hi), _mm_andnot_si128(matchhi, _mm_loadu_si128(dst + 1))));
+		}
+	}
+	return blocks;
+#elif defined(MAME_SIMD_NEON)
+	uint8x16_t const maskvec = vdupq_n_u8(u8(mask));
+	uint8x16_t const valuevec = vdupq_n_u8(u8(value));
+	uint16x8_t const palvec = vdupq_n_u16(pal);
+	for (int i = 0; i < blocks; i += 16)
+	{
+		uint8x16_t const match = vceqq_u8(vandq_u8(vld1q_u8(&maskptr[i]), maskvec), valuevec);
+		uint16x8_t const matchlo = vreinterpretq_u16_s16(vmovl_s8(vreinterpret_s8_u8(vget_low_u8(match))));
+		uint16x8_t const matchhi = vreinterpretq_u16_s16(vmovl_s8(vreinterpret_s8_u8(vget_high_u8(match))));
+		vst1q_u16(&dest[i], vbslq_u16(matchlo, vaddq_u16(vld1q_u16(&source[i]), palvec), vld1q_u16(&dest[i])));
+		vst1q_u16(&dest[i + 8], vbslq_u16(matchhi, vaddq_u16(vld1q_u16(&source[i + 8]), palvec), vld1q_u16(&dest[i + 8])));
+	}
+	return blocks;
+#else
+	return 0;
+#endif
+}
+
+} // anonymous namespace
 
 
 //**************************************************************************
@@ -114,7 +296,7 @@ inline void tilemap_t::scanline_draw_opaque_null(int count, u8 *pri, u32 pcode)
 		return;
 
 	// update priority across the scanline
-	for (int i = 0; i < count; i++)
+	for (int i = vector_priority_row(pri, count, pcode); i < count; i++)
 		pri[i] = (pri[i] & (pcode >> 8)) | pcode;
 }
 
@@ -131,7 +313,7 @@ inline void tilemap_t::scanline_draw_masked_null(const u8 *maskptr, int mask, in
 		return;
 
 	// update priority across the scanline, checking the mask
-	for (int i = 0; i < count; i++)
+	for (int i = vector_masked_priority_row(maskptr, mask, value, count, pri, pcode); i < count; i++)
 		if ((maskptr[i] & mask) == value)
 			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
 }
@@ -157,24 +339,23 @@ inline void tilemap_t::scanline_draw_opaque_ind16(u16 *dest, const u16 *source,
 			return;
 
 		// update priority across the scanline
-		for (int i = 0; i < count; i++)
+		for (int i = vector_priority_row(pri, count, pcode); i < count; i++)
 			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
 	}
 
 	// priority case
 	else if ((pcode & 0xffff) != 0xff00)
 	{
-		for (int i = 0; i < count; i++)
-		{
+		for (int i = vector_rebase_row16(dest, source, count, pal); i < count; i++)
 			dest[i] = source[i] + pal;
+		for (int i = vector_priority_row(pri, count, pcode); i < count; i++)
 			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-		}
 	}
 
 	// no priority case
 	else
 	{
-		for (int i = 0; i < count; i++)
+		for (int i = vector_rebase_row16(dest, source, count, pal); i < count; i++)
 			dest[i] = source[i] + pal;
 	}
 }
@@ -192,18 +373,18 @@ inline void tilemap_t::scanline_draw_masked_ind16(u16 *dest, const u16 *source,
 	// priority case
 	if ((pcode & 0xffff) != 0xff00)
 	{
-		for (int i = 0; i < count; i++)
+		for (int i = vector_masked_rebase_row16(dest, source, maskptr, mask, value, count, pal); i < count; i++)
 			if ((maskptr[i] & mask) == value)
-			{
 				dest[i] = source[i] + pal;
+		for (int i = vector_masked_priority_row(maskptr, mask, value, count, pri, pcode); i < count; i++)
+			if ((maskptr[i] & mask) == value)
 				pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-			}
 	}
 
 	// no priority case
 	else
 	{
-		for (int i = 0; i < count; i++)
+		for (int i = vector_masked_rebase_row16(dest, source, maskptr, mask, value, count, pal); i < count; i++)
 			if ((maskptr[i] & mask) == value)
 				dest[i] = source[i] + pal;
 	}
@@ -224,10 +405,9 @@ inline void tilemap_t::scanline_draw_opaque_rgb32(u32 *dest, const u16 *source,
 	if ((pcode & 0xffff) != 0xff00)
 	{
 		for (int i = 0; i < count; i++)
-		{
 			dest[i] = clut[source[i]];
+		for (int i = vector_priority_row(pri, count, pcode); i < count; i++)
 			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-		}
 	}
 
 	// no priority case
@@ -253,10 +433,10 @@ inline void tilemap_t::scanline_draw_masked_rgb32(u32 *dest, const u16 *source,
 	{
 		for (int i = 0; i < count; i++)
 			if ((maskptr[i] & mask) == value)
-			{
 				dest[i] = clut[source[i]];
+		for (int i = vector_masked_priority_row(maskptr, mask, value, count, pri, pcode); i < count; i++)
+			if ((maskptr[i] & mask) == value)
 				pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-			}
 	}
 
 	// no priority case
@@ -403,6 +583,10 @@ void tilemap_t::init_common(
 	m_flagsmap.allocate(m_width, m_height);
 	memset(m_pen_to_flags, 0, sizeof(m_pen_to_flags));
 
+	// render container textures are allocated on first use
+	m_layer_textures_used = 0;
+	m_layer_frame = ~u64(0);
+
 	// create the initial mappings
 	mappings_create();
 
@@ -801,6 +985,10 @@ void tilemap_t::tile_update(logical_index logindex, u32 col, u32 row)
 	tilemap_memory_index memindex = m_logical_to_memory[logindex];
 	m_tile_get_info(*this, m_tileinfo, memindex);
 
+	// ARGB copies of this tile for render containers are now stale
+	for (layer_cache &layer : m_layer_caches)
+		layer.valid[logindex] = 0;
+
 	// apply the global tilemap flip to the returned flip flags
 	u32 flags = m_tileinfo.flags ^ (m_attributes & 0x03);
 
@@ -1004,6 +1192,24 @@ void tilemap_t::draw_common(screen_device &screen, _BitmapClass &dest, const rec
 	// flush the dirty state to all tiles as appropriate
 	realize_all_dirty_tiles();
 
+	// draw each visible copy of the tilemap
+	draw_instances(
+			screen,
+			blit,
+			[this, &screen, &dest, &blit] (int xpos, int ypos) { draw_instance(screen, dest, blit, xpos, ypos); });
+}
+
+
+//-------------------------------------------------
+//  draw_instances - call draw_instance for each
+//  position the tilemap appears at, narrowing
+//  the cliprect for runs of rows or columns
+//  with the same scroll value
+//-------------------------------------------------
+
+template<typename T>
+void tilemap_t::draw_instances(screen_device &screen, blit_parameters &blit, T &&visit)
+{
 	// flip the tilemap around the center of the visible area
 	rectangle const visarea = screen.visible_area();
 	u32 const xextent = visarea.right() + visarea.left() + 1; // x0 + x1 + 1 for calculating horizontal centre as (x0 + x1 + 1) >> 1
@@ -1017,7 +1223,7 @@ void tilemap_t::draw_common(screen_device &screen, _BitmapClass &dest, const rec
 		int scrolly = effective_colscroll(0, yextent);
 		for (int ypos = scrolly - m_height; ypos <= blit.cliprect.bottom(); ypos += m_height)
 			for (int xpos = scrollx - m_width; xpos <= blit.cliprect.right(); xpos += m_width)
-				draw_instance(screen, dest, blit, xpos, ypos);
+				visit(xpos, ypos);
 	}
 
 	// scrolling rows + vertical scroll
@@ -1053,7 +1259,7 @@ void tilemap_t::draw_common(screen_device &screen, _BitmapClass &dest, const rec
 
 				// iterate over X to handle wraparound
 				for (int xpos = scrollx - m_width; xpos <= original_cliprect.right(); xpos += m_width)
-					draw_instance(screen, dest, blit, xpos, ypos);
+					visit(xpos, ypos);
 			}
 		}
 	}
@@ -1088,7 +1294,7 @@ void tilemap_t::draw_common(screen_device &screen, _BitmapClass &dest, const rec
 
 				// iterate over Y to handle wraparound
 				for (int ypos = scrolly - m_height; ypos <= original_cliprect.bottom(); ypos += m_height)
-					draw_instance(screen, dest, blit, xpos, ypos);
+					visit(xpos, ypos);
 			}
 		}
 	}
@@ -1156,6 +1362,169 @@ void tilemap_t::draw_roz(screen_device &screen, bitmap_rgb32 &dest, const rectan
 { draw_roz_common(screen, dest, cliprect, startx, starty, incxx, incxy, incyx, incyy, wraparound, flags, priority, priority_mask); }
 
 
+//-------------------------------------------------
+//  draw - add the tilemap to a screen's render
+//  container as textured quads, for the OSD to
+//  composite; layers are blended in the order
+//  they're added and the priority bitmap is not
+//  touched
+//-------------------------------------------------
+
+void tilemap_t::draw(screen_device &screen, render_container &container, const rectangle &cliprect, u32 flags)
+{
+	// skip if disabled
+	if (!m_enable)
+		return;
+
+	auto profile = g_profiler.start(PROFILER_TILEMAP_DRAW);
+
+	// configure the blit parameters based on the input parameters
+	blit_parameters blit;
+	configure_blit_parameters(blit, screen.priority(), cliprect, flags, 0, 0xff);
+
+	// flush the dirty state to all tiles as appropriate
+	realize_all_dirty_tiles();
+
+	// on a new frame, recycle the textures and pick up palette changes
+	if (m_layer_frame != screen.frame_number())
+	{
+		m_layer_frame = screen.frame_number();
+		m_layer_textures_used = 0;
+
+		palette_t const &palette(*m_palette->palette());
+		rgb_t const *const entries = palette.entry_list_adjusted();
+		if ((m_layer_palette.size() != size_t(palette.max_index())) || !std::equal(m_layer_palette.begin(), m_layer_palette.end(), entries))
+		{
+			m_layer_palette.assign(entries, entries + palette.max_index());
+			for (layer_cache &layer : m_layer_caches)
+				std::fill(layer.valid.begin(), layer.valid.end(), 0);
+		}
+	}
+
+	// draw each visible copy of the tilemap
+	layer_cache &layer(find_layer_cache(blit.mask, blit.value));
+	draw_instances(
+			screen,
+			blit,
+			[this, &screen, &container, &layer, &blit] (int xpos, int ypos) { add_layer_quad(screen, container, layer, blit, xpos, ypos); });
+}
+
+
+//-------------------------------------------------
+//  find_layer_cache - get the ARGB copy of the
+//  pixmap for a transparency mask
+//-------------------------------------------------
+
+tilemap_t::layer_cache &tilemap_t::find_layer_cache(u8 mask, u8 value)
+{
+	auto found = std::find_if(
+			m_layer_caches.begin(),
+			m_layer_caches.end(),
+			[mask, value] (layer_cache const &layer) { return (layer.mask == mask) && (layer.value == value); });
+	if (m_layer_caches.end() == found)
+	{
+		found = m_layer_caches.emplace(m_layer_caches.end());
+		found->mask = mask;
+		found->value = value;
+		found->palette_offset = m_palette_offset;
+		found->bitmap.allocate(m_width, m_height);
+		found->valid.resize(m_tileflags.size(), 0);
+	}
+	else if (found->palette_offset != m_palette_offset)
+	{
+		found->palette_offset = m_palette_offset;
+		std::fill(found->valid.begin(), found->valid.end(), 0);
+	}
+	return *found;
+}
+
+
+//-------------------------------------------------
+//  layer_cache_update - bring the tiles covering
+//  part of the pixmap up to date in an ARGB copy
+//-------------------------------------------------
+
+void tilemap_t::layer_cache_update(layer_cache &layer, const rectangle &srcrect)
+{
+	rgb_t const *const clut = &m_layer_palette[layer.palette_offset];
+	for (int row = srcrect.top() / m_tileheight; (srcrect.bottom() / m_tileheight) >= row; row++)
+	{
+		for (int col = srcrect.left() / m_tilewidth; (srcrect.right() / m_tilewidth) >= col; col++)
+		{
+			logical_index const logindex = row * m_cols + col;
+			if (m_tileflags[logindex] == TILE_FLAG_DIRTY)
+				tile_update(logindex, col, row);
+			if (layer.valid[logindex])
+				continue;
+
+			for (int y = row * m_tileheight; ((row + 1) * m_tileheight) > y; y++)
+			{
+				u16 const *const src = &m_pixmap.pix(y, col * m_tilewidth);
+				u8 const *const flags = &m_flagsmap.pix(y, col * m_tilewidth);
+				u32 *const dst = &layer.bitmap.pix(y, col * m_tilewidth);
+				for (int x = 0; m_tilewidth > x; x++)
+					dst[x] = ((flags[x] & layer.mask) == layer.value) ? (clut[src[x]] | 0xff000000) : 0;
+			}
+			layer.valid[logindex] = 1;
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  add_layer_quad - add a quad for one copy of
+//  the tilemap, clipped to the blit cliprect
+//-------------------------------------------------
+
+void tilemap_t::add_layer_quad(screen_device &screen, render_container &container, layer_cache &layer, const blit_parameters &blit, int xpos, int ypos)
+{
+	// clip destination coordinates to the tilemap
+	// note that x2/y2 are exclusive, not inclusive
+	int const x1 = (std::max)(xpos, blit.cliprect.left());
+	int const x2 = (std::min)(xpos + int(m_width), blit.cliprect.right() + 1);
+	int const y1 = (std::max)(ypos, blit.cliprect.top());
+	int const y2 = (std::min)(ypos + int(m_height), blit.cliprect.bottom() + 1);
+
+	// if totally clipped, stop here
+	if (x1 >= x2 || y1 >= y2)
+		return;
+
+	rectangle const srcrect(x1 - xpos, x2 - xpos - 1, y1 - ypos, y2 - ypos - 1);
+	layer_cache_update(layer, srcrect);
+
+	// each quad needs its own texture, as the bounds are part of the texture
+	if (m_layer_textures.size() == m_layer_textures_used)
+		m_layer_textures.emplace_back(machine().render().texture_alloc());
+	render_texture *const texture = m_layer_textures[m_layer_textures_used++];
+	texture->set_bitmap(layer.bitmap, srcrect, TEXFORMAT_ARGB32);
+
+	// container coordinates span the visible area
+	rectangle const &visarea = screen.visible_area();
+	float const xscale = 1.0f / float(visarea.width());
+	float const yscale = 1.0f / float(visarea.height());
+	container.add_quad(
+			float(x1 - visarea.left()) * xscale, float(y1 - visarea.top()) * yscale,
+			float(x2 - visarea.left()) * xscale, float(y2 - visarea.top()) * yscale,
+			rgb_t(blit.alpha, 0xff, 0xff, 0xff),
+			texture,
+			PRIMFLAG_BLENDMODE(BLENDMODE_ALPHA));
+}
+
+
+//-------------------------------------------------
+//  free_layer_textures - release render textures
+//  while the render manager still exists
+//-------------------------------------------------
+
+void tilemap_t::free_layer_textures()
+{
+	for (render_texture *texture : m_layer_textures)
+		machine().render().texture_free(texture);
+	m_layer_textures.clear();
+	m_layer_textures_used = 0;
+}
+
+
 //-------------------------------------------------
 //  draw_instance - draw a single instance of the
 //  tilemap to the internal pixmap at the given
@@ -1596,6 +1965,10 @@ tilemap_manager::tilemap_manager(running_machine &machine)
 
 tilemap_manager::~tilemap_manager()
 {
+	// device tilemaps outlive the render manager, so free their textures now
+	for (tilemap_t &tmap : m_tilemap_list)
+		tmap.free_layer_textures();
+
 	// detach all device tilemaps since they will be destroyed as subdevices elsewhere
 	bool found = true;
 	while (found)
@@ -287,6 +287,17 @@
     * If you want to render with alpha blending, you can call
         tilemap_t::draw() with the TILEMAP_DRAW_ALPHA flag.
 
+    * Drivers whose layers are composited strictly in order (no
+        per-pixel priority) can let the OSD renderer do the blending.
+        Set VIDEO_SELF_RENDER on the screen, empty screen.container() at
+        the start of the update, and call the tilemap_t::draw() overload
+        that takes a render_container for each layer, back to front.
+        Each visible part of the tilemap becomes a textured quad taken
+        from an ARGB copy of the pixmap that is only refreshed for tiles
+        that changed, so nothing is blitted to a screen bitmap.  Scroll
+        and rowscroll/colscroll work as they do for bitmaps; the
+        priority bitmap is not updated.
+
     * To configure more complex pen-to-layer mapping, use the
         tilemap_t::map_pens_to_layer() call. This call takes a group
         number so that you can configure 1 of the 256 groups
@@ -491,6 +502,7 @@ public:
 	void draw(screen_device &screen, bitmap_rgb32 &dest, const rectangle &cliprect, u32 flags = TILEMAP_DRAW_ALL_CATEGORIES, u8 priority = 0, u8 priority_mask = 0xff);
 	void draw_roz(screen_device &screen, bitmap_ind16 &dest, const rectangle &cliprect, u32 startx, u32 starty, int incxx, int incxy, int incyx, int incyy, bool wraparound, u32 flags = TILEMAP_DRAW_ALL_CATEGORIES, u8 priority = 0, u8 priority_mask = 0xff);
 	void draw_roz(screen_device &screen, bitmap_rgb32 &dest, const rectangle &cliprect, u32 startx, u32 starty, int incxx, int incxy, int incyx, int incyy, bool wraparound, u32 flags = TILEMAP_DRAW_ALL_CATEGORIES, u8 priority = 0, u8 priority_mask = 0xff);
+	void draw(screen_device &screen, render_container &container, const rectangle &cliprect, u32 flags = TILEMAP_DRAW_ALL_CATEGORIES);
 	void draw_debug(screen_device &screen, bitmap_rgb32 &dest, u32 scrollx, u32 scrolly, u32 flags = TILEMAP_DRAW_ALL_CATEGORIES);
 
 	// mappers
@@ -526,6 +538,16 @@ private:
 		u8                  alpha;
 	};
 
+	// ARGB copy of the pixmap for one transparency mask, for render textures
+	struct layer_cache
+	{
+		u8                  mask;
+		u8                  value;
+		u32                 palette_offset;
+		bitmap_argb32       bitmap;
+		std::vector<u8>     valid;              // per-tile: converted since last drawn
+	};
+
 	// inline helpers
 	s32 effective_rowscroll(int index, u32 screen_width);
 	s32 effective_colscroll(int index, u32 screen_height);
@@ -557,6 +579,13 @@ private:
 	template<class _BitmapClass> void draw_roz_common(screen_device &screen, _BitmapClass &dest, const rectangle &cliprect, u32 startx, u32 starty, int incxx, int incxy, int incyx, int incyy, bool wraparound, u32 flags, u8 priority, u8 priority_mask);
 	template<class _BitmapClass> void draw_instance(screen_device &screen, _BitmapClass &dest, const blit_parameters &blit, int xpos, int ypos);
 	template<class _BitmapClass> void draw_roz_core(screen_device &screen, _BitmapClass &destbitmap, const blit_parameters &blit, u32 startx, u32 starty, int incxx, int incxy, int incyx, int incyy, bool wraparound);
+	template<typename T> void draw_instances(screen_device &screen, blit_parameters &blit, T &&draw_instance);
+
+	// render container drawing
+	layer_cache &find_layer_cache(u8 mask, u8 value);
+	void layer_cache_update(layer_cache &layer, const rectangle &srcrect);
+	void add_layer_quad(screen_device &screen, render_container &container, layer_cache &layer, const blit_parameters &blit, int xpos, int ypos);
+	void free_layer_textures();
 
 	// managers and devices
 	tilemap_manager *           m_manager;              // reference to the owning manager
@@ -608,6 +637,13 @@ private:
 	bitmap_ind8                 m_flagsmap;             // per-pixel flags
 	std::vector<u8>             m_tileflags;            // per-tile flags
 	u8                          m_pen_to_flags[MAX_PEN_TO_FLAGS * TILEMAP_NUM_GROUPS]; // mapping of pens to flags
+
+	// render container drawing
+	std::vector<layer_cache>    m_layer_caches;         // ARGB pixmap copies by transparency mask
+	std::vector<rgb_t>          m_layer_palette;        // palette the copies were converted with
+	std::vector<render_texture *> m_layer_textures;     // one texture per quad emitted this frame
+	u32                         m_layer_textures_used;  // textures emitted so far this frame
+	u64                         m_layer_frame;          // frame the textures were emitted for
 };
 
 
@@ -21,7 +21,13 @@
 #include "path.h"
 #include "unicode.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cctype>
+#include <condition_variable>
+#include <exception>
+#include <future>
+#include <thread>
 #include <type_traits>
 #include <typeinfo>
 
@@ -1818,6 +1824,10 @@ void validity_checker::validate_tag(const char *tag)
 //  VALIDATION FUNCTIONS
 //**************************************************************************
 
+// checker collecting output for the driver being validated on a worker thread
+thread_local validity_checker *validity_checker::s_worker = nullptr;
+
+
 //-------------------------------------------------
 //  validity_checker - constructor
 //-------------------------------------------------
@@ -1832,6 +1842,7 @@ validity_checker::validity_checker(emu_options &options, bool quick)
 	, m_current_ioport(nullptr)
 	, m_checking_card(false)
 	, m_quick(quick)
+	, m_parent(nullptr)
 {
 	// pre-populate the defstr map with all the default strings
 	for (int strnum = 1; strnum < INPUT_STRING_COUNT; strnum++)
@@ -1846,9 +1857,63 @@ validity_checker::validity_checker(emu_options &options, bool quick)
 //  validity_checker - destructor
 //-------------------------------------------------
 
+validity_checker::validity_checker(validity_checker &parent)
+	: m_drivlist(parent.m_drivlist.options())
+	, m_errors(0)
+	, m_warnings(0)
+	, m_print_verbose(false)
+	, m_names_map(parent.m_names_map)
+	, m_descriptions_map(parent.m_descriptions_map)
+	, m_defstr_map(parent.m_defstr_map)
+	, m_current_driver(nullptr)
+	, m_current_device(nullptr)
+	, m_current_ioport(nullptr)
+	, m_checking_card(false)
+	, m_quick(parent.m_quick)
+	, m_parent(&parent)
+{
+}
+
+//-------------------------------------------------
+//  validity_checker - destructor
+//-------------------------------------------------
+
 validity_checker::~validity_checker()
 {
-	validate_end();
+	if (!m_parent)
+		validate_end();
+}
+
+
+//-------------------------------------------------
+//  already_checked - record that a one-time
+//  check has been done, returning true if it was
+//  done before
+//-------------------------------------------------
+
+bool validity_checker::already_checked(const char *string)
+{
+	if (m_parent)
+		return m_parent->already_checked(string);
+
+	std::lock_guard<std::mutex> lock(m_shared_mutex);
+	return !m_already_checked.insert(string).second;
+}
+
+
+//-------------------------------------------------
+//  slot_card_checked - record that a slot card
+//  type has been validated, returning true if it
+//  was validated before
+//-------------------------------------------------
+
+bool validity_checker::slot_card_checked(const char *shortname)
+{
+	if (m_parent)
+		return m_parent->slot_card_checked(shortname);
+
+	std::lock_guard<std::mutex> lock(m_shared_mutex);
+	return !m_slotcard_set.insert(shortname).second;
 }
 
 //-------------------------------------------------
@@ -1914,16 +1979,29 @@ bool validity_checker::check_all_matching(const char *string)
 		output_via_delegate(OSD_OUTPUT_CHANNEL_ERROR, "\n");
 	}
 
-	// then iterate over all drivers and check them
+	// a pattern containing a period selects drivers by source file name
+	bool const by_source = string && strchr(string, '.');
+
+	// then iterate over all drivers and collect the ones to check
+	std::vector<const game_driver *> drivers;
 	m_drivlist.reset();
-	bool validated_any = false;
 	while (m_drivlist.next())
 	{
-		if (driver_list::matches(string, m_drivlist.driver().name))
-		{
-			validate_one(m_drivlist.driver());
-			validated_any = true;
-		}
+		const game_driver &driver(m_drivlist.driver());
+		if (!by_source ? driver_list::matches(string, driver.name) : ((driver.name[0] != '_') && !core_strwildcmp(string, core_filename_extract_base(driver.type.source()))))
+			drivers.emplace_back(&driver);
+	}
+	bool const validated_any = !drivers.empty();
+
+	// verbose output is used to find the driver that crashes, so only go parallel without it
+	if (!m_print_verbose && (drivers.size() > 1) && (std::thread::hardware_concurrency() > 1))
+	{
+		validate_parallel(drivers);
+	}
+	else
+	{
+		for (const game_driver *driver : drivers)
+			validate_one(*driver);
 	}
 
 	// validate devices
@@ -2044,6 +2122,99 @@ void validity_checker::validate_one(const game_driver &driver)
 }
 
 
+//-------------------------------------------------
+//  validate_parallel - validate drivers on worker
+//  threads, reporting in driver order
+//-------------------------------------------------
+
+void validity_checker::validate_parallel(const std::vector<const game_driver *> &drivers)
+{
+	// duplicate names and descriptions are reported against the later driver, so record the
+	// first driver for each before starting
+	for (const game_driver *driver : drivers)
+	{
+		m_names_map.emplace(driver->name, driver);
+		m_descriptions_map.emplace(driver->type.fullname(), driver);
+	}
+
+	struct driver_result
+	{
+		std::string report;
+		int         errors = 0;
+		int         warnings = 0;
+		bool        ready = false;
+	};
+	std::vector<driver_result> results(drivers.size());
+	std::mutex resultmutex;
+	std::condition_variable resultcond;
+	std::exception_ptr failure;
+	std::atomic<std::size_t> nextdriver(0);
+	std::atomic<bool> cancel(false);
+	auto const validate_drivers =
+			[this, &drivers, &results, &resultmutex, &resultcond, &failure, &nextdriver, &cancel] ()
+			{
+				try
+				{
+					// output from this thread is redirected to a checker of its own
+					validity_checker worker(*this);
+					s_worker = &worker;
+					for (std::size_t i = nextdriver++; (drivers.size() > i) && !cancel; i = nextdriver++)
+					{
+						int const start_errors = worker.m_errors;
+						int const start_warnings = worker.m_warnings;
+						worker.validate_one(*drivers[i]);
+
+						{
+							std::lock_guard<std::mutex> lock(resultmutex);
+							results[i].report = std::move(worker.m_report);
+							results[i].errors = worker.m_errors - start_errors;
+							results[i].warnings = worker.m_warnings - start_warnings;
+							results[i].ready = true;
+						}
+						worker.m_report.clear();
+						resultcond.notify_all();
+					}
+					s_worker = nullptr;
+				}
+				catch (...)
+				{
+					s_worker = nullptr;
+					std::lock_guard<std::mutex> lock(resultmutex);
+					if (!failure)
+						failure = std::current_exception();
+					cancel = true;
+					resultcond.notify_all();
+				}
+			};
+	std::vector<std::future<void> > workers;
+	unsigned const threads = std::min<std::size_t>(std::thread::hardware_concurrency(), drivers.size());
+	for (unsigned i = 0; threads > i; ++i)
+		workers.emplace_back(std::async(std::launch::async, validate_drivers));
+
+	// report results in driver order as they become available
+	for (std::size_t i = 0; drivers.size() > i; ++i)
+	{
+		driver_result result;
+		{
+			std::unique_lock<std::mutex> lock(resultmutex);
+			resultcond.wait(lock, [&results, &failure, i] () { return results[i].ready || failure; });
+			if (!results[i].ready)
+				break;
+			result = std::move(results[i]);
+		}
+
+		m_errors += result.errors;
+		m_warnings += result.warnings;
+		if (!result.report.empty())
+			output_via_delegate(OSD_OUTPUT_CHANNEL_ERROR, "%s", result.report);
+	}
+	for (std::future<void> &worker : workers)
+		worker.wait();
+	if (failure)
+		std::rethrow_exception(failure);
+}
+
+
 //-------------------------------------------------
 //  validate_driver - validate basic driver
 //  information
@@ -2051,19 +2222,15 @@ void validity_checker::validate_one(const game_driver &driver)
 
 void validity_checker::validate_driver(device_t &root)
 {
-	// check for duplicate names
-	if (!m_names_map.insert(std::make_pair(m_current_driver->name, m_current_driver)).second)
-	{
-		const game_driver *match = m_names_map.find(m_current_driver->name)->second;
+	// check for duplicate names (the first driver may already have been recorded)
+	const game_driver *match = m_names_map.emplace(m_current_driver->name, m_current_driver).first->second;
+	if (match != m_current_driver)
 		osd_printf_error("Driver name is a duplicate of %s(%s)\n", core_filename_extract_base(match->type.source()), match->name);
-	}
 
 	// check for duplicate descriptions
-	if (!m_descriptions_map.insert(std::make_pair(m_current_driver->type.fullname(), m_current_driver)).second)
-	{
-		const game_driver *match = m_descriptions_map.find(m_current_driver->type.fullname())->second;
+	match = m_descriptions_map.emplace(m_current_driver->type.fullname(), m_current_driver).first->second;
+	if (match != m_current_driver)
 		osd_printf_error("Driver description is a duplicate of %s(%s)\n", core_filename_extract_base(match->type.source()), match->name);
-	}
 
 	// determine if we are a clone
 	bool is_clone = (strcmp(m_current_driver->parent, "0") != 0);
@@ -2663,7 +2830,7 @@ void validity_checker::validate_devices(machine_config &config)
 					continue;
 
 				// if we need to save time, instantiate and validate each slot card type at most once
-				if (m_quick && !m_slotcard_set.insert(option.second->devtype().shortname()).second)
+				if (m_quick && slot_card_checked(option.second->devtype().shortname()))
 					continue;
 
 				m_checking_card = true;
@@ -2893,6 +3060,13 @@ void validity_checker::build_output_prefix(std::ostream &str) const
 
 void validity_checker::output_callback(osd_output_channel channel, const util::format_argument_pack<char> &args)
 {
+	// output from worker threads goes to the checker for the driver being validated there
+	if (s_worker && (s_worker != this))
+	{
+		s_worker->output_callback(channel, args);
+		return;
+	}
+
 	std::ostringstream output;
 	switch (channel)
 	{
@@ -2933,7 +3107,15 @@ void validity_checker::output_callback(osd_output_channel channel, const util::f
 		break;
 
 	default:
-		chain_output(channel, args);
+		if (m_parent)
+		{
+			std::lock_guard<std::mutex> lock(m_parent->m_shared_mutex);
+			m_parent->chain_output(channel, args);
+		}
+		else
+		{
+			chain_output(channel, args);
+		}
 		break;
 	}
 }
@@ -2947,8 +3129,11 @@ void validity_checker::output_callback(osd_output_channel channel, const util::f
 template <typename Format, typename... Params>
 void validity_checker::output_via_delegate(osd_output_channel channel, Format &&fmt, Params &&...args)
 {
-	// call through to the delegate with the proper parameters
-	chain_output(channel, util::make_format_argument_pack(std::forward<Format>(fmt), std::forward<Params>(args)...));
+	// collect the output on worker threads, or call through to the delegate with the proper parameters
+	if (m_parent)
+		m_report.append(util::string_format(std::forward<Format>(fmt), std::forward<Params>(args)...));
+	else
+		chain_output(channel, util::make_format_argument_pack(std::forward<Format>(fmt), std::forward<Params>(args)...));
 }
 
 //-------------------------------------------------
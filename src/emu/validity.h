@@ -16,6 +16,10 @@
 #include "drivenum.h"
 #include "emuopts.h"
 
+#include <mutex>
+#include <string>
+#include <vector>
+
 
 //**************************************************************************
 //  TYPE DEFINITIONS
@@ -47,7 +51,7 @@ public:
 	bool ioport_missing(const char *tag) { return !m_checking_card && (m_ioport_set.find(tag) == m_ioport_set.end()); }
 
 	// generic registry of already-checked stuff
-	bool already_checked(const char *string) { return !m_already_checked.insert(string).second; }
+	bool already_checked(const char *string);
 
 protected:
 	// osd_output interface
@@ -59,13 +63,18 @@ private:
 	using int_map = std::unordered_map<std::string, uintptr_t>;
 	using string_set = std::unordered_set<std::string>;
 
+	// construction of checkers for worker threads
+	validity_checker(validity_checker &parent);
+
 	// internal helpers
 	int get_defstr_index(const char *string, bool suppress_error = false);
+	bool slot_card_checked(const char *shortname);
 
 	// core helpers
 	void validate_begin();
 	void validate_end();
 	void validate_one(const game_driver &driver);
+	void validate_parallel(const std::vector<const game_driver *> &drivers);
 
 	// internal sub-checks
 	void validate_driver(device_t &root);
@@ -112,6 +121,13 @@ private:
 	string_set              m_slotcard_set;
 	bool                    m_checking_card;
 	bool const              m_quick;
+
+	// parallel validation
+	validity_checker *const m_parent;           // owner of shared state when running on a worker thread
+	std::mutex              m_shared_mutex;     // protects state shared with worker threads
+	std::string             m_report;           // output collected on a worker thread
+
+	static thread_local validity_checker *s_worker; // checker for this worker thread
 };
 
 #endif // MAME_EMU_VALIDITY_H
@@ -26,6 +26,13 @@
 #include "xmlfile.h"
 
 #include "osdepend.h"
+#include "modules/lib/osdlib.h"
+
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
+
+#include <algorithm>
+#include <cmath>
 
 #include "rendersw.hxx"
 
@@ -95,6 +102,8 @@ video_manager::video_manager(running_machine &machine)
 	, m_throttled(true)
 	, m_throttle_rate(1.0f)
 	, m_fastforward(false)
+	, m_turbo(machine.options().turbo())
+	, m_turbo_shown_ticks(0)
 	, m_seconds_to_run(machine.options().seconds_to_run())
 	, m_auto_frameskip(machine.options().auto_frameskip())
 	, m_speed(original_speed_setting())
@@ -106,6 +115,25 @@ video_manager::video_manager(running_machine &machine)
 	, m_frameskip_adjust(0)
 	, m_skipping_this_frame(false)
 	, m_average_oversleep(0)
+	, m_frame_delay(machine.options().frame_delay())
+	, m_frame_delay_auto(machine.options().frame_delay_auto())
+	, m_frame_delay_emutime(attotime::zero)
+	, m_frame_delay_polled(0)
+	, m_frame_delay_busy(0)
+	, m_runahead_frames(machine.options().runahead())
+	, m_runahead_mode(runahead_mode::NONE)
+	, m_runahead_pending(false)
+	, m_runahead_skipping(false)
+	, m_resimulating(false)
+	, m_beam_racing(false)
+	, m_display_pacing(machine.osd().presents_on_vblank())
+	, m_present_last_ticks(0)
+	, m_present_period(0)
+	, m_frame_count(0)
+	, m_bench_report(machine.options().bench_report() ? machine.options().bench_report() : "")
+	, m_bench_start_ticks(0)
+	, m_bench_start_emutime(attotime::zero)
+	, m_bench_last_ticks(0)
 	, m_snap_target(nullptr)
 	, m_snap_native(true)
 	, m_snap_width(0)
@@ -213,49 +241,87 @@ void video_manager::set_frameskip(int frameskip)
 void video_manager::frame_update(bool from_debugger)
 {
 	// only render sound and video if we're in the running phase
+	auto trace = g_tracer.begin("frame");
 	machine_phase const phase = machine().phase();
 	bool skipped_it = m_skipping_this_frame;
 	bool const update_screens = (phase == machine_phase::RUNNING) && (!machine().paused() || machine().options().update_in_pause());
+	bool const ahead = (m_runahead_mode != runahead_mode::NONE);
+
+	// report output changes first, as layouts and SVG screens depend on them
+	machine().output().notify_pending();
 	bool anything_changed = update_screens && finish_screen_updates();
 
+	// with run-ahead enabled, regular frames aren't displayed; the last
+	// frame emulated ahead of it is displayed instead
+	m_runahead_pending = !from_debugger && !ahead && m_runahead_frames && (phase == machine_phase::RUNNING) && !machine().paused()
+			&& !(machine().debug_flags & DEBUG_FLAG_ENABLED) && machine().scheduler().can_save();
+
 	// update inputs and draw the user interface
-	machine().osd().input_update(true);
-	anything_changed = emulator_info::draw_user_interface(machine()) || anything_changed;
+	if (!ahead)
+	{
+		machine().osd().input_update(true);
+		anything_changed = emulator_info::draw_user_interface(machine()) || anything_changed;
 
-	// let plugins draw over the UI
-	anything_changed = emulator_info::frame_hook() || anything_changed;
+		// let plugins draw over the UI
+		anything_changed = emulator_info::frame_hook() || anything_changed;
+	}
 
 	// if none of the screens changed and we haven't skipped too many frames in a row,
 	// mark this frame as skipped to prevent throttling; this helps for games that
 	// don't update their screen at the monitor refresh rate
-	if (!anything_changed && !m_auto_frameskip && (m_frameskip_level == 0) && (m_empty_skip_count++ < 3))
-		skipped_it = true;
-	else
-		m_empty_skip_count = 0;
+	if (!ahead)
+	{
+		if (!anything_changed && !m_auto_frameskip && (m_frameskip_level == 0) && (m_empty_skip_count++ < 3))
+			skipped_it = true;
+		else
+			m_empty_skip_count = 0;
+	}
 
 	// if we're throttling, synchronize before rendering
 	attotime current_time = machine().time();
-	if (!from_debugger && phase > machine_phase::INIT && !m_low_latency && effective_throttle())
+	osd_ticks_t throttle_ticks = 0;
+	bool const paced = display_paced();
+	if (!from_debugger && !ahead && !paced && phase > machine_phase::INIT && (!m_low_latency || m_runahead_pending) && effective_throttle())
+	{
+		osd_ticks_t const start = osd_ticks();
 		update_throttle(current_time);
+		throttle_ticks += osd_ticks() - start;
+	}
 
 	// ask the OSD to update
+	if (!m_runahead_pending && (m_runahead_mode != runahead_mode::HIDDEN))
 	{
 		auto profile = g_profiler.start(PROFILER_BLIT);
+		auto trace = g_tracer.begin("osd update");
 		machine().osd().update(!from_debugger && skipped_it);
+		if (!from_debugger && !skipped_it)
+			record_present();
 	}
 
 	// we synchronize after rendering instead of before, if low latency mode is enabled
-	if (!from_debugger && phase > machine_phase::INIT && m_low_latency && effective_throttle())
+	if (!from_debugger && !ahead && !paced && !m_runahead_pending && phase > machine_phase::INIT && m_low_latency && effective_throttle())
+	{
+		osd_ticks_t const start = osd_ticks();
 		update_throttle(current_time);
+		throttle_ticks += osd_ticks() - start;
+	}
 
-	machine().osd().input_update(false);
-	emulator_info::periodic_check();
+	// wait a while so the inputs polled below are as fresh as possible when the next frame is emulated
+	if (m_frame_delay && !from_debugger && !ahead && !m_runahead_pending && (phase == machine_phase::RUNNING) && !machine().paused() && effective_throttle())
+		apply_frame_delay(current_time, throttle_ticks);
 
-	if (!from_debugger)
+	if (!ahead)
 	{
-		// perform tasks for this frame
+		machine().osd().input_update(false);
+		emulator_info::periodic_check();
+	}
+
+	// perform tasks for this frame - frames emulated again for network play need their inputs too
+	if (!from_debugger && (!ahead || m_resimulating))
 		machine().call_notifiers(MACHINE_NOTIFY_FRAME);
 
+	if (!from_debugger && !ahead)
+	{
 		// update frameskipping
 		if (phase > machine_phase::INIT)
 			update_frameskip();
@@ -263,7 +329,13 @@ void video_manager::frame_update(bool from_debugger)
 		// update speed computations
 		if (!skipped_it && phase > machine_phase::INIT)
 			recompute_speed(current_time);
+
+		// collect per-frame timing for the benchmark report
+		if (!m_bench_report.empty() && phase == machine_phase::RUNNING)
+			record_frame_time();
 	}
+	if (!from_debugger)
+		m_frame_count++;
 
 	// call the end-of-frame callback
 	if (phase == machine_phase::RUNNING)
@@ -278,6 +350,32 @@ void video_manager::frame_update(bool from_debugger)
 }
 
 
+//-------------------------------------------------
+//  begin_runahead - start emulating frames that
+//  won't be displayed
+//-------------------------------------------------
+
+void video_manager::begin_runahead()
+{
+	m_runahead_pending = false;
+	m_runahead_skipping = m_skipping_this_frame;
+	m_runahead_mode = runahead_mode::HIDDEN;
+	m_skipping_this_frame = true;
+}
+
+
+//-------------------------------------------------
+//  end_runahead - go back to emulating regular
+//  frames
+//-------------------------------------------------
+
+void video_manager::end_runahead()
+{
+	m_runahead_mode = runahead_mode::NONE;
+	m_skipping_this_frame = m_runahead_skipping;
+}
+
+
 //-------------------------------------------------
 //  speed_text - print the text to be displayed
 //  into a string buffer
@@ -296,6 +394,10 @@ std::string video_manager::speed_text()
 	else if (m_fastforward)
 		str << "fast ";
 
+	// likewise for turbo mode
+	else if (m_turbo)
+		str << "turbo";
+
 	// if we're auto frameskipping, display that plus the level
 	else if (effective_autoframeskip())
 		util::stream_format(str, "auto%2d/%d", effective_frameskip(), m_frameskip_max ? m_frameskip_max : MAX_FRAMESKIP);
@@ -510,6 +612,153 @@ void video_manager::exit()
 		double final_emu_time = m_overall_emutime.as_double();
 		osd_printf_info("Average speed: %.2f%% (%d seconds)\n", 100 * final_emu_time / final_real_time, (m_overall_emutime + attotime(0, ATTOSECONDS_PER_SECOND / 2)).seconds());
 	}
+
+	// write the benchmark report if requested
+	if (!m_bench_report.empty())
+		write_bench_report();
+}
+
+
+//-------------------------------------------------
+//  record_frame_time - note the real time taken
+//  by the frame that just completed
+//-------------------------------------------------
+
+void video_manager::record_frame_time()
+{
+	osd_ticks_t const now = osd_ticks();
+	if (!m_bench_start_ticks)
+	{
+		m_bench_start_ticks = now;
+		m_bench_start_emutime = machine().time();
+	}
+	else
+	{
+		m_bench_frame_ticks.push_back(now - m_bench_last_ticks);
+	}
+	m_bench_last_ticks = now;
+}
+
+
+//-------------------------------------------------
+//  ticks_stddev - get the standard deviation of
+//  a set of intervals in milliseconds, to show
+//  how evenly frames were paced
+//-------------------------------------------------
+
+static double ticks_stddev(const std::vector<osd_ticks_t> &ticks, double tps)
+{
+	if (ticks.size() < 2)
+		return 0.0;
+	double sum = 0.0, squares = 0.0;
+	for (osd_ticks_t const t : ticks)
+	{
+		double const ms = 1000.0 * double(t) / tps;
+		sum += ms;
+		squares += ms * ms;
+	}
+	double const mean = sum / double(ticks.size());
+	return std::sqrt(std::max(0.0, (squares / double(ticks.size())) - (mean * mean)));
+}
+
+
+//-------------------------------------------------
+//  write_bench_report - write a machine-readable
+//  summary of the session's performance
+//-------------------------------------------------
+
+void video_manager::write_bench_report()
+{
+	double const tps = double(osd_ticks_per_second());
+	double const real_seconds = m_bench_start_ticks ? (double(m_bench_last_ticks - m_bench_start_ticks) / tps) : 0.0;
+	double const emu_seconds = m_bench_start_ticks ? (machine().time() - m_bench_start_emutime).as_double() : 0.0;
+
+	rapidjson::StringBuffer s;
+	rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(s);
+	writer.StartObject();
+
+	writer.Key("system");
+	writer.String(machine().system().name);
+	writer.Key("description");
+	writer.String(machine().system().type.fullname());
+	writer.Key("seconds_to_run");
+	writer.Uint(m_seconds_to_run);
+	writer.Key("emulated_seconds");
+	writer.Double(emu_seconds);
+	writer.Key("host_seconds");
+	writer.Double(real_seconds);
+	writer.Key("speed_percent");
+	writer.Double((real_seconds > 0.0) ? (100.0 * emu_seconds / real_seconds) : 0.0);
+	writer.Key("peak_memory_bytes");
+	writer.Uint64(osd_get_peak_memory_usage());
+
+	// frame time distribution in milliseconds
+	std::vector<osd_ticks_t> sorted(m_bench_frame_ticks);
+	std::sort(sorted.begin(), sorted.end());
+	auto const percentile =
+			[&sorted, tps] (unsigned pct)
+			{
+				if (sorted.empty())
+					return 0.0;
+				size_t const index = std::min<size_t>((sorted.size() * pct) / 100, sorted.size() - 1);
+				return 1000.0 * double(sorted[index]) / tps;
+			};
+	writer.Key("frames");
+	writer.Uint64(sorted.size());
+	writer.Key("frame_time_ms");
+	writer.StartObject();
+	writer.Key("mean");
+	writer.Double(sorted.empty() ? 0.0 : (1000.0 * real_seconds / double(sorted.size())));
+	writer.Key("p50");
+	writer.Double(percentile(50));
+	writer.Key("p90");
+	writer.Double(percentile(90));
+	writer.Key("p99");
+	writer.Double(percentile(99));
+	writer.Key("max");
+	writer.Double(sorted.empty() ? 0.0 : (1000.0 * double(sorted.back()) / tps));
+	writer.Key("stddev");
+	writer.Double(ticks_stddev(sorted, tps));
+	writer.EndObject();
+
+	// per-device scheduler statistics if they were collected
+	device_scheduler const &scheduler(machine().scheduler());
+	if (scheduler.profiling())
+	{
+		writer.Key("devices");
+		writer.StartArray();
+		for (device_execute_interface &exec : execute_interface_enumerator(machine().root_device()))
+		{
+			device_scheduler::device_profile const *const prof(scheduler.profile(exec));
+			if (!prof)
+				continue;
+			writer.StartObject();
+			writer.Key("tag");
+			writer.String(exec.device().tag());
+			writer.Key("host_seconds");
+			writer.Double(double(prof->host_ticks) / tps);
+			writer.Key("cycles");
+			writer.Uint64(prof->cycles);
+			writer.Key("timeslices");
+			writer.Uint64(prof->timeslices);
+			writer.Key("aborted");
+			writer.Uint64(prof->aborted);
+			writer.EndObject();
+		}
+		writer.EndArray();
+	}
+
+	writer.EndObject();
+
+	util::core_file::ptr file;
+	std::error_condition const filerr = util::core_file::open(m_bench_report, OPEN_FLAG_WRITE | OPEN_FLAG_CREATE, file);
+	if (filerr)
+	{
+		osd_printf_error("Error opening benchmark report file %s (%s)\n", m_bench_report, filerr.message());
+		return;
+	}
+	file->puts(std::string_view(s.GetString(), s.GetSize()));
+	file->puts("\n");
 }
 
 
@@ -551,7 +800,7 @@ void video_manager::postload()
 inline bool video_manager::effective_autoframeskip() const
 {
 	// if we're fast forwarding or paused, autoframeskip is disabled
-	if (m_fastforward || machine().paused())
+	if (m_fastforward || m_turbo || machine().paused())
 		return false;
 
 	// otherwise, it's up to the user
@@ -589,7 +838,7 @@ inline bool video_manager::effective_throttle() const
 		return true;
 
 	// if we're fast forwarding, we don't throttle
-	if (m_fastforward)
+	if (m_fastforward || m_turbo)
 		return false;
 
 	// otherwise, it's up to the user
@@ -638,7 +887,7 @@ bool video_manager::finish_screen_updates()
 			anything_changed = true;
 
 	// update our movie recording and burn-in state
-	if (!machine().paused())
+	if (!machine().paused() && (m_runahead_mode == runahead_mode::NONE))
 	{
 		record_frame();
 
@@ -794,6 +1043,126 @@ void video_manager::update_throttle(attotime emutime)
 }
 
 
+//-------------------------------------------------
+//  record_present - measure the time between
+//  presented frames
+//-------------------------------------------------
+
+void video_manager::record_present()
+{
+	osd_ticks_t const now = osd_ticks();
+	osd_ticks_t const interval = now - m_present_last_ticks;
+	m_present_last_ticks = now;
+
+	// ignore gaps from pausing, loading states and the like
+	if (interval < (osd_ticks_per_second() / 10))
+		m_present_period = m_present_period ? ((m_present_period * 15) + interval) / 16 : interval;
+}
+
+
+//-------------------------------------------------
+//  display_paced - check whether waiting for the
+//  display's VBLANK can replace throttling
+//-------------------------------------------------
+
+bool video_manager::display_paced() const
+{
+	if (!m_display_pacing || !m_present_period || !m_speed || machine().paused() || m_fastforward || m_turbo || m_runahead_frames)
+		return false;
+
+	// presents must be arriving once per emulated frame, to within 2%, or we fall back to throttling
+	screen_device const *const screen = screen_device_enumerator(machine().root_device()).first();
+	if (!screen || !screen->frame_period().attoseconds())
+		return false;
+	double const emulated = screen->frame_period().as_double() * 1000.0 / m_speed;
+	double const measured = double(m_present_period) / double(osd_ticks_per_second());
+	return std::abs(measured - emulated) < (emulated * 0.02);
+}
+
+
+//-------------------------------------------------
+//  beam_racing - check whether a slice of the
+//  screen can be presented now
+//-------------------------------------------------
+
+bool video_manager::beam_racing(const screen_device &screen)
+{
+	// only while regular frames are displayed at full speed
+	if ((m_runahead_mode != runahead_mode::NONE) || m_runahead_frames || machine().paused() || !effective_throttle() || (machine().debug_flags & DEBUG_FLAG_ENABLED))
+		return false;
+
+	// slices only line up with the host scanout if the refresh rates match to within half a percent
+	double const host = machine().render().max_update_rate();
+	double const emulated = ATTOSECONDS_TO_HZ(screen.frame_period().attoseconds()) * m_speed / 1000.0;
+	bool const matched = (host != 0) && (std::abs(host - emulated) < (emulated * 0.005));
+	if (matched != m_beam_racing)
+	{
+		osd_printf_verbose("Beam racing %s (host=%.3fHz, system=%.3fHz)\n", matched ? "enabled" : "disabled", host, emulated);
+		m_beam_racing = matched;
+	}
+	return matched;
+}
+
+
+//-------------------------------------------------
+//  present_slice - wait until real time catches
+//  up with the emulated beam and present
+//-------------------------------------------------
+
+void video_manager::present_slice()
+{
+	update_throttle(machine().time());
+
+	auto profile = g_profiler.start(PROFILER_BLIT);
+	auto trace = g_tracer.begin("osd update");
+	machine().osd().update(false);
+}
+
+
+//-------------------------------------------------
+//  apply_frame_delay - wait part of a frame after
+//  throttling, so there's less time between
+//  polling inputs and emulating with them
+//-------------------------------------------------
+
+void video_manager::apply_frame_delay(const attotime &emutime, osd_ticks_t throttle_ticks)
+{
+	osd_ticks_t const now = osd_ticks();
+	osd_ticks_t const ticks_per_second = osd_ticks_per_second();
+
+	// work out how long a frame lasts in real time, ignoring anomalies like resets or loading states
+	attoseconds_t emu_delta = (emutime - m_frame_delay_emutime).as_attoseconds();
+	m_frame_delay_emutime = emutime;
+	if (emu_delta <= 0 || emu_delta > ATTOSECONDS_PER_SECOND / 10 || !m_frame_delay_polled)
+	{
+		m_frame_delay_polled = now;
+		m_frame_delay_busy = 0;
+		return;
+	}
+	if (m_speed != 0 && m_speed != 1000)
+		emu_delta = emu_delta * 1000 / m_speed;
+	attoseconds_t const attoseconds_per_tick = ATTOSECONDS_PER_SECOND / ticks_per_second * m_throttle_rate;
+	osd_ticks_t const period = attoseconds_per_tick ? osd_ticks_t(emu_delta / attoseconds_per_tick) : 0;
+	osd_ticks_t delay = period * m_frame_delay / 10;
+
+	// time spent emulating and rendering since the last poll is what's left after throttling
+	if (m_frame_delay_auto)
+	{
+		osd_ticks_t const elapsed = now - m_frame_delay_polled;
+		osd_ticks_t const busy = (elapsed > throttle_ticks) ? (elapsed - throttle_ticks) : 0;
+		m_frame_delay_busy = std::max(busy, m_frame_delay_busy - (m_frame_delay_busy / 64));
+
+		// leave a quarter again of the slowest recent frame plus a millisecond as headroom
+		osd_ticks_t const needed = m_frame_delay_busy + (m_frame_delay_busy / 4) + (ticks_per_second / 1000);
+		delay = std::min(delay, (period > needed) ? (period - needed) : 0);
+	}
+
+	if (delay)
+		throttle_until_ticks(now + delay);
+	m_frame_delay_polled = osd_ticks();
+}
+
+
 //-------------------------------------------------
 //  throttle_until_ticks - spin until the
 //  specified target time, calling the OSD code
@@ -808,6 +1177,7 @@ osd_ticks_t video_manager::throttle_until_ticks(osd_ticks_t target_ticks)
 
 	// loop until we reach our target
 	auto profile = g_profiler.start(PROFILER_IDLE);
+	auto trace = g_tracer.begin("throttle");
 	osd_ticks_t current_ticks = osd_ticks();
 	while (current_ticks < target_ticks)
 	{
@@ -894,6 +1264,15 @@ void video_manager::update_frameskip()
 	// increment the frameskip counter and determine if we will skip the next frame
 	m_frameskip_counter = (m_frameskip_counter + 1) % FRAMESKIP_LEVELS;
 	m_skipping_this_frame = s_skiptable[effective_frameskip()][m_frameskip_counter];
+
+	// in turbo mode, screen updates are skipped except for a few frames a second to keep the user interface usable
+	if (m_turbo && !machine().paused())
+	{
+		osd_ticks_t const now = osd_ticks();
+		m_skipping_this_frame = (now - m_turbo_shown_ticks) < (osd_ticks_per_second() / TURBO_REFRESH_RATE);
+		if (!m_skipping_this_frame)
+			m_turbo_shown_ticks = now;
+	}
 }
 
 
@@ -968,7 +1347,7 @@ void video_manager::recompute_speed(const attotime &emutime)
 		m_speed_last_emutime = emutime;
 
 		// if we're throttled, this time period counts for overall speed; otherwise, we reset the counter
-		if (!m_fastforward)
+		if (!m_fastforward && !m_turbo)
 			m_overall_valid_counter++;
 		else
 			m_overall_valid_counter = 0;
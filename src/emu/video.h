@@ -53,12 +53,14 @@ public:
 	bool throttled() const { return m_throttled; }
 	float throttle_rate() const { return m_throttle_rate; }
 	bool fastforward() const { return m_fastforward; }
+	bool turbo() const { return m_turbo; }
 
 	// setters
 	void set_frameskip(int frameskip);
 	void set_throttled(bool throttled) { m_throttled = throttled; }
 	void set_throttle_rate(float throttle_rate) { m_throttle_rate = throttle_rate; }
 	void set_fastforward(bool ffwd) { m_fastforward = ffwd; }
+	void set_turbo(bool turbo) { m_turbo = turbo; m_turbo_shown_ticks = 0; }
 	void set_output_changed() { m_output_changed = true; }
 
 	// misc
@@ -70,9 +72,25 @@ public:
 	// render a frame
 	void frame_update(bool from_debugger = false);
 
+	// run-ahead support
+	bool runahead_pending() const { return m_runahead_pending; }
+	u32 frame_count() const { return m_frame_count; }
+	void begin_runahead();
+	void set_runahead_last_frame() { m_runahead_mode = runahead_mode::LAST; m_skipping_this_frame = false; }
+	void end_runahead();
+
+	// beam racing: present the screen in slices as it's drawn
+	bool beam_racing(const screen_device &screen);
+	void present_slice();
+
+	// network play re-simulation: frames aren't displayed, but frame notifiers run
+	void begin_resimulation() { begin_runahead(); m_resimulating = true; }
+	void end_resimulation() { m_resimulating = false; end_runahead(); }
+
 	// current speed helpers
 	std::string speed_text();
 	double speed_percent() const { return m_speed_percent; }
+	double present_period() const { return m_present_period ? (double(m_present_period) / double(osd_ticks_per_second())) : 0.0; }
 	int effective_frameskip() const;
 
 	// snapshots
@@ -88,6 +106,14 @@ public:
 	bool is_recording() const { return !m_movie_recordings.empty(); }
 
 private:
+	// run-ahead frame types
+	enum class runahead_mode
+	{
+		NONE,   // regular frame
+		HIDDEN, // frame run ahead, not displayed
+		LAST    // last frame run ahead, displayed without throttling
+	};
+
 	// internal helpers
 	void exit();
 	void screenless_update_callback(int param);
@@ -102,9 +128,14 @@ private:
 	bool finish_screen_updates();
 	void update_throttle(attotime emutime);
 	osd_ticks_t throttle_until_ticks(osd_ticks_t target_ticks);
+	void apply_frame_delay(const attotime &emutime, osd_ticks_t throttle_ticks);
+	void record_present();
+	bool display_paced() const;
 	void update_frameskip();
 	void update_refresh_speed();
 	void recompute_speed(const attotime &emutime);
+	void record_frame_time();
+	void write_bench_report();
 
 	// snapshot/movie helpers
 	void create_snapshot_bitmap(screen_device *screen);
@@ -141,6 +172,8 @@ private:
 	bool                m_throttled;                // flag: true if we're currently throttled
 	float               m_throttle_rate;            // target rate for throttling
 	bool                m_fastforward;              // flag: true if we're currently fast-forwarding
+	bool                m_turbo;                    // flag: true if we're running without drawing most frames or mixing sound
+	osd_ticks_t         m_turbo_shown_ticks;        // osd_ticks when the last frame was drawn in turbo mode
 	u32                 m_seconds_to_run;           // number of seconds to run before quitting
 	bool                m_auto_frameskip;           // flag: true if we're automatically frameskipping
 	u32                 m_speed;                    // overall speed (*1000)
@@ -155,6 +188,36 @@ private:
 	bool                m_skipping_this_frame;      // flag: true if we are skipping the current frame
 	osd_ticks_t         m_average_oversleep;        // average number of ticks the OSD oversleeps
 
+	// frame delay
+	u8                  m_frame_delay;              // tenths of a frame to wait before polling inputs (maximum if automatic)
+	bool                m_frame_delay_auto;         // flag: true if the delay is limited by the measured emulation time
+	attotime            m_frame_delay_emutime;      // emulated time at the last frame delay
+	osd_ticks_t         m_frame_delay_polled;       // osd_ticks when inputs were last polled after a delay
+	osd_ticks_t         m_frame_delay_busy;         // decaying peak of ticks spent emulating a frame
+
+	// run-ahead
+	u32                 m_runahead_frames;          // number of frames to run ahead (0 == disabled)
+	runahead_mode       m_runahead_mode;            // type of frame being emulated
+	bool                m_runahead_pending;         // flag: true if a frame was completed without being displayed
+	bool                m_runahead_skipping;        // frameskip state saved while running ahead
+	bool                m_resimulating;             // flag: true while network play emulates frames again
+
+	// beam racing
+	bool                m_beam_racing;              // flag: true if the host refresh rate matched when last checked
+
+	// display pacing
+	bool                m_display_pacing;           // flag: true if the OSD waits for VBLANK when presenting
+	osd_ticks_t         m_present_last_ticks;       // osd_ticks after the last present
+	osd_ticks_t         m_present_period;           // smoothed ticks between presents (0 == unknown)
+	u32                 m_frame_count;              // number of frames completed
+
+	// benchmark report
+	std::string         m_bench_report;             // path to write the report to (empty == disabled)
+	osd_ticks_t         m_bench_start_ticks;        // real time when the first frame was recorded
+	attotime            m_bench_start_emutime;      // emulated time when the first frame was recorded
+	osd_ticks_t         m_bench_last_ticks;         // real time when the last frame was recorded
+	std::vector<osd_ticks_t> m_bench_frame_ticks;   // real time taken by each frame
+
 	// snapshot stuff
 	render_target *     m_snap_target;              // screen shapshot target
 	bitmap_rgb32        m_snap_bitmap;              // screen snapshot bitmap
@@ -169,6 +232,7 @@ private:
 
 	static const attoseconds_t ATTOSECONDS_PER_SPEED_UPDATE = ATTOSECONDS_PER_SECOND / 4;
 	static const int PAUSED_REFRESH_RATE = 30;
+	static const int TURBO_REFRESH_RATE = 10;
 };
 
 #endif // MAME_EMU_VIDEO_H
@@ -0,0 +1,43 @@
+// license:BSD-3-Clause
+// copyright-holders:Vas Crabb, Ryan Holtz
+/***************************************************************************
+
+    rgbneon.cpp
+
+    NEON optimised RGB utilities.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "simd.h"
+
+#if defined(MAME_SIMD_NEON) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+
+#include "rgbutil.h"
+
+
+/***************************************************************************
+    HIGHER LEVEL OPERATIONS
+***************************************************************************/
+
+void rgbaint_t::blend(const rgbaint_t& other, u8 factor)
+{
+	m_value = vmlaq_n_s32(vmulq_n_s32(m_value, factor), other.m_value, 0x100 - factor);
+	sra_imm(8);
+}
+
+void rgbaint_t::scale_and_clamp(const rgbaint_t& scale)
+{
+	mul(scale);
+	sra_imm(8);
+	clamp_to_uint8();
+}
+
+void rgbaint_t::scale_imm_and_clamp(s32 scale)
+{
+	mul_imm(scale);
+	sra_imm(8);
+	clamp_to_uint8();
+}
+
+#endif // defined(MAME_SIMD_NEON) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
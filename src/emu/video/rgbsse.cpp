@@ -11,8 +11,9 @@
 ***************************************************************************/
 
 #include "emu.h"
+#include "simd.h"
 
-#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#if defined(MAME_SIMD_SSE2)
 
 #include "rgbsse.h"
 
@@ -185,4 +186,4 @@ void rgbaint_t::scale_and_clamp(const rgbaint_t& scale)
 	clamp_to_uint8();
 }
 
-#endif // (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#endif // defined(MAME_SIMD_SSE2)
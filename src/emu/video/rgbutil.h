@@ -12,12 +12,20 @@
 #ifndef MAME_EMU_VIDEO_RGBUTIL_H
 #define MAME_EMU_VIDEO_RGBUTIL_H
 
-// use SSE on 64-bit implementations, where it can be assumed
-#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#include "simd.h"
+
+// use SSE where it can be assumed
+#if defined(MAME_SIMD_SSE2)
 
 #define MAME_RGB_HIGH_PRECISION
 #include "rgbsse.h"
 
+// use NEON on ARM implementations that have it
+#elif defined(MAME_SIMD_NEON) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+
+#define MAME_RGB_HIGH_PRECISION
+#include "rgbneon.h"
+
 #elif defined(__ALTIVEC__)
 
 #define MAME_RGB_HIGH_PRECISION
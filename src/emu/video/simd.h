@@ -0,0 +1,33 @@
+// license:BSD-3-Clause
+// copyright-holders:Vas Crabb
+/***************************************************************************
+
+    simd.h
+
+    Selects the SIMD instruction set that hand-vectorised code paths
+    may use.  Defines MAME_SIMD_SSE2 or MAME_SIMD_NEON, and includes
+    the matching intrinsics header.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_VIDEO_SIMD_H
+#define MAME_EMU_VIDEO_SIMD_H
+
+#pragma once
+
+// SSE2 is part of x86-64, and 32-bit builds may be told they can use it;
+// unoptimised debug builds use the portable code so it stays exercised
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+
+#define MAME_SIMD_SSE2
+#include <emmintrin.h>
+
+// NEON is part of AArch64, and 32-bit ARM builds may be told they can use it
+#elif (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64))
+
+#define MAME_SIMD_NEON
+#include <arm_neon.h>
+
+#endif
+
+#endif // MAME_EMU_VIDEO_SIMD_H
@@ -0,0 +1,264 @@
+// license:BSD-3-Clause
+// copyright-holders:Vas Crabb
+/***************************************************************************
+
+    cheatsearch.cpp
+
+    Native cheat search engine.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "cheatsearch.h"
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+
+//**************************************************************************
+//  CHEAT SEARCH
+//**************************************************************************
+
+//-------------------------------------------------
+//  cheat_search - constructor
+//-------------------------------------------------
+
+cheat_search::cheat_search(void *base, size_t bytes, u8 bytewidth, endianness_t endianness, unsigned size, bool is_signed)
+	: m_base(reinterpret_cast<const u8 *>(base))
+	, m_bytes(bytes)
+	, m_bytewidth(bytewidth ? bytewidth : 1)
+	, m_endianness(endianness)
+	, m_size(((size == 1) || (size == 2) || (size == 4) || (size == 8)) ? size : 1)
+	, m_signed(is_signed)
+	, m_count(bytes / m_size)
+	, m_candidates_left(0)
+{
+	reset();
+}
+
+
+//-------------------------------------------------
+//  reset - take a fresh snapshot and make every
+//  value a candidate again
+//-------------------------------------------------
+
+void cheat_search::reset()
+{
+	read(m_snapshot);
+	m_prior = m_snapshot;
+
+	m_candidates.assign((m_count + 63) / 64, ~u64(0));
+	if (m_count % 64)
+		m_candidates.back() = (u64(1) << (m_count % 64)) - 1;
+	m_candidates_left = m_count;
+}
+
+
+//-------------------------------------------------
+//  filter - keep the candidates that pass a
+//  comparison and take a new snapshot, returning
+//  the number of candidates left
+//-------------------------------------------------
+
+size_t cheat_search::filter(op comparison, u64 operand)
+{
+	// read into the older buffer, so it becomes the latest snapshot
+	std::swap(m_prior, m_snapshot);
+	read(m_snapshot);
+
+	switch (m_size)
+	{
+	case 1: m_signed ? filter<s8>(comparison, operand)  : filter<u8>(comparison, operand);  break;
+	case 2: m_signed ? filter<s16>(comparison, operand) : filter<u16>(comparison, operand); break;
+	case 4: m_signed ? filter<s32>(comparison, operand) : filter<u32>(comparison, operand); break;
+	case 8: m_signed ? filter<s64>(comparison, operand) : filter<u64>(comparison, operand); break;
+	}
+	count_candidates();
+	return m_candidates_left;
+}
+
+
+//-------------------------------------------------
+//  exclude - stop considering the value at a byte
+//  offset
+//-------------------------------------------------
+
+void cheat_search::exclude(offs_t offset)
+{
+	size_t const index = offset / m_size;
+	if (m_count > index)
+	{
+		u64 &word = m_candidates[index / 64];
+		u64 const bit = u64(1) << (index % 64);
+		if (word & bit)
+		{
+			word &= ~bit;
+			--m_candidates_left;
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  matches - get up to a given number of the
+//  remaining candidates
+//-------------------------------------------------
+
+std::vector<cheat_search::match> cheat_search::matches(size_t limit) const
+{
+	std::vector<match> result;
+	result.reserve(std::min(limit, m_candidates_left));
+	for (size_t word = 0; (m_candidates.size() > word) && (limit > result.size()); ++word)
+	{
+		for (u64 bits = m_candidates[word]; bits && (limit > result.size()); bits &= bits - 1)
+		{
+			size_t const index = (word * 64) + population_count_64((bits & -bits) - 1);
+			match &m = result.emplace_back();
+			m.offset = offs_t(index * m_size);
+			switch (m_size)
+			{
+			case 1: m.value = value<u8>(m_snapshot, index);  m.previous = value<u8>(m_prior, index);  break;
+			case 2: m.value = value<u16>(m_snapshot, index); m.previous = value<u16>(m_prior, index); break;
+			case 4: m.value = value<u32>(m_snapshot, index); m.previous = value<u32>(m_prior, index); break;
+			case 8: m.value = value<u64>(m_snapshot, index); m.previous = value<u64>(m_prior, index); break;
+			}
+		}
+	}
+	return result;
+}
+
+
+//-------------------------------------------------
+//  parse_op - get a comparison from its name
+//-------------------------------------------------
+
+std::optional<cheat_search::op> cheat_search::parse_op(std::string_view name)
+{
+	if ((name == "eq") || (name == "equal"))
+		return op::EQUAL;
+	else if ((name == "ne") || (name == "notequal"))
+		return op::NOT_EQUAL;
+	else if ((name == "lt") || (name == "less"))
+		return op::LESS;
+	else if ((name == "gt") || (name == "greater"))
+		return op::GREATER;
+	else if (name == "changed")
+		return op::CHANGED;
+	else if (name == "unchanged")
+		return op::UNCHANGED;
+	else if (name == "increased")
+		return op::INCREASED;
+	else if (name == "decreased")
+		return op::DECREASED;
+	else if (name == "delta")
+		return op::DELTA;
+	else
+		return std::nullopt;
+}
+
+
+//-------------------------------------------------
+//  read - copy the block in logical byte order
+//-------------------------------------------------
+
+void cheat_search::read(std::vector<u8> &dest) const
+{
+	dest.resize(m_bytes);
+	if ((m_bytewidth == 1) || (m_endianness == ENDIANNESS_NATIVE))
+	{
+		std::memcpy(dest.data(), m_base, m_bytes);
+	}
+	else
+	{
+		// words are stored in host order, so bytes within them are reversed
+		size_t const flip = m_bytewidth - 1;
+		for (size_t i = 0; m_bytes > i; ++i)
+			dest[i] = m_base[i ^ flip];
+	}
+}
+
+
+//-------------------------------------------------
+//  value - assemble a value from a snapshot
+//-------------------------------------------------
+
+template <typename T>
+inline T cheat_search::value(const std::vector<u8> &buffer, size_t index) const
+{
+	T result;
+	std::memcpy(&result, &buffer[index * sizeof(T)], sizeof(T));
+	if constexpr (sizeof(T) > 1)
+	{
+		if (m_endianness != ENDIANNESS_NATIVE)
+		{
+			using unsigned_t = std::make_unsigned_t<T>;
+			unsigned_t raw = unsigned_t(result);
+			if constexpr (sizeof(T) == 2)
+				raw = swapendian_int16(raw);
+			else if constexpr (sizeof(T) == 4)
+				raw = swapendian_int32(raw);
+			else
+				raw = swapendian_int64(raw);
+			result = T(raw);
+		}
+	}
+	return result;
+}
+
+
+//-------------------------------------------------
+//  filter - apply a comparison to values of a
+//  given type
+//-------------------------------------------------
+
+template <typename T>
+void cheat_search::filter(op comparison, u64 operand)
+{
+	T const o = T(operand);
+	switch (comparison)
+	{
+	case op::EQUAL:     filter<T>([o] (T cur, T prev) { return cur == o; });              break;
+	case op::NOT_EQUAL: filter<T>([o] (T cur, T prev) { return cur != o; });              break;
+	case op::LESS:      filter<T>([o] (T cur, T prev) { return cur < o; });               break;
+	case op::GREATER:   filter<T>([o] (T cur, T prev) { return cur > o; });               break;
+	case op::CHANGED:   filter<T>([] (T cur, T prev) { return cur != prev; });            break;
+	case op::UNCHANGED: filter<T>([] (T cur, T prev) { return cur == prev; });            break;
+	case op::INCREASED: filter<T>([] (T cur, T prev) { return cur > prev; });             break;
+	case op::DECREASED: filter<T>([] (T cur, T prev) { return cur < prev; });             break;
+	case op::DELTA:     filter<T>([o] (T cur, T prev) { return T(cur - prev) == o; });    break;
+	}
+}
+
+template <typename T, typename U>
+void cheat_search::filter(U &&pred)
+{
+	for (size_t word = 0; m_candidates.size() > word; ++word)
+	{
+		u64 const bits = m_candidates[word];
+		if (!bits)
+			continue;
+
+		// compare a whole word's worth of values at once so the loop can be vectorised
+		size_t const base = word * 64;
+		size_t const n = std::min<size_t>(m_count - base, 64);
+		u64 keep = 0;
+		for (size_t i = 0; n > i; ++i)
+			keep |= u64(pred(value<T>(m_snapshot, base + i), value<T>(m_prior, base + i)) ? 1 : 0) << i;
+		m_candidates[word] = bits & keep;
+	}
+}
+
+
+//-------------------------------------------------
+//  count_candidates - update the number of
+//  candidates left
+//-------------------------------------------------
+
+void cheat_search::count_candidates()
+{
+	size_t count = 0;
+	for (u64 const bits : m_candidates)
+		count += population_count_64(bits);
+	m_candidates_left = count;
+}
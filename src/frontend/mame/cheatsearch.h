@@ -0,0 +1,106 @@
+// license:BSD-3-Clause
+// copyright-holders:Vas Crabb
+/***************************************************************************
+
+    cheatsearch.h
+
+    Native cheat search engine.
+
+****************************************************************************
+
+    A search covers a block of emulated memory, such as a memory region
+    or share, treated as an array of aligned values of one size.  Every
+    value starts out as a candidate; each filter compares the current
+    contents with the snapshot taken by the previous step (or with a
+    given value) and keeps only the candidates that pass, then takes a
+    new snapshot.
+
+    Contents are copied into a snapshot in logical byte order when
+    they're read, so values are assembled with the block's endianness
+    regardless of how the host stores it.  Candidates are a bitset, and
+    filters work through it 64 values at a time, skipping words with no
+    candidates left, so late steps of a search touch little memory.
+
+***************************************************************************/
+
+#ifndef MAME_FRONTEND_CHEATSEARCH_H
+#define MAME_FRONTEND_CHEATSEARCH_H
+
+#pragma once
+
+#include <optional>
+#include <string_view>
+#include <vector>
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// ======================> cheat_search
+
+class cheat_search
+{
+public:
+	// comparisons a filter can make
+	enum class op
+	{
+		EQUAL,          // current value equals the operand
+		NOT_EQUAL,      // current value doesn't equal the operand
+		LESS,           // current value is less than the operand
+		GREATER,        // current value is greater than the operand
+		CHANGED,        // value differs from the snapshot
+		UNCHANGED,      // value is the same as the snapshot
+		INCREASED,      // value is greater than in the snapshot
+		DECREASED,      // value is less than in the snapshot
+		DELTA           // value changed by exactly the operand since the snapshot
+	};
+
+	// a remaining candidate
+	struct match
+	{
+		offs_t          offset;         // byte offset into the block
+		u64             value;          // value in the latest snapshot
+		u64             previous;       // value in the snapshot before that
+	};
+
+	// construction/destruction
+	cheat_search(void *base, size_t bytes, u8 bytewidth, endianness_t endianness, unsigned size, bool is_signed);
+
+	// getters
+	unsigned size() const { return m_size; }
+	bool is_signed() const { return m_signed; }
+	size_t value_count() const { return m_count; }
+	size_t candidate_count() const { return m_candidates_left; }
+
+	// searching
+	void reset();
+	size_t filter(op comparison, u64 operand);
+	void exclude(offs_t offset);
+	std::vector<match> matches(size_t limit) const;
+
+	// helpers
+	static std::optional<op> parse_op(std::string_view name);
+
+private:
+	void read(std::vector<u8> &dest) const;
+	template <typename T> T value(const std::vector<u8> &buffer, size_t index) const;
+	template <typename T> void filter(op comparison, u64 operand);
+	template <typename T, typename U> void filter(U &&pred);
+	void count_candidates();
+
+	// internal state
+	const u8 *              m_base;             // start of the block
+	size_t                  m_bytes;            // length of the block in bytes
+	u8                      m_bytewidth;        // width of a word in the block
+	endianness_t            m_endianness;       // byte order of the block
+	unsigned                m_size;             // bytes per value
+	bool                    m_signed;           // compare values as signed
+	size_t                  m_count;            // number of values in the block
+	std::vector<u8>         m_snapshot;         // contents at the latest step, in logical byte order
+	std::vector<u8>         m_prior;            // contents at the step before
+	std::vector<u64>        m_candidates;       // one bit per value still being considered
+	size_t                  m_candidates_left;  // number of bits set in m_candidates
+};
+
+#endif // MAME_FRONTEND_CHEATSEARCH_H
@@ -38,9 +38,16 @@
 #include "osdepend.h"
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <future>
+#include <mutex>
 #include <new>
 #include <set>
+#include <thread>
 #include <tuple>
+#include <unordered_map>
 #include <cctype>
 #include <iostream>
 
@@ -133,10 +140,9 @@ const options_entry cli_option_entries[] =
 
 
 void print_summary(
-		const media_auditor &auditor, media_auditor::summary summary, bool record_none_needed,
+		const char *details, media_auditor::summary summary, bool record_none_needed,
 		const char *type, const char *name, const char *parent,
-		unsigned &correct, unsigned &incorrect, unsigned &notfound,
-		util::ovectorstream &buffer)
+		unsigned &correct, unsigned &incorrect, unsigned &notfound)
 {
 	if (summary == media_auditor::NOTFOUND)
 	{
@@ -146,11 +152,7 @@ void print_summary(
 	else if (record_none_needed || (summary != media_auditor::NONE_NEEDED))
 	{
 		// output the summary of the audit
-		buffer.clear();
-		buffer.seekp(0);
-		auditor.summarize(name, &buffer);
-		buffer.put('\0');
-		osd_printf_info("%s", &buffer.vec()[0]);
+		osd_printf_info("%s", details);
 
 		// output the name of the driver and its parent
 		osd_printf_info("%sset %s ", type, name);
@@ -185,6 +187,23 @@ void print_summary(
 	}
 }
 
+
+void print_summary(
+		const media_auditor &auditor, media_auditor::summary summary, bool record_none_needed,
+		const char *type, const char *name, const char *parent,
+		unsigned &correct, unsigned &incorrect, unsigned &notfound,
+		util::ovectorstream &buffer)
+{
+	// format the details of the audit if they'll be shown
+	buffer.clear();
+	buffer.seekp(0);
+	if ((summary != media_auditor::NOTFOUND) && (record_none_needed || (summary != media_auditor::NONE_NEEDED)))
+		auditor.summarize(name, &buffer);
+	buffer.put('\0');
+
+	print_summary(&buffer.vec()[0], summary, record_none_needed, type, name, parent, correct, incorrect, notfound);
+}
+
 } // anonymous namespace
 
 
@@ -991,23 +1010,14 @@ void cli_frontend::verifyroms(const std::vector<std::string> &args)
 	unsigned incorrect = 0;
 	unsigned notfound = 0;
 
-	// iterate over drivers
+	// collect the matching drivers
 	driver_enumerator drivlist(m_options);
-	media_auditor auditor(drivlist);
-	util::ovectorstream summary_string;
+	std::vector<std::size_t> systems;
 	while (drivlist.next())
 	{
 		if (included(drivlist.driver().name))
 		{
-			// audit the ROMs in this set
-			media_auditor::summary summary = auditor.audit_media(AUDIT_VALIDATE_FAST);
-
-			auto const clone_of = drivlist.clone();
-			print_summary(
-					auditor, summary, true,
-					"rom", drivlist.driver().name, (clone_of >= 0) ? drivlist.driver(clone_of).name : nullptr,
-					correct, incorrect, notfound,
-					summary_string);
+			systems.emplace_back(drivlist.current());
 
 			// if it wasn't a wildcard, there can only be one
 			if (!iswild)
@@ -1015,8 +1025,108 @@ void cli_frontend::verifyroms(const std::vector<std::string> &args)
 		}
 	}
 
+	// group clones with their parents so a family's archives are opened in
+	// succession by one worker, which lets them hit the archive cache
+	std::vector<std::vector<std::size_t> > families;
+	{
+		std::unordered_map<int, std::size_t> familymap;
+		for (std::size_t i = 0; systems.size() > i; ++i)
+		{
+			int root = systems[i];
+			for (int parent = driver_list::non_bios_clone(root); 0 <= parent; parent = driver_list::non_bios_clone(parent))
+				root = parent;
+			auto const ins = familymap.emplace(root, families.size());
+			if (ins.second)
+				families.emplace_back();
+			families[ins.first->second].emplace_back(i);
+		}
+	}
+
+	// audit families on worker threads
+	struct audit_result
+	{
+		media_auditor::summary  summary = media_auditor::NOTFOUND;
+		std::string             details;
+		bool                    ready = false;
+	};
+	std::vector<audit_result> results(systems.size());
+	std::mutex resultmutex;
+	std::condition_variable resultcond;
+	std::exception_ptr failure;
+	std::atomic<std::size_t> nextfamily(0);
+	std::atomic<bool> cancel(false);
+	auto const audit_families =
+			[this, &systems, &families, &results, &resultmutex, &resultcond, &failure, &nextfamily, &cancel] ()
+			{
+				try
+				{
+					driver_enumerator enumerator(m_options);
+					media_auditor auditor(enumerator);
+					util::ovectorstream buffer;
+					for (std::size_t family = nextfamily++; (families.size() > family) && !cancel; family = nextfamily++)
+					{
+						for (std::size_t i : families[family])
+						{
+							// audit the ROMs in this set
+							enumerator.set_current(systems[i]);
+							media_auditor::summary const summary = auditor.audit_media(AUDIT_VALIDATE_FAST);
+							buffer.clear();
+							buffer.seekp(0);
+							if (media_auditor::NOTFOUND != summary)
+								auditor.summarize(enumerator.driver().name, &buffer);
+							buffer.put('\0');
+
+							{
+								std::lock_guard<std::mutex> lock(resultmutex);
+								results[i].summary = summary;
+								results[i].details = &buffer.vec()[0];
+								results[i].ready = true;
+							}
+							resultcond.notify_all();
+						}
+					}
+				}
+				catch (...)
+				{
+					std::lock_guard<std::mutex> lock(resultmutex);
+					if (!failure)
+						failure = std::current_exception();
+					cancel = true;
+					resultcond.notify_all();
+				}
+			};
+	std::vector<std::future<void> > workers;
+	unsigned const threads = std::min<std::size_t>(std::max(std::thread::hardware_concurrency(), 1U), families.size());
+	for (unsigned i = 0; threads > i; ++i)
+		workers.emplace_back(std::async(std::launch::async, audit_families));
+
+	// report results in driver order as they become available
+	for (std::size_t i = 0; systems.size() > i; ++i)
+	{
+		audit_result result;
+		{
+			std::unique_lock<std::mutex> lock(resultmutex);
+			resultcond.wait(lock, [&results, &failure, i] () { return results[i].ready || failure; });
+			if (!results[i].ready)
+				break;
+			result = std::move(results[i]);
+		}
+
+		auto const clone_of = drivlist.clone(systems[i]);
+		print_summary(
+				result.details.c_str(), result.summary, true,
+				"rom", drivlist.driver(systems[i]).name, (clone_of >= 0) ? drivlist.driver(clone_of).name : nullptr,
+				correct, incorrect, notfound);
+	}
+	for (std::future<void> &worker : workers)
+		worker.wait();
+	if (failure)
+		std::rethrow_exception(failure);
+
 	if (iswild || !matchcount)
 	{
+		media_auditor auditor(drivlist);
+		util::ovectorstream summary_string;
 		machine_config config(GAME_NAME(___empty), m_options);
 		machine_config::token const tok(config.begin_configuration(config.root_device()));
 		for (device_type type : registered_device_types)
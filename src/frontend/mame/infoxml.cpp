@@ -524,7 +524,7 @@ void info_xml_creator::output(std::ostream &out, const std::function<bool(const
 				break;
 
 			// do the dirty work asynchronously
-			auto task_proc = [&drivlist, drivers = std::move(drivers), include_devices, &active_task_count]
+			auto task_proc = [&drivlist, drivers = std::move(drivers), track_devices = bool(devset), &active_task_count]
 					{
 						prepared_info result;
 						std::ostringstream stream;
@@ -532,7 +532,7 @@ void info_xml_creator::output(std::ostream &out, const std::function<bool(const
 
 						// output each of the drivers
 						for (const game_driver &driver : drivers)
-							output_one(stream, drivlist, driver, include_devices ? &result.m_dev_set : nullptr);
+							output_one(stream, drivlist, driver, track_devices ? &result.m_dev_set : nullptr);
 
 						// capture the XML snippet
 						result.m_xml_snippet = std::move(stream).str();
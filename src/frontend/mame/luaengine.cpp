@@ -18,7 +18,9 @@
 
 #include "imagedev/cassette.h"
 
+#include "bootstate.h"
 #include "debugger.h"
+#include "divtlb.h"
 #include "drivenum.h"
 #include "emuopts.h"
 #include "fileio.h"
@@ -587,20 +589,18 @@ void lua_engine::set_machine(running_machine *machine)
 template <typename T>
 size_t lua_engine::enumerate_functions(const char *id, T &&callback)
 {
+	auto const found = m_functions.find(id);
+	if (m_functions.end() == found)
+		return 0;
+
+	// callbacks may register more functions, so don't hold iterators
+	std::vector<sol::protected_function> const &functions = found->second;
 	size_t count = 0;
-	sol::object functable = sol().registry()[id];
-	if (functable.is<sol::table>())
+	while (functions.size() > count)
 	{
-		for (auto &func : functable.as<sol::table>())
-		{
-			if (func.second.is<sol::protected_function>())
-			{
-				bool cont = callback(func.second.as<sol::protected_function>());
-				count++;
-				if (!cont)
-					break;
-			}
-		}
+		bool const cont = callback(functions[count++]);
+		if (!cont)
+			break;
 	}
 	return count;
 }
@@ -611,11 +611,36 @@ bool lua_engine::execute_function(const char *id)
 			id,
 			[this] (const sol::protected_function &func)
 			{
-				auto ret = invoke(func);
-				if (!ret.valid())
+				// reuse a thread a previous callback ran to completion on rather than creating one every time
+				sol::thread th;
+				if (m_spare_threads.empty())
 				{
-					sol::error err = ret;
-					osd_printf_error("[LUA ERROR] in execute_function: %s\n", err.what());
+					th = sol::thread::create(m_lua_state);
+				}
+				else
+				{
+					th = std::move(m_spare_threads.back());
+					m_spare_threads.pop_back();
+				}
+
+				bool finished;
+				{
+					auto profile = g_profiler.start(PROFILER_LUA);
+					sol::coroutine cr(th.state(), func);
+					auto ret = cr();
+					if (!ret.valid())
+					{
+						sol::error err = ret;
+						osd_printf_error("[LUA ERROR] in execute_function: %s\n", err.what());
+					}
+					finished = sol::call_status::ok == ret.status();
+				}
+
+				// a thread that yielded belongs to whatever resumes it, and one that failed can't be resumed
+				if (finished && (lua_status(th.thread_state()) == LUA_OK) && (m_spare_threads.size() < MAX_SPARE_THREADS))
+				{
+					lua_settop(th.thread_state(), 0);
+					m_spare_threads.emplace_back(std::move(th));
 				}
 				return true;
 			});
@@ -624,11 +649,10 @@ bool lua_engine::execute_function(const char *id)
 
 void lua_engine::register_function(sol::function func, const char *id)
 {
-	sol::object functable = sol().registry()[id];
-	if(functable.is<sol::table>())
-		functable.as<sol::table>().add(func);
-	else
-		sol().registry().create_named(id, 1, func);
+	auto found = m_functions.find(id);
+	if (m_functions.end() == found)
+		found = m_functions.emplace(id, std::vector<sol::protected_function>()).first;
+	found->second.emplace_back(std::move(func));
 }
 
 void lua_engine::on_machine_prestart()
@@ -646,6 +670,7 @@ void lua_engine::on_machine_stop()
 {
 	// clear waiting tasks
 	m_timer = nullptr;
+	m_state_saved_subscription.reset();
 	std::vector<int> expired;
 	expired.reserve(m_waiting_tasks.size());
 	for (auto const &waiting : m_waiting_tasks)
@@ -707,6 +732,11 @@ void lua_engine::on_machine_postload()
 	m_notifiers->on_postload();
 }
 
+void lua_engine::on_machine_state_saved(std::string_view filename, save_error error)
+{
+	m_notifiers->on_state_saved(std::string(filename).c_str(), STATERR_NONE == error);
+}
+
 void lua_engine::on_sound_update()
 {
 	execute_function("LUA_ON_SOUND_UPDATE");
@@ -750,6 +780,7 @@ void lua_engine::attach_notifiers()
 	machine().add_notifier(MACHINE_NOTIFY_FRAME, machine_notify_delegate(&lua_engine::on_machine_frame, this));
 	machine().save().register_presave(save_prepost_delegate(FUNC(lua_engine::on_machine_presave), this));
 	machine().save().register_postload(save_prepost_delegate(FUNC(lua_engine::on_machine_postload), this));
+	m_state_saved_subscription = machine().add_state_saved_notifier(delegate<void (std::string_view, save_error)>(&lua_engine::on_machine_state_saved, this));
 
 	m_timer = machine().scheduler().timer_alloc(timer_expired_delegate(FUNC(lua_engine::resume), this));
 }
@@ -877,6 +908,7 @@ void lua_engine::initialize()
 	emu.set_function("add_machine_frame_notifier", make_notifier_adder(m_notifiers->on_frame, "machine frame"));
 	emu.set_function("add_machine_pre_save_notifier", make_notifier_adder(m_notifiers->on_presave, "machine pre-save"));
 	emu.set_function("add_machine_post_load_notifier", make_notifier_adder(m_notifiers->on_postload, "machine post-load"));
+	emu.set_function("add_machine_state_saved_notifier", make_notifier_adder(m_notifiers->on_state_saved, "machine state saved"));
 	emu.set_function("print_error", [] (const char *str) { osd_printf_error("%s\n", str); });
 	emu.set_function("print_warning", [] (const char *str) { osd_printf_warning("%s\n", str); });
 	emu.set_function("print_info", [] (const char *str) { osd_printf_info("%s\n", str); });
@@ -1422,6 +1454,34 @@ void lua_engine::initialize()
 					return false;
 				}
 			});
+	machine_type.set_function("state_hash", [] (running_machine &m) { return m.save().state_hash(); });
+	machine_type.set_function("capture_boot_state", [] (running_machine &m) { return m.boot_state() && m.boot_state()->capture(); });
+	machine_type.set_function("device_state_hashes",
+			[this] (running_machine &m)
+			{
+				std::vector<std::pair<device_t *, u64> > hashes;
+				m.save().device_state_hashes(hashes);
+				sol::table result = sol().create_table();
+				for (auto const &hash : hashes)
+					result[hash.first ? hash.first->tag() : "global"] = hash.second;
+				return result;
+			});
+	machine_type.set_function("memory_usage",
+			[this] (running_machine &m)
+			{
+				sol::table result = sol().create_table();
+				for (device_memory_usage const &usage : m.memory_usage())
+				{
+					sol::table entry = sol().create_table();
+					entry["regions"] = usage.regions;
+					entry["shares"] = usage.shares;
+					entry["gfx"] = usage.gfx;
+					entry["state"] = usage.state;
+					result[usage.device->tag()] = entry;
+				}
+				return result;
+			});
+	machine_type.set_function("ramstate_bytes", [] (running_machine &m) { return m.save().ramstate_bytes(); });
 	machine_type.set_function("popmessage",
 			[] (running_machine &m, std::optional<const char *> str)
 			{
@@ -1434,6 +1494,7 @@ void lua_engine::initialize()
 	machine_type["time"] = sol::property(&running_machine::time);
 	machine_type["system"] = sol::property(&running_machine::system);
 	machine_type["parameters"] = sol::property(&running_machine::parameters);
+	machine_type["scheduler"] = sol::property(&running_machine::scheduler);
 	machine_type["video"] = sol::property(&running_machine::video);
 	machine_type["sound"] = sol::property(&running_machine::sound);
 	machine_type["output"] = sol::property(&running_machine::output);
@@ -1464,6 +1525,43 @@ void lua_engine::initialize()
 	machine_type["slots"] = sol::property([](running_machine &m) { return devenum<slot_interface_enumerator>(m.root_device()); });
 
 
+	auto scheduler_type = sol().registry().new_usertype<device_scheduler>("scheduler", sol::no_constructor);
+	scheduler_type.set_function("reset_profile", &device_scheduler::reset_profile);
+	scheduler_type["profiling"] = sol::property(&device_scheduler::profiling, &device_scheduler::set_profiling);
+	scheduler_type["time"] = sol::property(&device_scheduler::time);
+	scheduler_type["profile"] = sol::property(
+			[this] (device_scheduler &sched)
+			{
+				device_scheduler::profile_counters const &counters(sched.profile());
+				double const tps = double(osd_ticks_per_second());
+				sol::table table = sol().create_table();
+				table["timeslices"] = counters.timeslices;
+				table["perfect_timeslices"] = counters.perfect_timeslices;
+				table["perfect_quantum_calls"] = counters.perfect_quantum_calls;
+				table["synchronize_calls"] = counters.synchronize_calls;
+				table["aborts"] = counters.aborts;
+				sol::table devices = sol().create_table();
+				for (device_execute_interface &exec : execute_interface_enumerator(sched.machine().root_device()))
+				{
+					device_scheduler::device_profile const *const prof(sched.profile(exec));
+					if (!prof)
+						continue;
+					sol::table entry = sol().create_table();
+					entry["host_time"] = double(prof->host_ticks) / tps;
+					entry["cycles"] = prof->cycles;
+					entry["timeslices"] = prof->timeslices;
+					entry["aborted"] = prof->aborted;
+					devices[exec.device().tag()] = entry;
+				}
+				table["devices"] = devices;
+				sol::table callers = sol().create_table();
+				for (auto const &caller : sched.synchronize_profile())
+					callers[caller.first] = caller.second;
+				table["synchronize"] = callers;
+				return table;
+			});
+
+
 	auto game_driver_type = sol().registry().new_usertype<game_driver>("game_driver", sol::no_constructor);
 	game_driver_type["name"] = sol::property([] (game_driver const &driver) { return &driver.name[0]; });
 	game_driver_type["description"] = sol::property([] (game_driver const &driver) { return &driver.type.fullname()[0]; });
@@ -1549,6 +1647,17 @@ void lua_engine::initialize()
 				}
 				return sp_table;
 			});
+	device_type["vtlb_stats"] = sol::property(
+			[this] (device_t &dev) -> sol::object
+			{
+				device_vtlb_interface const *vtlb;
+				if (!dev.interface(vtlb))
+					return sol::lua_nil;
+				sol::table result = sol().create_table();
+				result["fills"] = vtlb->vtlb_fill_count();
+				result["flushes"] = vtlb->vtlb_flush_count();
+				return result;
+			});
 	device_type["state"] = sol::property(
 			[] (device_t &dev, sol::this_state s) -> sol::object
 			{
@@ -1557,6 +1666,7 @@ void lua_engine::initialize()
 					return sol::lua_nil;
 				return sol::make_object(s, device_state_entries(*state));
 			});
+	device_type.set_function("state_hash", [] (device_t &dev) { return dev.machine().save().state_hash(&dev); });
 	// FIXME: turn into a wrapper - it's stupid slow to walk on every property access
 	// also, this mixes up things like RAM areas with stuff saved by the device itself, so there's potential for key conflicts
 	device_type["items"] = sol::property(
@@ -2016,6 +2126,7 @@ void lua_engine::initialize()
 	video_type["speed_factor"] = sol::property(&video_manager::speed_factor);
 	video_type["throttled"] = sol::property(&video_manager::throttled, &video_manager::set_throttled);
 	video_type["throttle_rate"] = sol::property(&video_manager::throttle_rate, &video_manager::set_throttle_rate);
+	video_type["turbo"] = sol::property(&video_manager::turbo, &video_manager::set_turbo);
 	video_type["frameskip"] = sol::property(&video_manager::frameskip, &video_manager::set_frameskip);
 	video_type["speed_percent"] = sol::property(&video_manager::speed_percent);
 	video_type["effective_frameskip"] = sol::property(&video_manager::effective_frameskip);
@@ -2160,6 +2271,8 @@ void lua_engine::close()
 	m_menu.clear();
 	m_update_tasks.clear();
 	m_frame_tasks.clear();
+	m_functions.clear();
+	m_spare_threads.clear();
 	m_sol_state.reset();
 	if (m_lua_state)
 	{
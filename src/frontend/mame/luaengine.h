@@ -141,6 +141,8 @@ public:
 	}
 
 private:
+	static constexpr size_t MAX_SPARE_THREADS = 4;
+
 	struct notifiers
 	{
 		util::notifier<> on_reset;
@@ -150,6 +152,7 @@ private:
 		util::notifier<> on_frame;
 		util::notifier<> on_presave;
 		util::notifier<> on_postload;
+		util::notifier<char const *, bool> on_state_saved;
 	};
 
 	template <typename T, size_t Size> class enum_parser;
@@ -159,6 +162,7 @@ private:
 	class palette_wrapper;
 	template <typename T> class bitmap_helper;
 	class tap_helper;
+	class tap_buffer_helper;
 	class addr_space_change_notif;
 	class symbol_table_wrapper;
 	class expression_wrapper;
@@ -174,6 +178,11 @@ private:
 
 	// machine event notifiers
 	std::optional<notifiers> m_notifiers;
+	util::notifier_subscription m_state_saved_subscription;
+
+	// functions registered for events, and finished threads to run them on
+	std::map<std::string, std::vector<sol::protected_function>, std::less<> > m_functions;
+	std::vector<sol::thread> m_spare_threads;
 
 	// deferred coroutines
 	std::vector<std::pair<attotime, int> > m_waiting_tasks;
@@ -195,6 +204,7 @@ private:
 	void on_machine_frame();
 	void on_machine_presave();
 	void on_machine_postload();
+	void on_machine_state_saved(std::string_view filename, save_error error);
 
 	void resume(s32 param);
 	void register_function(sol::function func, const char *id);
@@ -11,6 +11,15 @@
 #include "emu.h"
 #include "luaengine.ipp"
 
+#include "cheatsearch.h"
+
+#include "debug/memprof.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <functional>
+
 
 namespace {
 
@@ -118,6 +127,76 @@ void share_write(memory_share &share, offs_t address, T val)
 	}
 }
 
+//-------------------------------------------------
+//  compare_op - comparisons for snapshot searches
+//-------------------------------------------------
+
+enum class compare_op
+{
+	EQ,
+	NE,
+	LT,
+	LE,
+	GT,
+	GE
+};
+
+std::optional<compare_op> parse_compare_op(std::string_view op)
+{
+	if ((op == "eq") || (op == "=="))
+		return compare_op::EQ;
+	else if ((op == "ne") || (op == "~=") || (op == "!="))
+		return compare_op::NE;
+	else if ((op == "lt") || (op == "<"))
+		return compare_op::LT;
+	else if ((op == "le") || (op == "<="))
+		return compare_op::LE;
+	else if ((op == "gt") || (op == ">"))
+		return compare_op::GT;
+	else if ((op == "ge") || (op == ">="))
+		return compare_op::GE;
+	else
+		return std::nullopt;
+}
+
+//-------------------------------------------------
+//  compare_values - find the elements of a buffer
+//  that compare true against a snapshot
+//-------------------------------------------------
+
+template <typename T, typename U>
+void compare_values(T const *current, T const *previous, size_t count, U &&cmp, std::vector<size_t> &result)
+{
+	// compare a block at a time so the comparison loop can be vectorised
+	constexpr size_t BLOCK = 256;
+	u8 flags[BLOCK];
+	for (size_t base = 0; count > base; base += BLOCK)
+	{
+		size_t const n = std::min(count - base, BLOCK);
+		for (size_t i = 0; n > i; ++i)
+			flags[i] = cmp(current[base + i], previous[base + i]) ? 1 : 0;
+		for (size_t i = 0; n > i; ++i)
+		{
+			if (flags[i])
+				result.emplace_back(base + i);
+		}
+	}
+}
+
+template <typename T>
+void compare_values(T const *current, T const *previous, size_t count, compare_op op, std::vector<size_t> &result)
+{
+	switch (op)
+	{
+	case compare_op::EQ: compare_values(current, previous, count, std::equal_to<T>(), result);      break;
+	case compare_op::NE: compare_values(current, previous, count, std::not_equal_to<T>(), result);  break;
+	case compare_op::LT: compare_values(current, previous, count, std::less<T>(), result);          break;
+	case compare_op::LE: compare_values(current, previous, count, std::less_equal<T>(), result);    break;
+	case compare_op::GT: compare_values(current, previous, count, std::greater<T>(), result);       break;
+	case compare_op::GE: compare_values(current, previous, count, std::greater_equal<T>(), result); break;
+	}
+}
+
 } // anonymous namespace
 
 
@@ -312,6 +391,185 @@ private:
 };
 
 
+//-------------------------------------------------
+//  tap_buffer_helper - class for managing address
+//  space taps that record accesses for scripts to
+//  collect later rather than calling into Lua for
+//  every access
+//-------------------------------------------------
+
+class lua_engine::tap_buffer_helper
+{
+public:
+	static constexpr size_t DEFAULT_CAPACITY = 4096;
+
+	tap_buffer_helper(tap_buffer_helper const &) = delete;
+	tap_buffer_helper(tap_buffer_helper &&) = delete;
+
+	tap_buffer_helper(
+			address_space &space,
+			read_or_write mode,
+			offs_t start,
+			offs_t end,
+			std::string &&name,
+			size_t capacity)
+		: m_space(space)
+		, m_handler()
+		, m_name(std::move(name))
+		, m_start(start)
+		, m_end(end)
+		, m_mode(mode)
+		, m_records(std::max<size_t>(capacity, 1))
+		, m_head(0)
+		, m_count(0)
+		, m_dropped(0)
+		, m_installing(0U)
+	{
+		reinstall();
+	}
+
+	~tap_buffer_helper()
+	{
+		remove();
+	}
+
+	offs_t start() const noexcept { return m_start; }
+	offs_t end() const noexcept { return m_end; }
+	std::string const &name() const noexcept { return m_name; }
+	size_t capacity() const noexcept { return m_records.size(); }
+	size_t count() const noexcept { return m_count; }
+	u64 dropped() const noexcept { return m_dropped; }
+
+	void reinstall()
+	{
+		switch (m_space.data_width())
+		{
+		case  8: do_install<u8>();  break;
+		case 16: do_install<u16>(); break;
+		case 32: do_install<u32>(); break;
+		case 64: do_install<u64>(); break;
+		}
+	}
+
+	void remove()
+	{
+		++m_installing;
+		try
+		{
+			m_handler.remove();
+		}
+		catch (...)
+		{
+			--m_installing;
+			throw;
+		}
+		--m_installing;
+	}
+
+	void clear() noexcept
+	{
+		m_head = 0;
+		m_count = 0;
+		m_dropped = 0;
+	}
+
+	sol::table drain(sol::this_state s)
+	{
+		// oldest first, as { offset, data, mask } tables
+		sol::state_view lua(s);
+		sol::table result = lua.create_table(m_count, 0);
+		for (size_t i = 0; m_count > i; ++i)
+		{
+			record const &r = m_records[(m_head + i) % m_records.size()];
+			sol::table entry = lua.create_table(0, 3);
+			entry["offset"] = r.offset;
+			entry["data"] = r.data;
+			entry["mask"] = r.mem_mask;
+			result[i + 1] = entry;
+		}
+		clear();
+		return result;
+	}
+
+private:
+	struct record
+	{
+		offs_t offset;
+		u64 data;
+		u64 mem_mask;
+	};
+
+	void add(offs_t offset, u64 data, u64 mem_mask) noexcept
+	{
+		// overwrite the oldest record when the buffer is full
+		size_t const size = m_records.size();
+		if (m_count == size)
+		{
+			m_head = (m_head + 1) % size;
+			--m_count;
+			++m_dropped;
+		}
+		record &r = m_records[(m_head + m_count++) % size];
+		r.offset = offset;
+		r.data = data;
+		r.mem_mask = mem_mask;
+	}
+
+	template <typename T>
+	void do_install()
+	{
+		if (m_installing)
+			return;
+		++m_installing;
+		try
+		{
+			m_handler.remove();
+
+			switch (m_mode)
+			{
+			case read_or_write::READ:
+				m_handler = m_space.install_read_tap(
+						m_start,
+						m_end,
+						m_name,
+						[this] (offs_t offset, T &data, T mem_mask) { add(offset, data, mem_mask); },
+						&m_handler);
+				break;
+			case read_or_write::WRITE:
+				m_handler = m_space.install_write_tap(
+						m_start,
+						m_end,
+						m_name,
+						[this] (offs_t offset, T &data, T mem_mask) { add(offset, data, mem_mask); },
+						&m_handler);
+				break;
+			case read_or_write::READWRITE:
+				// won't ever get here, but compilers complain about unhandled enum value
+				break;
+			}
+		}
+		catch (...)
+		{
+			--m_installing;
+			throw;
+		}
+		--m_installing;
+	};
+
+	address_space &m_space;
+	memory_passthrough_handler m_handler;
+	std::string m_name;
+	offs_t const m_start;
+	offs_t const m_end;
+	read_or_write const m_mode;
+	std::vector<record> m_records;
+	size_t m_head;
+	size_t m_count;
+	u64 m_dropped;
+	unsigned m_installing;
+};
+
+
 //-------------------------------------------------
 //  mem_read - templated memory readers for <sign>,<size>
 //  -> manager:machine().devices[":maincpu"].spaces["program"]:read_i8(0xC000)
@@ -645,6 +903,108 @@ void lua_engine::initialize_memory(sol::table &emu)
 				luaL_pushresultsize(&buff, byte_count);
 				return sol::make_reference(s, sol::stack_reference(s, -1));
 			});
+	addr_space_type.set_function("write_range",
+			[] (addr_space &sp, sol::this_state s, u64 first, int width, std::string_view data, sol::object opt_step)
+			{
+				u64 step = 1;
+				if (opt_step.is<u64>())
+				{
+					step = opt_step.as<u64>();
+					if (step < 1)
+					{
+						luaL_error(s, "Invalid step");
+						return;
+					}
+				}
+
+				if ((width != 8) && (width != 16) && (width != 32) && (width != 64))
+				{
+					luaL_error(s, "Invalid width. Must be 8/16/32/64");
+					return;
+				}
+				size_t const count = data.length() / (width / 8);
+				if (!count)
+					return;
+
+				offs_t space_size = sp.space.addrmask();
+				if ((first > space_size) || ((count - 1) > ((space_size - first) / step)))
+				{
+					luaL_error(s, "Invalid offset");
+					return;
+				}
+
+				auto const write_values =
+					[&sp, first, step, count, &data] (auto sample)
+					{
+						using T = decltype(sample);
+						char const *src = data.data();
+						u64 address = first;
+						for (size_t i = 0; count > i; ++i, src += sizeof(T), address += step)
+						{
+							T value;
+							std::memcpy(&value, src, sizeof(T));
+							sp.template mem_write<T>(address, value);
+						}
+					};
+				switch (width)
+				{
+				case 8:  write_values(u8(0));  break;
+				case 16: write_values(u16(0)); break;
+				case 32: write_values(u32(0)); break;
+				case 64: write_values(u64(0)); break;
+				}
+			});
+	addr_space_type.set_function("compare_range",
+			[] (addr_space &sp, sol::this_state s, u64 first, int width, std::string_view snapshot, std::string_view op, sol::object opt_step)
+			{
+				sol::state_view lua(s);
+				u64 step = 1;
+				if (opt_step.is<u64>())
+				{
+					step = opt_step.as<u64>();
+					if (step < 1)
+						luaL_error(s, "Invalid step");
+				}
+
+				std::optional<compare_op> const cmp = parse_compare_op(op);
+				if (!cmp)
+					luaL_error(s, "Invalid comparison");
+				if ((width != 8) && (width != 16) && (width != 32) && (width != 64))
+					luaL_error(s, "Invalid width. Must be 8/16/32/64");
+				size_t const count = snapshot.length() / (width / 8);
+
+				offs_t space_size = sp.space.addrmask();
+				if ((first > space_size) || (count && ((count - 1) > ((space_size - first) / step))))
+					luaL_error(s, "Invalid offset");
+
+				// read the whole range before comparing so the comparisons run over contiguous buffers
+				std::vector<size_t> found;
+				std::string current;
+				auto const compare =
+					[&sp, first, step, count, &snapshot, &cmp, &found, &current] (auto sample)
+					{
+						using T = decltype(sample);
+						std::vector<T> now(count), previous(count);
+						std::memcpy(previous.data(), snapshot.data(), count * sizeof(T));
+						u64 address = first;
+						for (size_t i = 0; count > i; ++i, address += step)
+							now[i] = sp.template mem_read<T>(address);
+						compare_values(now.data(), previous.data(), count, *cmp, found);
+						current.assign(reinterpret_cast<char const *>(now.data()), count * sizeof(T));
+					};
+				switch (width)
+				{
+				case 8:  compare(u8(0));  break;
+				case 16: compare(u16(0)); break;
+				case 32: compare(u32(0)); break;
+				case 64: compare(u64(0)); break;
+				}
+
+				sol::table result = lua.create_table(found.size(), 0);
+				for (size_t i = 0; found.size() > i; ++i)
+					result[i + 1] = first + (found[i] * step);
+				return std::make_tuple(result, std::move(current));
+			});
 	addr_space_type.set_function("add_change_notifier",
 			[this] (addr_space &sp, sol::protected_function &&cb)
 			{
@@ -676,6 +1036,21 @@ void lua_engine::initialize_memory(sol::table &emu)
 			{
 				return std::make_unique<tap_helper>(*this, sp.space, read_or_write::WRITE, start, end, std::move(name), std::move(cb));
 			});
+	addr_space_type.set_function("install_read_tap_buffer",
+			[] (addr_space &sp, offs_t start, offs_t end, std::string &&name, std::optional<size_t> capacity)
+			{
+				return std::make_unique<tap_buffer_helper>(sp.space, read_or_write::READ, start, end, std::move(name), capacity ? *capacity : tap_buffer_helper::DEFAULT_CAPACITY);
+			});
+	addr_space_type.set_function("install_write_tap_buffer",
+			[] (addr_space &sp, offs_t start, offs_t end, std::string &&name, std::optional<size_t> capacity)
+			{
+				return std::make_unique<tap_buffer_helper>(sp.space, read_or_write::WRITE, start, end, std::move(name), capacity ? *capacity : tap_buffer_helper::DEFAULT_CAPACITY);
+			});
+	addr_space_type.set_function("memory_profiler",
+			[] (addr_space &sp, std::optional<int> page_bits)
+			{
+				return std::make_unique<memory_profiler>(sp.space, page_bits ? *page_bits : -1);
+			});
 	addr_space_type["name"] = sol::property([] (addr_space &sp) { return sp.space.name(); });
 	addr_space_type["shift"] = sol::property([] (addr_space &sp) { return sp.space.addr_shift(); });
 	addr_space_type["index"] = sol::property([] (addr_space &sp) { return sp.space.spacenum(); });
@@ -693,6 +1068,65 @@ void lua_engine::initialize_memory(sol::table &emu)
 	tap_type["name"] = sol::property(&tap_helper::name);
 
 
+	auto tap_buffer_type = sol().registry().new_usertype<tap_buffer_helper>("membuffertap", sol::no_constructor);
+	tap_buffer_type.set_function("reinstall", &tap_buffer_helper::reinstall);
+	tap_buffer_type.set_function("remove", &tap_buffer_helper::remove);
+	tap_buffer_type.set_function("drain", &tap_buffer_helper::drain);
+	tap_buffer_type.set_function("clear", &tap_buffer_helper::clear);
+	tap_buffer_type["addrstart"] = sol::property(&tap_buffer_helper::start);
+	tap_buffer_type["addrend"] = sol::property(&tap_buffer_helper::end);
+	tap_buffer_type["name"] = sol::property(&tap_buffer_helper::name);
+	tap_buffer_type["capacity"] = sol::property(&tap_buffer_helper::capacity);
+	tap_buffer_type["count"] = sol::property(&tap_buffer_helper::count);
+	tap_buffer_type["dropped"] = sol::property(&tap_buffer_helper::dropped);
+
+
+	auto memprof_type = sol().registry().new_usertype<memory_profiler>("memprofiler", sol::no_constructor);
+	memprof_type.set_function("start", &memory_profiler::start);
+	memprof_type.set_function("stop", &memory_profiler::stop);
+	memprof_type.set_function("reset", &memory_profiler::reset);
+	memprof_type.set_function("handlers",
+			[this] (memory_profiler &prof, char const *mode)
+			{
+				sol::table result = sol().create_table();
+				int index = 1;
+				for (memory_profiler::handler_stats const &h : prof.handlers(((mode != nullptr) && (*mode == 'w')) ? read_or_write::WRITE : read_or_write::READ))
+				{
+					sol::table entry = sol().create_table();
+					entry["addrstart"] = h.start;
+					entry["addrend"] = h.end;
+					entry["name"] = h.name;
+					entry["count"] = h.count;
+					result[index++] = entry;
+				}
+				return result;
+			});
+	memprof_type.set_function("pages",
+			[this] (memory_profiler &prof, char const *mode)
+			{
+				sol::table result = sol().create_table();
+				std::vector<u64> const &counts = prof.pages(((mode != nullptr) && (*mode == 'w')) ? read_or_write::WRITE : read_or_write::READ);
+				for (size_t i = 0; counts.size() > i; ++i)
+				{
+					if (counts[i])
+						result[offs_t(i) << prof.page_shift()] = counts[i];
+				}
+				return result;
+			});
+	memprof_type.set_function("write_csv",
+			[] (memory_profiler &prof, std::string const &filename)
+			{
+				std::ofstream file(filename);
+				if (!file.good())
+					return false;
+				prof.write_csv(file);
+				return file.good();
+			});
+	memprof_type["running"] = sol::property(&memory_profiler::running);
+	memprof_type["map_changed"] = sol::property(&memory_profiler::map_changed);
+	memprof_type["page_shift"] = sol::property(&memory_profiler::page_shift);
+
+
 	auto addrmap_type = sol().registry().new_usertype<address_map>("addrmap", sol::no_constructor);
 	addrmap_type["spacenum"] = sol::readonly(&address_map::m_spacenum);
 	addrmap_type["device"] = sol::readonly(&address_map::m_device);
@@ -731,6 +1165,7 @@ void lua_engine::initialize_memory(sol::table &emu)
 	auto bank_type = sol().registry().new_usertype<memory_bank>("membank", sol::no_constructor);
 	bank_type["tag"] = sol::property(&memory_bank::tag);
 	bank_type["entry"] = sol::property(&memory_bank::entry, &memory_bank::set_entry);
+	bank_type["set_count"] = sol::property(&memory_bank::set_count);
 
 
 	auto region_type = sol().registry().new_usertype<memory_region>("region", sol::no_constructor);
@@ -750,6 +1185,11 @@ void lua_engine::initialize_memory(sol::table &emu)
 	region_type.set_function("write_u32", &region_write<u32>);
 	region_type.set_function("write_i64", &region_write<s64>);
 	region_type.set_function("write_u64", &region_write<u64>);
+	region_type.set_function("cheat_search",
+			[] (memory_region &r, std::optional<unsigned> size, std::optional<bool> is_signed)
+			{
+				return std::make_unique<cheat_search>(r.base(), r.bytes(), r.bytewidth(), r.endianness(), size ? *size : 1, is_signed && *is_signed);
+			});
 	region_type["tag"] = sol::property(&memory_region::name);
 	region_type["size"] = sol::property(&memory_region::bytes);
 	region_type["length"] = sol::property([] (memory_region &r) { return r.bytes() / r.bytewidth(); });
@@ -775,6 +1215,55 @@ void lua_engine::initialize_memory(sol::table &emu)
 	share_type.set_function("write_u32", &share_write<u32>);
 	share_type.set_function("write_i64", &share_write<s64>);
 	share_type.set_function("write_u64", &share_write<u64>);
+	share_type.set_function("read_range",
+			[] (memory_share &share, sol::this_state s, offs_t first, offs_t last)
+			{
+				if ((last < first) || (last >= share.bytes()))
+					luaL_error(s, "Invalid offset");
+				std::string result(last - first + 1, '\0');
+				for (offs_t i = 0; result.length() > i; ++i)
+					result[i] = char(share_read<u8>(share, first + i));
+				return result;
+			});
+	share_type.set_function("write_range",
+			[] (memory_share &share, sol::this_state s, offs_t first, std::string_view data)
+			{
+				if ((first > share.bytes()) || (data.length() > (share.bytes() - first)))
+					luaL_error(s, "Invalid offset");
+				for (offs_t i = 0; data.length() > i; ++i)
+					share_write<u8>(share, first + i, u8(data[i]));
+			});
+	share_type.set_function("compare_range",
+			[] (memory_share &share, sol::this_state s, offs_t first, std::string_view snapshot, std::string_view op)
+			{
+				sol::state_view lua(s);
+				std::optional<compare_op> const cmp = parse_compare_op(op);
+				if (!cmp)
+					luaL_error(s, "Invalid comparison");
+				if ((first > share.bytes()) || (snapshot.length() > (share.bytes() - first)))
+					luaL_error(s, "Invalid offset");
+
+				std::string current(snapshot.length(), '\0');
+				for (offs_t i = 0; current.length() > i; ++i)
+					current[i] = char(share_read<u8>(share, first + i));
+				std::vector<size_t> found;
+				compare_values(
+						reinterpret_cast<u8 const *>(current.data()),
+						reinterpret_cast<u8 const *>(snapshot.data()),
+						current.length(),
+						*cmp,
+						found);
+
+				sol::table result = lua.create_table(found.size(), 0);
+				for (size_t i = 0; found.size() > i; ++i)
+					result[i + 1] = first + found[i];
+				return std::make_tuple(result, std::move(current));
+			});
+	share_type.set_function("cheat_search",
+			[] (memory_share &sh, std::optional<unsigned> size, std::optional<bool> is_signed)
+			{
+				return std::make_unique<cheat_search>(sh.ptr(), sh.bytes(), sh.bytewidth(), sh.endianness(), size ? *size : 1, is_signed && *is_signed);
+			});
 	share_type["tag"] = sol::property(&memory_share::name);
 	share_type["size"] = sol::property(&memory_share::bytes);
 	share_type["length"] = sol::property([] (memory_share &s) { return s.bytes() / s.bytewidth(); });
@@ -782,4 +1271,37 @@ void lua_engine::initialize_memory(sol::table &emu)
 	share_type["bitwidth"] = sol::property(&memory_share::bitwidth);
 	share_type["bytewidth"] = sol::property(&memory_share::bytewidth);
 
+
+	auto search_type = sol().registry().new_usertype<cheat_search>("cheatsearch", sol::no_constructor);
+	search_type.set_function("reset", &cheat_search::reset);
+	search_type.set_function("filter",
+			[] (cheat_search &search, sol::this_state s, std::string_view op, std::optional<s64> operand)
+			{
+				std::optional<cheat_search::op> const cmp = cheat_search::parse_op(op);
+				if (!cmp)
+					luaL_error(s, "Invalid comparison");
+				return search.filter(*cmp, operand ? u64(*operand) : 0U);
+			});
+	search_type.set_function("exclude", &cheat_search::exclude);
+	search_type.set_function("matches",
+			[] (cheat_search &search, sol::this_state s, std::optional<size_t> limit)
+			{
+				sol::state_view lua(s);
+				std::vector<cheat_search::match> const found = search.matches(limit ? *limit : search.candidate_count());
+				sol::table result = lua.create_table(found.size(), 0);
+				for (size_t i = 0; found.size() > i; ++i)
+				{
+					sol::table entry = lua.create_table(0, 3);
+					entry["offset"] = found[i].offset;
+					entry["value"] = found[i].value;
+					entry["previous"] = found[i].previous;
+					result[i + 1] = entry;
+				}
+				return result;
+			});
+	search_type["size"] = sol::property(&cheat_search::size);
+	search_type["signed"] = sol::property(&cheat_search::is_signed);
+	search_type["length"] = sol::property(&cheat_search::value_count);
+	search_type["count"] = sol::property(&cheat_search::candidate_count);
+
 }
@@ -27,10 +27,16 @@
 #include "validity.h"
 
 #include "corestr.h"
+#include "hashing.h"
 #include "xmlfile.h"
 
 #include "osdepend.h"
 
+#include <rapidjson/writer.h>
+#include <rapidjson/stringbuffer.h>
+
+#include <cstdio>
+#include <cstdlib>
 #include <ctime>
 
 
@@ -63,7 +69,10 @@ mame_machine_manager::mame_machine_manager(emu_options &options,osd_interface &o
 	m_lua(std::make_unique<lua_engine>()),
 	m_new_driver_pending(nullptr),
 	m_firstrun(true),
-	m_autoboot_timer(nullptr)
+	m_autoboot_timer(nullptr),
+	m_batch(false),
+	m_batch_started(false),
+	m_batch_frames(0)
 {
 }
 
@@ -234,6 +243,9 @@ void mame_machine_manager::start_luaengine()
 
 int mame_machine_manager::execute()
 {
+	if (*options().batch())
+		return execute_batch();
+
 	bool started_empty = false;
 
 	bool firstgame = true;
@@ -269,6 +281,7 @@ int mame_machine_manager::execute()
 
 		// otherwise, perform validity checks before anything else
 		bool is_empty = (system == &GAME_NAME(___empty));
+		osd_ticks_t const validity_start = osd_ticks();
 		if (!is_empty)
 		{
 			validity_checker valid(m_options, true);
@@ -277,7 +290,12 @@ int mame_machine_manager::execute()
 		}
 
 		// create the machine configuration
+		osd_ticks_t const config_start = osd_ticks();
 		machine_config config(*system, m_options);
+		osd_ticks_t const config_end = osd_ticks();
+		osd_printf_verbose("Validity checks took %.2f ms, machine configuration took %.2f ms\n",
+				double(config_start - validity_start) * 1000.0 / double(osd_ticks_per_second()),
+				double(config_end - config_start) * 1000.0 / double(osd_ticks_per_second()));
 
 		// create the machine structure and driver
 		running_machine machine(config, *this);
@@ -314,6 +332,177 @@ int mame_machine_manager::execute()
 	return error;
 }
 
+
+//-------------------------------------------------
+//  execute_batch - run the systems listed in the
+//  batch file one after another, reusing the
+//  driver list, plugins and Lua engine, and
+//  report how each run ended
+//-------------------------------------------------
+
+int mame_machine_manager::execute_batch()
+{
+	std::string const batchname(options().batch());
+	util::core_file::ptr batch;
+	std::error_condition const batcherr = util::core_file::open(batchname, OPEN_FLAG_READ, batch);
+	if (batcherr)
+	{
+		osd_printf_error("Error opening batch file %s (%s)\n", batchname, batcherr.message());
+		return EMU_ERR_INVALID_CONFIG;
+	}
+
+	util::core_file::ptr report;
+	if (*options().batch_report())
+	{
+		std::error_condition const reporterr = util::core_file::open(options().batch_report(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE, report);
+		if (reporterr)
+		{
+			osd_printf_error("Error opening batch report file %s (%s)\n", options().batch_report(), reporterr.message());
+			return EMU_ERR_INVALID_CONFIG;
+		}
+	}
+
+	// runs without a time limit would never end, so fall back to half a minute
+	int const default_seconds = options().seconds_to_run() ? options().seconds_to_run() : 30;
+
+	int result = EMU_ERR_NONE;
+	char buffer[1024];
+	unsigned line = 0;
+	m_batch = true;
+	while (batch->gets(buffer, std::size(buffer)))
+	{
+		++line;
+
+		// each line is a system name, optionally followed by seconds to run; # starts a comment
+		std::string_view job(buffer);
+		job = strtrimspace(job.substr(0, job.find('#')));
+		if (job.empty())
+			continue;
+		std::string_view::size_type const split = job.find_first_of(" \t");
+		std::string const name(job.substr(0, split));
+		int seconds = default_seconds;
+		if (std::string_view::npos != split)
+			seconds = std::atoi(std::string(job.substr(split)).c_str());
+		if (0 >= seconds)
+			seconds = default_seconds;
+
+		m_batch_started = false;
+		m_batch_time = attotime::zero;
+		m_batch_frames = 0;
+		m_batch_state.clear();
+		m_batch_snapshot.clear();
+
+		int error = EMU_ERR_NONE;
+		osd_ticks_t const start = osd_ticks();
+		int const index = driver_list::find(name.c_str());
+		if (0 > index)
+		{
+			osd_printf_error("%s:%u: Unknown system '%s'\n", batchname, line, name);
+			error = EMU_ERR_NO_SUCH_SYSTEM;
+		}
+		else
+		{
+			game_driver const &system = driver_list::driver(index);
+			m_options.set_system_name(system.name);
+			m_options.set_value(OPTION_SECONDS_TO_RUN, seconds, OPTION_PRIORITY_CMDLINE);
+
+			// revert settings from the previous system's INIs and read this one's
+			if (m_options.read_config())
+			{
+				m_options.revert(OPTION_PRIORITY_INI);
+				std::ostringstream errors;
+				mame_options::parse_standard_inis(m_options, errors, &system);
+			}
+
+			// run it to completion as execute() would
+			machine_config config(system, m_options);
+			running_machine machine(config, *this);
+			set_machine(&machine);
+			error = machine.run(false);
+			m_firstrun = false;
+			set_machine(nullptr);
+		}
+		double const host_seconds = double(osd_ticks() - start) / double(osd_ticks_per_second());
+
+		rapidjson::StringBuffer s;
+		rapidjson::Writer<rapidjson::StringBuffer> writer(s);
+		writer.StartObject();
+		writer.Key("system");
+		writer.String(name.c_str());
+		writer.Key("error");
+		writer.Int(error);
+		writer.Key("seconds_to_run");
+		writer.Int(seconds);
+		writer.Key("emulated_seconds");
+		writer.Double(m_batch_time.as_double());
+		writer.Key("host_seconds");
+		writer.Double(host_seconds);
+		writer.Key("frames");
+		writer.Uint64(m_batch_frames);
+		writer.Key("state_sha1");
+		if (m_batch_state.empty())
+			writer.Null();
+		else
+			writer.String(m_batch_state.c_str());
+		writer.Key("snapshot");
+		if (m_batch_snapshot.empty())
+			writer.Null();
+		else
+			writer.String(m_batch_snapshot.c_str());
+		writer.EndObject();
+
+		// write each result as soon as it's known, so a crash doesn't lose the earlier ones
+		if (report)
+		{
+			report->puts(std::string_view(s.GetString(), s.GetSize()));
+			report->puts("\n");
+			report->flush();
+		}
+		else
+		{
+			std::fwrite(s.GetString(), 1, s.GetSize(), stdout);
+			std::fputc('\n', stdout);
+			std::fflush(stdout);
+		}
+
+		if ((EMU_ERR_NONE != error) && (EMU_ERR_NONE == result))
+			result = error;
+	}
+	m_batch = false;
+	return result;
+}
+
+
+//-------------------------------------------------
+//  batch_capture - record the final state and
+//  screen of a batch run before the devices stop
+//-------------------------------------------------
+
+void mame_machine_manager::batch_capture()
+{
+	running_machine &machine(*this->machine());
+	if (!m_batch_started)
+		return;
+
+	m_batch_time = machine.time();
+	m_batch_frames = machine.video().frame_count();
+
+	if (machine.system().flags & MACHINE_SUPPORTS_SAVE)
+	{
+		std::vector<u8> state;
+		if (STATERR_NONE == machine.save().write_snapshot(state))
+			m_batch_state = util::sha1_creator::simple(state.data(), state.size()).as_string();
+	}
+
+	emu_file file(options().snapshot_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (!file.open(machine.basename() + PATH_SEPARATOR "batch.png"))
+	{
+		machine.video().save_snapshot(nullptr, file);
+		m_batch_snapshot = file.fullpath();
+	}
+}
+
+
 TIMER_CALLBACK_MEMBER(mame_machine_manager::autoboot_callback)
 {
 	if (*options().autoboot_script())
@@ -363,6 +552,20 @@ void mame_machine_manager::ui_initialize(running_machine& machine)
 
 	// display the startup screens
 	m_ui->display_startup_screens(m_firstrun);
+
+	m_batch_started = m_batch;
+}
+
+//-------------------------------------------------
+//  inifile - get the category INI index, scanning
+//  the category INI path the first time
+//-------------------------------------------------
+
+inifile_manager &mame_machine_manager::inifile()
+{
+	if (!m_inifile)
+		m_inifile = std::make_unique<inifile_manager>(m_ui->options());
+	return *m_inifile;
 }
 
 void mame_machine_manager::before_load_settings(running_machine& machine)
@@ -372,8 +575,8 @@ void mame_machine_manager::before_load_settings(running_machine& machine)
 
 void mame_machine_manager::create_custom(running_machine &machine)
 {
-	// start the inifile manager
-	m_inifile = std::make_unique<inifile_manager>(m_ui->options());
+	// category INIs are only needed by the system selection menu, so scan them on first use
+	m_inifile.reset();
 
 	// allocate autoboot timer
 	m_autoboot_timer = machine.scheduler().timer_alloc(timer_expired_delegate(FUNC(mame_machine_manager::autoboot_callback), this));
@@ -381,6 +584,10 @@ void mame_machine_manager::create_custom(running_machine &machine)
 	// start favorite manager
 	m_favorite = std::make_unique<favorite_manager>(m_ui->options());
 
+	// batch results are captured ahead of the other exit notifiers, while devices can still save their state
+	if (m_batch)
+		machine.add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&mame_machine_manager::batch_capture, this), true);
+
 	// attempt to load the autoboot script if configured
 	m_autoboot_script.reset();
 	if (*options().autoboot_script())
@@ -64,11 +64,13 @@ public:
 
 	/* execute as configured by the OPTION_SYSTEMNAME option on the specified options */
 	int execute();
+	/* execute each system listed in the OPTION_BATCH file in turn */
+	int execute_batch();
 	void start_luaengine();
 	void schedule_new_driver(const game_driver &driver);
 	mame_ui_manager& ui() const { assert(m_ui != nullptr); return *m_ui; }
 	cheat_manager &cheat() const { assert(m_cheat != nullptr); return *m_cheat; }
-	inifile_manager &inifile() const { assert(m_inifile != nullptr); return *m_inifile; }
+	inifile_manager &inifile();
 	favorite_manager &favorite() const { assert(m_favorite != nullptr); return *m_favorite; }
 
 private:
@@ -79,6 +81,8 @@ private:
 	mame_machine_manager &operator=(mame_machine_manager const &) = delete;
 	mame_machine_manager &operator=(mame_machine_manager &&) = delete;
 
+	void batch_capture();
+
 	std::unique_ptr<plugin_options>    m_plugins;           // pointer to plugin options
 	std::unique_ptr<lua_engine>        m_lua;
 
@@ -92,6 +96,14 @@ private:
 	std::unique_ptr<inifile_manager>   m_inifile;           // internal data from inifile.c for INIs
 	std::unique_ptr<favorite_manager>  m_favorite;          // internal data from inifile.c for favorites
 
+	// batch runs
+	bool                    m_batch;                        // running systems from a batch file?
+	bool                    m_batch_started;                // current batch machine reached the running phase?
+	attotime                m_batch_time;                   // emulated time when it exited
+	u64                     m_batch_frames;                 // frames it drew
+	std::string             m_batch_state;                  // SHA1 of its final state, if it supports saving
+	std::string             m_batch_snapshot;               // path of its final screenshot
+
 	static mame_machine_manager *s_manager;
 };
 
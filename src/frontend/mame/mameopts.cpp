@@ -29,6 +29,22 @@
 #include <stack>
 
 
+namespace {
+
+//-------------------------------------------------
+//  ini_exists - check whether an INI file can be
+//  found on the INI path
+//-------------------------------------------------
+
+bool ini_exists(emu_options &options, const char *basename)
+{
+	emu_file file(options.ini_path(), OPEN_FLAG_READ);
+	return !file.open(std::string(basename) + ".ini");
+}
+
+} // anonymous namespace
+
+
 //-------------------------------------------------
 //  parse_standard_inis - parse the standard set
 //  of INI files
@@ -58,26 +74,31 @@ void mame_options::parse_standard_inis(emu_options &options, std::ostream &error
 		else
 			parse_one_ini(options, "horizont", OPTION_PRIORITY_ORIENTATION_INI, &error_stream);
 
-		machine_config config(*cursystem, options);
-		for (const screen_device &device : screen_device_enumerator(config.root_device()))
+		// building the machine configuration to find the screen type is
+		// expensive, so don't bother if there's nothing to apply
+		if (options.read_config() && (ini_exists(options, "raster") || ini_exists(options, "vector") || ini_exists(options, "lcd")))
 		{
-			// parse "raster.ini" for raster games
-			if (device.screen_type() == SCREEN_TYPE_RASTER)
-			{
-				parse_one_ini(options, "raster", OPTION_PRIORITY_SCREEN_INI, &error_stream);
-				break;
-			}
-			// parse "vector.ini" for vector games
-			if (device.screen_type() == SCREEN_TYPE_VECTOR)
-			{
-				parse_one_ini(options, "vector", OPTION_PRIORITY_SCREEN_INI, &error_stream);
-				break;
-			}
-			// parse "lcd.ini" for lcd games
-			if (device.screen_type() == SCREEN_TYPE_LCD)
+			machine_config config(*cursystem, options);
+			for (const screen_device &device : screen_device_enumerator(config.root_device()))
 			{
-				parse_one_ini(options, "lcd", OPTION_PRIORITY_SCREEN_INI, &error_stream);
-				break;
+				// parse "raster.ini" for raster games
+				if (device.screen_type() == SCREEN_TYPE_RASTER)
+				{
+					parse_one_ini(options, "raster", OPTION_PRIORITY_SCREEN_INI, &error_stream);
+					break;
+				}
+				// parse "vector.ini" for vector games
+				if (device.screen_type() == SCREEN_TYPE_VECTOR)
+				{
+					parse_one_ini(options, "vector", OPTION_PRIORITY_SCREEN_INI, &error_stream);
+					break;
+				}
+				// parse "lcd.ini" for lcd games
+				if (device.screen_type() == SCREEN_TYPE_LCD)
+				{
+					parse_one_ini(options, "lcd", OPTION_PRIORITY_SCREEN_INI, &error_stream);
+					break;
+				}
 			}
 		}
 	}
@@ -35,9 +35,12 @@
 #include "uiinput.h"
 #include "unicode.h"
 
+#include <algorithm>
 #include <cstring>
+#include <future>
 #include <iterator>
 #include <memory>
+#include <thread>
 
 
 extern const char UI_VERSION_TAG[];
@@ -877,43 +880,60 @@ void menu_select_game::populate_search()
 	if (m_persistent_data.is_available(system_list::AVAIL_UCS_MANUF_DFLT_DESC))
 		m_searched_fields |= system_list::AVAIL_UCS_MANUF_DFLT_DESC;
 
-	for (std::pair<double, std::reference_wrapper<ui_system_info const> > &info : m_searchlist)
-	{
-		info.first = 1.0;
-		ui_system_info const &sys(info.second);
+	// score the systems on several threads, as this happens on every keystroke
+	auto const score =
+			[this, &ucs_search] (auto begin, auto end)
+			{
+				for (auto it = begin; end != it; ++it)
+				{
+					std::pair<double, std::reference_wrapper<ui_system_info const> > &info(*it);
+					info.first = 1.0;
+					ui_system_info const &sys(info.second);
 
-		// match shortnames
-		if (m_searched_fields & system_list::AVAIL_UCS_SHORTNAME)
-			info.first = util::edit_distance(ucs_search, sys.ucs_shortname);
+					// match shortnames
+					if (m_searched_fields & system_list::AVAIL_UCS_SHORTNAME)
+						info.first = util::edit_distance(ucs_search, sys.ucs_shortname);
 
-		// match reading
-		if (info.first && !sys.ucs_reading_description.empty())
-		{
-			info.first = (std::min)(util::edit_distance(ucs_search, sys.ucs_reading_description), info.first);
+					// match reading
+					if (info.first && !sys.ucs_reading_description.empty())
+					{
+						info.first = (std::min)(util::edit_distance(ucs_search, sys.ucs_reading_description), info.first);
 
-			// match "<manufacturer> <reading>"
-			if (info.first)
-				info.first = (std::min)(util::edit_distance(ucs_search, sys.ucs_manufacturer_reading_description), info.first);
-		}
+						// match "<manufacturer> <reading>"
+						if (info.first)
+							info.first = (std::min)(util::edit_distance(ucs_search, sys.ucs_manufacturer_reading_description), info.first);
+					}
 
-		// match descriptions
-		if (info.first && (m_searched_fields & system_list::AVAIL_UCS_DESCRIPTION))
-			info.first = (std::min)(util::edit_distance(ucs_search, sys.ucs_description), info.first);
+					// match descriptions
+					if (info.first && (m_searched_fields & system_list::AVAIL_UCS_DESCRIPTION))
+						info.first = (std::min)(util::edit_distance(ucs_search, sys.ucs_description), info.first);
 
-		// match "<manufacturer> <description>"
-		if (info.first && (m_searched_fields & system_list::AVAIL_UCS_MANUF_DESC))
-			info.first = (std::min)(util::edit_distance(ucs_search, sys.ucs_manufacturer_description), info.first);
+					// match "<manufacturer> <description>"
+					if (info.first && (m_searched_fields & system_list::AVAIL_UCS_MANUF_DESC))
+						info.first = (std::min)(util::edit_distance(ucs_search, sys.ucs_manufacturer_description), info.first);
 
-		// match default description
-		if (info.first && (m_searched_fields & system_list::AVAIL_UCS_DFLT_DESC) && !sys.ucs_default_description.empty())
-		{
-			info.first = (std::min)(util::edit_distance(ucs_search, sys.ucs_default_description), info.first);
+					// match default description
+					if (info.first && (m_searched_fields & system_list::AVAIL_UCS_DFLT_DESC) && !sys.ucs_default_description.empty())
+					{
+						info.first = (std::min)(util::edit_distance(ucs_search, sys.ucs_default_description), info.first);
 
-			// match "<manufacturer> <default description>"
-			if (info.first && (m_searched_fields & system_list::AVAIL_UCS_MANUF_DFLT_DESC))
-				info.first = (std::min)(util::edit_distance(ucs_search, sys.ucs_manufacturer_default_description), info.first);
-		}
+						// match "<manufacturer> <default description>"
+						if (info.first && (m_searched_fields & system_list::AVAIL_UCS_MANUF_DFLT_DESC))
+							info.first = (std::min)(util::edit_distance(ucs_search, sys.ucs_manufacturer_default_description), info.first);
+					}
+				}
+			};
+	std::size_t const threads = (std::max)(std::thread::hardware_concurrency(), 1U);
+	std::size_t const chunk = (m_searchlist.size() + threads - 1) / threads;
+	std::vector<std::future<void> > workers;
+	for (std::size_t start = chunk; m_searchlist.size() > start; start += chunk)
+	{
+		auto const begin = std::next(m_searchlist.begin(), start);
+		workers.emplace_back(std::async(std::launch::async, score, begin, std::next(begin, (std::min)(chunk, m_searchlist.size() - start))));
 	}
+	score(m_searchlist.begin(), std::next(m_searchlist.begin(), (std::min)(chunk, m_searchlist.size())));
+	for (std::future<void> &worker : workers)
+		worker.get();
 
 	// sort according to edit distance
 	std::stable_sort(
@@ -1094,17 +1114,17 @@ float menu_select_game::draw_left_panel(float x1, float y1, float x2, float y2)
 //  get selected software and/or driver
 //-------------------------------------------------
 
-void menu_select_game::get_selection(ui_software_info const *&software, ui_system_info const *&system) const
+void menu_select_game::get_item_selection(void *ref, ui_software_info const *&software, ui_system_info const *&system) const
 {
 	if (m_populated_favorites)
 	{
-		software = reinterpret_cast<ui_software_info const *>(get_selection_ptr());
+		software = reinterpret_cast<ui_software_info const *>(ref);
 		system = software ? &m_persistent_data.systems()[driver_list::find(software->driver->name)] : nullptr;
 	}
 	else
 	{
 		software = nullptr;
-		system = reinterpret_cast<ui_system_info const *>(get_selection_ptr());
+		system = reinterpret_cast<ui_system_info const *>(ref);
 	}
 }
 
@@ -66,7 +66,7 @@ private:
 	virtual render_texture *get_icon_texture(int linenum, void *selectedref) override;
 
 	// get selected software and/or driver
-	virtual void get_selection(ui_software_info const *&software, ui_system_info const *&system) const override;
+	virtual void get_item_selection(void *ref, ui_software_info const *&software, ui_system_info const *&system) const override;
 	virtual bool accept_search() const override { return !isfavorite(); }
 
 	// text for main top/bottom panels
@@ -413,6 +413,8 @@ menu_select_launch::cache::cache(running_machine &machine)
 	, m_snapx_texture(nullptr, machine.render())
 	, m_snapx_driver(nullptr)
 	, m_snapx_software(nullptr)
+	, m_images(MAX_CACHED_IMAGES)
+	, m_image_exit(false)
 	, m_no_avail_bitmap(256, 256)
 	, m_toolbar_bitmaps()
 	, m_toolbar_textures()
@@ -431,6 +433,143 @@ menu_select_launch::cache::cache(running_machine &machine)
 
 menu_select_launch::cache::~cache()
 {
+	if (m_image_thread.joinable())
+	{
+		{
+			std::lock_guard<std::mutex> guard(m_image_mutex);
+			m_image_exit = true;
+		}
+		m_image_condition.notify_one();
+		m_image_thread.join();
+	}
+}
+
+
+std::string menu_select_launch::cache::image_request::key() const
+{
+	// the search path distinguishes the artwork type
+	std::string result(searchpath);
+	result.append(1, '\0');
+	if (listname.empty())
+	{
+		result.append(driver->name);
+	}
+	else
+	{
+		result.append(listname).append(1, '\0');
+		result.append(shortname).append(1, '\0');
+		result.append(partname);
+	}
+	return result;
+}
+
+
+//-------------------------------------------------
+//  fetch_image - copy a decoded image into dest
+//  if it's ready, or queue it ahead of any
+//  prefetches and return false; an invalid
+//  bitmap means no image was found
+//-------------------------------------------------
+
+bool menu_select_launch::cache::fetch_image(image_request &&request, bitmap_argb32 &dest)
+{
+	std::unique_lock<std::mutex> lock(m_image_mutex);
+	auto const found(m_images.find(request.key()));
+	if (m_images.end() == found)
+	{
+		lock.unlock();
+		queue_image(std::move(request), true);
+		return false;
+	}
+
+	bitmap_argb32 const &src(found->second);
+	dest.reset();
+	if (src.valid())
+	{
+		dest.allocate(src.width(), src.height());
+		for (s32 y = 0; src.height() > y; ++y)
+			std::copy_n(&src.pix(y), src.width(), &dest.pix(y));
+	}
+	return true;
+}
+
+
+void menu_select_launch::cache::prefetch_image(image_request &&request)
+{
+	queue_image(std::move(request), false);
+}
+
+
+void menu_select_launch::cache::queue_image(image_request &&request, bool urgent)
+{
+	std::string key(request.key());
+	{
+		std::lock_guard<std::mutex> guard(m_image_mutex);
+
+		// nothing to do if it's already decoded or being decoded
+		if ((m_images.end() != m_images.find(key)) || (m_image_loading == key))
+			return;
+
+		// the most recent request goes first so scrolling quickly doesn't build a backlog
+		auto const queued(std::find_if(
+				m_image_queue.begin(),
+				m_image_queue.end(),
+				[&key] (image_request const &r) { return r.key() == key; }));
+		if (m_image_queue.end() != queued)
+		{
+			if (!urgent)
+				return;
+			m_image_queue.erase(queued);
+		}
+		if (urgent)
+			m_image_queue.emplace_front(std::move(request));
+		else
+			m_image_queue.emplace_back(std::move(request));
+		if (m_image_queue.size() > MAX_QUEUED_IMAGES)
+			m_image_queue.pop_back();
+
+		if (!m_image_thread.joinable())
+			m_image_thread = std::thread([this] () { image_thread(); });
+	}
+	m_image_condition.notify_one();
+}
+
+
+void menu_select_launch::cache::image_thread()
+{
+	std::unique_lock<std::mutex> lock(m_image_mutex);
+	while (true)
+	{
+		m_image_condition.wait(lock, [this] () { return m_image_exit || !m_image_queue.empty(); });
+		if (m_image_exit)
+			return;
+
+		image_request request(std::move(m_image_queue.front()));
+		m_image_queue.pop_front();
+		m_image_loading = request.key();
+		lock.unlock();
+
+		// emu_file only touches the search path and the OSD file layer
+		emu_file snapfile(request.searchpath, OPEN_FLAG_READ);
+		bitmap_argb32 bitmap;
+		if (request.listname.empty())
+		{
+			load_driver_image(bitmap, snapfile, *request.driver);
+		}
+		else
+		{
+			// First attempt from name list
+			load_image(bitmap, snapfile, util::path_concat(request.listname, request.shortname));
+
+			// Second attempt from driver name + part name
+			if (!bitmap.valid())
+				load_image(bitmap, snapfile, util::path_concat(request.partname, request.shortname));
+		}
+
+		lock.lock();
+		m_images.emplace(std::move(m_image_loading), std::move(bitmap));
+		m_image_loading.clear();
+	}
 }
 
 
@@ -2350,27 +2489,22 @@ void menu_select_launch::arts_render(float origx1, float origy1, float origx2, f
 		// loads the image if necessary
 		if (!m_cache.snapx_software_is(software) || !snapx_valid() || m_switch_image)
 		{
-			emu_file snapfile(searchstr.c_str(), OPEN_FLAG_READ);
+			cache::image_request request;
 			bitmap_argb32 tmp_bitmap;
-
-			if (software->startempty == 1)
+			make_image_request(searchstr, software, system, request);
+			if (m_cache.fetch_image(std::move(request), tmp_bitmap))
 			{
-				// Load driver snapshot
-				load_driver_image(tmp_bitmap, snapfile, *software->driver);
+				m_cache.set_snapx_software(software);
+				m_switch_image = false;
+				arts_render_images(std::move(tmp_bitmap), origx1, origy1, origx2, origy2);
 			}
 			else
 			{
-				// First attempt from name list
-				load_image(tmp_bitmap, snapfile, util::path_concat(software->listname, software->shortname));
-
-				// Second attempt from driver name + part name
-				if (!tmp_bitmap.valid())
-					load_image(tmp_bitmap, snapfile, util::path_concat(software->driver->name + software->part, software->shortname));
+				// leave the panel empty until it's decoded
+				m_cache.set_snapx_software(nullptr);
+				m_cache.snapx_bitmap().reset();
 			}
-
-			m_cache.set_snapx_software(software);
-			m_switch_image = false;
-			arts_render_images(std::move(tmp_bitmap), origx1, origy1, origx2, origy2);
+			arts_prefetch(searchstr);
 		}
 
 		// if the image is available, loaded and valid, display it
@@ -2385,13 +2519,22 @@ void menu_select_launch::arts_render(float origx1, float origy1, float origx2, f
 		// loads the image if necessary
 		if (!m_cache.snapx_driver_is(system->driver) || !snapx_valid() || m_switch_image)
 		{
-			emu_file snapfile(searchstr, OPEN_FLAG_READ);
+			cache::image_request request;
 			bitmap_argb32 tmp_bitmap;
-			load_driver_image(tmp_bitmap, snapfile, *system->driver);
-
-			m_cache.set_snapx_driver(system->driver);
-			m_switch_image = false;
-			arts_render_images(std::move(tmp_bitmap), origx1, origy1, origx2, origy2);
+			make_image_request(searchstr, nullptr, system, request);
+			if (m_cache.fetch_image(std::move(request), tmp_bitmap))
+			{
+				m_cache.set_snapx_driver(system->driver);
+				m_switch_image = false;
+				arts_render_images(std::move(tmp_bitmap), origx1, origy1, origx2, origy2);
+			}
+			else
+			{
+				// leave the panel empty until it's decoded
+				m_cache.set_snapx_driver(nullptr);
+				m_cache.snapx_bitmap().reset();
+			}
+			arts_prefetch(searchstr);
 		}
 
 		// if the image is available, loaded and valid, display it
@@ -2400,6 +2543,63 @@ void menu_select_launch::arts_render(float origx1, float origy1, float origx2, f
 }
 
 
+//-------------------------------------------------
+//  queue images for the items either side of the
+//  selection so they're ready when scrolling
+//-------------------------------------------------
+
+void menu_select_launch::arts_prefetch(std::string const &searchstr)
+{
+	int const selected(selected_index());
+	for (int distance = 1; 2 >= distance; ++distance)
+	{
+		for (int const index : { selected + distance, selected - distance })
+		{
+			if ((0 > index) || (item_count() <= index) || (uintptr_t(item(index).ref()) <= m_skip_main_items))
+				continue;
+
+			ui_software_info const *software;
+			ui_system_info const *system;
+			get_item_selection(item(index).ref(), software, system);
+
+			cache::image_request request;
+			if (make_image_request(searchstr, software, system, request))
+				m_cache.prefetch_image(std::move(request));
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  describe the image to load for an item
+//-------------------------------------------------
+
+bool menu_select_launch::make_image_request(std::string const &searchstr, ui_software_info const *software, ui_system_info const *system, cache::image_request &request)
+{
+	request.searchpath = searchstr;
+	if (software && (!software->startempty || !system))
+	{
+		request.driver = software->driver;
+		if (software->startempty != 1)
+		{
+			request.listname = software->listname;
+			request.shortname = software->shortname;
+			request.partname = software->driver->name + software->part;
+		}
+		return true;
+	}
+	else if (system)
+	{
+		request.driver = system->driver;
+		return true;
+	}
+	else
+	{
+		return false;
+	}
+}
+
+
 //-------------------------------------------------
 //  common function for images render
 //-------------------------------------------------
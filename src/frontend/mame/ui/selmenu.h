@@ -18,9 +18,14 @@
 
 #include "lrucache.h"
 
+#include <condition_variable>
+#include <deque>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <string>
+#include <thread>
 #include <vector>
 
 
@@ -164,6 +169,12 @@ protected:
 		return (uintptr_t(selected_ref) > m_skip_main_items) ? selected_ref : m_prev_selected;
 	}
 
+	// get selected software and/or driver
+	void get_selection(ui_software_info const *&software, ui_system_info const *&system) const
+	{
+		get_item_selection(get_selection_ptr(), software, system);
+	}
+
 	u8 right_panel() const { return m_right_panel; }
 	u8 right_image() const { return m_image_view; }
 	char const *right_panel_config_string() const;
@@ -218,12 +229,43 @@ private:
 
 		void cache_toolbar(running_machine &machine, float width, float height);
 
+		// artwork is decoded on a background thread
+		struct image_request
+		{
+			std::string             searchpath;
+			game_driver const       *driver = nullptr; // system image if listname is empty
+			std::string             listname;
+			std::string             shortname;
+			std::string             partname;
+
+			std::string key() const;
+		};
+
+		bool fetch_image(image_request &&request, bitmap_argb32 &dest);
+		void prefetch_image(image_request &&request);
+
 	private:
+		using image_lru = util::lru_cache_map<std::string, bitmap_argb32>;
+
+		static constexpr std::size_t MAX_CACHED_IMAGES = 32;
+		static constexpr std::size_t MAX_QUEUED_IMAGES = 8;
+
+		void queue_image(image_request &&request, bool urgent);
+		void image_thread();
+
 		bitmap_ptr              m_snapx_bitmap;
 		texture_ptr             m_snapx_texture;
 		game_driver const       *m_snapx_driver;
 		ui_software_info const  *m_snapx_software;
 
+		std::thread                 m_image_thread;
+		std::mutex                  m_image_mutex;
+		std::condition_variable     m_image_condition;
+		std::deque<image_request>   m_image_queue;
+		image_lru                   m_images;
+		std::string                 m_image_loading;
+		bool                        m_image_exit;
+
 		bitmap_argb32           m_no_avail_bitmap;
 
 		bitmap_vector           m_toolbar_bitmaps;
@@ -256,8 +298,8 @@ private:
 	void infos_render(float x1, float y1, float x2, float y2);
 	void general_info(ui_system_info const *system, game_driver const &driver, std::string &buffer);
 
-	// get selected software and/or driver
-	virtual void get_selection(ui_software_info const *&software, ui_system_info const *&system) const = 0;
+	// get software and/or driver for a list item reference
+	virtual void get_item_selection(void *ref, ui_software_info const *&software, ui_system_info const *&system) const = 0;
 	virtual bool accept_search() const { return true; }
 	void select_prev()
 	{
@@ -301,6 +343,8 @@ private:
 	void arts_render(float origx1, float origy1, float origx2, float origy2);
 	std::string arts_render_common(float origx1, float origy1, float origx2, float origy2);
 	void arts_render_images(bitmap_argb32 &&bitmap, float origx1, float origy1, float origx2, float origy2);
+	void arts_prefetch(std::string const &searchstr);
+	static bool make_image_request(std::string const &searchstr, ui_software_info const *software, ui_system_info const *system, cache::image_request &request);
 	void draw_snapx(float origx1, float origy1, float origx2, float origy2);
 
 	// text for main top/bottom panels
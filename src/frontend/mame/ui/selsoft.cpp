@@ -764,9 +764,9 @@ render_texture *menu_select_software::get_icon_texture(int linenum, void *select
 //  get selected software and/or driver
 //-------------------------------------------------
 
-void menu_select_software::get_selection(ui_software_info const *&software, ui_system_info const *&system) const
+void menu_select_software::get_item_selection(void *ref, ui_software_info const *&software, ui_system_info const *&system) const
 {
-	software = reinterpret_cast<ui_software_info const *>(get_selection_ptr());
+	software = reinterpret_cast<ui_software_info const *>(ref);
 	system = &m_system;
 }
 
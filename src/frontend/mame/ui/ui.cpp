@@ -1414,6 +1414,13 @@ uint32_t mame_ui_manager::handler_ingame(render_container &container)
 			machine().sound().ui_mute(!new_throttle_state);
 	}
 
+	// toggle turbo mode?
+	if (machine().ui_input().pressed(IPT_UI_TURBO))
+	{
+		machine().video().set_turbo(!machine().video().turbo());
+		show_fps_temp(2.0);
+	}
+
 	// check for fast forward
 	if (machine().ioport().type_pressed(IPT_UI_FAST_FORWARD))
 	{
@@ -493,12 +493,19 @@ cassette_image::error cassette_image::put_samples(int channel,
 			(int)ranges.sample_first,   (int)ranges.sample_last);
 	}
 
+	// when there's a source sample for every destination sample, skip the scaling
+	bool const direct = (sample_count == (ranges.sample_last + 1 - ranges.sample_first));
+
 	for (size_t sample_index = ranges.sample_first; sample_index <= ranges.sample_last; sample_index++)
 	{
 		/* figure out the source pointer */
-		double d = map_double(sample_count, ranges.sample_first, ranges.sample_last + 1, sample_index);
+		size_t source_index;
+		if (direct)
+			source_index = sample_index - ranges.sample_first;
+		else
+			source_index = (size_t) map_double(sample_count, ranges.sample_first, ranges.sample_last + 1, sample_index);
 		const uint8_t *source_ptr = (const uint8_t*)samples;
-		source_ptr += ((size_t) d) * sample_spacing;
+		source_ptr += source_index * sample_spacing;
 
 		/* compute the value that we are writing */
 		int32_t dest_value;
@@ -862,10 +869,26 @@ cassette_image::error cassette_image::legacy_construct(const LegacyWaveFiller *l
 		pos += length;
 	}
 
+	/* read the image in one go rather than a chunk at a time, which can be a byte */
+	if (bytes.empty() && (size <= 0x7FFFFFFF))
+	{
+		bytes.resize(size);
+		if (size)
+			image_read(&bytes[0], 0, size);
+	}
+
 	/* convert the file data to samples */
 	while ((pos < sample_count) && (offset < size))
 	{
-		image_read(&chunk[0], offset, args.chunk_size);
+		if (!bytes.empty())
+		{
+			// a short final chunk keeps the tail of the previous one, as with image_read
+			memcpy(&chunk[0], &bytes[offset], std::min<uint64_t>(args.chunk_size, size - offset));
+		}
+		else
+		{
+			image_read(&chunk[0], offset, args.chunk_size);
+		}
 		offset += args.chunk_size;
 
 		length = args.fill_wave(&samples[pos], sample_count - pos, &chunk[0]);
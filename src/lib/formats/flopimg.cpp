@@ -35,6 +35,15 @@ floppy_image::~floppy_image()
 {
 }
 
+void floppy_image::generate(track_info &t)
+{
+	// clear the generator first so it can't be reentered
+	auto generator = std::move(t.generator);
+	t.generator = nullptr;
+	t.cell_data.clear();
+	generator(t.cell_data);
+}
+
 void floppy_image::get_maximal_geometry(int &_tracks, int &_heads) const
 {
 	_tracks = tracks;
@@ -47,7 +56,7 @@ void floppy_image::get_actual_geometry(int &_tracks, int &_heads)
 
 	while(maxt >= 0) {
 		for(int i=0; i<=maxh; i++)
-			if(!track_array[maxt][i].cell_data.empty())
+			if(track_array[maxt][i].has_data())
 				goto track_done;
 		maxt--;
 	}
@@ -55,7 +64,7 @@ void floppy_image::get_actual_geometry(int &_tracks, int &_heads)
 	if(maxt >= 0)
 		while(maxh >= 0) {
 			for(int i=0; i<=maxt; i++)
-				if(!track_array[i][maxh].cell_data.empty())
+				if(track_array[i][maxh].has_data())
 					goto head_done;
 			maxh--;
 		}
@@ -72,7 +81,7 @@ int floppy_image::get_resolution() const
 	int mask = 0;
 	for(int i=0; i<=(tracks-1)*4; i++)
 		for(int j=0; j<heads; j++)
-			if(!track_array[i][j].cell_data.empty())
+			if(track_array[i][j].has_data())
 				mask |= 1 << (i & 3);
 	if(mask & 0xa)
 		return 2;
@@ -88,7 +97,10 @@ bool floppy_image::track_is_formatted(int track, int head, int subtrack)
 		return false;
 	if(int(track_array[idx].size()) <= head)
 		return false;
-	const auto &data = track_array[idx][head].cell_data;
+	track_info &t = track_array[idx][head];
+	if(t.generator)
+		generate(t);
+	const auto &data = t.cell_data;
 	if(data.empty())
 		return false;
 	for(uint32_t mg : data)
@@ -15,6 +15,7 @@
 
 #include "utilfwd.h"
 
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -569,7 +570,19 @@ public:
 	  @param head head number
 	  @return a pointer to the data buffer for this track and head
 	*/
-	std::vector<uint32_t> &get_buffer(int track, int head, int subtrack = 0) { assert(track < tracks && head < heads); return track_array[track*4+subtrack][head].cell_data; }
+	std::vector<uint32_t> &get_buffer(int track, int head, int subtrack = 0) { assert(track < tracks && head < heads); track_info &t = track_array[track*4+subtrack][head]; if(t.generator) generate(t); return t.cell_data; }
+
+	//! Defers building a track's cell data until it's first accessed.
+	//! Formats keeping the source data for each track themselves can
+	//! use this to avoid decoding tracks that are never read.  The
+	//! generator must produce a formatted (non-empty) track.
+
+	/*! @param track
+	    @param head
+	    @param generator function filling the cell data buffer it's given
+	    @param subtrack
+	*/
+	void set_track_generator(int track, int head, std::function<void (std::vector<uint32_t> &)> &&generator, int subtrack = 0) { assert(track < tracks && head < heads); track_info &t = track_array[track*4+subtrack][head]; t.cell_data.clear(); t.generator = std::move(generator); }
 
 	//! Sets the write splice position.
 	//! The "track splice" information indicates where to start writing
@@ -612,11 +625,16 @@ private:
 	struct track_info
 	{
 		std::vector<uint32_t> cell_data;
+		std::function<void (std::vector<uint32_t> &)> generator; // builds cell_data on first access
 		uint32_t write_splice;
 
 		track_info() { write_splice = 0; }
+
+		bool has_data() const { return generator || !cell_data.empty(); }
 	};
 
+	static void generate(track_info &t);
+
 	// track number multiplied by 4 then head
 	// last array size may be bigger than actual track size
 	std::vector<std::vector<track_info> > track_array;
@@ -69,6 +69,33 @@
   TODO: big-endian support
 */
 
+namespace {
+
+// Inflate a track's data without keeping it, to check that it's intact
+// and has the expected size before it's left for later
+bool check_track(const std::vector<uint8_t> &compressed, uint32_t uncompressed_size)
+{
+	z_stream stream;
+	memset(&stream, 0, sizeof(stream));
+	if(inflateInit(&stream) != Z_OK)
+		return false;
+
+	uint8_t scratch[16384];
+	stream.next_in = const_cast<Bytef *>(compressed.data());
+	stream.avail_in = compressed.size();
+	int err;
+	do {
+		stream.next_out = scratch;
+		stream.avail_out = sizeof(scratch);
+		err = inflate(&stream, Z_NO_FLUSH);
+	} while(err == Z_OK && stream.total_out <= uncompressed_size);
+	bool const result = err == Z_STREAM_END && stream.total_out == uncompressed_size;
+	inflateEnd(&stream);
+	return result;
+}
+
+} // anonymous namespace
+
 const char mfi_format::sign_old[16] = "MESSFLOPPYIMAGE"; // Includes the final \0
 const char mfi_format::sign[16]     = "MAMEFLOPPYIMAGE"; // Includes the final \0
 
@@ -165,9 +192,6 @@ bool mfi_format::load(util::random_read &io, uint32_t form_factor, const std::ve
 		};
 	}
 
-	std::vector<uint8_t> compressed;
-	std::vector<uint32_t> uncompressed;
-
 	entry *ent = entries;
 	for(unsigned int cyl=0; cyl <= (h.cyl_count - 1) << 2; cyl += 4 >> resolution)
 		for(unsigned int head=0; head != h.head_count; head++) {
@@ -180,22 +204,23 @@ bool mfi_format::load(util::random_read &io, uint32_t form_factor, const std::ve
 				continue;
 			}
 
-			unsigned int cell_count = ent->uncompressed_size/4;
-			compressed.resize(ent->compressed_size);
-			uncompressed.resize(cell_count);
-
-			io.read_at(ent->offset, &compressed[0], ent->compressed_size, actual);
-
-			uLongf size = ent->uncompressed_size;
-			if(uncompress((Bytef *)uncompressed.data(), &size, &compressed[0], ent->compressed_size) != Z_OK) {
-				fprintf(stderr, "fail1\n");
+			std::vector<uint8_t> compressed(ent->compressed_size);
+			if(io.read_at(ent->offset, &compressed[0], ent->compressed_size, actual) || actual != ent->compressed_size)
 				return false;
-			}
 
-			std::vector<uint32_t> &trackbuf = image->get_buffer(cyl >> 2, head, cyl & 3);
-			trackbuf.clear();
+			// a damaged track fails the load now rather than reading back empty later
+			if(!check_track(compressed, ent->uncompressed_size))
+				return false;
 
-			converter(uncompressed, trackbuf);
+			// only keep the compressed data until the track is first used
+			image->set_track_generator(cyl >> 2, head,
+					[compressed = std::move(compressed), uncompressed_size = ent->uncompressed_size, converter] (std::vector<uint32_t> &trackbuf) {
+						std::vector<uint32_t> uncompressed(uncompressed_size/4);
+						uLongf size = uncompressed_size;
+						if(uncompress((Bytef *)uncompressed.data(), &size, &compressed[0], compressed.size()) == Z_OK)
+							converter(uncompressed, trackbuf);
+					},
+					cyl & 3);
 			ent++;
 		}
 
@@ -113,6 +113,7 @@ namespace netlist::devices
 		, m_startup_strategy(*this, "STARTUP_STRATEGY", 0)
 		, m_mos_cap_model(*this, "DEFAULT_MOS_CAPMODEL", 2)
 		, m_max_link_loops(*this, "MAX_LINK_RESOLVE_LOOPS", 100)
+		, m_fuse_truth_tables(*this, "FUSE_TRUTH_TABLES", 0)
 		{
 		}
 		// NETLIB_RESETI() {}
@@ -123,6 +124,8 @@ namespace netlist::devices
 		param_num_t<unsigned> m_mos_cap_model;
 		//! How many times do we try to resolve links (connections)
 		param_num_t<unsigned> m_max_link_loops;
+		//! Maximum inputs of fused truth tables, 0 disables fusion
+		param_num_t<unsigned> m_fuse_truth_tables;
 	};
 
 	// -----------------------------------------------------------------------------
@@ -76,8 +76,9 @@ namespace netlist::detail
 			m_size = this->size();
 			for (std::size_t i = 0; i < m_size; i++)
 			{
-				m_times[i] = this->list_pointer()[i].exec_time().as_raw();
-				m_net_ids[i] = m_get_id(this->list_pointer()[i].object());
+				const entry_t e((*this)[i]);
+				m_times[i] = e.exec_time().as_raw();
+				m_net_ids[i] = m_get_id(e.object());
 			}
 		}
 		void on_post_load(
@@ -214,6 +214,7 @@ namespace netlist
 	private:
 
 		void resolve_inputs();
+		void fuse_truth_tables(std::size_t max_inputs);
 		pstring resolve_alias(const pstring &name) const;
 
 		void merge_nets(detail::net_t &this_net, detail::net_t &other_net);
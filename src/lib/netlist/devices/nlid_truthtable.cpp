@@ -8,6 +8,8 @@
 #include "nl_factory.h"
 #include "nlid_truthtable.h"
 
+#include <algorithm>
+#include <array>
 #include <bitset>
 #include <cstdint>
 #include <vector>
@@ -664,6 +666,22 @@ namespace netlist::factory {
 	{
 	}
 
+	std::vector<pstring> truth_table_base_element_t::inputs() const
+	{
+		std::vector<pstring> ret(plib::psplit(plib::psplit(m_desc[0], '|')[0], ','));
+		for (auto &e : ret)
+			e = plib::trim(e);
+		return ret;
+	}
+
+	std::vector<pstring> truth_table_base_element_t::outputs() const
+	{
+		std::vector<pstring> ret(plib::psplit(plib::psplit(m_desc[0], '|')[1], ','));
+		for (auto &e : ret)
+			e = plib::trim(e);
+		return ret;
+	}
+
 	#define ENTRYY(n, m, s)    case (n * 100 + m): \
 		{ using dev_type = devices::factory_truth_table_t<n, m>; \
 			auto cs=s; \
@@ -703,4 +721,130 @@ namespace netlist::factory {
 		return ret;
 	}
 
+	// ----------------------------------------------------------------------------------------
+	// Truth table fusion ....
+	// ----------------------------------------------------------------------------------------
+
+	namespace {
+
+		struct truth_table_values
+		{
+			explicit truth_table_values(const truth_table_base_element_t &tt)
+			: m_ni(tt.inputs().size())
+			, m_no(tt.outputs().size())
+			, m_out(std::size_t(1) << m_ni)
+			, m_timing(m_out.size() * m_no)
+			{
+				devices::truth_table_parser parser(unsigned(m_no), unsigned(m_ni),
+						devices::packed_int(m_out.data(), sizeof(m_out[0]) * 8),
+						m_timing.data(), m_timing_nt.data());
+				parser.parse(tt.m_desc);
+			}
+
+			std::uint_least64_t value(std::size_t state) const noexcept
+			{
+				return m_out[state] & ((std::uint_least64_t(1) << m_no) - 1);
+			}
+
+			netlist_time delay(std::size_t state, std::size_t output) const noexcept
+			{
+				return m_timing_nt[m_timing[state * m_no + output]];
+			}
+
+		private:
+			std::size_t m_ni;
+			std::size_t m_no;
+			std::vector<std::uint_least64_t> m_out;
+			std::vector<uint_least8_t> m_timing;
+			std::array<netlist_time, 16> m_timing_nt;
+		};
+
+		pstring join(const std::vector<pstring> &list)
+		{
+			pstring ret;
+			for (const auto &e : list)
+			{
+				if (!ret.empty())
+					ret += ",";
+				ret += e;
+			}
+			return ret;
+		}
+
+	} // anonymous namespace
+
+	host_arena::unique_ptr<truth_table_base_element_t> truth_table_fuse(const pstring &name,
+		const truth_table_base_element_t &drv, const truth_table_base_element_t &rcv,
+		std::size_t input, std::size_t max_inputs)
+	{
+		const auto drv_in(drv.inputs());
+		const auto rcv_in(rcv.inputs());
+		const auto rcv_out(rcv.outputs());
+		const std::size_t nr(rcv_in.size() - 1);
+		const std::size_t ni(nr + drv_in.size());
+
+		if (drv.outputs().size() != 1 || input > nr || ni > std::min<std::size_t>(max_inputs, 12))
+			return nullptr;
+
+		// inputs of rcv except the fused one, followed by the inputs of drv
+		std::vector<pstring> names;
+		for (std::size_t i = 0; i < rcv_in.size(); i++)
+			if (i != input)
+				names.push_back(rcv_in[i]);
+		for (const auto &e : drv_in)
+		{
+			pstring n(rcv_in[input] + "_" + e);
+			while (plib::container::contains(names, n) || plib::container::contains(rcv_out, n))
+				n += "_";
+			names.push_back(n);
+		}
+
+		const truth_table_values dv(drv);
+		const truth_table_values rv(rcv);
+
+		tt_desc desc;
+		desc.name = name;
+		desc.ni = ni;
+		desc.no = rcv_out.size();
+		desc.family = rcv.m_family_name;
+		desc.desc.push_back(join(names) + "|" + join(rcv_out));
+
+		const std::size_t low_mask((std::size_t(1) << input) - 1);
+		const std::size_t rcv_mask((std::size_t(1) << nr) - 1);
+		std::vector<std::int64_t> delays;
+		for (std::size_t s = 0; s < (std::size_t(1) << ni); s++)
+		{
+			const std::size_t ds(s >> nr);
+			const std::size_t rs((s & low_mask) | ((s & rcv_mask & ~low_mask) << 1)
+				| (dv.value(ds) << input));
+			const std::uint_least64_t q(rv.value(rs));
+			const std::uint_least64_t sensitive(q ^ rv.value(rs ^ (std::size_t(1) << input)));
+
+			std::vector<pstring> ins;
+			std::vector<pstring> outs;
+			std::vector<pstring> times;
+			for (std::size_t i = 0; i < ni; i++)
+				ins.emplace_back(((s >> i) & 1) ? "1" : "0");
+			for (std::size_t j = 0; j < desc.no; j++)
+			{
+				netlist_time t(rv.delay(rs, j));
+				if ((sensitive >> j) & 1)
+					t += dv.delay(ds, 0);
+				const auto ns(static_cast<std::int64_t>(t.as_double() * 1e9 + 0.5));
+				if (!plib::container::contains(delays, ns))
+				{
+					// the truth table device only supports 16 different delays
+					if (delays.size() == 16)
+						return nullptr;
+					delays.push_back(ns);
+				}
+				outs.emplace_back(((q >> j) & 1) ? "1" : "0");
+				times.push_back(plib::pfmt("{1}")(ns));
+			}
+			desc.desc.push_back(join(ins) + "|" + join(outs) + "|" + join(times));
+		}
+
+		return truth_table_create(desc, properties("", rcv.source()));
+	}
+
 } // namespace netlist::factory
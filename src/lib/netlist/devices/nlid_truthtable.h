@@ -19,6 +19,9 @@ namespace netlist::factory {
 	public:
 		truth_table_base_element_t(const pstring &name,properties &&props);
 
+		std::vector<pstring> inputs() const;
+		std::vector<pstring> outputs() const;
+
 		std::vector<pstring> m_desc;
 		pstring m_family_name;
 	};
@@ -26,6 +29,21 @@ namespace netlist::factory {
 	host_arena::unique_ptr<truth_table_base_element_t> truth_table_create(tt_desc &desc,
 		properties &&props);
 
+	/// \brief Fuse two truth tables into one
+	///
+	/// The output of single output table \p drv feeds input \p input of
+	/// \p rcv. The result has the inputs of \p rcv except \p input, followed
+	/// by the inputs of \p drv, and the outputs of \p rcv. Outputs
+	/// depending on \p input in a given state are delayed by the delays of
+	/// both tables.
+	///
+	/// \returns nullptr if the result would have more than \p max_inputs
+	///          inputs or cannot represent the combined delays.
+	///
+	host_arena::unique_ptr<truth_table_base_element_t> truth_table_fuse(const pstring &name,
+		const truth_table_base_element_t &drv, const truth_table_base_element_t &rcv,
+		std::size_t input, std::size_t max_inputs);
+
 } // namespace netlist::factory
 
 #endif // NLID_TRUTHTABLE_H_
@@ -259,11 +259,20 @@ namespace netlist
 		/// linear processing queue. This slows down execution by about 35%
 		/// on a Kaby Lake.
 		///
+		/// Use timed_queue_wheel to sort only the events of the current
+		/// time step and keep later ones in buckets of a time wheel. This
+		/// scales better for netlists with many pending events, e.g. large
+		/// TTL netlists. Run `nltool -c run -s -v` on the netlist in question
+		/// to compare queue statistics and execution time.
+		///
 		/// The default is the  linear queue.
 
 		// template <class A, class T>
 		// using timed_queue = plib::timed_queue_heap<A, T>;
 
+		// template <class A, class T>
+		// using timed_queue = plib::timed_queue_wheel<A, T>;
+
 		template <typename A, typename T>
 		using timed_queue = plib::timed_queue_linear<A, T>;
 	};
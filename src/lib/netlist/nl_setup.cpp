@@ -22,6 +22,7 @@
 #include "plib/putil.h"
 
 #include <sstream>
+#include <unordered_set>
 
 namespace netlist
 {
@@ -1670,6 +1671,245 @@ namespace netlist
 			m_nlstate.nets().end());
 	}
 
+	// -------------------------------------------------------------------------
+	// Truth table fusion
+	// -------------------------------------------------------------------------
+
+	static pstring device_of(const pstring &terminal)
+	{
+		pstring::size_type p = terminal.find('.');
+		if (p == pstring::npos)
+			return pstring();
+		for (auto n = terminal.find('.', p + 1); n != pstring::npos;
+			 n = terminal.find('.', p + 1))
+			p = n;
+		return terminal.substr(0, p);
+	}
+
+	///
+	/// Fuse truth table devices whose single output only drives one input of
+	/// another truth table device into one truth table. This runs on the
+	/// abstract net list before devices are created. It is repeated until
+	/// nothing is left to fuse, so chains of gates end up in one device named
+	/// after the last gate of the chain.
+	///
+	/// Devices with parameters or hints set are left alone, as are outputs
+	/// seen by anything else, e.g. logs or the MAME interface.
+	///
+	void setup_t::fuse_truth_tables(std::size_t max_inputs)
+	{
+		using tt_element = factory::truth_table_base_element_t;
+
+		// devices (and all their prefixes) parameters or hints refer to
+		std::unordered_set<pstring> configured;
+		auto add_configured = [&configured](const pstring &key)
+		{
+			for (pstring dev = device_of(key); !dev.empty();
+				 dev = device_of(dev))
+				configured.insert(dev);
+		};
+		for (const auto &p : m_abstract.m_param_values)
+			add_configured(p.first);
+		for (const auto &h : m_abstract.m_hints)
+			add_configured(h.first);
+
+		std::size_t fused(0);
+		for (bool again = true; again;)
+		{
+			again = false;
+
+			std::unordered_map<pstring, tt_element *> tts;
+			std::unordered_map<pstring, std::size_t> position;
+			for (std::size_t i = 0; i < m_abstract.m_device_factory.size(); i++)
+			{
+				const auto &d(m_abstract.m_device_factory[i]);
+				auto *tt(dynamic_cast<tt_element *>(d.second));
+				if (tt != nullptr && configured.find(d.first) == configured.end())
+				{
+					tts.emplace(d.first, tt);
+					position.emplace(d.first, i);
+				}
+			}
+
+			// same resolution as find_terminal, including the ".Q" default
+			auto resolve = [this, &tts](const pstring &name)
+			{
+				pstring ret(resolve_alias(name));
+				return (tts.find(ret) != tts.end()) ? ret + ".Q" : ret;
+			};
+
+			// collect the terminals connected together
+			std::unordered_map<pstring, std::size_t> ids;
+			std::vector<std::size_t>                 parent;
+			auto id = [&ids, &parent](const pstring &name)
+			{
+				auto r(ids.emplace(name, parent.size()));
+				if (r.second)
+					parent.push_back(parent.size());
+				return r.first->second;
+			};
+			auto root = [&parent](std::size_t i)
+			{
+				while (parent[i] != i)
+					i = parent[i] = parent[parent[i]];
+				return i;
+			};
+
+			std::vector<detail::abstract_t::connection_t> resolved;
+			for (const auto &c : m_abstract.m_connections)
+			{
+				resolved.emplace_back(resolve(c.first), resolve(c.second));
+				const std::size_t i1(id(resolved.back().first));
+				const std::size_t i2(id(resolved.back().second));
+				parent[root(i1)] = root(i2);
+			}
+			std::unordered_map<std::size_t, std::vector<pstring>> members;
+			for (const auto &c : resolved)
+				for (const auto *t : { &c.first, &c.second })
+				{
+					auto &m(members[root(ids[*t])]);
+					if (!plib::container::contains(m, *t))
+						m.push_back(*t);
+				}
+
+			auto is_plain = [](const std::vector<pstring> &inputs)
+			{
+				// "_Q" inputs are connected to outputs internally
+				return std::none_of(inputs.begin(), inputs.end(),
+					[](const pstring &e) { return plib::startsWith(e, "_"); });
+			};
+
+			// find the pairs to fuse, each device at most once per pass
+			std::unordered_set<pstring>          used;
+			std::unordered_set<pstring>          removed;
+			std::unordered_map<pstring, pstring> renames;
+			for (const auto &d : m_abstract.m_device_factory)
+			{
+				auto drv(tts.find(d.first));
+				if (drv == tts.end() || used.find(d.first) != used.end())
+					continue;
+				const auto drv_in(drv->second->inputs());
+				const auto drv_out(drv->second->outputs());
+				if (drv_out.size() != 1 || !is_plain(drv_in))
+					continue;
+
+				const pstring q(d.first + "." + drv_out[0]);
+				const auto    qi(ids.find(q));
+				if (qi == ids.end())
+					continue;
+				const auto &net(members[root(qi->second)]);
+				if (net.size() != 2)
+					continue;
+
+				const pstring &x(net[0] == q ? net[1] : net[0]);
+				const pstring  rcv_name(device_of(x));
+				auto           rcv(tts.find(rcv_name));
+				if (rcv == tts.end() || rcv_name == d.first
+					|| used.find(rcv_name) != used.end()
+					|| rcv->second->m_family_name != drv->second->m_family_name)
+					continue;
+				const auto rcv_in(rcv->second->inputs());
+				const std::size_t input(plib::container::index_of(rcv_in,
+					x.substr(rcv_name.length() + 1)));
+				if (input == plib::container::npos || !is_plain(rcv_in))
+					continue;
+
+				auto fac(factory::truth_table_fuse(
+					plib::pfmt("TT_FUSED_{1}")(fused), *drv->second,
+					*rcv->second, input, max_inputs));
+				if (!fac)
+					continue;
+
+				log().debug("fusing {1} into {2}\n", d.first, rcv_name);
+				const auto fused_in(fac->inputs());
+				for (std::size_t i = 0; i < drv_in.size(); i++)
+					renames[d.first + "." + drv_in[i]] = rcv_name + "."
+						+ fused_in[rcv_in.size() - 1 + i];
+				renames[q] = pstring();
+				renames[x] = pstring();
+
+				m_abstract.m_device_factory[position[rcv_name]].second = fac.get();
+				m_abstract.m_factory.add(std::move(fac));
+				used.insert(d.first);
+				used.insert(rcv_name);
+				removed.insert(d.first);
+				fused++;
+				again = true;
+			}
+
+			if (!again)
+				break;
+
+			// rewrite the connections, empty to drop
+			auto rewrite = [&](const pstring &name, const pstring &res)
+			{
+				auto r(renames.find(res));
+				if (r != renames.end())
+					return r->second;
+				if (removed.find(device_of(res)) == removed.end())
+					return name;
+				// other terminals of removed devices, e.g. the power pins:
+				// use another terminal on the same net instead
+				for (const auto &t : members[root(ids[res])])
+					if (removed.find(device_of(t)) == removed.end())
+						return t;
+				return pstring();
+			};
+
+			// Substituted connections may close loops, and connecting a
+			// terminal to a rail net twice is an error. Keep the untouched
+			// connections and only those substituted ones still needed.
+			std::vector<detail::abstract_t::connection_t> connections;
+			std::vector<bool>                             changed;
+			for (std::size_t i = 0; i < resolved.size(); i++)
+			{
+				const auto &c(m_abstract.m_connections[i]);
+				const pstring t1(rewrite(c.first, resolved[i].first));
+				const pstring t2(rewrite(c.second, resolved[i].second));
+				connections.emplace_back(t1, t2);
+				changed.push_back(t1 != c.first || t2 != c.second);
+			}
+			parent.clear();
+			ids.clear();
+			for (std::size_t i = 0; i < connections.size(); i++)
+				if (!changed[i])
+					parent[root(id(resolve(connections[i].first)))]
+						= root(id(resolve(connections[i].second)));
+			m_abstract.m_connections.clear();
+			for (std::size_t i = 0; i < connections.size(); i++)
+			{
+				const auto &c(connections[i]);
+				if (changed[i])
+				{
+					if (c.first.empty() || c.second.empty())
+						continue;
+					const std::size_t r1(root(id(resolve(c.first))));
+					const std::size_t r2(root(id(resolve(c.second))));
+					if (r1 == r2)
+						continue;
+					parent[r1] = r2;
+				}
+				m_abstract.m_connections.push_back(c);
+			}
+
+			for (auto &a : m_abstract.m_aliases)
+			{
+				auto r(renames.find(a.second.references()));
+				if (r != renames.end() && !r->second.empty())
+					a.second = detail::alias_t(a.second.type(), a.second.name(),
+						r->second);
+			}
+
+			auto &devs(m_abstract.m_device_factory);
+			devs.erase(std::remove_if(devs.begin(), devs.end(),
+						   [&removed](const auto &e)
+						   { return removed.find(e.first) != removed.end(); }),
+				devs.end());
+		}
+
+		log().verbose("fused {1} truth tables", fused);
+	}
+
 	// -------------------------------------------------------------------------
 	// Run preparation
 	// -------------------------------------------------------------------------
@@ -1725,6 +1965,11 @@ namespace netlist
 		m_parser.register_model(plib::pfmt("PMOS_DEFAULT _(CAPMOD={1})")(
 			m_netlist_params->m_mos_cap_model()));
 
+		// fuse truth tables before devices are created
+
+		if (m_netlist_params->m_fuse_truth_tables() > 0)
+			fuse_truth_tables(m_netlist_params->m_fuse_truth_tables());
+
 		// create devices
 
 		log().debug("Creating devices ...\n");
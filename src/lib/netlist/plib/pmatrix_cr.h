@@ -264,6 +264,14 @@ namespace plib
 
 		~pGEmatrix_cr() = default;
 
+		template <typename M>
+		void build_from_fill_mat(const M &f, std::size_t max_fill = base_type::FILL_INFINITY - 1,
+			std::size_t band_width = base_type::FILL_INFINITY) noexcept(false)
+		{
+			base_type::build_from_fill_mat(f, max_fill, band_width);
+			build_gaussian_elimination_schedule();
+		}
+
 		template <typename M>
 		std::pair<std::size_t, std::size_t> gaussian_extend_fill_mat(M &fill) noexcept
 		{
@@ -302,6 +310,36 @@ namespace plib
 		{
 			const std::size_t iN = base_type::size();
 
+			if (!m_ge_schedule.empty())
+			{
+				// Use the precomputed target positions. The inner loop is
+				// a plain indexed axpy without any column searching which
+				// the compiler is able to unroll and vectorize.
+				const index_type *s = m_ge_schedule.data();
+				for (std::size_t i = 0; i < iN - 1; i++)
+				{
+					std::size_t nzbdp = 0;
+					std::size_t pi = base_type::diagonal[i];
+					const auto f = reciprocal(base_type::A[pi++]);
+					const std::size_t n = base_type::row_idx[i+1] - pi;
+					const typename base_type::value_type *Ai = &base_type::A[pi];
+					typename base_type::value_type *pA = &base_type::A[0];
+
+					const auto *nz = base_type::m_nzbd[i];
+					while (auto j = nz[nzbdp++]) // NOLINT(bugprone-infinite-loop)
+					{
+						const typename base_type::value_type f1 = - pA[*s++] * f;
+
+						for (std::size_t k = 0; k < n; k++)
+							pA[s[k]] += Ai[k] * f1;
+						s += n;
+
+						RHS[j] += f1 * RHS[i];
+					}
+				}
+				return;
+			}
+
 			for (std::size_t i = 0; i < iN - 1; i++)
 			{
 				std::size_t nzbdp = 0;
@@ -424,6 +462,57 @@ namespace plib
 		}
 
 	private:
+		/// \brief Precompute the element positions touched by gaussian_elimination
+		///
+		/// For each pivot row i and each row j below it with a non-zero in
+		/// column i the schedule holds the position of A(j,i) followed by
+		/// the position in row j for every element of row i right of the
+		/// diagonal. If the matrix lacks fill-in for any of these elements,
+		/// the schedule is left empty and elimination falls back to the
+		/// searching row update.
+		///
+		void build_gaussian_elimination_schedule()
+		{
+			const std::size_t iN = base_type::size();
+			const auto &col_idx = base_type::col_idx;
+
+			m_ge_schedule.clear();
+			for (std::size_t i = 0; i + 1 < iN; i++)
+			{
+				std::size_t nzbdp = 0;
+				const std::size_t pi = base_type::diagonal[i] + 1;
+				const std::size_t piie = base_type::row_idx[i+1];
+
+				const auto *nz = base_type::m_nzbd[i];
+				while (auto j = nz[nzbdp++]) // NOLINT(bugprone-infinite-loop)
+				{
+					std::size_t pj = base_type::row_idx[j];
+					const std::size_t pje = base_type::row_idx[j+1];
+
+					while (pj < pje && col_idx[pj] < i)
+						pj++;
+					if (pj >= pje || col_idx[pj] != i)
+					{
+						m_ge_schedule.clear();
+						return;
+					}
+					m_ge_schedule.push_back(narrow_cast<index_type>(pj++));
+
+					for (std::size_t pii = pi; pii < piie; pii++)
+					{
+						while (pj < pje && col_idx[pj] < col_idx[pii])
+							pj++;
+						if (pj >= pje || col_idx[pj] != col_idx[pii])
+						{
+							m_ge_schedule.clear();
+							return;
+						}
+						m_ge_schedule.push_back(narrow_cast<index_type>(pj++));
+					}
+				}
+			}
+		}
+
 		template <typename M>
 		void build_parallel_gaussian_execution_scheme(const M &fill) noexcept
 		{
@@ -481,6 +570,7 @@ namespace plib
 			//  printf("%d %d\n", (int) k, (int) m_ge_par[k].size());
 		}
 		std::vector<std::vector<std::size_t>> m_ge_par; // parallel execution support for Gauss
+		std::vector<index_type> m_ge_schedule;          // precomputed positions for gaussian_elimination
 	};
 
 	template<typename B>
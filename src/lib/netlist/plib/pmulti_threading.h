@@ -13,9 +13,12 @@
 #include <algorithm>
 #include <atomic>
 #include <condition_variable>
+#include <cstddef>
 #include <mutex>
+#include <thread>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace plib {
 
@@ -83,6 +86,121 @@ namespace plib {
 		long m_count;
 	};
 
+	/// \brief Fixed pool of threads for short fork/join loops
+	///
+	/// The calling thread takes part in each loop. Loops are expected to be
+	/// short and frequent, so idle workers spin for a while before they
+	/// block on the condition variable.
+	///
+	class pfor_pool
+	{
+	public:
+		/// \brief Create a pool running loops on `threads` threads in total
+		///
+		/// `threads` includes the calling thread, so a value of 1 or less
+		/// creates no workers and loops are run serially.
+		explicit pfor_pool(std::size_t threads)
+		{
+			for (std::size_t i = 1; i < threads; i++)
+				m_threads.emplace_back([this] () { worker(); });
+		}
+
+		pfor_pool(const pfor_pool &) = delete;
+		pfor_pool &operator=(const pfor_pool &) = delete;
+		pfor_pool(pfor_pool &&) = delete;
+		pfor_pool &operator=(pfor_pool &&) = delete;
+
+		~pfor_pool()
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_stop = true;
+				m_generation.fetch_add(1, std::memory_order_release);
+			}
+			m_cv.notify_all();
+			for (auto &t : m_threads)
+				t.join();
+		}
+
+		std::size_t size() const noexcept { return m_threads.size() + 1; }
+
+		/// \brief Call `what(i)` for i in [0, count) and wait for completion
+		///
+		/// Indices are handed out dynamically, so `what` must not depend on
+		/// which thread runs it or in which order.
+		template <typename T>
+		void for_each(std::size_t count, const T &what)
+		{
+			if (m_threads.empty() || count < 2)
+			{
+				for (std::size_t i = 0; i < count; i++)
+					what(i);
+				return;
+			}
+
+			m_func = [] (const void *ctx, std::size_t i) { (*static_cast<const T *>(ctx))(i); };
+			m_ctx = &what;
+			m_count = count;
+			m_next.store(0, std::memory_order_relaxed);
+			m_busy.store(m_threads.size(), std::memory_order_relaxed);
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_generation.fetch_add(1, std::memory_order_release);
+			}
+			m_cv.notify_all();
+
+			run();
+			while (m_busy.load(std::memory_order_acquire) != 0)
+				std::this_thread::yield();
+		}
+
+	private:
+		static constexpr unsigned SPIN_COUNT = 1U << 14;
+
+		void run()
+		{
+			for (std::size_t i = m_next.fetch_add(1, std::memory_order_relaxed); i < m_count; i = m_next.fetch_add(1, std::memory_order_relaxed))
+				m_func(m_ctx, i);
+		}
+
+		void worker()
+		{
+			unsigned seen = 0;
+			while (true)
+			{
+				unsigned spins = 0;
+				unsigned gen;
+				while ((gen = m_generation.load(std::memory_order_acquire)) == seen)
+				{
+					if (++spins < SPIN_COUNT)
+					{
+						std::this_thread::yield();
+					}
+					else
+					{
+						std::unique_lock<std::mutex> lock(m_mutex);
+						m_cv.wait(lock, [this, seen] () { return m_generation.load(std::memory_order_acquire) != seen; });
+					}
+				}
+				seen = gen;
+				if (m_stop)
+					return;
+				run();
+				m_busy.fetch_sub(1, std::memory_order_release);
+			}
+		}
+
+		std::vector<std::thread>           m_threads;
+		std::mutex                         m_mutex;
+		std::condition_variable            m_cv;
+		std::atomic<unsigned>              m_generation{0};
+		std::atomic<std::size_t>           m_next{0};
+		std::atomic<std::size_t>           m_busy{0};
+		void (*m_func)(const void *, std::size_t) = nullptr;
+		const void *                       m_ctx = nullptr;
+		std::size_t                        m_count = 0;
+		bool                               m_stop = false;
+	};
 
 } // namespace plib
 
@@ -14,7 +14,9 @@
 #include "ptypes.h"
 
 #include <algorithm>
+#include <array>
 #include <mutex>
+#include <cstdint>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -352,6 +354,349 @@ namespace plib {
 		pperfcount_t<true> m_prof_remove; // NOLINT
 	};
 
+	// ----------------------------------------------------------------------------------------
+	// timed queue using a bucketed time wheel
+	// ----------------------------------------------------------------------------------------
+
+	///
+	/// \brief Timed queue using a bucketed time wheel
+	///
+	/// Entries due within the current bucket (2^SHIFT time units wide) are
+	/// kept in a small sorted array, ordered just as in timed_queue_linear.
+	/// Entries due within the next BUCKETS buckets are kept unsorted in the
+	/// bucket covering their time, and anything further out is kept in a
+	/// single overflow list. Once the sorted array runs dry, the next
+	/// non-empty bucket is moved into it and sorted in one go, so all
+	/// events of a time step are queued together.
+	///
+	/// Queued entries are stored as separate time, object and link arrays,
+	/// kept dense so remove() only has to scan the object array.
+	///
+	/// Thus a push costs the insertion into a sorted array of only the
+	/// current bucket, instead of all pending events.
+	///
+	/// operator[] returns entries by value: the bucketed entries first in
+	/// no particular order, followed by the sorted array with top() last.
+	///
+	/// \tparam A Arena type
+	/// \tparam T Queue entry type, e.g. queue_entry_t
+	/// \tparam SHIFT log2 of the bucket width in time units
+	/// \tparam BUCKETS Number of buckets, must be a power of two
+	///
+	template <class A, class T, unsigned SHIFT, std::size_t BUCKETS>
+	class timed_queue_wheel
+	{
+	public:
+		using element_type = typename T::element_type;
+		using time_type = std::decay_t<decltype(std::declval<T>().exec_time())>;
+		using raw_type = typename time_type::internal_type;
+
+		explicit timed_queue_wheel(A &arena, const std::size_t list_size)
+		: m_run(arena, list_size + 1)
+		, m_time(arena, list_size)
+		, m_obj(arena, list_size)
+		, m_next(arena, list_size)
+		, m_prev(arena, list_size)
+		, m_list(arena, list_size)
+		{
+			clear();
+		}
+		~timed_queue_wheel() = default;
+
+		PCOPYASSIGNMOVE(timed_queue_wheel, delete)
+
+		constexpr std::size_t capacity() const noexcept { return m_run.size() - 1; }
+		constexpr bool empty() const noexcept { return (m_run_end == &m_run[1]); }
+
+		template <bool KEEPSTAT, typename... Args>
+		void emplace(Args&&... args) noexcept
+		{
+			push<KEEPSTAT>(T(std::forward<Args>(args)...));
+		}
+
+		template <bool KEEPSTAT>
+		void push(T &&e) noexcept;
+
+		void pop() noexcept
+		{
+			if (--m_run_end == &m_run[1])
+				advance();
+		}
+
+		const T &top() const noexcept { return *(m_run_end-1); }
+
+		bool exists(const element_type &elem) const noexcept;
+
+		template <bool KEEPSTAT>
+		void remove(const T &elem) noexcept { remove<KEEPSTAT>(elem.object()); }
+
+		template <bool KEEPSTAT>
+		void remove(const element_type &elem) noexcept;
+
+		void clear() noexcept
+		{
+			// same sentinel as timed_queue_linear
+			m_run[0] = T::never();
+			m_run_end = &m_run[1];
+			m_count = 0;
+			m_wheel_count = 0;
+			m_far_count = 0;
+			m_far_min = time_type::never().as_raw();
+			m_base = 0;
+			std::fill(m_head.begin(), m_head.end(), npos);
+		}
+
+		// save state support & mame disassembler
+
+		std::size_t size() const noexcept { return m_count + narrow_cast<std::size_t>(m_run_end - &m_run[1]); }
+		T operator[](std::size_t index) const noexcept
+		{
+			if (index < m_count)
+				return T(time_type::from_raw(m_time[index]), m_obj[index]);
+			return m_run[1 + index - m_count];
+		}
+
+	private:
+		using index_type = std::uint32_t;
+
+		static_assert(BUCKETS > 0 && (BUCKETS & (BUCKETS - 1)) == 0, "BUCKETS must be a power of two");
+
+		static constexpr index_type npos = ~index_type(0);
+		static constexpr index_type far_list = index_type(BUCKETS);
+		static constexpr raw_type bucket_width = raw_type(1) << SHIFT;
+		static constexpr raw_type wheel_width = bucket_width * raw_type(BUCKETS);
+
+		static constexpr index_type bucket(raw_type t) noexcept { return index_type(static_cast<std::size_t>(t >> SHIFT) & (BUCKETS - 1)); }
+		static constexpr raw_type align(raw_type t) noexcept { return t & ~(bucket_width - 1); }
+
+		template <bool KEEPSTAT>
+		void insert_sorted(T &&e) noexcept;
+		void link(index_type s, index_type list) noexcept;
+		void unlink(index_type s) noexcept;
+		void free_slot(index_type s) noexcept;
+		void migrate_far() noexcept;
+		void advance() noexcept;
+
+		PALIGNAS(PALIGN_CACHELINE)
+		T *                      m_run_end;
+		std::size_t              m_count;       // bucketed entries
+		std::size_t              m_wheel_count; // ... of those in the wheel
+		std::size_t              m_far_count;   // ... of those in the overflow list
+		raw_type                 m_far_min;     // may be stale, but never too large
+		raw_type                 m_base;        // start of bucket held in m_run
+		plib::arena_vector<A, T, PALIGN_CACHELINE> m_run;
+		plib::arena_vector<A, raw_type, PALIGN_CACHELINE> m_time;
+		plib::arena_vector<A, element_type, PALIGN_CACHELINE> m_obj;
+		plib::arena_vector<A, index_type> m_next;
+		plib::arena_vector<A, index_type> m_prev;
+		plib::arena_vector<A, index_type> m_list;
+		std::array<index_type, BUCKETS + 1> m_head;
+
+	public:
+		// profiling
+		pperfcount_t<true> m_prof_sort_move; // NOLINT
+		pperfcount_t<true> m_prof_call; // NOLINT
+		pperfcount_t<true> m_prof_remove; // NOLINT
+	};
+
+	template <class A, class T, unsigned SHIFT, std::size_t BUCKETS>
+	template <bool KEEPSTAT>
+	inline void timed_queue_wheel<A, T, SHIFT, BUCKETS>::push(T &&e) noexcept
+	{
+		const raw_type t(e.exec_time().as_raw());
+		if (empty())
+		{
+			m_base = align(t);
+			insert_sorted<KEEPSTAT>(std::move(e));
+		}
+		else if (t < m_base || t - m_base < bucket_width)
+		{
+			insert_sorted<KEEPSTAT>(std::move(e));
+		}
+		else
+		{
+			const auto s(static_cast<index_type>(m_count++));
+			m_time[s] = t;
+			m_obj[s] = e.object();
+			if (t - m_base < wheel_width)
+			{
+				link(s, bucket(t));
+				++m_wheel_count;
+			}
+			else
+			{
+				link(s, far_list);
+				++m_far_count;
+				m_far_min = std::min(m_far_min, t);
+			}
+		}
+		if constexpr (KEEPSTAT)
+			m_prof_call.inc();
+	}
+
+	template <class A, class T, unsigned SHIFT, std::size_t BUCKETS>
+	template <bool KEEPSTAT>
+	inline void timed_queue_wheel<A, T, SHIFT, BUCKETS>::insert_sorted(T &&e) noexcept
+	{
+		T * i(m_run_end++);
+		*i = std::move(e);
+		for (; *(i-1) < *i; --i)
+		{
+			std::swap(*(i-1), *(i));
+			if constexpr (KEEPSTAT)
+				m_prof_sort_move.inc();
+		}
+	}
+
+	template <class A, class T, unsigned SHIFT, std::size_t BUCKETS>
+	template <bool KEEPSTAT>
+	inline void timed_queue_wheel<A, T, SHIFT, BUCKETS>::remove(const element_type &elem) noexcept
+	{
+		if constexpr (KEEPSTAT)
+			m_prof_remove.inc();
+		for (T * i = m_run_end - 1; i > &m_run[0]; --i)
+		{
+			// == operator ignores time!
+			if (*i == elem)
+			{
+				std::copy(i+1, m_run_end--, i);
+				if (empty())
+					advance();
+				return;
+			}
+		}
+		for (std::size_t i = 0; i < m_count; i++)
+		{
+			if (m_obj[i] == elem)
+			{
+				const auto s(static_cast<index_type>(i));
+				if (m_list[s] == far_list)
+					--m_far_count;
+				else
+					--m_wheel_count;
+				unlink(s);
+				free_slot(s);
+				return;
+			}
+		}
+	}
+
+	template <class A, class T, unsigned SHIFT, std::size_t BUCKETS>
+	inline bool timed_queue_wheel<A, T, SHIFT, BUCKETS>::exists(const element_type &elem) const noexcept
+	{
+		for (const T * i = &m_run[1]; i < m_run_end; ++i)
+			if (*i == elem)
+				return true;
+		for (std::size_t i = 0; i < m_count; i++)
+			if (m_obj[i] == elem)
+				return true;
+		return false;
+	}
+
+	template <class A, class T, unsigned SHIFT, std::size_t BUCKETS>
+	inline void timed_queue_wheel<A, T, SHIFT, BUCKETS>::link(index_type s, index_type list) noexcept
+	{
+		const index_type head(m_head[list]);
+		m_list[s] = list;
+		m_prev[s] = npos;
+		m_next[s] = head;
+		if (head != npos)
+			m_prev[head] = s;
+		m_head[list] = s;
+	}
+
+	template <class A, class T, unsigned SHIFT, std::size_t BUCKETS>
+	inline void timed_queue_wheel<A, T, SHIFT, BUCKETS>::unlink(index_type s) noexcept
+	{
+		const index_type p(m_prev[s]);
+		const index_type n(m_next[s]);
+		if (p != npos)
+			m_next[p] = n;
+		else
+			m_head[m_list[s]] = n;
+		if (n != npos)
+			m_prev[n] = p;
+	}
+
+	template <class A, class T, unsigned SHIFT, std::size_t BUCKETS>
+	inline void timed_queue_wheel<A, T, SHIFT, BUCKETS>::free_slot(index_type s) noexcept
+	{
+		// keep the arrays dense by moving the last entry into the hole
+		const auto last(static_cast<index_type>(--m_count));
+		if (s == last)
+			return;
+		m_time[s] = m_time[last];
+		m_obj[s] = m_obj[last];
+		m_list[s] = m_list[last];
+		m_prev[s] = m_prev[last];
+		m_next[s] = m_next[last];
+		if (m_prev[s] != npos)
+			m_next[m_prev[s]] = s;
+		else
+			m_head[m_list[s]] = s;
+		if (m_next[s] != npos)
+			m_prev[m_next[s]] = s;
+	}
+
+	template <class A, class T, unsigned SHIFT, std::size_t BUCKETS>
+	inline void timed_queue_wheel<A, T, SHIFT, BUCKETS>::migrate_far() noexcept
+	{
+		// move overflow entries the wheel has caught up with into their buckets
+		m_far_min = time_type::never().as_raw();
+		for (index_type s = m_head[far_list]; s != npos; )
+		{
+			const index_type n(m_next[s]);
+			const raw_type t(m_time[s]);
+			if (t - m_base < wheel_width)
+			{
+				unlink(s);
+				link(s, bucket(t));
+				--m_far_count;
+				++m_wheel_count;
+			}
+			else
+				m_far_min = std::min(m_far_min, t);
+			s = n;
+		}
+	}
+
+	template <class A, class T, unsigned SHIFT, std::size_t BUCKETS>
+	inline void timed_queue_wheel<A, T, SHIFT, BUCKETS>::advance() noexcept
+	{
+		// called with the sorted array empty: find the next non-empty bucket
+		index_type b;
+		while (true)
+		{
+			if (m_far_count != 0 && (m_wheel_count == 0 || m_far_min - m_base < bucket_width))
+			{
+				if (m_wheel_count == 0)
+					m_base = align(m_far_min);
+				migrate_far();
+			}
+			if (m_wheel_count == 0)
+			{
+				if (m_far_count == 0)
+					return;
+				continue;
+			}
+			b = bucket(m_base);
+			if (m_head[b] != npos)
+				break;
+			m_base += bucket_width;
+		}
+
+		// move the whole bucket across and sort it once
+		while (m_head[b] != npos)
+		{
+			const index_type s(m_head[b]);
+			*m_run_end++ = T(time_type::from_raw(m_time[s]), m_obj[s]);
+			unlink(s);
+			free_slot(s);
+			--m_wheel_count;
+		}
+		std::sort(&m_run[1], m_run_end, [](const T &lhs, const T &rhs) noexcept { return rhs < lhs; });
+	}
+
 } // namespace plib
 
 #endif // PTIMED_QUEUE_H_
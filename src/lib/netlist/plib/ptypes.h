@@ -64,6 +64,9 @@ namespace plib
 	template <typename A, typename T>
 	class timed_queue_heap;
 
+	template <typename A, typename T, unsigned SHIFT = 6, std::size_t BUCKETS = 256>
+	class timed_queue_wheel;
+
 	namespace detail
 	{
 		class token_store_t;
@@ -88,7 +88,7 @@ public:
 		opt_grp4(*this,     "Options for run command",      "These options are only used by the run command."),
 		opt_ttr (*this,     "t", "time_to_run", 1,          "time to run the emulation (seconds)"),
 		opt_boost_lib(*this,  "",  "boost-lib", "builtin",   "generic: will use generic solvers.\nbuiltin: Use optimized solvers compiled in.\nsome_lib.so: Use library with precompiled solvers."),
-		opt_stats(*this,    "s", "statistics",              "gather runtime statistics"),
+		opt_stats(*this,    "s", "statistics",              "gather runtime statistics. Together with -v this reports the time spent per solve for each matrix solver."),
 		opt_logs(*this,     "l", "log" ,                    "define terminal to log. This option may be specified repeatedly."),
 		opt_inp(*this,      "i", "input",       "",         "input file to process (default is none)"),
 		opt_load_state(*this,"", "load-state",   "",        "load state from file and continue from there"),
@@ -756,6 +756,15 @@ namespace netlist::solver
 					/ static_cast<fptype>(this->m_stat_calculations),
 				static_cast<fptype>(this->m_iterative_total)
 					/ static_cast<fptype>(this->m_stat_calculations));
+			if (this->stats() != nullptr && this->stats()->m_stat_call_count() != 0)
+			{
+				const auto solve_time = this->stats()->m_stat_total_time.as_seconds<fptype>();
+				const auto solve_calls = static_cast<fptype>(this->stats()->m_stat_call_count());
+				log().verbose(
+					"       {1:10.3} us per solve ({2:10.0} solves/s real time)",
+					solve_time * nlconst::magic(1e6) / solve_calls,
+					solve_time > nlconst::zero() ? solve_calls / solve_time : nlconst::zero());
+			}
 		}
 	}
 
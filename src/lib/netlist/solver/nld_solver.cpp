@@ -26,6 +26,7 @@
 #include "plib/ptimed_queue.h"
 
 #include <algorithm>
+#include <thread>
 #include <type_traits>
 
 namespace netlist::devices
@@ -65,6 +66,7 @@ namespace netlist::devices
 
 	void NETLIB_NAME(solver)::stop()
 	{
+		m_pool.reset();
 		for (auto &s : m_mat_solvers)
 			s->log_stats();
 	}
@@ -75,12 +77,7 @@ namespace netlist::devices
 	NETLIB_HANDLER(solver, fb_step)
 	{
 		const netlist_time_ext now(exec().time());
-		const std::size_t      nthreads = m_params.m_parallel() < 2
-											  ? 1
-											  : std::min(
-											 static_cast<std::size_t>(
-												 m_params.m_parallel()),
-											 plib::omp::get_max_threads());
+		const std::size_t      nthreads = m_pool ? m_pool->size() : 1;
 		const netlist_time_ext sched(
 			now
 			+ (nthreads <= 1 ? netlist_time_ext::zero()
@@ -104,47 +101,39 @@ namespace netlist::devices
 			m_queue.pop();
 		}
 
-		// FIXME: Disabled for now since parallel processing will decrease
-		// performance
-		//        for tested applications. More testing required here
-		if (true || nthreads < 2)
+		// Each matrix solver owns a disjoint group of nets (see
+		// net_splitter), so the solves themselves are independent. Only
+		// solve() runs on the pool; results are pushed back and inputs
+		// updated afterwards in queue order, so the event sequence doesn't
+		// depend on how the solves were distributed over the threads.
+		if (KEEP_STATS)
 		{
-			if (!KEEP_STATS)
-			{
-				for (std::size_t i = 0; i < p; i++)
-					nt[i] = tmp[i]->solve(now, "no-parallel");
-			}
-			else
-			{
-				stats()->m_stat_total_time.stop();
-				for (std::size_t i = 0; i < p; i++)
-				{
-					tmp[i]->stats()->m_stat_call_count.inc();
-					auto g(tmp[i]->stats()->m_stat_total_time.guard());
-					nt[i] = tmp[i]->solve(now, "no-parallel");
-				}
-				stats()->m_stat_total_time.start();
-			}
-
+			stats()->m_stat_total_time.stop();
 			for (std::size_t i = 0; i < p; i++)
 			{
-				if (nt[i] != netlist_time::zero())
-					m_queue.push<false>({now + nt[i], tmp[i]});
-				tmp[i]->update_inputs();
+				tmp[i]->stats()->m_stat_call_count.inc();
+				auto g(tmp[i]->stats()->m_stat_total_time.guard());
+				nt[i] = tmp[i]->solve(now, "no-parallel");
 			}
+			stats()->m_stat_total_time.start();
 		}
-		else
+		else if (nthreads < 2 || p < 2)
 		{
-			plib::omp::set_num_threads(nthreads);
-			plib::omp::for_static(static_cast<std::size_t>(0), p,
-								  [&tmp, &nt, now](std::size_t i)
-								  { nt[i] = tmp[i]->solve(now, "parallel"); });
 			for (std::size_t i = 0; i < p; i++)
-			{
-				if (nt[i] != netlist_time::zero())
-					m_queue.push<false>({now + nt[i], tmp[i]});
-				tmp[i]->update_inputs();
-			}
+				nt[i] = tmp[i]->solve(now, "no-parallel");
+		}
+		else
+		{
+			m_pool->for_each(p,
+				[&tmp, &nt, now](std::size_t i)
+				{ nt[i] = tmp[i]->solve(now, "parallel"); });
+		}
+
+		for (std::size_t i = 0; i < p; i++)
+		{
+			if (nt[i] != netlist_time::zero())
+				m_queue.push<false>({now + nt[i], tmp[i]});
+			tmp[i]->update_inputs();
 		}
 		if (!m_queue.empty())
 			m_Q_step.net().toggle_and_push_to_queue(
@@ -573,6 +562,19 @@ namespace netlist::devices
 			m_mat_params.push_back(std::move(params));
 			m_mat_solvers.push_back(std::move(ms));
 		}
+
+		// PARALLEL > 1 solves independent matrices on a thread pool
+		const auto parallel = static_cast<std::size_t>(
+			std::max(m_params.m_parallel(), 0));
+		const std::size_t nthreads = std::min<std::size_t>(
+			{parallel, m_mat_solvers.size(),
+			 std::max<std::size_t>(std::thread::hardware_concurrency(), 1)});
+		if (nthreads > 1)
+		{
+			log().verbose("Solving {1} matrices on {2} threads",
+						  m_mat_solvers.size(), nthreads);
+			m_pool = std::make_unique<plib::pfor_pool>(nthreads);
+		}
 	}
 
 	solver::static_compile_container NETLIB_NAME(solver)::create_solver_code(
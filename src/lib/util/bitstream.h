@@ -103,12 +103,24 @@ inline uint32_t bitstream_in::peek(int numbits)
 	// fetch data if we need more
 	if (numbits > m_bits)
 	{
-		while (m_bits <= 24)
+		if ((m_dlength > m_doffset) && ((m_dlength - m_doffset) >= 4))
 		{
-			if (m_doffset < m_dlength)
-				m_buffer |= m_read[m_doffset] << (24 - m_bits);
-			m_doffset++;
-			m_bits += 8;
+			// at most four bytes are needed, so skip the bounds checks
+			while (m_bits <= 24)
+			{
+				m_buffer |= m_read[m_doffset++] << (24 - m_bits);
+				m_bits += 8;
+			}
+		}
+		else
+		{
+			while (m_bits <= 24)
+			{
+				if (m_doffset < m_dlength)
+					m_buffer |= m_read[m_doffset] << (24 - m_bits);
+				m_doffset++;
+				m_bits += 8;
+			}
 		}
 	}
 
@@ -22,6 +22,7 @@
 #include "osdfile.h"
 #include "strformat.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstdlib>
 
@@ -478,6 +479,106 @@ bool cdrom_file::read_data(uint32_t lbasector, void *buffer, uint32_t datatype,
 		chdsector = logical_to_chd_lba(lbasector, tracknum);
 	}
 
+	return read_converted_sector(buffer, lbasector, chdsector, tracknum, datatype, phys);
+}
+
+
+/*-------------------------------------------------
+    read_sectors - read a run of consecutive
+    sectors from a CD-ROM
+-------------------------------------------------*/
+
+/**
+ * @fn  bool read_sectors(uint32_t lbasector, uint32_t count, void *buffer, uint32_t datatype, bool phys)
+ *
+ * @brief   Cdrom read a run of sectors.
+ *
+ * @param   lbasector       The first lbasector.
+ * @param   count           The number of sectors.
+ * @param [in,out]  buffer  The buffer, which receives the sectors back to back.
+ * @param   datatype        The datatype.
+ * @param   phys            true to physical.
+ *
+ * @return  false if any of the sectors couldn't be read.
+ */
+
+bool cdrom_file::read_sectors(uint32_t lbasector, uint32_t count, void *buffer, uint32_t datatype, bool phys)
+{
+	auto *dest = reinterpret_cast<uint8_t *>(buffer);
+	bool result = true;
+
+	while (count)
+	{
+		// the track lookup is only needed once per track
+		uint32_t tracknum = 0;
+		uint32_t chdsector = phys ? physical_to_chd_lba(lbasector, tracknum) : logical_to_chd_lba(lbasector, tracknum);
+		uint32_t const trackend = phys ? cdtoc.tracks[tracknum + 1].physframeofs : cdtoc.tracks[tracknum + 1].logframeofs;
+		uint32_t const run = (lbasector < trackend) ? std::min(count, trackend - lbasector) : 1;
+		track_info const &track = cdtoc.tracks[tracknum];
+		uint32_t const size = converted_sector_size(tracknum, datatype);
+
+		if (!chd && ((datatype == track.trktype) || (datatype == CD_TRACK_RAW_DONTCARE)) && !track.subsize && !cdtrack_info.track[tracknum].swap && (phys || track.pgdatasize || (lbasector >= track.logframeofs)))
+		{
+			// unconverted sectors are contiguous in a bare image file
+			if (track.pgdatasize)
+				chdsector += track.pregap;
+			size_t actual;
+			std::error_condition err = fhandle[tracknum]->seek(cdtrack_info.track[tracknum].offset + uint64_t(chdsector) * track.datasize, SEEK_SET);
+			if (!err)
+				err = fhandle[tracknum]->read(dest, size_t(run) * size, actual);
+			if (err)
+				result = false;
+		}
+		else
+		{
+			for (uint32_t i = 0; run > i; ++i)
+			{
+				if (!read_converted_sector(dest + (i * size), lbasector + i, chdsector + i, tracknum, datatype, phys))
+					result = false;
+			}
+		}
+
+		lbasector += run;
+		dest += run * size;
+		count -= run;
+	}
+
+	return result;
+}
+
+
+/*-------------------------------------------------
+    converted_sector_size - size of a sector of
+    a track when read as the given type
+-------------------------------------------------*/
+
+uint32_t cdrom_file::converted_sector_size(uint32_t tracknum, uint32_t datatype) const
+{
+	if ((datatype == cdtoc.tracks[tracknum].trktype) || (datatype == CD_TRACK_RAW_DONTCARE))
+		return cdtoc.tracks[tracknum].datasize;
+
+	// the conversions read_converted_sector supports
+	switch (datatype)
+	{
+	case CD_TRACK_MODE1:
+		return 2048;
+	case CD_TRACK_MODE1_RAW:
+		return 2352;
+	case CD_TRACK_MODE2:
+		return 2336;
+	default:
+		return cdtoc.tracks[tracknum].datasize;
+	}
+}
+
+
+/*-------------------------------------------------
+    read_converted_sector - copy out a sector
+    converted to the requested type
+-------------------------------------------------*/
+
+bool cdrom_file::read_converted_sector(void *buffer, uint32_t lbasector, uint32_t chdsector, uint32_t tracknum, uint32_t datatype, bool phys)
+{
 	// copy out the requested sector
 	uint32_t tracktype = cdtoc.tracks[tracknum].trktype;
 
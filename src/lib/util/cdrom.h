@@ -122,6 +122,7 @@ public:
 
 	/* core read access */
 	bool read_data(uint32_t lbasector, void *buffer, uint32_t datatype, bool phys=false);
+	bool read_sectors(uint32_t lbasector, uint32_t count, void *buffer, uint32_t datatype, bool phys=false);
 	bool read_subcode(uint32_t lbasector, void *buffer, bool phys=false);
 
 	/* handy utilities */
@@ -251,6 +252,8 @@ private:
 	static uint8_t ecc_source_byte(const uint8_t *sector, uint32_t offset);
 	static void ecc_compute_bytes(const uint8_t *sector, const uint16_t *row, int rowlen, uint8_t &val1, uint8_t &val2);
 	std::error_condition read_partial_sector(void *dest, uint32_t lbasector, uint32_t chdsector, uint32_t tracknum, uint32_t startoffs, uint32_t length, bool phys);
+	bool read_converted_sector(void *buffer, uint32_t lbasector, uint32_t chdsector, uint32_t tracknum, uint32_t datatype, bool phys);
+	uint32_t converted_sector_size(uint32_t tracknum, uint32_t datatype) const;
 
 	static std::string get_file_path(std::string &path);
 	static uint64_t get_file_size(std::string_view filename);
@@ -21,6 +21,7 @@
 
 #include <zlib.h>
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <cstdlib>
@@ -194,6 +195,7 @@ inline void chd_file::file_read(uint64_t offset, void *dest, uint32_t length) co
 		throw std::error_condition(error::NOT_OPEN);
 
 	// seek and read
+	std::lock_guard<std::mutex> lock(m_file_mutex);
 	m_file->seek(offset, SEEK_SET);
 	size_t count;
 	std::error_condition err = m_file->read(dest, length, count);
@@ -216,6 +218,7 @@ inline void chd_file::file_write(uint64_t offset, const void *source, uint32_t l
 		throw std::error_condition(error::NOT_OPEN);
 
 	// seek and write
+	std::lock_guard<std::mutex> lock(m_file_mutex);
 	m_file->seek(offset, SEEK_SET);
 	size_t count;
 	std::error_condition err = m_file->write(source, length, count);
@@ -241,6 +244,7 @@ inline uint64_t chd_file::file_append(const void *source, uint32_t length, uint3
 		throw std::error_condition(error::NOT_OPEN);
 
 	// seek to the end and align if necessary
+	std::lock_guard<std::mutex> lock(m_file_mutex);
 	err = m_file->seek(0, SEEK_END);
 	if (err)
 		throw err;
@@ -312,6 +316,7 @@ inline uint8_t chd_file::bits_for_value(uint64_t value)
  */
 
 chd_file::chd_file()
+	: m_readahead_queue(nullptr)
 {
 	// reset state
 	close();
@@ -329,6 +334,8 @@ chd_file::~chd_file()
 {
 	// close any open files
 	close();
+	if (m_readahead_queue)
+		osd_work_queue_free(m_readahead_queue);
 }
 
 /**
@@ -830,6 +837,15 @@ std::error_condition chd_file::open(util::random_read_write::ptr &&file, bool wr
 
 void chd_file::close()
 {
+	// make sure read-ahead isn't touching anything we're about to tear down
+	stop_readahead();
+	m_hunk_cache.reset();
+	m_readahead = 0;
+	m_lasthunk = ~uint32_t(0);
+	m_readahead_next = 0;
+	m_readahead_end = 0;
+	m_readahead_pending = false;
+
 	// reset file characteristics
 	m_file.reset();
 	m_allow_reads = false;
@@ -873,7 +889,60 @@ void chd_file::close()
  * @fn  std::error_condition chd_file::read_hunk(uint32_t hunknum, void *buffer)
  *
  * @brief   -------------------------------------------------
- *            read - read a single hunk from the CHD file
+ *            read - read a single hunk from the CHD file,
+ *            going through the hunk cache if one is set up
+ *          -------------------------------------------------.
+ *
+ * @param   hunknum         The hunknum.
+ * @param [in,out]  buffer  If non-null, the buffer.
+ *
+ * @return  The hunk.
+ */
+
+std::error_condition chd_file::read_hunk(uint32_t hunknum, void *buffer)
+{
+	// without a cache, decompress straight into the caller's buffer
+	if (!m_hunk_cache || !buffer)
+		return read_hunk_internal(hunknum, buffer);
+
+	std::lock_guard<std::mutex> lock(m_hunk_cache_mutex);
+	std::error_condition err;
+	auto const found = m_hunk_cache->find(hunknum);
+	if (found != m_hunk_cache->end())
+	{
+		memcpy(buffer, &found->second[0], m_hunkbytes);
+	}
+	else
+	{
+		err = read_hunk_internal(hunknum, buffer);
+		if (err)
+			return err;
+		auto const *const src = reinterpret_cast<const uint8_t *>(buffer);
+		(*m_hunk_cache)[hunknum].assign(src, src + m_hunkbytes);
+	}
+
+	// a sequential reader gets the next few hunks decompressed in the background
+	if (m_readahead && (hunknum == m_lasthunk + 1))
+	{
+		if ((m_readahead_next <= hunknum) || (m_readahead_next > m_readahead_end))
+			m_readahead_next = hunknum + 1;
+		m_readahead_end = std::min<uint32_t>(hunknum + 1 + m_readahead, m_hunkcount);
+		if (!m_readahead_pending && (m_readahead_next < m_readahead_end))
+		{
+			m_readahead_pending = true;
+			osd_work_item_queue(m_readahead_queue, readahead_static, this, WORK_ITEM_FLAG_AUTO_RELEASE);
+		}
+	}
+	m_lasthunk = hunknum;
+	return err;
+}
+
+/**
+ * @fn  std::error_condition chd_file::read_hunk_internal(uint32_t hunknum, void *buffer)
+ *
+ * @brief   -------------------------------------------------
+ *            read_hunk_internal - read and decompress a
+ *            single hunk from the CHD file
  *          -------------------------------------------------.
  *
  * @exception   CHDERR_NOT_OPEN             Thrown when a chderr not open error condition occurs.
@@ -892,7 +961,7 @@ void chd_file::close()
  * @return  The hunk.
  */
 
-std::error_condition chd_file::read_hunk(uint32_t hunknum, void *buffer)
+std::error_condition chd_file::read_hunk_internal(uint32_t hunknum, void *buffer)
 {
 	// wrap this for clean reporting
 	try
@@ -944,7 +1013,7 @@ std::error_condition chd_file::read_hunk(uint32_t hunknum, void *buffer)
 						return std::error_condition();
 
 					case V34_MAP_ENTRY_TYPE_SELF_HUNK:
-						return read_hunk(blockoffs, dest);
+						return read_hunk_internal(blockoffs, dest);
 
 					case V34_MAP_ENTRY_TYPE_PARENT_HUNK:
 						if (m_parent_missing)
@@ -997,7 +1066,7 @@ std::error_condition chd_file::read_hunk(uint32_t hunknum, void *buffer)
 						return std::error_condition();
 
 					case COMPRESSION_SELF:
-						return read_hunk(blockoffs, dest);
+						return read_hunk_internal(blockoffs, dest);
 
 					case COMPRESSION_PARENT:
 						if (m_parent_missing)
@@ -1037,6 +1106,33 @@ std::error_condition chd_file::read_hunk(uint32_t hunknum, void *buffer)
  */
 
 std::error_condition chd_file::write_hunk(uint32_t hunknum, const void *buffer)
+{
+	if (!m_hunk_cache)
+		return write_hunk_internal(hunknum, buffer);
+
+	// drop any stale copy and keep read-ahead out until the map is consistent again
+	std::lock_guard<std::mutex> lock(m_hunk_cache_mutex);
+	auto const found = m_hunk_cache->find(hunknum);
+	if (found != m_hunk_cache->end())
+		m_hunk_cache->erase(found);
+	return write_hunk_internal(hunknum, buffer);
+}
+
+/**
+ * @fn  std::error_condition chd_file::write_hunk_internal(uint32_t hunknum, const void *buffer)
+ *
+ * @brief   -------------------------------------------------
+ *            write_hunk_internal - write a single hunk to
+ *            the CHD file bypassing the hunk cache
+ *          -------------------------------------------------.
+ *
+ * @param   hunknum The hunknum.
+ * @param   buffer  The buffer.
+ *
+ * @return  A std::error_condition.
+ */
+
+std::error_condition chd_file::write_hunk_internal(uint32_t hunknum, const void *buffer)
 {
 	// wrap this for clean reporting
 	try
@@ -1141,6 +1237,124 @@ std::error_condition chd_file::write_units(uint64_t unitnum, const void *buffer,
 	return write_bytes(unitnum * uint64_t(m_unitbytes), buffer, count * m_unitbytes);
 }
 
+/**
+ * @fn  void chd_file::set_hunk_cache(uint32_t hunks, uint32_t readahead)
+ *
+ * @brief   -------------------------------------------------
+ *            set_hunk_cache - keep the given number of
+ *            decompressed hunks around, and decompress up
+ *            to readahead hunks ahead of sequential reads
+ *            on a worker thread; zero hunks disables the
+ *            cache (the configuration is reset on close)
+ *          -------------------------------------------------.
+ *
+ * @param   hunks       Number of hunks to cache.
+ * @param   readahead   Number of hunks to read ahead.
+ */
+
+void chd_file::set_hunk_cache(uint32_t hunks, uint32_t readahead)
+{
+	stop_readahead();
+
+	std::lock_guard<std::mutex> lock(m_hunk_cache_mutex);
+	if (hunks)
+		m_hunk_cache = std::make_unique<util::lru_cache_map<uint32_t, std::vector<uint8_t> > >(hunks);
+	else
+		m_hunk_cache.reset();
+
+	// don't let read-ahead evict more than half of what the reader is using
+	m_readahead = std::min(readahead, hunks / 2);
+	if (m_readahead && !m_readahead_queue)
+	{
+		m_readahead_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
+		if (!m_readahead_queue)
+			m_readahead = 0;
+	}
+	m_lasthunk = ~uint32_t(0);
+	m_readahead_next = 0;
+	m_readahead_end = 0;
+}
+
+/**
+ * @fn  void chd_file::stop_readahead()
+ *
+ * @brief   -------------------------------------------------
+ *            stop_readahead - cancel any outstanding
+ *            read-ahead and wait for it to finish
+ *          -------------------------------------------------.
+ */
+
+void chd_file::stop_readahead()
+{
+	if (!m_readahead_queue)
+		return;
+
+	{
+		std::lock_guard<std::mutex> lock(m_hunk_cache_mutex);
+		m_readahead_end = m_readahead_next;
+	}
+	osd_work_queue_wait(m_readahead_queue, 30 * osd_ticks_per_second());
+}
+
+/**
+ * @fn  void *chd_file::readahead_static(void *param, int threadid)
+ *
+ * @brief   -------------------------------------------------
+ *            readahead_static - work item callback for
+ *            read-ahead
+ *          -------------------------------------------------.
+ *
+ * @param [in,out]  param   The chd_file.
+ * @param   threadid        The threadid.
+ *
+ * @return  null.
+ */
+
+void *chd_file::readahead_static(void *param, int threadid)
+{
+	reinterpret_cast<chd_file *>(param)->readahead();
+	return nullptr;
+}
+
+/**
+ * @fn  void chd_file::readahead()
+ *
+ * @brief   -------------------------------------------------
+ *            readahead - decompress hunks in the current
+ *            read-ahead window into the hunk cache
+ *          -------------------------------------------------.
+ */
+
+void chd_file::readahead()
+{
+	std::vector<uint8_t> buffer(m_hunkbytes);
+	std::unique_lock<std::mutex> lock(m_hunk_cache_mutex);
+	try
+	{
+		while (m_readahead_next < m_readahead_end)
+		{
+			uint32_t const hunknum = m_readahead_next++;
+			if (m_hunk_cache->find(hunknum) != m_hunk_cache->end())
+				continue;
+
+			// on error just stop; the reader will get the error when it gets there
+			if (read_hunk_internal(hunknum, &buffer[0]))
+				break;
+			(*m_hunk_cache)[hunknum].swap(buffer);
+			buffer.resize(m_hunkbytes);
+
+			// give the reader a chance to get in between hunks
+			lock.unlock();
+			lock.lock();
+		}
+	}
+	catch (...)
+	{
+		// same as an error, leave it to the reader
+	}
+	m_readahead_pending = false;
+}
+
 /**
  * @fn  std::error_condition chd_file::read_bytes(uint64_t offset, void *buffer, uint32_t bytes)
  *
@@ -15,10 +15,13 @@
 #include "chdcodec.h"
 #include "hashing.h"
 #include "ioprocs.h"
+#include "lrucache.h"
 
 #include "osdcore.h"
 
 #include <atomic>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <system_error>
@@ -338,6 +341,9 @@ public:
 	std::error_condition read_bytes(uint64_t offset, void *buffer, uint32_t bytes);
 	std::error_condition write_bytes(uint64_t offset, const void *buffer, uint32_t bytes);
 
+	// hunk caching
+	void set_hunk_cache(uint32_t hunks, uint32_t readahead);
+
 	// metadata management
 	std::error_condition read_metadata(chd_metadata_tag searchtag, uint32_t searchindex, std::string &output);
 	std::error_condition read_metadata(chd_metadata_tag searchtag, uint32_t searchindex, std::vector<uint8_t> &output);
@@ -377,6 +383,11 @@ private:
 	uint8_t bits_for_value(uint64_t value);
 
 	// internal helpers
+	std::error_condition read_hunk_internal(uint32_t hunknum, void *buffer);
+	std::error_condition write_hunk_internal(uint32_t hunknum, const void *buffer);
+	void stop_readahead();
+	static void *readahead_static(void *param, int threadid);
+	void readahead();
 	uint32_t guess_unitbytes();
 	void parse_v3_header(uint8_t *rawheader, util::sha1_t &parentsha1);
 	void parse_v4_header(uint8_t *rawheader, util::sha1_t &parentsha1);
@@ -431,6 +442,17 @@ private:
 	// caching
 	std::vector<uint8_t>    m_cache;            // single-hunk cache for partial reads/writes
 	uint32_t                m_cachehunk;        // which hunk is in the cache?
+
+	// multi-hunk cache and read-ahead
+	std::unique_ptr<util::lru_cache_map<uint32_t, std::vector<uint8_t> > > m_hunk_cache; // recently decompressed hunks
+	std::mutex              m_hunk_cache_mutex; // serialises decompression against read-ahead
+	mutable std::mutex      m_file_mutex;       // serialises seek/read/write pairs on m_file
+	osd_work_queue *        m_readahead_queue;  // queue for read-ahead work
+	uint32_t                m_readahead;        // number of hunks to decompress ahead of a sequential reader
+	uint32_t                m_lasthunk;         // last hunk requested by the reader
+	uint32_t                m_readahead_next;   // next hunk for read-ahead to decompress
+	uint32_t                m_readahead_end;    // end of the current read-ahead window
+	bool                    m_readahead_pending;// is a read-ahead item queued or running?
 };
 
 
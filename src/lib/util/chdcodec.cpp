@@ -21,6 +21,12 @@
 
 #include <zlib.h>
 
+// Zstandard isn't bundled, so the codecs are only built when the build
+// supplies the library and defines USE_ZSTD
+#if defined(USE_ZSTD)
+#include <zstd.h>
+#endif
+
 #include <new>
 
 
@@ -165,6 +171,48 @@ private:
 };
 
 
+#if defined(USE_ZSTD)
+
+// ======================> chd_zstd_compressor
+
+// Zstandard compressor
+class chd_zstd_compressor : public chd_compressor
+{
+public:
+	// construction/destruction
+	chd_zstd_compressor(chd_file &chd, uint32_t hunkbytes, bool lossy);
+	~chd_zstd_compressor();
+
+	// core functionality
+	virtual uint32_t compress(const uint8_t *src, uint32_t srclen, uint8_t *dest) override;
+
+private:
+	// internal state
+	ZSTD_CCtx *             m_context;
+};
+
+
+// ======================> chd_zstd_decompressor
+
+// Zstandard decompressor
+class chd_zstd_decompressor : public chd_decompressor
+{
+public:
+	// construction/destruction
+	chd_zstd_decompressor(chd_file &chd, uint32_t hunkbytes, bool lossy);
+	~chd_zstd_decompressor();
+
+	// core functionality
+	virtual void decompress(const uint8_t *src, uint32_t complen, uint8_t *dest, uint32_t destlen) override;
+
+private:
+	// internal state
+	ZSTD_DCtx *             m_context;
+};
+
+#endif // defined(USE_ZSTD)
+
+
 // ======================> chd_huffman_compressor
 
 // Huffman compressor
@@ -497,11 +545,17 @@ const codec_entry f_codec_list[] =
 	{ CHD_CODEC_LZMA,       false,  "LZMA",                 &codec_entry::construct_compressor<chd_lzma_compressor>,     &codec_entry::construct_decompressor<chd_lzma_decompressor> },
 	{ CHD_CODEC_HUFFMAN,    false,  "Huffman",              &codec_entry::construct_compressor<chd_huffman_compressor>,  &codec_entry::construct_decompressor<chd_huffman_decompressor> },
 	{ CHD_CODEC_FLAC,       false,  "FLAC",                 &codec_entry::construct_compressor<chd_flac_compressor>,     &codec_entry::construct_decompressor<chd_flac_decompressor> },
+#if defined(USE_ZSTD)
+	{ CHD_CODEC_ZSTD,       false,  "Zstandard",            &codec_entry::construct_compressor<chd_zstd_compressor>,     &codec_entry::construct_decompressor<chd_zstd_decompressor> },
+#endif
 
 	// general codecs with CD frontend
 	{ CHD_CODEC_CD_ZLIB,    false,  "CD Deflate",           &codec_entry::construct_compressor<chd_cd_compressor<chd_zlib_compressor, chd_zlib_compressor> >,        &codec_entry::construct_decompressor<chd_cd_decompressor<chd_zlib_decompressor, chd_zlib_decompressor> > },
 	{ CHD_CODEC_CD_LZMA,    false,  "CD LZMA",              &codec_entry::construct_compressor<chd_cd_compressor<chd_lzma_compressor, chd_zlib_compressor> >,        &codec_entry::construct_decompressor<chd_cd_decompressor<chd_lzma_decompressor, chd_zlib_decompressor> > },
 	{ CHD_CODEC_CD_FLAC,    false,  "CD FLAC",              &codec_entry::construct_compressor<chd_cd_flac_compressor>,                                              &codec_entry::construct_decompressor<chd_cd_flac_decompressor> },
+#if defined(USE_ZSTD)
+	{ CHD_CODEC_CD_ZSTD,    false,  "CD Zstandard",         &codec_entry::construct_compressor<chd_cd_compressor<chd_zstd_compressor, chd_zstd_compressor> >,        &codec_entry::construct_decompressor<chd_cd_decompressor<chd_zstd_decompressor, chd_zstd_decompressor> > },
+#endif
 
 	// A/V codecs
 	{ CHD_CODEC_AVHUFF,     false,  "A/V Huffman",          &codec_entry::construct_compressor<chd_avhuff_compressor>,   &codec_entry::construct_decompressor<chd_avhuff_decompressor> },
@@ -1235,6 +1289,103 @@ void chd_lzma_decompressor::decompress(const uint8_t *src, uint32_t complen, uin
 
 
 
+#if defined(USE_ZSTD)
+
+//**************************************************************************
+//  ZSTANDARD COMPRESSOR
+//**************************************************************************
+
+//-------------------------------------------------
+//  chd_zstd_compressor - constructor
+//-------------------------------------------------
+
+chd_zstd_compressor::chd_zstd_compressor(chd_file &chd, uint32_t hunkbytes, bool lossy)
+	: chd_compressor(chd, hunkbytes, lossy)
+	, m_context(ZSTD_createCCtx())
+{
+	if (!m_context)
+		throw std::bad_alloc();
+
+	// the hunk size is known to the CHD, so don't waste bytes storing it in each frame
+	if (ZSTD_isError(ZSTD_CCtx_setParameter(m_context, ZSTD_c_compressionLevel, ZSTD_maxCLevel())) ||
+		ZSTD_isError(ZSTD_CCtx_setParameter(m_context, ZSTD_c_contentSizeFlag, 0)) ||
+		ZSTD_isError(ZSTD_CCtx_setParameter(m_context, ZSTD_c_checksumFlag, 0)))
+	{
+		ZSTD_freeCCtx(m_context);
+		throw std::error_condition(chd_file::error::CODEC_ERROR);
+	}
+}
+
+
+//-------------------------------------------------
+//  ~chd_zstd_compressor - destructor
+//-------------------------------------------------
+
+chd_zstd_compressor::~chd_zstd_compressor()
+{
+	ZSTD_freeCCtx(m_context);
+}
+
+
+//-------------------------------------------------
+//  compress - compress data using the Zstandard
+//  codec
+//-------------------------------------------------
+
+uint32_t chd_zstd_compressor::compress(const uint8_t *src, uint32_t srclen, uint8_t *dest)
+{
+	// limiting the output to the input size makes incompressible data fail early
+	size_t const result = ZSTD_compress2(m_context, dest, srclen, src, srclen);
+	if (ZSTD_isError(result) || result >= srclen)
+		throw std::error_condition(chd_file::error::COMPRESSION_ERROR);
+	return uint32_t(result);
+}
+
+
+
+//**************************************************************************
+//  ZSTANDARD DECOMPRESSOR
+//**************************************************************************
+
+//-------------------------------------------------
+//  chd_zstd_decompressor - constructor
+//-------------------------------------------------
+
+chd_zstd_decompressor::chd_zstd_decompressor(chd_file &chd, uint32_t hunkbytes, bool lossy)
+	: chd_decompressor(chd, hunkbytes, lossy)
+	, m_context(ZSTD_createDCtx())
+{
+	if (!m_context)
+		throw std::bad_alloc();
+}
+
+
+//-------------------------------------------------
+//  ~chd_zstd_decompressor - destructor
+//-------------------------------------------------
+
+chd_zstd_decompressor::~chd_zstd_decompressor()
+{
+	ZSTD_freeDCtx(m_context);
+}
+
+
+//-------------------------------------------------
+//  decompress - decompress data using the
+//  Zstandard codec
+//-------------------------------------------------
+
+void chd_zstd_decompressor::decompress(const uint8_t *src, uint32_t complen, uint8_t *dest, uint32_t destlen)
+{
+	size_t const result = ZSTD_decompressDCtx(m_context, dest, destlen, src, complen);
+	if (ZSTD_isError(result) || result != destlen)
+		throw std::error_condition(chd_file::error::DECOMPRESSION_ERROR);
+}
+
+#endif // defined(USE_ZSTD)
+
+
+
 //**************************************************************************
 //  HUFFMAN COMPRESSOR
 //**************************************************************************
@@ -1408,8 +1559,7 @@ void chd_flac_decompressor::decompress(const uint8_t *src, uint32_t complen, uin
 	if (!m_decoder.decode_interleaved(reinterpret_cast<int16_t *>(dest), destlen / 4, swap_endian))
 		throw std::error_condition(chd_file::error::DECOMPRESSION_ERROR);
 
-	// finish up
-	m_decoder.finish();
+	// leave the stream open so the next hunk skips parsing the header
 }
 
 
@@ -1617,7 +1767,7 @@ void chd_cd_flac_decompressor::decompress(const uint8_t *src, uint32_t complen,
 		throw std::error_condition(chd_file::error::DECOMPRESSION_ERROR);
 
 	// inflate the subcode data
-	uint32_t offset = m_decoder.finish();
+	uint32_t offset = m_decoder.decode_position();
 	m_inflater.next_in = const_cast<Bytef *>(src + offset);
 	m_inflater.avail_in = complen - offset;
 	m_inflater.total_in = 0;
@@ -245,12 +245,21 @@ double edit_distance(std::u32string_view lhs, std::u32string_view rhs)
 	std::u32string_view const &longer((lhs.length() >= rhs.length()) ? lhs : rhs);
 	std::u32string_view const &shorter((lhs.length() < rhs.length()) ? lhs : rhs);
 
+	// this is called for every field of every system as a search is typed, so avoid the heap for typical lengths
+	bool local_flags[256];
+	std::unique_ptr<bool []> heap_flags;
+	bool *flags(local_flags);
+	if ((shorter.length() + longer.length()) > std::size(local_flags))
+	{
+		heap_flags = std::make_unique<bool []>(shorter.length() + longer.length());
+		flags = heap_flags.get();
+	}
+	bool *const match_shorter(flags);
+	bool *const match_longer(flags + shorter.length());
+	std::fill_n(flags, shorter.length() + longer.length(), false);
+
 	// find matches
 	long const range((std::max)(long(longer.length() / 2) - 1, 0L));
-	std::unique_ptr<long []> match_idx(std::make_unique<long []>(shorter.length()));
-	std::unique_ptr<bool []> match_flg(std::make_unique<bool []>(longer.length()));
-	std::fill_n(match_idx.get(), shorter.length(), -1);
-	std::fill_n(match_flg.get(), longer.length(), false);
 	long match_cnt(0);
 	for (long i = 0; shorter.length() > i; ++i)
 	{
@@ -258,10 +267,10 @@ double edit_distance(std::u32string_view lhs, std::u32string_view rhs)
 		long const n((std::min)(i + range + 1L, long(longer.length())));
 		for (long j = (std::max)(i - range, 0L); n > j; ++j)
 		{
-			if (!match_flg[j] && (ch == longer[j]))
+			if (!match_longer[j] && (ch == longer[j]))
 			{
-				match_idx[i] = j;
-				match_flg[j] = true;
+				match_shorter[i] = true;
+				match_longer[j] = true;
 				++match_cnt;
 				break;
 			}
@@ -272,30 +281,18 @@ double edit_distance(std::u32string_view lhs, std::u32string_view rhs)
 	if (!match_cnt)
 		return 1.0;
 
-	// now find transpositions
-	std::unique_ptr<char32_t []> ms(std::make_unique<char32_t []>(2 * match_cnt));
-	std::fill_n(ms.get(), 2 * match_cnt, char32_t(0));
-	char32_t *const ms1(&ms[0]);
-	char32_t *const ms2(&ms[match_cnt]);
-	for (long i = 0, j = 0; shorter.length() > i; ++i)
-	{
-		if (0 <= match_idx[i])
-			ms1[j++] = shorter[i];
-	}
-	match_idx.reset();
-	for (long i = 0, j = 0; longer.length() > i; ++i)
-	{
-		if (match_flg[i])
-			ms2[j++] = longer[i];
-	}
-	match_flg.reset();
+	// now find transpositions by comparing the matched characters of each string in order
 	long halftrans_cnt(0);
-	for (long i = 0; match_cnt > i; ++i)
+	for (long i = 0, j = 0; shorter.length() > i; ++i)
 	{
-		if (ms1[i] != ms2[i])
-			++halftrans_cnt;
+		if (match_shorter[i])
+		{
+			while (!match_longer[j])
+				++j;
+			if (shorter[i] != longer[j++])
+				++halftrans_cnt;
+		}
 	}
-	ms.reset();
 
 	// simple prefix detection
 	long prefix_len(0);
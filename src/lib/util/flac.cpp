@@ -359,6 +359,10 @@ flac_decoder::~flac_decoder()
 
 bool flac_decoder::reset()
 {
+	// a decode that failed part way through leaves the decoder initialised
+	if (FLAC__stream_decoder_get_state(m_decoder) != FLAC__STREAM_DECODER_UNINITIALIZED)
+		FLAC__stream_decoder_finish(m_decoder);
+
 	m_compressed_offset = 0;
 	if (FLAC__stream_decoder_init_stream(m_decoder,
 				&flac_decoder::read_callback_static,
@@ -414,12 +418,27 @@ bool flac_decoder::reset(uint32_t sample_rate, uint8_t num_channels, uint32_t bl
 		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00  //
 														// +2A: start of stream data
 	};
-	memcpy(m_custom_header, s_header_template, sizeof(s_header_template));
-	m_custom_header[0x08] = m_custom_header[0x0a] = block_size >> 8;
-	m_custom_header[0x09] = m_custom_header[0x0b] = block_size & 0xff;
-	m_custom_header[0x12] = sample_rate >> 12;
-	m_custom_header[0x13] = sample_rate >> 4;
-	m_custom_header[0x14] = (sample_rate << 4) | ((num_channels - 1) << 1);
+	uint8_t header[sizeof(s_header_template)];
+	memcpy(header, s_header_template, sizeof(s_header_template));
+	header[0x08] = header[0x0a] = block_size >> 8;
+	header[0x09] = header[0x0b] = block_size & 0xff;
+	header[0x12] = sample_rate >> 12;
+	header[0x13] = sample_rate >> 4;
+	header[0x14] = (sample_rate << 4) | ((num_channels - 1) << 1);
+
+	// if the stream was left open with the same header, just start again on new frames
+	FLAC__StreamDecoderState const curstate = state();
+	if ((m_compressed_start == reinterpret_cast<const FLAC__byte *>(m_custom_header)) &&
+			(curstate >= FLAC__STREAM_DECODER_SEARCH_FOR_FRAME_SYNC) && (curstate <= FLAC__STREAM_DECODER_END_OF_STREAM) &&
+			!memcmp(header, m_custom_header, sizeof(header)))
+	{
+		m_file = nullptr;
+		m_compressed_offset = m_compressed_length;
+		m_compressed2_start = reinterpret_cast<const FLAC__byte *>(buffer);
+		m_compressed2_length = length;
+		return FLAC__stream_decoder_flush(m_decoder);
+	}
+	memcpy(m_custom_header, header, sizeof(header));
 
 	// configure the header ahead of the provided buffer
 	m_file = nullptr;
@@ -503,9 +522,23 @@ bool flac_decoder::decode(int16_t **samples, uint32_t num_samples, bool swap_end
 uint32_t flac_decoder::finish()
 {
 	// get the final decoding position and move forward
+	uint32_t const position = decode_position();
+	FLAC__stream_decoder_finish(m_decoder);
+	return position;
+}
+
+
+//-------------------------------------------------
+//  decode_position - get the position in the
+//  compressed data without closing the stream,
+//  so a reset with the same custom header can
+//  reuse it
+//-------------------------------------------------
+
+uint32_t flac_decoder::decode_position()
+{
 	FLAC__uint64 position = 0;
 	FLAC__stream_decoder_get_decode_position(m_decoder, &position);
-	FLAC__stream_decoder_finish(m_decoder);
 
 	// adjust position if we provided the header
 	if (position == 0)
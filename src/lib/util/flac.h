@@ -111,8 +111,9 @@ public:
 	bool decode_interleaved(int16_t *samples, uint32_t num_samples, bool swap_endian = false);
 	bool decode(int16_t **samples, uint32_t num_samples, bool swap_endian = false);
 
-	// finish up
+	// finish up, or leave the stream open for the next reset with the same parameters
 	uint32_t finish();
+	uint32_t decode_position();
 
 private:
 	// internal helpers
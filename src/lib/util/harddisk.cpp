@@ -16,6 +16,22 @@
 #include "osdcore.h"
 
 #include <cstdlib>
+#include <cstring>
+
+
+namespace {
+
+/*-------------------------------------------------
+    overlay file layout: a header followed by
+    sector records in the order they were first
+    written; a record is the little-endian LBA
+    followed by the sector data
+-------------------------------------------------*/
+
+constexpr char OVERLAY_MAGIC[8] = { 'M', 'A', 'M', 'E', 'H', 'D', 'O', 'V' };
+constexpr uint32_t OVERLAY_HEADER_BYTES = 16;   // magic, sector size, reserved
+
+} // anonymous namespace
 
 
 /*-------------------------------------------------
@@ -28,6 +44,8 @@ hard_disk_file::hard_disk_file(chd_file *_chd)
 	chd = _chd;
 	fhandle = nullptr;
 	fileoffset = 0;
+	overlay = nullptr;
+	overlay_end = 0;
 
 	std::string metadata;
 	std::error_condition err;
@@ -55,6 +73,8 @@ hard_disk_file::hard_disk_file(util::random_read_write &corefile, uint32_t skipo
 
 	chd = nullptr;
 	fhandle = &corefile;
+	overlay = nullptr;
+	overlay_end = 0;
 	hdinfo.sectorbytes = 512;
 	hdinfo.cylinders = 0;
 	hdinfo.heads = 0;
@@ -88,6 +108,8 @@ hard_disk_file::~hard_disk_file()
 {
 	if (fhandle)
 		fhandle->flush();
+	if (overlay)
+		overlay->flush();
 }
 
 
@@ -96,30 +118,73 @@ hard_disk_file::~hard_disk_file()
 -------------------------------------------------*/
 
 /**
- * @fn  bool read(uint32_t lbasector, void *buffer)
+ * @fn  bool read(uint32_t lbasector, void *buffer, uint32_t count)
  *
  * @brief   Hard disk read.
  *
  * @param   lbasector       The sector number (Linear Block Address) to read.
  * @param   buffer          The buffer where the hard disk data will be placed.
+ * @param   count           The number of consecutive sectors to read.
  *
  * @return  True if the operation succeeded
  */
 
-bool hard_disk_file::read(uint32_t lbasector, void *buffer)
+bool hard_disk_file::read(uint32_t lbasector, void *buffer, uint32_t count)
+{
+	if (!overlay || overlay_index.empty())
+		return read_image(lbasector, buffer, count);
+
+	// take runs of unwritten sectors from the image and the rest from the overlay
+	auto *dest = reinterpret_cast<uint8_t *>(buffer);
+	while (count)
+	{
+		auto const found = overlay_index.find(lbasector);
+		if (overlay_index.end() != found)
+		{
+			size_t actual = 0;
+			std::error_condition err = overlay->read_at(found->second, dest, hdinfo.sectorbytes, actual);
+			if (err || (actual != hdinfo.sectorbytes))
+				return false;
+			++lbasector;
+			--count;
+			dest += hdinfo.sectorbytes;
+		}
+		else
+		{
+			uint32_t run = 1;
+			while ((count > run) && (overlay_index.find(lbasector + run) == overlay_index.end()))
+				++run;
+			if (!read_image(lbasector, dest, run))
+				return false;
+			lbasector += run;
+			count -= run;
+			dest += run * hdinfo.sectorbytes;
+		}
+	}
+	return true;
+}
+
+
+/*-------------------------------------------------
+    read_image - read sectors from the
+    underlying image
+-------------------------------------------------*/
+
+bool hard_disk_file::read_image(uint32_t lbasector, void *buffer, uint32_t count)
 {
 	if (chd)
 	{
-		std::error_condition err = chd->read_units(lbasector, buffer);
+		std::error_condition err = chd->read_units(lbasector, buffer, count);
 		return !err;
 	}
 	else
 	{
+		size_t const bytes = size_t(count) * hdinfo.sectorbytes;
 		size_t actual = 0;
-		std::error_condition err = fhandle->seek(fileoffset + (lbasector * hdinfo.sectorbytes), SEEK_SET);
+		std::error_condition err = fhandle->seek(fileoffset + (uint64_t(lbasector) * hdinfo.sectorbytes), SEEK_SET);
 		if (!err)
-			err = fhandle->read(buffer, hdinfo.sectorbytes, actual);
-		return !err && (actual == hdinfo.sectorbytes);
+			err = fhandle->read(buffer, bytes, actual);
+		return !err && (actual == bytes);
 	}
 }
 
@@ -129,30 +194,72 @@ bool hard_disk_file::read(uint32_t lbasector, void *buffer)
 -------------------------------------------------*/
 
 /**
- * @fn  bool write(uint32_t lbasector, const void *buffer)
+ * @fn  bool write(uint32_t lbasector, const void *buffer, uint32_t count)
  *
  * @brief   Hard disk write.
  *
  * @param   lbasector       The sector number (Linear Block Address) to write.
  * @param   buffer          The buffer containing the data to write.
+ * @param   count           The number of consecutive sectors to write.
  *
  * @return  True if the operation succeeded
  */
 
-bool hard_disk_file::write(uint32_t lbasector, const void *buffer)
+bool hard_disk_file::write(uint32_t lbasector, const void *buffer, uint32_t count)
+{
+	if (!overlay)
+		return write_image(lbasector, buffer, count);
+
+	// sectors written before are replaced in place, new ones are appended
+	auto const *src = reinterpret_cast<const uint8_t *>(buffer);
+	for ( ; count; ++lbasector, --count, src += hdinfo.sectorbytes)
+	{
+		size_t actual = 0;
+		std::error_condition err;
+		auto const found = overlay_index.find(lbasector);
+		if (overlay_index.end() != found)
+		{
+			err = overlay->write_at(found->second, src, hdinfo.sectorbytes, actual);
+		}
+		else
+		{
+			uint8_t const lba[4] = { uint8_t(lbasector), uint8_t(lbasector >> 8), uint8_t(lbasector >> 16), uint8_t(lbasector >> 24) };
+			err = overlay->write_at(overlay_end, lba, sizeof(lba), actual);
+			if (!err && (actual == sizeof(lba)))
+				err = overlay->write_at(overlay_end + sizeof(lba), src, hdinfo.sectorbytes, actual);
+			if (!err && (actual == hdinfo.sectorbytes))
+			{
+				overlay_index.emplace(lbasector, overlay_end + sizeof(lba));
+				overlay_end += sizeof(lba) + hdinfo.sectorbytes;
+			}
+		}
+		if (err || (actual != hdinfo.sectorbytes))
+			return false;
+	}
+	return true;
+}
+
+
+/*-------------------------------------------------
+    write_image - write sectors to the
+    underlying image
+-------------------------------------------------*/
+
+bool hard_disk_file::write_image(uint32_t lbasector, const void *buffer, uint32_t count)
 {
 	if (chd)
 	{
-		std::error_condition err = chd->write_units(lbasector, buffer);
+		std::error_condition err = chd->write_units(lbasector, buffer, count);
 		return !err;
 	}
 	else
 	{
+		size_t const bytes = size_t(count) * hdinfo.sectorbytes;
 		size_t actual = 0;
-		std::error_condition err = fhandle->seek(fileoffset + (lbasector * hdinfo.sectorbytes), SEEK_SET);
+		std::error_condition err = fhandle->seek(fileoffset + (uint64_t(lbasector) * hdinfo.sectorbytes), SEEK_SET);
 		if (!err)
-			err = fhandle->write(buffer, hdinfo.sectorbytes, actual);
-		return !err && (actual == hdinfo.sectorbytes);
+			err = fhandle->write(buffer, bytes, actual);
+		return !err && (actual == bytes);
 	}
 }
 
@@ -195,6 +302,83 @@ bool hard_disk_file::set_block_size(uint32_t blocksize)
 }
 
 
+/*-------------------------------------------------
+    set_overlay - send writes to a sparse overlay
+    file, leaving the image untouched; an empty
+    file is initialised and sectors already in
+    the file are read back
+-------------------------------------------------*/
+
+/**
+ * @fn  std::error_condition set_overlay(util::random_read_write *file)
+ *
+ * @brief   Hard disk set overlay.
+ *
+ * @param   file            The overlay file, or nullptr to write to the image again.  It
+ *                          must stay open for as long as it's in use.
+ *
+ * @return  An error if the file isn't an overlay for a disk with this sector size.
+ */
+
+std::error_condition hard_disk_file::set_overlay(util::random_read_write *file)
+{
+	if (overlay)
+		overlay->flush();
+	overlay = nullptr;
+	overlay_index.clear();
+	overlay_end = 0;
+	if (!file)
+		return std::error_condition();
+
+	uint64_t length;
+	std::error_condition err = file->length(length);
+	if (err)
+		return err;
+
+	uint8_t header[OVERLAY_HEADER_BYTES];
+	size_t actual = 0;
+	if (!length)
+	{
+		// start a new overlay
+		memset(header, 0, sizeof(header));
+		memcpy(header, OVERLAY_MAGIC, sizeof(OVERLAY_MAGIC));
+		header[8] = uint8_t(hdinfo.sectorbytes);
+		header[9] = uint8_t(hdinfo.sectorbytes >> 8);
+		header[10] = uint8_t(hdinfo.sectorbytes >> 16);
+		header[11] = uint8_t(hdinfo.sectorbytes >> 24);
+		err = file->write_at(0, header, sizeof(header), actual);
+		if (!err && (actual != sizeof(header)))
+			err = std::errc::io_error;
+		if (err)
+			return err;
+		length = sizeof(header);
+	}
+	else
+	{
+		err = file->read_at(0, header, sizeof(header), actual);
+		if (err)
+			return err;
+		uint32_t const sectorbytes = header[8] | (header[9] << 8) | (header[10] << 16) | (uint32_t(header[11]) << 24);
+		if ((actual != sizeof(header)) || memcmp(header, OVERLAY_MAGIC, sizeof(OVERLAY_MAGIC)) || (sectorbytes != hdinfo.sectorbytes))
+			return std::errc::invalid_argument;
+	}
+
+	// index the sectors already written; a truncated record at the end is overwritten
+	uint64_t offset = OVERLAY_HEADER_BYTES;
+	for ( ; (offset + 4 + hdinfo.sectorbytes) <= length; offset += 4 + hdinfo.sectorbytes)
+	{
+		uint8_t lba[4];
+		err = file->read_at(offset, lba, sizeof(lba), actual);
+		if (err || (actual != sizeof(lba)))
+			break;
+		overlay_index[lba[0] | (lba[1] << 8) | (lba[2] << 16) | (uint32_t(lba[3]) << 24)] = offset + sizeof(lba);
+	}
+	overlay = file;
+	overlay_end = offset;
+	return std::error_condition();
+}
+
+
 std::error_condition hard_disk_file::get_inquiry_data(std::vector<uint8_t> &data) const
 {
 	if(chd)
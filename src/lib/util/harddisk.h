@@ -17,6 +17,7 @@
 
 #include <cstdint>
 #include <system_error>
+#include <unordered_map>
 #include <vector>
 
 
@@ -41,18 +42,28 @@ public:
 
 	bool set_block_size(uint32_t blocksize);
 
-	bool read(uint32_t lbasector, void *buffer);
-	bool write(uint32_t lbasector, const void *buffer);
+	// keep writes in a sparse overlay file instead of the underlying image
+	std::error_condition set_overlay(util::random_read_write *file);
+
+	bool read(uint32_t lbasector, void *buffer, uint32_t count = 1);
+	bool write(uint32_t lbasector, const void *buffer, uint32_t count = 1);
 
 	std::error_condition get_inquiry_data(std::vector<uint8_t> &data) const;
 	std::error_condition get_cis_data(std::vector<uint8_t> &data) const;
 	std::error_condition get_disk_key_data(std::vector<uint8_t> &data) const;
 
 private:
+	bool read_image(uint32_t lbasector, void *buffer, uint32_t count);
+	bool write_image(uint32_t lbasector, const void *buffer, uint32_t count);
+
 	chd_file *                  chd;        // CHD file
 	util::random_read_write *   fhandle;    // file if not a CHD
 	info                        hdinfo;     // hard disk info
 	uint32_t                    fileoffset; // offset in the file where the HDD image starts.  not valid for CHDs.
+
+	util::random_read_write *   overlay;        // overlay file receiving writes, if any
+	std::unordered_map<uint32_t, uint64_t> overlay_index; // offset of each written sector's data in the overlay
+	uint64_t                    overlay_end;    // where the next new sector goes in the overlay
 };
 
 #endif // MAME_LIB_UTIL_HARDDISK_H
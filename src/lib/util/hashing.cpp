@@ -20,6 +20,18 @@
 #include <iomanip>
 #include <sstream>
 
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define MAME_SHA1_X86_SHA
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define MAME_SHA1_TARGET_SHA
+#else
+#include <cpuid.h>
+#define MAME_SHA1_TARGET_SHA __attribute__((target("sse2,sha")))
+#endif
+#endif
+
 
 namespace util {
 
@@ -85,7 +97,7 @@ inline void sha1_r4(uint32_t *data, std::array<uint32_t, 5> &d, unsigned i) noex
 	d[(i + 3) % 5] = rotl_32(d[(i + 3) % 5], 30);
 }
 
-inline void sha1_process(std::array<uint32_t, 5> &st, uint32_t *data) noexcept
+inline void sha1_process_generic(std::array<uint32_t, 5> &st, uint32_t *data) noexcept
 {
 	std::array<uint32_t, 5> d = st;
 	unsigned i = 0U;
@@ -103,6 +115,114 @@ inline void sha1_process(std::array<uint32_t, 5> &st, uint32_t *data) noexcept
 		st[i] += d[i];
 }
 
+#if defined(MAME_SHA1_X86_SHA)
+
+bool sha1_x86_sha_supported() noexcept
+{
+#if defined(_MSC_VER)
+	int regs[4];
+	__cpuid(regs, 0);
+	if (regs[0] < 7)
+		return false;
+	__cpuidex(regs, 7, 0);
+	return (regs[1] >> 29) & 1;
+#else
+	unsigned eax, ebx, ecx, edx;
+	return __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) && ((ebx >> 29) & 1);
+#endif
+}
+
+// four rounds per group, with the message schedule for later groups
+// interleaved - msg[n % 4] holds W[4n..4n+3], most significant first
+template <unsigned G>
+MAME_SHA1_TARGET_SHA inline void sha1_x86_sha_group(__m128i &abcd, __m128i (&e)[2], __m128i (&msg)[4]) noexcept
+{
+	__m128i const &m = msg[G % 4];
+	if constexpr (!G)
+		e[0] = _mm_add_epi32(e[0], m);
+	else
+		e[G & 1] = _mm_sha1nexte_epu32(e[G & 1], m);
+	e[~G & 1] = abcd;
+	if constexpr ((G >= 3) && (G <= 18))
+		msg[(G + 1) % 4] = _mm_sha1msg2_epu32(msg[(G + 1) % 4], m);
+	abcd = _mm_sha1rnds4_epu32(abcd, e[G & 1], G / 5);
+	if constexpr ((G >= 1) && (G <= 16))
+		msg[(G + 3) % 4] = _mm_sha1msg1_epu32(msg[(G + 3) % 4], m);
+	if constexpr ((G >= 2) && (G <= 17))
+		msg[(G + 2) % 4] = _mm_xor_si128(msg[(G + 2) % 4], m);
+	if constexpr (G < 19)
+		sha1_x86_sha_group<G + 1>(abcd, e, msg);
+}
+
+// the state is stored E, D, C, B, A, so A-D load straight into the order
+// the SHA instructions expect
+MAME_SHA1_TARGET_SHA void sha1_process_x86_sha(std::array<uint32_t, 5> &st, uint32_t *data) noexcept
+{
+	__m128i const abcd_save = _mm_loadu_si128(reinterpret_cast<__m128i const *>(&st[1]));
+	__m128i const e_save = _mm_set_epi32(st[0], 0, 0, 0);
+	__m128i msg[4];
+	for (unsigned i = 0U; i < 4U; i++)
+		msg[i] = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const *>(&data[i * 4])), 0x1b);
+
+	__m128i abcd = abcd_save;
+	__m128i e[2] = { e_save, e_save };
+	sha1_x86_sha_group<0>(abcd, e, msg);
+
+	_mm_storeu_si128(reinterpret_cast<__m128i *>(&st[1]), _mm_add_epi32(abcd, abcd_save));
+	st[0] = _mm_cvtsi128_si32(_mm_shuffle_epi32(_mm_sha1nexte_epu32(e[0], e_save), 0x03));
+}
+
+#endif // defined(MAME_SHA1_X86_SHA)
+
+inline void sha1_process(std::array<uint32_t, 5> &st, uint32_t *data) noexcept
+{
+#if defined(MAME_SHA1_X86_SHA)
+	static bool const use_sha = sha1_x86_sha_supported();
+	if (use_sha)
+	{
+		sha1_process_x86_sha(st, data);
+		return;
+	}
+#endif
+	sha1_process_generic(st, data);
+}
+
+// XXH64 primes and round functions
+constexpr uint64_t XXH_PRIME64_1 = 0x9e3779b185ebca87U;
+constexpr uint64_t XXH_PRIME64_2 = 0xc2b2ae3d27d4eb4fU;
+constexpr uint64_t XXH_PRIME64_3 = 0x165667b19e3779f9U;
+constexpr uint64_t XXH_PRIME64_4 = 0x85ebca77c2b2ae63U;
+constexpr uint64_t XXH_PRIME64_5 = 0x27d4eb2f165667c5U;
+
+inline uint64_t xxh_rotl64(uint64_t x, int r) noexcept
+{
+	return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t xxh_read64(const uint8_t *p) noexcept
+{
+	return uint64_t(p[0]) | (uint64_t(p[1]) << 8) | (uint64_t(p[2]) << 16) | (uint64_t(p[3]) << 24) |
+			(uint64_t(p[4]) << 32) | (uint64_t(p[5]) << 40) | (uint64_t(p[6]) << 48) | (uint64_t(p[7]) << 56);
+}
+
+inline uint32_t xxh_read32(const uint8_t *p) noexcept
+{
+	return uint32_t(p[0]) | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16) | (uint32_t(p[3]) << 24);
+}
+
+inline uint64_t xxh_round(uint64_t acc, uint64_t input) noexcept
+{
+	acc += input * XXH_PRIME64_2;
+	acc = xxh_rotl64(acc, 31);
+	return acc * XXH_PRIME64_1;
+}
+
+inline uint64_t xxh_merge(uint64_t acc, uint64_t val) noexcept
+{
+	acc ^= xxh_round(0, val);
+	return (acc * XXH_PRIME64_1) + XXH_PRIME64_4;
+}
+
 } // anonymous namespace
 
 
@@ -206,8 +326,11 @@ void sha1_creator::append(const void *data, uint32_t length) noexcept
 		}
 		while ((length - offset) >= 64U)
 		{
-			for (residual = 0U; residual < 64U; residual++, offset++)
-				reinterpret_cast<uint8_t *>(m_buf)[residual ^ swizzle] = reinterpret_cast<const uint8_t *>(data)[offset];
+			// whole blocks can be gathered a word at a time
+			const uint8_t *const src = reinterpret_cast<const uint8_t *>(data) + offset;
+			for (unsigned i = 0U; i < 16U; i++)
+				m_buf[i] = (uint32_t(src[i * 4]) << 24) | (uint32_t(src[(i * 4) + 1]) << 16) | (uint32_t(src[(i * 4) + 2]) << 8) | uint32_t(src[(i * 4) + 3]);
+			offset += 64U;
 			sha1_process(m_st, m_buf);
 		}
 		residual = 0U;
@@ -509,4 +632,131 @@ void sum16_creator::append(const void *data, uint32_t length) noexcept
 	m_accum.m_raw = sum;
 }
 
+
+
+//**************************************************************************
+//  XXH64 HELPERS
+//**************************************************************************
+
+//-------------------------------------------------
+//  reset - prepare to hash a block of data
+//-------------------------------------------------
+
+void xxh64_creator::reset(uint64_t seed) noexcept
+{
+	m_acc[0] = seed + XXH_PRIME64_1 + XXH_PRIME64_2;
+	m_acc[1] = seed + XXH_PRIME64_2;
+	m_acc[2] = seed;
+	m_acc[3] = seed - XXH_PRIME64_1;
+	m_seed = seed;
+	m_total = 0;
+	m_buffered = 0;
+}
+
+
+//-------------------------------------------------
+//  append - hash a block of data, appending to
+//  the currently-accumulated value
+//-------------------------------------------------
+
+void xxh64_creator::append(const void *data, std::size_t length) noexcept
+{
+	auto const *src = reinterpret_cast<const uint8_t *>(data);
+	m_total += length;
+
+	// top up a partial stripe first
+	if (m_buffered)
+	{
+		std::size_t const fill = (std::min)(std::size_t(sizeof(m_buffer) - m_buffered), length);
+		std::memcpy(&m_buffer[m_buffered], src, fill);
+		m_buffered += fill;
+		src += fill;
+		length -= fill;
+		if (sizeof(m_buffer) > m_buffered)
+			return;
+		for (int i = 0; 4 > i; ++i)
+			m_acc[i] = xxh_round(m_acc[i], xxh_read64(&m_buffer[i * 8]));
+		m_buffered = 0;
+	}
+
+	// rip through whole stripes in locals
+	if (sizeof(m_buffer) <= length)
+	{
+		uint64_t v0 = m_acc[0], v1 = m_acc[1], v2 = m_acc[2], v3 = m_acc[3];
+		do
+		{
+			v0 = xxh_round(v0, xxh_read64(src + 0));
+			v1 = xxh_round(v1, xxh_read64(src + 8));
+			v2 = xxh_round(v2, xxh_read64(src + 16));
+			v3 = xxh_round(v3, xxh_read64(src + 24));
+			src += 32;
+			length -= 32;
+		}
+		while (sizeof(m_buffer) <= length);
+		m_acc[0] = v0;
+		m_acc[1] = v1;
+		m_acc[2] = v2;
+		m_acc[3] = v3;
+	}
+
+	// keep the tail for next time
+	if (length)
+	{
+		std::memcpy(m_buffer, src, length);
+		m_buffered = uint32_t(length);
+	}
+}
+
+
+//-------------------------------------------------
+//  finish - fold the accumulators and any
+//  buffered tail into the final value; this
+//  doesn't disturb the state, so more data can
+//  be appended afterwards
+//-------------------------------------------------
+
+uint64_t xxh64_creator::finish() const noexcept
+{
+	uint64_t h;
+	if (sizeof(m_buffer) <= m_total)
+	{
+		h = xxh_rotl64(m_acc[0], 1) + xxh_rotl64(m_acc[1], 7) + xxh_rotl64(m_acc[2], 12) + xxh_rotl64(m_acc[3], 18);
+		for (int i = 0; 4 > i; ++i)
+			h = xxh_merge(h, m_acc[i]);
+	}
+	else
+	{
+		h = m_seed + XXH_PRIME64_5;
+	}
+	h += m_total;
+
+	uint8_t const *p = m_buffer;
+	uint32_t remaining = m_buffered;
+	for ( ; 8 <= remaining; p += 8, remaining -= 8)
+	{
+		h ^= xxh_round(0, xxh_read64(p));
+		h = (xxh_rotl64(h, 27) * XXH_PRIME64_1) + XXH_PRIME64_4;
+	}
+	if (4 <= remaining)
+	{
+		h ^= uint64_t(xxh_read32(p)) * XXH_PRIME64_1;
+		h = (xxh_rotl64(h, 23) * XXH_PRIME64_2) + XXH_PRIME64_3;
+		p += 4;
+		remaining -= 4;
+	}
+	for ( ; remaining; ++p, --remaining)
+	{
+		h ^= uint64_t(*p) * XXH_PRIME64_5;
+		h = xxh_rotl64(h, 11) * XXH_PRIME64_1;
+	}
+
+	// final avalanche
+	h ^= h >> 33;
+	h *= XXH_PRIME64_2;
+	h ^= h >> 29;
+	h *= XXH_PRIME64_3;
+	h ^= h >> 32;
+	return h;
+}
+
 } // namespace util
@@ -15,6 +15,7 @@
 #include "md5.h"
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <functional>
@@ -291,6 +292,43 @@ protected:
 	sum16_t             m_accum;        // internal accumulator
 };
 
+
+
+// ======================> XXH64
+
+// creation helper - fast non-cryptographic 64-bit hash (not a file digest)
+class xxh64_creator
+{
+public:
+	// construction/destruction
+	xxh64_creator(uint64_t seed = 0) noexcept { reset(seed); }
+
+	// reset
+	void reset(uint64_t seed = 0) noexcept;
+
+	// append data
+	void append(const void *data, std::size_t length) noexcept;
+
+	// compute the hash of everything appended so far
+	uint64_t finish() const noexcept;
+
+	// static wrapper to just get the hash of a block
+	static uint64_t simple(const void *data, std::size_t length, uint64_t seed = 0) noexcept
+	{
+		xxh64_creator creator(seed);
+		creator.append(data, length);
+		return creator.finish();
+	}
+
+protected:
+	// internal state
+	uint64_t            m_acc[4];       // lane accumulators
+	uint64_t            m_seed;         // seed value
+	uint64_t            m_total;        // total bytes appended
+	uint8_t             m_buffer[32];   // partial stripe
+	uint32_t            m_buffered;     // bytes in partial stripe
+};
+
 } // namespace util
 
 namespace std {
@@ -360,6 +360,71 @@ void palette_t::entry_set_color(uint32_t index, rgb_t rgb)
 }
 
 
+//-------------------------------------------------
+//  entry_set_colors - set the raw RGB colors for
+//  a range of palette indexes
+//-------------------------------------------------
+
+void palette_t::entry_set_colors(uint32_t index, const rgb_t *colors, uint32_t count)
+{
+	assert(index + count <= m_numcolors);
+
+	// store the colors, noting the span that changed
+	uint32_t first = count, last = 0;
+	for (uint32_t i = 0; i < count; i++)
+	{
+		if (m_entry_color[index + i] != colors[i])
+		{
+			m_entry_color[index + i] = colors[i];
+			first = std::min(first, i);
+			last = i;
+		}
+	}
+	if (first > last)
+		return;
+
+	// for a few entries, do them one at a time
+	uint32_t const start = index + first, end = index + last + 1;
+	if ((end - start) < 64)
+	{
+		for (int groupnum = 0; groupnum < m_numgroups; groupnum++)
+			for (uint32_t curindex = start; curindex < end; curindex++)
+				update_adjusted_color(groupnum, curindex);
+		return;
+	}
+
+	for (int groupnum = 0; groupnum < m_numgroups; groupnum++)
+	{
+		// entries without their own contrast map each component through the same table
+		float const brightness = m_group_bright[groupnum] + m_brightness;
+		float const contrast = m_group_contrast[groupnum] * m_contrast;
+		uint8_t adjust[256];
+		for (int level = 0; level < 256; level++)
+			adjust[level] = rgb_t::clamp(float(m_gamma_map[level]) * contrast + brightness);
+
+		for (uint32_t curindex = start; curindex < end; curindex++)
+		{
+			if (m_entry_contrast[curindex] != 1.0f)
+			{
+				update_adjusted_color(groupnum, curindex);
+				continue;
+			}
+
+			rgb_t const entry = m_entry_color[curindex];
+			rgb_t const adjusted(entry.a(), adjust[entry.r()], adjust[entry.g()], adjust[entry.b()]);
+			uint32_t const finalindex = groupnum * m_numcolors + curindex;
+			if (m_adjusted_color[finalindex] != adjusted)
+			{
+				m_adjusted_color[finalindex] = adjusted;
+				m_adjusted_rgb15[finalindex] = adjusted.as_rgb15();
+				for (palette_client *client = m_client_list; client != nullptr; client = client->next())
+					client->mark_dirty(finalindex);
+			}
+		}
+	}
+}
+
+
 //-------------------------------------------------
 //  entry_set_red_level - set the red level for a
 //  given palette index
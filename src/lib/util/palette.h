@@ -171,6 +171,7 @@ public:
 
 	// entry setters
 	void entry_set_color(uint32_t index, rgb_t rgb);
+	void entry_set_colors(uint32_t index, const rgb_t *colors, uint32_t count);
 	void entry_set_red_level(uint32_t index, uint8_t level);
 	void entry_set_green_level(uint32_t index, uint8_t level);
 	void entry_set_blue_level(uint32_t index, uint8_t level);
@@ -14,6 +14,7 @@
 #include "unicode.h"
 
 #include "osdcomm.h"
+#include "osdcore.h"
 
 #include <zlib.h>
 
@@ -24,6 +25,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <new>
+#include <vector>
 
 
 namespace util {
@@ -302,16 +304,29 @@ private:
 			return std::error_condition();
 
 		case PNG_PF_Paeth: // PAETH = special filter
-			for (std::uint32_t x = 0; rowbytes > x; ++x, ++src, ++dst)
+			if (dstprev)
 			{
-				int32_t const pa((x < bpp) ? 0 : dst[-bpp]);
-				int32_t const pc(((x < bpp) || !dstprev) ? 0 : dstprev[-bpp]);
-				int32_t const pb(!dstprev ? 0 : *dstprev++);
-				int32_t const prediction(pa + pb - pc);
-				int32_t const da(std::abs(prediction - pa));
-				int32_t const db(std::abs(prediction - pb));
-				int32_t const dc(std::abs(prediction - pc));
-				*dst = ((da <= db) && (da <= dc)) ? (*src + pa) : (db <= dc) ? (*src + pb) : (*src + pc);
+				// with nothing to the left, the prediction is always the pixel above
+				for (std::uint32_t x = 0; bpp > x; ++x, ++src, ++dst, ++dstprev)
+					*dst = *src + *dstprev;
+				for (std::uint32_t x = bpp; rowbytes > x; ++x, ++src, ++dst, ++dstprev)
+				{
+					int32_t const pa(dst[-bpp]);
+					int32_t const pb(*dstprev);
+					int32_t const pc(dstprev[-bpp]);
+					int32_t const da(std::abs(pb - pc));
+					int32_t const db(std::abs(pa - pc));
+					int32_t const dc(std::abs(pa + pb - (pc << 1)));
+					*dst = *src + (((da <= db) && (da <= dc)) ? pa : (db <= dc) ? pb : pc);
+				}
+			}
+			else
+			{
+				// with nothing above, the prediction is always the pixel to the left
+				dst = std::copy_n(src, bpp, dst);
+				src += bpp;
+				for (std::uint32_t x = bpp; rowbytes > x; ++x, ++src, ++dst)
+					*dst = *src + dst[-bpp];
 			}
 			return std::error_condition();
 
@@ -980,13 +995,126 @@ static std::error_condition write_chunk(write_stream &fp, const uint8_t *data, u
 }
 
 
+/*-------------------------------------------------
+    deflate_slice_callback - compress one slice
+    of a chunk as a raw deflate fragment, primed
+    with the data that precedes it
+-------------------------------------------------*/
+
+namespace {
+
+// images at least this large are compressed in slices on a work queue
+constexpr std::uint32_t PARALLEL_DEFLATE_MIN = 1U << 20;
+constexpr std::uint32_t PARALLEL_DEFLATE_SLICE = 1U << 17;
+constexpr std::uint32_t DEFLATE_WINDOW = 1U << 15;
+
+struct deflate_slice
+{
+	std::uint8_t const *data;
+	std::uint32_t length;
+	std::uint32_t dictlength;
+	bool last;
+	int result;
+	std::vector<std::uint8_t> output;
+};
+
+void *deflate_slice_callback(void *param, int threadid)
+{
+	deflate_slice &slice(*reinterpret_cast<deflate_slice *>(param));
+
+	z_stream stream;
+	memset(&stream, 0, sizeof(stream));
+	slice.result = deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY);
+	if (Z_OK != slice.result)
+		return nullptr;
+	if (slice.dictlength)
+		slice.result = deflateSetDictionary(&stream, slice.data - slice.dictlength, slice.dictlength);
+
+	// a sync flush adds an empty stored block on top of the bound
+	if (Z_OK == slice.result)
+	{
+		try { slice.output.resize(deflateBound(&stream, slice.length) + 16); }
+		catch (std::bad_alloc const &) { slice.result = Z_MEM_ERROR; }
+	}
+	if (Z_OK == slice.result)
+	{
+		stream.next_in = const_cast<Bytef *>(slice.data);
+		stream.avail_in = slice.length;
+		stream.next_out = &slice.output[0];
+		stream.avail_out = slice.output.size();
+		slice.result = deflate(&stream, slice.last ? Z_FINISH : Z_SYNC_FLUSH);
+		if (slice.last ? (Z_STREAM_END == slice.result) : ((Z_OK == slice.result) && !stream.avail_in && stream.avail_out))
+			slice.result = Z_OK;
+		else if (Z_OK == slice.result)
+			slice.result = Z_BUF_ERROR;
+		slice.output.resize(stream.total_out);
+	}
+	deflateEnd(&stream);
+	return nullptr;
+}
+
+} // anonymous namespace
+
+
+/*-------------------------------------------------
+    write_parallel_deflated_chunk - write an
+    in-memory chunk to the given file by
+    deflating slices of it on a work queue
+-------------------------------------------------*/
+
+static std::error_condition write_parallel_deflated_chunk(random_write &fp, uint8_t *data, uint32_t type, uint32_t length, osd_work_queue &queue) noexcept
+{
+	// every slice but the first is primed with the preceding window, so the
+	// fragments concatenate into a single stream (this is what pigz does)
+	std::vector<deflate_slice> slices;
+	try { slices.resize((length + PARALLEL_DEFLATE_SLICE - 1) / PARALLEL_DEFLATE_SLICE); }
+	catch (std::bad_alloc const &) { return std::errc::not_enough_memory; }
+	for (std::size_t i = 0; slices.size() > i; ++i)
+	{
+		std::uint32_t const offset = i * PARALLEL_DEFLATE_SLICE;
+		slices[i].data = data + offset;
+		slices[i].length = std::min(length - offset, PARALLEL_DEFLATE_SLICE);
+		slices[i].dictlength = std::min(offset, DEFLATE_WINDOW);
+		slices[i].last = (slices.size() - 1) == i;
+		slices[i].result = Z_OK;
+	}
+	osd_work_item_queue_multiple(&queue, deflate_slice_callback, slices.size(), &slices[0], sizeof(slices[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+	while (!osd_work_queue_wait(&queue, osd_ticks_per_second())) { }
+
+	// assemble the zlib stream: header, fragments, checksum of the whole input
+	std::size_t zlength = 2 + 4;
+	for (deflate_slice const &slice : slices)
+	{
+		if (Z_MEM_ERROR == slice.result)
+			return std::errc::not_enough_memory;
+		else if (Z_OK != slice.result)
+			return png_error::COMPRESS_ERROR;
+		zlength += slice.output.size();
+	}
+	std::vector<std::uint8_t> zdata;
+	try { zdata.resize(zlength); }
+	catch (std::bad_alloc const &) { return std::errc::not_enough_memory; }
+	std::uint8_t *dst = &zdata[0];
+	*dst++ = 0x78;
+	*dst++ = 0x9c;
+	for (deflate_slice const &slice : slices)
+		dst = std::copy(slice.output.begin(), slice.output.end(), dst);
+	put_32bit(dst, adler32(adler32(0, nullptr, 0), data, length));
+
+	return write_chunk(fp, &zdata[0], type, zlength);
+}
+
+
 /*-------------------------------------------------
     write_deflated_chunk - write an in-memory
     chunk to the given file by deflating it
 -------------------------------------------------*/
 
-static std::error_condition write_deflated_chunk(random_write &fp, uint8_t *data, uint32_t type, uint32_t length) noexcept
+static std::error_condition write_deflated_chunk(random_write &fp, uint8_t *data, uint32_t type, uint32_t length, osd_work_queue *queue) noexcept
 {
+	if (queue && (length >= PARALLEL_DEFLATE_MIN))
+		return write_parallel_deflated_chunk(fp, data, type, length, *queue);
+
 	std::error_condition err;
 	std::uint64_t lengthpos;
 	err = fp.tell(lengthpos);
@@ -1237,7 +1365,7 @@ static std::error_condition convert_bitmap_to_image_rgb(png_info &pnginfo, bitma
     chunks to the given file
 -------------------------------------------------*/
 
-static std::error_condition write_png_stream(random_write &fp, png_info &pnginfo, const bitmap_t &bitmap, int palette_length, const rgb_t *palette) noexcept
+static std::error_condition write_png_stream(random_write &fp, png_info &pnginfo, const bitmap_t &bitmap, int palette_length, const rgb_t *palette, osd_work_queue *queue) noexcept
 {
 	uint8_t tempbuff[16];
 	std::error_condition error;
@@ -1271,7 +1399,7 @@ static std::error_condition write_png_stream(random_write &fp, png_info &pnginfo
 		return error;
 
 	// write a single IDAT chunk
-	error = write_deflated_chunk(fp, pnginfo.image.get(), PNG_CN_IDAT, pnginfo.height * (compute_rowbytes(pnginfo) + 1));
+	error = write_deflated_chunk(fp, pnginfo.image.get(), PNG_CN_IDAT, pnginfo.height * (compute_rowbytes(pnginfo) + 1), queue);
 	if (error)
 		return error;
 
@@ -1318,7 +1446,7 @@ static std::error_condition write_png_stream(random_write &fp, png_info &pnginfo
 }
 
 
-std::error_condition png_write_bitmap(random_write &fp, png_info *info, bitmap_t const &bitmap, int palette_length, const rgb_t *palette) noexcept
+std::error_condition png_write_bitmap(random_write &fp, png_info *info, bitmap_t const &bitmap, int palette_length, const rgb_t *palette, osd_work_queue *queue) noexcept
 {
 	// use a dummy pnginfo if none passed to us
 	png_info pnginfo;
@@ -1334,7 +1462,7 @@ std::error_condition png_write_bitmap(random_write &fp, png_info *info, bitmap_t
 		return std::errc::io_error;
 
 	// write the rest of the PNG data
-	return write_png_stream(fp, *info, bitmap, palette_length, palette);
+	return write_png_stream(fp, *info, bitmap, palette_length, palette, queue);
 }
 
 
@@ -1364,9 +1492,9 @@ std::error_condition mng_capture_start(random_write &fp, bitmap_t const &bitmap,
 }
 
 
-std::error_condition mng_capture_frame(random_write &fp, png_info &info, bitmap_t const &bitmap, int palette_length, rgb_t const *palette) noexcept
+std::error_condition mng_capture_frame(random_write &fp, png_info &info, bitmap_t const &bitmap, int palette_length, rgb_t const *palette, osd_work_queue *queue) noexcept
 {
-	return write_png_stream(fp, info, bitmap, palette_length, palette);
+	return write_png_stream(fp, info, bitmap, palette_length, palette, queue);
 }
 
 
@@ -25,6 +25,9 @@
 #include <utility>
 
 
+struct osd_work_queue;
+
+
 namespace util {
 
 /***************************************************************************
@@ -104,10 +107,10 @@ private:
 
 std::error_condition png_read_bitmap(read_stream &fp, bitmap_argb32 &bitmap) noexcept;
 
-std::error_condition png_write_bitmap(random_write &fp, png_info *info, bitmap_t const &bitmap, int palette_length, const rgb_t *palette) noexcept;
+std::error_condition png_write_bitmap(random_write &fp, png_info *info, bitmap_t const &bitmap, int palette_length, const rgb_t *palette, osd_work_queue *queue = nullptr) noexcept;
 
 std::error_condition mng_capture_start(random_write &fp, bitmap_t const &bitmap, unsigned rate) noexcept;
-std::error_condition mng_capture_frame(random_write &fp, png_info &info, bitmap_t const &bitmap, int palette_length, rgb_t const *palette) noexcept;
+std::error_condition mng_capture_frame(random_write &fp, png_info &info, bitmap_t const &bitmap, int palette_length, rgb_t const *palette, osd_work_queue *queue = nullptr) noexcept;
 std::error_condition mng_capture_stop(random_write &fp) noexcept;
 
 } // namespace util
@@ -328,7 +328,7 @@ private:
 	};
 
 	static constexpr std::size_t        DECOMPRESS_BUFSIZE = 16384;
-	static constexpr std::size_t        CACHE_SIZE = 8; // number of open files to cache
+	static constexpr std::size_t        CACHE_SIZE = 16; // number of open files to cache (enough for auditing/loading on several threads)
 	static std::array<ptr, CACHE_SIZE>  s_cache;
 	static std::mutex                   s_cache_mutex;
 
@@ -781,6 +781,13 @@ int zip_file_impl::search(std::uint32_t search_crc, std::string_view search_file
 		if (!reader.signature_correct() || ((m_cd_pos + reader.total_length()) > m_ecd.cd_size))
 			break;
 
+		// the CRC is stored directly, so skip entries that can't match without decoding them
+		if (matchcrc && (reader.crc32() != search_crc))
+		{
+			m_cd_pos += reader.total_length();
+			continue;
+		}
+
 		// setting std::string can raise allocation exceptions
 		try
 		{
@@ -2662,6 +2662,7 @@ void cps_state::cps1_build_palette( const uint16_t* const palette_base )
 	{
 		if (BIT(ctrl, page))
 		{
+			rgb_t colors[0x200];
 			for (offset = 0; offset < 0x200; ++offset)
 			{
 				int palette = *(palette_ram++);
@@ -2676,8 +2677,9 @@ void cps_state::cps1_build_palette( const uint16_t* const palette_base )
 				g = ((palette >> 4) & 0x0f) * 0x11 * bright / 0x2d;
 				b = ((palette >> 0) & 0x0f) * 0x11 * bright / 0x2d;
 
-				m_palette->set_pen_color(0x200 * page + offset, rgb_t(r, g, b));
+				colors[offset] = rgb_t(r, g, b);
 			}
+			m_palette->set_pen_colors(0x200 * page, colors);
 		}
 		else
 		{
@@ -2780,6 +2782,16 @@ void cps_state::cps1_render_sprites( screen_device &screen, bitmap_ind16 &bitmap
 }
 
 
+	// the whole list is walked for every partial update, so skip rows of
+	// tiles that fall outside the band being drawn before calling drawgfx
+	auto const row_visible =
+		[this, &cliprect] (int sy)
+		{
+			if (flip_screen())
+				sy = 256 - 16 - sy;
+			return (sy <= cliprect.max_y) && ((sy + 15) >= cliprect.min_y);
+		};
+
 	int i, baseadd;
 	uint16_t *base = m_buffered_obj.get();
 
@@ -2825,10 +2837,13 @@ void cps_state::cps1_render_sprites( screen_device &screen, bitmap_ind16 &bitmap
 					{
 						for (nys = 0; nys < ny; nys++)
 						{
+							sy = (y + nys * 16) & 0x1ff;
+							if (!row_visible(sy))
+								continue;
+
 							for (nxs = 0; nxs < nx; nxs++)
 							{
 								sx = (x + nxs * 16) & 0x1ff;
-								sy = (y + nys * 16) & 0x1ff;
 
 								DRAWSPRITE(
 //                                      code + (nx - 1) - nxs + 0x10 * (ny - 1 - nys),
@@ -2843,10 +2858,13 @@ void cps_state::cps1_render_sprites( screen_device &screen, bitmap_ind16 &bitmap
 					{
 						for (nys = 0; nys < ny; nys++)
 						{
+							sy = (y + nys * 16) & 0x1ff;
+							if (!row_visible(sy))
+								continue;
+
 							for (nxs = 0; nxs < nx; nxs++)
 							{
 								sx = (x + nxs * 16) & 0x1ff;
-								sy = (y + nys * 16) & 0x1ff;
 
 								DRAWSPRITE(
 //                                      code + nxs + 0x10 * (ny - 1 - nys),
@@ -2864,10 +2882,13 @@ void cps_state::cps1_render_sprites( screen_device &screen, bitmap_ind16 &bitmap
 					{
 						for (nys = 0; nys < ny; nys++)
 						{
-							for (nxs = 0; nxs<nx; nxs++)
+							sy = (y + nys * 16) & 0x1ff;
+							if (!row_visible(sy))
+								continue;
+
+							for (nxs = 0; nxs < nx; nxs++)
 							{
 								sx = (x + nxs * 16) & 0x1ff;
-								sy = (y + nys * 16) & 0x1ff;
 
 								DRAWSPRITE(
 //                                      code + (nx - 1) - nxs + 0x10 * nys,
@@ -2882,10 +2903,13 @@ void cps_state::cps1_render_sprites( screen_device &screen, bitmap_ind16 &bitmap
 					{
 						for (nys = 0; nys < ny; nys++)
 						{
+							sy = (y + nys * 16) & 0x1ff;
+							if (!row_visible(sy))
+								continue;
+
 							for (nxs = 0; nxs < nx; nxs++)
 							{
 								sx = (x + nxs * 16) & 0x1ff;
-								sy = (y + nys * 16) & 0x1ff;
 
 								DRAWSPRITE(
 //                                      code + nxs + 0x10 * nys,
@@ -2898,7 +2922,7 @@ void cps_state::cps1_render_sprites( screen_device &screen, bitmap_ind16 &bitmap
 					}
 				}
 			}
-			else
+			else if (row_visible(y & 0x1ff))
 			{
 				/* Simple case... 1 sprite */
 						DRAWSPRITE(
@@ -279,8 +279,11 @@ inline bool neosprite_base_device::sprite_on_scanline(int scanline, int y, int r
 }
 
 
-void neosprite_base_device::draw_sprites(bitmap_rgb32 &bitmap, int scanline)
+template <typename T>
+void neosprite_base_device::draw_sprites_common(bitmap_rgb32 &bitmap, int scanline)
 {
+	T &self = static_cast<T &>(*this);
+
 	int max_sprite_index;
 	int y = 0;
 	int x = 0;
@@ -420,7 +423,7 @@ void neosprite_base_device::draw_sprites(bitmap_rgb32 &bitmap, int scanline)
 				{
 					if (zoom_x_table & 0x8000)
 					{
-						draw_pixel(gfx_base, pixel_addr, line_pens);
+						self.T::draw_pixel(gfx_base, pixel_addr, line_pens);
 
 						pixel_addr++;
 					}
@@ -444,7 +447,7 @@ void neosprite_base_device::draw_sprites(bitmap_rgb32 &bitmap, int scanline)
 					{
 						if (x >= 0x200)
 						{
-							draw_pixel(gfx_base, pixel_addr, line_pens);
+							self.T::draw_pixel(gfx_base, pixel_addr, line_pens);
 
 							pixel_addr++;
 						}
@@ -652,6 +655,11 @@ inline void neosprite_regular_device::draw_pixel(int romaddr, uint32_t* dst, con
 		*dst = line_pens[gfx];
 }
 
+void neosprite_regular_device::draw_sprites(bitmap_rgb32 &bitmap, int scanline)
+{
+	draw_sprites_common<neosprite_regular_device>(bitmap, scanline);
+}
+
 
 
 /*********************************************************************************************************************************/
@@ -729,6 +737,11 @@ inline void neosprite_optimized_device::draw_pixel(int romaddr, uint32_t* dst, c
 		*dst = line_pens[gfx];
 }
 
+void neosprite_optimized_device::draw_sprites(bitmap_rgb32 &bitmap, int scanline)
+{
+	draw_sprites_common<neosprite_optimized_device>(bitmap, scanline);
+}
+
 
 /*********************************************************************************************************************************/
 /* MIDAS specific sprite handling                                                                                                */
@@ -765,6 +778,11 @@ inline void neosprite_midas_device::draw_pixel(int romaddr, uint32_t* dst, const
 		*dst = line_pens[gfx];
 }
 
+void neosprite_midas_device::draw_sprites(bitmap_rgb32 &bitmap, int scanline)
+{
+	draw_sprites_common<neosprite_midas_device>(bitmap, scanline);
+}
+
 
 void neosprite_midas_device::device_start()
 {
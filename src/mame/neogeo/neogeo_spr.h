@@ -37,7 +37,7 @@ public:
 	void neogeo_set_fixed_layer_source(uint8_t data);
 	inline bool sprite_on_scanline(int scanline, int y, int rows);
 	virtual void draw_pixel(int romaddr, uint32_t* dst, const pen_t *line_pens) = 0;
-	void draw_sprites(bitmap_rgb32 &bitmap, int scanline);
+	virtual void draw_sprites(bitmap_rgb32 &bitmap, int scanline) = 0;
 	void parse_sprites(int scanline);
 	void create_sprite_line_timer();
 	void start_sprite_line_timer();
@@ -78,6 +78,9 @@ protected:
 			device_t *owner,
 			uint32_t clock);
 
+	// draws with the derived class's draw_pixel called directly, so it can be inlined
+	template <typename T> void draw_sprites_common(bitmap_rgb32 &bitmap, int scanline);
+
 	virtual void device_start() override;
 	virtual void device_reset() override;
 	uint32_t get_region_mask(uint8_t* rgn, uint32_t rgn_size);
@@ -95,6 +98,7 @@ class neosprite_regular_device : public neosprite_base_device
 public:
 	neosprite_regular_device(const machine_config &mconfig, const char *tag, device_t *owner, uint32_t clock);
 	virtual void draw_pixel(int romaddr, uint32_t* dst, const pen_t *line_pens) override;
+	virtual void draw_sprites(bitmap_rgb32 &bitmap, int scanline) override;
 	virtual void set_sprite_region(uint8_t* region_sprites, uint32_t region_sprites_size) override;
 
 };
@@ -109,6 +113,7 @@ public:
 	virtual void optimize_sprite_data() override;
 	virtual void set_optimized_sprite_data(uint8_t* sprdata, uint32_t mask) override;
 	virtual void draw_pixel(int romaddr, uint32_t* dst, const pen_t *line_pens) override;
+	virtual void draw_sprites(bitmap_rgb32 &bitmap, int scanline) override;
 	std::vector<uint8_t> m_sprite_gfx;
 	uint8_t* m_spritegfx8;
 
@@ -125,6 +130,7 @@ public:
 	neosprite_midas_device(const machine_config &mconfig, const char *tag, device_t *owner, uint32_t clock);
 
 	virtual void draw_pixel(int romaddr, uint32_t* dst, const pen_t *line_pens) override;
+	virtual void draw_sprites(bitmap_rgb32 &bitmap, int scanline) override;
 
 	std::unique_ptr<uint16_t[]> m_videoram_buffer;
 	void buffer_vram();
@@ -125,6 +125,9 @@ void n64_state::video_start()
 
 uint32_t n64_state::screen_update(screen_device &screen, bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
+	// the video interface reads what the RDP has drawn so far
+	m_rdp->flush_pipe("screen update");
+
 	//uint16_t* frame_buffer = (uint16_t*)&rdram[(m_rcp_periphs->vi_origin & 0xffffff) >> 2];
 	//uint8_t* cvg_buffer = &m_rdp.m_hidden_bits[((m_rcp_periphs->vi_origin & 0xffffff) >> 2) >> 1];
 	//int32_t vibuffering = ((m_rcp_periphs->vi_control & 2) && fsaa && divot);
@@ -1912,6 +1915,12 @@ void n64_rdp::draw_triangle(uint64_t *cmd_buf, bool shade, bool texture, bool zb
 		return;
 	}
 
+	// span data stays in use until queued primitives are drawn, so wait for them when it runs short
+	if ((m_aux_buf_ptr + (((ylfar - ycur) >> 2) + 1) * sizeof(rdp_span_aux)) >= EXTENT_AUX_COUNT || m_batch_count >= MAX_BATCHED_PRIMITIVES)
+	{
+		flush_pipe("span buffer full");
+	}
+
 	bool new_object = true;
 	rdp_poly_state* object = nullptr;
 	bool valid = false;
@@ -2064,8 +2073,6 @@ void n64_rdp::draw_triangle(uint64_t *cmd_buf, bool shade, bool texture, bool zb
 	{
 		render_spans(yh >> 2, yl >> 2, tilenum, flip ? true : false, spans, rect, object);
 	}
-	m_aux_buf_ptr = 0;  // Spans can be reused once render completes
-	//wait("draw_triangle");
 }
 
 /*****************************************************************************/
@@ -2077,7 +2084,6 @@ void n64_rdp::draw_triangle(uint64_t *cmd_buf, bool shade, bool texture, bool zb
 void n64_rdp::triangle(uint64_t *cmd_buf, bool shade, bool texture, bool zbuffer)
 {
 	draw_triangle(cmd_buf, shade, texture, zbuffer, false);
-	m_pipe_clean = false;
 }
 
 void n64_rdp::cmd_tex_rect(uint64_t *cmd_buf)
@@ -2182,7 +2188,8 @@ void n64_rdp::cmd_sync_tile(uint64_t *cmd_buf)
 
 void n64_rdp::cmd_sync_full(uint64_t *cmd_buf)
 {
-	//wait("SyncFull");
+	// everything must be in RDRAM before the CPU is told the RDP is done
+	flush_pipe("SyncFull");
 	m_n64_periphs->dp_full_sync();
 }
 
@@ -2207,7 +2214,7 @@ void n64_rdp::cmd_set_convert(uint64_t *cmd_buf)
 {
 	const uint64_t w1 = cmd_buf[0];
 
-	if(!m_pipe_clean) { m_pipe_clean = true; wait("SetConvert"); }
+	flush_pipe("SetConvert");
 	int32_t k0 = int32_t(w1 >> 45) & 0x1ff;
 	int32_t k1 = int32_t(w1 >> 36) & 0x1ff;
 	int32_t k2 = int32_t(w1 >> 27) & 0x1ff;
@@ -2288,7 +2295,6 @@ void n64_rdp::cmd_set_other_modes(uint64_t *cmd_buf)
 
 void n64_rdp::cmd_load_tlut(uint64_t *cmd_buf)
 {
-	//wait("LoadTLUT");
 	n64_tile_t* tile = m_tiles;
 	const uint64_t w1 = cmd_buf[0];
 
@@ -2298,6 +2304,8 @@ void n64_rdp::cmd_load_tlut(uint64_t *cmd_buf)
 	const int32_t sh = tile[tilenum].sh = int32_t(w1 >> 12) & 0xfff;
 	const int32_t th = tile[tilenum].th = int32_t(w1 >>  0) & 0xfff;
 
+	flush_if_rendered((th >> 2) + 1, (sh >> 2) + 1, "LoadTLUT");
+
 	if (tl != th)
 	{
 		fatalerror("Load tlut: tl=%d, th=%d\n",tl,th);
@@ -2360,7 +2368,6 @@ void n64_rdp::cmd_set_tile_size(uint64_t *cmd_buf)
 
 void n64_rdp::cmd_load_block(uint64_t *cmd_buf)
 {
-	//wait("LoadBlock");
 	n64_tile_t* tile = m_tiles;
 	const uint64_t w1 = cmd_buf[0];
 
@@ -2373,6 +2380,8 @@ void n64_rdp::cmd_load_block(uint64_t *cmd_buf)
 	tile[tilenum].sh =  sh = int32_t((w1 >> 12) & 0xfff);
 	tile[tilenum].th = dxt = int32_t((w1 >>  0) & 0xfff);
 
+	flush_if_rendered(tl + 1, sh + 1, "LoadBlock");
+
 	/*uint16_t tl_masked = tl & 0x3ff;
 
 	int32_t load_edge_walker_data[10] = {
@@ -2573,7 +2582,6 @@ void n64_rdp::cmd_load_block(uint64_t *cmd_buf)
 
 void n64_rdp::cmd_load_tile(uint64_t *cmd_buf)
 {
-	//wait("LoadTile");
 	n64_tile_t* tile = m_tiles;
 	const uint64_t w1 = cmd_buf[0];
 	const int32_t tilenum = int32_t(w1 >> 24) & 0x7;
@@ -2588,6 +2596,8 @@ void n64_rdp::cmd_load_tile(uint64_t *cmd_buf)
 	const int32_t sh = tile[tilenum].sh >> 2;
 	const int32_t th = tile[tilenum].th >> 2;
 
+	flush_if_rendered(th + 1, sh + 1, "LoadTile");
+
 	const int32_t width = (sh - sl) + 1;
 	const int32_t height = (th - tl) + 1;
 /*
@@ -2864,15 +2874,19 @@ void n64_rdp::cmd_set_texture_image(uint64_t *cmd_buf)
 
 void n64_rdp::cmd_set_mask_image(uint64_t *cmd_buf)
 {
-	//wait("SetMaskImage");
 	const uint64_t w1 = cmd_buf[0];
+	if ((uint32_t(w1) & 0x01ffffff) != m_misc_state.m_zb_address)
+		flush_pipe("SetMaskImage");
 	m_misc_state.m_zb_address = uint32_t(w1) & 0x01ffffff;
 }
 
 void n64_rdp::cmd_set_color_image(uint64_t *cmd_buf)
 {
-	//wait("SetColorImage");
+	// queued primitives for the same scanline are drawn in order, which only keeps
+	// their memory accesses in order while they all draw to the same images
 	const uint64_t w1 = cmd_buf[0];
+	if ((uint32_t(w1) & 0x01ffffff) != m_misc_state.m_fb_address || ((uint32_t(w1 >> 32) & 0x3ff) + 1) != m_misc_state.m_fb_width)
+		flush_pipe("SetColorImage");
 	m_misc_state.m_fb_format  = uint32_t(w1 >> 53) & 0x7;
 	m_misc_state.m_fb_size    = uint32_t(w1 >> 51) & 0x3;
 	m_misc_state.m_fb_width   = (uint32_t(w1 >> 32) & 0x3ff) + 1;
@@ -2881,6 +2895,34 @@ void n64_rdp::cmd_set_color_image(uint64_t *cmd_buf)
 
 /*****************************************************************************/
 
+// primitives are queued to the work queue as they're submitted, so consecutive
+// triangles and rectangles are drawn in parallel; this waits for them to finish
+// when something needs their results or would change what they use
+void n64_rdp::flush_pipe(const char *reason)
+{
+	if (!m_pipe_clean)
+	{
+		m_pipe_clean = true;
+		wait(reason);
+	}
+	m_aux_buf_ptr = 0;  // Spans can be reused once render completes
+	m_batch_count = 0;
+	m_pending_start = ~uint32_t(0);
+	m_pending_end = 0;
+}
+
+// wait for queued primitives if a texture load may read what they draw
+void n64_rdp::flush_if_rendered(int32_t rows, int32_t texels, const char *reason)
+{
+	if (m_pipe_clean)
+		return;
+
+	const uint32_t start = m_misc_state.m_ti_address;
+	const uint32_t end = start + ((rows * (m_misc_state.m_ti_width << m_misc_state.m_ti_size)) >> 1) + ((texels << m_misc_state.m_ti_size) >> 1) + 8;
+	if (start < m_pending_end && end > m_pending_start)
+		flush_pipe(reason);
+}
+
 void n64_rdp::cmd_noop(uint64_t *cmd_buf)
 {
 	// Do nothing
@@ -2999,6 +3041,9 @@ n64_rdp::n64_rdp(n64_state &state, uint32_t* rdram, uint32_t* dmem) : poly_manag
 	m_aux_buf_ptr = 0;
 	m_aux_buf = nullptr;
 	m_pipe_clean = true;
+	m_batch_count = 0;
+	m_pending_start = ~uint32_t(0);
+	m_pending_end = 0;
 
 	m_pending_mode_block = false;
 
@@ -3143,7 +3188,19 @@ void n64_rdp::render_spans(int32_t start, int32_t end, int32_t tilenum, bool fli
 			render_extents<8>(clip, render_delegate(&n64_rdp::span_draw_fill, this), start, (end - start) + 1, spans + offset);
 			break;
 	}
-	wait("render spans");
+
+	// note what the queued primitive may write, for texture loads to check against
+	const uint32_t fb_row = (m_misc_state.m_fb_width << m_misc_state.m_fb_size) >> 1;
+	m_pending_start = std::min(m_pending_start, m_misc_state.m_fb_address + (start * fb_row));
+	m_pending_end = std::max(m_pending_end, m_misc_state.m_fb_address + ((end + 1) * fb_row));
+	if (m_other_modes.z_update_en)
+	{
+		const uint32_t zb_row = m_misc_state.m_fb_width << 1;
+		m_pending_start = std::min(m_pending_start, m_misc_state.m_zb_address + (start * zb_row));
+		m_pending_end = std::max(m_pending_end, m_misc_state.m_zb_address + ((end + 1) * zb_row));
+	}
+	m_pipe_clean = false;
+	m_batch_count++;
 }
 
 void n64_rdp::rgbaz_clip(int32_t sr, int32_t sg, int32_t sb, int32_t sa, int32_t* sz, rdp_span_aux* userdata)
@@ -117,6 +117,7 @@
 #define SPAN_Z      (7)
 
 #define EXTENT_AUX_COUNT            (sizeof(rdp_span_aux)*(480*192)) // Screen coverage *192, more or less
+#define MAX_BATCHED_PRIMITIVES      (1024) // Primitives queued to the work queue before waiting for them
 
 /*****************************************************************************/
 
@@ -162,6 +163,7 @@ public:
 	}
 
 	void        process_command_list();
+	void        flush_pipe(const char *reason);
 	uint64_t    read_data(uint32_t address);
 	std::string disassemble(const uint64_t *cmd_buf);
 
@@ -214,6 +216,7 @@ public:
 	void            tc_div_no_perspective(int32_t ss, int32_t st, int32_t sw, int32_t* sss, int32_t* sst);
 	uint32_t          get_log2(uint32_t lod_clamp);
 	void            render_spans(int32_t start, int32_t end, int32_t tilenum, bool flip, extent_t* spans, bool rect, rdp_poly_state* object);
+	void            flush_if_rendered(int32_t rows, int32_t texels, const char *reason);
 	int32_t           get_alpha_cvg(int32_t comb_alpha, rdp_span_aux* userdata, const rdp_poly_state &object);
 
 	void            z_store(const rdp_poly_state &object, uint32_t zcurpixel, uint32_t dzcurpixel, uint32_t z, uint32_t enc);
@@ -353,6 +356,9 @@ private:
 	combine_modes_t m_combine;
 	bool            m_pending_mode_block;
 	bool            m_pipe_clean;
+	uint32_t        m_batch_count;          // primitives queued since the pipe was last clean
+	uint32_t        m_pending_start;        // lowest RDRAM address queued primitives may write
+	uint32_t        m_pending_end;          // and the end of the range
 
 	cv_mask_derivative_t cvarray[(1 << 8)];
 
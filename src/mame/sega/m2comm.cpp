@@ -195,23 +195,10 @@ void m2comm_device::device_add_mconfig(machine_config &config)
 //-------------------------------------------------
 
 m2comm_device::m2comm_device(const machine_config &mconfig, const char *tag, device_t *owner, uint32_t clock) :
-	device_t(mconfig, M2COMM, tag, owner, clock)
+	device_t(mconfig, M2COMM, tag, owner, clock),
+	m_link(mconfig.options(), "M2COMM")
 {
-	// prepare localhost "filename"
-	m_localhost[0] = 0;
-	strcat(m_localhost, "socket.");
-	strcat(m_localhost, mconfig.options().comm_localhost());
-	strcat(m_localhost, ":");
-	strcat(m_localhost, mconfig.options().comm_localport());
-
-	// prepare remotehost "filename"
-	m_remotehost[0] = 0;
-	strcat(m_remotehost, "socket.");
-	strcat(m_remotehost, mconfig.options().comm_remotehost());
-	strcat(m_remotehost, ":");
-	strcat(m_remotehost, mconfig.options().comm_remoteport());
-
-	m_framesync = mconfig.options().comm_framesync() ? 0x01 : 0x00;
+	m_framesync = m_link.framesync() ? 0x01 : 0x00;
 
 	m_frameoffset = 0x1c0; // default
 }
@@ -369,24 +356,8 @@ void m2comm_device::comm_tick()
 			m_shared[2] = 0xff;
 			m_shared[3] = 0xff;
 
-			// check rx socket
-			if (!m_line_rx)
-			{
-				osd_printf_verbose("M2COMM: listen on %s\n", m_localhost);
-				uint64_t filesize; // unused
-				osd_file::open(m_localhost, OPEN_FLAG_CREATE, m_line_rx, filesize);
-			}
-
-			// check tx socket
-			if (!m_line_tx)
-			{
-				osd_printf_verbose("M2COMM: connect to %s\n", m_remotehost);
-				uint64_t filesize; // unused
-				osd_file::open(m_remotehost, 0, m_line_tx, filesize);
-			}
-
 			// if both sockets are there check ring
-			if (m_line_rx && m_line_tx)
+			if (m_link.connect())
 			{
 				m_zfg ^= 0x01;
 
@@ -627,48 +598,18 @@ void m2comm_device::read_fg()
 
 int m2comm_device::read_frame(int dataSize)
 {
-	if (!m_line_rx)
-		return 0;
-
 	// try to read a message
-	std::uint32_t recv = 0;
-	std::error_condition filerr = m_line_rx->read(m_buffer0, 0, dataSize, recv);
-	if (recv > 0)
-	{
-		// check if message complete
-		if (recv != dataSize)
-		{
-			// only part of a message - read on
-			std::uint32_t togo = dataSize - recv;
-			int offset = recv;
-			while (togo > 0)
-			{
-				filerr = m_line_rx->read(m_buffer1, 0, togo, recv);
-				if (recv > 0)
-				{
-					for (int i = 0 ; i < recv ; i++)
-					{
-						m_buffer0[offset + i] = m_buffer1[i];
-					}
-					togo -= recv;
-					offset += recv;
-				}
-				else if (!filerr && recv == 0)
-				{
-					togo = 0;
-				}
-			}
-		}
-	}
-	else if (!filerr && recv == 0)
+	int const recv = m_link.read(m_buffer0, dataSize);
+	if (recv < 0)
 	{
 		if (m_linkalive == 0x01)
 		{
 			osd_printf_verbose("M2COMM: rx connection lost\n");
 			m_linkalive = 0x02;
 			m_linktimer = 0x00;
-			m_line_rx.reset();
+			m_link.close_rx();
 		}
+		return 0;
 	}
 	return recv;
 }
@@ -683,22 +624,16 @@ void m2comm_device::send_data(uint8_t frameType, int frameStart, int frameSize,
 	send_frame(dataSize);
 }
 
-void m2comm_device::send_frame(int dataSize){
-	if (!m_line_tx)
-		return;
-
-	std::error_condition filerr;
-	std::uint32_t written;
-
-	filerr = m_line_tx->write(&m_buffer0, 0, dataSize, written);
-	if (filerr)
+void m2comm_device::send_frame(int dataSize)
+{
+	if (!m_link.write(m_buffer0, dataSize))
 	{
 		if (m_linkalive == 0x01)
 		{
 			osd_printf_verbose("M2COMM: tx connection lost\n");
 			m_linkalive = 0x02;
 			m_linktimer = 0x00;
-			m_line_tx.reset();
+			m_link.close_tx();
 		}
 	}
 }
@@ -607,6 +607,7 @@ struct m2_poly_extra_data
 	u32      texx, texy;
 	u8       texmirrorx;
 	u8       texmirrory;
+	u32      texpens[16];   // final colour for each texel value
 };
 
 
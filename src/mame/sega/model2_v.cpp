@@ -796,6 +796,31 @@ void model2_renderer::model2_3d_render(triangle *tri, const rectangle &cliprect)
 		extra.texmirrory = 0;//(tri->texheader[0] >> 8) & 1;
 		extra.texsheet = (tri->texheader[2] & 0x1000) ? m_state.m_textureram1 : m_state.m_textureram0;
 
+		/* a texel only selects one of 16 luma values, so look up the final colours once per polygon */
+		/* rather than for every pixel drawn */
+		u32 const colorbase = m_state.m_palram[(extra.colorbase + 0x1000)] & 0x7fff;
+		const u16 *colortable_r = &m_state.m_colorxlat[(0x0000/2) + (((colorbase >>  0) & 0x1f) << 8)];
+		const u16 *colortable_g = &m_state.m_colorxlat[(0x4000/2) + (((colorbase >>  5) & 0x1f) << 8)];
+		const u16 *colortable_b = &m_state.m_colorxlat[(0x8000/2) + (((colorbase >> 10) & 0x1f) << 8)];
+		const u8 *gamma_value = &m_state.m_gamma_table[0];
+		for (int t = 0; t < 16; t++)
+		{
+			u8 luma = m_state.m_lumaram[(extra.lumabase + (t << 3))];
+
+			// Virtua Striker sets up a luma of 0x40 for national flags on bleachers, fix here.
+			luma = std::min((int)luma,0x3f);
+			// (Again) Virtua Striker seem to lookup colortable with a reversed endianness (stadium ads)
+			// TODO: it breaks Mexican flag colors tho ...
+//          luma^= 1;
+
+			/* we have the 6 bits of luma information along with 5 bits per color component */
+			/* now build and index into the master color lookup table and extract the raw RGB values */
+			extra.texpens[t] = rgb_t(
+					gamma_value[colortable_r[luma] & 0xff],
+					gamma_value[colortable_g[luma] & 0xff],
+					gamma_value[colortable_b[luma] & 0xff]);
+		}
+
 		tri->v[0].pz = 1.0f / (1.0f + tri->v[0].pz);
 		tri->v[0].pu = tri->v[0].pu * tri->v[0].pz * (1.0f / 8.0f);
 		tri->v[0].pv = tri->v[0].pv * tri->v[0].pz * (1.0f / 8.0f);
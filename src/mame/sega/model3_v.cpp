@@ -1495,6 +1495,8 @@ void model3_state::draw_model(uint32_t addr)
 	float fixed_point_fraction;
 	m3_vertex vertex[4];
 	m3_vertex prev_vertex[4];
+	VECTOR vertex_p[4], prev_vertex_p[4];       // positions in projection space
+	VECTOR3 vertex_n[4], prev_vertex_n[4];      // normals in view space
 	m3_clip_vertex clip_vert[10];
 
 	MATRIX transform_matrix;
@@ -1518,7 +1520,36 @@ void model3_state::draw_model(uint32_t addr)
 	matrix_multiply(transform_matrix, coord_matrix, &transform_matrix);
 	matrix_multiply(transform_matrix, m_projection_matrix, &vp_matrix);
 
+	// polygons share vertices with the one before, so transform each vertex
+	// once when it's loaded and carry the result along with it
+	auto const transform_vertex =
+		[&vp_matrix, &transform_matrix] (const m3_vertex &vtx, VECTOR &p, VECTOR3 &n)
+		{
+			VECTOR vect;
+
+			vect[0] = vtx.x;
+			vect[1] = vtx.y;
+			vect[2] = vtx.z;
+			vect[3] = 1.0f;
+
+			// transform to projection space
+			matrix_multiply_vector(vp_matrix, vect, &p);
+
+			// transform vertex normal
+			n[0] = (vtx.nx * transform_matrix[0][0]) +
+					(vtx.ny * transform_matrix[0][1]) +
+					(vtx.nz * transform_matrix[0][2]);
+			n[1] = (vtx.nx * transform_matrix[1][0]) +
+					(vtx.ny * transform_matrix[1][1]) +
+					(vtx.nz * transform_matrix[1][2]);
+			n[2] = (vtx.nx * transform_matrix[2][0]) +
+					(vtx.ny * transform_matrix[2][1]) +
+					(vtx.nz * transform_matrix[2][2]);
+		};
+
 	memset(prev_vertex, 0, sizeof(prev_vertex));
+	for (v = 0; v < 4; v++)
+		transform_vertex(prev_vertex[v], prev_vertex_p[v], prev_vertex_n[v]);
 
 	while (!last_polygon)
 	{
@@ -1526,7 +1557,6 @@ void model3_state::draw_model(uint32_t addr)
 		uint32_t color;
 		VECTOR3 normal;
 		VECTOR3 sn;
-		VECTOR p[4];
 		int polygon_transparency;
 
 		for (i = 0; i < 7; i++)
@@ -1559,7 +1589,12 @@ void model3_state::draw_model(uint32_t addr)
 		vi = 0;
 		for (v = 0; v < 4; v++)
 			if (header[0] & (1 << v))
-				vertex[vi++] = prev_vertex[v];
+			{
+				vertex[vi] = prev_vertex[v];
+				memcpy(vertex_p[vi], prev_vertex_p[v], sizeof(VECTOR));
+				memcpy(vertex_n[vi], prev_vertex_n[v], sizeof(VECTOR3));
+				vi++;
+			}
 
 		/* load new vertices */
 		for ( ; vi < num_vertices; vi++)
@@ -1580,10 +1615,14 @@ void model3_state::draw_model(uint32_t addr)
 			vertex[vi].nx = ((float)((int8_t)(xw)) / 127.0f);
 			vertex[vi].ny = ((float)((int8_t)(yw)) / 127.0f);
 			vertex[vi].nz = ((float)((int8_t)(zw)) / 127.0f);
+
+			transform_vertex(vertex[vi], vertex_p[vi], vertex_n[vi]);
 		}
 
 		/* Copy current vertices as previous vertices */
 		memcpy(prev_vertex, vertex, sizeof(m3_vertex) * 4);
+		memcpy(prev_vertex_p, vertex_p, sizeof(vertex_p));
+		memcpy(prev_vertex_n, vertex_n, sizeof(vertex_n));
 
 		if (header[1] & 0x2)
 		{
@@ -1612,41 +1651,19 @@ void model3_state::draw_model(uint32_t addr)
 		// transform and light vertices
 		for (i = 0; i < num_vertices; i++)
 		{
-			VECTOR vect;
-
-			vect[0] = vertex[i].x;
-			vect[1] = vertex[i].y;
-			vect[2] = vertex[i].z;
-			vect[3] = 1.0f;
-
-			// transform to projection space
-			matrix_multiply_vector(vp_matrix, vect, &p[i]);
-
-			clip_vert[i].x = p[i][0];
-			clip_vert[i].y = p[i][1];
-			clip_vert[i].z = p[i][2];
-			clip_vert[i].w = p[i][3];
+			clip_vert[i].x = vertex_p[i][0];
+			clip_vert[i].y = vertex_p[i][1];
+			clip_vert[i].z = vertex_p[i][2];
+			clip_vert[i].w = vertex_p[i][3];
 
 			clip_vert[i].p[0] = vertex[i].u * texture_coord_scale * 256.0f;        // 8 bits of subtexel accuracy for bilinear filtering
 			clip_vert[i].p[1] = vertex[i].v * texture_coord_scale * 256.0f;
 
-			// transform vertex normal
-			VECTOR3 n;
-			n[0] = (vertex[i].nx * transform_matrix[0][0]) +
-					(vertex[i].ny * transform_matrix[0][1]) +
-					(vertex[i].nz * transform_matrix[0][2]);
-			n[1] = (vertex[i].nx * transform_matrix[1][0]) +
-					(vertex[i].ny * transform_matrix[1][1]) +
-					(vertex[i].nz * transform_matrix[1][2]);
-			n[2] = (vertex[i].nx * transform_matrix[2][0]) +
-					(vertex[i].ny * transform_matrix[2][1]) +
-					(vertex[i].nz * transform_matrix[2][2]);
-
 			// lighting
 			float intensity;
 			if ((header[6] & 0x10000) == 0)
 			{
-				float dot = dot_product3(n, m_parallel_light);
+				float dot = dot_product3(vertex_n[i], m_parallel_light);
 
 				if (header[1] & 0x10)
 					dot = fabs(dot);
@@ -1007,9 +1007,7 @@ void naomi_gdrom_board::device_start()
 				memset(&dimm_data[file_rounded_size], 0, dimm_data_size - file_rounded_size);
 
 			// read encrypted data into dimm_des_data
-			uint32_t sectors = file_rounded_size / 2048;
-			for (uint32_t sec = 0; sec != sectors; sec++)
-				gdromfile->read_data(file_start + sec, &dimm_des_data[2048 * sec], cdrom_file::CD_TRACK_MODE1);
+			gdromfile->read_sectors(file_start, file_rounded_size / 2048, &dimm_des_data[0], cdrom_file::CD_TRACK_MODE1);
 
 			uint32_t des_subkeys[32];
 			des_generate_subkeys(swapendian_int64(key), des_subkeys);
@@ -2448,8 +2448,13 @@ inline void powervr2_device::render_hline(bitmap_rgb32 &bitmap, texinfo *ti, int
 	while(xxl < xxr) {
 		if((wl >= *wbufline)) {
 			uint32_t c;
-			float u = ul/wl;
-			float v = vl/wl;
+			float u = 0.0f, v = 0.0f;
+			if (sample_fn != &powervr2_device::sample_nontextured) {
+				// one divide for both texture coordinates
+				float const rw = 1.0f / wl;
+				u = ul * rw;
+				v = vl * rw;
+			}
 			uint32_t offset_color = float_argb_to_packed_argb(offl);
 			uint32_t base_color = float_argb_to_packed_argb(bl);
 			c = (this->*sample_fn)(ti, u, v, offset_color, base_color);
@@ -383,6 +383,14 @@ protected:
 		int layer_name = 0; /* just to keep track */
 	} stv2_current_tilemap;
 
+	// window coordinates only depend on the registers and the line, so they're
+	// worked out once per line rather than for every pixel of every layer
+	struct
+	{
+		int y = -1; /* line the coordinates belong to, -1 when stale */
+		int s_x[2]{}, e_x[2]{}, s_y[2]{}, e_y[2]{};
+	} stv_vdp2_window_cache;
+
 	struct rotation_table
 	{
 		int32_t   xst = 0;
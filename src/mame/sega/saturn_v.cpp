@@ -8736,18 +8736,24 @@ int saturn_state::get_window_pixel(int s_x,int e_x,int s_y,int e_y,int x, int y,
 
 inline int saturn_state::stv_vdp2_window_process(int x,int y)
 {
-	int s_x=0,e_x=0,s_y=0,e_y=0;
+	auto &wc = stv_vdp2_window_cache;
 	int w0_pix, w1_pix;
 
 	if (stv2_current_tilemap.window_control.enabled[0] == 0 &&
 		stv2_current_tilemap.window_control.enabled[1] == 0)
 		return 1;
 
-	stv_vdp2_get_window0_coordinates(&s_x, &e_x, &s_y, &e_y, y);
-	w0_pix = get_window_pixel(s_x,e_x,s_y,e_y,x,y,0);
+	if (wc.y != y)
+	{
+		wc.s_x[0] = wc.e_x[0] = wc.s_y[0] = wc.e_y[0] = 0;
+		wc.s_x[1] = wc.e_x[1] = wc.s_y[1] = wc.e_y[1] = 0;
+		stv_vdp2_get_window0_coordinates(&wc.s_x[0], &wc.e_x[0], &wc.s_y[0], &wc.e_y[0], y);
+		stv_vdp2_get_window1_coordinates(&wc.s_x[1], &wc.e_x[1], &wc.s_y[1], &wc.e_y[1], y);
+		wc.y = y;
+	}
 
-	stv_vdp2_get_window1_coordinates(&s_x, &e_x, &s_y, &e_y, y);
-	w1_pix = get_window_pixel(s_x,e_x,s_y,e_y,x,y,1);
+	w0_pix = get_window_pixel(wc.s_x[0],wc.e_x[0],wc.s_y[0],wc.e_y[0],x,y,0);
+	w1_pix = get_window_pixel(wc.s_x[1],wc.e_x[1],wc.s_y[1],wc.e_y[1],x,y,1);
 
 	return stv2_current_tilemap.window_control.logic & 1 ? (w0_pix | w1_pix) : (w0_pix & w1_pix);
 }
@@ -9322,6 +9328,9 @@ uint32_t saturn_state::screen_update_stv_vdp2(screen_device &screen, bitmap_rgb3
 {
 	stv_vdp2_fade_effects();
 
+	/* registers and line window tables may have changed since the last update */
+	stv_vdp2_window_cache.y = -1;
+
 	stv_vdp2_draw_back(m_tmpbitmap,cliprect);
 
 	if(STV_VDP2_DISP)
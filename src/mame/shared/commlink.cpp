@@ -0,0 +1,123 @@
+// license:BSD-3-Clause
+// copyright-holders:Ariane Fugmann
+/***************************************************************************
+
+    commlink.cpp
+
+    Host transport for emulated arcade cabinet link boards.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "commlink.h"
+
+#include "emuopts.h"
+
+
+//-------------------------------------------------
+//  comm_link - constructor
+//-------------------------------------------------
+
+comm_link::comm_link(emu_options const &options, char const *name)
+	: m_name(name)
+	, m_localhost(make_endpoint(options.comm_localhost(), options.comm_localport()))
+	, m_remotehost(make_endpoint(options.comm_remotehost(), options.comm_remoteport()))
+	, m_framesync(options.comm_framesync())
+{
+}
+
+
+//-------------------------------------------------
+//  connect - open any lines that aren't open yet
+//-------------------------------------------------
+
+bool comm_link::connect()
+{
+	// check rx socket
+	if (!m_line_rx)
+	{
+		osd_printf_verbose("%s: listen on %s\n", m_name, m_localhost);
+		uint64_t filesize; // unused
+		osd_file::open(m_localhost, OPEN_FLAG_CREATE, m_line_rx, filesize);
+	}
+
+	// check tx socket
+	if (!m_line_tx)
+	{
+		osd_printf_verbose("%s: connect to %s\n", m_name, m_remotehost);
+		uint64_t filesize; // unused
+		osd_file::open(m_remotehost, 0, m_line_tx, filesize);
+	}
+
+	return connected();
+}
+
+
+//-------------------------------------------------
+//  close - close both lines
+//-------------------------------------------------
+
+void comm_link::close()
+{
+	m_line_rx.reset();
+	m_line_tx.reset();
+}
+
+
+//-------------------------------------------------
+//  read - read a whole frame if one is waiting
+//-------------------------------------------------
+
+int comm_link::read(void *buffer, u32 length)
+{
+	if (!m_line_rx)
+		return 0;
+
+	// try to read a message
+	u8 *const dest = reinterpret_cast<u8 *>(buffer);
+	u32 recv = 0;
+	std::error_condition filerr = m_line_rx->read(dest, 0, length, recv);
+	if (!recv)
+		return filerr ? 0 : -1;
+
+	// only part of a message - the rest is on its way, so read on
+	u32 offset = recv;
+	while (length > offset)
+	{
+		filerr = m_line_rx->read(dest + offset, 0, length - offset, recv);
+		if (recv)
+			offset += recv;
+		else if (!filerr)
+			return -1;
+	}
+	return length;
+}
+
+
+//-------------------------------------------------
+//  write - send a whole frame
+//-------------------------------------------------
+
+bool comm_link::write(void const *buffer, u32 length)
+{
+	if (!m_line_tx)
+		return false;
+
+	u32 written;
+	std::error_condition const filerr = m_line_tx->write(buffer, 0, length, written);
+	return !filerr;
+}
+
+
+//-------------------------------------------------
+//  make_endpoint - get an OSD file name for an
+//  endpoint
+//-------------------------------------------------
+
+std::string comm_link::make_endpoint(char const *host, char const *port)
+{
+	if ('/' == host[0])
+		return util::string_format("domain.%s.%s", host, port);
+	else
+		return util::string_format("socket.%s:%s", host, port);
+}
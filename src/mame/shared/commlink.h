@@ -0,0 +1,70 @@
+// license:BSD-3-Clause
+// copyright-holders:Ariane Fugmann
+/***************************************************************************
+
+    commlink.h
+
+    Host transport for emulated arcade cabinet link boards.
+
+***************************************************************************/
+
+#ifndef MAME_SHARED_COMMLINK_H
+#define MAME_SHARED_COMMLINK_H
+
+#pragma once
+
+#include "osdfile.h"
+
+#include <string>
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// ======================> comm_link
+
+// A pair of byte streams joining this instance to the next one in a ring:
+// frames are received from the previous node on the local endpoint and sent
+// to the next node on the remote endpoint.  Endpoints come from the
+// -comm_localhost/-comm_localport and -comm_remotehost/-comm_remoteport
+// options.  A host beginning with '/' names a Unix domain socket (the port
+// is appended to the path), which avoids the TCP stack for instances on
+// the same host.
+class comm_link
+{
+public:
+	// construction/destruction
+	comm_link(emu_options const &options, char const *name);
+
+	// getters
+	bool connected() const { return m_line_rx && m_line_tx; }
+	bool framesync() const { return m_framesync; }
+	char const *local() const { return m_localhost.c_str(); }
+	char const *remote() const { return m_remotehost.c_str(); }
+
+	// try to open whichever lines aren't open yet, returning true if both are
+	bool connect();
+	void close();
+	void close_rx() { m_line_rx.reset(); }
+	void close_tx() { m_line_tx.reset(); }
+
+	// read a whole frame: returns its length, 0 if none is waiting, or -1
+	// if the previous node has closed the connection
+	int read(void *buffer, u32 length);
+
+	// send a whole frame, returning false on error
+	bool write(void const *buffer, u32 length);
+
+private:
+	static std::string make_endpoint(char const *host, char const *port);
+
+	char const *    m_name;         // name for log messages
+	std::string     m_localhost;    // endpoint we listen on
+	std::string     m_remotehost;   // endpoint we connect to
+	bool            m_framesync;    // wait for the master's vsync frame each frame
+	osd_file::ptr   m_line_rx;      // rx line - can be either differential, simple serial or toslink
+	osd_file::ptr   m_line_tx;      // tx line - is differential, simple serial and toslink
+};
+
+#endif // MAME_SHARED_COMMLINK_H
@@ -186,6 +186,12 @@ void mac_osd_interface::extract_video_config()
 		osd_printf_warning("-syncrefresh specified without -waitvsync. Reverting to -nosyncrefresh\n");
 		video_config.syncrefresh = 0;
 	}
+	video_config.vrr           = options().vrr();
+	if (video_config.vrr && video_config.syncrefresh)
+	{
+		osd_printf_warning("-syncrefresh specified with -vrr. Reverting to -nosyncrefresh\n");
+		video_config.syncrefresh = 0;
+	}
 
 	if (video_config.prescale < 1 || video_config.prescale > 8)
 	{
@@ -20,7 +20,9 @@
 
 #include "fileio.h"
 
+#include <algorithm>
 #include <cinttypes>
+#include <string_view>
 
 
 namespace osd {
@@ -507,6 +509,7 @@ public:
 		m_extended_mode(false),
 		m_send_stop_packet(false),
 		m_target_xml_sent(false),
+		m_cur_thread(0),
 		m_triggered_breakpoint(nullptr),
 		m_triggered_watchpoint(nullptr),
 		m_readbuf_len(0),
@@ -534,6 +537,12 @@ public:
 	void set_register_value(int gdb_regnum, uint64_t value);
 
 	bool is_thread_id_ok(const char *buf);
+	int parse_thread_id(const char *buf, const char **end = nullptr);
+	void select_thread(int index);
+	device_debug *current_debug() const { return m_threads[m_cur_thread]->debug(); }
+
+	bool read_memory(uint64_t address, uint64_t length, std::vector<uint8_t> &data);
+	bool decode_binary(std::vector<uint8_t> &data, const char *buf, const char *end);
 
 	void handle_character(char ch);
 	void send_nack();
@@ -565,6 +574,9 @@ public:
 	cmd_reply handle_q(const char *buf);
 	cmd_reply handle_s(const char *buf);
 	cmd_reply handle_T(const char *buf);
+	cmd_reply handle_v(const char *buf);
+	cmd_reply handle_x(const char *buf);
+	cmd_reply handle_X(const char *buf);
 	cmd_reply handle_z(const char *buf);
 	cmd_reply handle_Z(const char *buf);
 
@@ -579,10 +591,11 @@ public:
 	readbuf_state m_readbuf_state;
 
 	void generate_target_xml();
+	void generate_memory_map_xml();
 
 	int readchar();
 
-	void send_reply(const char *str);
+	void send_reply(std::string_view str);
 	void send_stop_packet();
 
 private:
@@ -602,6 +615,10 @@ private:
 	bool m_send_stop_packet;
 	bool m_target_xml_sent;     // the 'g', 'G', 'p', and 'P' commands only work once target.xml has been sent
 
+	// each CPU of the same type as the main CPU is presented as a thread
+	std::vector<device_t *> m_threads;
+	int m_cur_thread;
+
 	struct gdb_register
 	{
 		std::string gdb_name;
@@ -621,6 +638,7 @@ private:
 	debug_watchpoint *m_triggered_watchpoint;
 
 	std::string m_target_xml;
+	std::string m_memory_map_xml;
 
 	uint8_t  m_readbuf[512];
 	uint32_t m_readbuf_len;
@@ -671,13 +689,13 @@ int debug_gdbstub::readchar()
 }
 
 //-------------------------------------------------------------------------
-static std::string escape_packet(const std::string src)
+static std::string escape_packet(std::string_view src)
 {
 	std::string result;
 	result.reserve(src.length());
 	for ( char ch: src )
 	{
-		if ( ch == '#' || ch == '$' || ch == '}' )
+		if ( ch == '#' || ch == '$' || ch == '}' || ch == '*' )
 		{
 			result += '}';
 			ch ^= 0x20;
@@ -687,6 +705,30 @@ static std::string escape_packet(const std::string src)
 	return result;
 }
 
+//-------------------------------------------------------------------------
+static void hex_encode(std::string &dest, const std::vector<uint8_t> &data)
+{
+	static const char digits[] = "0123456789abcdef";
+	dest.reserve(dest.length() + data.size() * 2);
+	for ( uint8_t value: data )
+	{
+		dest += digits[value >> 4];
+		dest += digits[value & 0x0f];
+	}
+}
+
+//-------------------------------------------------------------------------
+static int hex_nibble(char ch)
+{
+	if ( ch >= '0' && ch <= '9' )
+		return ch - '0';
+	if ( ch >= 'a' && ch <= 'f' )
+		return ch - 'a' + 10;
+	if ( ch >= 'A' && ch <= 'F' )
+		return ch - 'A' + 10;
+	return -1;
+}
+
 //-------------------------------------------------------------------------
 void debug_gdbstub::generate_target_xml()
 {
@@ -705,6 +747,67 @@ void debug_gdbstub::generate_target_xml()
 	m_target_xml = escape_packet(target_xml);
 }
 
+//-------------------------------------------------------------------------
+void debug_gdbstub::generate_memory_map_xml()
+{
+	// Describe the program space as it is mapped, merging adjacent ranges
+	// of the same type.  Ranges that can't be written are reported as ROM
+	// so the client knows not to patch software breakpoints into them.
+	std::vector<memory_entry> read_map, write_map;
+	m_address_space->dump_maps(read_map, write_map);
+
+	auto is_mapped = [] (const handler_entry *entry)
+	{
+		return !(entry->flags() & handler_entry::F_UNMAP) && entry->name() != "nop";
+	};
+	auto is_writable = [&write_map, &is_mapped] (offs_t address)
+	{
+		auto found = std::find_if(write_map.begin(), write_map.end(), [address] (const memory_entry &e) { return e.start <= address && e.end >= address; });
+		return found != write_map.end() && is_mapped(found->entry);
+	};
+
+	std::string memory_map;
+	memory_map += "<?xml version=\"1.0\"?>\n";
+	memory_map += "<!DOCTYPE memory-map PUBLIC \"+//IDN gnu.org//DTD GDB Memory Map V1.0//EN\" \"http://sourceware.org/gdb/gdb-memory-map.dtd\">\n";
+	memory_map += "<memory-map>\n";
+	bool have_range = false;
+	bool range_writable = false;
+	offs_t range_start = 0;
+	offs_t range_end = 0;
+	auto flush_range = [&] ()
+	{
+		if ( have_range )
+		{
+			uint64_t start = m_address_space->address_to_byte(range_start);
+			uint64_t length = uint64_t(m_address_space->address_to_byte_end(range_end)) - start + 1;
+			memory_map += string_format("  <memory type=\"%s\" start=\"0x%x\" length=\"0x%x\"/>\n", range_writable ? "ram" : "rom", start, length);
+		}
+		have_range = false;
+	};
+	for ( const memory_entry &entry: read_map )
+	{
+		if ( !is_mapped(entry.entry) )
+		{
+			flush_range();
+			continue;
+		}
+		bool writable = is_writable(entry.start);
+		if ( have_range && range_writable == writable && range_end + 1 == entry.start )
+		{
+			range_end = entry.end;
+			continue;
+		}
+		flush_range();
+		have_range = true;
+		range_writable = writable;
+		range_start = entry.start;
+		range_end = entry.end;
+	}
+	flush_range();
+	memory_map += "</memory-map>\n";
+	m_memory_map_xml = escape_packet(memory_map);
+}
+
 //-------------------------------------------------------------------------
 void debug_gdbstub::wait_for_debugger(device_t &device, bool firststop)
 {
@@ -723,10 +826,11 @@ void debug_gdbstub::wait_for_debugger(device_t &device, bool firststop)
 		if ( it == gdb_register_maps.end() )
 			fatalerror("gdbstub: cpuname %s not found in gdb stub descriptions\n", cpuname);
 
-		m_maincpu->interface(m_state);
-		assert(m_state != nullptr);
-		m_memory = &m_maincpu->memory();
-		m_address_space = &m_memory->space(AS_PROGRAM);
+		// other CPUs can share the register description if they're the same type
+		for ( cpu_device &cpu: device_interface_enumerator<cpu_device>(m_machine->root_device()) )
+			if ( &cpu == m_maincpu || strcmp(cpu.shortname(), cpuname) == 0 )
+				m_threads.push_back(&cpu);
+		select_thread(0);
 		m_debugger_cpu = &m_machine->debugger().cpu();
 		m_debugger_console = &m_machine->debugger().console();
 
@@ -792,7 +896,11 @@ void debug_gdbstub::wait_for_debugger(device_t &device, bool firststop)
 	}
 	else
 	{
-		device_debug *debug = m_debugger_console->get_visible_cpu()->debug();
+		// report the stop on the thread that stopped
+		auto found = std::find(m_threads.begin(), m_threads.end(), &device);
+		if ( found != m_threads.end() )
+			select_thread(found - m_threads.begin());
+		device_debug *debug = device.debug();
 		m_triggered_watchpoint = debug->triggered_watchpoint();
 		m_triggered_breakpoint = debug->triggered_breakpoint();
 		if ( m_send_stop_packet )
@@ -842,15 +950,18 @@ void debug_gdbstub::send_ack()
 }
 
 //-------------------------------------------------------------------------
-void debug_gdbstub::send_reply(const char *str)
+void debug_gdbstub::send_reply(std::string_view str)
 {
-	size_t length = strlen(str);
-
+	// replies to binary packets may contain NUL characters
 	uint8_t checksum = 0;
-	for ( size_t i = 0; i < length; i++ )
-		checksum += str[i];
+	for ( char ch: str )
+		checksum += ch;
 
-	std::string reply = string_format("$%s#%02x", str, checksum);
+	std::string reply;
+	reply.reserve(str.length() + 4);
+	reply += '$';
+	reply += str;
+	reply += string_format("#%02x", checksum);
 	m_socket.puts(reply);
 }
 
@@ -936,9 +1047,15 @@ debug_gdbstub::cmd_reply debug_gdbstub::handle_G(const char *buf)
 // Set thread for subsequent operations.
 debug_gdbstub::cmd_reply debug_gdbstub::handle_H(const char *buf)
 {
-	// accept threads 'any', 1, and 'all'
+	// accept threads 'any', 'all', and the CPUs we reported
 	if ( (buf[0] == 'c' || buf[0] == 'g') && is_thread_id_ok(buf + 1) )
+	{
+		// registers and memory are accessed on the selected thread
+		int thread = parse_thread_id(buf + 1);
+		if ( buf[0] == 'g' && thread > 0 )
+			select_thread(thread - 1);
 		return REPLY_OK;
+	}
 	// otherwise silently ignore
 	return REPLY_UNSUPPORTED;
 }
@@ -963,24 +1080,60 @@ debug_gdbstub::cmd_reply debug_gdbstub::handle_m(const char *buf)
 	if ( sscanf(buf, "%" PRIx64 ",%" PRIx64, &address, &length) != 2 )
 		return REPLY_ENN;
 
+	// The reply may be shorter than requested, so limit it to what fits
+	// in a packet rather than refusing large reads.
+	length = std::min<uint64_t>(length, MAX_PACKET_SIZE / 2);
+	std::vector<uint8_t> data;
+	if ( !read_memory(address, length, data) )
+		return REPLY_ENN;
+
+	std::string reply;
+	hex_encode(reply, data);
+	send_reply(reply);
+
+	return REPLY_NONE;
+}
+
+//-------------------------------------------------------------------------
+// Read length bytes of memory, using accesses as wide as the data bus
+// where the address is aligned.
+bool debug_gdbstub::read_memory(uint64_t address, uint64_t length, std::vector<uint8_t> &data)
+{
 	offs_t offset = address;
 	address_space *tspace;
 	if ( !m_memory->translate(m_address_space->spacenum(), device_memory_interface::TR_READ, offset, tspace) )
-		return REPLY_ENN;
+		return false;
 
 	// Disable side effects while reading memory.
 	auto dis = m_machine->disable_side_effects();
 
-	std::string reply;
-	reply.reserve(length * 2);
-	for ( int i = 0; i < length; i++ )
+	const int unit = tspace->data_width() / 8;
+	const bool is_be = tspace->endianness() == ENDIANNESS_BIG;
+	data.resize(length);
+	uint64_t pos = 0;
+	while ( pos < length )
 	{
-		uint8_t value = tspace->read_byte(offset + i);
-		reply += string_format("%02x", value);
-	}
-	send_reply(reply.c_str());
+		offs_t const cur = offset + pos;
+		if ( unit == 1 || (cur & (unit - 1)) != 0 || length - pos < unit )
+		{
+			data[pos++] = tspace->read_byte(cur);
+			continue;
+		}
 
-	return REPLY_NONE;
+		uint64_t value;
+		switch ( unit )
+		{
+			case 2: value = tspace->read_word(cur); break;
+			case 4: value = tspace->read_dword(cur); break;
+			default: value = tspace->read_qword(cur); break;
+		}
+		for ( int i = 0; i < unit; i++ )
+		{
+			int const shift = (is_be ? (unit - 1 - i) : i) * 8;
+			data[pos++] = uint8_t(value >> shift);
+		}
+	}
+	return true;
 }
 
 //-------------------------------------------------------------------------
@@ -990,8 +1143,11 @@ static bool hex_decode(std::vector<uint8_t> *_data, const char *buf, size_t leng
 	data.resize(length);
 	for ( int i = 0; i < length; i++ )
 	{
-		if ( sscanf(buf, "%02hhx", &data[i]) != 1 )
+		int const hi = hex_nibble(buf[0]);
+		int const lo = (hi < 0) ? -1 : hex_nibble(buf[1]);
+		if ( lo < 0 )
 			return false;
+		data[i] = uint8_t((hi << 4) | lo);
 		buf += 2;
 	}
 	if ( *buf != '\0' )
@@ -1064,7 +1220,7 @@ debug_gdbstub::cmd_reply debug_gdbstub::handle_q(const char *buf)
 	if ( *buf == 'C' )
 	{
 		// Return the current thread ID.
-		send_reply("QC1");
+		send_reply(string_format("QC%x", m_cur_thread + 1));
 		return REPLY_NONE;
 	}
 	else if ( *buf == 'P' )
@@ -1118,6 +1274,7 @@ debug_gdbstub::cmd_reply debug_gdbstub::handle_q(const char *buf)
 	{
 		std::string reply = string_format("PacketSize=%x", MAX_PACKET_SIZE);
 		reply += ";qXfer:features:read+";
+		reply += ";qXfer:memory-map:read+";
 		send_reply(reply.c_str());
 		return REPLY_NONE;
 	}
@@ -1144,10 +1301,34 @@ debug_gdbstub::cmd_reply debug_gdbstub::handle_q(const char *buf)
 				return REPLY_NONE;
 			}
 		}
+		// "memory-map:read::0,fff"
+		else if ( strncmp(params.c_str(), "memory-map:read::", 17) == 0 )
+		{
+			int offset = 0;
+			int length = 0;
+			if ( sscanf(params.c_str() + 17, "%x,%x", &offset, &length) == 2 )
+			{
+				if ( m_memory_map_xml.empty() )
+					generate_memory_map_xml();
+				offset = std::min(offset, (int) m_memory_map_xml.length());
+				length = std::min(length, (int) m_memory_map_xml.length()-offset);
+				std::string reply;
+				if ( offset + length < m_memory_map_xml.length() )
+					reply += 'm';
+				else
+					reply += 'l';
+				reply += m_memory_map_xml.substr(offset, length);
+				send_reply(reply);
+				return REPLY_NONE;
+			}
+		}
 	}
 	else if ( name == "fThreadInfo" )
 	{
-		send_reply("m1");
+		std::string reply = "m";
+		for ( int i = 0; i < m_threads.size(); i++ )
+			reply += string_format(i ? ",%x" : "%x", i + 1);
+		send_reply(reply);
 		return REPLY_NONE;
 	}
 	else if ( name == "sThreadInfo" )
@@ -1155,6 +1336,19 @@ debug_gdbstub::cmd_reply debug_gdbstub::handle_q(const char *buf)
 		send_reply("l");
 		return REPLY_NONE;
 	}
+	else if ( strncmp(buf, "ThreadExtraInfo,", 16) == 0 )
+	{
+		// Describe the CPU behind a thread.
+		int thread = parse_thread_id(buf + 16);
+		if ( thread < 1 )
+			return REPLY_ENN;
+		const device_t &cpu = *m_threads[thread - 1];
+		std::string info = string_format("%s (%s)", cpu.tag(), cpu.name());
+		std::string reply;
+		hex_encode(reply, std::vector<uint8_t>(info.begin(), info.end()));
+		send_reply(reply);
+		return REPLY_NONE;
+	}
 
 	return REPLY_UNSUPPORTED;
 }
@@ -1167,7 +1361,7 @@ debug_gdbstub::cmd_reply debug_gdbstub::handle_s(const char *buf)
 	if ( *buf != '\0' )
 		return REPLY_UNSUPPORTED;
 
-	m_debugger_console->get_visible_cpu()->debug()->single_step();
+	current_debug()->single_step();
 	m_send_stop_packet = true;
 	return REPLY_NONE;
 }
@@ -1183,6 +1377,139 @@ debug_gdbstub::cmd_reply debug_gdbstub::handle_T(const char *buf)
 	return REPLY_ENN;
 }
 
+//-------------------------------------------------------------------------
+// Multi-letter packets.
+debug_gdbstub::cmd_reply debug_gdbstub::handle_v(const char *buf)
+{
+	if ( strcmp(buf, "Cont?") == 0 )
+	{
+		send_reply("vCont;c;C;s;S");
+		return REPLY_NONE;
+	}
+	else if ( strncmp(buf, "Cont;", 5) == 0 )
+	{
+		// Execution is all-stop, so every thread resumes together.  The
+		// first step action found decides which thread steps; otherwise
+		// everything continues.  Signals are ignored.
+		buf += 5;
+		int step_thread = -1;
+		bool resume = false;
+		while ( *buf != '\0' )
+		{
+			char action = *buf++;
+			if ( action == 'C' || action == 'S' )
+			{
+				if ( hex_nibble(buf[0]) < 0 || hex_nibble(buf[1]) < 0 )
+					return REPLY_ENN;
+				buf += 2;
+			}
+			else if ( action != 'c' && action != 's' )
+			{
+				return REPLY_UNSUPPORTED;
+			}
+
+			int thread = -1;
+			if ( *buf == ':' )
+			{
+				thread = parse_thread_id(buf + 1, &buf);
+				if ( thread < -1 )
+					return REPLY_ENN;
+			}
+			if ( *buf == ';' )
+				buf++;
+			else if ( *buf != '\0' )
+				return REPLY_ENN;
+
+			if ( (action == 's' || action == 'S') && step_thread < 0 )
+				step_thread = (thread > 0) ? (thread - 1) : m_cur_thread;
+			resume = true;
+		}
+		if ( !resume )
+			return REPLY_ENN;
+
+		if ( step_thread >= 0 )
+		{
+			select_thread(step_thread);
+			current_debug()->single_step();
+		}
+		else
+		{
+			m_debugger_console->get_visible_cpu()->debug()->go();
+		}
+		m_send_stop_packet = true;
+		return REPLY_NONE;
+	}
+
+	return REPLY_UNSUPPORTED;
+}
+
+//-------------------------------------------------------------------------
+// Read memory as binary data.
+debug_gdbstub::cmd_reply debug_gdbstub::handle_x(const char *buf)
+{
+	uint64_t address;
+	uint64_t length;
+	if ( sscanf(buf, "%" PRIx64 ",%" PRIx64, &address, &length) != 2 )
+		return REPLY_ENN;
+
+	// Leave room for escaping every byte.
+	length = std::min<uint64_t>(length, MAX_PACKET_SIZE / 2);
+	std::vector<uint8_t> data;
+	if ( !read_memory(address, length, data) )
+		return REPLY_ENN;
+
+	std::string reply = "b";
+	reply += escape_packet(std::string_view(reinterpret_cast<const char *>(data.data()), data.size()));
+	send_reply(reply);
+	return REPLY_NONE;
+}
+
+//-------------------------------------------------------------------------
+bool debug_gdbstub::decode_binary(std::vector<uint8_t> &data, const char *buf, const char *end)
+{
+	data.clear();
+	data.reserve(end - buf);
+	while ( buf < end )
+	{
+		char ch = *buf++;
+		if ( ch == '}' )
+		{
+			if ( buf == end )
+				return false;
+			ch = *buf++ ^ 0x20;
+		}
+		data.push_back(uint8_t(ch));
+	}
+	return true;
+}
+
+//-------------------------------------------------------------------------
+// Write memory from binary data.
+debug_gdbstub::cmd_reply debug_gdbstub::handle_X(const char *buf)
+{
+	uint64_t address;
+	uint64_t length;
+	int buf_offset;
+	if ( sscanf(buf, "%" PRIx64 ",%" PRIx64 ":%n", &address, &length, &buf_offset) != 2 )
+		return REPLY_ENN;
+
+	offs_t offset = address;
+	address_space *tspace;
+	if ( !m_memory->translate(m_address_space->spacenum(), device_memory_interface::TR_READ, offset, tspace) )
+		return REPLY_ENN;
+
+	// The data may contain NUL characters, so use the packet length.
+	const char *end = (const char *) m_packet_buf + m_packet_len;
+	std::vector<uint8_t> data;
+	if ( !decode_binary(data, buf + buf_offset, end) || data.size() != length )
+		return REPLY_ENN;
+
+	for ( int i = 0; i < length; i++ )
+		tspace->write_byte(offset + i, data[i]);
+
+	return REPLY_OK;
+}
+
 //-------------------------------------------------------------------------
 static bool remove_breakpoint(device_debug *debug, uint64_t address, int /*kind*/)
 {
@@ -1323,6 +1650,8 @@ void debug_gdbstub::send_stop_packet()
 		uint64_t address = m_address_map[offset];
 		reply += string_format(":%" PRIx64 ";", address);
 	}
+	if ( m_threads.size() > 1 )
+		reply += string_format("thread:%x;", m_cur_thread + 1);
 	if ( m_target_xml_sent )
 		for ( const auto &gdb_regnum: m_stop_reply_registers )
 			reply += string_format("%02x:%s;", gdb_regnum, get_register_string(gdb_regnum));
@@ -1356,6 +1685,9 @@ void debug_gdbstub::handle_packet()
 		case 'q': reply = handle_q(buf); break;
 		case 's': reply = handle_s(buf); break;
 		case 'T': reply = handle_T(buf); break;
+		case 'v': reply = handle_v(buf); break;
+		case 'x': reply = handle_x(buf); break;
+		case 'X': reply = handle_X(buf); break;
 		case 'z': reply = handle_z(buf); break;
 		case 'Z': reply = handle_Z(buf); break;
 	}
@@ -1420,16 +1752,48 @@ void debug_gdbstub::set_register_value(int gdb_regnum, uint64_t value)
 //-------------------------------------------------------------------------
 bool debug_gdbstub::is_thread_id_ok(const char *buf)
 {
-	// 'any'
-	if ( buf[0] == '0' && buf[1] == '\0' )
-		return true;
-	// The thread id we reported.
-	if ( buf[0] == '1' && buf[1] == '\0' )
-		return true;
-	// 'all'
-	if ( buf[0] == '-' && buf[1] == '1' && buf[2] == '\0' )
-		return true;
-	return false;
+	// 'any', 'all', or one of the thread ids we reported.
+	const char *end;
+	return parse_thread_id(buf, &end) >= -1 && *end == '\0';
+}
+
+//-------------------------------------------------------------------------
+// Returns the thread id, 0 for 'any', -1 for 'all', or -2 if the id is
+// invalid or isn't one we reported.
+int debug_gdbstub::parse_thread_id(const char *buf, const char **end)
+{
+	if ( end )
+		*end = buf;
+	if ( buf[0] == '-' && buf[1] == '1' )
+	{
+		if ( end )
+			*end = buf + 2;
+		return -1;
+	}
+
+	int thread = 0;
+	const char *ptr = buf;
+	while ( hex_nibble(*ptr) >= 0 )
+	{
+		thread = (thread << 4) | hex_nibble(*ptr++);
+		if ( thread > m_threads.size() )
+			return -2;
+	}
+	if ( ptr == buf )
+		return -2;
+	if ( end )
+		*end = ptr;
+	return thread;
+}
+
+//-------------------------------------------------------------------------
+void debug_gdbstub::select_thread(int index)
+{
+	m_cur_thread = index;
+	m_threads[index]->interface(m_state);
+	assert(m_state != nullptr);
+	m_memory = &m_threads[index]->memory();
+	m_address_space = &m_memory->space(AS_PROGRAM);
 }
 
 //-------------------------------------------------------------------------
@@ -51,6 +51,7 @@
 #include <cerrno>
 #include <cstdlib>
 #include <cstring>
+#include <limits>
 #include <memory>
 #include <type_traits>
 #include <vector>
@@ -61,6 +62,10 @@
 #include <cstdlib>
 #include <unistd.h>
 
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#endif
+
 
 
 namespace {
@@ -317,6 +322,12 @@ std::error_condition osd_file::open(std::string const &path, std::uint32_t openf
 		return staterr;
 	}
 
+#if defined(POSIX_FADV_SEQUENTIAL)
+	// images and ROMs are mostly read front to back, so let the kernel read further ahead in the background
+	if ((access == O_RDONLY) && S_ISREG(st.st_mode))
+		::posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
 	osd_file::ptr result(new (std::nothrow) posix_osd_file(fd));
 	if (!result)
 	{
@@ -353,6 +364,38 @@ std::error_condition osd_file::remove(std::string const &filename) noexcept
 }
 
 
+//============================================================
+//  osd_file::rename
+//============================================================
+
+std::error_condition osd_file::rename(std::string const &oldname, std::string const &newname) noexcept
+{
+	if (::rename(oldname.c_str(), newname.c_str()) < 0)
+		return std::error_condition(errno, std::generic_category());
+	else
+		return std::error_condition();
+}
+
+
+//============================================================
+//  osd_file::sync
+//============================================================
+
+std::error_condition osd_file::sync(std::string const &path) noexcept
+{
+	// a read-only descriptor is enough for fsync, and works for directories
+	int const fd = ::open(path.c_str(), O_RDONLY);
+	if (fd < 0)
+		return std::error_condition(errno, std::generic_category());
+
+	std::error_condition result;
+	if (::fsync(fd) < 0)
+		result = std::error_condition(errno, std::generic_category());
+	::close(fd);
+	return result;
+}
+
+
 //============================================================
 //  osd_get_physical_drive_geometry
 //============================================================
@@ -455,6 +498,62 @@ std::error_condition osd_get_full_path(std::string &dst, std::string const &path
 }
 
 
+//============================================================
+//  osd_map_file
+//============================================================
+
+std::error_condition osd_map_file(std::string const &path, std::uint64_t length, void *&base) noexcept
+{
+#if defined(_WIN32)
+	return std::errc::not_supported;
+#else
+	if (!length || (length > std::numeric_limits<size_t>::max()))
+		return std::errc::invalid_argument;
+
+	int const fd = ::open(path.c_str(), O_RDONLY);
+	if (fd < 0)
+		return std::error_condition(errno, std::generic_category());
+
+	// make sure the file really is long enough, or accessing the end will fault
+	struct stat st;
+	if (::fstat(fd, &st) < 0)
+	{
+		std::error_condition const err(errno, std::generic_category());
+		::close(fd);
+		return err;
+	}
+	if (!S_ISREG(st.st_mode) || (std::uint64_t(st.st_size) < length))
+	{
+		::close(fd);
+		return std::errc::invalid_argument;
+	}
+
+	// the mapping keeps its own reference to the file
+	void *const result = ::mmap(nullptr, size_t(length), PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+	std::error_condition const err(errno, std::generic_category());
+	::close(fd);
+	if (MAP_FAILED == result)
+		return err;
+
+	base = result;
+	return std::error_condition();
+#endif
+}
+
+
+//============================================================
+//  osd_unmap_file
+//============================================================
+
+void osd_unmap_file(void *base, std::uint64_t length) noexcept
+{
+#if !defined(_WIN32)
+	if (base)
+		::munmap(base, size_t(length));
+#endif
+}
+
+
 //============================================================
 //  osd_is_absolute_path
 //============================================================
@@ -194,6 +194,30 @@ std::error_condition osd_file::remove(std::string const &filename) noexcept
 }
 
 
+//============================================================
+//  osd_file::rename
+//============================================================
+
+std::error_condition osd_file::rename(std::string const &oldname, std::string const &newname) noexcept
+{
+	if (!std::rename(oldname.c_str(), newname.c_str()))
+		return std::error_condition();
+	else
+		return std::error_condition(errno, std::generic_category());
+}
+
+
+//============================================================
+//  osd_file::sync
+//============================================================
+
+std::error_condition osd_file::sync(std::string const &path) noexcept
+{
+	// no portable way to do this
+	return std::error_condition();
+}
+
+
 //============================================================
 //  osd_get_physical_drive_geometry
 //============================================================
@@ -292,3 +316,23 @@ std::vector<std::string> osd_get_volume_names()
 	// we don't expose volumes
 	return std::vector<std::string>();
 }
+
+
+//============================================================
+//  osd_map_file
+//============================================================
+
+std::error_condition osd_map_file(std::string const &path, std::uint64_t length, void *&base) noexcept
+{
+	// there's no portable way to map a file
+	return std::errc::not_supported;
+}
+
+
+//============================================================
+//  osd_unmap_file
+//============================================================
+
+void osd_unmap_file(void *base, std::uint64_t length) noexcept
+{
+}
@@ -19,6 +19,7 @@
 
 #include <cassert>
 #include <cstring>
+#include <limits>
 #include <memory>
 
 // standard windows headers
@@ -301,6 +302,60 @@ std::error_condition osd_file::remove(std::string const &filename) noexcept
 }
 
 
+//============================================================
+//  osd_file::rename
+//============================================================
+
+std::error_condition osd_file::rename(std::string const &oldname, std::string const &newname) noexcept
+{
+	osd::text::tstring oldstr, newstr;
+	try
+	{
+		oldstr = osd::text::to_tstring(oldname);
+		newstr = osd::text::to_tstring(newname);
+	}
+	catch (...)
+	{
+		return std::errc::not_enough_memory;
+	}
+
+	std::error_condition filerr;
+	if (!MoveFileEx(oldstr.c_str(), newstr.c_str(), MOVEFILE_REPLACE_EXISTING))
+		filerr = win_error_to_error_condition(GetLastError());
+
+	return filerr;
+}
+
+
+//============================================================
+//  osd_file::sync
+//============================================================
+
+std::error_condition osd_file::sync(std::string const &path) noexcept
+{
+	osd::text::tstring tempstr;
+	try { tempstr = osd::text::to_tstring(path); }
+	catch (...) { return std::errc::not_enough_memory; }
+
+	// directory handles can't be flushed; NTFS journals the entries anyway
+	DWORD const attributes = GetFileAttributes(tempstr.c_str());
+	if (INVALID_FILE_ATTRIBUTES == attributes)
+		return win_error_to_error_condition(GetLastError());
+	if (attributes & FILE_ATTRIBUTE_DIRECTORY)
+		return std::error_condition();
+
+	HANDLE const h = CreateFile(tempstr.c_str(), GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (INVALID_HANDLE_VALUE == h)
+		return win_error_to_error_condition(GetLastError());
+
+	std::error_condition filerr;
+	if (!FlushFileBuffers(h))
+		filerr = win_error_to_error_condition(GetLastError());
+	CloseHandle(h);
+	return filerr;
+}
+
+
 
 //============================================================
 //  osd_get_physical_drive_geometry
@@ -430,6 +485,62 @@ std::error_condition osd_get_full_path(std::string &dst, std::string const &path
 
 
 
+//============================================================
+//  osd_map_file
+//============================================================
+
+std::error_condition osd_map_file(std::string const &path, std::uint64_t length, void *&base) noexcept
+{
+	if (!length || (length > std::numeric_limits<SIZE_T>::max()))
+		return std::errc::invalid_argument;
+
+	// convert path to TCHAR
+	osd::text::tstring t_path;
+	try { t_path = osd::text::to_tstring(path); }
+	catch (...) { return std::errc::not_enough_memory; }
+
+	HANDLE const file = CreateFile(t_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, 0, nullptr);
+	if (INVALID_HANDLE_VALUE == file)
+		return win_error_to_error_condition(GetLastError());
+
+	// make sure the file really is long enough, or accessing the end will fault
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(file, &size) || (std::uint64_t(size.QuadPart) < length))
+	{
+		CloseHandle(file);
+		return std::errc::invalid_argument;
+	}
+
+	// copy-on-write access keeps modifications private to this process
+	HANDLE const mapping = CreateFileMapping(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+	DWORD err = GetLastError();
+	CloseHandle(file);
+	if (!mapping)
+		return win_error_to_error_condition(err);
+
+	// the view keeps its own reference to the mapping
+	void *const result = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, SIZE_T(length));
+	err = GetLastError();
+	CloseHandle(mapping);
+	if (!result)
+		return win_error_to_error_condition(err);
+
+	base = result;
+	return std::error_condition();
+}
+
+
+//============================================================
+//  osd_unmap_file
+//============================================================
+
+void osd_unmap_file(void *base, std::uint64_t length) noexcept
+{
+	if (base)
+		UnmapViewOfFile(base);
+}
+
+
 //============================================================
 //  osd_is_absolute_path
 //============================================================
@@ -18,9 +18,13 @@
 #include "interface/inputman.h"
 #include "modules/osdmodule.h"
 
+#include "osdcore.h"
+
 #include "util/strformat.h"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cassert>
 #include <chrono>
 #include <functional>
@@ -228,6 +232,7 @@ public:
 	// Poll and reset methods
 	virtual void poll(bool relative_reset) = 0;
 	virtual void reset() = 0;
+	virtual void discard_events() { }
 	virtual void configure(osd::input_device &device) = 0;
 };
 
@@ -236,46 +241,82 @@ public:
 //  event_based_device
 //============================================================
 
+// Events are queued by a single thread (an input thread or the thread
+// pumping window messages) and processed by the emulation thread when it
+// polls.  The queue is a fixed-size ring, so neither side ever blocks.
 template <class TEvent>
 class event_based_device : public device_info
 {
 private:
-	static inline constexpr unsigned DEFAULT_EVENT_QUEUE_SIZE = 20;
+	static inline constexpr unsigned EVENT_QUEUE_SIZE = 128;
 
-	std::queue<TEvent> m_event_queue;
+	using clock_type = std::chrono::steady_clock;
 
-protected:
-	std::mutex           m_device_lock;
+	struct queued_event
+	{
+		clock_type::time_point  time;   // when the event was queued
+		TEvent                  event;
+	};
+
+	std::array<queued_event, EVENT_QUEUE_SIZE> m_event_queue;
+	std::atomic<unsigned> m_event_head; // next entry to write
+	std::atomic<unsigned> m_event_tail; // next entry to read
+	std::atomic<unsigned> m_events_dropped;
 
+protected:
 	virtual void process_event(TEvent const &ev) = 0;
 
 public:
 	event_based_device(std::string &&name, std::string &&id, input_module &module) :
-		device_info(std::move(name), std::move(id), module)
+		device_info(std::move(name), std::move(id), module),
+		m_event_head(0),
+		m_event_tail(0),
+		m_events_dropped(0)
 	{
 	}
 
 	void queue_events(TEvent const *events, int count)
 	{
-		std::lock_guard<std::mutex> scope_lock(m_device_lock);
+		clock_type::time_point const now = clock_type::now();
+		unsigned head = m_event_head.load(std::memory_order_relaxed);
 		for (int i = 0; i < count; i++)
-			m_event_queue.push(events[i]);
-
-		// If we've gone over the size, remove old events from the queue
-		while (m_event_queue.size() > DEFAULT_EVENT_QUEUE_SIZE)
-			m_event_queue.pop();
+		{
+			// if the emulation thread has fallen this far behind, newer events are dropped
+			unsigned const next = (head + 1) % EVENT_QUEUE_SIZE;
+			if (next == m_event_tail.load(std::memory_order_acquire))
+			{
+				m_events_dropped.fetch_add(count - i, std::memory_order_relaxed);
+				break;
+			}
+			m_event_queue[head].time = now;
+			m_event_queue[head].event = events[i];
+			head = next;
+			m_event_head.store(head, std::memory_order_release);
+		}
 	}
 
-	void virtual poll(bool relative_reset) override
+	virtual void poll(bool relative_reset) override
 	{
-		std::lock_guard<std::mutex> scope_lock(m_device_lock);
-
-		// Process each event until the queue is empty
-		while (!m_event_queue.empty())
+		// events queued while processing are left for the next poll, so each
+		// poll sees the state as of the moment it started
+		clock_type::time_point const cutoff = clock_type::now();
+		unsigned const head = m_event_head.load(std::memory_order_acquire);
+		unsigned tail = m_event_tail.load(std::memory_order_relaxed);
+		while ((tail != head) && (m_event_queue[tail].time <= cutoff))
 		{
-			process_event(m_event_queue.front());
-			m_event_queue.pop();
+			process_event(m_event_queue[tail].event);
+			tail = (tail + 1) % EVENT_QUEUE_SIZE;
 		}
+		m_event_tail.store(tail, std::memory_order_release);
+
+		unsigned const dropped = m_events_dropped.exchange(0, std::memory_order_relaxed);
+		if (dropped)
+			osd_printf_verbose("Input: %s dropped %u events\n", name(), dropped);
+	}
+
+	virtual void discard_events() override
+	{
+		m_event_tail.store(m_event_head.load(std::memory_order_acquire), std::memory_order_release);
 	}
 };
 
@@ -305,7 +346,10 @@ public:
 	void reset_devices()
 	{
 		for (auto &device: m_list)
+		{
+			device->discard_events();
 			device->reset();
+		}
 	}
 
 	template <typename T>
@@ -24,10 +24,13 @@
 #include "inpttype.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <condition_variable>
 #include <functional>
 #include <mutex>
 #include <new>
+#include <thread>
 
 // standard windows headers
 #include <windows.h>
@@ -544,6 +547,130 @@ private:
 };
 
 
+//============================================================
+//  rawinput_thread - receives WM_INPUT messages on a thread of
+//  its own, so events are queued as soon as they arrive rather
+//  than when the emulation thread next pumps window messages
+//============================================================
+
+class rawinput_thread
+{
+public:
+	static rawinput_thread &instance()
+	{
+		static rawinput_thread s_instance;
+		return s_instance;
+	}
+
+	// returns the window to register as the target, or nullptr on failure
+	HWND acquire(windows_osd_interface &osd, bool background)
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		if (!m_users++)
+		{
+			m_osd = &osd;
+			m_background.store(background, std::memory_order_relaxed);
+			m_started = false;
+			m_thread = std::thread([this] () { run(); });
+			m_ready.wait(lock, [this] () { return m_started; });
+			if (!m_window)
+				osd_printf_verbose("RawInput: unable to create input thread window, using the main window\n");
+		}
+		return m_window;
+	}
+
+	void release()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		assert(m_users);
+		if (!--m_users)
+		{
+			if (m_window)
+				PostMessage(m_window, WM_CLOSE, 0, 0);
+			m_thread.join();
+			m_window = nullptr;
+			m_osd = nullptr;
+		}
+	}
+
+private:
+	rawinput_thread() = default;
+
+	void run()
+	{
+		HINSTANCE const instance = GetModuleHandle(nullptr);
+		WNDCLASS wc = { 0 };
+		wc.lpfnWndProc = &rawinput_thread::window_proc;
+		wc.hInstance = instance;
+		wc.lpszClassName = TEXT("MAMERawInput");
+		RegisterClass(&wc); // fails harmlessly if already registered
+
+		HWND const window = CreateWindowEx(0, wc.lpszClassName, nullptr, 0, 0, 0, 0, 0, HWND_MESSAGE, nullptr, instance, nullptr);
+		if (window)
+			SetWindowLongPtr(window, GWLP_USERDATA, LONG_PTR(this));
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_window = window;
+			m_started = true;
+		}
+		m_ready.notify_all();
+		if (!window)
+			return;
+
+		MSG message;
+		while (GetMessage(&message, nullptr, 0, 0) > 0)
+			DispatchMessage(&message);
+	}
+
+	bool in_foreground() const
+	{
+		if (m_background.load(std::memory_order_relaxed))
+			return true;
+		DWORD process = 0;
+		HWND const foreground = GetForegroundWindow();
+		return foreground && GetWindowThreadProcessId(foreground, &process) && (GetCurrentProcessId() == process);
+	}
+
+	static LRESULT CALLBACK window_proc(HWND wnd, UINT message, WPARAM wparam, LPARAM lparam)
+	{
+		auto *const thread = reinterpret_cast<rawinput_thread *>(GetWindowLongPtr(wnd, GWLP_USERDATA));
+		switch (message)
+		{
+		case WM_INPUT:
+			// input has to be accepted in the background to reach a message-only window
+			if (thread && thread->in_foreground())
+				thread->m_osd->handle_input_event(INPUT_EVENT_RAWINPUT, &lparam);
+			break;
+
+		case WM_INPUT_DEVICE_CHANGE:
+			if (thread && (GIDC_ARRIVAL == wparam))
+				thread->m_osd->handle_input_event(INPUT_EVENT_ARRIVAL, &lparam);
+			else if (thread && (GIDC_REMOVAL == wparam))
+				thread->m_osd->handle_input_event(INPUT_EVENT_REMOVAL, &lparam);
+			return 0;
+
+		case WM_CLOSE:
+			DestroyWindow(wnd);
+			return 0;
+
+		case WM_DESTROY:
+			PostQuitMessage(0);
+			return 0;
+		}
+		return DefWindowProc(wnd, message, wparam, lparam);
+	}
+
+	std::mutex                  m_mutex;
+	std::condition_variable     m_ready;
+	std::thread                 m_thread;
+	unsigned                    m_users = 0;
+	bool                        m_started = false;
+	HWND                        m_window = nullptr;
+	windows_osd_interface *     m_osd = nullptr;
+	std::atomic<bool>           m_background = false;
+};
+
+
 //============================================================
 //  rawinput_module - base class for rawinput modules
 //============================================================
@@ -552,12 +679,33 @@ class rawinput_module : public wininput_module<rawinput_device>
 {
 private:
 	std::mutex  m_module_lock;
+	bool        m_threaded;
 
 public:
-	rawinput_module(const char *type, const char *name) : wininput_module<rawinput_device>(type, name)
+	rawinput_module(const char *type, const char *name) : wininput_module<rawinput_device>(type, name), m_threaded(false)
 	{
 	}
 
+	virtual void exit() override
+	{
+		// stop receiving input before the devices go away
+		if (m_threaded)
+		{
+			RAWINPUTDEVICE registration;
+			registration.usUsagePage = usagepage();
+			registration.usUsage = usage();
+			registration.dwFlags = RIDEV_REMOVE;
+			registration.hwndTarget = nullptr;
+			RegisterRawInputDevices(&registration, 1, sizeof(registration));
+
+			rawinput_thread::instance().release();
+			m_threaded = false;
+		}
+
+		std::lock_guard<std::mutex> scope_lock(m_module_lock);
+		wininput_module<rawinput_device>::exit();
+	}
+
 	virtual bool probe() override
 	{
 		return true;
@@ -609,9 +757,19 @@ public:
 		registration.usUsagePage = usagepage();
 		registration.usUsage = usage();
 		registration.dwFlags = RIDEV_DEVNOTIFY;
-		if (background_input())
+		registration.hwndTarget = rawinput_thread::instance().acquire(dynamic_cast<windows_osd_interface &>(osd()), background_input());
+		m_threaded = registration.hwndTarget != nullptr;
+		if (m_threaded)
+		{
 			registration.dwFlags |= RIDEV_INPUTSINK;
-		registration.hwndTarget = dynamic_cast<win_window_info &>(*osd_common_t::window_list().front()).platform_window();
+		}
+		else
+		{
+			rawinput_thread::instance().release();
+			if (background_input())
+				registration.dwFlags |= RIDEV_INPUTSINK;
+			registration.hwndTarget = dynamic_cast<win_window_info &>(*osd_common_t::window_list().front()).platform_window();
+		}
 
 		// register the device
 		RegisterRawInputDevices(&registration, 1, sizeof(registration));
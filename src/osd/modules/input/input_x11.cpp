@@ -29,7 +29,10 @@
 #include <X11/extensions/XInput.h>
 #include <X11/Xutil.h>
 
+#include <poll.h>
+
 #include <algorithm>
+#include <atomic>
 #include <cctype>
 #include <cstddef>
 #include <cstdio>
@@ -38,6 +41,7 @@
 #include <mutex>
 #include <queue>
 #include <string>
+#include <thread>
 #include <unordered_map>
 
 
@@ -580,11 +584,31 @@ class x11_lightgun_module : public input_module_impl<x11_input_device, osd_commo
 private:
 	device_map m_lightgun_map;
 	Display *m_display;
+	std::thread m_event_thread;
+	std::atomic<bool> m_event_thread_exit;
+
+	void event_thread()
+	{
+		// the display connection is only used from this thread while it runs,
+		// so events are queued with accurate timestamps as soon as they arrive
+		pollfd fd;
+		fd.fd = ConnectionNumber(m_display);
+		fd.events = POLLIN;
+		while (!m_event_thread_exit.load(std::memory_order_acquire))
+		{
+			x11_event_manager::instance().process_events();
+
+			// wake up periodically to check whether we should exit
+			fd.revents = 0;
+			::poll(&fd, 1, 10);
+		}
+	}
 
 public:
 	x11_lightgun_module() :
 		input_module_impl<x11_input_device, osd_common_t>(OSD_LIGHTGUNINPUT_PROVIDER, "x11"),
-		m_display(nullptr)
+		m_display(nullptr),
+		m_event_thread_exit(false)
 	{
 	}
 
@@ -657,11 +681,23 @@ public:
 		osd_printf_verbose("Events types to register: motion:%d, press:%d, release:%d\n", motion_type, button_press_type, button_release_type);
 		subscribe(x11_event_manager::instance(), event_types);
 
+		// collect events on a thread of their own
+		XFlush(m_display);
+		m_event_thread_exit.store(false, std::memory_order_relaxed);
+		m_event_thread = std::thread([this] () { event_thread(); });
+
 		osd_printf_verbose("Lightgun: End initialization\n");
 	}
 
 	virtual void exit() override
 	{
+		// stop collecting events
+		if (m_event_thread.joinable())
+		{
+			m_event_thread_exit.store(true, std::memory_order_release);
+			m_event_thread.join();
+		}
+
 		// unsubscribe from events
 		unsubscribe();
 
@@ -675,12 +711,9 @@ public:
 
 	virtual void before_poll() override
 	{
-		// trigger the SDL event manager so it can process window events
+		// trigger the SDL event manager so it can process window events; XInput
+		// events are pushed to the devices by the event thread
 		input_module_impl<x11_input_device, osd_common_t>::before_poll();
-
-		// Tell the event manager to process events and push them to the devices
-		if (should_poll_devices())
-			x11_event_manager::instance().process_events();
 	}
 
 	virtual void handle_event(XEvent const &xevent) override
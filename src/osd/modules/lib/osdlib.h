@@ -59,6 +59,13 @@ void osd_process_kill();
 int osd_setenv(const char *name, const char *value, int overwrite);
 
 
+/// \brief Get peak memory usage
+///
+/// Gets the peak resident/working set size of the current process.
+/// \return Peak memory usage in bytes, or zero if not supported.
+std::uint64_t osd_get_peak_memory_usage() noexcept;
+
+
 /// \brief Get clipboard text
 ///
 /// Gets current clipboard content as UTF-8 text.  Returns an empty
@@ -20,6 +20,7 @@
 
 #include <dlfcn.h>
 #include <sys/mman.h>
+#include <sys/resource.h>
 #include <sys/sysctl.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -56,6 +57,20 @@ void osd_process_kill()
 	kill(getpid(), SIGKILL);
 }
 
+//============================================================
+//  osd_get_peak_memory_usage
+//============================================================
+
+std::uint64_t osd_get_peak_memory_usage() noexcept
+{
+	struct rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage))
+		return 0;
+
+	// ru_maxrss is reported in bytes on macOS
+	return std::uint64_t(usage.ru_maxrss);
+}
+
 //============================================================
 //  osd_break_into_debugger
 //============================================================
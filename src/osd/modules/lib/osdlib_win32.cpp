@@ -23,6 +23,7 @@
 
 #include <windows.h>
 #include <memoryapi.h>
+#include <psapi.h>
 
 #ifndef _MSC_VER
 #include <unistd.h>
@@ -82,6 +83,19 @@ void osd_process_kill()
 	TerminateProcess(GetCurrentProcess(), -1);
 }
 
+//============================================================
+//  osd_get_peak_memory_usage
+//============================================================
+
+std::uint64_t osd_get_peak_memory_usage() noexcept
+{
+	PROCESS_MEMORY_COUNTERS counters;
+	counters.cb = sizeof(counters);
+	if (!K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+		return 0;
+	return std::uint64_t(counters.PeakWorkingSetSize);
+}
+
 
 //============================================================
 //  osd_break_into_debugger
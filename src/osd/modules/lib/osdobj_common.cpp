@@ -66,6 +66,8 @@ const options_entry osd_options::s_option_entries[] =
 	{ nullptr,                                   nullptr,          core_options::option_type::HEADER,    "OSD PERFORMANCE OPTIONS" },
 	{ OSDOPTION_NUMPROCESSORS ";np",             OSDOPTVAL_AUTO,   core_options::option_type::STRING,    "number of processors; this overrides the number the system reports" },
 	{ OSDOPTION_BENCH,                           "0",              core_options::option_type::INTEGER,   "benchmark for the given number of emulated seconds; implies -video none -sound none -nothrottle" },
+	{ OSDOPTION_THREAD_AFFINITY,                 "",               core_options::option_type::STRING,    "CPUs to run each kind of thread on, as role=cpus pairs separated by semicolons; roles are emu, render, audio, work and io, and cpus is a list such as 0-3,6" },
+	{ OSDOPTION_THREAD_QOS,                      "1",              core_options::option_type::BOOLEAN,   "ask the OS to keep emulation, render, audio and worker threads on fast cores and I/O threads on efficient ones" },
 
 	{ nullptr,                                   nullptr,          core_options::option_type::HEADER,    "OSD VIDEO OPTIONS" },
 	{ OSDOPTION_VIDEO,                           OSDOPTVAL_AUTO,   core_options::option_type::STRING,    "video output method: " },
@@ -74,6 +76,7 @@ const options_entry osd_options::s_option_entries[] =
 	{ OSDOPTION_MAXIMIZE ";max",                 "1",              core_options::option_type::BOOLEAN,   "default to maximized windows" },
 	{ OSDOPTION_WAITVSYNC ";vs",                 "0",              core_options::option_type::BOOLEAN,   "enable waiting for the start of VBLANK before flipping screens (reduces tearing effects)" },
 	{ OSDOPTION_SYNCREFRESH ";srf",              "0",              core_options::option_type::BOOLEAN,   "enable using the start of VBLANK for throttling instead of the game time" },
+	{ OSDOPTION_VRR,                             "0",              core_options::option_type::BOOLEAN,   "the display has a variable refresh rate (FreeSync, G-Sync or HDMI VRR), so present each frame at the emulated rate instead of adapting to the display's" },
 	{ OSD_MONITOR_PROVIDER,                      OSDOPTVAL_AUTO,   core_options::option_type::STRING,    "monitor discovery method: " },
 
 	// per-window options
@@ -617,6 +620,11 @@ static void output_notifier_callback(const char *outname, int32_t value, void *p
 
 void osd_common_t::init_subsystems()
 {
+	// place this thread, and set up the threads started from here on
+	if (!osd_thread_role_configure(options().thread_affinity(), options().thread_qos()))
+		osd_printf_warning("Invalid %s value '%s'; some threads will be left to the OS\n", OSDOPTION_THREAD_AFFINITY, options().thread_affinity());
+	osd_thread_set_role(OSD_THREAD_ROLE_EMULATION);
+
 	// monitors have to be initialized before video init
 	m_monitor_module = &select_module_options<monitor_module>(OSD_MONITOR_PROVIDER);
 
@@ -50,6 +50,8 @@
 
 #define OSDOPTION_NUMPROCESSORS         "numprocessors"
 #define OSDOPTION_BENCH                 "bench"
+#define OSDOPTION_THREAD_AFFINITY       "thread_affinity"
+#define OSDOPTION_THREAD_QOS            "thread_qos"
 
 #define OSDOPTION_VIDEO                 "video"
 #define OSDOPTION_NUMSCREENS            "numscreens"
@@ -57,6 +59,7 @@
 #define OSDOPTION_MAXIMIZE              "maximize"
 #define OSDOPTION_WAITVSYNC             "waitvsync"
 #define OSDOPTION_SYNCREFRESH           "syncrefresh"
+#define OSDOPTION_VRR                   "vrr"
 
 #define OSDOPTION_SCREEN                "screen"
 #define OSDOPTION_ASPECT                "aspect"
@@ -127,6 +130,8 @@ public:
 	// performance options
 	const char *numprocessors() const { return value(OSDOPTION_NUMPROCESSORS); }
 	int bench() const { return int_value(OSDOPTION_BENCH); }
+	const char *thread_affinity() const { return value(OSDOPTION_THREAD_AFFINITY); }
+	bool thread_qos() const { return bool_value(OSDOPTION_THREAD_QOS); }
 
 	// video options
 	const char *video() const { return value(OSDOPTION_VIDEO); }
@@ -135,6 +140,7 @@ public:
 	bool maximize() const { return bool_value(OSDOPTION_MAXIMIZE); }
 	bool wait_vsync() const { return bool_value(OSDOPTION_WAITVSYNC); }
 	bool sync_refresh() const { return bool_value(OSDOPTION_SYNCREFRESH); }
+	bool vrr() const { return bool_value(OSDOPTION_VRR); }
 
 	// per-window options
 	const char *screen() const { return value(OSDOPTION_SCREEN); }
@@ -215,6 +221,7 @@ public:
 	// general overridables
 	virtual void init(running_machine &machine) override;
 	virtual void update(bool skip_redraw) override;
+	virtual bool presents_on_vblank() override { return !m_options.vrr() && m_options.sync_refresh() && m_options.wait_vsync(); }
 
 	// debugger overridables
 	virtual void init_debugger() override;
@@ -122,6 +122,9 @@ public:
 	virtual void set_mac(const char *mac) override;
 protected:
 	virtual int recv_dev(uint8_t **buf) override;
+#if !defined(SDLMAME_MACOSX) && !defined(SDLMAME_WIN32) && !defined(OSD_WINDOWS)
+	virtual int recv_dev_wait(uint8_t *buf, int maxlen, int timeout_ms) override;
+#endif
 private:
 	pcap_t *m_p;
 #ifdef SDLMAME_MACOSX
@@ -184,6 +187,9 @@ netdev_pcap::netdev_pcap(const char *name, class device_network_interface *ifdev
 	m_ctx.tail = 0;
 	m_ctx.p = m_p;
 	pthread_create(&m_thread, nullptr, netdev_pcap_blocker, &m_ctx);
+#elif !defined(SDLMAME_WIN32) && !defined(OSD_WINDOWS)
+	// the capture timeout bounds how long the thread waits, so it can see it's being stopped
+	start_receive_thread();
 #endif
 }
 
@@ -243,12 +249,29 @@ int netdev_pcap::recv_dev(uint8_t **buf)
 #endif
 }
 
+#if !defined(SDLMAME_MACOSX) && !defined(SDLMAME_WIN32) && !defined(OSD_WINDOWS)
+int netdev_pcap::recv_dev_wait(uint8_t *buf, int maxlen, int timeout_ms)
+{
+	struct pcap_pkthdr *header;
+	const u_char *data;
+	if(!m_p) return 0;
+	if((*module->pcap_next_ex_dl)(m_p, &header, &data) != 1) return 0;
+
+	// frames that don't fit a queue slot aren't Ethernet frames an emulated NIC could take anyway
+	if((header->caplen > unsigned(maxlen)) || (header->caplen < header->len)) return 0;
+	memcpy(buf, data, header->caplen);
+	return header->caplen;
+}
+#endif
+
 netdev_pcap::~netdev_pcap()
 {
 #ifdef SDLMAME_MACOSX
 	m_ctx.p = nullptr;
 	pthread_cancel(m_thread);
 	pthread_join(m_thread, nullptr);
+#else
+	stop_receive_thread();
 #endif
 	if(m_p) (*module->pcap_close_dl)(m_p);
 	m_p = nullptr;
@@ -14,6 +14,7 @@
 #include <fcntl.h>
 #include <sys/ioctl.h>
 #include <net/if.h>
+#include <poll.h>
 #include <cerrno>
 #endif
 
@@ -68,6 +69,9 @@ public:
 	void set_mac(const char *mac) override;
 protected:
 	int recv_dev(uint8_t **buf) override;
+#if !defined(_WIN32)
+	int recv_dev_wait(uint8_t *buf, int maxlen, int timeout_ms) override;
+#endif
 private:
 #if defined(_WIN32)
 	HANDLE m_handle = INVALID_HANDLE_VALUE;
@@ -105,6 +109,7 @@ netdev_tap::netdev_tap(const char *name, class device_network_interface *ifdev,
 	osd_printf_verbose("netdev_tap: network up!\n");
 	strncpy(m_ifname, ifr.ifr_name, 10);
 	fcntl(m_fd, F_SETFL, O_NONBLOCK);
+	start_receive_thread();
 #elif defined(_WIN32)
 	std::wstring device_path(L"" USERMODEDEVICEDIR);
 	device_path.append(wstring_from_utf8(name));
@@ -137,6 +142,7 @@ netdev_tap::~netdev_tap()
 		CloseHandle(m_handle);
 	}
 #else
+	stop_receive_thread();
 	close(m_fd);
 #endif
 }
@@ -346,6 +352,23 @@ int netdev_tap::recv_dev(uint8_t **buf)
 	*buf = m_buf;
 	return (len == -1)?0:len;
 }
+
+int netdev_tap::recv_dev_wait(uint8_t *buf, int maxlen, int timeout_ms)
+{
+	struct pollfd pfd;
+	int len;
+	if(m_fd == -1) return 0;
+	pfd.fd = m_fd;
+	pfd.events = POLLIN;
+	pfd.revents = 0;
+	if(poll(&pfd, 1, timeout_ms) <= 0) return 0;
+
+	// leave room for the frame check sequence, and apply the same filter as recv_dev
+	len = read(m_fd, buf, maxlen - 4);
+	if((len <= 0) || (memcmp(get_mac(), buf, 6) && !get_promisc() && !(buf[0] & 1)))
+		return 0;
+	return finalise_frame(buf, len);
+}
 #endif
 
 static CREATE_NETDEV(create_tap)
@@ -31,6 +31,13 @@ static char const *const glsl_mamebm_fsh_files[glsl_shader_info::FEAT_INT_NUMBER
 	"/tmp/glsl_bicubic_rgb32_dir.fsh",     // rgb32 dir bicubic
 };
 
+static char const *const glsl_idx16_lut_fsh_files[glsl_shader_info::FEAT_INT_NUMBER] =
+{
+	"/tmp/glsl_plain_idx16_lut.fsh",       // idx16 lut plain
+	"/tmp/glsl_bilinear_idx16_lut.fsh",    // idx16 lut bilinear
+	nullptr                                // idx16 lut bicubic
+};
+
 #else // GLSL_SOURCE_ON_DISK
 
 #include "shader/glsl_general.vsh.c"
@@ -39,6 +46,9 @@ static char const *const glsl_mamebm_fsh_files[glsl_shader_info::FEAT_INT_NUMBER
 #include "shader/glsl_bilinear_rgb32_dir.fsh.c"
 #include "shader/glsl_bicubic_rgb32_dir.fsh.c"
 
+#include "shader/glsl_plain_idx16_lut.fsh.c"
+#include "shader/glsl_bilinear_idx16_lut.fsh.c"
+
 static char const *const glsl_mamebm_vsh_sources[GLSL_VERTEX_SHADER_INT_NUMBER] =
 {
 	glsl_general_vsh_src                   // general
@@ -51,6 +61,13 @@ static char const *const glsl_mamebm_fsh_sources[glsl_shader_info::FEAT_INT_NUMB
 	glsl_bicubic_rgb32_dir_fsh_src,        // rgb32 dir bicubic
 };
 
+static char const *const glsl_idx16_lut_fsh_sources[glsl_shader_info::FEAT_INT_NUMBER] =
+{
+	glsl_plain_idx16_lut_fsh_src,          // idx16 lut plain
+	glsl_bilinear_idx16_lut_fsh_src,       // idx16 lut bilinear
+	nullptr                                // idx16 lut bicubic
+};
+
 #endif // GLSL_SOURCE_ON_DISK
 
 static char const *const glsl_mamebm_filter_names[glsl_shader_info::FEAT_MAX_NUMBER]{
@@ -85,6 +102,8 @@ public:
 		std::fill(std::begin(mamebm_programs), std::end(mamebm_programs), GLhandleARB(0));
 		std::fill(std::begin(mamebm_vsh_shader), std::end(mamebm_vsh_shader), GLhandleARB(0));
 		std::fill(std::begin(mamebm_fsh_shader), std::end(mamebm_fsh_shader), GLhandleARB(0));
+		std::fill(std::begin(lut_programs), std::end(lut_programs), GLhandleARB(0));
+		std::fill(std::begin(lut_fsh_shader), std::end(lut_fsh_shader), GLhandleARB(0));
 		std::fill(std::begin(scrn_programs), std::end(scrn_programs), GLhandleARB(0));
 		std::fill(std::begin(scrn_vsh_shader), std::end(scrn_vsh_shader), GLhandleARB(0));
 		std::fill(std::begin(scrn_fsh_shader), std::end(scrn_fsh_shader), GLhandleARB(0));
@@ -142,6 +161,30 @@ public:
 		if (err)
 			return false;
 
+		// palette lookup programs are optional - the palette is applied on the CPU without them
+		for (int j = 0; j < FEAT_INT_NUMBER; j++)
+		{
+			GLhandleARB vsh = mamebm_vsh_shader[0]; // don't let a failure delete the shared vertex shader
+#ifdef GLSL_SOURCE_ON_DISK
+			if (glsl_idx16_lut_fsh_files[j])
+				compile_files(
+						&lut_programs[j],
+						&vsh,
+						&lut_fsh_shader[j],
+						nullptr, // precompiled
+						glsl_idx16_lut_fsh_files[j],
+						false);
+#else
+			if (glsl_idx16_lut_fsh_sources[j])
+				compile_sources(
+						&lut_programs[j],
+						&vsh,
+						&lut_fsh_shader[j],
+						nullptr, // precompiled
+						glsl_idx16_lut_fsh_sources[j]);
+#endif
+		}
+
 		return true;
 	}
 
@@ -168,6 +211,14 @@ public:
 				delete_shader(&mamebm_programs[j], nullptr, nullptr);
 		}
 
+		for (int j = 0; j < FEAT_INT_NUMBER; j++)
+		{
+			if (lut_fsh_shader[j])
+				delete_shader(nullptr, nullptr, &lut_fsh_shader[j]);
+			if (lut_programs[j])
+				delete_shader(&lut_programs[j], nullptr, nullptr);
+		}
+
 		for (int i = 0; i < 10; i++)
 		{
 			if (scrn_vsh_shader[i])
@@ -195,6 +246,14 @@ public:
 		return mamebm_programs[glslShaderFeature + idx];
 	}
 
+	virtual GLhandleARB get_program_idx16_lut(int glslShaderFeature) override
+	{
+		if ((0 > glslShaderFeature) || (glslShaderFeature >= FEAT_INT_NUMBER))
+			return 0;
+
+		return lut_programs[glslShaderFeature];
+	}
+
 	virtual GLhandleARB get_program_scrn(int idx) override
 	{
 		if ((0 > idx) || (idx >= 10))
@@ -251,6 +310,8 @@ private:
 	GLhandleARB mamebm_programs[FEAT_MAX_NUMBER + 9];                 // rgb32 dir: plain, bilinear, bicubic, custom0-9, ..
 	GLhandleARB mamebm_vsh_shader[GLSL_VERTEX_SHADER_MAX_NUMBER + 9]; // general, custom0-9
 	GLhandleARB mamebm_fsh_shader[FEAT_MAX_NUMBER+9];                 // rgb32 dir: plain, bilinear, bicubic, custom0-9
+	GLhandleARB lut_programs[FEAT_INT_NUMBER];                        // idx16 lut: plain, bilinear
+	GLhandleARB lut_fsh_shader[FEAT_INT_NUMBER];                      // idx16 lut: plain, bilinear
 	GLhandleARB scrn_programs[10];                                    // rgb32: custom0-9, ..
 	GLhandleARB scrn_vsh_shader[10];                                  // custom0-9
 	GLhandleARB scrn_fsh_shader[10];                                  // rgb32: custom0-9
@@ -40,6 +40,12 @@ public:
 
 	virtual int add_mamebm(const char *custShaderPrefix, int idx) = 0;
 
+	/**
+	 * returns the GLSL program looking up 16-bit indices in a palette
+	 * texture if ok/available for the given internal feature, otherwise 0
+	 */
+	virtual GLhandleARB get_program_idx16_lut(int glslShaderFeature) = 0;
+
 	virtual GLhandleARB get_program_scrn(int idx) = 0;
 	virtual int add_scrn(const char *custShaderPrefix, int idx) = 0;
 
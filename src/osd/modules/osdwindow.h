@@ -217,6 +217,7 @@ struct osd_video_config
 	// hardware options
 	int                 waitvsync;                  // spin until vsync
 	int                 syncrefresh;                // sync only to refresh rate
+	int                 vrr;                        // display has a variable refresh rate
 	int                 switchres;                  // switch resolutions
 
 	// d3d, accel, opengl
@@ -27,6 +27,10 @@
 #include "clear.h"
 #include "modules/osdwindow.h"
 
+#include "util/hashing.h"
+
+#include <algorithm>
+
 bgfx_chain::bgfx_chain(
 		std::string &&name,
 		std::string &&author,
@@ -85,6 +89,71 @@ void bgfx_chain::repopulate_targets()
 			m_target_list[i] = target;
 		}
 	}
+
+	// Recreated targets have lost their contents
+	m_frame_cache.clear();
+}
+
+uint64_t bgfx_chain::frame_signature(const chain_manager::screen_prim &prim, uint16_t screen_count, uint32_t rotation_type, bool swap_xy,
+	float screen_scale_x, float screen_scale_y, float screen_offset_x, float screen_offset_y) const
+{
+	util::xxh64_creator hash;
+
+	// Screen contents and everything that feeds the automatic uniforms
+	const float geometry[] = {
+		prim.m_prim->color.a, prim.m_prim->color.r, prim.m_prim->color.g, prim.m_prim->color.b,
+		float(prim.m_quad_width), float(prim.m_quad_height), prim.m_tex_width, prim.m_tex_height,
+		float(screen_count), float(rotation_type), swap_xy ? 1.0f : 0.0f,
+		screen_scale_x, screen_scale_y, screen_offset_x, screen_offset_y };
+	hash.append(&prim.m_content_hash, sizeof(prim.m_content_hash));
+	hash.append(geometry, sizeof(geometry));
+
+	// Slider settings and the textures each pass samples
+	for (bgfx_slider* slider : m_sliders)
+	{
+		const float value = slider->value();
+		hash.append(&value, sizeof(value));
+	}
+	for (bgfx_chain_entry* entry : m_entries)
+	{
+		for (bgfx_input_pair* input : entry->inputs())
+		{
+			const std::string texture = input->texture();
+			hash.append(texture.c_str(), texture.length() + 1);
+		}
+	}
+
+	return hash.finish();
+}
+
+bool bgfx_chain::reads_feedback(size_t index) const
+{
+	// A pass that samples a target written by itself or a later pass sees the
+	// previous frame's output
+	for (bgfx_input_pair* input : m_entries[index]->inputs())
+	{
+		const std::string texture = input->texture();
+		for (size_t i = index; i < m_entries.size(); i++)
+		{
+			if (m_entries[i]->output() == texture)
+			{
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+bool bgfx_chain::reads_redrawn(size_t index) const
+{
+	for (bgfx_input_pair* input : m_entries[index]->inputs())
+	{
+		if (std::find(m_redrawn.begin(), m_redrawn.end(), input->texture()) != m_redrawn.end())
+		{
+			return true;
+		}
+	}
+	return false;
 }
 
 void bgfx_chain::process(chain_manager::screen_prim &prim, int view, int screen, texture_manager& textures, osd_window& window)
@@ -116,13 +185,39 @@ void bgfx_chain::process(chain_manager::screen_prim &prim, int view, int screen,
 		screen_offset_y = -screen_container.yoffset();
 	}
 
+	// Passes keep their output from the previous host frame unless something
+	// they depend on has changed: the screen contents or chain settings, an
+	// animated uniform, or a target redrawn earlier in this frame
+	if (screen >= m_frame_cache.size())
+	{
+		m_frame_cache.resize(screen + 1);
+	}
+	frame_cache &cache = m_frame_cache[screen];
+	const uint64_t signature = frame_signature(prim, screen_count, rotation_type, swap_xy, screen_scale_x, screen_scale_y, screen_offset_x, screen_offset_y);
+	const bool changed = !cache.valid || signature != cache.signature;
+	if (changed)
+	{
+		cache.settle_frames = FEEDBACK_SETTLE_FRAMES;
+	}
+	else if (cache.settle_frames > 0)
+	{
+		cache.settle_frames--;
+	}
+	cache.signature = signature;
+	cache.valid = true;
+
+	m_redrawn.clear();
 	int current_view = view;
 	for (size_t i = 0; i < m_entries.size(); i++)
 	{
 		if (!m_entries[i]->skip())
 		{
-			m_entries[i]->submit(current_view, prim, textures, screen_count, screen_width, screen_height, screen_scale_x, screen_scale_y, screen_offset_x, screen_offset_y,
-				rotation_type, swap_xy, screen);
+			if (changed || m_entries[i]->animated() || (cache.settle_frames > 0 && reads_feedback(i)) || reads_redrawn(i))
+			{
+				m_entries[i]->submit(current_view, prim, textures, screen_count, screen_width, screen_height, screen_scale_x, screen_scale_y, screen_offset_x, screen_offset_y,
+					rotation_type, swap_xy, screen);
+				m_redrawn.push_back(m_entries[i]->output());
+			}
 			current_view++;
 		}
 	}
@@ -180,9 +275,10 @@ void bgfx_chain::insert_effect(uint32_t index, bgfx_effect *effect, const bool a
 	uniforms.push_back(new bgfx_value_uniform(new bgfx_uniform("u_inv_tex_bounds1", bgfx::UniformType::Vec4), values, 4));
 
 	m_entries.insert(m_entries.begin() + index, new bgfx_chain_entry(name, effect, clear, suppressors, inputs, uniforms, m_targets, "screen", apply_tint));
+	m_frame_cache.clear();
 
 	const uint32_t screen_width = chains.targets().width(TARGET_STYLE_GUEST, m_screen_index);
 	const uint32_t screen_height = chains.targets().height(TARGET_STYLE_GUEST, m_screen_index);
 	m_targets.destroy_target("screen", m_screen_index);
-	m_targets.create_target("screen", bgfx::TextureFormat::BGRA8, screen_width, screen_height, 1, 1, TARGET_STYLE_GUEST, true, false, 1, m_screen_index);
+	m_targets.create_target("screen", bgfx::TextureFormat::BGRA8, screen_width, screen_height, 1, 1, TARGET_STYLE_GUEST, true, false, 1, 1, m_screen_index);
 }
@@ -48,6 +48,23 @@ public:
 	void insert_effect(uint32_t index, bgfx_effect *effect, const bool apply_tint, std::string name, std::string source, chain_manager &chains);
 
 private:
+	// per-screen record of what the chain last rendered
+	struct frame_cache
+	{
+		uint64_t    signature = 0;
+		uint32_t    settle_frames = 0;
+		bool        valid = false;
+	};
+
+	uint64_t frame_signature(const chain_manager::screen_prim &prim, uint16_t screen_count, uint32_t rotation_type, bool swap_xy,
+		float screen_scale_x, float screen_scale_y, float screen_offset_x, float screen_offset_y) const;
+	bool reads_feedback(size_t index) const;
+	bool reads_redrawn(size_t index) const;
+
+	// keep re-running passes that read their own earlier output for this many
+	// host frames after the inputs settle, so persistence effects can decay
+	static inline constexpr uint32_t FEEDBACK_SETTLE_FRAMES = 120;
+
 	std::string                         m_name;
 	std::string                         m_author;
 	bool                                m_transform;
@@ -62,6 +79,8 @@ private:
 	uint32_t                            m_screen_index;
 	bool                                m_has_converter;
 	bool                                m_has_adjuster;
+	std::vector<frame_cache>            m_frame_cache;
+	std::vector<std::string>            m_redrawn;
 };
 
 #endif // MAME_RENDER_BGFX_CHAIN_H
@@ -384,6 +384,18 @@ void bgfx_chain_entry::put_screen_buffer(uint16_t screen_width, uint16_t screen_
 	vertex[5].m_v = v[0];
 }
 
+bool bgfx_chain_entry::animated() const
+{
+	for (bgfx_entry_uniform* uniform : m_uniforms)
+	{
+		if (uniform->animated())
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
 bool bgfx_chain_entry::skip()
 {
 	if (m_suppressors.size() == 0)
@@ -34,6 +34,7 @@
 
 #include "sliderdirtynotifier.h"
 
+#include "util/hashing.h"
 #include "util/path.h"
 #include "util/unicode.h"
 #include "util/xmlfile.h"
@@ -406,6 +407,39 @@ void chain_manager::process_screen_quad(uint32_t view, uint32_t screen, screen_p
 	view += chain->applicable_passes();
 }
 
+uint64_t chain_manager::screen_content_hash(const screen_prim &prim)
+{
+	// Fingerprint the visible pixels and palette so chains can tell when the
+	// emulated frame hasn't changed since the last host frame
+	const render_texinfo &texinfo = prim.m_prim->texture;
+	const uint32_t format = PRIMFLAG_GET_TEXFORMAT(prim.m_flags);
+	const size_t bytes_per_pixel = (format == TEXFORMAT_RGB32 || format == TEXFORMAT_ARGB32) ? 4 : 2;
+
+	util::xxh64_creator hash;
+	const auto *row = reinterpret_cast<const uint8_t *>(texinfo.base);
+	for (uint32_t y = 0; y < texinfo.height; y++, row += texinfo.rowpixels * bytes_per_pixel)
+	{
+		hash.append(row, texinfo.width * bytes_per_pixel);
+	}
+	if (texinfo.palette != nullptr)
+	{
+		hash.append(texinfo.palette, texinfo.palette_length * sizeof(rgb_t));
+	}
+	return hash.finish();
+}
+
+bool chain_manager::can_reference_screen_data() const
+{
+	// Screen bitmaps can be handed to bgfx by reference rather than copied
+	// if they're guaranteed to be consumed before emulation resumes and
+	// draws into them again.  That's only the case when bgfx processes the
+	// frame synchronously, and the single window always calls bgfx::frame()
+	// after updating the screen textures.
+	if (osd_common_t::window_list().size() != 1)
+		return false;
+	return !(bgfx::getCaps()->supported & BGFX_CAPS_RENDERER_MULTITHREADED);
+}
+
 uint32_t chain_manager::count_screens(render_primitive* prim)
 {
 	uint32_t screen_count = 0;
@@ -528,12 +562,18 @@ uint32_t chain_manager::update_screen_textures(uint32_t view, render_primitive *
 	if (!count_screens(starting_prim))
 		return 0;
 
+	const bool reference = can_reference_screen_data();
 	for (int screen = 0; screen < m_screen_prims.size(); screen++)
 	{
 		screen_prim &prim = m_screen_prims[screen];
 		uint16_t tex_width(prim.m_tex_width);
 		uint16_t tex_height(prim.m_tex_height);
 
+		if (m_current_chain[screen] != CHAIN_NONE && screen_chain(screen) != nullptr)
+		{
+			prim.m_content_hash = screen_content_hash(prim);
+		}
+
 		bgfx_texture* texture = screen < m_screen_textures.size() ? m_screen_textures[screen] : nullptr;
 		bgfx_texture* palette = screen < m_screen_palettes.size() ? m_screen_palettes[screen] : nullptr;
 
@@ -558,7 +598,7 @@ uint32_t chain_manager::update_screen_textures(uint32_t view, render_primitive *
 		int width_div_factor = 1;
 		int width_mul_factor = 1;
 		const bgfx::Memory* mem = bgfx_util::mame_texture_data_to_bgfx_texture_data(dst_format, prim.m_flags & PRIMFLAG_TEXFORMAT_MASK,
-			prim.m_rowpixels, prim.m_prim->texture.width_margin, tex_height, prim.m_prim->texture.palette, prim.m_prim->texture.base, pitch, width_div_factor, width_mul_factor);
+			prim.m_rowpixels, prim.m_prim->texture.width_margin, tex_height, prim.m_prim->texture.palette, prim.m_prim->texture.base, pitch, width_div_factor, width_mul_factor, reference);
 
 		if (!texture)
 		{
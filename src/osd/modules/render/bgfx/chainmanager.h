@@ -57,6 +57,7 @@ public:
 		int m_rowpixels = 0;
 		uint32_t m_palette_length = 0;
 		uint32_t m_flags = 0;
+		uint64_t m_content_hash = 0;
 	};
 
 	chain_manager(running_machine& machine, const osd_options& options, texture_manager& textures, target_manager& targets, effect_manager& effects, uint32_t window_index,
@@ -127,7 +128,9 @@ private:
 	bool needs_sliders();
 
 	uint32_t count_screens(render_primitive* prim);
+	bool can_reference_screen_data() const;
 	void process_screen_quad(uint32_t view, uint32_t screen, screen_prim &prim, osd_window& window);
+	static uint64_t screen_content_hash(const screen_prim &prim);
 
 	running_machine&            m_machine;
 	const osd_options&          m_options;
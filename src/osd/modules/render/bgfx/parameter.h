@@ -36,6 +36,7 @@ public:
 	// Getters
 	virtual float value() = 0;
 	const std::string &name() const { return m_name; }
+	parameter_type type() const { return m_type; }
 
 protected:
 	std::string m_name;
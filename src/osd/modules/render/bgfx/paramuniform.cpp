@@ -21,3 +21,9 @@ void bgfx_param_uniform::bind()
 	float value = m_param->value();
 	m_uniform->set(&value, sizeof(float));
 }
+
+bool bgfx_param_uniform::animated() const
+{
+	// frame and time parameters change every host frame
+	return m_param->type() != bgfx_parameter::PARAM_WINDOW;
+}
@@ -10,8 +10,10 @@
 
 #include "target.h"
 
+#include <algorithm>
+
 bgfx_target::bgfx_target(std::string name, bgfx::TextureFormat::Enum format, uint16_t width, uint16_t height, uint16_t xprescale, uint16_t yprescale,
-	uint32_t style, bool double_buffer, bool filter, uint16_t scale, uint32_t screen)
+	uint32_t style, bool double_buffer, bool filter, uint16_t scale, uint16_t downscale, uint32_t screen)
 	: m_name(name)
 	, m_format(format)
 	, m_targets(nullptr)
@@ -24,6 +26,7 @@ bgfx_target::bgfx_target(std::string name, bgfx::TextureFormat::Enum format, uin
 	, m_style(style)
 	, m_filter(filter)
 	, m_scale(scale)
+	, m_downscale(std::max<uint16_t>(downscale, 1))
 	, m_screen(screen)
 	, m_current_page(0)
 	, m_initialized(false)
@@ -31,8 +34,9 @@ bgfx_target::bgfx_target(std::string name, bgfx::TextureFormat::Enum format, uin
 {
 	if (m_width > 0 && m_height > 0)
 	{
-		m_width *= m_scale;
-		m_height *= m_scale;
+		// passes such as bloom and blur can run at a fraction of the resolution
+		m_width = std::max(m_width * m_scale / m_downscale, 1);
+		m_height = std::max(m_height * m_scale / m_downscale, 1);
 
 		uint32_t wrap_mode = BGFX_SAMPLER_U_CLAMP | BGFX_SAMPLER_V_CLAMP;
 		uint32_t filter_mode = filter ? (BGFX_SAMPLER_MIN_ANISOTROPIC | BGFX_SAMPLER_MAG_ANISOTROPIC) : (BGFX_SAMPLER_MIN_POINT | BGFX_SAMPLER_MAG_POINT | BGFX_SAMPLER_MIP_POINT);
@@ -71,6 +75,7 @@ bgfx_target::bgfx_target(void *handle, uint16_t width, uint16_t height)
 	, m_style(TARGET_STYLE_CUSTOM)
 	, m_filter(false)
 	, m_scale(0)
+	, m_downscale(1)
 	, m_screen(-1)
 	, m_current_page(0)
 	, m_initialized(true)
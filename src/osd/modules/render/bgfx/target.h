@@ -28,7 +28,7 @@ class bgfx_target : public bgfx_texture_handle_provider
 {
 public:
 	bgfx_target(std::string name, bgfx::TextureFormat::Enum format, uint16_t width, uint16_t height, uint16_t xprescale, uint16_t yprescale,
-		uint32_t style, bool double_buffer, bool filter, uint16_t scale, uint32_t screen);
+		uint32_t style, bool double_buffer, bool filter, uint16_t scale, uint16_t downscale, uint32_t screen);
 	bgfx_target(void *handle, uint16_t width, uint16_t height);
 	virtual ~bgfx_target();
 
@@ -42,6 +42,7 @@ public:
 	uint32_t                    style() const { return m_style; }
 	bool                        filter() const { return m_filter; }
 	uint16_t                    scale() const { return m_scale; }
+	uint16_t                    downscale() const { return m_downscale; }
 	uint32_t                    screen_index() const { return m_screen; }
 	uint16_t                    raw_width() const { return m_width; }
 	uint16_t                    raw_height() const { return m_height; }
@@ -73,6 +74,7 @@ private:
 	uint32_t                    m_style;
 	bool                        m_filter;
 	uint16_t                    m_scale;
+	uint16_t                    m_downscale;
 
 	int32_t                     m_screen;
 
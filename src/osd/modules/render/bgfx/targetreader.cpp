@@ -44,6 +44,11 @@ bgfx_target* target_reader::read_from_value(
 	{
 		scale = int(floor(value["scale"].GetDouble() + 0.5));
 	}
+	int downscale = 1;
+	if (value.HasMember("downscale"))
+	{
+		downscale = int(floor(value["downscale"].GetDouble() + 0.5));
+	}
 	bool use_user_prescale = get_bool(value, "user_prescale", false);
 
 	uint16_t width = 0;
@@ -87,7 +92,7 @@ bgfx_target* target_reader::read_from_value(
 			break;
 	}
 
-	return chains.targets().create_target(std::move(target_name), bgfx::TextureFormat::BGRA8, width, height, xprescale, yprescale, mode, double_buffer, bilinear, scale, screen_index);
+	return chains.targets().create_target(std::move(target_name), bgfx::TextureFormat::BGRA8, width, height, xprescale, yprescale, mode, double_buffer, bilinear, scale, downscale, screen_index);
 }
 
 bool target_reader::validate_parameters(const Value& value, const std::string &prefix)
@@ -100,5 +105,6 @@ bool target_reader::validate_parameters(const Value& value, const std::string &p
 	if (!READER_CHECK(!value.HasMember("doublebuffer") || value["doublebuffer"].IsBool(), "%sValue 'doublebuffer' must be a boolean\n", prefix)) return false;
 	if (!READER_CHECK(!value.HasMember("user_prescale") || value["user_prescale"].IsBool(), "%sValue 'user_prescale' must be a boolean\n", prefix)) return false;
 	if (!READER_CHECK(!value.HasMember("scale") || value["scale"].IsNumber(), "%sValue 'scale' must be a numeric value\n", prefix)) return false;
+	if (!READER_CHECK(!value.HasMember("downscale") || (value["downscale"].IsNumber() && value["downscale"].GetDouble() >= 1.0), "%sValue 'downscale' must be a number no less than 1\n", prefix)) return false;
 	return true;
 }
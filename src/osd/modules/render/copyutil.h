@@ -12,12 +12,78 @@
 #define __RENDER_COPYUTIL__
 
 #include "palette.h"
+#include "video/simd.h"
 
+#include <algorithm>
 #include <cassert>
 
 
 class copy_util
 {
+#if defined(MAME_SIMD_SSE2)
+	// swap the R and B bytes of four pixels at a time, optionally forcing
+	// alpha to opaque; returns the number of pixels converted
+	template <bool ForceAlpha>
+	static inline int swap_rb_sse2(uint32_t *dst, const uint32_t *src, int width)
+	{
+		__m128i const agmask = _mm_set1_epi32(ForceAlpha ? 0x0000ff00 : 0xff00ff00);
+		__m128i const alpha = _mm_set1_epi32(ForceAlpha ? 0xff000000 : 0x00000000);
+		__m128i const lomask = _mm_set1_epi32(0x000000ff);
+		int x;
+		for (x = 0; (x + 4) <= width; x += 4)
+		{
+			__m128i const pix = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + x));
+			__m128i const ag = _mm_or_si128(_mm_and_si128(pix, agmask), alpha);
+			__m128i const r = _mm_and_si128(_mm_srli_epi32(pix, 16), lomask);
+			__m128i const b = _mm_slli_epi32(_mm_and_si128(pix, lomask), 16);
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + x), _mm_or_si128(ag, _mm_or_si128(r, b)));
+		}
+		return x;
+	}
+
+	// convert YUY16 four pixels (two Cb/Cr pairs) at a time using the same
+	// fixed-point equations as ycc_to_rgb; returns the number of pixels converted
+	template <bool ToBGRA>
+	static inline int yuy16_sse2(uint32_t *dst, const uint16_t *src, int width)
+	{
+		__m128i const zero = _mm_setzero_si128();
+		__m128i const lomask = _mm_set1_epi32(0x000000ff);
+		__m128i const alpha = _mm_set1_epi32(0x000000ff);
+		__m128i const rmul = _mm_set1_epi32((409 << 16) | 298);
+		__m128i const gmul = _mm_set1_epi32((uint32_t(-100) << 16) | 298);
+		__m128i const gcrmul = _mm_set1_epi32(uint16_t(-208));
+		__m128i const bmul = _mm_set1_epi32((516 << 16) | 298);
+		__m128i const rbias = _mm_set1_epi32(-298 * 16 - 409 * 128 + 128);
+		__m128i const gbias = _mm_set1_epi32(-298 * 16 + 100 * 128 + 208 * 128 + 128);
+		__m128i const bbias = _mm_set1_epi32(-298 * 16 - 516 * 128 + 128);
+		int x;
+		for (x = 0; (x + 4) <= width; x += 4)
+		{
+			// widen to one pixel per 32-bit lane and split Y from Cb/Cr
+			__m128i const pix = _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(src + x)), zero);
+			__m128i const y = _mm_srli_epi32(pix, 8);
+			__m128i const c = _mm_and_si128(pix, lomask);
+			__m128i const cb = _mm_shuffle_epi32(c, _MM_SHUFFLE(2, 2, 0, 0));
+			__m128i const cr = _mm_shuffle_epi32(c, _MM_SHUFFLE(3, 3, 1, 1));
+
+			// each lane holds a pair of 16-bit terms for pmaddwd
+			__m128i const ycb = _mm_or_si128(y, _mm_slli_epi32(cb, 16));
+			__m128i const ycr = _mm_or_si128(y, _mm_slli_epi32(cr, 16));
+			__m128i const r = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(ycr, rmul), rbias), 8);
+			__m128i const g = _mm_srai_epi32(_mm_add_epi32(_mm_add_epi32(_mm_madd_epi16(ycb, gmul), _mm_madd_epi16(cr, gcrmul)), gbias), 8);
+			__m128i const b = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(ycb, bmul), bbias), 8);
+
+			// saturating packs clamp to 0-255, then interleave the channel planes
+			__m128i const planes = ToBGRA
+					? _mm_packus_epi16(_mm_packs_epi32(b, r), _mm_packs_epi32(g, alpha))
+					: _mm_packus_epi16(_mm_packs_epi32(r, b), _mm_packs_epi32(g, alpha));
+			__m128i const pairs = _mm_unpacklo_epi8(planes, _mm_srli_si128(planes, 8));
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + x), _mm_unpacklo_epi16(pairs, _mm_srli_si128(pairs, 8)));
+		}
+		return x;
+	}
+#endif
+
 public:
 	static inline void copyline_palette16(uint32_t *dst, const uint16_t *src, int width, const rgb_t *palette)
 	{
@@ -54,7 +120,13 @@ public:
 		// direct case
 		else
 		{
-			for (x = 0; x < width; x++)
+			x = 0;
+#if defined(MAME_SIMD_SSE2)
+			x = swap_rb_sse2<true>(dst, src, width);
+			dst += x;
+			src += x;
+#endif
+			for ( ; x < width; x++)
 			{
 				rgb_t srcpix = *src++;
 				*dst++ = 0xff000000 | (srcpix.b() << 16) | (srcpix.g() << 8) | srcpix.r();
@@ -77,14 +149,11 @@ public:
 			}
 		}
 
-		// direct case
+		// direct case - the source is already in this order, so just force alpha
 		else
 		{
 			for (x = 0; x < width; x++)
-			{
-				rgb_t srcpix = *src++;
-				*dst++ = 0xff000000 | (srcpix.r() << 16) | (srcpix.g() << 8) | srcpix.b();
-			}
+				*dst++ = 0xff000000 | *src++;
 		}
 	}
 
@@ -104,7 +173,13 @@ public:
 		// direct case
 		else
 		{
-			for (x = 0; x < width; x++)
+			x = 0;
+#if defined(MAME_SIMD_SSE2)
+			x = swap_rb_sse2<false>(dst, src, width);
+			dst += x;
+			src += x;
+#endif
+			for ( ; x < width; x++)
 			{
 				rgb_t srcpix = *src++;
 				*dst++ = (srcpix.a() << 24) | (srcpix.b() << 16) | (srcpix.g() << 8) | srcpix.r();
@@ -126,14 +201,10 @@ public:
 			}
 		}
 
-		// direct case
+		// direct case - the source is already in this order
 		else
 		{
-			for (x = 0; x < width; x++)
-			{
-				rgb_t srcpix = *src++;
-				*dst++ = (srcpix.a() << 24) | (srcpix.r() << 16) | (srcpix.g() << 8) | srcpix.b();
-			}
+			std::copy_n(src, width, dst);
 		}
 	}
 
@@ -201,7 +272,16 @@ public:
 		// direct case
 		else
 		{
-			for (int x = 0; x < width; x += 2)
+			int x = 0;
+#if defined(MAME_SIMD_SSE2)
+			if (xprescale == 1)
+			{
+				x = yuy16_sse2<false>(dst, src, width);
+				dst += x;
+				src += x;
+			}
+#endif
+			for ( ; x < width; x += 2)
 			{
 				uint16_t srcpix0 = *src++;
 				uint16_t srcpix1 = *src++;
@@ -244,7 +324,16 @@ public:
 		// direct case
 		else
 		{
-			for (int x = 0; x < width; x += 2)
+			int x = 0;
+#if defined(MAME_SIMD_SSE2)
+			if (xprescale == 1)
+			{
+				x = yuy16_sse2<true>(dst, src, width);
+				dst += x;
+				src += x;
+			}
+#endif
+			for ( ; x < width; x += 2)
 			{
 				uint16_t srcpix0 = *src++;
 				uint16_t srcpix1 = *src++;
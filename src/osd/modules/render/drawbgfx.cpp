@@ -463,6 +463,7 @@ MODULE_DEFINITION(RENDERER_BGFX, osd::video_bgfx)
 
 uint16_t const renderer_bgfx::CACHE_SIZE = 1024;
 uint32_t const renderer_bgfx::PACKABLE_SIZE = 128;
+uint32_t const renderer_bgfx::MAX_QUAD_RUN = 1024;
 uint32_t const renderer_bgfx::WHITE_HASH = 0x87654321;
 char const *const renderer_bgfx::WINDOW_PREFIX = "Window 0, ";
 
@@ -695,7 +696,7 @@ void renderer_bgfx::record()
 	else
 	{
 		m_avi_writer->record(m_module().options().bgfx_avi_name());
-		m_avi_target = m_targets->create_target("avibuffer", bgfx::TextureFormat::BGRA8, s_width[0], s_height[0], 1, 1, TARGET_STYLE_CUSTOM, false, true, 1, 0);
+		m_avi_target = m_targets->create_target("avibuffer", bgfx::TextureFormat::BGRA8, s_width[0], s_height[0], 1, 1, TARGET_STYLE_CUSTOM, false, true, 1, 1, 0);
 		m_avi_texture = bgfx::createTexture2D(s_width[0], s_height[0], false, 1, bgfx::TextureFormat::BGRA8, BGFX_TEXTURE_BLIT_DST | BGFX_TEXTURE_READ_BACK);
 
 		if (m_avi_view == nullptr)
@@ -861,22 +862,52 @@ void renderer_bgfx::render_avi_quad()
 	s_current_view++;
 }
 
-void renderer_bgfx::render_textured_quad(render_primitive* prim, bgfx::TransientVertexBuffer* buffer, int window_index)
+uint32_t renderer_bgfx::textured_quad_run(const render_primitive *prim)
+{
+	// consecutive quads sampling the same texture with the same state (e.g.
+	// lamps in a layout sharing an element) can go out in a single draw call
+	if (PRIMFLAG_GET_SCREENTEX(prim->flags) || prim->packable(PACKABLE_SIZE))
+		return 1;
+
+	const uint32_t state_mask = PRIMFLAG_TEXFORMAT_MASK | PRIMFLAG_BLENDMODE_MASK | PRIMFLAG_ANTIALIAS_MASK | PRIMFLAG_SCREENTEX_MASK | PRIMFLAG_TEXWRAP_MASK;
+	uint32_t count = 1;
+	for (const render_primitive *next = prim->next(); next != nullptr && count < MAX_QUAD_RUN; next = next->next(), count++)
+	{
+		if (next->type != render_primitive::QUAD
+			|| (next->flags & state_mask) != (prim->flags & state_mask)
+			|| next->texture.base != prim->texture.base
+			|| next->texture.palette != prim->texture.palette
+			|| next->texture.seqid != prim->texture.seqid
+			|| next->texture.unique_id != prim->texture.unique_id
+			|| next->texture.width != prim->texture.width
+			|| next->texture.height != prim->texture.height
+			|| next->texture.rowpixels != prim->texture.rowpixels)
+		{
+			break;
+		}
+	}
+	return count;
+}
+
+void renderer_bgfx::render_textured_quad(render_primitive* prim, uint32_t count, bgfx::TransientVertexBuffer* buffer, int window_index)
 {
 	auto* vertices = reinterpret_cast<ScreenVertex*>(buffer->data);
-	uint32_t rgba = u32Color(prim->color.r * 255, prim->color.g * 255, prim->color.b * 255, prim->color.a * 255);
+	for (const render_primitive *quad = prim; count--; quad = quad->next(), vertices += 6)
+	{
+		uint32_t rgba = u32Color(quad->color.r * 255, quad->color.g * 255, quad->color.b * 255, quad->color.a * 255);
 
-	float x[4] = { prim->bounds.x0, prim->bounds.x1, prim->bounds.x0, prim->bounds.x1 };
-	float y[4] = { prim->bounds.y0, prim->bounds.y0, prim->bounds.y1, prim->bounds.y1 };
-	float u[4] = { prim->texcoords.tl.u, prim->texcoords.tr.u, prim->texcoords.bl.u, prim->texcoords.br.u };
-	float v[4] = { prim->texcoords.tl.v, prim->texcoords.tr.v, prim->texcoords.bl.v, prim->texcoords.br.v };
+		float x[4] = { quad->bounds.x0, quad->bounds.x1, quad->bounds.x0, quad->bounds.x1 };
+		float y[4] = { quad->bounds.y0, quad->bounds.y0, quad->bounds.y1, quad->bounds.y1 };
+		float u[4] = { quad->texcoords.tl.u, quad->texcoords.tr.u, quad->texcoords.bl.u, quad->texcoords.br.u };
+		float v[4] = { quad->texcoords.tl.v, quad->texcoords.tr.v, quad->texcoords.bl.v, quad->texcoords.br.v };
 
-	vertex(&vertices[0], x[0], y[0], 0, rgba, u[0], v[0]);
-	vertex(&vertices[1], x[1], y[1], 0, rgba, u[1], v[1]);
-	vertex(&vertices[2], x[3], y[3], 0, rgba, u[3], v[3]);
-	vertex(&vertices[3], x[3], y[3], 0, rgba, u[3], v[3]);
-	vertex(&vertices[4], x[2], y[2], 0, rgba, u[2], v[2]);
-	vertex(&vertices[5], x[0], y[0], 0, rgba, u[0], v[0]);
+		vertex(&vertices[0], x[0], y[0], 0, rgba, u[0], v[0]);
+		vertex(&vertices[1], x[1], y[1], 0, rgba, u[1], v[1]);
+		vertex(&vertices[2], x[3], y[3], 0, rgba, u[3], v[3]);
+		vertex(&vertices[3], x[3], y[3], 0, rgba, u[3], v[3]);
+		vertex(&vertices[4], x[2], y[2], 0, rgba, u[2], v[2]);
+		vertex(&vertices[5], x[0], y[0], 0, rgba, u[0], v[0]);
+	}
 
 	uint32_t texture_flags = 0U;
 	if (!PRIMFLAG_GET_TEXWRAP(prim->flags))
@@ -1420,8 +1451,11 @@ renderer_bgfx::buffer_status renderer_bgfx::buffer_primitives(bool atlas_valid,
 						}
 						else
 						{
+							const uint32_t count = textured_quad_run(*prim);
 							setup_ortho_view();
-							render_textured_quad(*prim, buffer, window_index);
+							render_textured_quad(*prim, count, buffer, window_index);
+							for (uint32_t i = 1; i < count; i++)
+								*prim = (*prim)->next();
 							return BUFFER_EMPTY;
 						}
 					}
@@ -1591,7 +1625,7 @@ void renderer_bgfx::allocate_buffer(render_primitive *prim, uint32_t blend, bgfx
 					{
 						if (vertices == 0)
 						{
-							vertices += 6;
+							vertices += 6 * textured_quad_run(prim);
 						}
 						mode_switched = true;
 					}
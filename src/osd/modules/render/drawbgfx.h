@@ -95,7 +95,8 @@ private:
 	void allocate_buffer(render_primitive *prim, uint32_t blend, bgfx::TransientVertexBuffer *buffer);
 	buffer_status buffer_primitives(bool atlas_valid, render_primitive** prim, bgfx::TransientVertexBuffer* buffer, int32_t screen, int window_index);
 
-	void render_textured_quad(render_primitive* prim, bgfx::TransientVertexBuffer* buffer, int window_index);
+	uint32_t textured_quad_run(const render_primitive *prim);
+	void render_textured_quad(render_primitive* prim, uint32_t count, bgfx::TransientVertexBuffer* buffer, int window_index);
 	void render_post_screen_quad(int view, render_primitive* prim, bgfx::TransientVertexBuffer* buffer, int32_t screen, int window_index);
 
 	void put_packed_quad(render_primitive *prim, uint32_t hash, ScreenVertex* vertex);
@@ -154,6 +155,7 @@ private:
 
 	static const uint16_t CACHE_SIZE;
 	static const uint32_t PACKABLE_SIZE;
+	static const uint32_t MAX_QUAD_RUN;
 	static const uint32_t WHITE_HASH;
 
 	static uint32_t s_current_view;
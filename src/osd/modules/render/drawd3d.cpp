@@ -286,7 +286,8 @@ render_primitive_list *renderer_d3d9::get_primitives()
 	if (rect_width(&client) > 0 && rect_height(&client) > 0)
 	{
 		window().target()->set_bounds(rect_width(&client), rect_height(&client), window().pixel_aspect());
-		window().target()->set_max_update_rate((get_refresh() == 0) ? get_origmode().RefreshRate : get_refresh());
+		// a variable refresh rate display follows us, so don't slow down to its maximum rate
+		window().target()->set_max_update_rate(video_config.vrr ? 0 : (get_refresh() == 0) ? get_origmode().RefreshRate : get_refresh());
 	}
 	if (m_shaders != nullptr)
 	{
@@ -57,8 +57,10 @@ typedef uint64_t HashT;
 // standard C headers
 #include <cmath>
 #include <cstdio>
+#include <algorithm>
 #include <memory>
 #include <utility>
+#include <vector>
 
 
 #if defined(SDLMAME_MACOSX) || defined(OSD_MAC)
@@ -245,6 +247,13 @@ public:
 	GLfloat             texCoord[8];
 	GLuint              texCoordBufferName;
 
+	GLhandleARB         lut_program = 0;                // GLSL palette lookup program, or 0 (PALETTE16 only)
+	uint32_t            lut_texture = 0;                // OpenGL palette texture "name"/ID
+	int                 lut_width = 0, lut_height = 0;  // palette texture width/height in entries
+	int                 lut_width_create = 0;           // palette texture width/height, pow2
+	int                 lut_height_create = 0;
+	std::vector<uint32_t> lut_data;                     // palette as last uploaded
+
 };
 
 // renderer_ogl is the information about OpenGL for the current screen
@@ -333,10 +342,12 @@ private:
 	void texture_compute_size_type(const render_texinfo *texsource, ogl_texture_info *texture, uint32_t flags);
 	ogl_texture_info *texture_create(const render_texinfo *texsource, uint32_t flags);
 	int texture_shader_create(const render_texinfo *texsource, ogl_texture_info *texture, uint32_t flags);
+	int texture_lut_create(const render_texinfo *texsource, ogl_texture_info *texture);
 	ogl_texture_info *texture_find(const render_primitive *prim);
 	void texture_coord_update(ogl_texture_info *texture, const render_primitive *prim, int shaderIdx);
 	void texture_mpass_flip(ogl_texture_info *texture, int shaderIdx);
 	void texture_shader_update(ogl_texture_info *texture, render_container *container,  int shaderIdx);
+	void texture_lut_update(ogl_texture_info *texture, const render_texinfo *texsource);
 	ogl_texture_info * texture_update(const render_primitive *prim, int shaderIdx);
 	void texture_disable(ogl_texture_info * texture);
 	void texture_all_disable();
@@ -858,6 +869,8 @@ void renderer_ogl::destroy_all_textures()
 			}
 
 			glDeleteTextures(1, (GLuint *)&texture->texture);
+			if (texture->lut_texture)
+				glDeleteTextures(1, (GLuint *)&texture->lut_texture);
 			if (texture->data_own)
 			{
 				free(texture->data);
@@ -1945,6 +1958,16 @@ int renderer_ogl::texture_shader_create(const render_texinfo *texsource, ogl_tex
 			m_width, m_height, surf_w_pow2, surf_h_pow2);
 	}
 
+	// indexed bitmaps are uploaded as-is and looked up in the shader, if possible
+	if ( texture->format==SDL_TEXFORMAT_PALETTE16 && m_glsl_program_num==1 &&
+			texsource->palette && texsource->palette_length && !texture->borderpix &&
+			gl_round_to_pow2((texsource->palette_length + 255) / 256) <= m_texture_max_height )
+	{
+		texture->lut_program = m_shader_tool->get_program_idx16_lut(glsl_shader_feature);
+		if ( texture->lut_program )
+			return texture_lut_create(texsource, texture);
+	}
+
 	// GL_TEXTURE0
 	// get a name for this texture
 	glGenTextures(1, (GLuint *)&texture->texture);
@@ -2007,6 +2030,93 @@ int renderer_ogl::texture_shader_create(const render_texinfo *texsource, ogl_tex
 	return 0;
 }
 
+//============================================================
+//  texture_lut_create
+//============================================================
+
+//
+// PALETTE16 screen bitmaps are uploaded unconverted as ALPHA16,
+// and the palette goes into a second texture on GL_TEXTURE1,
+// so the per-pixel lookup happens on the GPU instead of in copyline_palette16
+//
+int renderer_ogl::texture_lut_create(const render_texinfo *texsource, ogl_texture_info *texture)
+{
+	int uniform_location;
+	GLint _width, _height;
+
+	texture->lut_width  = std::min<int>(texsource->palette_length, 256);
+	texture->lut_height = (texsource->palette_length + texture->lut_width - 1) / texture->lut_width;
+	texture->lut_width_create  = gl_round_to_pow2(texture->lut_width);
+	texture->lut_height_create = gl_round_to_pow2(texture->lut_height);
+	// no conversion - the texture is fed straight from the bitmap
+	texture->nocopy = true;
+
+	m_shader_tool->pfn_glUseProgramObjectARB(texture->lut_program);
+
+	uniform_location = m_shader_tool->pfn_glGetUniformLocationARB(texture->lut_program, "color_texture");
+	m_shader_tool->pfn_glUniform1iARB(uniform_location, 0);
+	uniform_location = m_shader_tool->pfn_glGetUniformLocationARB(texture->lut_program, "colortable_texture");
+	m_shader_tool->pfn_glUniform1iARB(uniform_location, 1);
+	GL_CHECK_ERROR_NORMAL();
+
+	// GL_TEXTURE1: the palette
+	glGenTextures(1, (GLuint *)&texture->lut_texture);
+	m_glActiveTexture(GL_TEXTURE1);
+	glBindTexture(GL_TEXTURE_2D, texture->lut_texture);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8,
+			texture->lut_width_create, texture->lut_height_create,
+			0,
+			GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, nullptr);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	texture->lut_data.assign(texture->lut_width * texture->lut_height, 0);
+
+	// GL_TEXTURE0: the indices
+	glGenTextures(1, (GLuint *)&texture->texture);
+	m_glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_2D, texture->texture);
+
+	if ( m_shader_tool->texture_check_size(GL_TEXTURE_2D, 0, GL_ALPHA16,
+					texture->rawwidth_create, texture->rawheight_create,
+					0,
+					GL_ALPHA, GL_UNSIGNED_SHORT,
+					&_width, &_height, 1) )
+	{
+		osd_printf_error("cannot create bitmap texture, req: %dx%d, avail: %dx%d - bail out\n",
+			texture->rawwidth_create, texture->rawheight_create, (int)_width, (int)_height);
+		return -1;
+	}
+
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA16,
+			texture->rawwidth_create, texture->rawheight_create,
+			0,
+			GL_ALPHA, GL_UNSIGNED_SHORT, nullptr);
+
+	// indices must never be filtered - the bilinear shader filters the looked up colors
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+	if (texture->flags & PRIMFLAG_TEXWRAP_MASK)
+	{
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+	}
+	else
+	{
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	}
+
+	GL_CHECK_ERROR_NORMAL();
+
+	osd_printf_verbose("GL texture: palette lookup in shader, %d entries (%dx%d)\n",
+		texsource->palette_length, texture->lut_width, texture->lut_height);
+
+	return 0;
+}
+
 ogl_texture_info *renderer_ogl::texture_create(const render_texinfo *texsource, uint32_t flags)
 {
 	ogl_texture_info *texture;
@@ -2516,7 +2626,22 @@ void renderer_ogl::texture_set_data(ogl_texture_info *texture, const render_texi
 			(texsource->width * texture->xprescale + 2) * sizeof(uint32_t));
 	}
 
-	if ( texture->type == TEXTURE_TYPE_SHADER )
+	if ( texture->type == TEXTURE_TYPE_SHADER && texture->lut_program )
+	{
+		m_glActiveTexture(GL_TEXTURE0);
+		glBindTexture(texture->texTarget, texture->texture);
+
+		// the rows of a 16-bit bitmap need not be 4-byte aligned
+		glPixelStorei(GL_UNPACK_ROW_LENGTH, texture->texinfo.rowpixels);
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 2);
+
+		// and upload the indices
+		glTexSubImage2D(texture->texTarget, 0, 0, 0, texture->rawwidth, texture->rawheight,
+				GL_ALPHA, GL_UNSIGNED_SHORT, texture->data);
+
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+	}
+	else if ( texture->type == TEXTURE_TYPE_SHADER )
 	{
 		m_glActiveTexture(GL_TEXTURE0);
 		glBindTexture(texture->texTarget, texture->texture);
@@ -2766,7 +2891,7 @@ void renderer_ogl::texture_shader_update(ogl_texture_info *texture, render_conta
 		vid_attributes[1] = settings.m_contrast;
 		vid_attributes[2] = settings.m_brightness;
 		vid_attributes[3] = 0.0f;
-		uniform_location = m_shader_tool->pfn_glGetUniformLocationARB(m_glsl_program[shaderIdx], "vid_attributes");
+		uniform_location = m_shader_tool->pfn_glGetUniformLocationARB(texture->lut_program ? texture->lut_program : m_glsl_program[shaderIdx], "vid_attributes");
 		m_shader_tool->pfn_glUniform4fvARB(uniform_location, 1, &(vid_attributes[shaderIdx]));
 		if ( GL_CHECK_ERROR_QUIET() ) {
 			osd_printf_verbose("GLSL: could not set 'vid_attributes' for shader prog idx %d\n", shaderIdx);
@@ -2774,6 +2899,48 @@ void renderer_ogl::texture_shader_update(ogl_texture_info *texture, render_conta
 	}
 }
 
+void renderer_ogl::texture_lut_update(ogl_texture_info *texture, const render_texinfo *texsource)
+{
+	int uniform_location;
+
+	// the palette is small, so compare it on every use instead of trusting the bitmap's seqid
+	uint32_t const entries = std::min<uint32_t>(texsource->palette_length, texture->lut_data.size());
+	bool dirty = false;
+	for (uint32_t i = 0; i < entries; i++)
+	{
+		uint32_t const color = 0xff000000 | texsource->palette[i];
+		if (texture->lut_data[i] != color)
+		{
+			texture->lut_data[i] = color;
+			dirty = true;
+		}
+	}
+
+	m_glActiveTexture(GL_TEXTURE1);
+	glBindTexture(GL_TEXTURE_2D, texture->lut_texture);
+	if (dirty)
+	{
+		glPixelStorei(GL_UNPACK_ROW_LENGTH, texture->lut_width);
+		glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, texture->lut_width, texture->lut_height,
+				GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, &texture->lut_data[0]);
+	}
+	m_glActiveTexture(GL_TEXTURE0);
+
+	// the program is shared by all indexed textures, so the sizes are set on every use
+	GLfloat colortable_sz[2] = { (GLfloat)texture->lut_width, (GLfloat)texture->lut_height };
+	uniform_location = m_shader_tool->pfn_glGetUniformLocationARB(texture->lut_program, "colortable_sz");
+	m_shader_tool->pfn_glUniform2fvARB(uniform_location, 1, &(colortable_sz[0]));
+
+	GLfloat colortable_pow2_sz[2] = { (GLfloat)texture->lut_width_create, (GLfloat)texture->lut_height_create };
+	uniform_location = m_shader_tool->pfn_glGetUniformLocationARB(texture->lut_program, "colortable_pow2_sz");
+	m_shader_tool->pfn_glUniform2fvARB(uniform_location, 1, &(colortable_pow2_sz[0]));
+
+	GLfloat color_texture_pow2_sz[2] = { (GLfloat)texture->rawwidth_create, (GLfloat)texture->rawheight_create };
+	uniform_location = m_shader_tool->pfn_glGetUniformLocationARB(texture->lut_program, "color_texture_pow2_sz");
+	m_shader_tool->pfn_glUniform2fvARB(uniform_location, 1, &(color_texture_pow2_sz[0]));
+	GL_CHECK_ERROR_NORMAL();
+}
+
 ogl_texture_info * renderer_ogl::texture_update(const render_primitive *prim, int shaderIdx)
 {
 	ogl_texture_info *texture = texture_find(prim);
@@ -2788,7 +2955,7 @@ ogl_texture_info * renderer_ogl::texture_update(const render_primitive *prim, in
 	{
 		if ( texture->type == TEXTURE_TYPE_SHADER )
 		{
-			m_shader_tool->pfn_glUseProgramObjectARB(m_glsl_program[shaderIdx]); // back to our shader
+			m_shader_tool->pfn_glUseProgramObjectARB(texture->lut_program ? texture->lut_program : m_glsl_program[shaderIdx]); // back to our shader
 		}
 		else if ( texture->type == TEXTURE_TYPE_DYNAMIC )
 		{
@@ -2807,6 +2974,10 @@ ogl_texture_info * renderer_ogl::texture_update(const render_primitive *prim, in
 		if ( texture->type == TEXTURE_TYPE_SHADER )
 		{
 			texture_shader_update(texture, prim->container, shaderIdx);
+			if ( texture->lut_program )
+			{
+				texture_lut_update(texture, &prim->texture);
+			}
 			if ( m_glsl_program_num>1 )
 			{
 				texture_mpass_flip(texture, shaderIdx);
@@ -20,14 +20,19 @@
 #include <stdlib.h>
 #include <poll.h>
 
+#include <algorithm>
+#include <atomic>
+#include <memory>
 #include <mutex>
 #include <thread>
 #include <pulse/pulseaudio.h>
 
 #include "modules/lib/osdobj_common.h"
+#include "osdcore.h"
 
 using osd::s16;
 using osd::u32;
+using osd::u64;
 
 class sound_pulse : public osd_module, public sound_module
 {
@@ -44,20 +49,32 @@ public:
 	virtual void set_mastervolume(int attenuation) override;
 
 private:
-	struct abuffer {
-		size_t cpos;
-		std::vector<u32> data;
-	};
-
 	std::thread *m_thread;
 	pa_mainloop *m_mainloop;
 	pa_context *m_context;
 	pa_stream *m_stream;
 	std::mutex m_mutex;
 
-	std::vector<abuffer> m_buffers;
+	// lock-free SPSC ring of stereo frames: the emulation thread writes, the mainloop thread reads
+	std::unique_ptr<u32 []> m_ring;
+	u32 m_ring_size;
+	std::atomic<u32> m_ring_read;
+	std::atomic<u32> m_ring_write;
+	u32 m_target_frames;                // buffered frames we try to stay around
+	u32 m_sample_rate;
 
+	// owned by the mainloop thread
 	u32 m_last_sample;
+	u32 m_over_target_requests;         // consecutive requests with too much buffered
+	bool m_draining;                    // dropping frames to get back to the target?
+	bool m_started;                     // have we received any audio yet?
+	u64 m_latency_total_usec;           // accumulated latency measurements
+	u64 m_latency_max_usec;             // largest latency measured
+	u32 m_latency_count;                // number of latency measurements
+	u32 m_underflows;
+	std::atomic<u32> m_overflows;
+
+	u32 ring_count() const { return (m_ring_write.load(std::memory_order_acquire) - m_ring_read.load(std::memory_order_acquire) + m_ring_size) % m_ring_size; }
 	int m_new_volume_value;
 	bool m_setting_volume;
 	bool m_new_volume;
@@ -227,31 +244,61 @@ void sound_pulse::stream_write_request(size_t size)
 	}
 	size >>= 2;
 
-	std::unique_lock<std::mutex> lock(m_mutex);
-	while(size) {
-		if(m_buffers.empty()) {
-			std::vector<u32> zero(size, m_last_sample);
-			int err = pa_stream_write(m_stream, zero.data(), size << 2, nullptr, 0, PA_SEEK_RELATIVE);
-			if(err)
-				generic_pa_error("stream write", err);
-			size = 0;
-
-		} else {
-			auto &buf = m_buffers[0];
-			size_t csz = size;
-			size_t cur = buf.data.size() - buf.cpos;
-			if(csz > cur)
-				csz = cur;
-			int err = pa_stream_write(m_stream, buf.data.data() + buf.cpos, csz << 2, nullptr, 0, PA_SEEK_RELATIVE);
-			if(err)
-				generic_pa_error("stream write", err);
-			if(csz == cur)
-				m_buffers.erase(m_buffers.begin());
-			else
-				buf.cpos += csz;
-			size -= csz;
-		}
+	// if we have stayed well above the target for a while, the emulation is running a little
+	// fast relative to the sound card; drop a few frames per request to pull the latency back
+	// down gradually, rather than jumping and making an audible click
+	u32 available = ring_count();
+	if(available > 2 * m_target_frames + size) {
+		if(++m_over_target_requests >= 16)
+			m_draining = true;
+	} else
+		m_over_target_requests = 0;
+	if(available <= m_target_frames + size)
+		m_draining = false;
+
+	// measure the latency: what's in the ring plus what the server reports
+	pa_usec_t server_usec;
+	int negative;
+	if(m_started && !pa_stream_get_latency(m_stream, &server_usec, &negative)) {
+		u64 const usec = (negative ? 0 : server_usec) + u64(available) * 1000000 / m_sample_rate;
+		m_latency_total_usec += usec;
+		m_latency_max_usec = std::max(m_latency_max_usec, usec);
+		m_latency_count++;
 	}
+
+	void *data;
+	size_t bytes = size << 2;
+	int err = pa_stream_begin_write(m_stream, &data, &bytes);
+	if(err)
+		generic_pa_error("stream begin write", err);
+	size = std::min<size_t>(size, bytes >> 2);
+	u32 *const dest = reinterpret_cast<u32 *>(data);
+
+	// copy what we have, repeating the last sample if we run dry; when draining, skip about
+	// one frame in 128, spread evenly through the request
+	u32 const copy = std::min<u32>(size, available);
+	u32 const drop = m_draining ? std::min<u32>(std::max<u32>(copy >> 7, 1), available - copy - m_target_frames) : 0;
+	u32 readpos = m_ring_read.load(std::memory_order_relaxed);
+	for(u32 index = 0; index < copy; index++) {
+		dest[index] = m_ring[readpos];
+		readpos = (readpos + 1) % m_ring_size;
+		if(drop && (((index + 1) * drop / copy) != (index * drop / copy)))
+			readpos = (readpos + 1) % m_ring_size;
+	}
+	m_ring_read.store(readpos, std::memory_order_release);
+	if(copy)
+		m_last_sample = dest[copy - 1];
+	if(copy < size) {
+		std::fill(dest + copy, dest + size, m_last_sample);
+		if(m_started)
+			m_underflows++;
+	}
+	if(copy)
+		m_started = true;
+
+	err = pa_stream_write(m_stream, data, size << 2, nullptr, 0, PA_SEEK_RELATIVE);
+	if(err)
+		generic_pa_error("stream write", err);
 }
 
 void sound_pulse::i_stream_write_request(pa_stream *, size_t size, void *self)
@@ -276,6 +323,14 @@ void sound_pulse::stop_mainloop(int err)
 int sound_pulse::init(osd_interface &osd, osd_options const &options)
 {
 	m_last_sample = 0;
+	m_over_target_requests = 0;
+	m_draining = false;
+	m_started = false;
+	m_latency_total_usec = 0;
+	m_latency_max_usec = 0;
+	m_latency_count = 0;
+	m_underflows = 0;
+	m_overflows = 0;
 	m_setting_volume = false;
 	m_new_volume = false;
 	m_new_volume_value = 0;
@@ -298,6 +353,14 @@ int sound_pulse::init(osd_interface &osd, osd_options const &options)
 
 	const int sample_rate = options.sample_rate();
 
+	// each audio_latency step adds 20ms of buffering; 0 asks for as little as we can get away with
+	m_sample_rate = sample_rate;
+	m_target_frames = options.audio_latency() > 0 ? (sample_rate * std::min(options.audio_latency(), 5)) / 50 : sample_rate / 200;
+	m_ring_size = std::max<u32>(4 * m_target_frames, sample_rate / 5) + 1;
+	m_ring = std::make_unique<u32 []>(m_ring_size);
+	m_ring_read = 0;
+	m_ring_write = 0;
+
 	pa_sample_spec ss;
 #ifdef LSB_FIRST
 	ss.format = PA_SAMPLE_S16LE;
@@ -317,7 +380,7 @@ int sound_pulse::init(osd_interface &osd, osd_options const &options)
 	battr.prebuf = uint32_t(-1);
 	battr.tlength = sample_rate / 1000;
 
-	err = pa_stream_connect_playback(m_stream, nullptr, &battr, PA_STREAM_ADJUST_LATENCY, nullptr, nullptr);
+	err = pa_stream_connect_playback(m_stream, nullptr, &battr, pa_stream_flags_t(PA_STREAM_ADJUST_LATENCY | PA_STREAM_INTERPOLATE_TIMING | PA_STREAM_AUTO_TIMING_UPDATE), nullptr, nullptr);
 	if(err)
 		generic_pa_error("stream connect playback", err);
 
@@ -329,23 +392,25 @@ int sound_pulse::init(osd_interface &osd, osd_options const &options)
 
 void sound_pulse::update_audio_stream(bool is_throttled, const s16 *buffer, int samples_this_frame)
 {
-	std::unique_lock<std::mutex> lock(m_mutex);
-	m_buffers.resize(m_buffers.size() + 1);
-	auto &buf = m_buffers.back();
-	buf.cpos = 0;
-	buf.data.resize(samples_this_frame);
-	memcpy(buf.data.data(), buffer, samples_this_frame*4);
-	m_last_sample = buf.data.back();
-
-	if(m_buffers.size() > 10)
-		// If there way too many buffers, drop some so only 10 are left (roughly 0.2s)
-		m_buffers.erase(m_buffers.begin(), m_buffers.begin() + m_buffers.size() - 10);
-
-	else if(m_buffers.size() >= 5)
-		// If there are too many buffers, remove five sample per buffer
-		// to slowly resync to reduce latency (4 seconds to
-		// compensate one buffer roughly)
-		buf.cpos = 5;
+	if(!m_ring)
+		return;
+
+	// drop whatever doesn't fit; the reader skips forward if we stay too far ahead
+	u32 const space = m_ring_size - 1 - ring_count();
+	u32 count = samples_this_frame;
+	if(count > space) {
+		count = space;
+		m_overflows++;
+	}
+
+	u32 writepos = m_ring_write.load(std::memory_order_relaxed);
+	for(u32 index = 0; index < count; index++) {
+		u32 frame;
+		memcpy(&frame, &buffer[index * 2], sizeof(frame));
+		m_ring[writepos] = frame;
+		writepos = (writepos + 1) % m_ring_size;
+	}
+	m_ring_write.store(writepos, std::memory_order_release);
 }
 
 void sound_pulse::volume_set_notify(int success)
@@ -393,6 +458,11 @@ void sound_pulse::exit()
 	pa_stream_unref(m_stream);
 	pa_context_unref(m_context);
 	m_thread->join();
+
+	if(m_latency_count)
+		osd_printf_verbose("Sound: average latency %.1f ms, maximum %.1f ms\n", double(m_latency_total_usec) / double(m_latency_count) / 1000.0, double(m_latency_max_usec) / 1000.0);
+	if(m_overflows || m_underflows)
+		osd_printf_verbose("Sound: overflows=%d underflows=%d\n", int(m_overflows), m_underflows);
 	pa_mainloop_free(m_mainloop);
 	delete m_thread;
 
@@ -405,7 +475,7 @@ void sound_pulse::exit()
 	m_mainloop = nullptr;
 	m_context = nullptr;
 	m_stream = nullptr;
-	m_buffers.clear();
+	m_ring.reset();
 }
 
 #else
@@ -313,6 +313,15 @@ void sound_sdl::set_mastervolume(int _attenuation)
 void sound_sdl::sdl_callback(void *userdata, Uint8 *stream, int len)
 {
 	sound_sdl *thiz = reinterpret_cast<sound_sdl *>(userdata);
+
+	// SDL calls us on its own audio thread
+	static thread_local bool placed = false;
+	if (!placed)
+	{
+		osd_thread_set_role(OSD_THREAD_ROLE_AUDIO);
+		placed = true;
+	}
+
 	size_t const free_size = thiz->stream_buffer->free_size();
 	size_t const data_size = thiz->stream_buffer->data_size();
 
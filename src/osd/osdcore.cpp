@@ -14,6 +14,15 @@
 #include <cstdio>
 #include <shellapi.h>
 #include "strconv.h"
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+#endif
+
+#if defined(__linux__)
+#include <sys/prctl.h>
+#include <cerrno>
+#include <time.h>
 #endif
 
 static const int MAXSTACK = 10;
@@ -171,8 +180,39 @@ osd_ticks_t osd_ticks_per_second() noexcept
 void osd_sleep(osd_ticks_t duration) noexcept
 {
 #ifdef _WIN32
-// sleep_for appears to oversleep on Windows with gcc 8
+	// a high resolution waitable timer (Windows 10 1803 and later) can wake within
+	// a fraction of a millisecond, so much less time is left to spin
+	struct waitable_timer
+	{
+		waitable_timer() : handle(CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS)) { }
+		~waitable_timer() { if (handle) CloseHandle(handle); }
+		HANDLE const handle;
+	};
+	thread_local waitable_timer const timer;
+	if (timer.handle)
+	{
+		// negative due times are relative, in 100ns units
+		LARGE_INTEGER due;
+		due.QuadPart = -LONGLONG(duration * 10'000'000 / osd_ticks_per_second());
+		if (SetWaitableTimerEx(timer.handle, &due, 0, nullptr, nullptr, nullptr, 0))
+		{
+			WaitForSingleObject(timer.handle, INFINITE);
+			return;
+		}
+	}
+
+	// sleep_for appears to oversleep on Windows with gcc 8
 	Sleep(duration / (osd_ticks_per_second() / 1000));
+#elif defined(__linux__)
+	// the default 50us timer slack is a large part of the jitter in short sleeps
+	thread_local bool const slack_set = (prctl(PR_SET_TIMERSLACK, 1UL, 0UL, 0UL, 0UL) == 0);
+	(void)slack_set;
+
+	auto const nsec = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::duration(duration)).count();
+	timespec ts;
+	ts.tv_sec = nsec / 1'000'000'000;
+	ts.tv_nsec = nsec % 1'000'000'000;
+	while (clock_nanosleep(CLOCK_MONOTONIC, 0, &ts, &ts) == EINTR) { }
 #else
 	std::this_thread::sleep_for(std::chrono::high_resolution_clock::duration(duration));
 #endif
@@ -337,6 +337,64 @@ void osd_work_item_release(osd_work_item *item);
 
 
 
+/***************************************************************************
+    THREAD PLACEMENT INTERFACES
+***************************************************************************/
+
+/* what a thread is used for, which decides the CPUs and scheduling class it gets */
+enum osd_thread_role
+{
+	OSD_THREAD_ROLE_EMULATION,
+	OSD_THREAD_ROLE_RENDER,
+	OSD_THREAD_ROLE_AUDIO,
+	OSD_THREAD_ROLE_WORK,
+	OSD_THREAD_ROLE_IO,
+	OSD_THREAD_ROLE_COUNT
+};
+
+
+/*-----------------------------------------------------------------------------
+    osd_thread_role_configure: set up the placement for each thread role
+
+    Parameters:
+
+        affinity - nullptr or an empty string to leave affinity to the OS, or
+            role=cpus pairs separated by semicolons, where role is one of
+            emu, render, audio, work and io, and cpus is a comma-separated
+            list of CPU numbers and ranges (e.g. "emu=0-1;work=2-7")
+
+        qos - true to ask the OS to favour fast cores for the emulation,
+            render, audio and worker threads and efficient cores for I/O
+            threads
+
+    Return value:
+
+        false if the affinity string could not be parsed; roles that were
+        parsed before the error are still configured.
+
+    Notes:
+
+        Only threads that call osd_thread_set_role afterwards are affected.
+        Work queue threads do this themselves when they start.
+-----------------------------------------------------------------------------*/
+bool osd_thread_role_configure(const char *affinity, bool qos);
+
+
+/*-----------------------------------------------------------------------------
+    osd_thread_set_role: apply a role's placement to the calling thread
+
+    Parameters:
+
+        role - the role the calling thread plays
+
+    Return value:
+
+        None.
+-----------------------------------------------------------------------------*/
+void osd_thread_set_role(osd_thread_role role);
+
+
+
 /***************************************************************************
     MISCELLANEOUS INTERFACES
 ***************************************************************************/
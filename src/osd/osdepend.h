@@ -69,6 +69,7 @@ public:
 	virtual void input_update(bool relative_reset) = 0;
 	virtual void check_osd_inputs() = 0;
 	virtual void set_verbose(bool print_verbose) = 0;
+	virtual bool presents_on_vblank() = 0; // true if update() waits for VBLANK, so the display can pace emulation
 
 	// debugger overridables
 	virtual void init_debugger() = 0;
@@ -156,6 +156,25 @@ public:
 	/// \param [in] filename Path to the file to delete.
 	/// \return Result of the operation.
 	static std::error_condition remove(std::string const &filename) noexcept;
+
+	/// \brief Rename a file
+	///
+	/// Replaces the destination if it exists.  This is atomic if both
+	/// paths are on the same volume and the host supports it.
+	/// \param [in] oldname Path to the file to rename.
+	/// \param [in] newname New path for the file.
+	/// \return Result of the operation.
+	static std::error_condition rename(std::string const &oldname, std::string const &newname) noexcept;
+
+	/// \brief Write a file or directory to persistent storage
+	///
+	/// Waits until the contents of the file, or the entries of the
+	/// directory, have reached persistent storage.  Syncing a
+	/// directory after renaming a file into it makes the rename
+	/// durable.  Hosts that can't sync directories report success.
+	/// \param [in] path Path to the file or directory to sync.
+	/// \return Result of the operation.
+	static std::error_condition sync(std::string const &path) noexcept;
 };
 
 
@@ -271,6 +290,31 @@ bool osd_is_absolute_path(const std::string &path) noexcept;
 std::error_condition osd_get_full_path(std::string &dst, std::string const &path) noexcept;
 
 
+/// \brief Map the start of a file into memory.
+///
+/// Creates a private, copy-on-write mapping of a file for reading.
+/// Pages that are never written remain backed by the file, so they
+/// can be shared with other processes mapping the same file.  Writes
+/// are never propagated to the file.  Not all platforms support this.
+/// \param [in] path Path to the file to map.
+/// \param [in] length Number of bytes to map.  Must not be larger than
+///   the file.
+/// \param [out] base Receives the address of the mapping if the
+///   operation succeeds.  Not valid if the operation fails.
+/// \return Result of the operation.
+/// \sa osd_unmap_file
+std::error_condition osd_map_file(std::string const &path, std::uint64_t length, void *&base) noexcept;
+
+
+/// \brief Release a mapping created with osd_map_file.
+///
+/// \param [in] base Address of the mapping.
+/// \param [in] length Number of bytes mapped, as passed to
+///   osd_map_file.
+/// \sa osd_map_file
+void osd_unmap_file(void *base, std::uint64_t length) noexcept;
+
+
 /// \brief Retrieves the volume name.
 ///
 /// \param [in] idx Index number of volume.
@@ -39,6 +39,10 @@ class osd_netdev *open_netdev(int id, class device_network_interface *ifdev, int
 }
 
 osd_netdev::osd_netdev(class device_network_interface *ifdev, int rate)
+	: m_rx_head(0)
+	, m_rx_tail(0)
+	, m_rx_exit(false)
+	, m_rx_dropped(0)
 {
 	m_dev = ifdev;
 	m_timer = ifdev->device().timer_alloc(FUNC(osd_netdev::recv), this);
@@ -47,6 +51,8 @@ osd_netdev::osd_netdev(class device_network_interface *ifdev, int rate)
 
 osd_netdev::~osd_netdev()
 {
+	// derived classes should have stopped it before closing their handle
+	stop_receive_thread();
 }
 
 void osd_netdev::start()
@@ -68,6 +74,21 @@ void osd_netdev::recv(int param)
 {
 	uint8_t *buf;
 	int len;
+
+	if(m_rx_queue)
+	{
+		// an empty queue costs one atomic load - no system calls on the emulation thread
+		unsigned tail = m_rx_tail.load(std::memory_order_relaxed);
+		while(m_timer->enabled() && (tail != m_rx_head.load(std::memory_order_acquire)))
+		{
+			rx_frame &frame = m_rx_queue[tail];
+			m_dev->recv_cb(frame.data, frame.len);
+			tail = (tail + 1) & (RX_QUEUE_SIZE - 1);
+			m_rx_tail.store(tail, std::memory_order_release);
+		}
+		return;
+	}
+
 	//const char atalkmac[] = { 0x09, 0x00, 0x07, 0xff, 0xff, 0xff };
 	while(m_timer->enabled() && (len = recv_dev(&buf)))
 	{
@@ -92,6 +113,55 @@ int osd_netdev::recv_dev(uint8_t **buf)
 	return 0;
 }
 
+int osd_netdev::recv_dev_wait(uint8_t *buf, int maxlen, int timeout_ms)
+{
+	return 0;
+}
+
+void osd_netdev::start_receive_thread()
+{
+	if(m_rx_queue)
+		return;
+	m_rx_queue = std::make_unique<rx_frame []>(RX_QUEUE_SIZE);
+	m_rx_head = m_rx_tail = 0;
+	m_rx_exit = false;
+	m_rx_thread = std::thread([this] () { receive_thread(); });
+}
+
+void osd_netdev::stop_receive_thread()
+{
+	if(!m_rx_thread.joinable())
+		return;
+	m_rx_exit = true;
+	m_rx_thread.join();
+	if(m_rx_dropped)
+		osd_printf_verbose("netdev: %u received frames dropped with the queue full\n", m_rx_dropped.load());
+}
+
+void osd_netdev::receive_thread()
+{
+	uint8_t scratch[RX_FRAME_SIZE];
+	while(!m_rx_exit.load(std::memory_order_relaxed))
+	{
+		// wait in short steps so we notice being asked to stop
+		unsigned const head = m_rx_head.load(std::memory_order_relaxed);
+		unsigned const next = (head + 1) & (RX_QUEUE_SIZE - 1);
+		bool const full = next == m_rx_tail.load(std::memory_order_acquire);
+		rx_frame &frame = m_rx_queue[head];
+		int const len = recv_dev_wait(full ? scratch : frame.data, RX_FRAME_SIZE, 100);
+		if(len <= 0)
+			continue;
+		if(full)
+		{
+			// the emulated side isn't keeping up, drop the newest frame like a real NIC would
+			m_rx_dropped.fetch_add(1, std::memory_order_relaxed);
+			continue;
+		}
+		frame.len = len;
+		m_rx_head.store(next, std::memory_order_release);
+	}
+}
+
 void osd_netdev::set_mac(const char *mac)
 {
 }
@@ -6,6 +6,9 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
 
 class osd_netdev;
 
@@ -43,11 +46,37 @@ public:
 protected:
 	virtual int recv_dev(uint8_t **buf);
 
+	// backends that can wait for a frame override this and call
+	// start_receive_thread() once open and stop_receive_thread() before
+	// closing; frames are then queued by a host thread and the timer
+	// only has to look at the queue
+	virtual int recv_dev_wait(uint8_t *buf, int maxlen, int timeout_ms);
+	void start_receive_thread();
+	void stop_receive_thread();
+
 private:
+	static constexpr unsigned RX_QUEUE_SIZE = 64;   // must be a power of two
+	static constexpr int RX_FRAME_SIZE = 2048;
+
+	struct rx_frame
+	{
+		int len;
+		uint8_t data[RX_FRAME_SIZE];
+	};
+
 	void recv(int param);
+	void receive_thread();
 
 	class device_network_interface *m_dev;
 	emu_timer *m_timer;
+
+	// single producer/single consumer queue filled by the receive thread
+	std::unique_ptr<rx_frame []> m_rx_queue;
+	std::atomic<unsigned> m_rx_head;
+	std::atomic<unsigned> m_rx_tail;
+	std::atomic<bool> m_rx_exit;
+	std::atomic<uint32_t> m_rx_dropped;
+	std::thread m_rx_thread;
 };
 
 class osd_netdev *open_netdev(int id, class device_network_interface *ifdev, int rate);
@@ -31,6 +31,13 @@
 #include <pthread.h>
 #endif
 
+#if defined(SDLMAME_MACOSX) || defined(OSD_MAC)
+#include <pthread/qos.h>
+#endif
+
+#include <cstdlib>
+#include <cstring>
+
 //============================================================
 //  DEBUGGING
 //============================================================
@@ -108,6 +115,8 @@ struct work_thread_info
 		, handle(nullptr)
 		, wakeevent(true, false)  // manual reset, not signalled
 		, id(aid)
+		, list(nullptr)
+		, tailptr(&list)
 #if KEEP_STATISTICS
 		, itemsdone(0)
 		, actruntime(0)
@@ -123,6 +132,10 @@ struct work_thread_info
 	osd_event           wakeevent;      // wake event for the thread
 	uint32_t            id;
 
+	std::mutex          lock;           // lock for protecting this thread's items
+	osd_work_item *     list;           // items queued for this thread; others steal from here when idle
+	osd_work_item **    tailptr;        // pointer to the tail pointer of the list
+
 #if KEEP_STATISTICS
 	int32_t             itemsdone;
 	osd_ticks_t         actruntime;
@@ -136,10 +149,10 @@ struct work_thread_info
 struct osd_work_queue
 {
 	osd_work_queue()
-		: list(nullptr)
-		, tailptr(nullptr)
-		, free(nullptr)
+		: free(nullptr)
 		, items(0)
+		, pending(0)
+		, nextthread(0)
 		, livethreads(0)
 		, waiting(0)
 		, exiting(0)
@@ -151,15 +164,17 @@ struct osd_work_queue
 		, setevents(0)
 		, extraitems(0)
 		, spinloops(0)
+		, steals(0)
+		, contended(0)
 #endif
 	{
 	}
 
-	std::mutex          lock;           // lock for protecting the queue
-	std::atomic<osd_work_item *> list;  // list of items in the queue
-	osd_work_item ** volatile tailptr;  // pointer to the tail pointer of work items in the queue
+	std::mutex          lock;           // lock for protecting the free list and item events
 	std::atomic<osd_work_item *> free;  // free list of work items
 	std::atomic<int32_t>  items;          // items in the queue
+	std::atomic<int32_t>  pending;        // items not yet picked up by a thread
+	std::atomic<uint32_t> nextthread;     // thread list that gets the next batch of items
 	std::atomic<int32_t>  livethreads;    // number of live threads
 	std::atomic<int32_t>  waiting;        // is someone waiting on the queue to complete?
 	std::atomic<int32_t>  exiting;        // should the threads exit on their next opportunity?
@@ -173,6 +188,8 @@ struct osd_work_queue
 	std::atomic<int32_t>  setevents;      // number of times we called SetEvent
 	std::atomic<int32_t>  extraitems;     // how many extra items we got after the first in the queue loop
 	std::atomic<int32_t>  spinloops;      // how many times spinning bought us more items
+	std::atomic<int32_t>  steals;         // items taken from another thread's list
+	std::atomic<int32_t>  contended;      // times a thread's list lock was already held
 #endif
 };
 
@@ -207,6 +224,10 @@ struct osd_work_item
 
 int osd_num_processors = 0;
 
+// CPUs each thread role may run on (0 = leave it to the OS), and whether to set scheduling classes
+static uint64_t thread_role_affinity[OSD_THREAD_ROLE_COUNT] = { 0 };
+static bool thread_role_qos = false;
+
 //============================================================
 //  FUNCTION PROTOTYPES
 //============================================================
@@ -215,6 +236,7 @@ static int effective_num_processors(bool heavy_mt);
 static void *worker_thread_entry(void *param);
 static void worker_thread_process(osd_work_queue *queue, work_thread_info *thread);
 static bool queue_has_list_items(osd_work_queue *queue);
+static osd_work_item *pop_work_item(osd_work_queue *queue, work_thread_info *thread);
 
 //============================================================
 //  osd_thread_adjust_priority
@@ -244,6 +266,127 @@ int thread_adjust_priority(std::thread *thread, int adjust)
 	return true;
 }
 
+//============================================================
+//  osd_thread_role_configure
+//============================================================
+
+bool osd_thread_role_configure(const char *affinity, bool qos)
+{
+	static char const *const names[OSD_THREAD_ROLE_COUNT] = { "emu", "render", "audio", "work", "io" };
+
+	thread_role_qos = qos;
+	std::fill(std::begin(thread_role_affinity), std::end(thread_role_affinity), 0);
+	if (!affinity)
+		return true;
+
+	// role=cpus[;role=cpus...]
+	char const *pos = affinity;
+	while (*pos)
+	{
+		char const *const end = pos + strcspn(pos, ";");
+		char const *const equals = std::find(pos, end, '=');
+		if (equals == end)
+			return false;
+
+		int role = 0;
+		while ((role < OSD_THREAD_ROLE_COUNT) && (size_t(equals - pos) != strlen(names[role]) || strncmp(pos, names[role], equals - pos)))
+			role++;
+		if (role == OSD_THREAD_ROLE_COUNT)
+			return false;
+
+		// n or n-m, separated by commas
+		uint64_t mask = 0;
+		char const *cpus = equals + 1;
+		while (cpus < end)
+		{
+			char *next;
+			unsigned long const first = strtoul(cpus, &next, 10);
+			unsigned long last = first;
+			if (next == cpus)
+				return false;
+			if (*next == '-')
+			{
+				cpus = next + 1;
+				last = strtoul(cpus, &next, 10);
+				if (next == cpus)
+					return false;
+			}
+			if ((first > last) || (last >= 64) || ((next != end) && (*next != ',')))
+				return false;
+			for (unsigned long cpu = first; cpu <= last; cpu++)
+				mask |= uint64_t(1) << cpu;
+			cpus = (next == end) ? end : (next + 1);
+		}
+		thread_role_affinity[role] = mask;
+
+		pos = *end ? (end + 1) : end;
+	}
+	return true;
+}
+
+
+//============================================================
+//  osd_thread_set_role
+//============================================================
+
+void osd_thread_set_role(osd_thread_role role)
+{
+	uint64_t const mask = thread_role_affinity[role];
+	bool const efficient = (role == OSD_THREAD_ROLE_IO);
+
+#if defined(OSD_WINDOWS) || defined(SDLMAME_WIN32)
+	if (mask)
+		SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(mask));
+
+	if (thread_role_qos)
+	{
+		// opt in or out of EcoQoS, which is what steers threads towards efficiency cores (Windows 10 1709 and later)
+		struct power_throttling_state { ULONG Version, ControlMask, StateMask; };
+		typedef BOOL (WINAPI *set_thread_information_fn)(HANDLE, int, LPVOID, DWORD);
+		static auto const set_thread_information = reinterpret_cast<set_thread_information_fn>(
+				reinterpret_cast<void (*)()>(GetProcAddress(GetModuleHandle(TEXT("kernel32.dll")), "SetThreadInformation")));
+		if (set_thread_information)
+		{
+			int const thread_power_throttling = 3;
+			ULONG const execution_speed = 0x1;
+			power_throttling_state state = { 1, execution_speed, efficient ? execution_speed : 0 };
+			set_thread_information(GetCurrentThread(), thread_power_throttling, &state, sizeof(state));
+		}
+	}
+#elif defined(SDLMAME_MACOSX) || defined(OSD_MAC)
+	// there's no CPU affinity on macOS, but the QoS class decides between performance and efficiency cores
+	if (thread_role_qos)
+	{
+		qos_class_t qos_class;
+		switch (role)
+		{
+		case OSD_THREAD_ROLE_WORK:  qos_class = QOS_CLASS_USER_INITIATED;   break;
+		case OSD_THREAD_ROLE_IO:    qos_class = QOS_CLASS_UTILITY;          break;
+		default:                    qos_class = QOS_CLASS_USER_INTERACTIVE; break;
+		}
+		pthread_set_qos_class_self_np(qos_class, 0);
+	}
+	(void)mask;
+	(void)efficient;
+#elif defined(SDLMAME_LINUX) && !defined(SDLMAME_ANDROID)
+	// Linux has no QoS classes; the scheduler's capacity awareness handles hybrid CPUs
+	if (mask)
+	{
+		cpu_set_t set;
+		CPU_ZERO(&set);
+		for (int cpu = 0; cpu < 64; cpu++)
+			if ((mask >> cpu) & 1)
+				CPU_SET(cpu, &set);
+		pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+	}
+	(void)efficient;
+#else
+	(void)mask;
+	(void)efficient;
+#endif
+}
+
+
 //============================================================
 //  osd_work_queue_alloc
 //============================================================
@@ -261,7 +404,6 @@ osd_work_queue *osd_work_queue_alloc(int flags)
 	queue = new osd_work_queue();
 
 	// initialize basic queue members
-	queue->tailptr = (osd_work_item **)&queue->list;
 	queue->flags = flags;
 
 	// determine how many threads to create...
@@ -376,11 +518,26 @@ bool osd_work_queue_wait(osd_work_queue *queue, osd_ticks_t timeout)
 		begin_timing(thread->waittime);
 	}
 
-	// reset our done event and double-check the items before waiting
-	queue->doneevent.reset();
+	// reset our done event and double-check the items before waiting; a thread running out of
+	// work sets the event even if others are still busy, so keep waiting until we hit 0
+	osd_ticks_t const stoptime = (timeout == OSD_EVENT_WAIT_INFINITE) ? timeout : (osd_ticks() + timeout);
 	queue->waiting = true;
-	if (queue->items != 0)
-		queue->doneevent.wait(timeout);
+	while (queue->items != 0)
+	{
+		queue->doneevent.reset();
+		if (queue->items == 0)
+			break;
+
+		osd_ticks_t remaining = timeout;
+		if (timeout != OSD_EVENT_WAIT_INFINITE)
+		{
+			osd_ticks_t const now = osd_ticks();
+			if (now >= stoptime)
+				break;
+			remaining = stoptime - now;
+		}
+		queue->doneevent.wait(remaining);
+	}
 	queue->waiting = false;
 
 	// return true if we actually hit 0
@@ -437,9 +594,18 @@ void osd_work_queue_free(osd_work_queue *queue)
 	}
 #endif
 
-	// free the list
+	// free all items still queued, then the threads
 	for (auto & th : queue->thread)
+	{
+		while (th->list != nullptr)
+		{
+			auto *item = th->list;
+			th->list = item->next;
+			delete item->event;
+			delete item;
+		}
 		delete th;
+	}
 	queue->thread.clear();
 
 	// free all items in the free list
@@ -451,20 +617,13 @@ void osd_work_queue_free(osd_work_queue *queue)
 		delete item;
 	}
 
-	// free all items in the active list
-	while (queue->list.load() != nullptr)
-	{
-		auto *item = (osd_work_item *)queue->list;
-		queue->list = item->next;
-		delete item->event;
-		delete item;
-	}
-
 #if KEEP_STATISTICS
 	printf("Items queued   = %9d\n", queue->itemsqueued.load());
 	printf("SetEvent calls = %9d\n", queue->setevents.load());
 	printf("Extra items    = %9d\n", queue->extraitems.load());
 	printf("Spin loops     = %9d\n", queue->spinloops.load());
+	printf("Steals         = %9d\n", queue->steals.load());
+	printf("Contended      = %9d\n", queue->contended.load());
 #endif
 
 	// free the queue itself
@@ -478,8 +637,14 @@ void osd_work_queue_free(osd_work_queue *queue)
 
 osd_work_item *osd_work_item_queue_multiple(osd_work_queue *queue, osd_work_callback callback, int32_t numitems, void *parambase, int32_t paramstep, uint32_t flags)
 {
-	osd_work_item *itemlist = nullptr, *lastitem = nullptr;
-	osd_work_item **item_tailptr = &itemlist;
+	// deal the items out to the threads' lists so they don't all contend on one lock
+	uint32_t const numlists = queue->thread.size();
+	uint32_t const firstlist = queue->nextthread.fetch_add(1, std::memory_order_relaxed) % numlists;
+	osd_work_item *itemlist[WORK_MAX_THREADS + 1] = { nullptr };
+	osd_work_item **item_tailptr[WORK_MAX_THREADS + 1];
+	for (uint32_t listnum = 0; listnum < numlists; listnum++)
+		item_tailptr[listnum] = &itemlist[listnum];
+	osd_work_item *lastitem = nullptr;
 	int itemnum;
 
 	// loop over items, building up a local list of work
@@ -517,20 +682,27 @@ osd_work_item *osd_work_item_queue_multiple(osd_work_queue *queue, osd_work_call
 		item->flags = flags;
 
 		// advance to the next
+		uint32_t const listnum = (firstlist + itemnum) % numlists;
 		lastitem = item;
-		*item_tailptr = item;
-		item_tailptr = &item->next;
+		*item_tailptr[listnum] = item;
+		item_tailptr[listnum] = &item->next;
 		parambase = (uint8_t *)parambase + paramstep;
 	}
 
-	// enqueue the whole thing within the critical section
+	// append each thread's share within its critical section
+	for (uint32_t listnum = 0; listnum < numlists; listnum++)
 	{
-		std::lock_guard<std::mutex> lock(queue->lock);
-		*queue->tailptr = itemlist;
-		queue->tailptr = item_tailptr;
+		if (itemlist[listnum] != nullptr)
+		{
+			work_thread_info *thread = queue->thread[listnum];
+			std::lock_guard<std::mutex> lock(thread->lock);
+			*thread->tailptr = itemlist[listnum];
+			thread->tailptr = item_tailptr[listnum];
+		}
 	}
 
 	// increment the number of items in the queue
+	queue->pending += numitems;
 	queue->items += numitems;
 	add_to_stat(queue->itemsqueued, numitems);
 
@@ -672,6 +844,8 @@ static void *worker_thread_entry(void *param)
 	auto *thread = (work_thread_info *)param;
 	osd_work_queue &queue = thread->queue;
 
+	osd_thread_set_role((queue.flags & WORK_QUEUE_FLAG_IO) ? OSD_THREAD_ROLE_IO : OSD_THREAD_ROLE_WORK);
+
 	// loop until we exit
 	for ( ;; )
 	{
@@ -700,11 +874,11 @@ static void *worker_thread_entry(void *param)
 			worker_thread_process(&queue, thread);
 
 			// if we're a high frequency queue, spin for a while before giving up
-			if (queue.flags & WORK_QUEUE_FLAG_HIGH_FREQ && queue.list.load() == nullptr)
+			if (queue.flags & WORK_QUEUE_FLAG_HIGH_FREQ && !queue_has_list_items(&queue))
 			{
 				// spin for a while looking for more work
 				begin_timing(thread->spintime);
-				spin_while<std::atomic<osd_work_item *>, osd_work_item *>(&queue.list, (osd_work_item *)nullptr, SPIN_LOOP_TIME);
+				spin_while<std::atomic<int32_t>, int32_t>(&queue.pending, 0, SPIN_LOOP_TIME);
 				end_timing(thread->spintime);
 			}
 
@@ -736,32 +910,8 @@ static void worker_thread_process(osd_work_queue *queue, work_thread_info *threa
 	// loop until everything is processed
 	while (true)
 	{
-		osd_work_item *item = nullptr;
-
-		bool end_loop = false;
-
-		// use a critical section to synchronize the removal of items
-		{
-			std::lock_guard<std::mutex> lock(queue->lock);
-
-			if (queue->list.load() == nullptr)
-			{
-				end_loop = true;
-			}
-			else
-			{
-				// pull the item from the queue
-				item = (osd_work_item *)queue->list;
-				if (item != nullptr)
-				{
-					queue->list = item->next;
-					if (queue->list.load() == nullptr)
-						queue->tailptr = (osd_work_item **)&queue->list;
-				}
-			}
-		}
-
-		if (end_loop)
+		osd_work_item *item = pop_work_item(queue, thread);
+		if (item == nullptr)
 			break;
 
 		// process non-NULL items
@@ -811,7 +961,39 @@ static void worker_thread_process(osd_work_queue *queue, work_thread_info *threa
 
 bool queue_has_list_items(osd_work_queue *queue)
 {
-	std::lock_guard<std::mutex> lock(queue->lock);
-	bool has_list_items = (queue->list.load() != nullptr);
-	return has_list_items;
+	return queue->pending > 0;
+}
+
+
+//============================================================
+//  pop_work_item
+//============================================================
+
+static osd_work_item *pop_work_item(osd_work_queue *queue, work_thread_info *thread)
+{
+	// take from our own list first, then steal from the others in turn
+	uint32_t const numlists = queue->thread.size();
+	for (uint32_t offset = 0; (offset < numlists) && queue_has_list_items(queue); offset++)
+	{
+		work_thread_info *victim = queue->thread[(thread->id + offset) % numlists];
+		std::unique_lock<std::mutex> lock(victim->lock, std::try_to_lock);
+		if (!lock.owns_lock())
+		{
+			add_to_stat(queue->contended, 1);
+			lock.lock();
+		}
+
+		osd_work_item *item = victim->list;
+		if (item != nullptr)
+		{
+			victim->list = item->next;
+			if (victim->list == nullptr)
+				victim->tailptr = &victim->list;
+			--queue->pending;
+			if (offset != 0)
+				add_to_stat(queue->steals, 1);
+			return item;
+		}
+	}
+	return nullptr;
 }
@@ -526,6 +526,7 @@ void sdl_window_info::update()
 			else
 			{
 				// otherwise, render with our drawing system
+				auto trace = g_tracer.begin("osd draw");
 				if (video_config.perftest)
 					measure_fps(update);
 				else
@@ -171,6 +171,12 @@ void windows_osd_interface::extract_video_config()
 
 	video_config.waitvsync     = options().wait_vsync();
 	video_config.syncrefresh   = options().sync_refresh();
+	video_config.vrr           = options().vrr();
+	if (video_config.vrr && video_config.syncrefresh)
+	{
+		osd_printf_warning("-syncrefresh specified with -vrr. Reverting to -nosyncrefresh\n");
+		video_config.syncrefresh = 0;
+	}
 	video_config.triplebuf     = options().triple_buffer();
 	video_config.switchres     = options().switch_res();
 
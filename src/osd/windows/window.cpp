@@ -1336,6 +1336,7 @@ void win_window_info::draw_video_contents(HDC dc, bool update)
 			m_dc = dc;
 			if (has_renderer())
 			{
+				auto trace = g_tracer.begin("osd draw");
 				renderer().draw(update);
 			}
 		}
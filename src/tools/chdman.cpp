@@ -20,6 +20,7 @@
 #include "strformat.h"
 #include "vbiparse.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cctype>
 #include <cstdarg>
@@ -31,6 +32,7 @@
 #include <limits>
 #include <memory>
 #include <new>
+#include <thread>
 #include <unordered_map>
 
 using util::string_format;
@@ -587,6 +589,49 @@ private:
 };
 
 
+// ======================> parallel_chd_reader
+
+// decompresses batches of a CHD on worker threads, each with its own
+// open instance of the file, while the previous batch is consumed
+class parallel_chd_reader
+{
+public:
+	// construction/destruction
+	parallel_chd_reader(const parameters_map &params, chd_file &input_chd);
+	~parallel_chd_reader();
+
+	// start reading the next batch, which must follow the previous one
+	void queue(uint64_t offset, uint64_t end);
+
+	// wait for the queued batch and return its data
+	const uint8_t *wait(uint32_t &length);
+
+private:
+	// one open CHD and the chunk of the batch it is decompressing
+	struct reader
+	{
+		chd_file                    parent;
+		chd_file                    file;
+		chd_file *                  chd;
+		uint8_t *                   dest;
+		uint64_t                    offset;
+		uint32_t                    length;
+		std::error_condition        err;
+	};
+
+	static void *read_callback(void *param, int threadid);
+
+	// internal state
+	const parameters_map &          m_params;
+	osd_work_queue *                m_queue;
+	std::vector<std::unique_ptr<reader>> m_readers;
+	std::vector<uint8_t>            m_buffer[2];
+	uint32_t                        m_chunk_bytes;
+	uint32_t                        m_batch_length;
+	int                             m_current;
+};
+
+
 
 //**************************************************************************
 //  GLOBAL VARIABLES
@@ -628,7 +673,7 @@ static const option_description s_options[] =
 	{ OPTION_INDEX,                 "ix",   true, " <index>: indexed instance of this metadata tag" },
 	{ OPTION_VALUE_TEXT,            "vt",   true, " <text>: text for the metadata" },
 	{ OPTION_VALUE_FILE,            "vf",   true, " <file>: file containing data to add" },
-	{ OPTION_NUMPROCESSORS,         "np",   true, " <processors>: limit the number of processors to use during compression" },
+	{ OPTION_NUMPROCESSORS,         "np",   true, " <processors>: limit the number of processors to use during compression, verification and raw/DVD extraction" },
 	{ OPTION_NO_CHECKSUM,           "nocs", false, ": do not include this metadata information in the overall SHA-1" },
 	{ OPTION_FIX,                   "f",    false, ": fix the SHA-1 if it is incorrect" },
 	{ OPTION_VERBOSE,               "v",    false, ": output additional information" },
@@ -650,7 +695,8 @@ static const command_description s_commands[] =
 	{ COMMAND_VERIFY, do_verify, ": verifies a CHD's integrity",
 		{
 			REQUIRED OPTION_INPUT,
-			OPTION_INPUT_PARENT
+			OPTION_INPUT_PARENT,
+			OPTION_NUMPROCESSORS
 		}
 	},
 
@@ -737,7 +783,8 @@ static const command_description s_commands[] =
 			OPTION_INPUT_START_BYTE,
 			OPTION_INPUT_START_HUNK,
 			OPTION_INPUT_LENGTH_BYTES,
-			OPTION_INPUT_LENGTH_HUNKS
+			OPTION_INPUT_LENGTH_HUNKS,
+			OPTION_NUMPROCESSORS
 		}
 	},
 
@@ -771,6 +818,7 @@ static const command_description s_commands[] =
 			OPTION_OUTPUT_FORCE,
 			REQUIRED OPTION_INPUT,
 			OPTION_INPUT_PARENT,
+			OPTION_NUMPROCESSORS
 		}
 	},
 
@@ -1254,6 +1302,120 @@ static void parse_numprocessors(const parameters_map &params)
 }
 
 
+//-------------------------------------------------
+//  parallel_chd_reader - open an instance of the
+//  input CHD for each worker
+//-------------------------------------------------
+
+parallel_chd_reader::parallel_chd_reader(const parameters_map &params, chd_file &input_chd)
+	: m_params(params)
+	, m_queue(nullptr)
+	, m_chunk_bytes(0)
+	, m_batch_length(0)
+	, m_current(0)
+{
+	// honour -numprocessors, then fall back to the number of hardware threads
+	extern int osd_num_processors;
+	int const count = std::clamp(osd_num_processors > 0 ? osd_num_processors : int(std::thread::hardware_concurrency()), 1, WORK_MAX_THREADS);
+
+	// the caller's instance handles the first chunk; open more for the rest
+	for (int index = 0; index < count; index++)
+	{
+		m_readers.emplace_back(std::make_unique<reader>());
+		if (index == 0)
+			m_readers[index]->chd = &input_chd;
+		else
+		{
+			parse_input_chd_parameters(params, m_readers[index]->file, m_readers[index]->parent);
+			m_readers[index]->chd = &m_readers[index]->file;
+		}
+	}
+
+	// split the temporary buffer into hunk-aligned chunks
+	uint32_t const hunkbytes = input_chd.hunk_bytes();
+	m_chunk_bytes = std::max<uint32_t>(1, TEMP_BUFFER_SIZE / hunkbytes / count) * hunkbytes;
+	m_buffer[0].resize(size_t(m_chunk_bytes) * count);
+	m_buffer[1].resize(size_t(m_chunk_bytes) * count);
+
+	if (count > 1)
+		m_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+}
+
+
+//-------------------------------------------------
+//  ~parallel_chd_reader - wait for outstanding
+//  work before freeing anything
+//-------------------------------------------------
+
+parallel_chd_reader::~parallel_chd_reader()
+{
+	if (m_queue != nullptr)
+	{
+		osd_work_queue_wait(m_queue, 30 * osd_ticks_per_second());
+		osd_work_queue_free(m_queue);
+	}
+}
+
+
+//-------------------------------------------------
+//  queue - start decompressing the next batch
+//  into the buffer not currently being consumed
+//-------------------------------------------------
+
+void parallel_chd_reader::queue(uint64_t offset, uint64_t end)
+{
+	m_current ^= 1;
+	uint8_t *dest = &m_buffer[m_current][0];
+	m_batch_length = 0;
+	for (auto &reader : m_readers)
+	{
+		reader->dest = dest;
+		reader->offset = offset;
+		reader->length = (std::min<uint64_t>)(m_chunk_bytes, end - offset);
+		reader->err.clear();
+		dest += reader->length;
+		offset += reader->length;
+		m_batch_length += reader->length;
+	}
+
+	if (m_queue != nullptr)
+		osd_work_item_queue_multiple(m_queue, read_callback, m_readers.size(), &m_readers[0], sizeof(m_readers[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+}
+
+
+//-------------------------------------------------
+//  wait - wait for the queued batch and return it
+//-------------------------------------------------
+
+const uint8_t *parallel_chd_reader::wait(uint32_t &length)
+{
+	if (m_queue != nullptr)
+		osd_work_queue_wait(m_queue, 30 * osd_ticks_per_second());
+	else
+		read_callback(&m_readers[0], 0);
+
+	for (auto &reader : m_readers)
+		if (reader->err)
+			report_error(1, "Error reading CHD file (%s): %s", *m_params.find(OPTION_INPUT)->second, reader->err.message());
+
+	length = m_batch_length;
+	return &m_buffer[m_current][0];
+}
+
+
+//-------------------------------------------------
+//  read_callback - decompress one chunk
+//-------------------------------------------------
+
+void *parallel_chd_reader::read_callback(void *param, int threadid)
+{
+	reader &chunk = **reinterpret_cast<std::unique_ptr<reader> *>(param);
+	if (chunk.length != 0)
+		chunk.err = chunk.chd->read_bytes(chunk.offset, chunk.dest, chunk.length);
+	return nullptr;
+}
+
+
 //-------------------------------------------------
 //  compression_string - create a friendly string
 //  describing a set of compressors
@@ -1629,24 +1791,27 @@ static void do_verify(parameters_map &params)
 	if (raw_sha1 == util::sha1_t::null)
 		report_error(0, "No verification to be done; CHD has no checksum");
 
-	// create an array to read into
-	std::vector<uint8_t> buffer((TEMP_BUFFER_SIZE / input_chd.hunk_bytes()) * input_chd.hunk_bytes());
-
-	// read all the data and build up an SHA-1
+	// read all the data and build up an SHA-1, decompressing the next batch while hashing the current one
+	parse_numprocessors(params);
 	util::sha1_creator rawsha1;
-	for (uint64_t offset = 0; offset < input_chd.logical_bytes(); )
 	{
-		progress(false, "Verifying, %.1f%% complete... \r", 100.0 * double(offset) / double(input_chd.logical_bytes()));
+		parallel_chd_reader reader(params, input_chd);
+		uint64_t const end = input_chd.logical_bytes();
+		if (end != 0)
+			reader.queue(0, end);
+		for (uint64_t offset = 0; offset < end; )
+		{
+			progress(false, "Verifying, %.1f%% complete... \r", 100.0 * double(offset) / double(end));
 
-		// determine how much to read
-		uint32_t bytes_to_read = (std::min<uint64_t>)(buffer.size(), input_chd.logical_bytes() - offset);
-		std::error_condition err = input_chd.read_bytes(offset, &buffer[0], bytes_to_read);
-		if (err)
-			report_error(1, "Error reading CHD file (%s): %s", *params.find(OPTION_INPUT)->second, err.message());
+			uint32_t bytes_read;
+			const uint8_t *data = reader.wait(bytes_read);
+			if (offset + bytes_read < end)
+				reader.queue(offset + bytes_read, end);
 
-		// add to the checksum
-		rawsha1.append(&buffer[0], bytes_to_read);
-		offset += bytes_to_read;
+			// add to the checksum
+			rawsha1.append(data, bytes_read);
+			offset += bytes_read;
+		}
 	}
 	util::sha1_t computed_sha1 = rawsha1.finish();
 
@@ -2469,26 +2634,28 @@ static void do_extract_raw(parameters_map &params)
 		if (filerr)
 			report_error(1, "Unable to open file (%s): %s", *output_file_str->second, filerr.message());
 
-		// copy all data
-		std::vector<uint8_t> buffer((TEMP_BUFFER_SIZE / input_chd.hunk_bytes()) * input_chd.hunk_bytes());
+		// copy all data, decompressing the next batch while writing the current one
+		parse_numprocessors(params);
+		parallel_chd_reader reader(params, input_chd);
+		if (input_start < input_end)
+			reader.queue(input_start, input_end);
 		for (uint64_t offset = input_start; offset < input_end; )
 		{
 			progress(false, "Extracting, %.1f%% complete... \r", 100.0 * double(offset - input_start) / double(input_end - input_start));
 
-			// determine how much to read
-			uint32_t bytes_to_read = (std::min<uint64_t>)(buffer.size(), input_end - offset);
-			std::error_condition err = input_chd.read_bytes(offset, &buffer[0], bytes_to_read);
-			if (err)
-				report_error(1, "Error reading CHD file (%s): %s", *params.find(OPTION_INPUT)->second, err.message());
+			uint32_t bytes_read;
+			const uint8_t *data = reader.wait(bytes_read);
+			if (offset + bytes_read < input_end)
+				reader.queue(offset + bytes_read, input_end);
 
 			// write to the output
 			size_t count;
-			std::error_condition const writerr = output_file->write(&buffer[0], bytes_to_read, count);
-			if (writerr || (count != bytes_to_read))
+			std::error_condition const writerr = output_file->write(data, bytes_read, count);
+			if (writerr || (count != bytes_read))
 				report_error(1, "Error writing to file; check disk space (%s)", *output_file_str->second);
 
 			// advance
-			offset += bytes_to_read;
+			offset += bytes_read;
 		}
 
 		// finish up
@@ -2777,26 +2944,28 @@ static void do_extract_dvd(parameters_map &params)
 		if (filerr)
 			report_error(1, "Unable to open file (%s): %s", *output_file_str->second, filerr.message());
 
-		// copy all data
-		std::vector<uint8_t> buffer((TEMP_BUFFER_SIZE / input_chd.hunk_bytes()) * input_chd.hunk_bytes());
+		// copy all data, decompressing the next batch while writing the current one
+		parse_numprocessors(params);
+		parallel_chd_reader reader(params, input_chd);
+		if (input_start < input_end)
+			reader.queue(input_start, input_end);
 		for (uint64_t offset = input_start; offset < input_end; )
 		{
 			progress(false, "Extracting, %.1f%% complete... \r", 100.0 * double(offset - input_start) / double(input_end - input_start));
 
-			// determine how much to read
-			uint32_t bytes_to_read = (std::min<uint64_t>)(buffer.size(), input_end - offset);
-			std::error_condition err = input_chd.read_bytes(offset, &buffer[0], bytes_to_read);
-			if (err)
-				report_error(1, "Error reading CHD file (%s): %s", *params.find(OPTION_INPUT)->second, err.message());
+			uint32_t bytes_read;
+			const uint8_t *data = reader.wait(bytes_read);
+			if (offset + bytes_read < input_end)
+				reader.queue(offset + bytes_read, input_end);
 
 			// write to the output
 			size_t count;
-			std::error_condition const writerr = output_file->write(&buffer[0], bytes_to_read, count);
-			if (writerr || (count != bytes_to_read))
+			std::error_condition const writerr = output_file->write(data, bytes_read, count);
+			if (writerr || (count != bytes_read))
 				report_error(1, "Error writing to file; check disk space (%s)", *output_file_str->second);
 
 			// advance
-			offset += bytes_to_read;
+			offset += bytes_read;
 		}
 
 		// finish up
@@ -14,7 +14,10 @@
 #include "strformat.h"
 
 #include "osdcomm.h"
+#include "osdcore.h"
+#include "osdfile.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cctype>
 #include <cstdarg>
@@ -23,6 +26,8 @@
 #include <cstring>
 #include <ctime>
 #include <exception>
+#include <string>
+#include <vector>
 
 
 static formats_table formats;
@@ -34,6 +39,7 @@ static void display_usage(const char *first_argument)
 	fprintf(stderr, "Usage: \n");
 	fprintf(stderr, "       %s identify <inputfile> [<inputfile> ...]                                 -- Identify an image format\n", exe_name.c_str());
 	fprintf(stderr, "       %s flopconvert [input_format|auto] output_format <inputfile> <outputfile> -- Convert a floppy image\n", exe_name.c_str());
+	fprintf(stderr, "       %s flopconvertdir [input_format|auto] output_format <inputdir> <outputdir> -- Convert every floppy image in a directory\n", exe_name.c_str());
 	fprintf(stderr, "       %s flopcreate output_format filesystem <outputfile>                       -- Create a preformatted floppy image\n", exe_name.c_str());
 	fprintf(stderr, "       %s flopdir input_format filesystem <image>                                -- List the contents of a floppy image\n", exe_name.c_str());
 	fprintf(stderr, "       %s flopread input_format filesystem <image> <path> <outputfile>           -- Extract a file from a floppy image\n", exe_name.c_str());
@@ -227,6 +233,138 @@ static int flopconvert(int argc, char *argv[])
 	return 0;
 }
 
+namespace {
+
+struct convert_job
+{
+	std::string source_path;
+	std::string dest_path;
+	uint64_t size;
+	const floppy_format_info *source_format;    // nullptr to identify
+	const floppy_format_info *dest_format;
+	std::string error;                          // empty on success
+};
+
+void convert_job_run(convert_job &job)
+{
+	image_handler ih;
+	ih.set_on_disk_path(job.source_path);
+
+	const floppy_format_info *source_format = job.source_format;
+	if(!source_format) {
+		// unlike the single image case, don't stop to list candidates
+		auto scores = ih.identify(formats);
+		if(scores.empty()) {
+			job.error = "could not identify the format";
+			return;
+		}
+		if(scores.size() >= 2 && scores[0].first == scores[1].first) {
+			job.error = util::string_format("ambiguous source format (%s or %s)", scores[0].second->m_format->name(), scores[1].second->m_format->name());
+			return;
+		}
+		source_format = scores[0].second;
+	}
+
+	if(ih.floppy_load(source_format)) {
+		job.error = util::string_format("loading as format '%s' failed", source_format->m_format->name());
+		return;
+	}
+
+	ih.set_on_disk_path(job.dest_path);
+	if(ih.floppy_save(job.dest_format))
+		job.error = util::string_format("saving as format '%s' failed", job.dest_format->m_format->name());
+}
+
+void *convert_one(void *param, int threadid)
+{
+	auto &job = *reinterpret_cast<convert_job *>(param);
+	try {
+		convert_job_run(job);
+	} catch(const std::exception &err) {
+		job.error = err.what();
+	}
+	return nullptr;
+}
+
+} // anonymous namespace
+
+static int flopconvertdir(int argc, char *argv[])
+{
+	if(argc!=6) {
+		fprintf(stderr, "Incorrect number of arguments.\n\n");
+		display_usage(argv[0]);
+		return 1;
+	}
+
+	const floppy_format_info *source_format = nullptr;
+	if(core_stricmp(argv[2], "auto")) {
+		source_format = formats.find_floppy_format_info_by_key(argv[2]);
+		if(!source_format) {
+			fprintf(stderr, "Error: Format '%s' unknown\n", argv[2]);
+			return 1;
+		}
+	}
+
+	const floppy_format_info *dest_format = formats.find_floppy_format_info_by_key(argv[3]);
+	if(!dest_format) {
+		fprintf(stderr, "Error: Format '%s' unknown\n", argv[3]);
+		return 1;
+	}
+	if(!dest_format->m_format->supports_save()) {
+		fprintf(stderr, "Error: Saving to format '%s' unsupported\n", argv[3]);
+		return 1;
+	}
+
+	auto dir = osd::directory::open(argv[4]);
+	if(!dir) {
+		fprintf(stderr, "Error: Could not open directory %s\n", argv[4]);
+		return 1;
+	}
+
+	// output files take the first extension of the destination format
+	std::string ext(dest_format->m_format->extensions());
+	ext = ext.substr(0, ext.find(','));
+
+	std::vector<convert_job> jobs;
+	for(const osd::directory::entry *entry = dir->read(); entry; entry = dir->read())
+		if(entry->type == osd::directory::entry::entry_type::FILE) {
+			convert_job &job = jobs.emplace_back();
+			job.source_path = util::path_concat(argv[4], entry->name);
+			job.dest_path = util::path_concat(argv[5], std::string(core_filename_extract_base(entry->name, true)) + '.' + ext);
+			job.size = entry->size;
+			job.source_format = source_format;
+			job.dest_format = dest_format;
+		}
+	dir.reset();
+
+	// start with the biggest images so the last few don't leave the other threads idle
+	std::stable_sort(jobs.begin(), jobs.end(), [] (const convert_job &a, const convert_job &b) { return a.size > b.size; });
+
+	osd_work_queue *queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	if(queue) {
+		for(convert_job &job : jobs)
+			osd_work_item_queue(queue, convert_one, &job, WORK_ITEM_FLAG_AUTO_RELEASE);
+		osd_work_queue_wait(queue, osd_ticks_per_second() * 3600);
+		osd_work_queue_free(queue);
+	} else {
+		for(convert_job &job : jobs)
+			convert_one(&job, 0);
+	}
+
+	int failed = 0;
+	for(const convert_job &job : jobs) {
+		if(job.error.empty()) {
+			printf("%s -> %s\n", job.source_path.c_str(), job.dest_path.c_str());
+		} else {
+			fprintf(stderr, "Error: %s: %s\n", job.source_path.c_str(), job.error.c_str());
+			failed++;
+		}
+	}
+	printf("%d of %d images converted\n", int(jobs.size()) - failed, int(jobs.size()));
+
+	return failed ? 1 : 0;
+}
+
 static fs::meta_data extract_meta_data(int &argc, char *argv[])
 {
 	fs::meta_data result;
@@ -701,6 +839,8 @@ int CLIB_DECL main(int argc, char *argv[])
 			return identify(argc, argv);
 		else if(!core_stricmp("flopconvert", argv[1]))
 			return flopconvert(argc, argv);
+		else if(!core_stricmp("flopconvertdir", argv[1]))
+			return flopconvertdir(argc, argv);
 		else if(!core_stricmp("flopcreate", argv[1]))
 			return flopcreate(argc, argv);
 		else if(!core_stricmp("flopdir", argv[1]))
@@ -213,6 +213,7 @@ using util::BIT;
 #include "eminline.h"
 #include "endianness.h"
 #include "ioprocs.h"
+#include "ioprocsfilter.h"
 #include "osdfile.h"
 #include "strformat.h"
 
@@ -226,6 +227,7 @@ using util::BIT;
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -378,6 +380,11 @@ struct options
 	uint32_t                skip;
 	uint32_t                count;
 	bool                    octal;
+	bool                    trace;
+	bool                    range;
+	offs_t                  range_start;
+	offs_t                  range_end;
+	uint32_t                jobs;
 };
 
 static const dasm_table_entry dasm_table[] =
@@ -1146,6 +1153,8 @@ static int parse_options(int argc, char *argv[], options *opts)
 	bool pending_arch = false;
 	bool pending_skip = false;
 	bool pending_count = false;
+	bool pending_range = false;
+	bool pending_jobs = false;
 
 	memset(opts, 0, sizeof(*opts));
 
@@ -1155,7 +1164,7 @@ static int parse_options(int argc, char *argv[], options *opts)
 
 		// is it a switch?
 		if(curarg[0] == '-' && curarg[1] != '\0') {
-			if(pending_base || pending_arch || pending_skip || pending_count)
+			if(pending_base || pending_arch || pending_skip || pending_count || pending_range || pending_jobs)
 				goto usage;
 
 			if(tolower((uint8_t)curarg[1]) == 'a')
@@ -1178,6 +1187,12 @@ static int parse_options(int argc, char *argv[], options *opts)
 				opts->xchbytes = true;
 			else if(tolower((uint8_t)curarg[1]) == 'o')
 				opts->octal = true;
+			else if(tolower((uint8_t)curarg[1]) == 't')
+				opts->trace = true;
+			else if(tolower((uint8_t)curarg[1]) == 'r')
+				pending_range = true;
+			else if(tolower((uint8_t)curarg[1]) == 'j')
+				pending_jobs = true;
 			else
 				goto usage;
 
@@ -1236,6 +1251,21 @@ static int parse_options(int argc, char *argv[], options *opts)
 				goto usage;
 			pending_count = false;
 
+		} else if(pending_range) {
+			// pc range for traces
+			if(sscanf(curarg, "%x:%x", &opts->range_start, &opts->range_end) != 2)
+				goto usage;
+			opts->range = true;
+			pending_range = false;
+
+		} else if(pending_jobs) {
+			// worker threads, 0 for one per hardware thread
+			if(sscanf(curarg, "%u", &opts->jobs) != 1)
+				goto usage;
+			if(!opts->jobs)
+				opts->jobs = std::max(1U, std::thread::hardware_concurrency());
+			pending_jobs = false;
+
 		} else if(opts->filename == nullptr) {
 			// filename
 			opts->filename = curarg;
@@ -1247,7 +1277,7 @@ static int parse_options(int argc, char *argv[], options *opts)
 	}
 
 	// if we have a dangling option, error
-	if(pending_base || pending_arch || pending_skip || pending_count)
+	if(pending_base || pending_arch || pending_skip || pending_count || pending_range || pending_jobs)
 		goto usage;
 
 	// if no file or no architecture, fail
@@ -1259,7 +1289,15 @@ static int parse_options(int argc, char *argv[], options *opts)
 usage:
 	printf("Usage: %s <filename> -arch <architecture> [-basepc <pc>] \n", argv[0]);
 	printf("   [-norawbytes] [-xchbytes] [-flipped] [-upper] [-lower]\n");
-	printf("   [-skip <n>] [-count <n>] [-octal]\n");
+	printf("   [-skip <n>] [-count <n>] [-octal] [-jobs <n>]\n");
+	printf("   [-trace [-range <start>:<end>]]\n");
+	printf("\n");
+	printf("-jobs disassembles large files in chunks on <n> threads (0 for one per\n");
+	printf("hardware thread); the output is the same as disassembling serially.\n");
+	printf("\n");
+	printf("With -trace, <filename> is a binary trace written by the debugger's trace\n");
+	printf("command, -skip and -count apply to instructions, and -range only shows\n");
+	printf("instructions with a pc in the given range.\n");
 	printf("\n");
 	printf("Supported architectures:");
 	const int colwidth = 1 + std::strlen(std::max_element(std::begin(dasm_table), std::end(dasm_table), [](const dasm_table_entry &a, const dasm_table_entry &b) { return std::strlen(a.name) < std::strlen(b.name); })->name);
@@ -1478,14 +1516,65 @@ int disasm_file(util::random_read &file, u64 length, options &opts)
 
 	// Do the disassembly
 	std::vector<dasm_line> dasm_lines;
-	offs_t curpc = opts.basepc;
-	for(u32 i=0; i < count;) {
-		std::ostringstream stream;
-		offs_t result = disasm->disassemble(stream, curpc, *popcodes, *pparams);
-		offs_t len = result & util::disasm_interface::LENGTHMASK;
-		dasm_lines.emplace_back(dasm_line{ curpc, len, stream.str() });
-		curpc = next_pc(curpc, len);
-		i += len;
+	u64 const endpc = u64(opts.basepc) + count;
+	offs_t const alignment = disasm->opcode_alignment();
+	u64 const chunk = opts.jobs > 1 ? std::max<u64>(0x1000, ((count / opts.jobs) + alignment - 1) / alignment * alignment) : count;
+	if((opts.jobs > 1) && (count > chunk) && !(flags & (util::disasm_interface::NONLINEAR_PC | util::disasm_interface::PAGED)) && (endpc <= 0xffffffff)) {
+		// Linear pcs that don't wrap: disassemble each chunk from its start on its own thread
+		auto const disassemble_range = [popcodes, pparams](util::disasm_interface &dis, u64 start, u64 end, std::vector<dasm_line> &lines) {
+			for(u64 pc = start; pc < end;) {
+				std::ostringstream stream;
+				offs_t result = dis.disassemble(stream, offs_t(pc), *popcodes, *pparams);
+				offs_t len = result & util::disasm_interface::LENGTHMASK;
+				lines.emplace_back(dasm_line{ offs_t(pc), len, stream.str() });
+				pc += len;
+			}
+		};
+
+		u32 const chunks = (count + chunk - 1) / chunk;
+		std::vector<std::vector<dasm_line> > chunk_lines(chunks);
+		std::vector<std::thread> workers;
+		for(u32 i = 1; i < chunks; i++)
+			workers.emplace_back(
+					[&disassemble_range, &chunk_lines, &opts, i, chunk, endpc]() {
+						std::unique_ptr<util::disasm_interface> dis(opts.dasm->alloc());
+						u64 const start = opts.basepc + (u64(i) * chunk);
+						disassemble_range(*dis, start, std::min(start + chunk, endpc), chunk_lines[i]);
+					});
+		disassemble_range(*disasm, opts.basepc, opts.basepc + chunk, dasm_lines);
+		for(auto &worker : workers)
+			worker.join();
+
+		// The previous chunk ran past this one's start; continue it serially
+		// until it lands on an instruction this chunk also decoded, then
+		// take that chunk's lines from there
+		for(u32 i = 1; i < chunks; i++) {
+			u64 const chunk_end = std::min(opts.basepc + (u64(i + 1) * chunk), endpc);
+			u64 pc = u64(dasm_lines.back().pc) + dasm_lines.back().size;
+			auto &lines = chunk_lines[i];
+			auto found = lines.end();
+			while(pc < chunk_end) {
+				found = std::lower_bound(lines.begin(), lines.end(), pc, [](const dasm_line &l, u64 pc) { return l.pc < pc; });
+				if((lines.end() != found) && (found->pc == pc))
+					break;
+				std::vector<dasm_line> line;
+				disassemble_range(*disasm, pc, pc + 1, line);
+				pc += line.front().size;
+				dasm_lines.emplace_back(std::move(line.front()));
+				found = lines.end();
+			}
+			dasm_lines.insert(dasm_lines.end(), std::make_move_iterator(found), std::make_move_iterator(lines.end()));
+		}
+	} else {
+		offs_t curpc = opts.basepc;
+		for(u32 i=0; i < count;) {
+			std::ostringstream stream;
+			offs_t result = disasm->disassemble(stream, curpc, *popcodes, *pparams);
+			offs_t len = result & util::disasm_interface::LENGTHMASK;
+			dasm_lines.emplace_back(dasm_line{ curpc, len, stream.str() });
+			curpc = next_pc(curpc, len);
+			i += len;
+		}
 	}
 
 	// Compute the extrema
@@ -1641,6 +1730,167 @@ int disasm_file(util::random_read &file, u64 length, options &opts)
 }
 
 
+int disasm_trace(util::random_read &file, options &opts)
+{
+	// Check the uncompressed header
+	u8 header[16];
+	std::size_t actual;
+	if(file.read_at(0, header, sizeof(header), actual) || (sizeof(header) != actual) || std::memcmp(header, "MTRC", 4)) {
+		std::fprintf(stderr, "File '%s' is not a binary trace\n", opts.filename);
+		return 1;
+	}
+	if(header[4] != 1) {
+		std::fprintf(stderr, "File '%s' has unsupported trace version %u\n", opts.filename, header[4]);
+		return 1;
+	}
+	int const addr_shift = int8_t(header[6]);
+	int const addr_bits = header[7];
+	int const unit = header[8] ? header[8] : 1;
+	if(addr_shift != opts.dasm->pcshift)
+		std::fprintf(stderr, "Warning: trace address shift %d does not match architecture '%s'\n", addr_shift, opts.dasm->name);
+
+	// The rest is compressed
+	util::read_stream::ptr stream;
+	if(!file.seek(sizeof(header), SEEK_SET))
+		stream = util::zlib_read(file, 16384);
+	if(!stream) {
+		std::fprintf(stderr, "Error reading from file '%s'\n", opts.filename);
+		return 1;
+	}
+	bool eof = false;
+	auto const read = [&stream, &eof](void *buffer, std::size_t length) -> bool {
+		std::size_t total = 0;
+		while(!eof && (total < length)) {
+			std::size_t actual;
+			if(stream->read(reinterpret_cast<u8 *>(buffer) + total, length - total, actual) || !actual)
+				eof = true;
+			total += actual;
+		}
+		return total == length;
+	};
+	auto const read8 = [&read]() -> u8 { u8 v = 0; read(&v, 1); return v; };
+	auto const read16 = [&read]() -> u16 { u8 v[2] = { 0, 0 }; read(v, 2); return v[0] | (v[1] << 8); };
+	auto const read32 = [&read]() -> u32 { u8 v[4] = { 0, 0, 0, 0 }; read(v, 4); return v[0] | (v[1] << 8) | (v[2] << 16) | (u32(v[3]) << 24); };
+	auto const read64 = [&read32]() -> u64 { u64 const l = read32(); return l | (u64(read32()) << 32); };
+	auto const read_string = [&read](std::size_t length) -> std::string { std::string r(length, '\0'); read(&r[0], length); return r; };
+
+	std::string const tag = read_string(read16());
+	std::vector<std::string> registers(read16());
+	for(auto &name : registers)
+		name = read_string(read8());
+	if(eof) {
+		std::fprintf(stderr, "File '%s' is truncated\n", opts.filename);
+		return 1;
+	}
+	util::stream_format(std::cout, "; trace of %s\n", tag);
+
+	// Build the disasm object
+	std::unique_ptr<util::disasm_interface> disasm(opts.dasm->alloc());
+	unidasm_data_buffer buffer(disasm.get(), opts.dasm);
+
+	int const nc = opts.octal ? (addr_bits + 2) / 3 : (addr_bits + 3) / 4;
+	auto const pc_to_string = [&opts, nc](offs_t pc) -> std::string {
+		return util::string_format(opts.octal ? "%0*o" : "%0*x", nc, pc);
+	};
+
+	// Walk the records
+	u32 seen = 0, shown = 0;
+	bool visible = false;
+	std::vector<u8> opcodes;
+	while(!eof) {
+		u8 type;
+		if(!read(&type, 1))
+			break;
+
+		switch(type) {
+		case 1: { // instruction
+			offs_t const pc = read32();
+			opcodes.resize(read8());
+			read(opcodes.data(), opcodes.size());
+
+			visible = (seen++ >= opts.skip) && (!opts.range || ((pc >= opts.range_start) && (pc <= opts.range_end)));
+			if(visible && opts.count && (shown >= opts.count))
+				return 0;
+			if(!visible)
+				break;
+			shown++;
+
+			// the debugger stores each opcode unit little-endian
+			buffer.data = opcodes;
+			if((unit > 1) && (opts.dasm->endian == util::endianness::big))
+				for(std::size_t i = 0; (i + unit) <= buffer.data.size(); i += unit)
+					std::reverse(buffer.data.begin() + i, buffer.data.begin() + i + unit);
+			buffer.size = buffer.data.size();
+			buffer.data.resize(buffer.size + 8, 0x00);
+			buffer.base_pc = pc;
+
+			std::ostringstream dasm;
+			disasm->disassemble(dasm, pc, buffer, buffer);
+			if(opts.norawbytes) {
+				util::stream_format(std::cout, "%s: %s\n", pc_to_string(pc), dasm.str());
+			} else {
+				std::string raw;
+				for(std::size_t i = 0; (i + unit) <= opcodes.size(); i += unit) {
+					u64 value = 0;
+					for(int j = 0; j != unit; j++)
+						value |= u64(opcodes[i + j]) << (8 * j);
+					if(i)
+						raw += ' ';
+					raw += util::string_format("%0*x", unit * 2, value);
+				}
+				util::stream_format(std::cout, "%s: %-20s  %s\n", pc_to_string(pc), raw, dasm.str());
+			}
+			break;
+		}
+
+		case 2: { // registers
+			std::string line;
+			for(int count = read8(); count > 0; count--) {
+				u8 const index = read8();
+				u64 const value = read64();
+				if(visible)
+					line += util::string_format(" %s=%X", (index < registers.size()) ? registers[index] : "?", value);
+			}
+			if(visible && !line.empty())
+				util::stream_format(std::cout, "    ;%s\n", line);
+			break;
+		}
+
+		case 3: { // memory access
+			u8 const space = read8();
+			offs_t const address = read32();
+			u64 const data = read64();
+			u64 const mem_mask = read64();
+			if(visible)
+				util::stream_format(std::cout, "    ; %c %d:%s = %X & %X\n", (space & 0x80) ? 'W' : 'R', space & 0x7f, pc_to_string(address), data, mem_mask);
+			break;
+		}
+
+		case 4: { // interrupt
+			int const irqline = int32_t(read32());
+			offs_t const pc = read32();
+			if(seen >= opts.skip)
+				util::stream_format(std::cout, "\n   (interrupted at %s, IRQ %d)\n\n", pc_to_string(pc), irqline);
+			break;
+		}
+
+		case 5: { // text
+			std::string const text = read_string(read32());
+			if(seen >= opts.skip)
+				std::cout << text;
+			break;
+		}
+
+		default:
+			std::fprintf(stderr, "Unknown record type %u in trace\n", type);
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+
 int main(int argc, char *argv[])
 {
 	// Parse options first
@@ -1702,7 +1952,7 @@ int main(int argc, char *argv[])
 		}
 	}
 
-	int result = disasm_file(*file, length, opts);
+	int result = opts.trace ? disasm_trace(*file, opts) : disasm_file(*file, length, opts);
 
 	file.reset();
 	std::free(data);
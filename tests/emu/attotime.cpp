@@ -9,3 +9,76 @@ TEST_CASE("convert 1 sec to attotime", "[emu]")
    attotime value = attotime::from_seconds(1);
    REQUIRE(value.as_attoseconds() == 1000000000000000000);
 }
+
+TEST_CASE("attotime addition carries into seconds", "[emu]")
+{
+   attotime const a(0, ATTOSECONDS_PER_SECOND - 1);
+   attotime const b(0, 2);
+   attotime const sum = a + b;
+   REQUIRE(sum.seconds() == 1);
+   REQUIRE(sum.attoseconds() == 1);
+
+   attotime acc = a;
+   acc += b;
+   REQUIRE(acc == sum);
+}
+
+TEST_CASE("attotime subtraction borrows from seconds", "[emu]")
+{
+   attotime const a(2, 1);
+   attotime const b(0, 2);
+   attotime const diff = a - b;
+   REQUIRE(diff.seconds() == 1);
+   REQUIRE(diff.attoseconds() == ATTOSECONDS_PER_SECOND - 1);
+   REQUIRE((b - a).as_attoseconds() == -ATTOSECONDS_PER_SECOND);
+   REQUIRE((attotime(1, 0) - attotime(0, 1)).as_attoseconds() == ATTOSECONDS_PER_SECOND - 1);
+   REQUIRE((attotime(0, 1) - attotime(1, 0)).as_attoseconds() == 1 - ATTOSECONDS_PER_SECOND);
+}
+
+TEST_CASE("attotime never saturates", "[emu]")
+{
+   REQUIRE((attotime::never + attotime(0, 1)).is_never());
+   REQUIRE((attotime(ATTOTIME_MAX_SECONDS - 1, ATTOSECONDS_PER_SECOND - 1) + attotime(0, 1)).is_never());
+   REQUIRE((attotime::never - attotime(1, 0)).is_never());
+}
+
+TEST_CASE("attotime tick conversion round trips", "[emu]")
+{
+   u32 const clocks[] = { 1, 3'579'545, 14'318'181, 50'000'000, 333'333'333 };
+   for (u32 clock : clocks)
+   {
+      for (u64 ticks : { u64(0), u64(1), u64(clock) - 1, u64(clock), u64(clock) * 3 + 7 })
+      {
+         attotime const time = attotime::from_ticks(ticks, clock);
+         REQUIRE(time.attoseconds() >= 0);
+         REQUIRE(time.attoseconds() < ATTOSECONDS_PER_SECOND);
+
+         // the tick period is truncated to whole attoseconds, so converting
+         // back may land on the previous tick, but never further away
+         u64 const back = time.as_ticks(clock);
+         if ((ATTOSECONDS_PER_SECOND % clock) == 0)
+            REQUIRE(back == ticks);
+         else
+            REQUIRE(ticks - back <= 1);
+      }
+   }
+}
+
+TEST_CASE("attotime offsets accumulate exactly", "[emu]")
+{
+   // the scheduler tracks slice targets as attosecond offsets from its base
+   // time; stepping through a second in cycle-sized pieces must agree with
+   // the normalized representation at every step
+   attoseconds_t const per_cycle = HZ_TO_ATTOSECONDS(3'579'545);
+   attotime const base(12, ATTOSECONDS_PER_SECOND - per_cycle * 100);
+   attotime local = base;
+   attoseconds_t offset = 0;
+   for (int i = 0; i < 10'000; i++)
+   {
+      attoseconds_t const step = per_cycle * ((i % 37) + 1);
+      local += attotime(0, step);
+      offset += step;
+      REQUIRE((local - base).as_attoseconds() == offset);
+      REQUIRE(base + attotime(0, offset) == local);
+   }
+}
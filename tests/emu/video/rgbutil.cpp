@@ -34,15 +34,7 @@ TEST_CASE("check rgb", "[emu][video]")
 
 	    The following functions are not tested yet:
 	    rgbaint_t()
-	    clamp_and_clear(const u32)
-	    sign_extend(const u32, const u32)
-	    min(const s32)
-	    max(const s32)
-	    blend(const rgbaint_t&, u8)
-	    scale_and_clamp(const rgbaint_t&)
 	    scale_imm_and_clamp(const s32)
-	    scale2_add_and_clamp(const rgbaint_t&, const rgbaint_t&, const rgbaint_t&)
-	    scale_add_and_clamp(const rgbaint_t&, const rgbaint_t&);
 	    scale_imm_add_and_clamp(const s32, const rgbaint_t&);
 	    static bilinear_filter(u32, u32, u32, u32, u8, u8)
 	    bilinear_filter_rgbaint(u32, u32, u32, u32, u8, u8)
@@ -60,6 +52,14 @@ TEST_CASE("check rgb", "[emu][video]")
 	volatile s32 imm;
 	rgbaint_t rgb, other;
 	rgb_t packed;
+
+	// start from a known state - the default constructor doesn't initialise
+	// the value for every implementation
+	expected_a = 0;
+	expected_r = 0;
+	expected_g = 0;
+	expected_b = 0;
+	rgb.zero();
 	auto check_expected = [&] ()
 	{
 		const volatile s32 a = rgb.get_a32();
@@ -473,9 +473,11 @@ TEST_CASE("check rgb", "[emu][video]")
 		check_expected();
 	}
 	
-	// while we have a value loaded that we know doesn't exceed 8-bit range, check the non-clamping convert-to-rgba
+	// with a value loaded that we know doesn't exceed 8-bit range, check the non-clamping convert-to-rgba
 	SECTION("non-clamping convert-to-rgba") 
 	{	
+		imm = random_i32();
+		rgb.set(u32(imm));
 		packed = rgb.to_rgba();
 		REQUIRE(u32(imm) == u32(packed));
 	}
@@ -492,9 +494,11 @@ TEST_CASE("check rgb", "[emu][video]")
 		check_expected();
 	}
 	
-	// while we have a value loaded that we know doesn't exceed 8-bit range, check the non-clamping convert-to-rgba
+	// with a value loaded that we know doesn't exceed 8-bit range, check the non-clamping convert-to-rgba
 	SECTION("non-clamping convert-to-rgba") 
 	{	
+		imm = random_i32();
+		rgb = rgbaint_t(u32(imm));
 		packed = rgb.to_rgba();
 		REQUIRE(u32(imm) == u32(packed));
 	}
@@ -1033,4 +1037,118 @@ TEST_CASE("check rgb", "[emu][video]")
 		rgb.cmplt_imm_rgba(actual_a + 1, std::numeric_limits<s32>::min(), std::numeric_limits<s32>::max(), actual_b);
 		check_expected();
 	}
+
+	// test clamping and scaling with values small enough for every implementation
+	SECTION("rgbaint_t::min and rgbaint_t::max")
+	{
+		actual_a = (rand() % 2048) - 1024;
+		actual_r = (rand() % 2048) - 1024;
+		actual_g = (rand() % 2048) - 1024;
+		actual_b = (rand() % 2048) - 1024;
+		imm = (rand() % 2048) - 1024;
+		expected_a = (actual_a < imm) ? actual_a : imm;
+		expected_r = (actual_r < imm) ? actual_r : imm;
+		expected_g = (actual_g < imm) ? actual_g : imm;
+		expected_b = (actual_b < imm) ? actual_b : imm;
+		rgb.set(actual_a, actual_r, actual_g, actual_b);
+		rgb.min(imm);
+		check_expected();
+		expected_a = (actual_a > imm) ? actual_a : imm;
+		expected_r = (actual_r > imm) ? actual_r : imm;
+		expected_g = (actual_g > imm) ? actual_g : imm;
+		expected_b = (actual_b > imm) ? actual_b : imm;
+		rgb.set(actual_a, actual_r, actual_g, actual_b);
+		rgb.max(imm);
+		check_expected();
+	}
+
+	SECTION("rgbaint_t::clamp_and_clear")
+	{
+		expected_a = 0;
+		expected_r = 0;
+		expected_g = 0xff;
+		expected_b = 0x7f;
+		rgb.set(-1, 0x200, 0x1ff, 0x7f);
+		rgb.clamp_and_clear(0xfffffe00);
+		check_expected();
+	}
+
+	SECTION("rgbaint_t::sign_extend")
+	{
+		expected_a = 0xfffffe00 | 0x180;
+		expected_r = 0x100;
+		expected_g = 0x080;
+		expected_b = 0xfffffe00 | 0x1ff;
+		rgb.set(0x180, 0x100, 0x080, 0x1ff);
+		rgb.sign_extend(0x180, 0xfffffe00);
+		check_expected();
+	}
+
+	SECTION("rgbaint_t::blend")
+	{
+		actual_a = rand() & 0xff;
+		actual_r = rand() & 0xff;
+		actual_g = rand() & 0xff;
+		actual_b = rand() & 0xff;
+		other.set(rand() & 0xff, rand() & 0xff, rand() & 0xff, rand() & 0xff);
+		imm = rand() & 0xff;
+		expected_a = (actual_a * imm + other.get_a32() * (256 - imm)) >> 8;
+		expected_r = (actual_r * imm + other.get_r32() * (256 - imm)) >> 8;
+		expected_g = (actual_g * imm + other.get_g32() * (256 - imm)) >> 8;
+		expected_b = (actual_b * imm + other.get_b32() * (256 - imm)) >> 8;
+		rgb.set(actual_a, actual_r, actual_g, actual_b);
+		rgb.blend(other, u8(imm));
+		check_expected();
+	}
+
+	SECTION("rgbaint_t::scale_and_clamp")
+	{
+		actual_a = (rand() % 2048) - 1024;
+		actual_r = (rand() % 2048) - 1024;
+		actual_g = (rand() % 2048) - 1024;
+		actual_b = (rand() % 2048) - 1024;
+		other.set(rand() % 1024, rand() % 1024, rand() % 1024, rand() % 1024);
+		expected_a = std::clamp<s32>((actual_a * other.get_a32()) >> 8, 0, 255);
+		expected_r = std::clamp<s32>((actual_r * other.get_r32()) >> 8, 0, 255);
+		expected_g = std::clamp<s32>((actual_g * other.get_g32()) >> 8, 0, 255);
+		expected_b = std::clamp<s32>((actual_b * other.get_b32()) >> 8, 0, 255);
+		rgb.set(actual_a, actual_r, actual_g, actual_b);
+		rgb.scale_and_clamp(other);
+		check_expected();
+	}
+
+	SECTION("rgbaint_t::scale_add_and_clamp")
+	{
+		actual_a = (rand() % 2048) - 1024;
+		actual_r = (rand() % 2048) - 1024;
+		actual_g = (rand() % 2048) - 1024;
+		actual_b = (rand() % 2048) - 1024;
+		other.set(rand() % 1024, rand() % 1024, rand() % 1024, rand() % 1024);
+		const rgbaint_t add((rand() % 512) - 256, (rand() % 512) - 256, (rand() % 512) - 256, (rand() % 512) - 256);
+		expected_a = std::clamp<s32>(((actual_a * other.get_a32()) >> 8) + add.get_a32(), 0, 255);
+		expected_r = std::clamp<s32>(((actual_r * other.get_r32()) >> 8) + add.get_r32(), 0, 255);
+		expected_g = std::clamp<s32>(((actual_g * other.get_g32()) >> 8) + add.get_g32(), 0, 255);
+		expected_b = std::clamp<s32>(((actual_b * other.get_b32()) >> 8) + add.get_b32(), 0, 255);
+		rgb.set(actual_a, actual_r, actual_g, actual_b);
+		rgb.scale_add_and_clamp(other, add);
+		check_expected();
+	}
+
+	SECTION("rgbaint_t::scale2_add_and_clamp")
+	{
+		actual_a = (rand() % 2048) - 1024;
+		actual_r = (rand() % 2048) - 1024;
+		actual_g = (rand() % 2048) - 1024;
+		actual_b = (rand() % 2048) - 1024;
+		other.set(rand() % 1024, rand() % 1024, rand() % 1024, rand() % 1024);
+		const rgbaint_t color2((rand() % 2048) - 1024, (rand() % 2048) - 1024, (rand() % 2048) - 1024, (rand() % 2048) - 1024);
+		const rgbaint_t scale2(rand() % 1024, rand() % 1024, rand() % 1024, rand() % 1024);
+		expected_a = std::clamp<s32>((actual_a * other.get_a32() + color2.get_a32() * scale2.get_a32()) >> 8, 0, 255);
+		expected_r = std::clamp<s32>((actual_r * other.get_r32() + color2.get_r32() * scale2.get_r32()) >> 8, 0, 255);
+		expected_g = std::clamp<s32>((actual_g * other.get_g32() + color2.get_g32() * scale2.get_g32()) >> 8, 0, 255);
+		expected_b = std::clamp<s32>((actual_b * other.get_b32() + color2.get_b32() * scale2.get_b32()) >> 8, 0, 255);
+		rgb.set(actual_a, actual_r, actual_g, actual_b);
+		rgb.scale2_add_and_clamp(other, color2, scale2);
+		check_expected();
+	}
 }
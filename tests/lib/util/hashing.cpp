@@ -0,0 +1,31 @@
+#include "catch.hpp"
+
+#include "hashing.h"
+
+#include <algorithm>
+#include <vector>
+
+TEST_CASE("XXH64 reference values", "[util]")
+{
+	REQUIRE(util::xxh64_creator::simple("", 0) == 0xef46db3751d8e999U);
+	REQUIRE(util::xxh64_creator::simple("a", 1) == 0xd24ec4f1a98c6e5bU);
+	REQUIRE(util::xxh64_creator::simple("abc", 3) == 0x44bc2cf5ad770999U);
+}
+
+TEST_CASE("XXH64 streaming matches one shot", "[util]")
+{
+	std::vector<uint8_t> data(1000);
+	for (std::size_t i = 0; data.size() > i; ++i)
+		data[i] = uint8_t(i * 7);
+
+	util::xxh64_creator creator(5);
+	std::size_t offset = 0, chunk = 1;
+	while (data.size() > offset)
+	{
+		std::size_t const length = std::min(chunk, data.size() - offset);
+		creator.append(&data[offset], length);
+		offset += length;
+		chunk = (chunk * 3) % 37 + 1;
+	}
+	REQUIRE(creator.finish() == util::xxh64_creator::simple(data.data(), data.size(), 5));
+}